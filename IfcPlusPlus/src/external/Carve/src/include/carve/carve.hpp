@@ -113,6 +113,29 @@ namespace carve {
         }
     };
 
+    /**
+     * \brief Thrown by check_interrupt(), when the interrupt check of the
+     * calling thread asks to stop.
+     */
+    struct interrupted : public exception {
+        interrupted() : exception("operation interrupted") {}
+    };
+
+    typedef bool (*interrupt_check_t)(const void* data);
+
+    /**
+     * \brief Sets the interrupt check of the calling thread. Long running
+     * loops of carve::csg::CSG call check(data) through check_interrupt().
+     * Pass nullptr to remove it.
+     */
+    void set_interrupt_check(interrupt_check_t check, const void* data);
+
+    /**
+     * \brief Throws carve::interrupted if the interrupt check of the calling
+     * thread returns true.
+     */
+    void check_interrupt();
+
     template <typename iter_t,
         typename order_t =
         std::less<typename std::iterator_traits<iter_t>::value_type> >
@@ -149,8 +149,14 @@ namespace carve {
 				virtual ~Collector() {}
 			};
 
-		private:
+		public:
+			/// R-tree of mesh faces, used to find candidate pairs of intersecting faces.
 			typedef carve::geom::RTreeNode<3, carve::mesh::Face<3>*> face_rtree_t;
+
+			/// Build the face R-tree of \a meshset, as used by compute(). The caller owns the result.
+			static face_rtree_t* constructFaceRTree(meshset_t* meshset);
+
+		private:
 			typedef std::unordered_map<carve::mesh::Face<3>*, std::vector<carve::mesh::Face<3>*> > face_pairs_t;
 
 			/// The computed intersection data.
@@ -373,6 +379,14 @@ namespace carve {
 			 */
 			meshset_t* compute(meshset_t* a, meshset_t* b, CSG::Collector& collector, carve::csg::CSG::OP op, V2Set* shared_edges = nullptr, CLASSIFY_TYPE classify_type = CLASSIFY_NORMAL);
 
+			/**
+			 * \brief Compute a CSG operation, using face R-trees that have been built before by constructFaceRTree.
+			 *
+			 * The trees only depend on the operand meshes, so they can be reused for several operations on unchanged operands.
+			 * If a tree is NULL, it is built for this operation only.
+			 */
+			meshset_t* compute(meshset_t* a, const face_rtree_t* a_rtree, meshset_t* b, const face_rtree_t* b_rtree, CSG::Collector& collector, carve::csg::CSG::OP op, V2Set* shared_edges = nullptr, CLASSIFY_TYPE classify_type = CLASSIFY_NORMAL);
+
 			/**
 			 * \brief Compute a CSG operation between two closed polyhedra, \a a and \a b.
 			 *
@@ -387,6 +401,11 @@ namespace carve {
 			 */
 			meshset_t* compute(meshset_t* a, meshset_t* b, OP op, V2Set* shared_edges = nullptr, CLASSIFY_TYPE classify_type = CLASSIFY_NORMAL);
 
+			/**
+			 * \brief Compute a CSG operation between two closed polyhedra, using prebuilt face R-trees (see constructFaceRTree).
+			 */
+			meshset_t* compute(meshset_t* a, const face_rtree_t* a_rtree, meshset_t* b, const face_rtree_t* b_rtree, OP op, V2Set* shared_edges = nullptr, CLASSIFY_TYPE classify_type = CLASSIFY_NORMAL);
+
 			meshset_t* classifyInnerMeshes(meshset_t* a, V2Set* shared_edges = nullptr, CLASSIFY_TYPE classify_type = CLASSIFY_NORMAL);
 
 			void slice(meshset_t* a, meshset_t* b, std::list<meshset_t*>& a_sliced, std::list<meshset_t*>& b_sliced, V2Set* shared_edges = nullptr);
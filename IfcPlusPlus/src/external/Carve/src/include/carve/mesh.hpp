@@ -33,6 +33,8 @@
 #include <carve/rtree.hpp>
 #include <carve/tag.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 
 #if defined _DEBUG || defined _DEBUG_RELEASE
@@ -703,6 +705,7 @@ namespace carve {
 					faces[i]->recalc(CARVE_EPSILON);
 				}
 				calcOrientation();
+				touchMeshSet();
 			}
 
 			void invert()
@@ -715,8 +718,12 @@ namespace carve {
 				{
 					is_negative = !is_negative;
 				}
+				touchMeshSet();
 			}
 
+			// marks the owning MeshSet as modified
+			void touchMeshSet();
+
 			Mesh* clone(const vertex_t* old_base, vertex_t* new_base) const;
 		};
 
@@ -742,6 +749,20 @@ namespace carve {
 			std::vector<mesh_t*> meshes;
 			//bool m_inner_outer_meshes_classified = false;
 
+			// Revision stamp for caches of derived data. It is unique over all MeshSets of the process, so a cached
+			// value can be identified by (pointer, revision) even if the memory of a deleted MeshSet is reused.
+			// Code that modifies vertices, faces or meshes without calling recalc, invert or cacheEdges has to call touch().
+			uint64_t revision() const { return m_revision; }
+			void touch() { m_revision = nextRevision(); }
+
+		private:
+			static uint64_t nextRevision()
+			{
+				static std::atomic<uint64_t> revisionCounter(0);
+				return ++revisionCounter;
+			}
+			uint64_t m_revision = nextRevision();
+
 		public:
 			template <typename face_type>
 			struct FaceIter {
@@ -836,6 +857,7 @@ namespace carve {
 				for( size_t i = 0; i < meshes.size(); ++i ) {
 					meshes[i]->recalc();
 				}
+				touch();
 			}
 
 			MeshSet(const std::vector<typename vertex_t::vector_t>& points, size_t n_faces, const std::vector<int>& face_indices, double CARVE_EPSILON, const MeshOptions& opts = MeshOptions());
@@ -812,9 +812,19 @@ namespace detail {
     }
 }  // namespace detail
 
+template <unsigned int ndim>
+void Mesh<ndim>::touchMeshSet()
+{
+    if (meshset != nullptr)
+    {
+        meshset->touch();
+    }
+}
+
 template <unsigned int ndim>
 void Mesh<ndim>::cacheEdges()
 {
+    touchMeshSet();
     closed_edges.clear();
     open_edges.clear();
 
@@ -1336,6 +1346,7 @@ void MeshSet<ndim>::collectVertices() {
     }
 
     std::swap(vertex_storage, new_vertex_storage);
+    touch();
 }
 
 template <unsigned int ndim>
@@ -1370,6 +1381,7 @@ void MeshSet<ndim>::canonicalize()
     }
 
     vertex_storage.swap(vout);
+    touch();
 }
 
 template <unsigned int ndim>
@@ -1409,6 +1421,7 @@ void MeshSet<ndim>::separateMeshes() {
     }
 
     vertex_storage.swap(vout);
+    touch();
 }
 }  // namespace mesh
 }  // namespace carve
@@ -28,6 +28,22 @@
 
 #include <carve/carve.hpp>
 
+namespace {
+    thread_local carve::interrupt_check_t interrupt_check = nullptr;
+    thread_local const void* interrupt_check_data = nullptr;
+}
+
+void carve::set_interrupt_check(interrupt_check_t check, const void* data) {
+    interrupt_check = check;
+    interrupt_check_data = data;
+}
+
+void carve::check_interrupt() {
+    if (interrupt_check != nullptr && interrupt_check(interrupt_check_data)) {
+        throw carve::interrupted();
+    }
+}
+
 //#define DEF_EPSILON 1.4901161193847656e-08
 //namespace carve {
 	//double CARVE_EPSILON_INTERNAL[24] = { DEF_EPSILON,	DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON, DEF_EPSILON };
@@ -938,26 +938,31 @@ void carve::csg::CSG::generateIntersections(meshset_t* a, const face_rtree_t* a_
 
 	for( face_pairs_t::const_iterator i = face_pairs.begin(); i != face_pairs.end(); ++i )
 	{
+		carve::check_interrupt();
 		generateVertexVertexIntersections((*i).first, (*i).second);
 	}
 
 	for( face_pairs_t::const_iterator i = face_pairs.begin(); i != face_pairs.end(); ++i )
 	{
+		carve::check_interrupt();
 		generateVertexEdgeIntersections((*i).first, (*i).second);
 	}
 
 	for( face_pairs_t::const_iterator i = face_pairs.begin(); i != face_pairs.end(); ++i )
 	{
+		carve::check_interrupt();
 		generateEdgeEdgeIntersections((*i).first, (*i).second);
 	}
 
 	for( face_pairs_t::const_iterator i = face_pairs.begin(); i != face_pairs.end(); ++i )
 	{
+		carve::check_interrupt();
 		generateVertexFaceIntersections((*i).first, (*i).second);
 	}
 
 	for( face_pairs_t::const_iterator i = face_pairs.begin(); i != face_pairs.end(); ++i )
 	{
+		carve::check_interrupt();
 		generateEdgeFaceIntersections((*i).first, (*i).second);
 	}
 
@@ -1034,6 +1039,7 @@ void carve::csg::CSG::makeFaceEdges(carve::csg::EdgeClassification& eclass, deta
 	for( detail::FVSMap::const_iterator i = data.fmap.begin(),
 		ie = data.fmap.end();
 		i != ie; ++i ) {
+		carve::check_interrupt();
 		meshset_t::face_t* face_a = (*i).first;
 		const detail::FVSMap::mapped_type& face_a_intersections = ((*i).second);
 		face_b_set.clear();
@@ -1424,6 +1430,17 @@ void returnSharedEdges(carve::csg::V2Set& shared_edges, std::list<carve::mesh::M
  * @return
  */
 carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, carve::csg::CSG::Collector& collector, carve::csg::CSG::OP op, carve::csg::V2Set* shared_edges_ptr, CLASSIFY_TYPE classify_type)
+{
+	return compute(a, nullptr, b, nullptr, collector, op, shared_edges_ptr, classify_type);
+}
+
+carve::csg::CSG::face_rtree_t* carve::csg::CSG::constructFaceRTree(meshset_t* meshset)
+{
+	return face_rtree_t::construct_STR(meshset->faceBegin(), meshset->faceEnd(), 4, 4);
+}
+
+carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, const face_rtree_t* a_rtree_prebuilt, meshset_t* b, const face_rtree_t* b_rtree_prebuilt, carve::csg::CSG::Collector& collector, carve::csg::CSG::OP op,
+	carve::csg::V2Set* shared_edges_ptr, CLASSIFY_TYPE classify_type)
 {
 	static carve::TimingName FUNC_NAME("CSG::compute");
 	carve::TimingBlock block(FUNC_NAME);
@@ -1440,13 +1457,25 @@ carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, c
 	size_t a_edge_count;
 	size_t b_edge_count;
 
-	std::unique_ptr<face_rtree_t> a_rtree( face_rtree_t::construct_STR(a->faceBegin(), a->faceEnd(), 4, 4));
-	std::unique_ptr<face_rtree_t> b_rtree( face_rtree_t::construct_STR(b->faceBegin(), b->faceEnd(), 4, 4));
+	std::unique_ptr<face_rtree_t> a_rtree_local;
+	std::unique_ptr<face_rtree_t> b_rtree_local;
+	const face_rtree_t* a_rtree = a_rtree_prebuilt;
+	const face_rtree_t* b_rtree = b_rtree_prebuilt;
+	if( !a_rtree )
+	{
+		a_rtree_local.reset(constructFaceRTree(a));
+		a_rtree = a_rtree_local.get();
+	}
+	if( !b_rtree )
+	{
+		b_rtree_local.reset(constructFaceRTree(b));
+		b_rtree = b_rtree_local.get();
+	}
 
 	{
 		static carve::TimingName FUNC_NAME("CSG::compute - calc()");
 		carve::TimingBlock block(FUNC_NAME);
-		calc(a, a_rtree.get(), b, b_rtree.get(), vclass, eclass, a_face_loops, b_face_loops, a_edge_count, b_edge_count);
+		calc(a, a_rtree, b, b_rtree, vclass, eclass, a_face_loops, b_face_loops, a_edge_count, b_edge_count);
 	}
 
 	detail::LoopEdges a_edge_map;
@@ -1518,13 +1547,14 @@ carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, c
 	}
 #endif
 
+	carve::check_interrupt();
 	switch( classify_type )
 	{
 	case CLASSIFY_EDGE:
-		classifyFaceGroupsEdge(shared_edges, vclass, a, a_rtree.get(), a_loops_grouped, a_edge_map, b, b_rtree.get(), b_loops_grouped, b_edge_map, collector);
+		classifyFaceGroupsEdge(shared_edges, vclass, a, a_rtree, a_loops_grouped, a_edge_map, b, b_rtree, b_loops_grouped, b_edge_map, collector);
 		break;
 	case CLASSIFY_NORMAL:
-		classifyFaceGroups(shared_edges, vclass, a, a_rtree.get(), a_loops_grouped, a_edge_map, b, b_rtree.get(), b_loops_grouped, b_edge_map, collector);
+		classifyFaceGroups(shared_edges, vclass, a, a_rtree, a_loops_grouped, a_edge_map, b, b_rtree, b_loops_grouped, b_edge_map, collector);
 		break;
 	}
 
@@ -1602,6 +1632,11 @@ carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, c
  * @return
  */
 carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, carve::csg::CSG::OP op, carve::csg::V2Set* shared_edges, CLASSIFY_TYPE classify_type) 
+{
+	return compute(a, nullptr, b, nullptr, op, shared_edges, classify_type);
+}
+
+carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, const face_rtree_t* a_rtree, meshset_t* b, const face_rtree_t* b_rtree, carve::csg::CSG::OP op, carve::csg::V2Set* shared_edges, CLASSIFY_TYPE classify_type)
 {
 	if (a->vertex_storage.size() == 0 || b->vertex_storage.size() ==0)
 	{
@@ -1616,7 +1651,7 @@ carve::mesh::MeshSet<3>* carve::csg::CSG::compute( meshset_t* a, meshset_t* b, c
 	meshset_t* result = nullptr;
 	try
 	{
-		result = compute(a, b, *coll, op, shared_edges, classify_type);
+		result = compute(a, a_rtree, b, b_rtree, *coll, op, shared_edges, classify_type);
 	}
 	catch (carve::exception& ce)
 	{
@@ -814,6 +814,7 @@ namespace carve {
 
 			for( FLGroupList::iterator i = a_loops_grouped.begin(); i != a_loops_grouped.end(); ++i )
 			{
+				carve::check_interrupt();
 				if( (*i).classification.size() == 0 )
 				{
 #if defined(CARVE_DEBUG)
@@ -856,6 +857,7 @@ namespace carve {
 			size_t numFacesUndefined = 0;
 			for( FLGroupList::iterator it = b_loops_grouped.begin(); it != b_loops_grouped.end(); ++it )
 			{
+				carve::check_interrupt();
 				if( (*it).classification.size() == 0 )
 				{
 #if defined(CARVE_DEBUG)
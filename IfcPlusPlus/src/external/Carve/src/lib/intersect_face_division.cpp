@@ -1746,6 +1746,7 @@ size_t carve::csg::CSG::generateFaceLoops(carve::mesh::MeshSet<3>* poly, const d
 
 	for( carve::mesh::MeshSet<3>::face_iter it = poly->faceBegin(); it != poly->faceEnd(); ++it )
 	{
+		carve::check_interrupt();
 		carve::mesh::Face<3>* face = (*it);
 
 #if defined(CARVE_DEBUG)
@@ -1,5 +1,6 @@
 /* Code generated by IfcQuery EXPRESS generator, www.ifcquery.com */
 
+#include <algorithm>
 #include <map>
 #include <functional>
 #include "ifcpp/model/BasicTypes.h"
@@ -3105,3 +3106,3711 @@ const char* IFC4X3::EntityFactory::getStringForClassID(uint32_t ifcClassID)
 		default: return "unkown entity type"; 
 	}
 }
+static const IFC4X3::EntityClassInfo entity_class_infos[IFC_NUM_ENTITY_CLASSES] = {
+{ 3630933823, 0, 0, 1 },	// IfcActorRole
+{ 618182010, 0, 1, 4 },	// IfcAddress
+{ 3355820592, 618182010, 2, 3 },	// IfcPostalAddress
+{ 912023232, 618182010, 3, 4 },	// IfcTelecomAddress
+{ 2879124712, 0, 4, 8 },	// IfcAlignmentParameterSegment
+{ 3752311538, 2879124712, 5, 6 },	// IfcAlignmentCantSegment
+{ 536804194, 2879124712, 6, 7 },	// IfcAlignmentHorizontalSegment
+{ 3633395639, 2879124712, 7, 8 },	// IfcAlignmentVerticalSegment
+{ 639542469, 0, 8, 9 },	// IfcApplication
+{ 411424972, 0, 9, 11 },	// IfcAppliedValue
+{ 602808272, 411424972, 10, 11 },	// IfcCostValue
+{ 130549933, 0, 11, 12 },	// IfcApproval
+{ 4037036970, 0, 12, 17 },	// IfcBoundaryCondition
+{ 1560379544, 4037036970, 13, 14 },	// IfcBoundaryEdgeCondition
+{ 3367102660, 4037036970, 14, 15 },	// IfcBoundaryFaceCondition
+{ 1387855156, 4037036970, 15, 17 },	// IfcBoundaryNodeCondition
+{ 2069777674, 1387855156, 16, 17 },	// IfcBoundaryNodeConditionWarping
+{ 2859738748, 0, 17, 23 },	// IfcConnectionGeometry
+{ 1981873012, 2859738748, 18, 19 },	// IfcConnectionCurveGeometry
+{ 2614616156, 2859738748, 19, 21 },	// IfcConnectionPointGeometry
+{ 45288368, 2614616156, 20, 21 },	// IfcConnectionPointEccentricity
+{ 2732653382, 2859738748, 21, 22 },	// IfcConnectionSurfaceGeometry
+{ 775493141, 2859738748, 22, 23 },	// IfcConnectionVolumeGeometry
+{ 1959218052, 0, 23, 26 },	// IfcConstraint
+{ 3368373690, 1959218052, 24, 25 },	// IfcMetric
+{ 2251480897, 1959218052, 25, 26 },	// IfcObjective
+{ 1785450214, 0, 26, 30 },	// IfcCoordinateOperation
+{ 3057273783, 1785450214, 27, 29 },	// IfcMapConversion
+{ 4105526436, 3057273783, 28, 29 },	// IfcMapConversionScaled
+{ 1794013214, 1785450214, 29, 30 },	// IfcRigidOperation
+{ 1466758467, 0, 30, 33 },	// IfcCoordinateReferenceSystem
+{ 917726184, 1466758467, 31, 32 },	// IfcGeographicCRS
+{ 3843373140, 1466758467, 32, 33 },	// IfcProjectedCRS
+{ 1765591967, 0, 33, 34 },	// IfcDerivedUnit
+{ 1045800335, 0, 34, 35 },	// IfcDerivedUnitElement
+{ 2949456006, 0, 35, 36 },	// IfcDimensionalExponents
+{ 4294318154, 0, 36, 40 },	// IfcExternalInformation
+{ 747523909, 4294318154, 37, 38 },	// IfcClassification
+{ 1154170062, 4294318154, 38, 39 },	// IfcDocumentInformation
+{ 2655187982, 4294318154, 39, 40 },	// IfcLibraryInformation
+{ 3200245327, 0, 40, 47 },	// IfcExternalReference
+{ 647927063, 3200245327, 41, 42 },	// IfcClassificationReference
+{ 3732053477, 3200245327, 42, 43 },	// IfcDocumentReference
+{ 2242383968, 3200245327, 43, 44 },	// IfcExternallyDefinedHatchStyle
+{ 1040185647, 3200245327, 44, 45 },	// IfcExternallyDefinedSurfaceStyle
+{ 3548104201, 3200245327, 45, 46 },	// IfcExternallyDefinedTextFont
+{ 3452421091, 3200245327, 46, 47 },	// IfcLibraryReference
+{ 852622518, 0, 47, 48 },	// IfcGridAxis
+{ 3020489413, 0, 48, 49 },	// IfcIrregularTimeSeriesValue
+{ 4162380809, 0, 49, 50 },	// IfcLightDistributionData
+{ 1566485204, 0, 50, 51 },	// IfcLightIntensityDistribution
+{ 1847130766, 0, 51, 52 },	// IfcMaterialClassificationRelationship
+{ 760658860, 0, 52, 62 },	// IfcMaterialDefinition
+{ 1838606355, 760658860, 53, 54 },	// IfcMaterial
+{ 3708119000, 760658860, 54, 55 },	// IfcMaterialConstituent
+{ 2852063980, 760658860, 55, 56 },	// IfcMaterialConstituentSet
+{ 248100487, 760658860, 56, 58 },	// IfcMaterialLayer
+{ 1847252529, 248100487, 57, 58 },	// IfcMaterialLayerWithOffsets
+{ 3303938423, 760658860, 58, 59 },	// IfcMaterialLayerSet
+{ 2235152071, 760658860, 59, 61 },	// IfcMaterialProfile
+{ 552965576, 2235152071, 60, 61 },	// IfcMaterialProfileWithOffsets
+{ 164193824, 760658860, 61, 62 },	// IfcMaterialProfileSet
+{ 2199411900, 0, 62, 63 },	// IfcMaterialList
+{ 1507914824, 0, 63, 67 },	// IfcMaterialUsageDefinition
+{ 1303795690, 1507914824, 64, 65 },	// IfcMaterialLayerSetUsage
+{ 3079605661, 1507914824, 65, 67 },	// IfcMaterialProfileSetUsage
+{ 3404854881, 3079605661, 66, 67 },	// IfcMaterialProfileSetUsageTapering
+{ 2597039031, 0, 67, 68 },	// IfcMeasureWithUnit
+{ 2706619895, 0, 68, 69 },	// IfcMonetaryUnit
+{ 1918398963, 0, 69, 74 },	// IfcNamedUnit
+{ 3050246964, 1918398963, 70, 71 },	// IfcContextDependentUnit
+{ 2889183280, 1918398963, 71, 73 },	// IfcConversionBasedUnit
+{ 2713554722, 2889183280, 72, 73 },	// IfcConversionBasedUnitWithOffset
+{ 448429030, 1918398963, 73, 74 },	// IfcSIUnit
+{ 3701648758, 0, 74, 78 },	// IfcObjectPlacement
+{ 178086475, 3701648758, 75, 76 },	// IfcGridPlacement
+{ 388784114, 3701648758, 76, 77 },	// IfcLinearPlacement
+{ 2624227202, 3701648758, 77, 78 },	// IfcLocalPlacement
+{ 4251960020, 0, 78, 79 },	// IfcOrganization
+{ 1207048766, 0, 79, 80 },	// IfcOwnerHistory
+{ 2077209135, 0, 80, 81 },	// IfcPerson
+{ 101040310, 0, 81, 82 },	// IfcPersonAndOrganization
+{ 2483315170, 0, 82, 92 },	// IfcPhysicalQuantity
+{ 3021840470, 2483315170, 83, 84 },	// IfcPhysicalComplexQuantity
+{ 2226359599, 2483315170, 84, 92 },	// IfcPhysicalSimpleQuantity
+{ 2044713172, 2226359599, 85, 86 },	// IfcQuantityArea
+{ 2093928680, 2226359599, 86, 87 },	// IfcQuantityCount
+{ 931644368, 2226359599, 87, 88 },	// IfcQuantityLength
+{ 2691318326, 2226359599, 88, 89 },	// IfcQuantityNumber
+{ 3252649465, 2226359599, 89, 90 },	// IfcQuantityTime
+{ 2405470396, 2226359599, 90, 91 },	// IfcQuantityVolume
+{ 825690147, 2226359599, 91, 92 },	// IfcQuantityWeight
+{ 677532197, 0, 92, 126 },	// IfcPresentationItem
+{ 3285139300, 677532197, 93, 94 },	// IfcColourRgbList
+{ 3264961684, 677532197, 94, 96 },	// IfcColourSpecification
+{ 776857604, 3264961684, 95, 96 },	// IfcColourRgb
+{ 1105321065, 677532197, 96, 97 },	// IfcCurveStyleFont
+{ 2367409068, 677532197, 97, 98 },	// IfcCurveStyleFontAndScaling
+{ 3510044353, 677532197, 98, 99 },	// IfcCurveStyleFontPattern
+{ 3570813810, 677532197, 99, 100 },	// IfcIndexedColourMap
+{ 3727388367, 677532197, 100, 107 },	// IfcPreDefinedItem
+{ 759155922, 3727388367, 101, 103 },	// IfcPreDefinedColour
+{ 445594917, 759155922, 102, 103 },	// IfcDraughtingPreDefinedColour
+{ 2559016684, 3727388367, 103, 105 },	// IfcPreDefinedCurveFont
+{ 4006246654, 2559016684, 104, 105 },	// IfcDraughtingPreDefinedCurveFont
+{ 1775413392, 3727388367, 105, 107 },	// IfcPreDefinedTextFont
+{ 1983826977, 1775413392, 106, 107 },	// IfcTextStyleFontModel
+{ 3303107099, 677532197, 107, 108 },	// IfcSurfaceStyleLighting
+{ 1607154358, 677532197, 108, 109 },	// IfcSurfaceStyleRefraction
+{ 846575682, 677532197, 109, 111 },	// IfcSurfaceStyleShading
+{ 1878645084, 846575682, 110, 111 },	// IfcSurfaceStyleRendering
+{ 1351298697, 677532197, 111, 112 },	// IfcSurfaceStyleWithTextures
+{ 626085974, 677532197, 112, 116 },	// IfcSurfaceTexture
+{ 616511568, 626085974, 113, 114 },	// IfcBlobTexture
+{ 3905492369, 626085974, 114, 115 },	// IfcImageTexture
+{ 597895409, 626085974, 115, 116 },	// IfcPixelTexture
+{ 2636378356, 677532197, 116, 117 },	// IfcTextStyleForDefinedFont
+{ 1640371178, 677532197, 117, 118 },	// IfcTextStyleTextModel
+{ 280115917, 677532197, 118, 124 },	// IfcTextureCoordinate
+{ 1437953363, 280115917, 119, 122 },	// IfcIndexedTextureMap
+{ 3465909080, 1437953363, 120, 121 },	// IfcIndexedPolygonalTextureMap
+{ 2133299955, 1437953363, 121, 122 },	// IfcIndexedTriangleTextureMap
+{ 1742049831, 280115917, 122, 123 },	// IfcTextureCoordinateGenerator
+{ 2552916305, 280115917, 123, 124 },	// IfcTextureMap
+{ 1210645708, 677532197, 124, 125 },	// IfcTextureVertex
+{ 3611470254, 677532197, 125, 126 },	// IfcTextureVertexList
+{ 2022622350, 0, 126, 128 },	// IfcPresentationLayerAssignment
+{ 1304840413, 2022622350, 127, 128 },	// IfcPresentationLayerWithStyle
+{ 3119450353, 0, 128, 134 },	// IfcPresentationStyle
+{ 3800577675, 3119450353, 129, 130 },	// IfcCurveStyle
+{ 738692330, 3119450353, 130, 131 },	// IfcFillAreaStyle
+{ 2417041796, 3119450353, 131, 132 },	// IfcPresentationStyleAssignment
+{ 1300840506, 3119450353, 132, 133 },	// IfcSurfaceStyle
+{ 1447204868, 3119450353, 133, 134 },	// IfcTextStyle
+{ 2095639259, 0, 134, 137 },	// IfcProductRepresentation
+{ 2022407955, 2095639259, 135, 136 },	// IfcMaterialDefinitionRepresentation
+{ 673634403, 2095639259, 136, 137 },	// IfcProductDefinitionShape
+{ 3958567839, 0, 137, 161 },	// IfcProfileDef
+{ 3798115385, 3958567839, 138, 140 },	// IfcArbitraryClosedProfileDef
+{ 2705031697, 3798115385, 139, 140 },	// IfcArbitraryProfileDefWithVoids
+{ 1310608509, 3958567839, 140, 142 },	// IfcArbitraryOpenProfileDef
+{ 3150382593, 1310608509, 141, 142 },	// IfcCenterLineProfileDef
+{ 1485152156, 3958567839, 142, 143 },	// IfcCompositeProfileDef
+{ 3632507154, 3958567839, 143, 145 },	// IfcDerivedProfileDef
+{ 2998442950, 3632507154, 144, 145 },	// IfcMirroredProfileDef
+{ 182550632, 3958567839, 145, 146 },	// IfcOpenCrossProfileDef
+{ 2529465313, 3958567839, 146, 161 },	// IfcParameterizedProfileDef
+{ 3207858831, 2529465313, 147, 148 },	// IfcAsymmetricIShapeProfileDef
+{ 2898889636, 2529465313, 148, 149 },	// IfcCShapeProfileDef
+{ 1383045692, 2529465313, 149, 151 },	// IfcCircleProfileDef
+{ 2937912522, 1383045692, 150, 151 },	// IfcCircleHollowProfileDef
+{ 2835456948, 2529465313, 151, 152 },	// IfcEllipseProfileDef
+{ 1484403080, 2529465313, 152, 153 },	// IfcIShapeProfileDef
+{ 572779678, 2529465313, 153, 154 },	// IfcLShapeProfileDef
+{ 3615266464, 2529465313, 154, 157 },	// IfcRectangleProfileDef
+{ 2770003689, 3615266464, 155, 156 },	// IfcRectangleHollowProfileDef
+{ 2778083089, 3615266464, 156, 157 },	// IfcRoundedRectangleProfileDef
+{ 3071757647, 2529465313, 157, 158 },	// IfcTShapeProfileDef
+{ 2715220739, 2529465313, 158, 159 },	// IfcTrapeziumProfileDef
+{ 427810014, 2529465313, 159, 160 },	// IfcUShapeProfileDef
+{ 2543172580, 2529465313, 160, 161 },	// IfcZShapeProfileDef
+{ 986844984, 0, 161, 179 },	// IfcPropertyAbstraction
+{ 297599258, 986844984, 162, 165 },	// IfcExtendedProperties
+{ 3265635763, 297599258, 163, 164 },	// IfcMaterialProperties
+{ 2802850158, 297599258, 164, 165 },	// IfcProfileProperties
+{ 3778827333, 986844984, 165, 169 },	// IfcPreDefinedProperties
+{ 1580146022, 3778827333, 166, 167 },	// IfcReinforcementBarProperties
+{ 2042790032, 3778827333, 167, 168 },	// IfcSectionProperties
+{ 4165799628, 3778827333, 168, 169 },	// IfcSectionReinforcementProperties
+{ 2598011224, 986844984, 169, 178 },	// IfcProperty
+{ 2542286263, 2598011224, 170, 171 },	// IfcComplexProperty
+{ 3692461612, 2598011224, 171, 178 },	// IfcSimpleProperty
+{ 871118103, 3692461612, 172, 173 },	// IfcPropertyBoundedValue
+{ 4166981789, 3692461612, 173, 174 },	// IfcPropertyEnumeratedValue
+{ 2752243245, 3692461612, 174, 175 },	// IfcPropertyListValue
+{ 941946838, 3692461612, 175, 176 },	// IfcPropertyReferenceValue
+{ 3650150729, 3692461612, 176, 177 },	// IfcPropertySingleValue
+{ 110355661, 3692461612, 177, 178 },	// IfcPropertyTableValue
+{ 3710013099, 986844984, 178, 179 },	// IfcPropertyEnumeration
+{ 3915482550, 0, 179, 180 },	// IfcRecurrencePattern
+{ 2433181523, 0, 180, 181 },	// IfcReference
+{ 1076942058, 0, 181, 187 },	// IfcRepresentation
+{ 3982875396, 1076942058, 182, 185 },	// IfcShapeModel
+{ 4240577450, 3982875396, 183, 184 },	// IfcShapeRepresentation
+{ 1735638870, 3982875396, 184, 185 },	// IfcTopologyRepresentation
+{ 2830218821, 1076942058, 185, 187 },	// IfcStyleModel
+{ 3049322572, 2830218821, 186, 187 },	// IfcStyledRepresentation
+{ 3377609919, 0, 187, 190 },	// IfcRepresentationContext
+{ 3448662350, 3377609919, 188, 190 },	// IfcGeometricRepresentationContext
+{ 4142052618, 3448662350, 189, 190 },	// IfcGeometricRepresentationSubContext
+{ 3008791417, 0, 190, 346 },	// IfcRepresentationItem
+{ 2453401579, 3008791417, 191, 324 },	// IfcGeometricRepresentationItem
+{ 669184980, 2453401579, 192, 193 },	// IfcAnnotationFillArea
+{ 2736907675, 2453401579, 193, 195 },	// IfcBooleanResult
+{ 3649129432, 2736907675, 194, 195 },	// IfcBooleanClippingResult
+{ 2581212453, 2453401579, 195, 196 },	// IfcBoundingBox
+{ 574549367, 2453401579, 196, 199 },	// IfcCartesianPointList
+{ 1675464909, 574549367, 197, 198 },	// IfcCartesianPointList2D
+{ 2059837836, 574549367, 198, 199 },	// IfcCartesianPointList3D
+{ 59481748, 2453401579, 199, 204 },	// IfcCartesianTransformationOperator
+{ 3749851601, 59481748, 200, 202 },	// IfcCartesianTransformationOperator2D
+{ 3486308946, 3749851601, 201, 202 },	// IfcCartesianTransformationOperator2DnonUniform
+{ 3331915920, 59481748, 202, 204 },	// IfcCartesianTransformationOperator3D
+{ 1416205885, 3331915920, 203, 204 },	// IfcCartesianTransformationOperator3DnonUniform
+{ 2506170314, 2453401579, 204, 210 },	// IfcCsgPrimitive3D
+{ 1334484129, 2506170314, 205, 206 },	// IfcBlock
+{ 2798486643, 2506170314, 206, 207 },	// IfcRectangularPyramid
+{ 4158566097, 2506170314, 207, 208 },	// IfcRightCircularCone
+{ 3626867408, 2506170314, 208, 209 },	// IfcRightCircularCylinder
+{ 451544542, 2506170314, 209, 210 },	// IfcSphere
+{ 2601014836, 2453401579, 210, 244 },	// IfcCurve
+{ 1260505505, 2601014836, 211, 224 },	// IfcBoundedCurve
+{ 1967976161, 1260505505, 212, 215 },	// IfcBSplineCurve
+{ 2461110595, 1967976161, 213, 215 },	// IfcBSplineCurveWithKnots
+{ 1232101972, 2461110595, 214, 215 },	// IfcRationalBSplineCurveWithKnots
+{ 3732776249, 1260505505, 215, 221 },	// IfcCompositeCurve
+{ 15328376, 3732776249, 216, 219 },	// IfcCompositeCurveOnSurface
+{ 1136057603, 15328376, 217, 219 },	// IfcBoundaryCurve
+{ 144952367, 1136057603, 218, 219 },	// IfcOuterBoundaryCurve
+{ 2898700619, 3732776249, 219, 220 },	// IfcGradientCurve
+{ 544395925, 3732776249, 220, 221 },	// IfcSegmentedReferenceCurve
+{ 2571569899, 1260505505, 221, 222 },	// IfcIndexedPolyCurve
+{ 3724593414, 1260505505, 222, 223 },	// IfcPolyline
+{ 3593883385, 1260505505, 223, 224 },	// IfcTrimmedCurve
+{ 2510884976, 2601014836, 224, 227 },	// IfcConic
+{ 2611217952, 2510884976, 225, 226 },	// IfcCircle
+{ 1704287377, 2510884976, 226, 227 },	// IfcEllipse
+{ 1281925730, 2601014836, 227, 228 },	// IfcLine
+{ 590820931, 2601014836, 228, 232 },	// IfcOffsetCurve
+{ 3388369263, 590820931, 229, 230 },	// IfcOffsetCurve2D
+{ 3505215534, 590820931, 230, 231 },	// IfcOffsetCurve3D
+{ 2485787929, 590820931, 231, 232 },	// IfcOffsetCurveByDistances
+{ 1682466193, 2601014836, 232, 233 },	// IfcPcurve
+{ 3381221214, 2601014836, 233, 234 },	// IfcPolynomialCurve
+{ 2735484536, 2601014836, 234, 241 },	// IfcSpiral
+{ 3497074424, 2735484536, 235, 236 },	// IfcClothoid
+{ 2000195564, 2735484536, 236, 237 },	// IfcCosineSpiral
+{ 3649235739, 2735484536, 237, 238 },	// IfcSecondOrderPolynomialSpiral
+{ 1027922057, 2735484536, 238, 239 },	// IfcSeventhOrderPolynomialSpiral
+{ 42703149, 2735484536, 239, 240 },	// IfcSineSpiral
+{ 782932809, 2735484536, 240, 241 },	// IfcThirdOrderPolynomialSpiral
+{ 699246055, 2601014836, 241, 244 },	// IfcSurfaceCurve
+{ 3113134337, 699246055, 242, 243 },	// IfcIntersectionCurve
+{ 2157484638, 699246055, 243, 244 },	// IfcSeamCurve
+{ 32440307, 2453401579, 244, 245 },	// IfcDirection
+{ 2047409740, 2453401579, 245, 246 },	// IfcFaceBasedSurfaceModel
+{ 374418227, 2453401579, 246, 247 },	// IfcFillAreaStyleHatching
+{ 315944413, 2453401579, 247, 248 },	// IfcFillAreaStyleTiles
+{ 3590301190, 2453401579, 248, 250 },	// IfcGeometricSet
+{ 987898635, 3590301190, 249, 250 },	// IfcGeometricCurveSet
+{ 812098782, 2453401579, 250, 253 },	// IfcHalfSpaceSolid
+{ 2713105998, 812098782, 251, 252 },	// IfcBoxedHalfSpace
+{ 2775532180, 812098782, 252, 253 },	// IfcPolygonalBoundedHalfSpace
+{ 1402838566, 2453401579, 253, 259 },	// IfcLightSource
+{ 125510826, 1402838566, 254, 255 },	// IfcLightSourceAmbient
+{ 2604431987, 1402838566, 255, 256 },	// IfcLightSourceDirectional
+{ 4266656042, 1402838566, 256, 257 },	// IfcLightSourceGoniometric
+{ 1520743889, 1402838566, 257, 259 },	// IfcLightSourcePositional
+{ 3422422726, 1520743889, 258, 259 },	// IfcLightSourceSpot
+{ 2004835150, 2453401579, 259, 264 },	// IfcPlacement
+{ 4261334040, 2004835150, 260, 261 },	// IfcAxis1Placement
+{ 3125803723, 2004835150, 261, 262 },	// IfcAxis2Placement2D
+{ 2740243338, 2004835150, 262, 263 },	// IfcAxis2Placement3D
+{ 3425423356, 2004835150, 263, 264 },	// IfcAxis2PlacementLinear
+{ 1663979128, 2453401579, 264, 266 },	// IfcPlanarExtent
+{ 603570806, 1663979128, 265, 266 },	// IfcPlanarBox
+{ 2067069095, 2453401579, 266, 271 },	// IfcPoint
+{ 1123145078, 2067069095, 267, 268 },	// IfcCartesianPoint
+{ 2165702409, 2067069095, 268, 269 },	// IfcPointByDistanceExpression
+{ 4022376103, 2067069095, 269, 270 },	// IfcPointOnCurve
+{ 1423911732, 2067069095, 270, 271 },	// IfcPointOnSurface
+{ 1509187699, 2453401579, 271, 272 },	// IfcSectionedSpine
+{ 823603102, 2453401579, 272, 276 },	// IfcSegment
+{ 2485617015, 823603102, 273, 275 },	// IfcCompositeCurveSegment
+{ 816062949, 2485617015, 274, 275 },	// IfcReparametrisedCompositeCurveSegment
+{ 4212018352, 823603102, 275, 276 },	// IfcCurveSegment
+{ 4124623270, 2453401579, 276, 277 },	// IfcShellBasedSurfaceModel
+{ 723233188, 2453401579, 277, 297 },	// IfcSolidModel
+{ 2147822146, 723233188, 278, 279 },	// IfcCsgSolid
+{ 1425443689, 723233188, 279, 284 },	// IfcManifoldSolidBrep
+{ 1635779807, 1425443689, 280, 282 },	// IfcAdvancedBrep
+{ 2603310189, 1635779807, 281, 282 },	// IfcAdvancedBrepWithVoids
+{ 807026263, 1425443689, 282, 284 },	// IfcFacetedBrep
+{ 3737207727, 807026263, 283, 284 },	// IfcFacetedBrepWithVoids
+{ 1862484736, 723233188, 284, 286 },	// IfcSectionedSolid
+{ 1290935644, 1862484736, 285, 286 },	// IfcSectionedSolidHorizontal
+{ 2247615214, 723233188, 286, 295 },	// IfcSweptAreaSolid
+{ 593015953, 2247615214, 287, 291 },	// IfcDirectrixCurveSweptAreaSolid
+{ 2652556860, 593015953, 288, 290 },	// IfcFixedReferenceSweptAreaSolid
+{ 4234616927, 2652556860, 289, 290 },	// IfcDirectrixDerivedReferenceSweptAreaSolid
+{ 2028607225, 593015953, 290, 291 },	// IfcSurfaceCurveSweptAreaSolid
+{ 477187591, 2247615214, 291, 293 },	// IfcExtrudedAreaSolid
+{ 2804161546, 477187591, 292, 293 },	// IfcExtrudedAreaSolidTapered
+{ 1856042241, 2247615214, 293, 295 },	// IfcRevolvedAreaSolid
+{ 3243963512, 1856042241, 294, 295 },	// IfcRevolvedAreaSolidTapered
+{ 1260650574, 723233188, 295, 297 },	// IfcSweptDiskSolid
+{ 1096409881, 1260650574, 296, 297 },	// IfcSweptDiskSolidPolygonal
+{ 2513912981, 2453401579, 297, 314 },	// IfcSurface
+{ 4182860854, 2513912981, 298, 305 },	// IfcBoundedSurface
+{ 2887950389, 4182860854, 299, 302 },	// IfcBSplineSurface
+{ 167062518, 2887950389, 300, 302 },	// IfcBSplineSurfaceWithKnots
+{ 683857671, 167062518, 301, 302 },	// IfcRationalBSplineSurfaceWithKnots
+{ 2827736869, 4182860854, 302, 303 },	// IfcCurveBoundedPlane
+{ 2629017746, 4182860854, 303, 304 },	// IfcCurveBoundedSurface
+{ 3454111270, 4182860854, 304, 305 },	// IfcRectangularTrimmedSurface
+{ 2777663545, 2513912981, 305, 310 },	// IfcElementarySurface
+{ 1213902940, 2777663545, 306, 307 },	// IfcCylindricalSurface
+{ 220341763, 2777663545, 307, 308 },	// IfcPlane
+{ 4015995234, 2777663545, 308, 309 },	// IfcSphericalSurface
+{ 1935646853, 2777663545, 309, 310 },	// IfcToroidalSurface
+{ 1356537516, 2513912981, 310, 311 },	// IfcSectionedSurface
+{ 230924584, 2513912981, 311, 314 },	// IfcSweptSurface
+{ 2809605785, 230924584, 312, 313 },	// IfcSurfaceOfLinearExtrusion
+{ 4124788165, 230924584, 313, 314 },	// IfcSurfaceOfRevolution
+{ 901063453, 2453401579, 314, 321 },	// IfcTessellatedItem
+{ 178912537, 901063453, 315, 317 },	// IfcIndexedPolygonalFace
+{ 2294589976, 178912537, 316, 317 },	// IfcIndexedPolygonalFaceWithVoids
+{ 2387106220, 901063453, 317, 321 },	// IfcTessellatedFaceSet
+{ 2839578677, 2387106220, 318, 319 },	// IfcPolygonalFaceSet
+{ 2916149573, 2387106220, 319, 321 },	// IfcTriangulatedFaceSet
+{ 1229763772, 2916149573, 320, 321 },	// IfcTriangulatedIrregularNetwork
+{ 4282788508, 2453401579, 321, 323 },	// IfcTextLiteral
+{ 3124975700, 4282788508, 322, 323 },	// IfcTextLiteralWithExtent
+{ 1417489154, 2453401579, 323, 324 },	// IfcVector
+{ 2347385850, 3008791417, 324, 325 },	// IfcMappedItem
+{ 3958052878, 3008791417, 325, 326 },	// IfcStyledItem
+{ 1377556343, 3008791417, 326, 346 },	// IfcTopologicalRepresentationItem
+{ 370225590, 1377556343, 327, 330 },	// IfcConnectedFaceSet
+{ 2205249479, 370225590, 328, 329 },	// IfcClosedShell
+{ 2665983363, 370225590, 329, 330 },	// IfcOpenShell
+{ 3900360178, 1377556343, 330, 334 },	// IfcEdge
+{ 476780140, 3900360178, 331, 332 },	// IfcEdgeCurve
+{ 1029017970, 3900360178, 332, 333 },	// IfcOrientedEdge
+{ 2233826070, 3900360178, 333, 334 },	// IfcSubedge
+{ 2556980723, 1377556343, 334, 337 },	// IfcFace
+{ 3008276851, 2556980723, 335, 337 },	// IfcFaceSurface
+{ 3406155212, 3008276851, 336, 337 },	// IfcAdvancedFace
+{ 1809719519, 1377556343, 337, 339 },	// IfcFaceBound
+{ 803316827, 1809719519, 338, 339 },	// IfcFaceOuterBound
+{ 1008929658, 1377556343, 339, 343 },	// IfcLoop
+{ 1472233963, 1008929658, 340, 341 },	// IfcEdgeLoop
+{ 2924175390, 1008929658, 341, 342 },	// IfcPolyLoop
+{ 2759199220, 1008929658, 342, 343 },	// IfcVertexLoop
+{ 2519244187, 1377556343, 343, 344 },	// IfcPath
+{ 2799835756, 1377556343, 344, 346 },	// IfcVertex
+{ 1907098498, 2799835756, 345, 346 },	// IfcVertexPoint
+{ 1660063152, 0, 346, 347 },	// IfcRepresentationMap
+{ 2439245199, 0, 347, 357 },	// IfcResourceLevelRelationship
+{ 3869604511, 2439245199, 348, 349 },	// IfcApprovalRelationship
+{ 539742890, 2439245199, 349, 350 },	// IfcCurrencyRelationship
+{ 770865208, 2439245199, 350, 351 },	// IfcDocumentInformationRelationship
+{ 1437805879, 2439245199, 351, 352 },	// IfcExternalReferenceRelationship
+{ 853536259, 2439245199, 352, 353 },	// IfcMaterialRelationship
+{ 1411181986, 2439245199, 353, 354 },	// IfcOrganizationRelationship
+{ 148025276, 2439245199, 354, 355 },	// IfcPropertyDependencyRelationship
+{ 2943643501, 2439245199, 355, 356 },	// IfcResourceApprovalRelationship
+{ 1608871552, 2439245199, 356, 357 },	// IfcResourceConstraintRelationship
+{ 2341007311, 0, 357, 843 },	// IfcRoot
+{ 219451334, 2341007311, 358, 775 },	// IfcObjectDefinition
+{ 3419103109, 219451334, 359, 362 },	// IfcContext
+{ 103090709, 3419103109, 360, 361 },	// IfcProject
+{ 653396225, 3419103109, 361, 362 },	// IfcProjectLibrary
+{ 3888040117, 219451334, 362, 615 },	// IfcObject
+{ 2296667514, 3888040117, 363, 365 },	// IfcActor
+{ 4143007308, 2296667514, 364, 365 },	// IfcOccupant
+{ 3293443760, 3888040117, 365, 376 },	// IfcControl
+{ 3821786052, 3293443760, 366, 367 },	// IfcActionRequest
+{ 3895139033, 3293443760, 367, 368 },	// IfcCostItem
+{ 1419761937, 3293443760, 368, 369 },	// IfcCostSchedule
+{ 2382730787, 3293443760, 369, 370 },	// IfcPerformanceHistory
+{ 3327091369, 3293443760, 370, 371 },	// IfcPermit
+{ 2904328755, 3293443760, 371, 372 },	// IfcProjectOrder
+{ 4088093105, 3293443760, 372, 373 },	// IfcWorkCalendar
+{ 1028945134, 3293443760, 373, 376 },	// IfcWorkControl
+{ 4218914973, 1028945134, 374, 375 },	// IfcWorkPlan
+{ 3342526732, 1028945134, 375, 376 },	// IfcWorkSchedule
+{ 2706460486, 3888040117, 376, 389 },	// IfcGroup
+{ 3460190687, 2706460486, 377, 378 },	// IfcAsset
+{ 2391368822, 2706460486, 378, 379 },	// IfcInventory
+{ 1252848954, 2706460486, 379, 381 },	// IfcStructuralLoadGroup
+{ 385403989, 1252848954, 380, 381 },	// IfcStructuralLoadCase
+{ 2986769608, 2706460486, 381, 382 },	// IfcStructuralResultGroup
+{ 2254336722, 2706460486, 382, 389 },	// IfcSystem
+{ 1177604601, 2254336722, 383, 384 },	// IfcBuildingSystem
+{ 3862327254, 2254336722, 384, 385 },	// IfcBuiltSystem
+{ 3205830791, 2254336722, 385, 387 },	// IfcDistributionSystem
+{ 562808652, 3205830791, 386, 387 },	// IfcDistributionCircuit
+{ 2515109513, 2254336722, 387, 388 },	// IfcStructuralAnalysisModel
+{ 1033361043, 2254336722, 388, 389 },	// IfcZone
+{ 2945172077, 3888040117, 389, 393 },	// IfcProcess
+{ 4148101412, 2945172077, 390, 391 },	// IfcEvent
+{ 2744685151, 2945172077, 391, 392 },	// IfcProcedure
+{ 3473067441, 2945172077, 392, 393 },	// IfcTask
+{ 4208778838, 3888040117, 393, 607 },	// IfcProduct
+{ 1674181508, 4208778838, 394, 395 },	// IfcAnnotation
+{ 1758889154, 4208778838, 395, 554 },	// IfcElement
+{ 1876633798, 1758889154, 396, 432 },	// IfcBuiltElement
+{ 753842376, 1876633798, 397, 398 },	// IfcBeam
+{ 4196446775, 1876633798, 398, 399 },	// IfcBearing
+{ 1095909175, 1876633798, 399, 400 },	// IfcBuildingElementProxy
+{ 3296154744, 1876633798, 400, 401 },	// IfcChimney
+{ 843113511, 1876633798, 401, 402 },	// IfcColumn
+{ 1502416096, 1876633798, 402, 403 },	// IfcCourse
+{ 1973544240, 1876633798, 403, 404 },	// IfcCovering
+{ 3495092785, 1876633798, 404, 405 },	// IfcCurtainWall
+{ 3426335179, 1876633798, 405, 408 },	// IfcDeepFoundation
+{ 3999819293, 3426335179, 406, 407 },	// IfcCaissonFoundation
+{ 1687234759, 3426335179, 407, 408 },	// IfcPile
+{ 395920057, 1876633798, 408, 409 },	// IfcDoor
+{ 1077100507, 1876633798, 409, 412 },	// IfcEarthworksElement
+{ 3376911765, 1077100507, 410, 411 },	// IfcEarthworksFill
+{ 3798194928, 1077100507, 411, 412 },	// IfcReinforcedSoil
+{ 900683007, 1876633798, 412, 413 },	// IfcFooting
+{ 2696325953, 1876633798, 413, 414 },	// IfcKerb
+{ 1073191201, 1876633798, 414, 415 },	// IfcMember
+{ 234836483, 1876633798, 415, 416 },	// IfcMooringDevice
+{ 2182337498, 1876633798, 416, 417 },	// IfcNavigationElement
+{ 1383356374, 1876633798, 417, 418 },	// IfcPavement
+{ 3171933400, 1876633798, 418, 419 },	// IfcPlate
+{ 3290496277, 1876633798, 419, 420 },	// IfcRail
+{ 2262370178, 1876633798, 420, 421 },	// IfcRailing
+{ 3024970846, 1876633798, 421, 422 },	// IfcRamp
+{ 3283111854, 1876633798, 422, 423 },	// IfcRampFlight
+{ 2016517767, 1876633798, 423, 424 },	// IfcRoof
+{ 1329646415, 1876633798, 424, 425 },	// IfcShadingDevice
+{ 1529196076, 1876633798, 425, 426 },	// IfcSlab
+{ 331165859, 1876633798, 426, 427 },	// IfcStair
+{ 4252922144, 1876633798, 427, 428 },	// IfcStairFlight
+{ 3425753595, 1876633798, 428, 429 },	// IfcTrackElement
+{ 2391406946, 1876633798, 429, 431 },	// IfcWall
+{ 3512223829, 2391406946, 430, 431 },	// IfcWallStandardCase
+{ 3304561284, 1876633798, 431, 432 },	// IfcWindow
+{ 1677625105, 1758889154, 432, 433 },	// IfcCivilElement
+{ 1945004755, 1758889154, 433, 516 },	// IfcDistributionElement
+{ 1062813311, 1945004755, 434, 442 },	// IfcDistributionControlElement
+{ 4288193352, 1062813311, 435, 436 },	// IfcActuator
+{ 3087945054, 1062813311, 436, 437 },	// IfcAlarm
+{ 25142252, 1062813311, 437, 438 },	// IfcController
+{ 182646315, 1062813311, 438, 439 },	// IfcFlowInstrument
+{ 2295281155, 1062813311, 439, 440 },	// IfcProtectiveDeviceTrippingUnit
+{ 4086658281, 1062813311, 440, 441 },	// IfcSensor
+{ 630975310, 1062813311, 441, 442 },	// IfcUnitaryControlElement
+{ 3040386961, 1945004755, 442, 516 },	// IfcDistributionFlowElement
+{ 1052013943, 3040386961, 443, 444 },	// IfcDistributionChamberElement
+{ 1658829314, 3040386961, 444, 465 },	// IfcEnergyConversionDevice
+{ 2056796094, 1658829314, 445, 446 },	// IfcAirToAirHeatRecovery
+{ 32344328, 1658829314, 446, 447 },	// IfcBoiler
+{ 2938176219, 1658829314, 447, 448 },	// IfcBurner
+{ 3902619387, 1658829314, 448, 449 },	// IfcChiller
+{ 639361253, 1658829314, 449, 450 },	// IfcCoil
+{ 2272882330, 1658829314, 450, 451 },	// IfcCondenser
+{ 4136498852, 1658829314, 451, 452 },	// IfcCooledBeam
+{ 3640358203, 1658829314, 452, 453 },	// IfcCoolingTower
+{ 264262732, 1658829314, 453, 454 },	// IfcElectricGenerator
+{ 402227799, 1658829314, 454, 455 },	// IfcElectricMotor
+{ 2814081492, 1658829314, 455, 456 },	// IfcEngine
+{ 3747195512, 1658829314, 456, 457 },	// IfcEvaporativeCooler
+{ 484807127, 1658829314, 457, 458 },	// IfcEvaporator
+{ 3319311131, 1658829314, 458, 459 },	// IfcHeatExchanger
+{ 2068733104, 1658829314, 459, 460 },	// IfcHumidifier
+{ 2474470126, 1658829314, 460, 461 },	// IfcMotorConnection
+{ 3420628829, 1658829314, 461, 462 },	// IfcSolarDevice
+{ 3825984169, 1658829314, 462, 463 },	// IfcTransformer
+{ 3026737570, 1658829314, 463, 464 },	// IfcTubeBundle
+{ 4292641817, 1658829314, 464, 465 },	// IfcUnitaryEquipment
+{ 2058353004, 3040386961, 465, 475 },	// IfcFlowController
+{ 177149247, 2058353004, 466, 467 },	// IfcAirTerminalBox
+{ 4074379575, 2058353004, 467, 468 },	// IfcDamper
+{ 3693000487, 2058353004, 468, 469 },	// IfcDistributionBoard
+{ 862014818, 2058353004, 469, 470 },	// IfcElectricDistributionBoard
+{ 1003880860, 2058353004, 470, 471 },	// IfcElectricTimeControl
+{ 2188021234, 2058353004, 471, 472 },	// IfcFlowMeter
+{ 738039164, 2058353004, 472, 473 },	// IfcProtectiveDevice
+{ 1162798199, 2058353004, 473, 474 },	// IfcSwitchingDevice
+{ 4207607924, 2058353004, 474, 475 },	// IfcValve
+{ 4278956645, 3040386961, 475, 481 },	// IfcFlowFitting
+{ 635142910, 4278956645, 476, 477 },	// IfcCableCarrierFitting
+{ 1051757585, 4278956645, 477, 478 },	// IfcCableFitting
+{ 342316401, 4278956645, 478, 479 },	// IfcDuctFitting
+{ 2176052936, 4278956645, 479, 480 },	// IfcJunctionBox
+{ 310824031, 4278956645, 480, 481 },	// IfcPipeFitting
+{ 3132237377, 3040386961, 481, 485 },	// IfcFlowMovingDevice
+{ 3571504051, 3132237377, 482, 483 },	// IfcCompressor
+{ 3415622556, 3132237377, 483, 484 },	// IfcFan
+{ 90941305, 3132237377, 484, 485 },	// IfcPump
+{ 987401354, 3040386961, 485, 491 },	// IfcFlowSegment
+{ 3758799889, 987401354, 486, 487 },	// IfcCableCarrierSegment
+{ 4217484030, 987401354, 487, 488 },	// IfcCableSegment
+{ 3460952963, 987401354, 488, 489 },	// IfcConveyorSegment
+{ 3518393246, 987401354, 489, 490 },	// IfcDuctSegment
+{ 3612865200, 987401354, 490, 491 },	// IfcPipeSegment
+{ 707683696, 3040386961, 491, 494 },	// IfcFlowStorageDevice
+{ 3310460725, 707683696, 492, 493 },	// IfcElectricFlowStorageDevice
+{ 812556717, 707683696, 493, 494 },	// IfcTank
+{ 2223149337, 3040386961, 494, 511 },	// IfcFlowTerminal
+{ 1634111441, 2223149337, 495, 496 },	// IfcAirTerminal
+{ 277319702, 2223149337, 496, 497 },	// IfcAudioVisualAppliance
+{ 3221913625, 2223149337, 497, 498 },	// IfcCommunicationsAppliance
+{ 1904799276, 2223149337, 498, 499 },	// IfcElectricAppliance
+{ 1426591983, 2223149337, 499, 500 },	// IfcFireSuppressionTerminal
+{ 76236018, 2223149337, 500, 501 },	// IfcLamp
+{ 629592764, 2223149337, 501, 502 },	// IfcLightFixture
+{ 1638804497, 2223149337, 502, 503 },	// IfcLiquidTerminal
+{ 1437502449, 2223149337, 503, 504 },	// IfcMedicalDevice
+{ 2078563270, 2223149337, 504, 505 },	// IfcMobileTelecommunicationsAppliance
+{ 3694346114, 2223149337, 505, 506 },	// IfcOutlet
+{ 3053780830, 2223149337, 506, 507 },	// IfcSanitaryTerminal
+{ 991950508, 2223149337, 507, 508 },	// IfcSignal
+{ 1999602285, 2223149337, 508, 509 },	// IfcSpaceHeater
+{ 1404847402, 2223149337, 509, 510 },	// IfcStackTerminal
+{ 4237592921, 2223149337, 510, 511 },	// IfcWasteTerminal
+{ 3508470533, 3040386961, 511, 516 },	// IfcFlowTreatmentDevice
+{ 1360408905, 3508470533, 512, 513 },	// IfcDuctSilencer
+{ 24726584, 3508470533, 513, 514 },	// IfcElectricFlowTreatmentDevice
+{ 819412036, 3508470533, 514, 515 },	// IfcFilter
+{ 4175244083, 3508470533, 515, 516 },	// IfcInterceptor
+{ 4123344466, 1758889154, 516, 517 },	// IfcElementAssembly
+{ 1623761950, 1758889154, 517, 532 },	// IfcElementComponent
+{ 2979338954, 1623761950, 518, 519 },	// IfcBuildingElementPart
+{ 1335981549, 1623761950, 519, 520 },	// IfcDiscreteAccessory
+{ 647756555, 1623761950, 520, 521 },	// IfcFastener
+{ 2568555532, 1623761950, 521, 522 },	// IfcImpactProtectionDevice
+{ 377706215, 1623761950, 522, 523 },	// IfcMechanicalFastener
+{ 3027567501, 1623761950, 523, 529 },	// IfcReinforcingElement
+{ 979691226, 3027567501, 524, 525 },	// IfcReinforcingBar
+{ 2320036040, 3027567501, 525, 526 },	// IfcReinforcingMesh
+{ 3824725483, 3027567501, 526, 527 },	// IfcTendon
+{ 2347447852, 3027567501, 527, 528 },	// IfcTendonAnchor
+{ 3663046924, 3027567501, 528, 529 },	// IfcTendonConduit
+{ 33720170, 1623761950, 529, 530 },	// IfcSign
+{ 1530820697, 1623761950, 530, 531 },	// IfcVibrationDamper
+{ 2391383451, 1623761950, 531, 532 },	// IfcVibrationIsolator
+{ 2827207264, 1758889154, 532, 540 },	// IfcFeatureElement
+{ 2143335405, 2827207264, 533, 535 },	// IfcFeatureElementAddition
+{ 3651124850, 2143335405, 534, 535 },	// IfcProjectionElement
+{ 1287392070, 2827207264, 535, 539 },	// IfcFeatureElementSubtraction
+{ 3071239417, 1287392070, 536, 537 },	// IfcEarthworksCut
+{ 3588315303, 1287392070, 537, 538 },	// IfcOpeningElement
+{ 926996030, 1287392070, 538, 539 },	// IfcVoidingFeature
+{ 3101698114, 2827207264, 539, 540 },	// IfcSurfaceFeature
+{ 263784265, 1758889154, 540, 543 },	// IfcFurnishingElement
+{ 1509553395, 263784265, 541, 542 },	// IfcFurniture
+{ 413509423, 263784265, 542, 543 },	// IfcSystemFurnitureElement
+{ 3493046030, 1758889154, 543, 544 },	// IfcGeographicElement
+{ 4230923436, 1758889154, 544, 550 },	// IfcGeotechnicalElement
+{ 2713699986, 4230923436, 545, 549 },	// IfcGeotechnicalAssembly
+{ 3314249567, 2713699986, 546, 547 },	// IfcBorehole
+{ 2680139844, 2713699986, 547, 548 },	// IfcGeomodel
+{ 1971632696, 2713699986, 548, 549 },	// IfcGeoslice
+{ 1594536857, 4230923436, 549, 550 },	// IfcGeotechnicalStratum
+{ 1953115116, 1758889154, 550, 553 },	// IfcTransportationDevice
+{ 1620046519, 1953115116, 551, 552 },	// IfcTransportElement
+{ 840318589, 1953115116, 552, 553 },	// IfcVehicle
+{ 2769231204, 1758889154, 553, 554 },	// IfcVirtualElement
+{ 2176059722, 4208778838, 554, 559 },	// IfcLinearElement
+{ 4266260250, 2176059722, 555, 556 },	// IfcAlignmentCant
+{ 1545765605, 2176059722, 556, 557 },	// IfcAlignmentHorizontal
+{ 317615605, 2176059722, 557, 558 },	// IfcAlignmentSegment
+{ 1662888072, 2176059722, 558, 559 },	// IfcAlignmentVertical
+{ 3740093272, 4208778838, 559, 561 },	// IfcPort
+{ 3041715199, 3740093272, 560, 561 },	// IfcDistributionPort
+{ 1946335990, 4208778838, 561, 566 },	// IfcPositioningElement
+{ 3009204131, 1946335990, 562, 563 },	// IfcGrid
+{ 1154579445, 1946335990, 563, 565 },	// IfcLinearPositioningElement
+{ 325726236, 1154579445, 564, 565 },	// IfcAlignment
+{ 4021432810, 1946335990, 565, 566 },	// IfcReferent
+{ 1412071761, 4208778838, 566, 586 },	// IfcSpatialElement
+{ 2853485674, 1412071761, 567, 569 },	// IfcExternalSpatialStructureElement
+{ 1209101575, 2853485674, 568, 569 },	// IfcExternalSpatialElement
+{ 2706606064, 1412071761, 569, 585 },	// IfcSpatialStructureElement
+{ 3124254112, 2706606064, 570, 571 },	// IfcBuildingStorey
+{ 24185140, 2706606064, 571, 577 },	// IfcFacility
+{ 644574406, 24185140, 572, 573 },	// IfcBridge
+{ 4031249490, 24185140, 573, 574 },	// IfcBuilding
+{ 525669439, 24185140, 574, 575 },	// IfcMarineFacility
+{ 3992365140, 24185140, 575, 576 },	// IfcRailway
+{ 146592293, 24185140, 576, 577 },	// IfcRoad
+{ 1310830890, 2706606064, 577, 583 },	// IfcFacilityPart
+{ 963979645, 1310830890, 578, 579 },	// IfcBridgePart
+{ 4228831410, 1310830890, 579, 580 },	// IfcFacilityPartCommon
+{ 976884017, 1310830890, 580, 581 },	// IfcMarinePart
+{ 1891881377, 1310830890, 581, 582 },	// IfcRailwayPart
+{ 550521510, 1310830890, 582, 583 },	// IfcRoadPart
+{ 4097777520, 2706606064, 583, 584 },	// IfcSite
+{ 3856911033, 2706606064, 584, 585 },	// IfcSpace
+{ 463610769, 1412071761, 585, 586 },	// IfcSpatialZone
+{ 3544373492, 4208778838, 586, 597 },	// IfcStructuralActivity
+{ 682877961, 3544373492, 587, 593 },	// IfcStructuralAction
+{ 1004757350, 682877961, 588, 590 },	// IfcStructuralCurveAction
+{ 1807405624, 1004757350, 589, 590 },	// IfcStructuralLinearAction
+{ 2082059205, 682877961, 590, 591 },	// IfcStructuralPointAction
+{ 3657597509, 682877961, 591, 593 },	// IfcStructuralSurfaceAction
+{ 1621171031, 3657597509, 592, 593 },	// IfcStructuralPlanarAction
+{ 3689010777, 3544373492, 593, 597 },	// IfcStructuralReaction
+{ 2757150158, 3689010777, 594, 595 },	// IfcStructuralCurveReaction
+{ 1235345126, 3689010777, 595, 596 },	// IfcStructuralPointReaction
+{ 603775116, 3689010777, 596, 597 },	// IfcStructuralSurfaceReaction
+{ 3136571912, 4208778838, 597, 607 },	// IfcStructuralItem
+{ 1179482911, 3136571912, 598, 602 },	// IfcStructuralConnection
+{ 4243806635, 1179482911, 599, 600 },	// IfcStructuralCurveConnection
+{ 734778138, 1179482911, 600, 601 },	// IfcStructuralPointConnection
+{ 1975003073, 1179482911, 601, 602 },	// IfcStructuralSurfaceConnection
+{ 530289379, 3136571912, 602, 607 },	// IfcStructuralMember
+{ 214636428, 530289379, 603, 605 },	// IfcStructuralCurveMember
+{ 2445595289, 214636428, 604, 605 },	// IfcStructuralCurveMemberVarying
+{ 3979015343, 530289379, 605, 607 },	// IfcStructuralSurfaceMember
+{ 2218152070, 3979015343, 606, 607 },	// IfcStructuralSurfaceMemberVarying
+{ 2914609552, 3888040117, 607, 615 },	// IfcResource
+{ 2559216714, 2914609552, 608, 615 },	// IfcConstructionResource
+{ 3898045240, 2559216714, 609, 610 },	// IfcConstructionEquipmentResource
+{ 1060000209, 2559216714, 610, 611 },	// IfcConstructionMaterialResource
+{ 488727124, 2559216714, 611, 612 },	// IfcConstructionProductResource
+{ 3295246426, 2559216714, 612, 613 },	// IfcCrewResource
+{ 3827777499, 2559216714, 613, 614 },	// IfcLaborResource
+{ 148013059, 2559216714, 614, 615 },	// IfcSubContractResource
+{ 1628702193, 219451334, 615, 775 },	// IfcTypeObject
+{ 3736923433, 1628702193, 616, 620 },	// IfcTypeProcess
+{ 4024345920, 3736923433, 617, 618 },	// IfcEventType
+{ 569719735, 3736923433, 618, 619 },	// IfcProcedureType
+{ 3206491090, 3736923433, 619, 620 },	// IfcTaskType
+{ 2347495698, 1628702193, 620, 767 },	// IfcTypeProduct
+{ 526551008, 2347495698, 621, 622 },	// IfcDoorStyle
+{ 339256511, 2347495698, 622, 762 },	// IfcElementType
+{ 1626504194, 339256511, 623, 655 },	// IfcBuiltElementType
+{ 819618141, 1626504194, 624, 625 },	// IfcBeamType
+{ 3649138523, 1626504194, 625, 626 },	// IfcBearingType
+{ 1909888760, 1626504194, 626, 627 },	// IfcBuildingElementProxyType
+{ 2197970202, 1626504194, 627, 628 },	// IfcChimneyType
+{ 300633059, 1626504194, 628, 629 },	// IfcColumnType
+{ 4189326743, 1626504194, 629, 630 },	// IfcCourseType
+{ 1916426348, 1626504194, 630, 631 },	// IfcCoveringType
+{ 1457835157, 1626504194, 631, 632 },	// IfcCurtainWallType
+{ 1306400036, 1626504194, 632, 635 },	// IfcDeepFoundationType
+{ 3203706013, 1306400036, 633, 634 },	// IfcCaissonFoundationType
+{ 1158309216, 1306400036, 634, 635 },	// IfcPileType
+{ 2323601079, 1626504194, 635, 636 },	// IfcDoorType
+{ 1893162501, 1626504194, 636, 637 },	// IfcFootingType
+{ 679976338, 1626504194, 637, 638 },	// IfcKerbType
+{ 3181161470, 1626504194, 638, 639 },	// IfcMemberType
+{ 710110818, 1626504194, 639, 640 },	// IfcMooringDeviceType
+{ 506776471, 1626504194, 640, 641 },	// IfcNavigationElementType
+{ 514975943, 1626504194, 641, 642 },	// IfcPavementType
+{ 4017108033, 1626504194, 642, 643 },	// IfcPlateType
+{ 1763565496, 1626504194, 643, 644 },	// IfcRailType
+{ 2893384427, 1626504194, 644, 645 },	// IfcRailingType
+{ 2324767716, 1626504194, 645, 646 },	// IfcRampFlightType
+{ 1469900589, 1626504194, 646, 647 },	// IfcRampType
+{ 2781568857, 1626504194, 647, 648 },	// IfcRoofType
+{ 4074543187, 1626504194, 648, 649 },	// IfcShadingDeviceType
+{ 2533589738, 1626504194, 649, 650 },	// IfcSlabType
+{ 1039846685, 1626504194, 650, 651 },	// IfcStairFlightType
+{ 338393293, 1626504194, 651, 652 },	// IfcStairType
+{ 618700268, 1626504194, 652, 653 },	// IfcTrackElementType
+{ 1898987631, 1626504194, 653, 654 },	// IfcWallType
+{ 4009809668, 1626504194, 654, 655 },	// IfcWindowType
+{ 3893394355, 339256511, 655, 656 },	// IfcCivilElementType
+{ 3256556792, 339256511, 656, 739 },	// IfcDistributionElementType
+{ 2063403501, 3256556792, 657, 665 },	// IfcDistributionControlElementType
+{ 2874132201, 2063403501, 658, 659 },	// IfcActuatorType
+{ 3001207471, 2063403501, 659, 660 },	// IfcAlarmType
+{ 578613899, 2063403501, 660, 661 },	// IfcControllerType
+{ 4037862832, 2063403501, 661, 662 },	// IfcFlowInstrumentType
+{ 655969474, 2063403501, 662, 663 },	// IfcProtectiveDeviceTrippingUnitType
+{ 1783015770, 2063403501, 663, 664 },	// IfcSensorType
+{ 3179687236, 2063403501, 664, 665 },	// IfcUnitaryControlElementType
+{ 3849074793, 3256556792, 665, 739 },	// IfcDistributionFlowElementType
+{ 1599208980, 3849074793, 666, 667 },	// IfcDistributionChamberElementType
+{ 2107101300, 3849074793, 667, 688 },	// IfcEnergyConversionDeviceType
+{ 1871374353, 2107101300, 668, 669 },	// IfcAirToAirHeatRecoveryType
+{ 231477066, 2107101300, 669, 670 },	// IfcBoilerType
+{ 2188180465, 2107101300, 670, 671 },	// IfcBurnerType
+{ 2951183804, 2107101300, 671, 672 },	// IfcChillerType
+{ 2301859152, 2107101300, 672, 673 },	// IfcCoilType
+{ 2816379211, 2107101300, 673, 674 },	// IfcCondenserType
+{ 335055490, 2107101300, 674, 675 },	// IfcCooledBeamType
+{ 2954562838, 2107101300, 675, 676 },	// IfcCoolingTowerType
+{ 1534661035, 2107101300, 676, 677 },	// IfcElectricGeneratorType
+{ 1217240411, 2107101300, 677, 678 },	// IfcElectricMotorType
+{ 132023988, 2107101300, 678, 679 },	// IfcEngineType
+{ 3174744832, 2107101300, 679, 680 },	// IfcEvaporativeCoolerType
+{ 3390157468, 2107101300, 680, 681 },	// IfcEvaporatorType
+{ 1251058090, 2107101300, 681, 682 },	// IfcHeatExchangerType
+{ 1806887404, 2107101300, 682, 683 },	// IfcHumidifierType
+{ 977012517, 2107101300, 683, 684 },	// IfcMotorConnectionType
+{ 1072016465, 2107101300, 684, 685 },	// IfcSolarDeviceType
+{ 1692211062, 2107101300, 685, 686 },	// IfcTransformerType
+{ 1600972822, 2107101300, 686, 687 },	// IfcTubeBundleType
+{ 1911125066, 2107101300, 687, 688 },	// IfcUnitaryEquipmentType
+{ 3907093117, 3849074793, 688, 698 },	// IfcFlowControllerType
+{ 1411407467, 3907093117, 689, 690 },	// IfcAirTerminalBoxType
+{ 3961806047, 3907093117, 690, 691 },	// IfcDamperType
+{ 479945903, 3907093117, 691, 692 },	// IfcDistributionBoardType
+{ 2417008758, 3907093117, 692, 693 },	// IfcElectricDistributionBoardType
+{ 712377611, 3907093117, 693, 694 },	// IfcElectricTimeControlType
+{ 3815607619, 3907093117, 694, 695 },	// IfcFlowMeterType
+{ 1842657554, 3907093117, 695, 696 },	// IfcProtectiveDeviceType
+{ 2315554128, 3907093117, 696, 697 },	// IfcSwitchingDeviceType
+{ 728799441, 3907093117, 697, 698 },	// IfcValveType
+{ 3198132628, 3849074793, 698, 704 },	// IfcFlowFittingType
+{ 395041908, 3198132628, 699, 700 },	// IfcCableCarrierFittingType
+{ 2674252688, 3198132628, 700, 701 },	// IfcCableFittingType
+{ 869906466, 3198132628, 701, 702 },	// IfcDuctFittingType
+{ 4288270099, 3198132628, 702, 703 },	// IfcJunctionBoxType
+{ 804291784, 3198132628, 703, 704 },	// IfcPipeFittingType
+{ 1482959167, 3849074793, 704, 708 },	// IfcFlowMovingDeviceType
+{ 3850581409, 1482959167, 705, 706 },	// IfcCompressorType
+{ 346874300, 1482959167, 706, 707 },	// IfcFanType
+{ 2250791053, 1482959167, 707, 708 },	// IfcPumpType
+{ 1834744321, 3849074793, 708, 714 },	// IfcFlowSegmentType
+{ 3293546465, 1834744321, 709, 710 },	// IfcCableCarrierSegmentType
+{ 1285652485, 1834744321, 710, 711 },	// IfcCableSegmentType
+{ 2940368186, 1834744321, 711, 712 },	// IfcConveyorSegmentType
+{ 3760055223, 1834744321, 712, 713 },	// IfcDuctSegmentType
+{ 4231323485, 1834744321, 713, 714 },	// IfcPipeSegmentType
+{ 1339347760, 3849074793, 714, 717 },	// IfcFlowStorageDeviceType
+{ 3277789161, 1339347760, 715, 716 },	// IfcElectricFlowStorageDeviceType
+{ 5716631, 1339347760, 716, 717 },	// IfcTankType
+{ 2297155007, 3849074793, 717, 734 },	// IfcFlowTerminalType
+{ 3352864051, 2297155007, 718, 719 },	// IfcAirTerminalType
+{ 1532957894, 2297155007, 719, 720 },	// IfcAudioVisualApplianceType
+{ 400855858, 2297155007, 720, 721 },	// IfcCommunicationsApplianceType
+{ 663422040, 2297155007, 721, 722 },	// IfcElectricApplianceType
+{ 4222183408, 2297155007, 722, 723 },	// IfcFireSuppressionTerminalType
+{ 1051575348, 2297155007, 723, 724 },	// IfcLampType
+{ 1161773419, 2297155007, 724, 725 },	// IfcLightFixtureType
+{ 1770583370, 2297155007, 725, 726 },	// IfcLiquidTerminalType
+{ 1114901282, 2297155007, 726, 727 },	// IfcMedicalDeviceType
+{ 1950438474, 2297155007, 727, 728 },	// IfcMobileTelecommunicationsApplianceType
+{ 2837617999, 2297155007, 728, 729 },	// IfcOutletType
+{ 1768891740, 2297155007, 729, 730 },	// IfcSanitaryTerminalType
+{ 1894708472, 2297155007, 730, 731 },	// IfcSignalType
+{ 1305183839, 2297155007, 731, 732 },	// IfcSpaceHeaterType
+{ 3112655638, 2297155007, 732, 733 },	// IfcStackTerminalType
+{ 1133259667, 2297155007, 733, 734 },	// IfcWasteTerminalType
+{ 3009222698, 3849074793, 734, 739 },	// IfcFlowTreatmentDeviceType
+{ 2030761528, 3009222698, 735, 736 },	// IfcDuctSilencerType
+{ 2142170206, 3009222698, 736, 737 },	// IfcElectricFlowTreatmentDeviceType
+{ 1810631287, 3009222698, 737, 738 },	// IfcFilterType
+{ 3946677679, 3009222698, 738, 739 },	// IfcInterceptorType
+{ 2397081782, 339256511, 739, 740 },	// IfcElementAssemblyType
+{ 2590856083, 339256511, 740, 755 },	// IfcElementComponentType
+{ 39481116, 2590856083, 741, 742 },	// IfcBuildingElementPartType
+{ 2635815018, 2590856083, 742, 743 },	// IfcDiscreteAccessoryType
+{ 2489546625, 2590856083, 743, 744 },	// IfcFastenerType
+{ 3948183225, 2590856083, 744, 745 },	// IfcImpactProtectionDeviceType
+{ 2108223431, 2590856083, 745, 746 },	// IfcMechanicalFastenerType
+{ 964333572, 2590856083, 746, 752 },	// IfcReinforcingElementType
+{ 2572171363, 964333572, 747, 748 },	// IfcReinforcingBarType
+{ 2310774935, 964333572, 748, 749 },	// IfcReinforcingMeshType
+{ 3081323446, 964333572, 749, 750 },	// IfcTendonAnchorType
+{ 2281632017, 964333572, 750, 751 },	// IfcTendonConduitType
+{ 2415094496, 964333572, 751, 752 },	// IfcTendonType
+{ 3599934289, 2590856083, 752, 753 },	// IfcSignType
+{ 3956297820, 2590856083, 753, 754 },	// IfcVibrationDamperType
+{ 3313531582, 2590856083, 754, 755 },	// IfcVibrationIsolatorType
+{ 4238390223, 339256511, 755, 758 },	// IfcFurnishingElementType
+{ 1268542332, 4238390223, 756, 757 },	// IfcFurnitureType
+{ 1580310250, 4238390223, 757, 758 },	// IfcSystemFurnitureElementType
+{ 4095422895, 339256511, 758, 759 },	// IfcGeographicElementType
+{ 3665877780, 339256511, 759, 762 },	// IfcTransportationDeviceType
+{ 2097647324, 3665877780, 760, 761 },	// IfcTransportElementType
+{ 3651464721, 3665877780, 761, 762 },	// IfcVehicleType
+{ 710998568, 2347495698, 762, 766 },	// IfcSpatialElementType
+{ 3893378262, 710998568, 763, 765 },	// IfcSpatialStructureElementType
+{ 3812236995, 3893378262, 764, 765 },	// IfcSpaceType
+{ 2481509218, 710998568, 765, 766 },	// IfcSpatialZoneType
+{ 1299126871, 2347495698, 766, 767 },	// IfcWindowStyle
+{ 3698973494, 1628702193, 767, 775 },	// IfcTypeResource
+{ 2574617495, 3698973494, 768, 775 },	// IfcConstructionResourceType
+{ 2185764099, 2574617495, 769, 770 },	// IfcConstructionEquipmentResourceType
+{ 4105962743, 2574617495, 770, 771 },	// IfcConstructionMaterialResourceType
+{ 1525564444, 2574617495, 771, 772 },	// IfcConstructionProductResourceType
+{ 1815067380, 2574617495, 772, 773 },	// IfcCrewResourceType
+{ 428585644, 2574617495, 773, 774 },	// IfcLaborResourceType
+{ 4095615324, 2574617495, 774, 775 },	// IfcSubContractResourceType
+{ 1680319473, 2341007311, 775, 792 },	// IfcPropertyDefinition
+{ 3357820518, 1680319473, 776, 787 },	// IfcPropertySetDefinition
+{ 3967405729, 3357820518, 777, 784 },	// IfcPreDefinedPropertySet
+{ 2963535650, 3967405729, 778, 779 },	// IfcDoorLiningProperties
+{ 1714330368, 3967405729, 779, 780 },	// IfcDoorPanelProperties
+{ 3566463478, 3967405729, 780, 781 },	// IfcPermeableCoveringProperties
+{ 3765753017, 3967405729, 781, 782 },	// IfcReinforcementDefinitionProperties
+{ 336235671, 3967405729, 782, 783 },	// IfcWindowLiningProperties
+{ 512836454, 3967405729, 783, 784 },	// IfcWindowPanelProperties
+{ 1451395588, 3357820518, 784, 785 },	// IfcPropertySet
+{ 2090586900, 3357820518, 785, 787 },	// IfcQuantitySet
+{ 1883228015, 2090586900, 786, 787 },	// IfcElementQuantity
+{ 1482703590, 1680319473, 787, 792 },	// IfcPropertyTemplateDefinition
+{ 492091185, 1482703590, 788, 789 },	// IfcPropertySetTemplate
+{ 3521284610, 1482703590, 789, 792 },	// IfcPropertyTemplate
+{ 3875453745, 3521284610, 790, 791 },	// IfcComplexPropertyTemplate
+{ 3663146110, 3521284610, 791, 792 },	// IfcSimplePropertyTemplate
+{ 478536968, 2341007311, 792, 843 },	// IfcRelationship
+{ 3939117080, 478536968, 793, 801 },	// IfcRelAssigns
+{ 1683148259, 3939117080, 794, 795 },	// IfcRelAssignsToActor
+{ 2495723537, 3939117080, 795, 796 },	// IfcRelAssignsToControl
+{ 1307041759, 3939117080, 796, 798 },	// IfcRelAssignsToGroup
+{ 1027710054, 1307041759, 797, 798 },	// IfcRelAssignsToGroupByFactor
+{ 4278684876, 3939117080, 798, 799 },	// IfcRelAssignsToProcess
+{ 2857406711, 3939117080, 799, 800 },	// IfcRelAssignsToProduct
+{ 205026976, 3939117080, 800, 801 },	// IfcRelAssignsToResource
+{ 1865459582, 478536968, 801, 809 },	// IfcRelAssociates
+{ 4095574036, 1865459582, 802, 803 },	// IfcRelAssociatesApproval
+{ 919958153, 1865459582, 803, 804 },	// IfcRelAssociatesClassification
+{ 2728634034, 1865459582, 804, 805 },	// IfcRelAssociatesConstraint
+{ 982818633, 1865459582, 805, 806 },	// IfcRelAssociatesDocument
+{ 3840914261, 1865459582, 806, 807 },	// IfcRelAssociatesLibrary
+{ 2655215786, 1865459582, 807, 808 },	// IfcRelAssociatesMaterial
+{ 1033248425, 1865459582, 808, 809 },	// IfcRelAssociatesProfileDef
+{ 826625072, 478536968, 809, 831 },	// IfcRelConnects
+{ 1204542856, 826625072, 810, 813 },	// IfcRelConnectsElements
+{ 3945020480, 1204542856, 811, 812 },	// IfcRelConnectsPathElements
+{ 3678494232, 1204542856, 812, 813 },	// IfcRelConnectsWithRealizingElements
+{ 4201705270, 826625072, 813, 814 },	// IfcRelConnectsPortToElement
+{ 3190031847, 826625072, 814, 815 },	// IfcRelConnectsPorts
+{ 2127690289, 826625072, 815, 816 },	// IfcRelConnectsStructuralActivity
+{ 1638771189, 826625072, 816, 818 },	// IfcRelConnectsStructuralMember
+{ 504942748, 1638771189, 817, 818 },	// IfcRelConnectsWithEccentricity
+{ 3242617779, 826625072, 818, 819 },	// IfcRelContainedInSpatialStructure
+{ 886880790, 826625072, 819, 820 },	// IfcRelCoversBldgElements
+{ 2802773753, 826625072, 820, 821 },	// IfcRelCoversSpaces
+{ 3940055652, 826625072, 821, 822 },	// IfcRelFillsElement
+{ 279856033, 826625072, 822, 823 },	// IfcRelFlowControlElements
+{ 427948657, 826625072, 823, 824 },	// IfcRelInterferesElements
+{ 1441486842, 826625072, 824, 825 },	// IfcRelPositions
+{ 1245217292, 826625072, 825, 826 },	// IfcRelReferencedInSpatialStructure
+{ 4122056220, 826625072, 826, 827 },	// IfcRelSequence
+{ 366585022, 826625072, 827, 828 },	// IfcRelServicesBuildings
+{ 3451746338, 826625072, 828, 831 },	// IfcRelSpaceBoundary
+{ 3523091289, 3451746338, 829, 831 },	// IfcRelSpaceBoundary1stLevel
+{ 1521410863, 3523091289, 830, 831 },	// IfcRelSpaceBoundary2ndLevel
+{ 2565941209, 478536968, 831, 832 },	// IfcRelDeclares
+{ 2551354335, 478536968, 832, 838 },	// IfcRelDecomposes
+{ 3818125796, 2551354335, 833, 834 },	// IfcRelAdheresToElement
+{ 160246688, 2551354335, 834, 835 },	// IfcRelAggregates
+{ 3268803585, 2551354335, 835, 836 },	// IfcRelNests
+{ 750771296, 2551354335, 836, 837 },	// IfcRelProjectsElement
+{ 1401173127, 2551354335, 837, 838 },	// IfcRelVoidsElement
+{ 693640335, 478536968, 838, 843 },	// IfcRelDefines
+{ 1462361463, 693640335, 839, 840 },	// IfcRelDefinesByObject
+{ 4186316022, 693640335, 840, 841 },	// IfcRelDefinesByProperties
+{ 307848117, 693640335, 841, 842 },	// IfcRelDefinesByTemplate
+{ 781010003, 693640335, 842, 843 },	// IfcRelDefinesByType
+{ 1054537805, 0, 843, 850 },	// IfcSchedulingTime
+{ 211053100, 1054537805, 844, 845 },	// IfcEventTime
+{ 1585845231, 1054537805, 845, 846 },	// IfcLagTime
+{ 1042787934, 1054537805, 846, 847 },	// IfcResourceTime
+{ 1549132990, 1054537805, 847, 849 },	// IfcTaskTime
+{ 2771591690, 1549132990, 848, 849 },	// IfcTaskTimeRecurring
+{ 1236880293, 1054537805, 849, 850 },	// IfcWorkTime
+{ 867548509, 0, 850, 851 },	// IfcShapeAspect
+{ 2273995522, 0, 851, 854 },	// IfcStructuralConnectionCondition
+{ 4219587988, 2273995522, 852, 853 },	// IfcFailureConnectionCondition
+{ 2609359061, 2273995522, 853, 854 },	// IfcSlippageConnectionCondition
+{ 2162789131, 0, 854, 866 },	// IfcStructuralLoad
+{ 3478079324, 2162789131, 855, 856 },	// IfcStructuralLoadConfiguration
+{ 609421318, 2162789131, 856, 866 },	// IfcStructuralLoadOrResult
+{ 2525727697, 609421318, 857, 865 },	// IfcStructuralLoadStatic
+{ 1595516126, 2525727697, 858, 859 },	// IfcStructuralLoadLinearForce
+{ 2668620305, 2525727697, 859, 860 },	// IfcStructuralLoadPlanarForce
+{ 2473145415, 2525727697, 860, 862 },	// IfcStructuralLoadSingleDisplacement
+{ 1973038258, 2473145415, 861, 862 },	// IfcStructuralLoadSingleDisplacementDistortion
+{ 1597423693, 2525727697, 862, 864 },	// IfcStructuralLoadSingleForce
+{ 1190533807, 1597423693, 863, 864 },	// IfcStructuralLoadSingleForceWarping
+{ 3408363356, 2525727697, 864, 865 },	// IfcStructuralLoadTemperature
+{ 2934153892, 609421318, 865, 866 },	// IfcSurfaceReinforcementArea
+{ 985171141, 0, 866, 867 },	// IfcTable
+{ 2043862942, 0, 867, 868 },	// IfcTableColumn
+{ 531007025, 0, 868, 869 },	// IfcTableRow
+{ 222769930, 0, 869, 871 },	// IfcTextureCoordinateIndices
+{ 1010789467, 222769930, 870, 871 },	// IfcTextureCoordinateIndicesWithVoids
+{ 1199560280, 0, 871, 872 },	// IfcTimePeriod
+{ 3101149627, 0, 872, 875 },	// IfcTimeSeries
+{ 3741457305, 3101149627, 873, 874 },	// IfcIrregularTimeSeries
+{ 3413951693, 3101149627, 874, 875 },	// IfcRegularTimeSeries
+{ 581633288, 0, 875, 876 },	// IfcTimeSeriesValue
+{ 180925521, 0, 876, 877 },	// IfcUnitAssignment
+{ 891718957, 0, 877, 878 },	// IfcVirtualGridIntersection
+{ 1175146630, 0, 878, 879 }};	// IfcWellKnownText
+
+static const std::pair<uint32_t, uint16_t> entity_class_index_by_id[IFC_NUM_ENTITY_CLASSES] = {
+{ 5716631, 716 },
+{ 15328376, 216 },
+{ 24185140, 571 },
+{ 24726584, 513 },
+{ 25142252, 437 },
+{ 32344328, 446 },
+{ 32440307, 244 },
+{ 33720170, 529 },
+{ 39481116, 741 },
+{ 42703149, 239 },
+{ 45288368, 20 },
+{ 59481748, 199 },
+{ 76236018, 500 },
+{ 90941305, 484 },
+{ 101040310, 81 },
+{ 103090709, 360 },
+{ 110355661, 177 },
+{ 125510826, 254 },
+{ 130549933, 11 },
+{ 132023988, 678 },
+{ 144952367, 218 },
+{ 146592293, 576 },
+{ 148013059, 614 },
+{ 148025276, 354 },
+{ 160246688, 834 },
+{ 164193824, 61 },
+{ 167062518, 300 },
+{ 177149247, 466 },
+{ 178086475, 75 },
+{ 178912537, 315 },
+{ 180925521, 876 },
+{ 182550632, 145 },
+{ 182646315, 438 },
+{ 205026976, 800 },
+{ 211053100, 844 },
+{ 214636428, 603 },
+{ 219451334, 358 },
+{ 220341763, 307 },
+{ 222769930, 869 },
+{ 230924584, 311 },
+{ 231477066, 669 },
+{ 234836483, 415 },
+{ 248100487, 56 },
+{ 263784265, 540 },
+{ 264262732, 453 },
+{ 277319702, 496 },
+{ 279856033, 822 },
+{ 280115917, 118 },
+{ 297599258, 162 },
+{ 300633059, 628 },
+{ 307848117, 841 },
+{ 310824031, 480 },
+{ 315944413, 247 },
+{ 317615605, 557 },
+{ 325726236, 564 },
+{ 331165859, 426 },
+{ 335055490, 674 },
+{ 336235671, 782 },
+{ 338393293, 651 },
+{ 339256511, 622 },
+{ 342316401, 478 },
+{ 346874300, 706 },
+{ 366585022, 827 },
+{ 370225590, 327 },
+{ 374418227, 246 },
+{ 377706215, 522 },
+{ 385403989, 380 },
+{ 388784114, 76 },
+{ 395041908, 699 },
+{ 395920057, 408 },
+{ 400855858, 720 },
+{ 402227799, 454 },
+{ 411424972, 9 },
+{ 413509423, 542 },
+{ 427810014, 159 },
+{ 427948657, 823 },
+{ 428585644, 773 },
+{ 445594917, 102 },
+{ 448429030, 73 },
+{ 451544542, 209 },
+{ 463610769, 585 },
+{ 476780140, 331 },
+{ 477187591, 291 },
+{ 478536968, 792 },
+{ 479945903, 691 },
+{ 484807127, 457 },
+{ 488727124, 611 },
+{ 492091185, 788 },
+{ 504942748, 817 },
+{ 506776471, 640 },
+{ 512836454, 783 },
+{ 514975943, 641 },
+{ 525669439, 574 },
+{ 526551008, 621 },
+{ 530289379, 602 },
+{ 531007025, 868 },
+{ 536804194, 6 },
+{ 539742890, 349 },
+{ 544395925, 220 },
+{ 550521510, 582 },
+{ 552965576, 60 },
+{ 562808652, 386 },
+{ 569719735, 618 },
+{ 572779678, 153 },
+{ 574549367, 196 },
+{ 578613899, 660 },
+{ 581633288, 875 },
+{ 590820931, 228 },
+{ 593015953, 287 },
+{ 597895409, 115 },
+{ 602808272, 10 },
+{ 603570806, 265 },
+{ 603775116, 596 },
+{ 609421318, 856 },
+{ 616511568, 113 },
+{ 618182010, 1 },
+{ 618700268, 652 },
+{ 626085974, 112 },
+{ 629592764, 501 },
+{ 630975310, 441 },
+{ 635142910, 476 },
+{ 639361253, 449 },
+{ 639542469, 8 },
+{ 644574406, 572 },
+{ 647756555, 520 },
+{ 647927063, 41 },
+{ 653396225, 361 },
+{ 655969474, 662 },
+{ 663422040, 721 },
+{ 669184980, 192 },
+{ 673634403, 136 },
+{ 677532197, 92 },
+{ 679976338, 637 },
+{ 682877961, 587 },
+{ 683857671, 301 },
+{ 693640335, 838 },
+{ 699246055, 241 },
+{ 707683696, 491 },
+{ 710110818, 639 },
+{ 710998568, 762 },
+{ 712377611, 693 },
+{ 723233188, 277 },
+{ 728799441, 697 },
+{ 734778138, 600 },
+{ 738039164, 472 },
+{ 738692330, 130 },
+{ 747523909, 37 },
+{ 750771296, 836 },
+{ 753842376, 397 },
+{ 759155922, 101 },
+{ 760658860, 52 },
+{ 770865208, 350 },
+{ 775493141, 22 },
+{ 776857604, 95 },
+{ 781010003, 842 },
+{ 782932809, 240 },
+{ 803316827, 338 },
+{ 804291784, 703 },
+{ 807026263, 282 },
+{ 812098782, 250 },
+{ 812556717, 493 },
+{ 816062949, 274 },
+{ 819412036, 514 },
+{ 819618141, 624 },
+{ 823603102, 272 },
+{ 825690147, 91 },
+{ 826625072, 809 },
+{ 840318589, 552 },
+{ 843113511, 401 },
+{ 846575682, 109 },
+{ 852622518, 47 },
+{ 853536259, 352 },
+{ 862014818, 469 },
+{ 867548509, 850 },
+{ 869906466, 701 },
+{ 871118103, 172 },
+{ 886880790, 819 },
+{ 891718957, 877 },
+{ 900683007, 412 },
+{ 901063453, 314 },
+{ 912023232, 3 },
+{ 917726184, 31 },
+{ 919958153, 803 },
+{ 926996030, 538 },
+{ 931644368, 87 },
+{ 941946838, 175 },
+{ 963979645, 578 },
+{ 964333572, 746 },
+{ 976884017, 580 },
+{ 977012517, 683 },
+{ 979691226, 524 },
+{ 982818633, 805 },
+{ 985171141, 866 },
+{ 986844984, 161 },
+{ 987401354, 485 },
+{ 987898635, 249 },
+{ 991950508, 507 },
+{ 1003880860, 470 },
+{ 1004757350, 588 },
+{ 1008929658, 339 },
+{ 1010789467, 870 },
+{ 1027710054, 797 },
+{ 1027922057, 238 },
+{ 1028945134, 373 },
+{ 1029017970, 332 },
+{ 1033248425, 808 },
+{ 1033361043, 388 },
+{ 1039846685, 650 },
+{ 1040185647, 44 },
+{ 1042787934, 846 },
+{ 1045800335, 34 },
+{ 1051575348, 723 },
+{ 1051757585, 477 },
+{ 1052013943, 443 },
+{ 1054537805, 843 },
+{ 1060000209, 610 },
+{ 1062813311, 434 },
+{ 1072016465, 684 },
+{ 1073191201, 414 },
+{ 1076942058, 181 },
+{ 1077100507, 409 },
+{ 1095909175, 399 },
+{ 1096409881, 296 },
+{ 1105321065, 96 },
+{ 1114901282, 726 },
+{ 1123145078, 267 },
+{ 1133259667, 733 },
+{ 1136057603, 217 },
+{ 1154170062, 38 },
+{ 1154579445, 563 },
+{ 1158309216, 634 },
+{ 1161773419, 724 },
+{ 1162798199, 473 },
+{ 1175146630, 878 },
+{ 1177604601, 383 },
+{ 1179482911, 598 },
+{ 1190533807, 863 },
+{ 1199560280, 871 },
+{ 1204542856, 810 },
+{ 1207048766, 79 },
+{ 1209101575, 568 },
+{ 1210645708, 124 },
+{ 1213902940, 306 },
+{ 1217240411, 677 },
+{ 1229763772, 320 },
+{ 1232101972, 214 },
+{ 1235345126, 595 },
+{ 1236880293, 849 },
+{ 1245217292, 825 },
+{ 1251058090, 681 },
+{ 1252848954, 379 },
+{ 1260505505, 211 },
+{ 1260650574, 295 },
+{ 1268542332, 756 },
+{ 1281925730, 227 },
+{ 1285652485, 710 },
+{ 1287392070, 535 },
+{ 1290935644, 285 },
+{ 1299126871, 766 },
+{ 1300840506, 132 },
+{ 1303795690, 64 },
+{ 1304840413, 127 },
+{ 1305183839, 731 },
+{ 1306400036, 632 },
+{ 1307041759, 796 },
+{ 1310608509, 140 },
+{ 1310830890, 577 },
+{ 1329646415, 424 },
+{ 1334484129, 205 },
+{ 1335981549, 519 },
+{ 1339347760, 714 },
+{ 1351298697, 111 },
+{ 1356537516, 310 },
+{ 1360408905, 512 },
+{ 1377556343, 326 },
+{ 1383045692, 149 },
+{ 1383356374, 417 },
+{ 1387855156, 15 },
+{ 1401173127, 837 },
+{ 1402838566, 253 },
+{ 1404847402, 509 },
+{ 1411181986, 353 },
+{ 1411407467, 689 },
+{ 1412071761, 566 },
+{ 1416205885, 203 },
+{ 1417489154, 323 },
+{ 1419761937, 368 },
+{ 1423911732, 270 },
+{ 1425443689, 279 },
+{ 1426591983, 499 },
+{ 1437502449, 503 },
+{ 1437805879, 351 },
+{ 1437953363, 119 },
+{ 1441486842, 824 },
+{ 1447204868, 133 },
+{ 1451395588, 784 },
+{ 1457835157, 631 },
+{ 1462361463, 839 },
+{ 1466758467, 30 },
+{ 1469900589, 646 },
+{ 1472233963, 340 },
+{ 1482703590, 787 },
+{ 1482959167, 704 },
+{ 1484403080, 152 },
+{ 1485152156, 142 },
+{ 1502416096, 402 },
+{ 1507914824, 63 },
+{ 1509187699, 271 },
+{ 1509553395, 541 },
+{ 1520743889, 257 },
+{ 1521410863, 830 },
+{ 1525564444, 771 },
+{ 1529196076, 425 },
+{ 1530820697, 530 },
+{ 1532957894, 719 },
+{ 1534661035, 676 },
+{ 1545765605, 556 },
+{ 1549132990, 847 },
+{ 1560379544, 13 },
+{ 1566485204, 50 },
+{ 1580146022, 166 },
+{ 1580310250, 757 },
+{ 1585845231, 845 },
+{ 1594536857, 549 },
+{ 1595516126, 858 },
+{ 1597423693, 862 },
+{ 1599208980, 666 },
+{ 1600972822, 686 },
+{ 1607154358, 108 },
+{ 1608871552, 356 },
+{ 1620046519, 551 },
+{ 1621171031, 592 },
+{ 1623761950, 517 },
+{ 1626504194, 623 },
+{ 1628702193, 615 },
+{ 1634111441, 495 },
+{ 1635779807, 280 },
+{ 1638771189, 816 },
+{ 1638804497, 502 },
+{ 1640371178, 117 },
+{ 1658829314, 444 },
+{ 1660063152, 346 },
+{ 1662888072, 558 },
+{ 1663979128, 264 },
+{ 1674181508, 394 },
+{ 1675464909, 197 },
+{ 1677625105, 432 },
+{ 1680319473, 775 },
+{ 1682466193, 232 },
+{ 1683148259, 794 },
+{ 1687234759, 407 },
+{ 1692211062, 685 },
+{ 1704287377, 226 },
+{ 1714330368, 779 },
+{ 1735638870, 184 },
+{ 1742049831, 122 },
+{ 1758889154, 395 },
+{ 1763565496, 643 },
+{ 1765591967, 33 },
+{ 1768891740, 729 },
+{ 1770583370, 725 },
+{ 1775413392, 105 },
+{ 1783015770, 663 },
+{ 1785450214, 26 },
+{ 1794013214, 29 },
+{ 1806887404, 682 },
+{ 1807405624, 589 },
+{ 1809719519, 337 },
+{ 1810631287, 737 },
+{ 1815067380, 772 },
+{ 1834744321, 708 },
+{ 1838606355, 53 },
+{ 1842657554, 695 },
+{ 1847130766, 51 },
+{ 1847252529, 57 },
+{ 1856042241, 293 },
+{ 1862484736, 284 },
+{ 1865459582, 801 },
+{ 1871374353, 668 },
+{ 1876633798, 396 },
+{ 1878645084, 110 },
+{ 1883228015, 786 },
+{ 1891881377, 581 },
+{ 1893162501, 636 },
+{ 1894708472, 730 },
+{ 1898987631, 653 },
+{ 1904799276, 498 },
+{ 1907098498, 345 },
+{ 1909888760, 626 },
+{ 1911125066, 687 },
+{ 1916426348, 630 },
+{ 1918398963, 69 },
+{ 1935646853, 309 },
+{ 1945004755, 433 },
+{ 1946335990, 561 },
+{ 1950438474, 727 },
+{ 1953115116, 550 },
+{ 1959218052, 23 },
+{ 1967976161, 212 },
+{ 1971632696, 548 },
+{ 1973038258, 861 },
+{ 1973544240, 403 },
+{ 1975003073, 601 },
+{ 1981873012, 18 },
+{ 1983826977, 106 },
+{ 1999602285, 508 },
+{ 2000195564, 236 },
+{ 2004835150, 259 },
+{ 2016517767, 423 },
+{ 2022407955, 135 },
+{ 2022622350, 126 },
+{ 2028607225, 290 },
+{ 2030761528, 735 },
+{ 2042790032, 167 },
+{ 2043862942, 867 },
+{ 2044713172, 85 },
+{ 2047409740, 245 },
+{ 2056796094, 445 },
+{ 2058353004, 465 },
+{ 2059837836, 198 },
+{ 2063403501, 657 },
+{ 2067069095, 266 },
+{ 2068733104, 459 },
+{ 2069777674, 16 },
+{ 2077209135, 80 },
+{ 2078563270, 504 },
+{ 2082059205, 590 },
+{ 2090586900, 785 },
+{ 2093928680, 86 },
+{ 2095639259, 134 },
+{ 2097647324, 760 },
+{ 2107101300, 667 },
+{ 2108223431, 745 },
+{ 2127690289, 815 },
+{ 2133299955, 121 },
+{ 2142170206, 736 },
+{ 2143335405, 533 },
+{ 2147822146, 278 },
+{ 2157484638, 243 },
+{ 2162789131, 854 },
+{ 2165702409, 268 },
+{ 2176052936, 479 },
+{ 2176059722, 554 },
+{ 2182337498, 416 },
+{ 2185764099, 769 },
+{ 2188021234, 471 },
+{ 2188180465, 670 },
+{ 2197970202, 627 },
+{ 2199411900, 62 },
+{ 2205249479, 328 },
+{ 2218152070, 606 },
+{ 2223149337, 494 },
+{ 2226359599, 84 },
+{ 2233826070, 333 },
+{ 2235152071, 59 },
+{ 2242383968, 43 },
+{ 2247615214, 286 },
+{ 2250791053, 707 },
+{ 2251480897, 25 },
+{ 2254336722, 382 },
+{ 2262370178, 420 },
+{ 2272882330, 450 },
+{ 2273995522, 851 },
+{ 2281632017, 750 },
+{ 2294589976, 316 },
+{ 2295281155, 439 },
+{ 2296667514, 363 },
+{ 2297155007, 717 },
+{ 2301859152, 672 },
+{ 2310774935, 748 },
+{ 2315554128, 696 },
+{ 2320036040, 525 },
+{ 2323601079, 635 },
+{ 2324767716, 645 },
+{ 2341007311, 357 },
+{ 2347385850, 324 },
+{ 2347447852, 527 },
+{ 2347495698, 620 },
+{ 2367409068, 97 },
+{ 2382730787, 369 },
+{ 2387106220, 317 },
+{ 2391368822, 378 },
+{ 2391383451, 531 },
+{ 2391406946, 429 },
+{ 2397081782, 739 },
+{ 2405470396, 90 },
+{ 2415094496, 751 },
+{ 2417008758, 692 },
+{ 2417041796, 131 },
+{ 2433181523, 180 },
+{ 2439245199, 347 },
+{ 2445595289, 604 },
+{ 2453401579, 191 },
+{ 2461110595, 213 },
+{ 2473145415, 860 },
+{ 2474470126, 460 },
+{ 2481509218, 765 },
+{ 2483315170, 82 },
+{ 2485617015, 273 },
+{ 2485787929, 231 },
+{ 2489546625, 743 },
+{ 2495723537, 795 },
+{ 2506170314, 204 },
+{ 2510884976, 224 },
+{ 2513912981, 297 },
+{ 2515109513, 387 },
+{ 2519244187, 343 },
+{ 2525727697, 857 },
+{ 2529465313, 146 },
+{ 2533589738, 649 },
+{ 2542286263, 170 },
+{ 2543172580, 160 },
+{ 2551354335, 832 },
+{ 2552916305, 123 },
+{ 2556980723, 334 },
+{ 2559016684, 103 },
+{ 2559216714, 608 },
+{ 2565941209, 831 },
+{ 2568555532, 521 },
+{ 2571569899, 221 },
+{ 2572171363, 747 },
+{ 2574617495, 768 },
+{ 2581212453, 195 },
+{ 2590856083, 740 },
+{ 2597039031, 67 },
+{ 2598011224, 169 },
+{ 2601014836, 210 },
+{ 2603310189, 281 },
+{ 2604431987, 255 },
+{ 2609359061, 853 },
+{ 2611217952, 225 },
+{ 2614616156, 19 },
+{ 2624227202, 77 },
+{ 2629017746, 303 },
+{ 2635815018, 742 },
+{ 2636378356, 116 },
+{ 2652556860, 288 },
+{ 2655187982, 39 },
+{ 2655215786, 807 },
+{ 2665983363, 329 },
+{ 2668620305, 859 },
+{ 2674252688, 700 },
+{ 2680139844, 547 },
+{ 2691318326, 88 },
+{ 2696325953, 413 },
+{ 2705031697, 139 },
+{ 2706460486, 376 },
+{ 2706606064, 569 },
+{ 2706619895, 68 },
+{ 2713105998, 251 },
+{ 2713554722, 72 },
+{ 2713699986, 545 },
+{ 2715220739, 158 },
+{ 2728634034, 804 },
+{ 2732653382, 21 },
+{ 2735484536, 234 },
+{ 2736907675, 193 },
+{ 2740243338, 262 },
+{ 2744685151, 391 },
+{ 2752243245, 174 },
+{ 2757150158, 594 },
+{ 2759199220, 342 },
+{ 2769231204, 553 },
+{ 2770003689, 155 },
+{ 2771591690, 848 },
+{ 2775532180, 252 },
+{ 2777663545, 305 },
+{ 2778083089, 156 },
+{ 2781568857, 647 },
+{ 2798486643, 206 },
+{ 2799835756, 344 },
+{ 2802773753, 820 },
+{ 2802850158, 164 },
+{ 2804161546, 292 },
+{ 2809605785, 312 },
+{ 2814081492, 455 },
+{ 2816379211, 673 },
+{ 2827207264, 532 },
+{ 2827736869, 302 },
+{ 2830218821, 185 },
+{ 2835456948, 151 },
+{ 2837617999, 728 },
+{ 2839578677, 318 },
+{ 2852063980, 55 },
+{ 2853485674, 567 },
+{ 2857406711, 799 },
+{ 2859738748, 17 },
+{ 2874132201, 658 },
+{ 2879124712, 4 },
+{ 2887950389, 299 },
+{ 2889183280, 71 },
+{ 2893384427, 644 },
+{ 2898700619, 219 },
+{ 2898889636, 148 },
+{ 2904328755, 371 },
+{ 2914609552, 607 },
+{ 2916149573, 319 },
+{ 2924175390, 341 },
+{ 2934153892, 865 },
+{ 2937912522, 150 },
+{ 2938176219, 447 },
+{ 2940368186, 711 },
+{ 2943643501, 355 },
+{ 2945172077, 389 },
+{ 2949456006, 35 },
+{ 2951183804, 671 },
+{ 2954562838, 675 },
+{ 2963535650, 778 },
+{ 2979338954, 518 },
+{ 2986769608, 381 },
+{ 2998442950, 144 },
+{ 3001207471, 659 },
+{ 3008276851, 335 },
+{ 3008791417, 190 },
+{ 3009204131, 562 },
+{ 3009222698, 734 },
+{ 3020489413, 48 },
+{ 3021840470, 83 },
+{ 3024970846, 421 },
+{ 3026737570, 463 },
+{ 3027567501, 523 },
+{ 3040386961, 442 },
+{ 3041715199, 560 },
+{ 3049322572, 186 },
+{ 3050246964, 70 },
+{ 3053780830, 506 },
+{ 3057273783, 27 },
+{ 3071239417, 536 },
+{ 3071757647, 157 },
+{ 3079605661, 65 },
+{ 3081323446, 749 },
+{ 3087945054, 436 },
+{ 3101149627, 872 },
+{ 3101698114, 539 },
+{ 3112655638, 732 },
+{ 3113134337, 242 },
+{ 3119450353, 128 },
+{ 3124254112, 570 },
+{ 3124975700, 322 },
+{ 3125803723, 261 },
+{ 3132237377, 481 },
+{ 3136571912, 597 },
+{ 3150382593, 141 },
+{ 3171933400, 418 },
+{ 3174744832, 679 },
+{ 3179687236, 664 },
+{ 3181161470, 638 },
+{ 3190031847, 814 },
+{ 3198132628, 698 },
+{ 3200245327, 40 },
+{ 3203706013, 633 },
+{ 3205830791, 385 },
+{ 3206491090, 619 },
+{ 3207858831, 147 },
+{ 3221913625, 497 },
+{ 3242617779, 818 },
+{ 3243963512, 294 },
+{ 3252649465, 89 },
+{ 3256556792, 656 },
+{ 3264961684, 94 },
+{ 3265635763, 163 },
+{ 3268803585, 835 },
+{ 3277789161, 715 },
+{ 3283111854, 422 },
+{ 3285139300, 93 },
+{ 3290496277, 419 },
+{ 3293443760, 365 },
+{ 3293546465, 709 },
+{ 3295246426, 612 },
+{ 3296154744, 400 },
+{ 3303107099, 107 },
+{ 3303938423, 58 },
+{ 3304561284, 431 },
+{ 3310460725, 492 },
+{ 3313531582, 754 },
+{ 3314249567, 546 },
+{ 3319311131, 458 },
+{ 3327091369, 370 },
+{ 3331915920, 202 },
+{ 3342526732, 375 },
+{ 3352864051, 718 },
+{ 3355820592, 2 },
+{ 3357820518, 776 },
+{ 3367102660, 14 },
+{ 3368373690, 24 },
+{ 3376911765, 410 },
+{ 3377609919, 187 },
+{ 3381221214, 233 },
+{ 3388369263, 229 },
+{ 3390157468, 680 },
+{ 3404854881, 66 },
+{ 3406155212, 336 },
+{ 3408363356, 864 },
+{ 3413951693, 874 },
+{ 3415622556, 483 },
+{ 3419103109, 359 },
+{ 3420628829, 461 },
+{ 3422422726, 258 },
+{ 3425423356, 263 },
+{ 3425753595, 428 },
+{ 3426335179, 405 },
+{ 3448662350, 188 },
+{ 3451746338, 828 },
+{ 3452421091, 46 },
+{ 3454111270, 304 },
+{ 3460190687, 377 },
+{ 3460952963, 488 },
+{ 3465909080, 120 },
+{ 3473067441, 392 },
+{ 3478079324, 855 },
+{ 3486308946, 201 },
+{ 3493046030, 543 },
+{ 3495092785, 404 },
+{ 3497074424, 235 },
+{ 3505215534, 230 },
+{ 3508470533, 511 },
+{ 3510044353, 98 },
+{ 3512223829, 430 },
+{ 3518393246, 489 },
+{ 3521284610, 789 },
+{ 3523091289, 829 },
+{ 3544373492, 586 },
+{ 3548104201, 45 },
+{ 3566463478, 780 },
+{ 3570813810, 99 },
+{ 3571504051, 482 },
+{ 3588315303, 537 },
+{ 3590301190, 248 },
+{ 3593883385, 223 },
+{ 3599934289, 752 },
+{ 3611470254, 125 },
+{ 3612865200, 490 },
+{ 3615266464, 154 },
+{ 3626867408, 208 },
+{ 3630933823, 0 },
+{ 3632507154, 143 },
+{ 3633395639, 7 },
+{ 3640358203, 452 },
+{ 3649129432, 194 },
+{ 3649138523, 625 },
+{ 3649235739, 237 },
+{ 3650150729, 176 },
+{ 3651124850, 534 },
+{ 3651464721, 761 },
+{ 3657597509, 591 },
+{ 3663046924, 528 },
+{ 3663146110, 791 },
+{ 3665877780, 759 },
+{ 3678494232, 812 },
+{ 3689010777, 593 },
+{ 3692461612, 171 },
+{ 3693000487, 468 },
+{ 3694346114, 505 },
+{ 3698973494, 767 },
+{ 3701648758, 74 },
+{ 3708119000, 54 },
+{ 3710013099, 178 },
+{ 3724593414, 222 },
+{ 3727388367, 100 },
+{ 3732053477, 42 },
+{ 3732776249, 215 },
+{ 3736923433, 616 },
+{ 3737207727, 283 },
+{ 3740093272, 559 },
+{ 3741457305, 873 },
+{ 3747195512, 456 },
+{ 3749851601, 200 },
+{ 3752311538, 5 },
+{ 3758799889, 486 },
+{ 3760055223, 712 },
+{ 3765753017, 781 },
+{ 3778827333, 165 },
+{ 3798115385, 138 },
+{ 3798194928, 411 },
+{ 3800577675, 129 },
+{ 3812236995, 764 },
+{ 3815607619, 694 },
+{ 3818125796, 833 },
+{ 3821786052, 366 },
+{ 3824725483, 526 },
+{ 3825984169, 462 },
+{ 3827777499, 613 },
+{ 3840914261, 806 },
+{ 3843373140, 32 },
+{ 3849074793, 665 },
+{ 3850581409, 705 },
+{ 3856911033, 584 },
+{ 3862327254, 384 },
+{ 3869604511, 348 },
+{ 3875453745, 790 },
+{ 3888040117, 362 },
+{ 3893378262, 763 },
+{ 3893394355, 655 },
+{ 3895139033, 367 },
+{ 3898045240, 609 },
+{ 3900360178, 330 },
+{ 3902619387, 448 },
+{ 3905492369, 114 },
+{ 3907093117, 688 },
+{ 3915482550, 179 },
+{ 3939117080, 793 },
+{ 3940055652, 821 },
+{ 3945020480, 811 },
+{ 3946677679, 738 },
+{ 3948183225, 744 },
+{ 3956297820, 753 },
+{ 3958052878, 325 },
+{ 3958567839, 137 },
+{ 3961806047, 690 },
+{ 3967405729, 777 },
+{ 3979015343, 605 },
+{ 3982875396, 182 },
+{ 3992365140, 575 },
+{ 3999819293, 406 },
+{ 4006246654, 104 },
+{ 4009809668, 654 },
+{ 4015995234, 308 },
+{ 4017108033, 642 },
+{ 4021432810, 565 },
+{ 4022376103, 269 },
+{ 4024345920, 617 },
+{ 4031249490, 573 },
+{ 4037036970, 12 },
+{ 4037862832, 661 },
+{ 4074379575, 467 },
+{ 4074543187, 648 },
+{ 4086658281, 440 },
+{ 4088093105, 372 },
+{ 4095422895, 758 },
+{ 4095574036, 802 },
+{ 4095615324, 774 },
+{ 4097777520, 583 },
+{ 4105526436, 28 },
+{ 4105962743, 770 },
+{ 4122056220, 826 },
+{ 4123344466, 516 },
+{ 4124623270, 276 },
+{ 4124788165, 313 },
+{ 4136498852, 451 },
+{ 4142052618, 189 },
+{ 4143007308, 364 },
+{ 4148101412, 390 },
+{ 4158566097, 207 },
+{ 4162380809, 49 },
+{ 4165799628, 168 },
+{ 4166981789, 173 },
+{ 4175244083, 515 },
+{ 4182860854, 298 },
+{ 4186316022, 840 },
+{ 4189326743, 629 },
+{ 4196446775, 398 },
+{ 4201705270, 813 },
+{ 4207607924, 474 },
+{ 4208778838, 393 },
+{ 4212018352, 275 },
+{ 4217484030, 487 },
+{ 4218914973, 374 },
+{ 4219587988, 852 },
+{ 4222183408, 722 },
+{ 4228831410, 579 },
+{ 4230923436, 544 },
+{ 4231323485, 713 },
+{ 4234616927, 289 },
+{ 4237592921, 510 },
+{ 4238390223, 755 },
+{ 4240577450, 183 },
+{ 4243806635, 599 },
+{ 4251960020, 78 },
+{ 4252922144, 427 },
+{ 4261334040, 260 },
+{ 4266260250, 555 },
+{ 4266656042, 256 },
+{ 4278684876, 798 },
+{ 4278956645, 475 },
+{ 4282788508, 321 },
+{ 4288193352, 435 },
+{ 4288270099, 702 },
+{ 4292641817, 464 },
+{ 4294318154, 36 }};
+
+const IFC4X3::EntityClassInfo* IFC4X3::EntityFactory::getEntityClassInfo( uint32_t ifcClassID )
+{
+	auto it_find = std::lower_bound( entity_class_index_by_id, entity_class_index_by_id + IFC_NUM_ENTITY_CLASSES, ifcClassID,
+		[]( const std::pair<uint32_t, uint16_t>& entry, uint32_t id ) { return entry.first < id; } );
+	if( it_find != entity_class_index_by_id + IFC_NUM_ENTITY_CLASSES && it_find->first == ifcClassID )
+	{
+		return &entity_class_infos[it_find->second];
+	}
+	return nullptr;
+}
+const IFC4X3::EntityClassInfo& IFC4X3::EntityFactory::getEntityClassInfoByIndex( uint16_t index )
+{
+	return entity_class_infos[index];
+}
+static BuildingEntity* (*const entity_factory_by_index[IFC_NUM_ENTITY_CLASSES])() = {
+[]()->BuildingEntity* { return new IFC4X3::IfcActorRole(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAddress(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPostalAddress(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTelecomAddress(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentParameterSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentCantSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentHorizontalSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentVerticalSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcApplication(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAppliedValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCostValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcApproval(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryEdgeCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryFaceCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryNodeCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryNodeConditionWarping(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionGeometry(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionCurveGeometry(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionPointGeometry(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionPointEccentricity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionSurfaceGeometry(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectionVolumeGeometry(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstraint(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMetric(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcObjective(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoordinateOperation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMapConversion(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMapConversionScaled(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRigidOperation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoordinateReferenceSystem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeographicCRS(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProjectedCRS(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDerivedUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDerivedUnitElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDimensionalExponents(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternalInformation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcClassification(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDocumentInformation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLibraryInformation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternalReference(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcClassificationReference(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDocumentReference(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternallyDefinedHatchStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternallyDefinedSurfaceStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternallyDefinedTextFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLibraryReference(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGridAxis(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIrregularTimeSeriesValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightDistributionData(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightIntensityDistribution(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialClassificationRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterial(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialConstituent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialConstituentSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialLayer(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialLayerWithOffsets(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialLayerSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProfile(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProfileWithOffsets(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProfileSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialList(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialUsageDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialLayerSetUsage(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProfileSetUsage(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProfileSetUsageTapering(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMeasureWithUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMonetaryUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcNamedUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcContextDependentUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConversionBasedUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConversionBasedUnitWithOffset(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSIUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcObjectPlacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGridPlacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLinearPlacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLocalPlacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOrganization(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOwnerHistory(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPerson(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPersonAndOrganization(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPhysicalQuantity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPhysicalComplexQuantity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPhysicalSimpleQuantity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityArea(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityCount(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityLength(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityNumber(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityVolume(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantityWeight(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPresentationItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcColourRgbList(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcColourSpecification(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcColourRgb(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveStyleFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveStyleFontAndScaling(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveStyleFontPattern(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedColourMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedColour(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDraughtingPreDefinedColour(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedCurveFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDraughtingPreDefinedCurveFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedTextFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextStyleFontModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyleLighting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyleRefraction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyleShading(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyleRendering(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyleWithTextures(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceTexture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBlobTexture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcImageTexture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPixelTexture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextStyleForDefinedFont(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextStyleTextModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureCoordinate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedTextureMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedPolygonalTextureMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedTriangleTextureMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureCoordinateGenerator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureVertex(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureVertexList(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPresentationLayerAssignment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPresentationLayerWithStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPresentationStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFillAreaStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPresentationStyleAssignment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProductRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialDefinitionRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProductDefinitionShape(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcArbitraryClosedProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcArbitraryProfileDefWithVoids(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcArbitraryOpenProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCenterLineProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompositeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDerivedProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMirroredProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOpenCrossProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcParameterizedProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAsymmetricIShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCircleProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCircleHollowProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEllipseProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRectangleProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRectangleHollowProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoundedRectangleProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTrapeziumProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcZShapeProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyAbstraction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExtendedProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProfileProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcementBarProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionReinforcementProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProperty(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcComplexProperty(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSimpleProperty(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyBoundedValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyEnumeratedValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyListValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyReferenceValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertySingleValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyTableValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyEnumeration(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRecurrencePattern(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReference(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShapeModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShapeRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTopologyRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStyleModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStyledRepresentation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRepresentationContext(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeometricRepresentationContext(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeometricRepresentationSubContext(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRepresentationItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeometricRepresentationItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAnnotationFillArea(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBooleanResult(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBooleanClippingResult(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundingBox(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianPointList(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianPointList2D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianPointList3D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianTransformationOperator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianTransformationOperator2D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianTransformationOperator2DnonUniform(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianTransformationOperator3D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianTransformationOperator3DnonUniform(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCsgPrimitive3D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBlock(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRectangularPyramid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRightCircularCone(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRightCircularCylinder(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSphere(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundedCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBSplineCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBSplineCurveWithKnots(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRationalBSplineCurveWithKnots(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompositeCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompositeCurveOnSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundaryCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOuterBoundaryCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGradientCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSegmentedReferenceCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedPolyCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPolyline(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTrimmedCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConic(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCircle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEllipse(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLine(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOffsetCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOffsetCurve2D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOffsetCurve3D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOffsetCurveByDistances(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPcurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPolynomialCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcClothoid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCosineSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSecondOrderPolynomialSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSeventhOrderPolynomialSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSineSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcThirdOrderPolynomialSpiral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIntersectionCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSeamCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDirection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFaceBasedSurfaceModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFillAreaStyleHatching(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFillAreaStyleTiles(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeometricSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeometricCurveSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcHalfSpaceSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoxedHalfSpace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPolygonalBoundedHalfSpace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSourceAmbient(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSourceDirectional(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSourceGoniometric(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSourcePositional(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightSourceSpot(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAxis1Placement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAxis2Placement2D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAxis2Placement3D(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAxis2PlacementLinear(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlanarExtent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlanarBox(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPoint(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCartesianPoint(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPointByDistanceExpression(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPointOnCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPointOnSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionedSpine(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompositeCurveSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReparametrisedCompositeCurveSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShellBasedSurfaceModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSolidModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCsgSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcManifoldSolidBrep(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAdvancedBrep(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAdvancedBrepWithVoids(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFacetedBrep(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFacetedBrepWithVoids(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionedSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionedSolidHorizontal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSweptAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDirectrixCurveSweptAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFixedReferenceSweptAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceCurveSweptAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExtrudedAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExtrudedAreaSolidTapered(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRevolvedAreaSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRevolvedAreaSolidTapered(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSweptDiskSolid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSweptDiskSolidPolygonal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoundedSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBSplineSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBSplineSurfaceWithKnots(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRationalBSplineSurfaceWithKnots(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveBoundedPlane(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurveBoundedSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRectangularTrimmedSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementarySurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCylindricalSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlane(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSphericalSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcToroidalSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSectionedSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSweptSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceOfLinearExtrusion(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceOfRevolution(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTessellatedItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedPolygonalFace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIndexedPolygonalFaceWithVoids(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTessellatedFaceSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPolygonalFaceSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTriangulatedFaceSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTriangulatedIrregularNetwork(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextLiteral(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextLiteralWithExtent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVector(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMappedItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStyledItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTopologicalRepresentationItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConnectedFaceSet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcClosedShell(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOpenShell(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEdge(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEdgeCurve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOrientedEdge(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSubedge(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFaceSurface(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAdvancedFace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFaceBound(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFaceOuterBound(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLoop(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEdgeLoop(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPolyLoop(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVertexLoop(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPath(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVertex(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVertexPoint(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRepresentationMap(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcResourceLevelRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcApprovalRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurrencyRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDocumentInformationRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternalReferenceRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMaterialRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOrganizationRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyDependencyRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcResourceApprovalRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcResourceConstraintRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoot(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcObjectDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcContext(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProject(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProjectLibrary(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcObject(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcActor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOccupant(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcControl(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcActionRequest(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCostItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCostSchedule(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPerformanceHistory(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPermit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProjectOrder(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWorkCalendar(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWorkControl(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWorkPlan(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWorkSchedule(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGroup(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAsset(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcInventory(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadGroup(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadCase(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralResultGroup(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSystem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingSystem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuiltSystem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionSystem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionCircuit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralAnalysisModel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcZone(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProcess(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEvent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProcedure(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTask(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProduct(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAnnotation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuiltElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBeam(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBearing(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingElementProxy(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcChimney(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcColumn(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCourse(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCovering(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurtainWall(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDeepFoundation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCaissonFoundation(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPile(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDoor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEarthworksElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEarthworksFill(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcedSoil(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFooting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcKerb(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMember(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMooringDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcNavigationElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPavement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRail(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRailing(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRamp(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRampFlight(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoof(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShadingDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSlab(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStair(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStairFlight(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTrackElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWall(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWallStandardCase(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWindow(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCivilElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionControlElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcActuator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlarm(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcController(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowInstrument(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProtectiveDeviceTrippingUnit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSensor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUnitaryControlElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionFlowElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionChamberElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEnergyConversionDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirToAirHeatRecovery(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoiler(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBurner(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcChiller(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoil(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCondenser(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCooledBeam(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoolingTower(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricGenerator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricMotor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEngine(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEvaporativeCooler(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEvaporator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcHeatExchanger(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcHumidifier(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMotorConnection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSolarDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransformer(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTubeBundle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUnitaryEquipment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowController(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirTerminalBox(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDamper(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionBoard(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricDistributionBoard(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricTimeControl(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowMeter(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProtectiveDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSwitchingDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcValve(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowFitting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableCarrierFitting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableFitting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctFitting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcJunctionBox(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPipeFitting(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowMovingDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompressor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFan(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPump(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableCarrierSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConveyorSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPipeSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowStorageDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricFlowStorageDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTank(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAudioVisualAppliance(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCommunicationsAppliance(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricAppliance(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFireSuppressionTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLamp(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightFixture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLiquidTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMedicalDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMobileTelecommunicationsAppliance(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOutlet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSanitaryTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSignal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpaceHeater(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStackTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWasteTerminal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowTreatmentDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctSilencer(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricFlowTreatmentDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFilter(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcInterceptor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementAssembly(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementComponent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingElementPart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDiscreteAccessory(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFastener(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcImpactProtectionDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMechanicalFastener(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingBar(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingMesh(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendon(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendonAnchor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendonConduit(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSign(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVibrationDamper(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVibrationIsolator(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFeatureElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFeatureElementAddition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProjectionElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFeatureElementSubtraction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEarthworksCut(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOpeningElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVoidingFeature(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceFeature(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFurnishingElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFurniture(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSystemFurnitureElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeographicElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeotechnicalElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeotechnicalAssembly(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBorehole(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeomodel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeoslice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeotechnicalStratum(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransportationDevice(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransportElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVehicle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVirtualElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLinearElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentCant(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentHorizontal(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentSegment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignmentVertical(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPort(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionPort(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPositioningElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGrid(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLinearPositioningElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlignment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReferent(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternalSpatialStructureElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcExternalSpatialElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialStructureElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingStorey(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFacility(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBridge(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuilding(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMarineFacility(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRailway(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoad(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFacilityPart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBridgePart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFacilityPartCommon(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMarinePart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRailwayPart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoadPart(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSite(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpace(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialZone(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralActivity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralCurveAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLinearAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralPointAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralSurfaceAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralPlanarAction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralReaction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralCurveReaction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralPointReaction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralSurfaceReaction(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralItem(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralConnection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralCurveConnection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralPointConnection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralSurfaceConnection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralMember(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralCurveMember(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralCurveMemberVarying(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralSurfaceMember(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralSurfaceMemberVarying(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionEquipmentResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionMaterialResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionProductResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCrewResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLaborResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSubContractResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTypeObject(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTypeProcess(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEventType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProcedureType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTaskType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTypeProduct(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDoorStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuiltElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBeamType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBearingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingElementProxyType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcChimneyType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcColumnType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCourseType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoveringType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCurtainWallType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDeepFoundationType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCaissonFoundationType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPileType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDoorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFootingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcKerbType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMemberType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMooringDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcNavigationElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPavementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPlateType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRailType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRailingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRampFlightType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRampType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRoofType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShadingDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSlabType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStairFlightType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStairType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTrackElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWallType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWindowType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCivilElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionControlElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcActuatorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAlarmType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcControllerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowInstrumentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProtectiveDeviceTrippingUnitType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSensorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUnitaryControlElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionFlowElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionChamberElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEnergyConversionDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirToAirHeatRecoveryType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBoilerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBurnerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcChillerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoilType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCondenserType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCooledBeamType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCoolingTowerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricGeneratorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricMotorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEngineType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEvaporativeCoolerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEvaporatorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcHeatExchangerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcHumidifierType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMotorConnectionType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSolarDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransformerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTubeBundleType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUnitaryEquipmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowControllerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirTerminalBoxType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDamperType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDistributionBoardType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricDistributionBoardType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricTimeControlType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowMeterType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcProtectiveDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSwitchingDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcValveType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowFittingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableCarrierFittingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableFittingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctFittingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcJunctionBoxType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPipeFittingType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowMovingDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCompressorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFanType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPumpType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableCarrierSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCableSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConveyorSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPipeSegmentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowStorageDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricFlowStorageDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTankType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAirTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcAudioVisualApplianceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCommunicationsApplianceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricApplianceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFireSuppressionTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLampType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLightFixtureType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLiquidTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMedicalDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMobileTelecommunicationsApplianceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcOutletType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSanitaryTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSignalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpaceHeaterType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStackTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWasteTerminalType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFlowTreatmentDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDuctSilencerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElectricFlowTreatmentDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFilterType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcInterceptorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementAssemblyType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementComponentType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcBuildingElementPartType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDiscreteAccessoryType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFastenerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcImpactProtectionDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcMechanicalFastenerType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingBarType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcingMeshType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendonAnchorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendonConduitType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTendonType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSignType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVibrationDamperType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVibrationIsolatorType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFurnishingElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFurnitureType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSystemFurnitureElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcGeographicElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransportationDeviceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTransportElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVehicleType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialStructureElementType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpaceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSpatialZoneType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWindowStyle(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTypeResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionEquipmentResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionMaterialResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcConstructionProductResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcCrewResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLaborResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSubContractResourceType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertySetDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPreDefinedPropertySet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDoorLiningProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcDoorPanelProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPermeableCoveringProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcReinforcementDefinitionProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWindowLiningProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWindowPanelProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertySet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcQuantitySet(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcElementQuantity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyTemplateDefinition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertySetTemplate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcPropertyTemplate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcComplexPropertyTemplate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSimplePropertyTemplate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelationship(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssigns(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToActor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToControl(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToGroup(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToGroupByFactor(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToProcess(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToProduct(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssignsToResource(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociates(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesApproval(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesClassification(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesConstraint(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesDocument(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesLibrary(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesMaterial(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAssociatesProfileDef(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnects(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsPathElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsWithRealizingElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsPortToElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsPorts(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsStructuralActivity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsStructuralMember(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelConnectsWithEccentricity(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelContainedInSpatialStructure(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelCoversBldgElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelCoversSpaces(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelFillsElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelFlowControlElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelInterferesElements(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelPositions(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelReferencedInSpatialStructure(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelSequence(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelServicesBuildings(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelSpaceBoundary(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelSpaceBoundary1stLevel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelSpaceBoundary2ndLevel(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDeclares(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDecomposes(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAdheresToElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelAggregates(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelNests(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelProjectsElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelVoidsElement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDefines(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDefinesByObject(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDefinesByProperties(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDefinesByTemplate(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRelDefinesByType(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSchedulingTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcEventTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcLagTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcResourceTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTaskTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTaskTimeRecurring(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWorkTime(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcShapeAspect(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralConnectionCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcFailureConnectionCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSlippageConnectionCondition(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoad(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadConfiguration(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadOrResult(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadStatic(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadLinearForce(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadPlanarForce(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadSingleDisplacement(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadSingleDisplacementDistortion(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadSingleForce(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadSingleForceWarping(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcStructuralLoadTemperature(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcSurfaceReinforcementArea(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTable(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTableColumn(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTableRow(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureCoordinateIndices(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTextureCoordinateIndicesWithVoids(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTimePeriod(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTimeSeries(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcIrregularTimeSeries(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcRegularTimeSeries(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcTimeSeriesValue(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcUnitAssignment(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcVirtualGridIntersection(); },
+[]()->BuildingEntity* { return new IFC4X3::IfcWellKnownText(); }};
+
+BuildingEntity* IFC4X3::EntityFactory::createEntityObject( uint32_t ifcClassID )
+{
+	const EntityClassInfo* info = getEntityClassInfo( ifcClassID );
+	if( info )
+	{
+		return entity_factory_by_index[info->m_index]();
+	}
+	// not an entity class
+	return nullptr;
+}
+static const char* inverse_attribute_names[IFC4X3::INVERSE_NUM_ATTRIBUTES] = {
+"AdheresToElement",
+"ApprovedObjects",
+"ApprovedResources",
+"AssignedStructuralActivity",
+"AssignedToFlowElement",
+"AssignedToStructuralItem",
+"AssociatedTo",
+"BoundedBy",
+"ClassificationForObjects",
+"ClassificationRefForObjects",
+"ConnectedBy",
+"ConnectedFrom",
+"ConnectedTo",
+"ConnectsStructuralMembers",
+"ContainedIn",
+"ContainedInStructure",
+"ContainsElements",
+"Controls",
+"Corresponds",
+"CoversElements",
+"CoversSpaces",
+"Declares",
+"Decomposes",
+"Defines",
+"DefinesOccurrence",
+"DefinesType",
+"DocumentInfoForObjects",
+"DocumentRefForObjects",
+"EngagedIn",
+"Engages",
+"ExternalReferenceForResources",
+"FillsVoids",
+"HasApprovals",
+"HasAssignments",
+"HasAssociations",
+"HasColours",
+"HasConstraints",
+"HasContext",
+"HasControlElements",
+"HasCoordinateOperation",
+"HasCoverings",
+"HasDocumentReferences",
+"HasExternalReference",
+"HasExternalReferences",
+"HasFillings",
+"HasIntersections",
+"HasLibraryReferences",
+"HasOpenings",
+"HasPorts",
+"HasProjections",
+"HasProperties",
+"HasReferences",
+"HasRepresentation",
+"HasShapeAspects",
+"HasSubContexts",
+"HasSurfaceFeatures",
+"HasTexCoords",
+"HasTextureMaps",
+"HasTextures",
+"InnerBoundaries",
+"InterferesElements",
+"IsActingUpon",
+"IsConnectionRealization",
+"IsDeclaredBy",
+"IsDecomposedBy",
+"IsDefinedBy",
+"IsGroupedBy",
+"IsInterferedByElements",
+"IsMappedBy",
+"IsNestedBy",
+"IsPointedTo",
+"IsPointer",
+"IsPredecessorTo",
+"IsRelatedBy",
+"IsRelatedWith",
+"IsSuccessorFrom",
+"IsTypedBy",
+"LayerAssignment",
+"LayerAssignments",
+"LibraryInfoForObjects",
+"LibraryRefForObjects",
+"LoadGroupFor",
+"MapUsage",
+"Nests",
+"OfOrganization",
+"OfPerson",
+"OfProductRepresentation",
+"OfShapeAspect",
+"OperatesOn",
+"PartOfComplex",
+"PartOfComplexTemplate",
+"PartOfPset",
+"PartOfPsetTemplate",
+"PartOfU",
+"PartOfV",
+"PartOfW",
+"PlacesObject",
+"PositionedRelativeTo",
+"Positions",
+"ProjectsElements",
+"PropertiesForConstraint",
+"PropertyDependsOn",
+"PropertyForDependance",
+"ProvidesBoundaries",
+"ReferencedBy",
+"ReferencedByPlacements",
+"ReferencedInStructures",
+"ReferencesElements",
+"Relates",
+"RelatesTo",
+"RepresentationMap",
+"RepresentationsInContext",
+"ResourceOf",
+"ResultGroupFor",
+"ServicedBySystems",
+"ServicesBuildings",
+"ServicesFacilities",
+"ShapeOfProduct",
+"SourceOfResultGroup",
+"StyledByItem",
+"ToFaceSet",
+"ToMaterialConstituentSet",
+"ToMaterialLayerSet",
+"ToMaterialProfileSet",
+"ToTexMap",
+"Types",
+"UsedInStyles",
+"UsingCurves",
+"VoidsElements",
+"WellKnownText"};
+
+const char* IFC4X3::EntityFactory::getInverseAttributeName( uint16_t inverseAttribute )
+{
+	if( inverseAttribute >= IFC4X3::INVERSE_NUM_ATTRIBUTES )
+	{
+		return nullptr;
+	}
+	return inverse_attribute_names[inverseAttribute];
+}
+
+bool BuildingEntity::isA( uint32_t ifcClassID ) const
+{
+	const IFC4X3::EntityClassInfo* info = IFC4X3::EntityFactory::getEntityClassInfo( ifcClassID );
+	if( !info )
+	{
+		return false;
+	}
+	const uint16_t index = classIndex();
+	return index >= info->m_index && index < info->m_index_end;
+}
+static const std::map<std::string, uint32_t> entity_class_id_by_name = {
+{ "IFCACTIONREQUEST", 3821786052 },
+{ "IFCACTOR", 2296667514 },
+{ "IFCACTORROLE", 3630933823 },
+{ "IFCACTUATOR", 4288193352 },
+{ "IFCACTUATORTYPE", 2874132201 },
+{ "IFCADDRESS", 618182010 },
+{ "IFCADVANCEDBREP", 1635779807 },
+{ "IFCADVANCEDBREPWITHVOIDS", 2603310189 },
+{ "IFCADVANCEDFACE", 3406155212 },
+{ "IFCAIRTERMINAL", 1634111441 },
+{ "IFCAIRTERMINALBOX", 177149247 },
+{ "IFCAIRTERMINALBOXTYPE", 1411407467 },
+{ "IFCAIRTERMINALTYPE", 3352864051 },
+{ "IFCAIRTOAIRHEATRECOVERY", 2056796094 },
+{ "IFCAIRTOAIRHEATRECOVERYTYPE", 1871374353 },
+{ "IFCALARM", 3087945054 },
+{ "IFCALARMTYPE", 3001207471 },
+{ "IFCALIGNMENT", 325726236 },
+{ "IFCALIGNMENTCANT", 4266260250 },
+{ "IFCALIGNMENTCANTSEGMENT", 3752311538 },
+{ "IFCALIGNMENTHORIZONTAL", 1545765605 },
+{ "IFCALIGNMENTHORIZONTALSEGMENT", 536804194 },
+{ "IFCALIGNMENTPARAMETERSEGMENT", 2879124712 },
+{ "IFCALIGNMENTSEGMENT", 317615605 },
+{ "IFCALIGNMENTVERTICAL", 1662888072 },
+{ "IFCALIGNMENTVERTICALSEGMENT", 3633395639 },
+{ "IFCANNOTATION", 1674181508 },
+{ "IFCANNOTATIONFILLAREA", 669184980 },
+{ "IFCAPPLICATION", 639542469 },
+{ "IFCAPPLIEDVALUE", 411424972 },
+{ "IFCAPPROVAL", 130549933 },
+{ "IFCAPPROVALRELATIONSHIP", 3869604511 },
+{ "IFCARBITRARYCLOSEDPROFILEDEF", 3798115385 },
+{ "IFCARBITRARYOPENPROFILEDEF", 1310608509 },
+{ "IFCARBITRARYPROFILEDEFWITHVOIDS", 2705031697 },
+{ "IFCASSET", 3460190687 },
+{ "IFCASYMMETRICISHAPEPROFILEDEF", 3207858831 },
+{ "IFCAUDIOVISUALAPPLIANCE", 277319702 },
+{ "IFCAUDIOVISUALAPPLIANCETYPE", 1532957894 },
+{ "IFCAXIS1PLACEMENT", 4261334040 },
+{ "IFCAXIS2PLACEMENT2D", 3125803723 },
+{ "IFCAXIS2PLACEMENT3D", 2740243338 },
+{ "IFCAXIS2PLACEMENTLINEAR", 3425423356 },
+{ "IFCBEAM", 753842376 },
+{ "IFCBEAMTYPE", 819618141 },
+{ "IFCBEARING", 4196446775 },
+{ "IFCBEARINGTYPE", 3649138523 },
+{ "IFCBLOBTEXTURE", 616511568 },
+{ "IFCBLOCK", 1334484129 },
+{ "IFCBOILER", 32344328 },
+{ "IFCBOILERTYPE", 231477066 },
+{ "IFCBOOLEANCLIPPINGRESULT", 3649129432 },
+{ "IFCBOOLEANRESULT", 2736907675 },
+{ "IFCBOREHOLE", 3314249567 },
+{ "IFCBOUNDARYCONDITION", 4037036970 },
+{ "IFCBOUNDARYCURVE", 1136057603 },
+{ "IFCBOUNDARYEDGECONDITION", 1560379544 },
+{ "IFCBOUNDARYFACECONDITION", 3367102660 },
+{ "IFCBOUNDARYNODECONDITION", 1387855156 },
+{ "IFCBOUNDARYNODECONDITIONWARPING", 2069777674 },
+{ "IFCBOUNDEDCURVE", 1260505505 },
+{ "IFCBOUNDEDSURFACE", 4182860854 },
+{ "IFCBOUNDINGBOX", 2581212453 },
+{ "IFCBOXEDHALFSPACE", 2713105998 },
+{ "IFCBRIDGE", 644574406 },
+{ "IFCBRIDGEPART", 963979645 },
+{ "IFCBSPLINECURVE", 1967976161 },
+{ "IFCBSPLINECURVEWITHKNOTS", 2461110595 },
+{ "IFCBSPLINESURFACE", 2887950389 },
+{ "IFCBSPLINESURFACEWITHKNOTS", 167062518 },
+{ "IFCBUILDING", 4031249490 },
+{ "IFCBUILDINGELEMENTPART", 2979338954 },
+{ "IFCBUILDINGELEMENTPARTTYPE", 39481116 },
+{ "IFCBUILDINGELEMENTPROXY", 1095909175 },
+{ "IFCBUILDINGELEMENTPROXYTYPE", 1909888760 },
+{ "IFCBUILDINGSTOREY", 3124254112 },
+{ "IFCBUILDINGSYSTEM", 1177604601 },
+{ "IFCBUILTELEMENT", 1876633798 },
+{ "IFCBUILTELEMENTTYPE", 1626504194 },
+{ "IFCBUILTSYSTEM", 3862327254 },
+{ "IFCBURNER", 2938176219 },
+{ "IFCBURNERTYPE", 2188180465 },
+{ "IFCCABLECARRIERFITTING", 635142910 },
+{ "IFCCABLECARRIERFITTINGTYPE", 395041908 },
+{ "IFCCABLECARRIERSEGMENT", 3758799889 },
+{ "IFCCABLECARRIERSEGMENTTYPE", 3293546465 },
+{ "IFCCABLEFITTING", 1051757585 },
+{ "IFCCABLEFITTINGTYPE", 2674252688 },
+{ "IFCCABLESEGMENT", 4217484030 },
+{ "IFCCABLESEGMENTTYPE", 1285652485 },
+{ "IFCCAISSONFOUNDATION", 3999819293 },
+{ "IFCCAISSONFOUNDATIONTYPE", 3203706013 },
+{ "IFCCARTESIANPOINT", 1123145078 },
+{ "IFCCARTESIANPOINTLIST", 574549367 },
+{ "IFCCARTESIANPOINTLIST2D", 1675464909 },
+{ "IFCCARTESIANPOINTLIST3D", 2059837836 },
+{ "IFCCARTESIANTRANSFORMATIONOPERATOR", 59481748 },
+{ "IFCCARTESIANTRANSFORMATIONOPERATOR2D", 3749851601 },
+{ "IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM", 3486308946 },
+{ "IFCCARTESIANTRANSFORMATIONOPERATOR3D", 3331915920 },
+{ "IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM", 1416205885 },
+{ "IFCCENTERLINEPROFILEDEF", 3150382593 },
+{ "IFCCHILLER", 3902619387 },
+{ "IFCCHILLERTYPE", 2951183804 },
+{ "IFCCHIMNEY", 3296154744 },
+{ "IFCCHIMNEYTYPE", 2197970202 },
+{ "IFCCIRCLE", 2611217952 },
+{ "IFCCIRCLEHOLLOWPROFILEDEF", 2937912522 },
+{ "IFCCIRCLEPROFILEDEF", 1383045692 },
+{ "IFCCIVILELEMENT", 1677625105 },
+{ "IFCCIVILELEMENTTYPE", 3893394355 },
+{ "IFCCLASSIFICATION", 747523909 },
+{ "IFCCLASSIFICATIONREFERENCE", 647927063 },
+{ "IFCCLOSEDSHELL", 2205249479 },
+{ "IFCCLOTHOID", 3497074424 },
+{ "IFCCOIL", 639361253 },
+{ "IFCCOILTYPE", 2301859152 },
+{ "IFCCOLOURRGB", 776857604 },
+{ "IFCCOLOURRGBLIST", 3285139300 },
+{ "IFCCOLOURSPECIFICATION", 3264961684 },
+{ "IFCCOLUMN", 843113511 },
+{ "IFCCOLUMNTYPE", 300633059 },
+{ "IFCCOMMUNICATIONSAPPLIANCE", 3221913625 },
+{ "IFCCOMMUNICATIONSAPPLIANCETYPE", 400855858 },
+{ "IFCCOMPLEXPROPERTY", 2542286263 },
+{ "IFCCOMPLEXPROPERTYTEMPLATE", 3875453745 },
+{ "IFCCOMPOSITECURVE", 3732776249 },
+{ "IFCCOMPOSITECURVEONSURFACE", 15328376 },
+{ "IFCCOMPOSITECURVESEGMENT", 2485617015 },
+{ "IFCCOMPOSITEPROFILEDEF", 1485152156 },
+{ "IFCCOMPRESSOR", 3571504051 },
+{ "IFCCOMPRESSORTYPE", 3850581409 },
+{ "IFCCONDENSER", 2272882330 },
+{ "IFCCONDENSERTYPE", 2816379211 },
+{ "IFCCONIC", 2510884976 },
+{ "IFCCONNECTEDFACESET", 370225590 },
+{ "IFCCONNECTIONCURVEGEOMETRY", 1981873012 },
+{ "IFCCONNECTIONGEOMETRY", 2859738748 },
+{ "IFCCONNECTIONPOINTECCENTRICITY", 45288368 },
+{ "IFCCONNECTIONPOINTGEOMETRY", 2614616156 },
+{ "IFCCONNECTIONSURFACEGEOMETRY", 2732653382 },
+{ "IFCCONNECTIONVOLUMEGEOMETRY", 775493141 },
+{ "IFCCONSTRAINT", 1959218052 },
+{ "IFCCONSTRUCTIONEQUIPMENTRESOURCE", 3898045240 },
+{ "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE", 2185764099 },
+{ "IFCCONSTRUCTIONMATERIALRESOURCE", 1060000209 },
+{ "IFCCONSTRUCTIONMATERIALRESOURCETYPE", 4105962743 },
+{ "IFCCONSTRUCTIONPRODUCTRESOURCE", 488727124 },
+{ "IFCCONSTRUCTIONPRODUCTRESOURCETYPE", 1525564444 },
+{ "IFCCONSTRUCTIONRESOURCE", 2559216714 },
+{ "IFCCONSTRUCTIONRESOURCETYPE", 2574617495 },
+{ "IFCCONTEXT", 3419103109 },
+{ "IFCCONTEXTDEPENDENTUNIT", 3050246964 },
+{ "IFCCONTROL", 3293443760 },
+{ "IFCCONTROLLER", 25142252 },
+{ "IFCCONTROLLERTYPE", 578613899 },
+{ "IFCCONVERSIONBASEDUNIT", 2889183280 },
+{ "IFCCONVERSIONBASEDUNITWITHOFFSET", 2713554722 },
+{ "IFCCONVEYORSEGMENT", 3460952963 },
+{ "IFCCONVEYORSEGMENTTYPE", 2940368186 },
+{ "IFCCOOLEDBEAM", 4136498852 },
+{ "IFCCOOLEDBEAMTYPE", 335055490 },
+{ "IFCCOOLINGTOWER", 3640358203 },
+{ "IFCCOOLINGTOWERTYPE", 2954562838 },
+{ "IFCCOORDINATEOPERATION", 1785450214 },
+{ "IFCCOORDINATEREFERENCESYSTEM", 1466758467 },
+{ "IFCCOSINESPIRAL", 2000195564 },
+{ "IFCCOSTITEM", 3895139033 },
+{ "IFCCOSTSCHEDULE", 1419761937 },
+{ "IFCCOSTVALUE", 602808272 },
+{ "IFCCOURSE", 1502416096 },
+{ "IFCCOURSETYPE", 4189326743 },
+{ "IFCCOVERING", 1973544240 },
+{ "IFCCOVERINGTYPE", 1916426348 },
+{ "IFCCREWRESOURCE", 3295246426 },
+{ "IFCCREWRESOURCETYPE", 1815067380 },
+{ "IFCCSGPRIMITIVE3D", 2506170314 },
+{ "IFCCSGSOLID", 2147822146 },
+{ "IFCCSHAPEPROFILEDEF", 2898889636 },
+{ "IFCCURRENCYRELATIONSHIP", 539742890 },
+{ "IFCCURTAINWALL", 3495092785 },
+{ "IFCCURTAINWALLTYPE", 1457835157 },
+{ "IFCCURVE", 2601014836 },
+{ "IFCCURVEBOUNDEDPLANE", 2827736869 },
+{ "IFCCURVEBOUNDEDSURFACE", 2629017746 },
+{ "IFCCURVESEGMENT", 4212018352 },
+{ "IFCCURVESTYLE", 3800577675 },
+{ "IFCCURVESTYLEFONT", 1105321065 },
+{ "IFCCURVESTYLEFONTANDSCALING", 2367409068 },
+{ "IFCCURVESTYLEFONTPATTERN", 3510044353 },
+{ "IFCCYLINDRICALSURFACE", 1213902940 },
+{ "IFCDAMPER", 4074379575 },
+{ "IFCDAMPERTYPE", 3961806047 },
+{ "IFCDEEPFOUNDATION", 3426335179 },
+{ "IFCDEEPFOUNDATIONTYPE", 1306400036 },
+{ "IFCDERIVEDPROFILEDEF", 3632507154 },
+{ "IFCDERIVEDUNIT", 1765591967 },
+{ "IFCDERIVEDUNITELEMENT", 1045800335 },
+{ "IFCDIMENSIONALEXPONENTS", 2949456006 },
+{ "IFCDIRECTION", 32440307 },
+{ "IFCDIRECTRIXCURVESWEPTAREASOLID", 593015953 },
+{ "IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID", 4234616927 },
+{ "IFCDISCRETEACCESSORY", 1335981549 },
+{ "IFCDISCRETEACCESSORYTYPE", 2635815018 },
+{ "IFCDISTRIBUTIONBOARD", 3693000487 },
+{ "IFCDISTRIBUTIONBOARDTYPE", 479945903 },
+{ "IFCDISTRIBUTIONCHAMBERELEMENT", 1052013943 },
+{ "IFCDISTRIBUTIONCHAMBERELEMENTTYPE", 1599208980 },
+{ "IFCDISTRIBUTIONCIRCUIT", 562808652 },
+{ "IFCDISTRIBUTIONCONTROLELEMENT", 1062813311 },
+{ "IFCDISTRIBUTIONCONTROLELEMENTTYPE", 2063403501 },
+{ "IFCDISTRIBUTIONELEMENT", 1945004755 },
+{ "IFCDISTRIBUTIONELEMENTTYPE", 3256556792 },
+{ "IFCDISTRIBUTIONFLOWELEMENT", 3040386961 },
+{ "IFCDISTRIBUTIONFLOWELEMENTTYPE", 3849074793 },
+{ "IFCDISTRIBUTIONPORT", 3041715199 },
+{ "IFCDISTRIBUTIONSYSTEM", 3205830791 },
+{ "IFCDOCUMENTINFORMATION", 1154170062 },
+{ "IFCDOCUMENTINFORMATIONRELATIONSHIP", 770865208 },
+{ "IFCDOCUMENTREFERENCE", 3732053477 },
+{ "IFCDOOR", 395920057 },
+{ "IFCDOORLININGPROPERTIES", 2963535650 },
+{ "IFCDOORPANELPROPERTIES", 1714330368 },
+{ "IFCDOORSTYLE", 526551008 },
+{ "IFCDOORTYPE", 2323601079 },
+{ "IFCDRAUGHTINGPREDEFINEDCOLOUR", 445594917 },
+{ "IFCDRAUGHTINGPREDEFINEDCURVEFONT", 4006246654 },
+{ "IFCDUCTFITTING", 342316401 },
+{ "IFCDUCTFITTINGTYPE", 869906466 },
+{ "IFCDUCTSEGMENT", 3518393246 },
+{ "IFCDUCTSEGMENTTYPE", 3760055223 },
+{ "IFCDUCTSILENCER", 1360408905 },
+{ "IFCDUCTSILENCERTYPE", 2030761528 },
+{ "IFCEARTHWORKSCUT", 3071239417 },
+{ "IFCEARTHWORKSELEMENT", 1077100507 },
+{ "IFCEARTHWORKSFILL", 3376911765 },
+{ "IFCEDGE", 3900360178 },
+{ "IFCEDGECURVE", 476780140 },
+{ "IFCEDGELOOP", 1472233963 },
+{ "IFCELECTRICAPPLIANCE", 1904799276 },
+{ "IFCELECTRICAPPLIANCETYPE", 663422040 },
+{ "IFCELECTRICDISTRIBUTIONBOARD", 862014818 },
+{ "IFCELECTRICDISTRIBUTIONBOARDTYPE", 2417008758 },
+{ "IFCELECTRICFLOWSTORAGEDEVICE", 3310460725 },
+{ "IFCELECTRICFLOWSTORAGEDEVICETYPE", 3277789161 },
+{ "IFCELECTRICFLOWTREATMENTDEVICE", 24726584 },
+{ "IFCELECTRICFLOWTREATMENTDEVICETYPE", 2142170206 },
+{ "IFCELECTRICGENERATOR", 264262732 },
+{ "IFCELECTRICGENERATORTYPE", 1534661035 },
+{ "IFCELECTRICMOTOR", 402227799 },
+{ "IFCELECTRICMOTORTYPE", 1217240411 },
+{ "IFCELECTRICTIMECONTROL", 1003880860 },
+{ "IFCELECTRICTIMECONTROLTYPE", 712377611 },
+{ "IFCELEMENT", 1758889154 },
+{ "IFCELEMENTARYSURFACE", 2777663545 },
+{ "IFCELEMENTASSEMBLY", 4123344466 },
+{ "IFCELEMENTASSEMBLYTYPE", 2397081782 },
+{ "IFCELEMENTCOMPONENT", 1623761950 },
+{ "IFCELEMENTCOMPONENTTYPE", 2590856083 },
+{ "IFCELEMENTQUANTITY", 1883228015 },
+{ "IFCELEMENTTYPE", 339256511 },
+{ "IFCELLIPSE", 1704287377 },
+{ "IFCELLIPSEPROFILEDEF", 2835456948 },
+{ "IFCENERGYCONVERSIONDEVICE", 1658829314 },
+{ "IFCENERGYCONVERSIONDEVICETYPE", 2107101300 },
+{ "IFCENGINE", 2814081492 },
+{ "IFCENGINETYPE", 132023988 },
+{ "IFCEVAPORATIVECOOLER", 3747195512 },
+{ "IFCEVAPORATIVECOOLERTYPE", 3174744832 },
+{ "IFCEVAPORATOR", 484807127 },
+{ "IFCEVAPORATORTYPE", 3390157468 },
+{ "IFCEVENT", 4148101412 },
+{ "IFCEVENTTIME", 211053100 },
+{ "IFCEVENTTYPE", 4024345920 },
+{ "IFCEXTENDEDPROPERTIES", 297599258 },
+{ "IFCEXTERNALINFORMATION", 4294318154 },
+{ "IFCEXTERNALLYDEFINEDHATCHSTYLE", 2242383968 },
+{ "IFCEXTERNALLYDEFINEDSURFACESTYLE", 1040185647 },
+{ "IFCEXTERNALLYDEFINEDTEXTFONT", 3548104201 },
+{ "IFCEXTERNALREFERENCE", 3200245327 },
+{ "IFCEXTERNALREFERENCERELATIONSHIP", 1437805879 },
+{ "IFCEXTERNALSPATIALELEMENT", 1209101575 },
+{ "IFCEXTERNALSPATIALSTRUCTUREELEMENT", 2853485674 },
+{ "IFCEXTRUDEDAREASOLID", 477187591 },
+{ "IFCEXTRUDEDAREASOLIDTAPERED", 2804161546 },
+{ "IFCFACE", 2556980723 },
+{ "IFCFACEBASEDSURFACEMODEL", 2047409740 },
+{ "IFCFACEBOUND", 1809719519 },
+{ "IFCFACEOUTERBOUND", 803316827 },
+{ "IFCFACESURFACE", 3008276851 },
+{ "IFCFACETEDBREP", 807026263 },
+{ "IFCFACETEDBREPWITHVOIDS", 3737207727 },
+{ "IFCFACILITY", 24185140 },
+{ "IFCFACILITYPART", 1310830890 },
+{ "IFCFACILITYPARTCOMMON", 4228831410 },
+{ "IFCFAILURECONNECTIONCONDITION", 4219587988 },
+{ "IFCFAN", 3415622556 },
+{ "IFCFANTYPE", 346874300 },
+{ "IFCFASTENER", 647756555 },
+{ "IFCFASTENERTYPE", 2489546625 },
+{ "IFCFEATUREELEMENT", 2827207264 },
+{ "IFCFEATUREELEMENTADDITION", 2143335405 },
+{ "IFCFEATUREELEMENTSUBTRACTION", 1287392070 },
+{ "IFCFILLAREASTYLE", 738692330 },
+{ "IFCFILLAREASTYLEHATCHING", 374418227 },
+{ "IFCFILLAREASTYLETILES", 315944413 },
+{ "IFCFILTER", 819412036 },
+{ "IFCFILTERTYPE", 1810631287 },
+{ "IFCFIRESUPPRESSIONTERMINAL", 1426591983 },
+{ "IFCFIRESUPPRESSIONTERMINALTYPE", 4222183408 },
+{ "IFCFIXEDREFERENCESWEPTAREASOLID", 2652556860 },
+{ "IFCFLOWCONTROLLER", 2058353004 },
+{ "IFCFLOWCONTROLLERTYPE", 3907093117 },
+{ "IFCFLOWFITTING", 4278956645 },
+{ "IFCFLOWFITTINGTYPE", 3198132628 },
+{ "IFCFLOWINSTRUMENT", 182646315 },
+{ "IFCFLOWINSTRUMENTTYPE", 4037862832 },
+{ "IFCFLOWMETER", 2188021234 },
+{ "IFCFLOWMETERTYPE", 3815607619 },
+{ "IFCFLOWMOVINGDEVICE", 3132237377 },
+{ "IFCFLOWMOVINGDEVICETYPE", 1482959167 },
+{ "IFCFLOWSEGMENT", 987401354 },
+{ "IFCFLOWSEGMENTTYPE", 1834744321 },
+{ "IFCFLOWSTORAGEDEVICE", 707683696 },
+{ "IFCFLOWSTORAGEDEVICETYPE", 1339347760 },
+{ "IFCFLOWTERMINAL", 2223149337 },
+{ "IFCFLOWTERMINALTYPE", 2297155007 },
+{ "IFCFLOWTREATMENTDEVICE", 3508470533 },
+{ "IFCFLOWTREATMENTDEVICETYPE", 3009222698 },
+{ "IFCFOOTING", 900683007 },
+{ "IFCFOOTINGTYPE", 1893162501 },
+{ "IFCFURNISHINGELEMENT", 263784265 },
+{ "IFCFURNISHINGELEMENTTYPE", 4238390223 },
+{ "IFCFURNITURE", 1509553395 },
+{ "IFCFURNITURETYPE", 1268542332 },
+{ "IFCGEOGRAPHICCRS", 917726184 },
+{ "IFCGEOGRAPHICELEMENT", 3493046030 },
+{ "IFCGEOGRAPHICELEMENTTYPE", 4095422895 },
+{ "IFCGEOMETRICCURVESET", 987898635 },
+{ "IFCGEOMETRICREPRESENTATIONCONTEXT", 3448662350 },
+{ "IFCGEOMETRICREPRESENTATIONITEM", 2453401579 },
+{ "IFCGEOMETRICREPRESENTATIONSUBCONTEXT", 4142052618 },
+{ "IFCGEOMETRICSET", 3590301190 },
+{ "IFCGEOMODEL", 2680139844 },
+{ "IFCGEOSLICE", 1971632696 },
+{ "IFCGEOTECHNICALASSEMBLY", 2713699986 },
+{ "IFCGEOTECHNICALELEMENT", 4230923436 },
+{ "IFCGEOTECHNICALSTRATUM", 1594536857 },
+{ "IFCGRADIENTCURVE", 2898700619 },
+{ "IFCGRID", 3009204131 },
+{ "IFCGRIDAXIS", 852622518 },
+{ "IFCGRIDPLACEMENT", 178086475 },
+{ "IFCGROUP", 2706460486 },
+{ "IFCHALFSPACESOLID", 812098782 },
+{ "IFCHEATEXCHANGER", 3319311131 },
+{ "IFCHEATEXCHANGERTYPE", 1251058090 },
+{ "IFCHUMIDIFIER", 2068733104 },
+{ "IFCHUMIDIFIERTYPE", 1806887404 },
+{ "IFCIMAGETEXTURE", 3905492369 },
+{ "IFCIMPACTPROTECTIONDEVICE", 2568555532 },
+{ "IFCIMPACTPROTECTIONDEVICETYPE", 3948183225 },
+{ "IFCINDEXEDCOLOURMAP", 3570813810 },
+{ "IFCINDEXEDPOLYCURVE", 2571569899 },
+{ "IFCINDEXEDPOLYGONALFACE", 178912537 },
+{ "IFCINDEXEDPOLYGONALFACEWITHVOIDS", 2294589976 },
+{ "IFCINDEXEDPOLYGONALTEXTUREMAP", 3465909080 },
+{ "IFCINDEXEDTEXTUREMAP", 1437953363 },
+{ "IFCINDEXEDTRIANGLETEXTUREMAP", 2133299955 },
+{ "IFCINTERCEPTOR", 4175244083 },
+{ "IFCINTERCEPTORTYPE", 3946677679 },
+{ "IFCINTERSECTIONCURVE", 3113134337 },
+{ "IFCINVENTORY", 2391368822 },
+{ "IFCIRREGULARTIMESERIES", 3741457305 },
+{ "IFCIRREGULARTIMESERIESVALUE", 3020489413 },
+{ "IFCISHAPEPROFILEDEF", 1484403080 },
+{ "IFCJUNCTIONBOX", 2176052936 },
+{ "IFCJUNCTIONBOXTYPE", 4288270099 },
+{ "IFCKERB", 2696325953 },
+{ "IFCKERBTYPE", 679976338 },
+{ "IFCLABORRESOURCE", 3827777499 },
+{ "IFCLABORRESOURCETYPE", 428585644 },
+{ "IFCLAGTIME", 1585845231 },
+{ "IFCLAMP", 76236018 },
+{ "IFCLAMPTYPE", 1051575348 },
+{ "IFCLIBRARYINFORMATION", 2655187982 },
+{ "IFCLIBRARYREFERENCE", 3452421091 },
+{ "IFCLIGHTDISTRIBUTIONDATA", 4162380809 },
+{ "IFCLIGHTFIXTURE", 629592764 },
+{ "IFCLIGHTFIXTURETYPE", 1161773419 },
+{ "IFCLIGHTINTENSITYDISTRIBUTION", 1566485204 },
+{ "IFCLIGHTSOURCE", 1402838566 },
+{ "IFCLIGHTSOURCEAMBIENT", 125510826 },
+{ "IFCLIGHTSOURCEDIRECTIONAL", 2604431987 },
+{ "IFCLIGHTSOURCEGONIOMETRIC", 4266656042 },
+{ "IFCLIGHTSOURCEPOSITIONAL", 1520743889 },
+{ "IFCLIGHTSOURCESPOT", 3422422726 },
+{ "IFCLINE", 1281925730 },
+{ "IFCLINEARELEMENT", 2176059722 },
+{ "IFCLINEARPLACEMENT", 388784114 },
+{ "IFCLINEARPOSITIONINGELEMENT", 1154579445 },
+{ "IFCLIQUIDTERMINAL", 1638804497 },
+{ "IFCLIQUIDTERMINALTYPE", 1770583370 },
+{ "IFCLOCALPLACEMENT", 2624227202 },
+{ "IFCLOOP", 1008929658 },
+{ "IFCLSHAPEPROFILEDEF", 572779678 },
+{ "IFCMANIFOLDSOLIDBREP", 1425443689 },
+{ "IFCMAPCONVERSION", 3057273783 },
+{ "IFCMAPCONVERSIONSCALED", 4105526436 },
+{ "IFCMAPPEDITEM", 2347385850 },
+{ "IFCMARINEFACILITY", 525669439 },
+{ "IFCMARINEPART", 976884017 },
+{ "IFCMATERIAL", 1838606355 },
+{ "IFCMATERIALCLASSIFICATIONRELATIONSHIP", 1847130766 },
+{ "IFCMATERIALCONSTITUENT", 3708119000 },
+{ "IFCMATERIALCONSTITUENTSET", 2852063980 },
+{ "IFCMATERIALDEFINITION", 760658860 },
+{ "IFCMATERIALDEFINITIONREPRESENTATION", 2022407955 },
+{ "IFCMATERIALLAYER", 248100487 },
+{ "IFCMATERIALLAYERSET", 3303938423 },
+{ "IFCMATERIALLAYERSETUSAGE", 1303795690 },
+{ "IFCMATERIALLAYERWITHOFFSETS", 1847252529 },
+{ "IFCMATERIALLIST", 2199411900 },
+{ "IFCMATERIALPROFILE", 2235152071 },
+{ "IFCMATERIALPROFILESET", 164193824 },
+{ "IFCMATERIALPROFILESETUSAGE", 3079605661 },
+{ "IFCMATERIALPROFILESETUSAGETAPERING", 3404854881 },
+{ "IFCMATERIALPROFILEWITHOFFSETS", 552965576 },
+{ "IFCMATERIALPROPERTIES", 3265635763 },
+{ "IFCMATERIALRELATIONSHIP", 853536259 },
+{ "IFCMATERIALUSAGEDEFINITION", 1507914824 },
+{ "IFCMEASUREWITHUNIT", 2597039031 },
+{ "IFCMECHANICALFASTENER", 377706215 },
+{ "IFCMECHANICALFASTENERTYPE", 2108223431 },
+{ "IFCMEDICALDEVICE", 1437502449 },
+{ "IFCMEDICALDEVICETYPE", 1114901282 },
+{ "IFCMEMBER", 1073191201 },
+{ "IFCMEMBERTYPE", 3181161470 },
+{ "IFCMETRIC", 3368373690 },
+{ "IFCMIRROREDPROFILEDEF", 2998442950 },
+{ "IFCMOBILETELECOMMUNICATIONSAPPLIANCE", 2078563270 },
+{ "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE", 1950438474 },
+{ "IFCMONETARYUNIT", 2706619895 },
+{ "IFCMOORINGDEVICE", 234836483 },
+{ "IFCMOORINGDEVICETYPE", 710110818 },
+{ "IFCMOTORCONNECTION", 2474470126 },
+{ "IFCMOTORCONNECTIONTYPE", 977012517 },
+{ "IFCNAMEDUNIT", 1918398963 },
+{ "IFCNAVIGATIONELEMENT", 2182337498 },
+{ "IFCNAVIGATIONELEMENTTYPE", 506776471 },
+{ "IFCOBJECT", 3888040117 },
+{ "IFCOBJECTDEFINITION", 219451334 },
+{ "IFCOBJECTIVE", 2251480897 },
+{ "IFCOBJECTPLACEMENT", 3701648758 },
+{ "IFCOCCUPANT", 4143007308 },
+{ "IFCOFFSETCURVE", 590820931 },
+{ "IFCOFFSETCURVE2D", 3388369263 },
+{ "IFCOFFSETCURVE3D", 3505215534 },
+{ "IFCOFFSETCURVEBYDISTANCES", 2485787929 },
+{ "IFCOPENCROSSPROFILEDEF", 182550632 },
+{ "IFCOPENINGELEMENT", 3588315303 },
+{ "IFCOPENSHELL", 2665983363 },
+{ "IFCORGANIZATION", 4251960020 },
+{ "IFCORGANIZATIONRELATIONSHIP", 1411181986 },
+{ "IFCORIENTEDEDGE", 1029017970 },
+{ "IFCOUTERBOUNDARYCURVE", 144952367 },
+{ "IFCOUTLET", 3694346114 },
+{ "IFCOUTLETTYPE", 2837617999 },
+{ "IFCOWNERHISTORY", 1207048766 },
+{ "IFCPARAMETERIZEDPROFILEDEF", 2529465313 },
+{ "IFCPATH", 2519244187 },
+{ "IFCPAVEMENT", 1383356374 },
+{ "IFCPAVEMENTTYPE", 514975943 },
+{ "IFCPCURVE", 1682466193 },
+{ "IFCPERFORMANCEHISTORY", 2382730787 },
+{ "IFCPERMEABLECOVERINGPROPERTIES", 3566463478 },
+{ "IFCPERMIT", 3327091369 },
+{ "IFCPERSON", 2077209135 },
+{ "IFCPERSONANDORGANIZATION", 101040310 },
+{ "IFCPHYSICALCOMPLEXQUANTITY", 3021840470 },
+{ "IFCPHYSICALQUANTITY", 2483315170 },
+{ "IFCPHYSICALSIMPLEQUANTITY", 2226359599 },
+{ "IFCPILE", 1687234759 },
+{ "IFCPILETYPE", 1158309216 },
+{ "IFCPIPEFITTING", 310824031 },
+{ "IFCPIPEFITTINGTYPE", 804291784 },
+{ "IFCPIPESEGMENT", 3612865200 },
+{ "IFCPIPESEGMENTTYPE", 4231323485 },
+{ "IFCPIXELTEXTURE", 597895409 },
+{ "IFCPLACEMENT", 2004835150 },
+{ "IFCPLANARBOX", 603570806 },
+{ "IFCPLANAREXTENT", 1663979128 },
+{ "IFCPLANE", 220341763 },
+{ "IFCPLATE", 3171933400 },
+{ "IFCPLATETYPE", 4017108033 },
+{ "IFCPOINT", 2067069095 },
+{ "IFCPOINTBYDISTANCEEXPRESSION", 2165702409 },
+{ "IFCPOINTONCURVE", 4022376103 },
+{ "IFCPOINTONSURFACE", 1423911732 },
+{ "IFCPOLYGONALBOUNDEDHALFSPACE", 2775532180 },
+{ "IFCPOLYGONALFACESET", 2839578677 },
+{ "IFCPOLYLINE", 3724593414 },
+{ "IFCPOLYLOOP", 2924175390 },
+{ "IFCPOLYNOMIALCURVE", 3381221214 },
+{ "IFCPORT", 3740093272 },
+{ "IFCPOSITIONINGELEMENT", 1946335990 },
+{ "IFCPOSTALADDRESS", 3355820592 },
+{ "IFCPREDEFINEDCOLOUR", 759155922 },
+{ "IFCPREDEFINEDCURVEFONT", 2559016684 },
+{ "IFCPREDEFINEDITEM", 3727388367 },
+{ "IFCPREDEFINEDPROPERTIES", 3778827333 },
+{ "IFCPREDEFINEDPROPERTYSET", 3967405729 },
+{ "IFCPREDEFINEDTEXTFONT", 1775413392 },
+{ "IFCPRESENTATIONITEM", 677532197 },
+{ "IFCPRESENTATIONLAYERASSIGNMENT", 2022622350 },
+{ "IFCPRESENTATIONLAYERWITHSTYLE", 1304840413 },
+{ "IFCPRESENTATIONSTYLE", 3119450353 },
+{ "IFCPRESENTATIONSTYLEASSIGNMENT", 2417041796 },
+{ "IFCPROCEDURE", 2744685151 },
+{ "IFCPROCEDURETYPE", 569719735 },
+{ "IFCPROCESS", 2945172077 },
+{ "IFCPRODUCT", 4208778838 },
+{ "IFCPRODUCTDEFINITIONSHAPE", 673634403 },
+{ "IFCPRODUCTREPRESENTATION", 2095639259 },
+{ "IFCPROFILEDEF", 3958567839 },
+{ "IFCPROFILEPROPERTIES", 2802850158 },
+{ "IFCPROJECT", 103090709 },
+{ "IFCPROJECTEDCRS", 3843373140 },
+{ "IFCPROJECTIONELEMENT", 3651124850 },
+{ "IFCPROJECTLIBRARY", 653396225 },
+{ "IFCPROJECTORDER", 2904328755 },
+{ "IFCPROPERTY", 2598011224 },
+{ "IFCPROPERTYABSTRACTION", 986844984 },
+{ "IFCPROPERTYBOUNDEDVALUE", 871118103 },
+{ "IFCPROPERTYDEFINITION", 1680319473 },
+{ "IFCPROPERTYDEPENDENCYRELATIONSHIP", 148025276 },
+{ "IFCPROPERTYENUMERATEDVALUE", 4166981789 },
+{ "IFCPROPERTYENUMERATION", 3710013099 },
+{ "IFCPROPERTYLISTVALUE", 2752243245 },
+{ "IFCPROPERTYREFERENCEVALUE", 941946838 },
+{ "IFCPROPERTYSET", 1451395588 },
+{ "IFCPROPERTYSETDEFINITION", 3357820518 },
+{ "IFCPROPERTYSETTEMPLATE", 492091185 },
+{ "IFCPROPERTYSINGLEVALUE", 3650150729 },
+{ "IFCPROPERTYTABLEVALUE", 110355661 },
+{ "IFCPROPERTYTEMPLATE", 3521284610 },
+{ "IFCPROPERTYTEMPLATEDEFINITION", 1482703590 },
+{ "IFCPROTECTIVEDEVICE", 738039164 },
+{ "IFCPROTECTIVEDEVICETRIPPINGUNIT", 2295281155 },
+{ "IFCPROTECTIVEDEVICETRIPPINGUNITTYPE", 655969474 },
+{ "IFCPROTECTIVEDEVICETYPE", 1842657554 },
+{ "IFCPUMP", 90941305 },
+{ "IFCPUMPTYPE", 2250791053 },
+{ "IFCQUANTITYAREA", 2044713172 },
+{ "IFCQUANTITYCOUNT", 2093928680 },
+{ "IFCQUANTITYLENGTH", 931644368 },
+{ "IFCQUANTITYNUMBER", 2691318326 },
+{ "IFCQUANTITYSET", 2090586900 },
+{ "IFCQUANTITYTIME", 3252649465 },
+{ "IFCQUANTITYVOLUME", 2405470396 },
+{ "IFCQUANTITYWEIGHT", 825690147 },
+{ "IFCRAIL", 3290496277 },
+{ "IFCRAILING", 2262370178 },
+{ "IFCRAILINGTYPE", 2893384427 },
+{ "IFCRAILTYPE", 1763565496 },
+{ "IFCRAILWAY", 3992365140 },
+{ "IFCRAILWAYPART", 1891881377 },
+{ "IFCRAMP", 3024970846 },
+{ "IFCRAMPFLIGHT", 3283111854 },
+{ "IFCRAMPFLIGHTTYPE", 2324767716 },
+{ "IFCRAMPTYPE", 1469900589 },
+{ "IFCRATIONALBSPLINECURVEWITHKNOTS", 1232101972 },
+{ "IFCRATIONALBSPLINESURFACEWITHKNOTS", 683857671 },
+{ "IFCRECTANGLEHOLLOWPROFILEDEF", 2770003689 },
+{ "IFCRECTANGLEPROFILEDEF", 3615266464 },
+{ "IFCRECTANGULARPYRAMID", 2798486643 },
+{ "IFCRECTANGULARTRIMMEDSURFACE", 3454111270 },
+{ "IFCRECURRENCEPATTERN", 3915482550 },
+{ "IFCREFERENCE", 2433181523 },
+{ "IFCREFERENT", 4021432810 },
+{ "IFCREGULARTIMESERIES", 3413951693 },
+{ "IFCREINFORCEDSOIL", 3798194928 },
+{ "IFCREINFORCEMENTBARPROPERTIES", 1580146022 },
+{ "IFCREINFORCEMENTDEFINITIONPROPERTIES", 3765753017 },
+{ "IFCREINFORCINGBAR", 979691226 },
+{ "IFCREINFORCINGBARTYPE", 2572171363 },
+{ "IFCREINFORCINGELEMENT", 3027567501 },
+{ "IFCREINFORCINGELEMENTTYPE", 964333572 },
+{ "IFCREINFORCINGMESH", 2320036040 },
+{ "IFCREINFORCINGMESHTYPE", 2310774935 },
+{ "IFCRELADHERESTOELEMENT", 3818125796 },
+{ "IFCRELAGGREGATES", 160246688 },
+{ "IFCRELASSIGNS", 3939117080 },
+{ "IFCRELASSIGNSTOACTOR", 1683148259 },
+{ "IFCRELASSIGNSTOCONTROL", 2495723537 },
+{ "IFCRELASSIGNSTOGROUP", 1307041759 },
+{ "IFCRELASSIGNSTOGROUPBYFACTOR", 1027710054 },
+{ "IFCRELASSIGNSTOPROCESS", 4278684876 },
+{ "IFCRELASSIGNSTOPRODUCT", 2857406711 },
+{ "IFCRELASSIGNSTORESOURCE", 205026976 },
+{ "IFCRELASSOCIATES", 1865459582 },
+{ "IFCRELASSOCIATESAPPROVAL", 4095574036 },
+{ "IFCRELASSOCIATESCLASSIFICATION", 919958153 },
+{ "IFCRELASSOCIATESCONSTRAINT", 2728634034 },
+{ "IFCRELASSOCIATESDOCUMENT", 982818633 },
+{ "IFCRELASSOCIATESLIBRARY", 3840914261 },
+{ "IFCRELASSOCIATESMATERIAL", 2655215786 },
+{ "IFCRELASSOCIATESPROFILEDEF", 1033248425 },
+{ "IFCRELATIONSHIP", 478536968 },
+{ "IFCRELCONNECTS", 826625072 },
+{ "IFCRELCONNECTSELEMENTS", 1204542856 },
+{ "IFCRELCONNECTSPATHELEMENTS", 3945020480 },
+{ "IFCRELCONNECTSPORTS", 3190031847 },
+{ "IFCRELCONNECTSPORTTOELEMENT", 4201705270 },
+{ "IFCRELCONNECTSSTRUCTURALACTIVITY", 2127690289 },
+{ "IFCRELCONNECTSSTRUCTURALMEMBER", 1638771189 },
+{ "IFCRELCONNECTSWITHECCENTRICITY", 504942748 },
+{ "IFCRELCONNECTSWITHREALIZINGELEMENTS", 3678494232 },
+{ "IFCRELCONTAINEDINSPATIALSTRUCTURE", 3242617779 },
+{ "IFCRELCOVERSBLDGELEMENTS", 886880790 },
+{ "IFCRELCOVERSSPACES", 2802773753 },
+{ "IFCRELDECLARES", 2565941209 },
+{ "IFCRELDECOMPOSES", 2551354335 },
+{ "IFCRELDEFINES", 693640335 },
+{ "IFCRELDEFINESBYOBJECT", 1462361463 },
+{ "IFCRELDEFINESBYPROPERTIES", 4186316022 },
+{ "IFCRELDEFINESBYTEMPLATE", 307848117 },
+{ "IFCRELDEFINESBYTYPE", 781010003 },
+{ "IFCRELFILLSELEMENT", 3940055652 },
+{ "IFCRELFLOWCONTROLELEMENTS", 279856033 },
+{ "IFCRELINTERFERESELEMENTS", 427948657 },
+{ "IFCRELNESTS", 3268803585 },
+{ "IFCRELPOSITIONS", 1441486842 },
+{ "IFCRELPROJECTSELEMENT", 750771296 },
+{ "IFCRELREFERENCEDINSPATIALSTRUCTURE", 1245217292 },
+{ "IFCRELSEQUENCE", 4122056220 },
+{ "IFCRELSERVICESBUILDINGS", 366585022 },
+{ "IFCRELSPACEBOUNDARY", 3451746338 },
+{ "IFCRELSPACEBOUNDARY1STLEVEL", 3523091289 },
+{ "IFCRELSPACEBOUNDARY2NDLEVEL", 1521410863 },
+{ "IFCRELVOIDSELEMENT", 1401173127 },
+{ "IFCREPARAMETRISEDCOMPOSITECURVESEGMENT", 816062949 },
+{ "IFCREPRESENTATION", 1076942058 },
+{ "IFCREPRESENTATIONCONTEXT", 3377609919 },
+{ "IFCREPRESENTATIONITEM", 3008791417 },
+{ "IFCREPRESENTATIONMAP", 1660063152 },
+{ "IFCRESOURCE", 2914609552 },
+{ "IFCRESOURCEAPPROVALRELATIONSHIP", 2943643501 },
+{ "IFCRESOURCECONSTRAINTRELATIONSHIP", 1608871552 },
+{ "IFCRESOURCELEVELRELATIONSHIP", 2439245199 },
+{ "IFCRESOURCETIME", 1042787934 },
+{ "IFCREVOLVEDAREASOLID", 1856042241 },
+{ "IFCREVOLVEDAREASOLIDTAPERED", 3243963512 },
+{ "IFCRIGHTCIRCULARCONE", 4158566097 },
+{ "IFCRIGHTCIRCULARCYLINDER", 3626867408 },
+{ "IFCRIGIDOPERATION", 1794013214 },
+{ "IFCROAD", 146592293 },
+{ "IFCROADPART", 550521510 },
+{ "IFCROOF", 2016517767 },
+{ "IFCROOFTYPE", 2781568857 },
+{ "IFCROOT", 2341007311 },
+{ "IFCROUNDEDRECTANGLEPROFILEDEF", 2778083089 },
+{ "IFCSANITARYTERMINAL", 3053780830 },
+{ "IFCSANITARYTERMINALTYPE", 1768891740 },
+{ "IFCSCHEDULINGTIME", 1054537805 },
+{ "IFCSEAMCURVE", 2157484638 },
+{ "IFCSECONDORDERPOLYNOMIALSPIRAL", 3649235739 },
+{ "IFCSECTIONEDSOLID", 1862484736 },
+{ "IFCSECTIONEDSOLIDHORIZONTAL", 1290935644 },
+{ "IFCSECTIONEDSPINE", 1509187699 },
+{ "IFCSECTIONEDSURFACE", 1356537516 },
+{ "IFCSECTIONPROPERTIES", 2042790032 },
+{ "IFCSECTIONREINFORCEMENTPROPERTIES", 4165799628 },
+{ "IFCSEGMENT", 823603102 },
+{ "IFCSEGMENTEDREFERENCECURVE", 544395925 },
+{ "IFCSENSOR", 4086658281 },
+{ "IFCSENSORTYPE", 1783015770 },
+{ "IFCSEVENTHORDERPOLYNOMIALSPIRAL", 1027922057 },
+{ "IFCSHADINGDEVICE", 1329646415 },
+{ "IFCSHADINGDEVICETYPE", 4074543187 },
+{ "IFCSHAPEASPECT", 867548509 },
+{ "IFCSHAPEMODEL", 3982875396 },
+{ "IFCSHAPEREPRESENTATION", 4240577450 },
+{ "IFCSHELLBASEDSURFACEMODEL", 4124623270 },
+{ "IFCSIGN", 33720170 },
+{ "IFCSIGNAL", 991950508 },
+{ "IFCSIGNALTYPE", 1894708472 },
+{ "IFCSIGNTYPE", 3599934289 },
+{ "IFCSIMPLEPROPERTY", 3692461612 },
+{ "IFCSIMPLEPROPERTYTEMPLATE", 3663146110 },
+{ "IFCSINESPIRAL", 42703149 },
+{ "IFCSITE", 4097777520 },
+{ "IFCSIUNIT", 448429030 },
+{ "IFCSLAB", 1529196076 },
+{ "IFCSLABTYPE", 2533589738 },
+{ "IFCSLIPPAGECONNECTIONCONDITION", 2609359061 },
+{ "IFCSOLARDEVICE", 3420628829 },
+{ "IFCSOLARDEVICETYPE", 1072016465 },
+{ "IFCSOLIDMODEL", 723233188 },
+{ "IFCSPACE", 3856911033 },
+{ "IFCSPACEHEATER", 1999602285 },
+{ "IFCSPACEHEATERTYPE", 1305183839 },
+{ "IFCSPACETYPE", 3812236995 },
+{ "IFCSPATIALELEMENT", 1412071761 },
+{ "IFCSPATIALELEMENTTYPE", 710998568 },
+{ "IFCSPATIALSTRUCTUREELEMENT", 2706606064 },
+{ "IFCSPATIALSTRUCTUREELEMENTTYPE", 3893378262 },
+{ "IFCSPATIALZONE", 463610769 },
+{ "IFCSPATIALZONETYPE", 2481509218 },
+{ "IFCSPHERE", 451544542 },
+{ "IFCSPHERICALSURFACE", 4015995234 },
+{ "IFCSPIRAL", 2735484536 },
+{ "IFCSTACKTERMINAL", 1404847402 },
+{ "IFCSTACKTERMINALTYPE", 3112655638 },
+{ "IFCSTAIR", 331165859 },
+{ "IFCSTAIRFLIGHT", 4252922144 },
+{ "IFCSTAIRFLIGHTTYPE", 1039846685 },
+{ "IFCSTAIRTYPE", 338393293 },
+{ "IFCSTRUCTURALACTION", 682877961 },
+{ "IFCSTRUCTURALACTIVITY", 3544373492 },
+{ "IFCSTRUCTURALANALYSISMODEL", 2515109513 },
+{ "IFCSTRUCTURALCONNECTION", 1179482911 },
+{ "IFCSTRUCTURALCONNECTIONCONDITION", 2273995522 },
+{ "IFCSTRUCTURALCURVEACTION", 1004757350 },
+{ "IFCSTRUCTURALCURVECONNECTION", 4243806635 },
+{ "IFCSTRUCTURALCURVEMEMBER", 214636428 },
+{ "IFCSTRUCTURALCURVEMEMBERVARYING", 2445595289 },
+{ "IFCSTRUCTURALCURVEREACTION", 2757150158 },
+{ "IFCSTRUCTURALITEM", 3136571912 },
+{ "IFCSTRUCTURALLINEARACTION", 1807405624 },
+{ "IFCSTRUCTURALLOAD", 2162789131 },
+{ "IFCSTRUCTURALLOADCASE", 385403989 },
+{ "IFCSTRUCTURALLOADCONFIGURATION", 3478079324 },
+{ "IFCSTRUCTURALLOADGROUP", 1252848954 },
+{ "IFCSTRUCTURALLOADLINEARFORCE", 1595516126 },
+{ "IFCSTRUCTURALLOADORRESULT", 609421318 },
+{ "IFCSTRUCTURALLOADPLANARFORCE", 2668620305 },
+{ "IFCSTRUCTURALLOADSINGLEDISPLACEMENT", 2473145415 },
+{ "IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION", 1973038258 },
+{ "IFCSTRUCTURALLOADSINGLEFORCE", 1597423693 },
+{ "IFCSTRUCTURALLOADSINGLEFORCEWARPING", 1190533807 },
+{ "IFCSTRUCTURALLOADSTATIC", 2525727697 },
+{ "IFCSTRUCTURALLOADTEMPERATURE", 3408363356 },
+{ "IFCSTRUCTURALMEMBER", 530289379 },
+{ "IFCSTRUCTURALPLANARACTION", 1621171031 },
+{ "IFCSTRUCTURALPOINTACTION", 2082059205 },
+{ "IFCSTRUCTURALPOINTCONNECTION", 734778138 },
+{ "IFCSTRUCTURALPOINTREACTION", 1235345126 },
+{ "IFCSTRUCTURALREACTION", 3689010777 },
+{ "IFCSTRUCTURALRESULTGROUP", 2986769608 },
+{ "IFCSTRUCTURALSURFACEACTION", 3657597509 },
+{ "IFCSTRUCTURALSURFACECONNECTION", 1975003073 },
+{ "IFCSTRUCTURALSURFACEMEMBER", 3979015343 },
+{ "IFCSTRUCTURALSURFACEMEMBERVARYING", 2218152070 },
+{ "IFCSTRUCTURALSURFACEREACTION", 603775116 },
+{ "IFCSTYLEDITEM", 3958052878 },
+{ "IFCSTYLEDREPRESENTATION", 3049322572 },
+{ "IFCSTYLEMODEL", 2830218821 },
+{ "IFCSUBCONTRACTRESOURCE", 148013059 },
+{ "IFCSUBCONTRACTRESOURCETYPE", 4095615324 },
+{ "IFCSUBEDGE", 2233826070 },
+{ "IFCSURFACE", 2513912981 },
+{ "IFCSURFACECURVE", 699246055 },
+{ "IFCSURFACECURVESWEPTAREASOLID", 2028607225 },
+{ "IFCSURFACEFEATURE", 3101698114 },
+{ "IFCSURFACEOFLINEAREXTRUSION", 2809605785 },
+{ "IFCSURFACEOFREVOLUTION", 4124788165 },
+{ "IFCSURFACEREINFORCEMENTAREA", 2934153892 },
+{ "IFCSURFACESTYLE", 1300840506 },
+{ "IFCSURFACESTYLELIGHTING", 3303107099 },
+{ "IFCSURFACESTYLEREFRACTION", 1607154358 },
+{ "IFCSURFACESTYLERENDERING", 1878645084 },
+{ "IFCSURFACESTYLESHADING", 846575682 },
+{ "IFCSURFACESTYLEWITHTEXTURES", 1351298697 },
+{ "IFCSURFACETEXTURE", 626085974 },
+{ "IFCSWEPTAREASOLID", 2247615214 },
+{ "IFCSWEPTDISKSOLID", 1260650574 },
+{ "IFCSWEPTDISKSOLIDPOLYGONAL", 1096409881 },
+{ "IFCSWEPTSURFACE", 230924584 },
+{ "IFCSWITCHINGDEVICE", 1162798199 },
+{ "IFCSWITCHINGDEVICETYPE", 2315554128 },
+{ "IFCSYSTEM", 2254336722 },
+{ "IFCSYSTEMFURNITUREELEMENT", 413509423 },
+{ "IFCSYSTEMFURNITUREELEMENTTYPE", 1580310250 },
+{ "IFCTABLE", 985171141 },
+{ "IFCTABLECOLUMN", 2043862942 },
+{ "IFCTABLEROW", 531007025 },
+{ "IFCTANK", 812556717 },
+{ "IFCTANKTYPE", 5716631 },
+{ "IFCTASK", 3473067441 },
+{ "IFCTASKTIME", 1549132990 },
+{ "IFCTASKTIMERECURRING", 2771591690 },
+{ "IFCTASKTYPE", 3206491090 },
+{ "IFCTELECOMADDRESS", 912023232 },
+{ "IFCTENDON", 3824725483 },
+{ "IFCTENDONANCHOR", 2347447852 },
+{ "IFCTENDONANCHORTYPE", 3081323446 },
+{ "IFCTENDONCONDUIT", 3663046924 },
+{ "IFCTENDONCONDUITTYPE", 2281632017 },
+{ "IFCTENDONTYPE", 2415094496 },
+{ "IFCTESSELLATEDFACESET", 2387106220 },
+{ "IFCTESSELLATEDITEM", 901063453 },
+{ "IFCTEXTLITERAL", 4282788508 },
+{ "IFCTEXTLITERALWITHEXTENT", 3124975700 },
+{ "IFCTEXTSTYLE", 1447204868 },
+{ "IFCTEXTSTYLEFONTMODEL", 1983826977 },
+{ "IFCTEXTSTYLEFORDEFINEDFONT", 2636378356 },
+{ "IFCTEXTSTYLETEXTMODEL", 1640371178 },
+{ "IFCTEXTURECOORDINATE", 280115917 },
+{ "IFCTEXTURECOORDINATEGENERATOR", 1742049831 },
+{ "IFCTEXTURECOORDINATEINDICES", 222769930 },
+{ "IFCTEXTURECOORDINATEINDICESWITHVOIDS", 1010789467 },
+{ "IFCTEXTUREMAP", 2552916305 },
+{ "IFCTEXTUREVERTEX", 1210645708 },
+{ "IFCTEXTUREVERTEXLIST", 3611470254 },
+{ "IFCTHIRDORDERPOLYNOMIALSPIRAL", 782932809 },
+{ "IFCTIMEPERIOD", 1199560280 },
+{ "IFCTIMESERIES", 3101149627 },
+{ "IFCTIMESERIESVALUE", 581633288 },
+{ "IFCTOPOLOGICALREPRESENTATIONITEM", 1377556343 },
+{ "IFCTOPOLOGYREPRESENTATION", 1735638870 },
+{ "IFCTOROIDALSURFACE", 1935646853 },
+{ "IFCTRACKELEMENT", 3425753595 },
+{ "IFCTRACKELEMENTTYPE", 618700268 },
+{ "IFCTRANSFORMER", 3825984169 },
+{ "IFCTRANSFORMERTYPE", 1692211062 },
+{ "IFCTRANSPORTATIONDEVICE", 1953115116 },
+{ "IFCTRANSPORTATIONDEVICETYPE", 3665877780 },
+{ "IFCTRANSPORTELEMENT", 1620046519 },
+{ "IFCTRANSPORTELEMENTTYPE", 2097647324 },
+{ "IFCTRAPEZIUMPROFILEDEF", 2715220739 },
+{ "IFCTRIANGULATEDFACESET", 2916149573 },
+{ "IFCTRIANGULATEDIRREGULARNETWORK", 1229763772 },
+{ "IFCTRIMMEDCURVE", 3593883385 },
+{ "IFCTSHAPEPROFILEDEF", 3071757647 },
+{ "IFCTUBEBUNDLE", 3026737570 },
+{ "IFCTUBEBUNDLETYPE", 1600972822 },
+{ "IFCTYPEOBJECT", 1628702193 },
+{ "IFCTYPEPROCESS", 3736923433 },
+{ "IFCTYPEPRODUCT", 2347495698 },
+{ "IFCTYPERESOURCE", 3698973494 },
+{ "IFCUNITARYCONTROLELEMENT", 630975310 },
+{ "IFCUNITARYCONTROLELEMENTTYPE", 3179687236 },
+{ "IFCUNITARYEQUIPMENT", 4292641817 },
+{ "IFCUNITARYEQUIPMENTTYPE", 1911125066 },
+{ "IFCUNITASSIGNMENT", 180925521 },
+{ "IFCUSHAPEPROFILEDEF", 427810014 },
+{ "IFCVALVE", 4207607924 },
+{ "IFCVALVETYPE", 728799441 },
+{ "IFCVECTOR", 1417489154 },
+{ "IFCVEHICLE", 840318589 },
+{ "IFCVEHICLETYPE", 3651464721 },
+{ "IFCVERTEX", 2799835756 },
+{ "IFCVERTEXLOOP", 2759199220 },
+{ "IFCVERTEXPOINT", 1907098498 },
+{ "IFCVIBRATIONDAMPER", 1530820697 },
+{ "IFCVIBRATIONDAMPERTYPE", 3956297820 },
+{ "IFCVIBRATIONISOLATOR", 2391383451 },
+{ "IFCVIBRATIONISOLATORTYPE", 3313531582 },
+{ "IFCVIRTUALELEMENT", 2769231204 },
+{ "IFCVIRTUALGRIDINTERSECTION", 891718957 },
+{ "IFCVOIDINGFEATURE", 926996030 },
+{ "IFCWALL", 2391406946 },
+{ "IFCWALLSTANDARDCASE", 3512223829 },
+{ "IFCWALLTYPE", 1898987631 },
+{ "IFCWASTETERMINAL", 4237592921 },
+{ "IFCWASTETERMINALTYPE", 1133259667 },
+{ "IFCWELLKNOWNTEXT", 1175146630 },
+{ "IFCWINDOW", 3304561284 },
+{ "IFCWINDOWLININGPROPERTIES", 336235671 },
+{ "IFCWINDOWPANELPROPERTIES", 512836454 },
+{ "IFCWINDOWSTYLE", 1299126871 },
+{ "IFCWINDOWTYPE", 4009809668 },
+{ "IFCWORKCALENDAR", 4088093105 },
+{ "IFCWORKCONTROL", 1028945134 },
+{ "IFCWORKPLAN", 4218914973 },
+{ "IFCWORKSCHEDULE", 3342526732 },
+{ "IFCWORKTIME", 1236880293 },
+{ "IFCZONE", 1033361043 },
+{ "IFCZSHAPEPROFILEDEF", 2543172580 }};
+uint32_t IFC4X3::EntityFactory::getClassIDForEntityName( const std::string& class_name_upper )
+{
+	auto it_find = entity_class_id_by_name.find( class_name_upper );
+	if( it_find != entity_class_id_by_name.end() )
+	{
+		return it_find->second;
+	}
+	// class_name not registered
+	return 0;
+}
@@ -886,11 +886,172 @@ namespace IFC4X3
 	#define IFCZSHAPEPROFILEDEF 2543172580
 	#define IFCZONE 1033361043
 
+	#define IFC_NUM_ENTITY_CLASSES 879
+
+	/** Position of an entity class in a depth first traversal of the inheritance tree. The class and all its subtypes have indexes in [m_index, m_index_end) */
+	struct EntityClassInfo
+	{
+		uint32_t m_class_id;
+		uint32_t m_supertype_class_id;	// 0 if the class has no supertype
+		uint16_t m_index;
+		uint16_t m_index_end;
+	};
+
+	/** Inverse attributes of all entity classes, used as slots of the model wide inverse index. An entity has at most one inverse attribute with a given name, so the name identifies the slot */
+	enum InverseAttributeEnum : uint16_t
+	{
+		INVERSE_AdheresToElement,
+		INVERSE_ApprovedObjects,
+		INVERSE_ApprovedResources,
+		INVERSE_AssignedStructuralActivity,
+		INVERSE_AssignedToFlowElement,
+		INVERSE_AssignedToStructuralItem,
+		INVERSE_AssociatedTo,
+		INVERSE_BoundedBy,
+		INVERSE_ClassificationForObjects,
+		INVERSE_ClassificationRefForObjects,
+		INVERSE_ConnectedBy,
+		INVERSE_ConnectedFrom,
+		INVERSE_ConnectedTo,
+		INVERSE_ConnectsStructuralMembers,
+		INVERSE_ContainedIn,
+		INVERSE_ContainedInStructure,
+		INVERSE_ContainsElements,
+		INVERSE_Controls,
+		INVERSE_Corresponds,
+		INVERSE_CoversElements,
+		INVERSE_CoversSpaces,
+		INVERSE_Declares,
+		INVERSE_Decomposes,
+		INVERSE_Defines,
+		INVERSE_DefinesOccurrence,
+		INVERSE_DefinesType,
+		INVERSE_DocumentInfoForObjects,
+		INVERSE_DocumentRefForObjects,
+		INVERSE_EngagedIn,
+		INVERSE_Engages,
+		INVERSE_ExternalReferenceForResources,
+		INVERSE_FillsVoids,
+		INVERSE_HasApprovals,
+		INVERSE_HasAssignments,
+		INVERSE_HasAssociations,
+		INVERSE_HasColours,
+		INVERSE_HasConstraints,
+		INVERSE_HasContext,
+		INVERSE_HasControlElements,
+		INVERSE_HasCoordinateOperation,
+		INVERSE_HasCoverings,
+		INVERSE_HasDocumentReferences,
+		INVERSE_HasExternalReference,
+		INVERSE_HasExternalReferences,
+		INVERSE_HasFillings,
+		INVERSE_HasIntersections,
+		INVERSE_HasLibraryReferences,
+		INVERSE_HasOpenings,
+		INVERSE_HasPorts,
+		INVERSE_HasProjections,
+		INVERSE_HasProperties,
+		INVERSE_HasReferences,
+		INVERSE_HasRepresentation,
+		INVERSE_HasShapeAspects,
+		INVERSE_HasSubContexts,
+		INVERSE_HasSurfaceFeatures,
+		INVERSE_HasTexCoords,
+		INVERSE_HasTextureMaps,
+		INVERSE_HasTextures,
+		INVERSE_InnerBoundaries,
+		INVERSE_InterferesElements,
+		INVERSE_IsActingUpon,
+		INVERSE_IsConnectionRealization,
+		INVERSE_IsDeclaredBy,
+		INVERSE_IsDecomposedBy,
+		INVERSE_IsDefinedBy,
+		INVERSE_IsGroupedBy,
+		INVERSE_IsInterferedByElements,
+		INVERSE_IsMappedBy,
+		INVERSE_IsNestedBy,
+		INVERSE_IsPointedTo,
+		INVERSE_IsPointer,
+		INVERSE_IsPredecessorTo,
+		INVERSE_IsRelatedBy,
+		INVERSE_IsRelatedWith,
+		INVERSE_IsSuccessorFrom,
+		INVERSE_IsTypedBy,
+		INVERSE_LayerAssignment,
+		INVERSE_LayerAssignments,
+		INVERSE_LibraryInfoForObjects,
+		INVERSE_LibraryRefForObjects,
+		INVERSE_LoadGroupFor,
+		INVERSE_MapUsage,
+		INVERSE_Nests,
+		INVERSE_OfOrganization,
+		INVERSE_OfPerson,
+		INVERSE_OfProductRepresentation,
+		INVERSE_OfShapeAspect,
+		INVERSE_OperatesOn,
+		INVERSE_PartOfComplex,
+		INVERSE_PartOfComplexTemplate,
+		INVERSE_PartOfPset,
+		INVERSE_PartOfPsetTemplate,
+		INVERSE_PartOfU,
+		INVERSE_PartOfV,
+		INVERSE_PartOfW,
+		INVERSE_PlacesObject,
+		INVERSE_PositionedRelativeTo,
+		INVERSE_Positions,
+		INVERSE_ProjectsElements,
+		INVERSE_PropertiesForConstraint,
+		INVERSE_PropertyDependsOn,
+		INVERSE_PropertyForDependance,
+		INVERSE_ProvidesBoundaries,
+		INVERSE_ReferencedBy,
+		INVERSE_ReferencedByPlacements,
+		INVERSE_ReferencedInStructures,
+		INVERSE_ReferencesElements,
+		INVERSE_Relates,
+		INVERSE_RelatesTo,
+		INVERSE_RepresentationMap,
+		INVERSE_RepresentationsInContext,
+		INVERSE_ResourceOf,
+		INVERSE_ResultGroupFor,
+		INVERSE_ServicedBySystems,
+		INVERSE_ServicesBuildings,
+		INVERSE_ServicesFacilities,
+		INVERSE_ShapeOfProduct,
+		INVERSE_SourceOfResultGroup,
+		INVERSE_StyledByItem,
+		INVERSE_ToFaceSet,
+		INVERSE_ToMaterialConstituentSet,
+		INVERSE_ToMaterialLayerSet,
+		INVERSE_ToMaterialProfileSet,
+		INVERSE_ToTexMap,
+		INVERSE_Types,
+		INVERSE_UsedInStyles,
+		INVERSE_UsingCurves,
+		INVERSE_VoidsElements,
+		INVERSE_WellKnownText,
+		INVERSE_NUM_ATTRIBUTES
+	};
+
 	class IFCQUERY_EXPORT EntityFactory
 	{
 	public:
 		static BuildingEntity* createEntityObject( const std::string& class_name_upper );
+
+		/** Same as createEntityObject( class_name_upper ), for example for IFCWALL. Returns nullptr if ifcClassID is not the ID of an entity class */
+		static BuildingEntity* createEntityObject( uint32_t ifcClassID );
+
+		/** Class ID for an upper case entity name as in STEP files, for example IFCWALL for "IFCWALL". Returns 0 if the name is not an entity class */
+		static uint32_t getClassIDForEntityName( const std::string& class_name_upper );
+
 		static void emptyMapOfEntities();
 		static const char* getStringForClassID(uint32_t ifcClassID);
+
+		/** Returns nullptr if ifcClassID is not the ID of an entity class */
+		static const EntityClassInfo* getEntityClassInfo( uint32_t ifcClassID );
+		static const EntityClassInfo& getEntityClassInfoByIndex( uint16_t index );
+
+		/** Returns the attribute name without prefix, for example "HasOpenings" for INVERSE_HasOpenings */
+		static const char* getInverseAttributeName( uint16_t inverseAttribute );
 	};
 } // namespace
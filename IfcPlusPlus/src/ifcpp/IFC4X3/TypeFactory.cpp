@@ -1,5 +1,6 @@
 /* Code generated by IfcQuery EXPRESS generator, www.ifcquery.com */
 
+#include <algorithm>
 #include <map>
 #include <functional>
 #include "ifcpp/model/BasicTypes.h"
@@ -887,6 +888,388 @@ static BuildingModelMapType<std::string, std::function<shared_ptr<BuildingObject
 { "IFCWORKPLANTYPEENUM", []( const std::string& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWorkPlanTypeEnum::createObjectFromSTEP( arg, map, errorStream, entityIdNotFound ); } },
 { "IFCWORKSCHEDULETYPEENUM", []( const std::string& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWorkScheduleTypeEnum::createObjectFromSTEP( arg, map, errorStream, entityIdNotFound ); } }};
 
+typedef shared_ptr<BuildingObject> (*BinaryTypeFactory)( const SnapshotArgument&, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >&, std::stringstream&, std::unordered_set<int>& );
+static const std::pair<uint32_t, BinaryTypeFactory> type_factory_binary_by_id[] = {
+{ 8322439, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDistributionChamberElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 33568735, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAddressTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 37940459, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBSplineSurfaceForm::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 51269191, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWarpingConstantMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 54623293, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCableCarrierFittingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 58845555, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTemperatureGradientMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 64643665, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPhysicalOrVirtualEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 69416015, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDynamicViscosityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 86635668, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDayInMonthNumber::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 91683625, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConstructionEquipmentResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 94842927, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCurvatureMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 96294661, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRatioMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 103775553, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcOutletTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 124742581, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDerivedUnitEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 126693432, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcActionSourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 145283476, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReinforcingBarTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 151039812, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLuminousIntensityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 185388416, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLampTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 191860431, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLinearForceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 200335297, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReal::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 207745069, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBenchmarkEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 232962298, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermalAdmittanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 237118112, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcHumidifierTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 244819378, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSolarDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 255461614, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 278839091, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowPanelPositionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 286949696, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMagneticFluxDensityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 290688911, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDataOriginEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 291444547, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTransformerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 296282323, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTextTransformation::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 316539858, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStructuralSurfaceMemberTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 358033588, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBeamTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 360377573, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAmountOfSubstanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 361837227, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpecularRoughness::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 365584592, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricDistributionBoardTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 373436428, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcArithmeticOperatorEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 376935608, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDuctFittingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 384449397, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTaskTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 408310005, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcShearModulusMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 423474865, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 460077198, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGeographicElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 473029300, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPumpTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 492794765, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBridgePartTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 503418787, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLogical::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 506783830, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConstructionProductResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 509816776, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorStyleOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 524656162, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoseEquivalentMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 525895558, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcNonNegativeLengthMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 527936033, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMotorConnectionTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 531202833, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcChangeActionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 542029231, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSIUnitName::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 554647353, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEvaporatorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 571176181, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPerformanceHistoryTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 603696268, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTextFontName::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 606860825, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPropertySetTemplateTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 614319689, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCommunicationsApplianceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 627898853, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcChimneyTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 628493158, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSequenceEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 632304761, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAngularVelocityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 639531123, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSlabTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 649472068, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCableSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 652748602, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSurfaceFeatureTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 661370862, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPlateTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 667340609, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricMotorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 668377315, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCoolingTowerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 672692152, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCostScheduleTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 683809370, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCostItemTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 690167070, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElementCompositionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 697765865, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDiscreteAccessoryTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 743184107, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermodynamicTemperatureMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 765770214, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMonthInYearNumber::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 798148481, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCompressorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 815500815, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcActuatorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 827741273, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRailwayTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 846465480, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSoundPowerMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 857959152, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermalResistanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 859079163, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTrackElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 860830233, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDistributionPortTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 881902783, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLightDistributionCurveEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 897523405, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFlowInstrumentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 922449830, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDistributionSystemEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 929793134, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPHMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 935604799, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcUnitaryEquipmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 937566702, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDate::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 950732822, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcURIReference::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 960210175, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPreferredSurfaceCurveRepresentation::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 960326014, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProjectedOrTrueLengthEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 962935207, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMechanicalFastenerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 983778844, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcIdentifier::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 993287707, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSoundPressureMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1002142388, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEvaporativeCoolerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1007984134, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcHeatExchangerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1011845978, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReflectanceMethodEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1019252178, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFacilityPartCommonTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1021971458, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSystemFurnitureElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1040890966, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRampFlightTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1052454078, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcModulusOfRotationalSubgradeReactionMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1074166056, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowStyleOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1095732595, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMarinePartTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1098295817, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSensorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1102727119, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFontStyle::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1128263546, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1131349010, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGeometricProjectionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1152197495, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTextPath::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1158859006, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcHeatingValueMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1162880614, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLaborResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1184275752, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVehicleTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1190328964, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReinforcingBarSurfaceEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1197507443, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcUnitEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1209108979, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTemperatureRateOfChangeMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1239913253, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAirTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1243674935, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLengthMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1245737093, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPositiveRatioMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1262424489, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricTimeControlTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1268632640, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEarthworksCutTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1269596434, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAirTerminalBoxTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1275358634, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLanguageId::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1278329552, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTorqueMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1280103771, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDuctSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1282226622, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVibrationIsolatorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1290156191, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricApplianceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1307019551, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLinearStiffnessMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1338660958, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBuiltSystemTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1361398929, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcForceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1364037233, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPowerMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1367202144, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSanitaryTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1385270127, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReinforcingMeshTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1390679141, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRecurrenceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1401066283, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEventTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1420568751, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCourseTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1432008316, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTimeSeriesDataTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1455546828, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpaceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1460886941, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTextAlignment::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1460979143, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcColumnTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1464019863, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRoadTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1469346588, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLayerSetDirectionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1471118587, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWorkCalendarTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1477762836, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMassDensityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1479426229, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTendonAnchorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1491040762, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRailingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1500781891, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAreaDensityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1501183454, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCableCarrierSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1505327130, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAlignmentVerticalSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1506544127, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSignalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1514641115, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDescriptiveMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1536983066, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBridgeTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1551283683, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProjectOrderTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1639589134, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFurnitureTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1648970520, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMolecularWeightMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1672225696, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVibrationDamperTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1683019596, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCardinalPointReference::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1687521235, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcInternalOrExternalEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1692979113, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcComplexPropertyTemplateTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1693487766, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcChillerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1718600412, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWarpingMomentMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1718859833, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReferentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1736192930, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRoofTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1753493141, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcModulusOfSubgradeReactionMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1755127002, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRotationalMassMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1760651496, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCoilTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1774176899, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLineIndex::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1778710042, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCountMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1787361927, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSIPrefix::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1790229001, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPositiveInteger::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1797193231, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAirToAirHeatRecoveryTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1805707277, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStrippedOptional::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1823282114, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcShadingDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1827137117, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricCapacitanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1844818999, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcJunctionBoxTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1855850635, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpaceHeaterTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1867003952, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBoxAlignment::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1875623387, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDuctSilencerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1897649832, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProjectionElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1906401893, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConveyorSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1913101020, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBuildingElementProxyTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1914407012, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTransitionCode::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1925676203, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAssemblyPlaceEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1932549289, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowTypePartitioningEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1938929368, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPavementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1939436016, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcInteger::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1942645678, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSwitchingDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1962769620, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcObjectiveEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1970628803, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 1973315761, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBurnerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2016195849, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermalTransmittanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2053683727, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcKnotType::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2054016361, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcKinematicViscosityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2078135608, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEnergyMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2079224331, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDamperTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2089642407, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCableFittingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2093906313, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricConductanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2095003142, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLuminousFluxMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2095195183, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcNormalisedRatioMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2128902557, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConnectionTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2128979029, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLinearMomentMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2133746277, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRotationalFrequencyMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2149462589, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWellKnownTextLiteral::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2169031380, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPresentableText::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2173214787, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcModulusOfLinearSubgradeReactionMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2181869104, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRailwayPartTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2183683140, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFlowDirectionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2190458107, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSectionalAreaIntegralMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2195413836, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDateTime::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2244117335, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFastenerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2260317790, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcParameterValue::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2261624226, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcActionTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2281867870, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermalExpansionCoefficientMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2293803863, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPipeSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2314439260, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBinary::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2319738306, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStairTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2321227483, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProfileTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2324037503, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowPanelOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2326367582, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAlignmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2342653256, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSectionTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2395907400, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcNumericMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2447993252, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFacilityUsageEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2449831054, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLogicalOperatorEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2451242878, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCurtainWallTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2457772935, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPileConstructionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2486716878, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMagneticFluxMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2506162743, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAnalysisTheoryTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2506197118, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricVoltageMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2541165894, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDuration::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2548949139, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcInterceptorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2590844177, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFontWeight::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2591213694, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTimeStamp::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2593997549, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVolumetricFlowRateMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2602792976, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLoadGroupTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2615040989, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMonetaryMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2615076639, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcKerbTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2630368378, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVirtualElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2641080392, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTendonConduitTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2642773653, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPlanarForceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2645777649, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcThermalConductivityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2650437152, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAreaMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2679005408, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcInductanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2680421541, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStructuralCurveMemberTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2706281606, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWorkPlanTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2707447046, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMooringDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2715512545, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFontVariant::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2721224556, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorStyleConstructionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2726807636, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTimeMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2735952531, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBoolean::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2749697471, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2755797622, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLuminousIntensityDistributionMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2757832317, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpecularExponent::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2774431236, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcInventoryTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2785408664, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSurfaceSide::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2793383123, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFireSuppressionTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2798247006, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPropertySetDefinitionSet::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2801250643, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcText::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2815919920, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPositiveLengthMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2841622424, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElementAssemblyTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2860242611, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStructuralSurfaceActivityTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2872136011, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorPanelPositionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2872680054, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEarthworksFillTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2874063949, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcOpeningElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2875026444, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReinforcedSoilTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2885466731, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDocumentConfidentialityEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2906317437, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRailTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2951915441, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricResistanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2952703181, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCrewResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2966862399, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCoveringTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2969962241, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAlignmentCantSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2973211341, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFlowMeterTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2974343352, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPileTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2981638260, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAudioVisualApplianceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 2991860651, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcComplexNumber::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3034186359, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLightEmissionSourceEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3037870609, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProcedureTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3038022802, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStairFlightTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3041753155, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGridTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3044325142, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFrequencyMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3044747827, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricFlowStorageDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3054510233, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPositivePlaneAngleMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3054888242, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBooleanOperator::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3061959087, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPermitTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3064340077, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGloballyUniqueId::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3086160713, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLinearVelocityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3098684301, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWorkScheduleTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3099164984, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLiquidTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3113092358, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcHeatFluxDensityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3114022597, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMomentOfInertiaMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3114819794, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBuildingSystemTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3124462625, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBearingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3124614049, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMassMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3160627042, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSignTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3177669450, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMoistureDiffusivityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3178974365, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGeotechnicalStratumTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3185663589, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricGeneratorTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3192672207, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcIsothermalMoistureCapacityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3194911961, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3202202375, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcReinforcingBarRoleEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3211557302, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRotationalStiffnessMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3238673880, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcContextDependentMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3258342251, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLabel::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3288126668, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVoidingFeatureTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3294834125, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcNavigationElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3300536621, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTankTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3301026240, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcUnitaryControlElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3341486342, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcModulusOfElasticityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3344706444, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcExternalSpatialElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3345633955, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVaporPermeabilityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3349296550, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcOccupantTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3358199106, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcIlluminanceMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3389681023, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDirectionSenseEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3405941096, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCooledBeamTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3407053508, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTrimmingPreference::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3446698506, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPermeableCoveringOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3453182476, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCondenserTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3457685358, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSoundPressureLevelMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3458127941, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcVolumeMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3462168616, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEngineTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3467162246, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSectionModulusMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3471399674, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSolidAngleMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3476419373, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBuildingElementPartTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3477203348, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpecificHeatCapacityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3490877962, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTextDecoration::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3531705166, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMassPerLengthMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3531860660, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPipeFittingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3547450287, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCurveInterpolationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3551551017, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWallTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3555794193, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTaskDurationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3571493279, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorPanelOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3573632694, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBSplineCurveForm::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3593671318, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConstructionMaterialResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3594581223, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcValveTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3627328112, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTubeBundleTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3629595153, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRoadPartTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3637616042, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcGlobalOrLocalEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3647622174, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSpatialZoneTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3665567075, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPressureMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3672713367, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWindowStyleConstructionEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3676660675, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcWasteTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3683503648, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcArcIndex::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3686016028, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcIonConcentrationMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3699917729, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAbsorbedDoseMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3701338814, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDayInWeekNumber::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3717035687, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcEventTriggerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3726661758, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcBoilerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3733744356, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAnnotationTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3739419792, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcProtectiveDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3740788744, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTransportElementTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3754373064, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFanTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3790457270, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricCurrentMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3805913727, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcControllerTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3809634241, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcIntegerCountRateMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3812528620, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCompoundPlaneAngleMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3818625751, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMemberTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3818826038, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcElectricChargeMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3829999316, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDistributionBoardTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3841475323, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSimplePropertyTemplateTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3869224543, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRoleEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3876018962, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStructuralCurveActivityTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3881097202, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAnalysisModelTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3917635812, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTendonTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3956248403, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStackTerminalTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3959380518, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFilterTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3972513137, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRadioActivityMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3989067775, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMedicalDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 3995464546, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcRampTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4008630002, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSubContractResourceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4013007887, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcImpactProtectionDeviceTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4016286979, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDoorTypeOperationEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4017473158, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMassFlowRateMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4042175685, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcPlaneAngleMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4068098364, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDocumentStatusEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4075327185, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcTime::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4111266820, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcConstraintEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4134073009, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcDimensionCount::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4135496989, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcMarineFacilityTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4151168619, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcActionRequestTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4155216521, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcFootingTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4157543285, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcSoundPowerLevelMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4164688622, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAlarmTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4182062534, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcAccelerationMeasure::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4215032627, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcLightFixtureTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4218053802, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcCaissonFoundationTypeEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } },
+{ 4223916898, []( const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )->shared_ptr<BuildingObject> { return IFC4X3::IfcStateEnum::createObjectFromBinary( arg, map, errorStream, entityIdNotFound ); } }};
+
 shared_ptr<BuildingObject> IFC4X3::TypeFactory::createTypeObject( const std::string& class_name_upper, const std::string& type_arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if (class_name_upper.size() > 0)
@@ -906,6 +1289,18 @@ shared_ptr<BuildingObject> IFC4X3::TypeFactory::createTypeObject( const std::str
 	// class_name not registered
 	return shared_ptr<BuildingObject>();
 }
+shared_ptr<BuildingObject> IFC4X3::TypeFactory::createTypeObject( uint32_t ifcClassID, const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const std::pair<uint32_t, BinaryTypeFactory>* table_end = type_factory_binary_by_id + sizeof(type_factory_binary_by_id)/sizeof(type_factory_binary_by_id[0]);
+	auto it_find = std::lower_bound( type_factory_binary_by_id, table_end, ifcClassID,
+		[]( const std::pair<uint32_t, BinaryTypeFactory>& entry, uint32_t id ) { return entry.first < id; } );
+	if( it_find != table_end && it_find->first == ifcClassID )
+	{
+		return it_find->second( arg, mapEntities, errorStream, entityIdNotFound );
+	}
+	// not a type class
+	return shared_ptr<BuildingObject>();
+}
 void IFC4X3::TypeFactory::emptyMapOfTypes()
 {
 	type_factory_map.clear();
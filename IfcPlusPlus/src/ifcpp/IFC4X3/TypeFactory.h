@@ -451,6 +451,9 @@ namespace IFC4X3
 	{
 	public:
 		static shared_ptr<BuildingObject> createTypeObject( const std::string& class_name_upper, const std::string& type_arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+
+		/** \brief Same as createTypeObject, for a value of a binary snapshot, which has the class ID of the type (see SnapshotArgument::typeClassID) */
+		static shared_ptr<BuildingObject> createTypeObject( uint32_t ifcClassID, const SnapshotArgument& arg, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		static void emptyMapOfTypes();
 	};
 } //namespace
@@ -19,8 +19,11 @@ namespace IFC4X3
 		IfcAbsorbedDoseMeasure() = default;
 		IfcAbsorbedDoseMeasure( double value );
 		virtual uint32_t classID() const { return 3699917729; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcAbsorbedDoseMeasure> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcAbsorbedDoseMeasure> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		double m_value;
 	};
 }
@@ -19,8 +19,11 @@ namespace IFC4X3
 		IfcAccelerationMeasure() = default;
 		IfcAccelerationMeasure( double value );
 		virtual uint32_t classID() const { return 4182062534; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcAccelerationMeasure> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcAccelerationMeasure> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		double m_value;
 	};
 }
@@ -19,12 +19,19 @@ namespace IFC4X3
 		virtual void getStepLine( std::stringstream& stream, size_t precision ) const;
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
 		virtual void readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		virtual void readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		virtual void setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self );
 		virtual uint8_t getNumAttributes() const { return 3; }
 		virtual void getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const;
 		virtual void getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const;
+		virtual void visitAttributes( AttributeVisitor& visitor ) const;
+		virtual void visitAttributesInverse( AttributeVisitor& visitor ) const;
 		virtual void unlinkFromInverseCounterparts();
 		virtual uint32_t classID() const { return 3630933823; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
+		virtual uint16_t classIndex() const { return 0; }
+		static constexpr uint16_t CLASS_INDEX = 0;
+		static constexpr uint16_t CLASS_INDEX_END = 1;
 
 		// IfcActorRole -----------------------------------------------------------
 		// attributes:
@@ -24,8 +24,11 @@ namespace IFC4X3
 		IfcAlignmentTypeEnum() = default;
 		IfcAlignmentTypeEnum( IfcAlignmentTypeEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 2326367582; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcAlignmentTypeEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcAlignmentTypeEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcAlignmentTypeEnumEnum m_enum;
 	};
 }
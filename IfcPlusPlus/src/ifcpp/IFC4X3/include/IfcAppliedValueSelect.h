@@ -15,6 +15,7 @@ namespace IFC4X3
 	public:
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const = 0;
 		static shared_ptr<IfcAppliedValueSelect> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcAppliedValueSelect> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 	};
 }
 
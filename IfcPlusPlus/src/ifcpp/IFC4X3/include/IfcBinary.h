@@ -19,8 +19,11 @@ namespace IFC4X3
 		IfcBinary() = default;
 		IfcBinary( std::string value );
 		virtual uint32_t classID() const { return 2314439260; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
+		virtual size_t getPayloadMemorySize() const { return getHeapMemorySize( m_value ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
 		static shared_ptr<IfcBinary> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcBinary> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		std::string m_value;
 	};
 }
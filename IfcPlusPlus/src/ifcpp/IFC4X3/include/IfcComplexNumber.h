@@ -18,8 +18,12 @@ namespace IFC4X3
 	public:
 		IfcComplexNumber() = default;
 		virtual uint32_t classID() const { return 2991860651; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
+		virtual size_t getPayloadMemorySize() const { return getHeapMemorySize( m_vec ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcComplexNumber> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcComplexNumber> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		std::vector<double> m_vec;
 	};
 }
@@ -19,8 +19,12 @@ namespace IFC4X3
 		IfcDate() = default;
 		IfcDate( std::string value );
 		virtual uint32_t classID() const { return 937566702; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
+		virtual size_t getPayloadMemorySize() const { return getHeapMemorySize( m_value ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcDate> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcDate> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		std::string m_value;
 	};
 }
@@ -73,8 +73,11 @@ namespace IFC4X3
 		IfcDistributionSystemEnum() = default;
 		IfcDistributionSystemEnum( IfcDistributionSystemEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 922449830; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcDistributionSystemEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcDistributionSystemEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcDistributionSystemEnumEnum m_enum;
 	};
 }
@@ -28,8 +28,11 @@ namespace IFC4X3
 		IfcFacilityUsageEnum() = default;
 		IfcFacilityUsageEnum( IfcFacilityUsageEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 2447993252; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcFacilityUsageEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcFacilityUsageEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcFacilityUsageEnumEnum m_enum;
 	};
 }
@@ -27,8 +27,11 @@ namespace IFC4X3
 		IfcFastenerTypeEnum() = default;
 		IfcFastenerTypeEnum( IfcFastenerTypeEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 2244117335; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcFastenerTypeEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcFastenerTypeEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcFastenerTypeEnumEnum m_enum;
 	};
 }
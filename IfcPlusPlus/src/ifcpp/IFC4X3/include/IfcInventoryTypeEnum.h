@@ -27,8 +27,11 @@ namespace IFC4X3
 		IfcInventoryTypeEnum() = default;
 		IfcInventoryTypeEnum( IfcInventoryTypeEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 2774431236; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcInventoryTypeEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcInventoryTypeEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcInventoryTypeEnumEnum m_enum;
 	};
 }
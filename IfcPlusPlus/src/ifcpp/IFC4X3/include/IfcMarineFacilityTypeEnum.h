@@ -43,8 +43,11 @@ namespace IFC4X3
 		IfcMarineFacilityTypeEnum() = default;
 		IfcMarineFacilityTypeEnum( IfcMarineFacilityTypeEnumEnum e ) { m_enum = e; }
 		virtual uint32_t classID() const { return 4135496989; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcMarineFacilityTypeEnum> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcMarineFacilityTypeEnum> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		IfcMarineFacilityTypeEnumEnum m_enum;
 	};
 }
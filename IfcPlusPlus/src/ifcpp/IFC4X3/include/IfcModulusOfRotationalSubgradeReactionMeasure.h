@@ -20,8 +20,11 @@ namespace IFC4X3
 		IfcModulusOfRotationalSubgradeReactionMeasure() = default;
 		IfcModulusOfRotationalSubgradeReactionMeasure( double value );
 		virtual uint32_t classID() const { return 1052454078; }
+		virtual size_t getMemorySize() const { return sizeof( *this ); }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
+		virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
 		static shared_ptr<IfcModulusOfRotationalSubgradeReactionMeasure> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+		static shared_ptr<IfcModulusOfRotationalSubgradeReactionMeasure> createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
 		double m_value;
 	};
 }
@@ -18,6 +18,10 @@ void IFC4X3::IfcAbsorbedDoseMeasure::getStepParameter( std::stringstream& stream
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAbsorbedDoseMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcAbsorbedDoseMeasure> IFC4X3::IfcAbsorbedDoseMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAbsorbedDoseMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcAbsorbedDoseMeasure> IFC4X3::IfcAbsorbedDoseMeasure::creat
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAbsorbedDoseMeasure> IFC4X3::IfcAbsorbedDoseMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcAbsorbedDoseMeasure>(); }
+	shared_ptr<IfcAbsorbedDoseMeasure> type_object( new IfcAbsorbedDoseMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
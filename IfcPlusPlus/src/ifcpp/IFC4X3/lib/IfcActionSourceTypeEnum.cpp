@@ -45,6 +45,10 @@ void IFC4X3::IfcActionSourceTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcActionSourceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcActionSourceTypeEnum> IFC4X3::IfcActionSourceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcActionSourceTypeEnum>(); }
@@ -161,3 +165,12 @@ shared_ptr<IFC4X3::IfcActionSourceTypeEnum> IFC4X3::IfcActionSourceTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcActionSourceTypeEnum> IFC4X3::IfcActionSourceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcActionSourceTypeEnum>(); }
+		return shared_ptr<IfcActionSourceTypeEnum>( new IfcActionSourceTypeEnum( IfcActionSourceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcActionTypeEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcActionTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcActionTypeEnum> IFC4X3::IfcActionTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcActionTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcActionTypeEnum> IFC4X3::IfcActionTypeEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcActionTypeEnum> IFC4X3::IfcActionTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcActionTypeEnum>(); }
+		return shared_ptr<IfcActionTypeEnum>( new IfcActionTypeEnum( IfcActionTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -50,6 +50,17 @@ void IFC4X3::IfcActor::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 5 ){m_TheActor = IfcActorSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcActor, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcActor::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_TheActor = IfcActorSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcActor, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcActor::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObject::getAttributes( vec_attributes );
@@ -68,6 +79,16 @@ void IFC4X3::IfcActor::getAttributesInverse( std::vector<std::pair<std::string,
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "IsActingUpon_inverse", IsActingUpon_inverse_vec_obj ) );
 }
+void IFC4X3::IfcActor::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributes( visitor );
+	visitor.visitObject( 5, "TheActor", m_TheActor );
+}
+void IFC4X3::IfcActor::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributesInverse( visitor );
+	visitor.visitList( 11, "IsActingUpon_inverse", AttributeInverseVectorView<IfcRelAssignsToActor>( m_IsActingUpon_inverse ) );
+}
 void IFC4X3::IfcActor::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObject::setInverseCounterparts( ptr_self_entity );
@@ -76,3 +97,12 @@ void IFC4X3::IfcActor::unlinkFromInverseCounterparts()
 {
 	IfcObject::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcActor::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObject::getEntityReferences( refs );
+	BuildingEntity* TheActor_entity = dynamic_cast<BuildingEntity*>( m_TheActor.get() );
+	if( TheActor_entity )
+	{
+		refs.push_back( TheActor_entity );
+	}
+}
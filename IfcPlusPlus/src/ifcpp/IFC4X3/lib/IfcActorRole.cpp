@@ -31,6 +31,14 @@ void IFC4X3::IfcActorRole::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 2 ){m_Description = IfcText::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcActorRole, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcActorRole::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Role = IfcRoleEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UserDefinedRole = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcActorRole, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcActorRole::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Role", m_Role ) );
@@ -49,6 +57,16 @@ void IFC4X3::IfcActorRole::getAttributesInverse( std::vector<std::pair<std::stri
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReference_inverse", HasExternalReference_inverse_vec_obj ) );
 }
+void IFC4X3::IfcActorRole::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Role", m_Role );
+	visitor.visitObject( 1, "UserDefinedRole", m_UserDefinedRole );
+	visitor.visitObject( 2, "Description", m_Description );
+}
+void IFC4X3::IfcActorRole::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReference_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReference_inverse ) );
+}
 void IFC4X3::IfcActorRole::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
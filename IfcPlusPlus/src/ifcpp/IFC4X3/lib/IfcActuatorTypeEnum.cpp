@@ -25,6 +25,10 @@ void IFC4X3::IfcActuatorTypeEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcActuatorTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcActuatorTypeEnum> IFC4X3::IfcActuatorTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcActuatorTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcActuatorTypeEnum> IFC4X3::IfcActuatorTypeEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcActuatorTypeEnum> IFC4X3::IfcActuatorTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcActuatorTypeEnum>(); }
+		return shared_ptr<IfcActuatorTypeEnum>( new IfcActuatorTypeEnum( IfcActuatorTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
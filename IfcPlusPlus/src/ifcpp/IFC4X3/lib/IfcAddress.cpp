@@ -32,6 +32,14 @@ void IFC4X3::IfcAddress::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 2 ){m_UserDefinedPurpose = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAddress, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAddress::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Purpose = IfcAddressTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedPurpose = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAddress, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAddress::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Purpose", m_Purpose ) );
@@ -59,6 +67,17 @@ void IFC4X3::IfcAddress::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "OfOrganization_inverse", OfOrganization_inverse_vec_obj ) );
 }
+void IFC4X3::IfcAddress::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Purpose", m_Purpose );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "UserDefinedPurpose", m_UserDefinedPurpose );
+}
+void IFC4X3::IfcAddress::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "OfPerson_inverse", AttributeInverseVectorView<IfcPerson>( m_OfPerson_inverse ) );
+	visitor.visitList( 1, "OfOrganization_inverse", AttributeInverseVectorView<IfcOrganization>( m_OfOrganization_inverse ) );
+}
 void IFC4X3::IfcAddress::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -23,6 +23,10 @@ void IFC4X3::IfcAddressTypeEnum::getStepParameter( std::stringstream& stream, bo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAddressTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAddressTypeEnum> IFC4X3::IfcAddressTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAddressTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcAddressTypeEnum> IFC4X3::IfcAddressTypeEnum::createObjectF
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAddressTypeEnum> IFC4X3::IfcAddressTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_USERDEFINED ) { return shared_ptr<IfcAddressTypeEnum>(); }
+		return shared_ptr<IfcAddressTypeEnum>( new IfcAddressTypeEnum( IfcAddressTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcAdvancedBrep::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcAdvancedBrep, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAdvancedBrep::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcAdvancedBrep, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAdvancedBrep::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcManifoldSolidBrep::getAttributes( vec_attributes );
@@ -32,6 +38,14 @@ void IFC4X3::IfcAdvancedBrep::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcManifoldSolidBrep::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAdvancedBrep::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcManifoldSolidBrep::visitAttributes( visitor );
+}
+void IFC4X3::IfcAdvancedBrep::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcManifoldSolidBrep::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAdvancedBrep::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcManifoldSolidBrep::setInverseCounterparts( ptr_self_entity );
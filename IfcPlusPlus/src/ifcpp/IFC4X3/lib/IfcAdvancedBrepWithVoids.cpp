@@ -27,6 +27,13 @@ void IFC4X3::IfcAdvancedBrepWithVoids::readStepArguments( const std::vector<std:
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_Voids, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAdvancedBrepWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAdvancedBrepWithVoids::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Voids, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAdvancedBrepWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAdvancedBrepWithVoids::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAdvancedBrep::getAttributes( vec_attributes );
@@ -38,6 +45,15 @@ void IFC4X3::IfcAdvancedBrepWithVoids::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcAdvancedBrep::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAdvancedBrepWithVoids::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAdvancedBrep::visitAttributes( visitor );
+	visitor.visitList( 1, "Voids", AttributeVectorView<IfcClosedShell>( m_Voids ) );
+}
+void IFC4X3::IfcAdvancedBrepWithVoids::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAdvancedBrep::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAdvancedBrepWithVoids::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAdvancedBrep::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +62,14 @@ void IFC4X3::IfcAdvancedBrepWithVoids::unlinkFromInverseCounterparts()
 {
 	IfcAdvancedBrep::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAdvancedBrepWithVoids::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcAdvancedBrep::getEntityReferences( refs );
+	for( size_t i=0; i<m_Voids.size(); ++i )
+	{
+		if( m_Voids[i] )
+		{
+			refs.push_back( m_Voids[i].get() );
+		}
+	}
+}
@@ -33,6 +33,14 @@ void IFC4X3::IfcAdvancedFace::readStepArguments( const std::vector<std::string>&
 	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAdvancedFace, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAdvancedFace::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Bounds, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_FaceSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAdvancedFace, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAdvancedFace::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFaceSurface::getAttributes( vec_attributes );
@@ -41,6 +49,14 @@ void IFC4X3::IfcAdvancedFace::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcFaceSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAdvancedFace::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFaceSurface::visitAttributes( visitor );
+}
+void IFC4X3::IfcAdvancedFace::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFaceSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAdvancedFace::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFaceSurface::setInverseCounterparts( ptr_self_entity );
@@ -63,6 +63,21 @@ void IFC4X3::IfcAirTerminalType::readStepArguments( const std::vector<std::strin
 	if( num_args > 9 ){m_PredefinedType = IfcAirTerminalTypeEnum::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcAirTerminalType, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAirTerminalType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ElementType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcAirTerminalTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcAirTerminalType, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAirTerminalType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFlowTerminalType::getAttributes( vec_attributes );
@@ -72,6 +87,15 @@ void IFC4X3::IfcAirTerminalType::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcFlowTerminalType::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAirTerminalType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFlowTerminalType::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcAirTerminalType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFlowTerminalType::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAirTerminalType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFlowTerminalType::setInverseCounterparts( ptr_self_entity );
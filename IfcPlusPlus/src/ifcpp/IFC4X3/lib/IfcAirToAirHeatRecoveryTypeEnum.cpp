@@ -29,6 +29,10 @@ void IFC4X3::IfcAirToAirHeatRecoveryTypeEnum::getStepParameter( std::stringstrea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAirToAirHeatRecoveryTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAirToAirHeatRecoveryTypeEnum> IFC4X3::IfcAirToAirHeatRecoveryTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAirToAirHeatRecoveryTypeEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcAirToAirHeatRecoveryTypeEnum> IFC4X3::IfcAirToAirHeatRecov
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAirToAirHeatRecoveryTypeEnum> IFC4X3::IfcAirToAirHeatRecoveryTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcAirToAirHeatRecoveryTypeEnum>(); }
+		return shared_ptr<IfcAirToAirHeatRecoveryTypeEnum>( new IfcAirToAirHeatRecoveryTypeEnum( IfcAirToAirHeatRecoveryTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
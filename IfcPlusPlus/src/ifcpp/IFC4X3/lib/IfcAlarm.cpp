@@ -76,6 +76,20 @@ void IFC4X3::IfcAlarm::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 8 ){m_PredefinedType = IfcAlarmTypeEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlarm, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlarm::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcAlarmTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlarm, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlarm::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcDistributionControlElement::getAttributes( vec_attributes );
@@ -85,6 +99,15 @@ void IFC4X3::IfcAlarm::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcDistributionControlElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAlarm::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionControlElement::visitAttributes( visitor );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcAlarm::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionControlElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAlarm::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcDistributionControlElement::setInverseCounterparts( ptr_self_entity );
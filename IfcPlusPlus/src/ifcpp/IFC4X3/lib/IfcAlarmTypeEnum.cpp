@@ -28,6 +28,10 @@ void IFC4X3::IfcAlarmTypeEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAlarmTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAlarmTypeEnum> IFC4X3::IfcAlarmTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAlarmTypeEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcAlarmTypeEnum> IFC4X3::IfcAlarmTypeEnum::createObjectFromS
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAlarmTypeEnum> IFC4X3::IfcAlarmTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcAlarmTypeEnum>(); }
+		return shared_ptr<IfcAlarmTypeEnum>( new IfcAlarmTypeEnum( IfcAlarmTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
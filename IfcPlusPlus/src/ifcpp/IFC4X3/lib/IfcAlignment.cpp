@@ -61,6 +61,19 @@ void IFC4X3::IfcAlignment::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 7 ){m_PredefinedType = IfcAlignmentTypeEnum::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcAlignment, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlignment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcAlignmentTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcAlignment, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlignment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLinearPositioningElement::getAttributes( vec_attributes );
@@ -70,6 +83,15 @@ void IFC4X3::IfcAlignment::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcLinearPositioningElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAlignment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLinearPositioningElement::visitAttributes( visitor );
+	visitor.visitObject( 7, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcAlignment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLinearPositioningElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAlignment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLinearPositioningElement::setInverseCounterparts( ptr_self_entity );
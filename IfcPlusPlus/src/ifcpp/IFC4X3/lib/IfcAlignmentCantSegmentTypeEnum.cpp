@@ -25,6 +25,10 @@ void IFC4X3::IfcAlignmentCantSegmentTypeEnum::getStepParameter( std::stringstrea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAlignmentCantSegmentTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAlignmentCantSegmentTypeEnum> IFC4X3::IfcAlignmentCantSegmentTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAlignmentCantSegmentTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcAlignmentCantSegmentTypeEnum> IFC4X3::IfcAlignmentCantSegm
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAlignmentCantSegmentTypeEnum> IFC4X3::IfcAlignmentCantSegmentTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_VIENNESEBEND ) { return shared_ptr<IfcAlignmentCantSegmentTypeEnum>(); }
+		return shared_ptr<IfcAlignmentCantSegmentTypeEnum>( new IfcAlignmentCantSegmentTypeEnum( IfcAlignmentCantSegmentTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -56,6 +56,18 @@ void IFC4X3::IfcAlignmentHorizontal::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcAlignmentHorizontal, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlignmentHorizontal::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcAlignmentHorizontal, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlignmentHorizontal::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLinearElement::getAttributes( vec_attributes );
@@ -64,6 +76,14 @@ void IFC4X3::IfcAlignmentHorizontal::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcLinearElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAlignmentHorizontal::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLinearElement::visitAttributes( visitor );
+}
+void IFC4X3::IfcAlignmentHorizontal::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLinearElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAlignmentHorizontal::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLinearElement::setInverseCounterparts( ptr_self_entity );
@@ -52,6 +52,20 @@ void IFC4X3::IfcAlignmentHorizontalSegment::readStepArguments( const std::vector
 	if( num_args > 8 ){m_PredefinedType = IfcAlignmentHorizontalSegmentTypeEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlignmentHorizontalSegment, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlignmentHorizontalSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_StartTag = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_EndTag = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_StartPoint, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartDirection = IfcPlaneAngleMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_StartRadiusOfCurvature = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_EndRadiusOfCurvature = IfcLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_SegmentLength = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_GravityCenterLineHeight = IfcPositiveLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcAlignmentHorizontalSegmentTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlignmentHorizontalSegment, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlignmentHorizontalSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAlignmentParameterSegment::getAttributes( vec_attributes );
@@ -67,6 +81,21 @@ void IFC4X3::IfcAlignmentHorizontalSegment::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcAlignmentParameterSegment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAlignmentHorizontalSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAlignmentParameterSegment::visitAttributes( visitor );
+	visitor.visitObject( 2, "StartPoint", m_StartPoint );
+	visitor.visitObject( 3, "StartDirection", m_StartDirection );
+	visitor.visitObject( 4, "StartRadiusOfCurvature", m_StartRadiusOfCurvature );
+	visitor.visitObject( 5, "EndRadiusOfCurvature", m_EndRadiusOfCurvature );
+	visitor.visitObject( 6, "SegmentLength", m_SegmentLength );
+	visitor.visitObject( 7, "GravityCenterLineHeight", m_GravityCenterLineHeight );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcAlignmentHorizontalSegment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAlignmentParameterSegment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAlignmentHorizontalSegment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAlignmentParameterSegment::setInverseCounterparts( ptr_self_entity );
@@ -75,3 +104,11 @@ void IFC4X3::IfcAlignmentHorizontalSegment::unlinkFromInverseCounterparts()
 {
 	IfcAlignmentParameterSegment::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAlignmentHorizontalSegment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcAlignmentParameterSegment::getEntityReferences( refs );
+	if( m_StartPoint )
+	{
+		refs.push_back( m_StartPoint.get() );
+	}
+}
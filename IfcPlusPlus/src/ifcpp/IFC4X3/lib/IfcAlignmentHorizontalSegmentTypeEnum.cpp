@@ -27,6 +27,10 @@ void IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum::getStepParameter( std::strin
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum> IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAlignmentHorizontalSegmentTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum> IFC4X3::IfcAlignmentHo
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum> IFC4X3::IfcAlignmentHorizontalSegmentTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_VIENNESEBEND ) { return shared_ptr<IfcAlignmentHorizontalSegmentTypeEnum>(); }
+		return shared_ptr<IfcAlignmentHorizontalSegmentTypeEnum>( new IfcAlignmentHorizontalSegmentTypeEnum( IfcAlignmentHorizontalSegmentTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
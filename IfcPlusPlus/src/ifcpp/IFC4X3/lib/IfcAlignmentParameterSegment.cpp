@@ -25,6 +25,13 @@ void IFC4X3::IfcAlignmentParameterSegment::readStepArguments( const std::vector<
 	if( num_args > 1 ){m_EndTag = IfcLabel::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAlignmentParameterSegment, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlignmentParameterSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_StartTag = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_EndTag = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAlignmentParameterSegment, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlignmentParameterSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "StartTag", m_StartTag ) );
@@ -33,6 +40,14 @@ void IFC4X3::IfcAlignmentParameterSegment::getAttributes( std::vector<std::pair<
 void IFC4X3::IfcAlignmentParameterSegment::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcAlignmentParameterSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "StartTag", m_StartTag );
+	visitor.visitObject( 1, "EndTag", m_EndTag );
+}
+void IFC4X3::IfcAlignmentParameterSegment::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcAlignmentParameterSegment::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
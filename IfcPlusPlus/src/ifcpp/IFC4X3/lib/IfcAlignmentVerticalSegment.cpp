@@ -50,6 +50,20 @@ void IFC4X3::IfcAlignmentVerticalSegment::readStepArguments( const std::vector<s
 	if( num_args > 8 ){m_PredefinedType = IfcAlignmentVerticalSegmentTypeEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlignmentVerticalSegment, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAlignmentVerticalSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_StartTag = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_EndTag = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_StartDistAlong = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_HorizontalLength = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_StartHeight = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_StartGradient = IfcRatioMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_EndGradient = IfcRatioMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_RadiusOfCurvature = IfcLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcAlignmentVerticalSegmentTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcAlignmentVerticalSegment, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAlignmentVerticalSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAlignmentParameterSegment::getAttributes( vec_attributes );
@@ -65,6 +79,21 @@ void IFC4X3::IfcAlignmentVerticalSegment::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcAlignmentParameterSegment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAlignmentVerticalSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAlignmentParameterSegment::visitAttributes( visitor );
+	visitor.visitObject( 2, "StartDistAlong", m_StartDistAlong );
+	visitor.visitObject( 3, "HorizontalLength", m_HorizontalLength );
+	visitor.visitObject( 4, "StartHeight", m_StartHeight );
+	visitor.visitObject( 5, "StartGradient", m_StartGradient );
+	visitor.visitObject( 6, "EndGradient", m_EndGradient );
+	visitor.visitObject( 7, "RadiusOfCurvature", m_RadiusOfCurvature );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcAlignmentVerticalSegment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAlignmentParameterSegment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAlignmentVerticalSegment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAlignmentParameterSegment::setInverseCounterparts( ptr_self_entity );
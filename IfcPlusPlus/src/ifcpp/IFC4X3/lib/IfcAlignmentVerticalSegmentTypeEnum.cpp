@@ -22,6 +22,10 @@ void IFC4X3::IfcAlignmentVerticalSegmentTypeEnum::getStepParameter( std::strings
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAlignmentVerticalSegmentTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAlignmentVerticalSegmentTypeEnum> IFC4X3::IfcAlignmentVerticalSegmentTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAlignmentVerticalSegmentTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcAlignmentVerticalSegmentTypeEnum> IFC4X3::IfcAlignmentVert
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAlignmentVerticalSegmentTypeEnum> IFC4X3::IfcAlignmentVerticalSegmentTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_PARABOLICARC ) { return shared_ptr<IfcAlignmentVerticalSegmentTypeEnum>(); }
+		return shared_ptr<IfcAlignmentVerticalSegmentTypeEnum>( new IfcAlignmentVerticalSegmentTypeEnum( IfcAlignmentVerticalSegmentTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
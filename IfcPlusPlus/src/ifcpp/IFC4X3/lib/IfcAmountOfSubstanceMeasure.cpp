@@ -18,6 +18,10 @@ void IFC4X3::IfcAmountOfSubstanceMeasure::getStepParameter( std::stringstream& s
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAmountOfSubstanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcAmountOfSubstanceMeasure> IFC4X3::IfcAmountOfSubstanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAmountOfSubstanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcAmountOfSubstanceMeasure> IFC4X3::IfcAmountOfSubstanceMeas
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAmountOfSubstanceMeasure> IFC4X3::IfcAmountOfSubstanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcAmountOfSubstanceMeasure>(); }
+	shared_ptr<IfcAmountOfSubstanceMeasure> type_object( new IfcAmountOfSubstanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -27,6 +27,13 @@ void IFC4X3::IfcAnnotationFillArea::readStepArguments( const std::vector<std::st
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_InnerBoundaries, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAnnotationFillArea, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAnnotationFillArea::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_OuterBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_InnerBoundaries, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAnnotationFillArea, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAnnotationFillArea::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -39,6 +46,16 @@ void IFC4X3::IfcAnnotationFillArea::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAnnotationFillArea::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "OuterBoundary", m_OuterBoundary );
+	visitor.visitList( 1, "InnerBoundaries", AttributeVectorView<IfcCurve>( m_InnerBoundaries ) );
+}
+void IFC4X3::IfcAnnotationFillArea::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAnnotationFillArea::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -47,3 +64,18 @@ void IFC4X3::IfcAnnotationFillArea::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAnnotationFillArea::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	if( m_OuterBoundary )
+	{
+		refs.push_back( m_OuterBoundary.get() );
+	}
+	for( size_t i=0; i<m_InnerBoundaries.size(); ++i )
+	{
+		if( m_InnerBoundaries[i] )
+		{
+			refs.push_back( m_InnerBoundaries[i].get() );
+		}
+	}
+}
@@ -33,6 +33,15 @@ void IFC4X3::IfcApplication::readStepArguments( const std::vector<std::string>&
 	if( num_args > 3 ){m_ApplicationIdentifier = IfcIdentifier::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcApplication, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcApplication::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ApplicationDeveloper, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Version = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ApplicationFullName = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ApplicationIdentifier = IfcIdentifier::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcApplication, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcApplication::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ApplicationDeveloper", m_ApplicationDeveloper ) );
@@ -43,9 +52,26 @@ void IFC4X3::IfcApplication::getAttributes( std::vector<std::pair<std::string, s
 void IFC4X3::IfcApplication::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcApplication::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ApplicationDeveloper", m_ApplicationDeveloper );
+	visitor.visitObject( 1, "Version", m_Version );
+	visitor.visitObject( 2, "ApplicationFullName", m_ApplicationFullName );
+	visitor.visitObject( 3, "ApplicationIdentifier", m_ApplicationIdentifier );
+}
+void IFC4X3::IfcApplication::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcApplication::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcApplication::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcApplication::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_ApplicationDeveloper )
+	{
+		refs.push_back( m_ApplicationDeveloper.get() );
+	}
+}
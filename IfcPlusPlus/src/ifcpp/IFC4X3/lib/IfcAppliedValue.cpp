@@ -55,6 +55,21 @@ void IFC4X3::IfcAppliedValue::readStepArguments( const std::vector<std::string>&
 	if( num_args > 9 ){readEntityReferenceList( args[9], m_Components, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcAppliedValue, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAppliedValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AppliedValue = IfcAppliedValueSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_UnitBasis, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableDate = IfcDate::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_FixedUntilDate = IfcDate::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Category = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Condition = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ArithmeticOperator = IfcArithmeticOperatorEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReferenceList( args[9], m_Components, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcAppliedValue, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAppliedValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -82,9 +97,45 @@ void IFC4X3::IfcAppliedValue::getAttributesInverse( std::vector<std::pair<std::s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReference_inverse", HasExternalReference_inverse_vec_obj ) );
 }
+void IFC4X3::IfcAppliedValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "AppliedValue", m_AppliedValue );
+	visitor.visitObject( 3, "UnitBasis", m_UnitBasis );
+	visitor.visitObject( 4, "ApplicableDate", m_ApplicableDate );
+	visitor.visitObject( 5, "FixedUntilDate", m_FixedUntilDate );
+	visitor.visitObject( 6, "Category", m_Category );
+	visitor.visitObject( 7, "Condition", m_Condition );
+	visitor.visitObject( 8, "ArithmeticOperator", m_ArithmeticOperator );
+	visitor.visitList( 9, "Components", AttributeVectorView<IfcAppliedValue>( m_Components ) );
+}
+void IFC4X3::IfcAppliedValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReference_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReference_inverse ) );
+}
 void IFC4X3::IfcAppliedValue::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcAppliedValue::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcAppliedValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* AppliedValue_entity = dynamic_cast<BuildingEntity*>( m_AppliedValue.get() );
+	if( AppliedValue_entity )
+	{
+		refs.push_back( AppliedValue_entity );
+	}
+	if( m_UnitBasis )
+	{
+		refs.push_back( m_UnitBasis.get() );
+	}
+	for( size_t i=0; i<m_Components.size(); ++i )
+	{
+		if( m_Components[i] )
+		{
+			refs.push_back( m_Components[i].get() );
+		}
+	}
+}
@@ -54,6 +54,20 @@ void IFC4X3::IfcApproval::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 8 ){m_GivingApproval = IfcActorSelect::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcApproval, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcApproval::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Identifier = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Name = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TimeOfApproval = IfcDateTime::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Status = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Level = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Qualifier = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_RequestingApproval = IfcActorSelect::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_GivingApproval = IfcActorSelect::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcApproval, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcApproval::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Identifier", m_Identifier ) );
@@ -114,9 +128,42 @@ void IFC4X3::IfcApproval::getAttributesInverse( std::vector<std::pair<std::strin
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Relates_inverse", Relates_inverse_vec_obj ) );
 }
+void IFC4X3::IfcApproval::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Identifier", m_Identifier );
+	visitor.visitObject( 1, "Name", m_Name );
+	visitor.visitObject( 2, "Description", m_Description );
+	visitor.visitObject( 3, "TimeOfApproval", m_TimeOfApproval );
+	visitor.visitObject( 4, "Status", m_Status );
+	visitor.visitObject( 5, "Level", m_Level );
+	visitor.visitObject( 6, "Qualifier", m_Qualifier );
+	visitor.visitObject( 7, "RequestingApproval", m_RequestingApproval );
+	visitor.visitObject( 8, "GivingApproval", m_GivingApproval );
+}
+void IFC4X3::IfcApproval::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+	visitor.visitList( 1, "ApprovedObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesApproval>( m_ApprovedObjects_inverse ) );
+	visitor.visitList( 2, "ApprovedResources_inverse", AttributeInverseVectorView<IfcResourceApprovalRelationship>( m_ApprovedResources_inverse ) );
+	visitor.visitList( 3, "IsRelatedWith_inverse", AttributeInverseVectorView<IfcApprovalRelationship>( m_IsRelatedWith_inverse ) );
+	visitor.visitList( 4, "Relates_inverse", AttributeInverseVectorView<IfcApprovalRelationship>( m_Relates_inverse ) );
+}
 void IFC4X3::IfcApproval::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcApproval::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcApproval::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* RequestingApproval_entity = dynamic_cast<BuildingEntity*>( m_RequestingApproval.get() );
+	if( RequestingApproval_entity )
+	{
+		refs.push_back( RequestingApproval_entity );
+	}
+	BuildingEntity* GivingApproval_entity = dynamic_cast<BuildingEntity*>( m_GivingApproval.get() );
+	if( GivingApproval_entity )
+	{
+		refs.push_back( GivingApproval_entity );
+	}
+}
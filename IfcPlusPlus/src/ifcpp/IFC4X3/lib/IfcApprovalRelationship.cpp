@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcApproval.h"
 #include "ifcpp/IFC4X3/include/IfcApprovalRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -33,6 +34,15 @@ void IFC4X3::IfcApprovalRelationship::readStepArguments( const std::vector<std::
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedApprovals, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcApprovalRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcApprovalRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingApproval, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedApprovals, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcApprovalRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcApprovalRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -45,6 +55,16 @@ void IFC4X3::IfcApprovalRelationship::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcApprovalRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingApproval", m_RelatingApproval );
+	visitor.visitList( 3, "RelatedApprovals", AttributeVectorView<IfcApproval>( m_RelatedApprovals ) );
+}
+void IFC4X3::IfcApprovalRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcApprovalRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -62,6 +82,21 @@ void IFC4X3::IfcApprovalRelationship::setInverseCounterparts( shared_ptr<Buildin
 		m_RelatingApproval->m_Relates_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcApprovalRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedApprovals.size(); ++i )
+	{
+		if( m_RelatedApprovals[i] )
+		{
+			refs.emplace_back( m_RelatedApprovals[i].get(), INVERSE_IsRelatedWith );
+		}
+	}
+	if( m_RelatingApproval )
+	{
+		refs.emplace_back( m_RelatingApproval.get(), INVERSE_Relates );
+	}
+}
 void IFC4X3::IfcApprovalRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -113,3 +148,18 @@ void IFC4X3::IfcApprovalRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcApprovalRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingApproval )
+	{
+		refs.push_back( m_RelatingApproval.get() );
+	}
+	for( size_t i=0; i<m_RelatedApprovals.size(); ++i )
+	{
+		if( m_RelatedApprovals[i] )
+		{
+			refs.push_back( m_RelatedApprovals[i].get() );
+		}
+	}
+}
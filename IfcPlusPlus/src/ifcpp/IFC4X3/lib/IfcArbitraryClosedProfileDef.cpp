@@ -32,6 +32,14 @@ void IFC4X3::IfcArbitraryClosedProfileDef::readStepArguments( const std::vector<
 	if( num_args > 2 ){readEntityReference( args[2], m_OuterCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcArbitraryClosedProfileDef, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcArbitraryClosedProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_OuterCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcArbitraryClosedProfileDef, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcArbitraryClosedProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProfileDef::getAttributes( vec_attributes );
@@ -41,6 +49,15 @@ void IFC4X3::IfcArbitraryClosedProfileDef::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcArbitraryClosedProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 2, "OuterCurve", m_OuterCurve );
+}
+void IFC4X3::IfcArbitraryClosedProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcArbitraryClosedProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +66,11 @@ void IFC4X3::IfcArbitraryClosedProfileDef::unlinkFromInverseCounterparts()
 {
 	IfcProfileDef::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcArbitraryClosedProfileDef::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProfileDef::getEntityReferences( refs );
+	if( m_OuterCurve )
+	{
+		refs.push_back( m_OuterCurve.get() );
+	}
+}
@@ -35,6 +35,15 @@ void IFC4X3::IfcArbitraryProfileDefWithVoids::readStepArguments( const std::vect
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_InnerCurves, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcArbitraryProfileDefWithVoids, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcArbitraryProfileDefWithVoids::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_OuterCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_InnerCurves, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcArbitraryProfileDefWithVoids, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcArbitraryProfileDefWithVoids::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcArbitraryClosedProfileDef::getAttributes( vec_attributes );
@@ -46,6 +55,15 @@ void IFC4X3::IfcArbitraryProfileDefWithVoids::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcArbitraryClosedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcArbitraryProfileDefWithVoids::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcArbitraryClosedProfileDef::visitAttributes( visitor );
+	visitor.visitList( 3, "InnerCurves", AttributeVectorView<IfcCurve>( m_InnerCurves ) );
+}
+void IFC4X3::IfcArbitraryProfileDefWithVoids::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcArbitraryClosedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcArbitraryProfileDefWithVoids::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcArbitraryClosedProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +72,14 @@ void IFC4X3::IfcArbitraryProfileDefWithVoids::unlinkFromInverseCounterparts()
 {
 	IfcArbitraryClosedProfileDef::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcArbitraryProfileDefWithVoids::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcArbitraryClosedProfileDef::getEntityReferences( refs );
+	for( size_t i=0; i<m_InnerCurves.size(); ++i )
+	{
+		if( m_InnerCurves[i] )
+		{
+			refs.push_back( m_InnerCurves[i].get() );
+		}
+	}
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcArcIndex::getStepParameter( std::stringstream& stream, bool is_s
 	writeTypeOfIntList( stream, m_vec, false );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcArcIndex::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeTyped( classID(), [&]() { return encoder.encodeList( AttributeVectorView<IfcPositiveInteger>( m_vec ) ); } );
+}
 shared_ptr<IFC4X3::IfcArcIndex> IFC4X3::IfcArcIndex::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcArcIndex>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcArcIndex> IFC4X3::IfcArcIndex::createObjectFromSTEP( const
 	readTypeOfIntegerList( arg, type_object->m_vec );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcArcIndex> IFC4X3::IfcArcIndex::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcArcIndex>(); }
+	shared_ptr<IfcArcIndex> type_object( new IfcArcIndex() );
+	readTypeOfIntegerList( arg, type_object->m_vec );
+	return type_object;
+}
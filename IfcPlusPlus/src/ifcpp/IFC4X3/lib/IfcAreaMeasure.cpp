@@ -18,6 +18,10 @@ void IFC4X3::IfcAreaMeasure::getStepParameter( std::stringstream& stream, bool i
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAreaMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcAreaMeasure> IFC4X3::IfcAreaMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAreaMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcAreaMeasure> IFC4X3::IfcAreaMeasure::createObjectFromSTEP(
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAreaMeasure> IFC4X3::IfcAreaMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcAreaMeasure>(); }
+	shared_ptr<IfcAreaMeasure> type_object( new IfcAreaMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcArithmeticOperatorEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcArithmeticOperatorEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcArithmeticOperatorEnum> IFC4X3::IfcArithmeticOperatorEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcArithmeticOperatorEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcArithmeticOperatorEnum> IFC4X3::IfcArithmeticOperatorEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcArithmeticOperatorEnum> IFC4X3::IfcArithmeticOperatorEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_SUBTRACT ) { return shared_ptr<IfcArithmeticOperatorEnum>(); }
+		return shared_ptr<IfcArithmeticOperatorEnum>( new IfcArithmeticOperatorEnum( IfcArithmeticOperatorEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
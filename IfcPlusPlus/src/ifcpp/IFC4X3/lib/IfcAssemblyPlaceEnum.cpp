@@ -21,6 +21,10 @@ void IFC4X3::IfcAssemblyPlaceEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAssemblyPlaceEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAssemblyPlaceEnum> IFC4X3::IfcAssemblyPlaceEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAssemblyPlaceEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcAssemblyPlaceEnum> IFC4X3::IfcAssemblyPlaceEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAssemblyPlaceEnum> IFC4X3::IfcAssemblyPlaceEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcAssemblyPlaceEnum>(); }
+		return shared_ptr<IfcAssemblyPlaceEnum>( new IfcAssemblyPlaceEnum( IfcAssemblyPlaceEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
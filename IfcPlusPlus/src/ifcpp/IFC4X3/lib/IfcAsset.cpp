@@ -79,6 +79,25 @@ void IFC4X3::IfcAsset::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 13 ){readEntityReference( args[13], m_DepreciatedValue, map, errorStream, entityIdNotFound );}
 	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcAsset, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAsset::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_OriginalValue, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_CurrentValue, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_TotalReplacementCost, map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Owner = IfcActorSelect::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_User = IfcActorSelect::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){readEntityReference( args[11], m_ResponsiblePerson, map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_IncorporationDate = IfcDate::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){readEntityReference( args[13], m_DepreciatedValue, map, errorStream, entityIdNotFound );}
+	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcAsset, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAsset::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGroup::getAttributes( vec_attributes );
@@ -96,6 +115,23 @@ void IFC4X3::IfcAsset::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcGroup::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAsset::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributes( visitor );
+	visitor.visitObject( 5, "Identification", m_Identification );
+	visitor.visitObject( 6, "OriginalValue", m_OriginalValue );
+	visitor.visitObject( 7, "CurrentValue", m_CurrentValue );
+	visitor.visitObject( 8, "TotalReplacementCost", m_TotalReplacementCost );
+	visitor.visitObject( 9, "Owner", m_Owner );
+	visitor.visitObject( 10, "User", m_User );
+	visitor.visitObject( 11, "ResponsiblePerson", m_ResponsiblePerson );
+	visitor.visitObject( 12, "IncorporationDate", m_IncorporationDate );
+	visitor.visitObject( 13, "DepreciatedValue", m_DepreciatedValue );
+}
+void IFC4X3::IfcAsset::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAsset::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGroup::setInverseCounterparts( ptr_self_entity );
@@ -104,3 +140,37 @@ void IFC4X3::IfcAsset::unlinkFromInverseCounterparts()
 {
 	IfcGroup::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAsset::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGroup::getEntityReferences( refs );
+	if( m_OriginalValue )
+	{
+		refs.push_back( m_OriginalValue.get() );
+	}
+	if( m_CurrentValue )
+	{
+		refs.push_back( m_CurrentValue.get() );
+	}
+	if( m_TotalReplacementCost )
+	{
+		refs.push_back( m_TotalReplacementCost.get() );
+	}
+	BuildingEntity* Owner_entity = dynamic_cast<BuildingEntity*>( m_Owner.get() );
+	if( Owner_entity )
+	{
+		refs.push_back( Owner_entity );
+	}
+	BuildingEntity* User_entity = dynamic_cast<BuildingEntity*>( m_User.get() );
+	if( User_entity )
+	{
+		refs.push_back( User_entity );
+	}
+	if( m_ResponsiblePerson )
+	{
+		refs.push_back( m_ResponsiblePerson.get() );
+	}
+	if( m_DepreciatedValue )
+	{
+		refs.push_back( m_DepreciatedValue.get() );
+	}
+}
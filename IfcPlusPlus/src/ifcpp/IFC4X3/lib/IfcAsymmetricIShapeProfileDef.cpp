@@ -71,6 +71,26 @@ void IFC4X3::IfcAsymmetricIShapeProfileDef::readStepArguments( const std::vector
 	if( num_args > 14 ){m_TopFlangeSlope = IfcPlaneAngleMeasure::createObjectFromSTEP( args[14], map, errorStream, entityIdNotFound );}
 	if( num_args != 15 ){ errorStream << "Wrong parameter count for entity IfcAsymmetricIShapeProfileDef, expecting 15, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAsymmetricIShapeProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_BottomFlangeWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_OverallDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_WebThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_BottomFlangeThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_BottomFlangeFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_TopFlangeWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_TopFlangeThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_TopFlangeFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_BottomFlangeEdgeRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_BottomFlangeSlope = IfcPlaneAngleMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_TopFlangeEdgeRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_TopFlangeSlope = IfcPlaneAngleMeasure::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args != 15 ){ errorStream << "Wrong parameter count for entity IfcAsymmetricIShapeProfileDef, expecting 15, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAsymmetricIShapeProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributes( vec_attributes );
@@ -91,6 +111,26 @@ void IFC4X3::IfcAsymmetricIShapeProfileDef::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAsymmetricIShapeProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "BottomFlangeWidth", m_BottomFlangeWidth );
+	visitor.visitObject( 4, "OverallDepth", m_OverallDepth );
+	visitor.visitObject( 5, "WebThickness", m_WebThickness );
+	visitor.visitObject( 6, "BottomFlangeThickness", m_BottomFlangeThickness );
+	visitor.visitObject( 7, "BottomFlangeFilletRadius", m_BottomFlangeFilletRadius );
+	visitor.visitObject( 8, "TopFlangeWidth", m_TopFlangeWidth );
+	visitor.visitObject( 9, "TopFlangeThickness", m_TopFlangeThickness );
+	visitor.visitObject( 10, "TopFlangeFilletRadius", m_TopFlangeFilletRadius );
+	visitor.visitObject( 11, "BottomFlangeEdgeRadius", m_BottomFlangeEdgeRadius );
+	visitor.visitObject( 12, "BottomFlangeSlope", m_BottomFlangeSlope );
+	visitor.visitObject( 13, "TopFlangeEdgeRadius", m_TopFlangeEdgeRadius );
+	visitor.visitObject( 14, "TopFlangeSlope", m_TopFlangeSlope );
+}
+void IFC4X3::IfcAsymmetricIShapeProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAsymmetricIShapeProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcParameterizedProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -33,6 +33,10 @@ void IFC4X3::IfcAudioVisualApplianceTypeEnum::getStepParameter( std::stringstrea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcAudioVisualApplianceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcAudioVisualApplianceTypeEnum> IFC4X3::IfcAudioVisualApplianceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcAudioVisualApplianceTypeEnum>(); }
@@ -101,3 +105,12 @@ shared_ptr<IFC4X3::IfcAudioVisualApplianceTypeEnum> IFC4X3::IfcAudioVisualApplia
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcAudioVisualApplianceTypeEnum> IFC4X3::IfcAudioVisualApplianceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcAudioVisualApplianceTypeEnum>(); }
+		return shared_ptr<IfcAudioVisualApplianceTypeEnum>( new IfcAudioVisualApplianceTypeEnum( IfcAudioVisualApplianceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
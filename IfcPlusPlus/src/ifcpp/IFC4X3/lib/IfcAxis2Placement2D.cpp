@@ -28,6 +28,13 @@ void IFC4X3::IfcAxis2Placement2D::readStepArguments( const std::vector<std::stri
 	if( num_args > 1 ){readEntityReference( args[1], m_RefDirection, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAxis2Placement2D, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAxis2Placement2D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Location, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_RefDirection, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcAxis2Placement2D, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAxis2Placement2D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPlacement::getAttributes( vec_attributes );
@@ -37,6 +44,15 @@ void IFC4X3::IfcAxis2Placement2D::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcPlacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAxis2Placement2D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlacement::visitAttributes( visitor );
+	visitor.visitObject( 1, "RefDirection", m_RefDirection );
+}
+void IFC4X3::IfcAxis2Placement2D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAxis2Placement2D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPlacement::setInverseCounterparts( ptr_self_entity );
@@ -45,3 +61,11 @@ void IFC4X3::IfcAxis2Placement2D::unlinkFromInverseCounterparts()
 {
 	IfcPlacement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAxis2Placement2D::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPlacement::getEntityReferences( refs );
+	if( m_RefDirection )
+	{
+		refs.push_back( m_RefDirection.get() );
+	}
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcAxis2Placement3D::readStepArguments( const std::vector<std::stri
 	if( num_args > 2 ){readEntityReference( args[2], m_RefDirection, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAxis2Placement3D, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcAxis2Placement3D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Location, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Axis, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RefDirection, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcAxis2Placement3D, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcAxis2Placement3D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPlacement::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcAxis2Placement3D::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcPlacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcAxis2Placement3D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlacement::visitAttributes( visitor );
+	visitor.visitObject( 1, "Axis", m_Axis );
+	visitor.visitObject( 2, "RefDirection", m_RefDirection );
+}
+void IFC4X3::IfcAxis2Placement3D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcAxis2Placement3D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPlacement::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +67,15 @@ void IFC4X3::IfcAxis2Placement3D::unlinkFromInverseCounterparts()
 {
 	IfcPlacement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcAxis2Placement3D::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPlacement::getEntityReferences( refs );
+	if( m_Axis )
+	{
+		refs.push_back( m_Axis.get() );
+	}
+	if( m_RefDirection )
+	{
+		refs.push_back( m_RefDirection.get() );
+	}
+}
@@ -39,6 +39,16 @@ void IFC4X3::IfcBSplineCurve::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcBSplineCurve, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBSplineCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Degree = IfcInteger::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_ControlPointsList, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CurveForm = IfcBSplineCurveForm::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ClosedCurve = IfcLogical::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcBSplineCurve, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBSplineCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedCurve::getAttributes( vec_attributes );
@@ -54,6 +64,19 @@ void IFC4X3::IfcBSplineCurve::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcBoundedCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBSplineCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Degree", m_Degree );
+	visitor.visitList( 1, "ControlPointsList", AttributeVectorView<IfcCartesianPoint>( m_ControlPointsList ) );
+	visitor.visitObject( 2, "CurveForm", m_CurveForm );
+	visitor.visitObject( 3, "ClosedCurve", m_ClosedCurve );
+	visitor.visitObject( 4, "SelfIntersect", m_SelfIntersect );
+}
+void IFC4X3::IfcBSplineCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBSplineCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedCurve::setInverseCounterparts( ptr_self_entity );
@@ -62,3 +85,14 @@ void IFC4X3::IfcBSplineCurve::unlinkFromInverseCounterparts()
 {
 	IfcBoundedCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBSplineCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedCurve::getEntityReferences( refs );
+	for( size_t i=0; i<m_ControlPointsList.size(); ++i )
+	{
+		if( m_ControlPointsList[i] )
+		{
+			refs.push_back( m_ControlPointsList[i].get() );
+		}
+	}
+}
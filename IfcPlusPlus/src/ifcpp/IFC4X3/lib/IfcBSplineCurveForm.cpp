@@ -24,6 +24,10 @@ void IFC4X3::IfcBSplineCurveForm::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBSplineCurveForm::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBSplineCurveForm> IFC4X3::IfcBSplineCurveForm::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBSplineCurveForm>(); }
@@ -56,3 +60,12 @@ shared_ptr<IFC4X3::IfcBSplineCurveForm> IFC4X3::IfcBSplineCurveForm::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBSplineCurveForm> IFC4X3::IfcBSplineCurveForm::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UNSPECIFIED ) { return shared_ptr<IfcBSplineCurveForm>(); }
+		return shared_ptr<IfcBSplineCurveForm>( new IfcBSplineCurveForm( IfcBSplineCurveFormEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
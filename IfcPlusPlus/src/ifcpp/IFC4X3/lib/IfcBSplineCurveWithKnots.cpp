@@ -50,6 +50,19 @@ void IFC4X3::IfcBSplineCurveWithKnots::readStepArguments( const std::vector<std:
 	if( num_args > 7 ){m_KnotSpec = IfcKnotType::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcBSplineCurveWithKnots, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBSplineCurveWithKnots::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Degree = IfcInteger::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_ControlPointsList, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CurveForm = IfcBSplineCurveForm::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ClosedCurve = IfcLogical::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readTypeOfIntegerList( args[5], m_KnotMultiplicities );}
+	if( num_args > 6 ){readTypeOfRealList( args[6], m_Knots );}
+	if( num_args > 7 ){m_KnotSpec = IfcKnotType::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcBSplineCurveWithKnots, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBSplineCurveWithKnots::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBSplineCurve::getAttributes( vec_attributes );
@@ -65,6 +78,17 @@ void IFC4X3::IfcBSplineCurveWithKnots::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcBSplineCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBSplineCurveWithKnots::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineCurve::visitAttributes( visitor );
+	visitor.visitList( 5, "KnotMultiplicities", AttributeVectorView<IfcInteger>( m_KnotMultiplicities ) );
+	visitor.visitList( 6, "Knots", AttributeVectorView<IfcParameterValue>( m_Knots ) );
+	visitor.visitObject( 7, "KnotSpec", m_KnotSpec );
+}
+void IFC4X3::IfcBSplineCurveWithKnots::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBSplineCurveWithKnots::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBSplineCurve::setInverseCounterparts( ptr_self_entity );
@@ -45,6 +45,18 @@ void IFC4X3::IfcBSplineSurface::readStepArguments( const std::vector<std::string
 	if( num_args > 6 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBSplineSurface, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBSplineSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_UDegree = IfcInteger::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_VDegree = IfcInteger::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList2D( args[2], m_ControlPointsList, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SurfaceForm = IfcBSplineSurfaceForm::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_UClosed = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_VClosed = IfcLogical::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBSplineSurface, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBSplineSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedSurface::getAttributes( vec_attributes );
@@ -68,6 +80,21 @@ void IFC4X3::IfcBSplineSurface::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcBoundedSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBSplineSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "UDegree", m_UDegree );
+	visitor.visitObject( 1, "VDegree", m_VDegree );
+	visitor.visitList2D( 2, "ControlPointsList", AttributeVector2DView<IfcCartesianPoint>( m_ControlPointsList ) );
+	visitor.visitObject( 3, "SurfaceForm", m_SurfaceForm );
+	visitor.visitObject( 4, "UClosed", m_UClosed );
+	visitor.visitObject( 5, "VClosed", m_VClosed );
+	visitor.visitObject( 6, "SelfIntersect", m_SelfIntersect );
+}
+void IFC4X3::IfcBSplineSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBSplineSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedSurface::setInverseCounterparts( ptr_self_entity );
@@ -76,3 +103,17 @@ void IFC4X3::IfcBSplineSurface::unlinkFromInverseCounterparts()
 {
 	IfcBoundedSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBSplineSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedSurface::getEntityReferences( refs );
+	for( size_t i=0; i<m_ControlPointsList.size(); ++i )
+	{
+		for( size_t j=0; j<m_ControlPointsList[i].size(); ++j )
+		{
+			if( m_ControlPointsList[i][j] )
+			{
+				refs.push_back( m_ControlPointsList[i][j].get() );
+			}
+		}
+	}
+}
@@ -29,6 +29,10 @@ void IFC4X3::IfcBSplineSurfaceForm::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBSplineSurfaceForm::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBSplineSurfaceForm> IFC4X3::IfcBSplineSurfaceForm::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBSplineSurfaceForm>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcBSplineSurfaceForm> IFC4X3::IfcBSplineSurfaceForm::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBSplineSurfaceForm> IFC4X3::IfcBSplineSurfaceForm::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UNSPECIFIED ) { return shared_ptr<IfcBSplineSurfaceForm>(); }
+		return shared_ptr<IfcBSplineSurfaceForm>( new IfcBSplineSurfaceForm( IfcBSplineSurfaceFormEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -62,6 +62,23 @@ void IFC4X3::IfcBSplineSurfaceWithKnots::readStepArguments( const std::vector<st
 	if( num_args > 11 ){m_KnotSpec = IfcKnotType::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcBSplineSurfaceWithKnots, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBSplineSurfaceWithKnots::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_UDegree = IfcInteger::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_VDegree = IfcInteger::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList2D( args[2], m_ControlPointsList, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SurfaceForm = IfcBSplineSurfaceForm::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_UClosed = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_VClosed = IfcLogical::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readTypeOfIntegerList( args[7], m_UMultiplicities );}
+	if( num_args > 8 ){readTypeOfIntegerList( args[8], m_VMultiplicities );}
+	if( num_args > 9 ){readTypeOfRealList( args[9], m_UKnots );}
+	if( num_args > 10 ){readTypeOfRealList( args[10], m_VKnots );}
+	if( num_args > 11 ){m_KnotSpec = IfcKnotType::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcBSplineSurfaceWithKnots, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBSplineSurfaceWithKnots::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBSplineSurface::getAttributes( vec_attributes );
@@ -83,6 +100,19 @@ void IFC4X3::IfcBSplineSurfaceWithKnots::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcBSplineSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBSplineSurfaceWithKnots::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineSurface::visitAttributes( visitor );
+	visitor.visitList( 7, "UMultiplicities", AttributeVectorView<IfcInteger>( m_UMultiplicities ) );
+	visitor.visitList( 8, "VMultiplicities", AttributeVectorView<IfcInteger>( m_VMultiplicities ) );
+	visitor.visitList( 9, "UKnots", AttributeVectorView<IfcParameterValue>( m_UKnots ) );
+	visitor.visitList( 10, "VKnots", AttributeVectorView<IfcParameterValue>( m_VKnots ) );
+	visitor.visitObject( 11, "KnotSpec", m_KnotSpec );
+}
+void IFC4X3::IfcBSplineSurfaceWithKnots::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBSplineSurfaceWithKnots::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBSplineSurface::setInverseCounterparts( ptr_self_entity );
@@ -32,6 +32,10 @@ void IFC4X3::IfcBeamTypeEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBeamTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBeamTypeEnum> IFC4X3::IfcBeamTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBeamTypeEnum>(); }
@@ -96,3 +100,12 @@ shared_ptr<IFC4X3::IfcBeamTypeEnum> IFC4X3::IfcBeamTypeEnum::createObjectFromSTE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBeamTypeEnum> IFC4X3::IfcBeamTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBeamTypeEnum>(); }
+		return shared_ptr<IfcBeamTypeEnum>( new IfcBeamTypeEnum( IfcBeamTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -28,6 +28,10 @@ void IFC4X3::IfcBenchmarkEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBenchmarkEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBenchmarkEnum> IFC4X3::IfcBenchmarkEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBenchmarkEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcBenchmarkEnum> IFC4X3::IfcBenchmarkEnum::createObjectFromS
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBenchmarkEnum> IFC4X3::IfcBenchmarkEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTINCLUDES ) { return shared_ptr<IfcBenchmarkEnum>(); }
+		return shared_ptr<IfcBenchmarkEnum>( new IfcBenchmarkEnum( IfcBenchmarkEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
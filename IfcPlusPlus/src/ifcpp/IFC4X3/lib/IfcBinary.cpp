@@ -27,3 +27,7 @@ shared_ptr<IFC4X3::IfcBinary> IFC4X3::IfcBinary::createObjectFromSTEP( const std
 	readBinaryString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBinary> IFC4X3::IfcBinary::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
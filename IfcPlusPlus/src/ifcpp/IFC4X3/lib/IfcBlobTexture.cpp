@@ -66,6 +66,18 @@ void IFC4X3::IfcBlobTexture::readStepArguments( const std::vector<std::string>&
 	if( num_args > 6 ){m_RasterCode = IfcBinary::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBlobTexture, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBlobTexture::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_RepeatS = IfcBoolean::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepeatT = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Mode = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_TextureTransform, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_Parameter );}
+	if( num_args > 5 ){m_RasterFormat = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RasterCode = IfcBinary::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBlobTexture, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBlobTexture::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurfaceTexture::getAttributes( vec_attributes );
@@ -76,6 +88,16 @@ void IFC4X3::IfcBlobTexture::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcSurfaceTexture::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBlobTexture::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceTexture::visitAttributes( visitor );
+	visitor.visitObject( 5, "RasterFormat", m_RasterFormat );
+	visitor.visitObject( 6, "RasterCode", m_RasterCode );
+}
+void IFC4X3::IfcBlobTexture::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceTexture::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBlobTexture::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurfaceTexture::setInverseCounterparts( ptr_self_entity );
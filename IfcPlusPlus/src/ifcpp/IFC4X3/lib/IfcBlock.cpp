@@ -34,6 +34,15 @@ void IFC4X3::IfcBlock::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 3 ){m_ZLength = IfcPositiveLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBlock, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBlock::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_XLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_YLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ZLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBlock, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBlock::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributes( vec_attributes );
@@ -45,6 +54,17 @@ void IFC4X3::IfcBlock::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBlock::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributes( visitor );
+	visitor.visitObject( 1, "XLength", m_XLength );
+	visitor.visitObject( 2, "YLength", m_YLength );
+	visitor.visitObject( 3, "ZLength", m_ZLength );
+}
+void IFC4X3::IfcBlock::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBlock::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCsgPrimitive3D::setInverseCounterparts( ptr_self_entity );
@@ -22,6 +22,10 @@ void IFC4X3::IfcBoilerTypeEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBoilerTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBoilerTypeEnum> IFC4X3::IfcBoilerTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBoilerTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcBoilerTypeEnum> IFC4X3::IfcBoilerTypeEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBoilerTypeEnum> IFC4X3::IfcBoilerTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBoilerTypeEnum>(); }
+		return shared_ptr<IfcBoilerTypeEnum>( new IfcBoilerTypeEnum( IfcBoilerTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -31,6 +31,10 @@ void IFC4X3::IfcBoolean::getStepParameter( std::stringstream& stream, bool is_se
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBoolean::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeBool( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcBoolean> IFC4X3::IfcBoolean::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBoolean>(); }
@@ -40,3 +44,10 @@ shared_ptr<IFC4X3::IfcBoolean> IFC4X3::IfcBoolean::createObjectFromSTEP( const s
 	readBool( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBoolean> IFC4X3::IfcBoolean::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcBoolean>(); }
+	shared_ptr<IfcBoolean> type_object( new IfcBoolean() );
+	readBool( arg, type_object->m_value );
+	return type_object;
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcBooleanClippingResult::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){m_SecondOperand = IfcBooleanOperand::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBooleanClippingResult, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBooleanClippingResult::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Operator = IfcBooleanOperator::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_FirstOperand = IfcBooleanOperand::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SecondOperand = IfcBooleanOperand::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBooleanClippingResult, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBooleanClippingResult::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBooleanResult::getAttributes( vec_attributes );
@@ -39,6 +47,14 @@ void IFC4X3::IfcBooleanClippingResult::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcBooleanResult::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBooleanClippingResult::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBooleanResult::visitAttributes( visitor );
+}
+void IFC4X3::IfcBooleanClippingResult::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBooleanResult::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBooleanClippingResult::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBooleanResult::setInverseCounterparts( ptr_self_entity );
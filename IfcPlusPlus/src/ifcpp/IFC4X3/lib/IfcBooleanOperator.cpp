@@ -21,6 +21,10 @@ void IFC4X3::IfcBooleanOperator::getStepParameter( std::stringstream& stream, bo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBooleanOperator::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBooleanOperator> IFC4X3::IfcBooleanOperator::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBooleanOperator>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcBooleanOperator> IFC4X3::IfcBooleanOperator::createObjectF
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBooleanOperator> IFC4X3::IfcBooleanOperator::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UNION ) { return shared_ptr<IfcBooleanOperator>(); }
+		return shared_ptr<IfcBooleanOperator>( new IfcBooleanOperator( IfcBooleanOperatorEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
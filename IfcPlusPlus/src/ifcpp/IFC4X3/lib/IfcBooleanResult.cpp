@@ -31,6 +31,14 @@ void IFC4X3::IfcBooleanResult::readStepArguments( const std::vector<std::string>
 	if( num_args > 2 ){m_SecondOperand = IfcBooleanOperand::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBooleanResult, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBooleanResult::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Operator = IfcBooleanOperator::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_FirstOperand = IfcBooleanOperand::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SecondOperand = IfcBooleanOperand::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBooleanResult, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBooleanResult::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -42,6 +50,17 @@ void IFC4X3::IfcBooleanResult::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBooleanResult::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Operator", m_Operator );
+	visitor.visitObject( 1, "FirstOperand", m_FirstOperand );
+	visitor.visitObject( 2, "SecondOperand", m_SecondOperand );
+}
+void IFC4X3::IfcBooleanResult::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBooleanResult::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -50,3 +69,17 @@ void IFC4X3::IfcBooleanResult::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBooleanResult::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	BuildingEntity* FirstOperand_entity = dynamic_cast<BuildingEntity*>( m_FirstOperand.get() );
+	if( FirstOperand_entity )
+	{
+		refs.push_back( FirstOperand_entity );
+	}
+	BuildingEntity* SecondOperand_entity = dynamic_cast<BuildingEntity*>( m_SecondOperand.get() );
+	if( SecondOperand_entity )
+	{
+		refs.push_back( SecondOperand_entity );
+	}
+}
@@ -22,6 +22,12 @@ void IFC4X3::IfcBoundaryCondition::readStepArguments( const std::vector<std::str
 	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcBoundaryCondition, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundaryCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcBoundaryCondition, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundaryCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -29,6 +35,13 @@ void IFC4X3::IfcBoundaryCondition::getAttributes( std::vector<std::pair<std::str
 void IFC4X3::IfcBoundaryCondition::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcBoundaryCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+}
+void IFC4X3::IfcBoundaryCondition::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcBoundaryCondition::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -42,6 +42,18 @@ void IFC4X3::IfcBoundaryEdgeCondition::readStepArguments( const std::vector<std:
 	if( num_args > 6 ){m_RotationalStiffnessByLengthZ = IfcModulusOfRotationalSubgradeReactionSelect::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBoundaryEdgeCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundaryEdgeCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TranslationalStiffnessByLengthX = IfcModulusOfTranslationalSubgradeReactionSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TranslationalStiffnessByLengthY = IfcModulusOfTranslationalSubgradeReactionSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TranslationalStiffnessByLengthZ = IfcModulusOfTranslationalSubgradeReactionSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RotationalStiffnessByLengthX = IfcModulusOfRotationalSubgradeReactionSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RotationalStiffnessByLengthY = IfcModulusOfRotationalSubgradeReactionSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RotationalStiffnessByLengthZ = IfcModulusOfRotationalSubgradeReactionSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBoundaryEdgeCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundaryEdgeCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundaryCondition::getAttributes( vec_attributes );
@@ -56,6 +68,20 @@ void IFC4X3::IfcBoundaryEdgeCondition::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcBoundaryCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundaryEdgeCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributes( visitor );
+	visitor.visitObject( 1, "TranslationalStiffnessByLengthX", m_TranslationalStiffnessByLengthX );
+	visitor.visitObject( 2, "TranslationalStiffnessByLengthY", m_TranslationalStiffnessByLengthY );
+	visitor.visitObject( 3, "TranslationalStiffnessByLengthZ", m_TranslationalStiffnessByLengthZ );
+	visitor.visitObject( 4, "RotationalStiffnessByLengthX", m_RotationalStiffnessByLengthX );
+	visitor.visitObject( 5, "RotationalStiffnessByLengthY", m_RotationalStiffnessByLengthY );
+	visitor.visitObject( 6, "RotationalStiffnessByLengthZ", m_RotationalStiffnessByLengthZ );
+}
+void IFC4X3::IfcBoundaryEdgeCondition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundaryEdgeCondition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundaryCondition::setInverseCounterparts( ptr_self_entity );
@@ -32,6 +32,15 @@ void IFC4X3::IfcBoundaryFaceCondition::readStepArguments( const std::vector<std:
 	if( num_args > 3 ){m_TranslationalStiffnessByAreaZ = IfcModulusOfSubgradeReactionSelect::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBoundaryFaceCondition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundaryFaceCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TranslationalStiffnessByAreaX = IfcModulusOfSubgradeReactionSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TranslationalStiffnessByAreaY = IfcModulusOfSubgradeReactionSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TranslationalStiffnessByAreaZ = IfcModulusOfSubgradeReactionSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBoundaryFaceCondition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundaryFaceCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundaryCondition::getAttributes( vec_attributes );
@@ -43,6 +52,17 @@ void IFC4X3::IfcBoundaryFaceCondition::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcBoundaryCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundaryFaceCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributes( visitor );
+	visitor.visitObject( 1, "TranslationalStiffnessByAreaX", m_TranslationalStiffnessByAreaX );
+	visitor.visitObject( 2, "TranslationalStiffnessByAreaY", m_TranslationalStiffnessByAreaY );
+	visitor.visitObject( 3, "TranslationalStiffnessByAreaZ", m_TranslationalStiffnessByAreaZ );
+}
+void IFC4X3::IfcBoundaryFaceCondition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundaryFaceCondition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundaryCondition::setInverseCounterparts( ptr_self_entity );
@@ -42,6 +42,18 @@ void IFC4X3::IfcBoundaryNodeCondition::readStepArguments( const std::vector<std:
 	if( num_args > 6 ){m_RotationalStiffnessZ = IfcRotationalStiffnessSelect::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBoundaryNodeCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundaryNodeCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TranslationalStiffnessX = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TranslationalStiffnessY = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TranslationalStiffnessZ = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RotationalStiffnessX = IfcRotationalStiffnessSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RotationalStiffnessY = IfcRotationalStiffnessSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RotationalStiffnessZ = IfcRotationalStiffnessSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBoundaryNodeCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundaryNodeCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundaryCondition::getAttributes( vec_attributes );
@@ -56,6 +68,20 @@ void IFC4X3::IfcBoundaryNodeCondition::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcBoundaryCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundaryNodeCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributes( visitor );
+	visitor.visitObject( 1, "TranslationalStiffnessX", m_TranslationalStiffnessX );
+	visitor.visitObject( 2, "TranslationalStiffnessY", m_TranslationalStiffnessY );
+	visitor.visitObject( 3, "TranslationalStiffnessZ", m_TranslationalStiffnessZ );
+	visitor.visitObject( 4, "RotationalStiffnessX", m_RotationalStiffnessX );
+	visitor.visitObject( 5, "RotationalStiffnessY", m_RotationalStiffnessY );
+	visitor.visitObject( 6, "RotationalStiffnessZ", m_RotationalStiffnessZ );
+}
+void IFC4X3::IfcBoundaryNodeCondition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundaryNodeCondition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundaryCondition::setInverseCounterparts( ptr_self_entity );
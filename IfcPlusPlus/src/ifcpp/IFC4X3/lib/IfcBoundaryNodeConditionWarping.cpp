@@ -46,6 +46,19 @@ void IFC4X3::IfcBoundaryNodeConditionWarping::readStepArguments( const std::vect
 	if( num_args > 7 ){m_WarpingStiffness = IfcWarpingStiffnessSelect::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcBoundaryNodeConditionWarping, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundaryNodeConditionWarping::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TranslationalStiffnessX = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TranslationalStiffnessY = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TranslationalStiffnessZ = IfcTranslationalStiffnessSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RotationalStiffnessX = IfcRotationalStiffnessSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RotationalStiffnessY = IfcRotationalStiffnessSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RotationalStiffnessZ = IfcRotationalStiffnessSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_WarpingStiffness = IfcWarpingStiffnessSelect::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcBoundaryNodeConditionWarping, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundaryNodeConditionWarping::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundaryNodeCondition::getAttributes( vec_attributes );
@@ -55,6 +68,15 @@ void IFC4X3::IfcBoundaryNodeConditionWarping::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcBoundaryNodeCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundaryNodeConditionWarping::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryNodeCondition::visitAttributes( visitor );
+	visitor.visitObject( 7, "WarpingStiffness", m_WarpingStiffness );
+}
+void IFC4X3::IfcBoundaryNodeConditionWarping::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryNodeCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundaryNodeConditionWarping::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundaryNodeCondition::setInverseCounterparts( ptr_self_entity );
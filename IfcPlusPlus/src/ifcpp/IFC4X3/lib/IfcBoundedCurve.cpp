@@ -19,6 +19,9 @@ void IFC4X3::IfcBoundedCurve::getStepParameter( std::stringstream& stream, bool
 void IFC4X3::IfcBoundedCurve::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcBoundedCurve::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcBoundedCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -27,6 +30,14 @@ void IFC4X3::IfcBoundedCurve::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundedCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+}
+void IFC4X3::IfcBoundedCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundedCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
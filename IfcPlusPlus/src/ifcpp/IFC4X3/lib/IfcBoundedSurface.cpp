@@ -19,6 +19,9 @@ void IFC4X3::IfcBoundedSurface::getStepParameter( std::stringstream& stream, boo
 void IFC4X3::IfcBoundedSurface::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcBoundedSurface::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcBoundedSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurface::getAttributes( vec_attributes );
@@ -27,6 +30,14 @@ void IFC4X3::IfcBoundedSurface::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundedSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributes( visitor );
+}
+void IFC4X3::IfcBoundedSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundedSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurface::setInverseCounterparts( ptr_self_entity );
@@ -34,6 +34,15 @@ void IFC4X3::IfcBoundingBox::readStepArguments( const std::vector<std::string>&
 	if( num_args > 3 ){m_ZDim = IfcPositiveLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBoundingBox, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoundingBox::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Corner, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_XDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_YDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ZDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcBoundingBox, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoundingBox::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -46,6 +55,18 @@ void IFC4X3::IfcBoundingBox::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoundingBox::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Corner", m_Corner );
+	visitor.visitObject( 1, "XDim", m_XDim );
+	visitor.visitObject( 2, "YDim", m_YDim );
+	visitor.visitObject( 3, "ZDim", m_ZDim );
+}
+void IFC4X3::IfcBoundingBox::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoundingBox::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +75,11 @@ void IFC4X3::IfcBoundingBox::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBoundingBox::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	if( m_Corner )
+	{
+		refs.push_back( m_Corner.get() );
+	}
+}
@@ -25,3 +25,10 @@ shared_ptr<IFC4X3::IfcBoxAlignment> IFC4X3::IfcBoxAlignment::createObjectFromSTE
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBoxAlignment> IFC4X3::IfcBoxAlignment::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcBoxAlignment>(); }
+	shared_ptr<IfcBoxAlignment> type_object( new IfcBoxAlignment() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -32,6 +32,14 @@ void IFC4X3::IfcBoxedHalfSpace::readStepArguments( const std::vector<std::string
 	if( num_args > 2 ){readEntityReference( args[2], m_Enclosure, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBoxedHalfSpace, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBoxedHalfSpace::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BaseSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_AgreementFlag = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Enclosure, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcBoxedHalfSpace, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBoxedHalfSpace::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcHalfSpaceSolid::getAttributes( vec_attributes );
@@ -41,6 +49,15 @@ void IFC4X3::IfcBoxedHalfSpace::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcHalfSpaceSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBoxedHalfSpace::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcHalfSpaceSolid::visitAttributes( visitor );
+	visitor.visitObject( 2, "Enclosure", m_Enclosure );
+}
+void IFC4X3::IfcBoxedHalfSpace::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcHalfSpaceSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBoxedHalfSpace::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcHalfSpaceSolid::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +66,11 @@ void IFC4X3::IfcBoxedHalfSpace::unlinkFromInverseCounterparts()
 {
 	IfcHalfSpaceSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBoxedHalfSpace::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcHalfSpaceSolid::getEntityReferences( refs );
+	if( m_Enclosure )
+	{
+		refs.push_back( m_Enclosure.get() );
+	}
+}
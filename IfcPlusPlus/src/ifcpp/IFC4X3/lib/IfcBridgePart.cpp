@@ -74,6 +74,22 @@ void IFC4X3::IfcBridgePart::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 10 ){m_PredefinedType = IfcBridgePartTypeEnum::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcBridgePart, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBridgePart::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_CompositionType = IfcElementCompositionEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_UsageType = IfcFacilityUsageEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_PredefinedType = IfcBridgePartTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcBridgePart, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBridgePart::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFacilityPart::getAttributes( vec_attributes );
@@ -83,6 +99,15 @@ void IFC4X3::IfcBridgePart::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcFacilityPart::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBridgePart::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacilityPart::visitAttributes( visitor );
+	visitor.visitObject( 10, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcBridgePart::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacilityPart::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBridgePart::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFacilityPart::setInverseCounterparts( ptr_self_entity );
@@ -30,6 +30,10 @@ void IFC4X3::IfcBridgePartTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBridgePartTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBridgePartTypeEnum> IFC4X3::IfcBridgePartTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBridgePartTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcBridgePartTypeEnum> IFC4X3::IfcBridgePartTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBridgePartTypeEnum> IFC4X3::IfcBridgePartTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBridgePartTypeEnum>(); }
+		return shared_ptr<IfcBridgePartTypeEnum>( new IfcBridgePartTypeEnum( IfcBridgePartTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
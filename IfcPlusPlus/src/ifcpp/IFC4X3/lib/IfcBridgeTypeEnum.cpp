@@ -28,6 +28,10 @@ void IFC4X3::IfcBridgeTypeEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBridgeTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBridgeTypeEnum> IFC4X3::IfcBridgeTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBridgeTypeEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcBridgeTypeEnum> IFC4X3::IfcBridgeTypeEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBridgeTypeEnum> IFC4X3::IfcBridgeTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBridgeTypeEnum>(); }
+		return shared_ptr<IfcBridgeTypeEnum>( new IfcBridgeTypeEnum( IfcBridgeTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -77,6 +77,23 @@ void IFC4X3::IfcBuilding::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 11 ){readEntityReference( args[11], m_BuildingAddress, map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcBuilding, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBuilding::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_CompositionType = IfcElementCompositionEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_ElevationOfRefHeight = IfcLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_ElevationOfTerrain = IfcLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){readEntityReference( args[11], m_BuildingAddress, map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcBuilding, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBuilding::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFacility::getAttributes( vec_attributes );
@@ -88,6 +105,17 @@ void IFC4X3::IfcBuilding::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcFacility::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBuilding::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacility::visitAttributes( visitor );
+	visitor.visitObject( 9, "ElevationOfRefHeight", m_ElevationOfRefHeight );
+	visitor.visitObject( 10, "ElevationOfTerrain", m_ElevationOfTerrain );
+	visitor.visitObject( 11, "BuildingAddress", m_BuildingAddress );
+}
+void IFC4X3::IfcBuilding::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacility::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBuilding::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFacility::setInverseCounterparts( ptr_self_entity );
@@ -96,3 +124,11 @@ void IFC4X3::IfcBuilding::unlinkFromInverseCounterparts()
 {
 	IfcFacility::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcBuilding::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcFacility::getEntityReferences( refs );
+	if( m_BuildingAddress )
+	{
+		refs.push_back( m_BuildingAddress.get() );
+	}
+}
@@ -25,6 +25,10 @@ void IFC4X3::IfcBuildingElementPartTypeEnum::getStepParameter( std::stringstream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBuildingElementPartTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBuildingElementPartTypeEnum> IFC4X3::IfcBuildingElementPartTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBuildingElementPartTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcBuildingElementPartTypeEnum> IFC4X3::IfcBuildingElementPar
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBuildingElementPartTypeEnum> IFC4X3::IfcBuildingElementPartTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBuildingElementPartTypeEnum>(); }
+		return shared_ptr<IfcBuildingElementPartTypeEnum>( new IfcBuildingElementPartTypeEnum( IfcBuildingElementPartTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
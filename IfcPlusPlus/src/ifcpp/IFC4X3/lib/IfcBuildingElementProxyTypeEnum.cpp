@@ -25,6 +25,10 @@ void IFC4X3::IfcBuildingElementProxyTypeEnum::getStepParameter( std::stringstrea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBuildingElementProxyTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBuildingElementProxyTypeEnum> IFC4X3::IfcBuildingElementProxyTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBuildingElementProxyTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcBuildingElementProxyTypeEnum> IFC4X3::IfcBuildingElementPr
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBuildingElementProxyTypeEnum> IFC4X3::IfcBuildingElementProxyTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBuildingElementProxyTypeEnum>(); }
+		return shared_ptr<IfcBuildingElementProxyTypeEnum>( new IfcBuildingElementProxyTypeEnum( IfcBuildingElementProxyTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -70,6 +70,21 @@ void IFC4X3::IfcBuildingStorey::readStepArguments( const std::vector<std::string
 	if( num_args > 9 ){m_Elevation = IfcLengthMeasure::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcBuildingStorey, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBuildingStorey::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_CompositionType = IfcElementCompositionEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Elevation = IfcLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcBuildingStorey, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBuildingStorey::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpatialStructureElement::getAttributes( vec_attributes );
@@ -79,6 +94,15 @@ void IFC4X3::IfcBuildingStorey::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSpatialStructureElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBuildingStorey::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialStructureElement::visitAttributes( visitor );
+	visitor.visitObject( 9, "Elevation", m_Elevation );
+}
+void IFC4X3::IfcBuildingStorey::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialStructureElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBuildingStorey::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpatialStructureElement::setInverseCounterparts( ptr_self_entity );
@@ -55,6 +55,18 @@ void IFC4X3::IfcBuildingSystem::readStepArguments( const std::vector<std::string
 	if( num_args > 6 ){m_LongName = IfcLabel::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBuildingSystem, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcBuildingSystem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PredefinedType = IfcBuildingSystemTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongName = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcBuildingSystem, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcBuildingSystem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSystem::getAttributes( vec_attributes );
@@ -65,6 +77,16 @@ void IFC4X3::IfcBuildingSystem::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcBuildingSystem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributes( visitor );
+	visitor.visitObject( 5, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 6, "LongName", m_LongName );
+}
+void IFC4X3::IfcBuildingSystem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcBuildingSystem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSystem::setInverseCounterparts( ptr_self_entity );
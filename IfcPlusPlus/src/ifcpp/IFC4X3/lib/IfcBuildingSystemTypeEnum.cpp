@@ -26,6 +26,10 @@ void IFC4X3::IfcBuildingSystemTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBuildingSystemTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBuildingSystemTypeEnum> IFC4X3::IfcBuildingSystemTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBuildingSystemTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcBuildingSystemTypeEnum> IFC4X3::IfcBuildingSystemTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBuildingSystemTypeEnum> IFC4X3::IfcBuildingSystemTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBuildingSystemTypeEnum>(); }
+		return shared_ptr<IfcBuildingSystemTypeEnum>( new IfcBuildingSystemTypeEnum( IfcBuildingSystemTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -20,6 +20,10 @@ void IFC4X3::IfcBurnerTypeEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcBurnerTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcBurnerTypeEnum> IFC4X3::IfcBurnerTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcBurnerTypeEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcBurnerTypeEnum> IFC4X3::IfcBurnerTypeEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcBurnerTypeEnum> IFC4X3::IfcBurnerTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcBurnerTypeEnum>(); }
+		return shared_ptr<IfcBurnerTypeEnum>( new IfcBurnerTypeEnum( IfcBurnerTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
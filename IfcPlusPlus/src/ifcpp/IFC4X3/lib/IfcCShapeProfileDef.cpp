@@ -49,6 +49,19 @@ void IFC4X3::IfcCShapeProfileDef::readStepArguments( const std::vector<std::stri
 	if( num_args > 7 ){m_InternalFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcCShapeProfileDef, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCShapeProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Depth = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Width = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_WallThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Girth = IfcPositiveLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_InternalFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcCShapeProfileDef, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCShapeProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributes( vec_attributes );
@@ -62,6 +75,19 @@ void IFC4X3::IfcCShapeProfileDef::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCShapeProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "Depth", m_Depth );
+	visitor.visitObject( 4, "Width", m_Width );
+	visitor.visitObject( 5, "WallThickness", m_WallThickness );
+	visitor.visitObject( 6, "Girth", m_Girth );
+	visitor.visitObject( 7, "InternalFilletRadius", m_InternalFilletRadius );
+}
+void IFC4X3::IfcCShapeProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCShapeProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcParameterizedProfileDef::setInverseCounterparts( ptr_self_entity );
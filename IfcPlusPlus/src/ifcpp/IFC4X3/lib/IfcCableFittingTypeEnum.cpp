@@ -26,6 +26,10 @@ void IFC4X3::IfcCableFittingTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCableFittingTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCableFittingTypeEnum> IFC4X3::IfcCableFittingTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCableFittingTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcCableFittingTypeEnum> IFC4X3::IfcCableFittingTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCableFittingTypeEnum> IFC4X3::IfcCableFittingTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCableFittingTypeEnum>(); }
+		return shared_ptr<IfcCableFittingTypeEnum>( new IfcCableFittingTypeEnum( IfcCableFittingTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -22,6 +22,10 @@ void IFC4X3::IfcCaissonFoundationTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCaissonFoundationTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCaissonFoundationTypeEnum> IFC4X3::IfcCaissonFoundationTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCaissonFoundationTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcCaissonFoundationTypeEnum> IFC4X3::IfcCaissonFoundationTyp
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCaissonFoundationTypeEnum> IFC4X3::IfcCaissonFoundationTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCaissonFoundationTypeEnum>(); }
+		return shared_ptr<IfcCaissonFoundationTypeEnum>( new IfcCaissonFoundationTypeEnum( IfcCaissonFoundationTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
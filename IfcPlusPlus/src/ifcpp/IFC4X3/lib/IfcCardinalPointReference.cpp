@@ -17,6 +17,10 @@ void IFC4X3::IfcCardinalPointReference::getStepParameter( std::stringstream& str
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCardinalPointReference::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcCardinalPointReference> IFC4X3::IfcCardinalPointReference::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCardinalPointReference>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcCardinalPointReference> IFC4X3::IfcCardinalPointReference:
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCardinalPointReference> IFC4X3::IfcCardinalPointReference::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcCardinalPointReference>(); }
+	shared_ptr<IfcCardinalPointReference> type_object( new IfcCardinalPointReference() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -30,6 +30,12 @@ void IFC4X3::IfcCartesianPoint::readStepArguments( const std::vector<std::string
 	if( num_args > 0 ){readRealArray( args[0], m_Coordinates );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcCartesianPoint, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianPoint::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readRealArray( args[0], m_Coordinates );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcCartesianPoint, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianPoint::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPoint::getAttributes( vec_attributes );
@@ -46,6 +52,15 @@ void IFC4X3::IfcCartesianPoint::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcPoint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianPoint::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributes( visitor );
+	visitor.visitReals( 0, "Coordinates", m_Coordinates, std::isnan( m_Coordinates[2] ) ? 2 : 3 );
+}
+void IFC4X3::IfcCartesianPoint::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianPoint::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPoint::setInverseCounterparts( ptr_self_entity );
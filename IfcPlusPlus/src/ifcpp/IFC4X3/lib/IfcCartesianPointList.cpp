@@ -19,6 +19,9 @@ void IFC4X3::IfcCartesianPointList::getStepParameter( std::stringstream& stream,
 void IFC4X3::IfcCartesianPointList::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcCartesianPointList::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcCartesianPointList::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -27,6 +30,14 @@ void IFC4X3::IfcCartesianPointList::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianPointList::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+}
+void IFC4X3::IfcCartesianPointList::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianPointList::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -49,6 +49,13 @@ void IFC4X3::IfcCartesianPointList3D::readStepArguments( const std::vector<std::
 	if( num_args > 1 ){readTypeOfStringList( args[1], m_TagList );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCartesianPointList3D, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianPointList3D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfRealList2D( args[0], m_CoordList );}
+	if( num_args > 1 ){readTypeOfStringList( args[1], m_TagList );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCartesianPointList3D, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianPointList3D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCartesianPointList::getAttributes( vec_attributes );
@@ -69,6 +76,16 @@ void IFC4X3::IfcCartesianPointList3D::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcCartesianPointList::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianPointList3D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianPointList::visitAttributes( visitor );
+	visitor.visitList2D( 0, "CoordList", AttributeVector2DView<IfcLengthMeasure>( m_CoordList ) );
+	visitor.visitList( 1, "TagList", AttributeVectorView<IfcLabel>( m_TagList ) );
+}
+void IFC4X3::IfcCartesianPointList3D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianPointList::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianPointList3D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCartesianPointList::setInverseCounterparts( ptr_self_entity );
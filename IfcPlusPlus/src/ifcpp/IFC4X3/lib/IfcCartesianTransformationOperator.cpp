@@ -35,6 +35,15 @@ void IFC4X3::IfcCartesianTransformationOperator::readStepArguments( const std::v
 	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianTransformationOperator::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Axis1, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Axis2, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_LocalOrigin, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianTransformationOperator::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -47,6 +56,18 @@ void IFC4X3::IfcCartesianTransformationOperator::getAttributesInverse( std::vect
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianTransformationOperator::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Axis1", m_Axis1 );
+	visitor.visitObject( 1, "Axis2", m_Axis2 );
+	visitor.visitObject( 2, "LocalOrigin", m_LocalOrigin );
+	visitor.visitObject( 3, "Scale", m_Scale );
+}
+void IFC4X3::IfcCartesianTransformationOperator::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianTransformationOperator::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +76,19 @@ void IFC4X3::IfcCartesianTransformationOperator::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCartesianTransformationOperator::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	if( m_Axis1 )
+	{
+		refs.push_back( m_Axis1.get() );
+	}
+	if( m_Axis2 )
+	{
+		refs.push_back( m_Axis2.get() );
+	}
+	if( m_LocalOrigin )
+	{
+		refs.push_back( m_LocalOrigin.get() );
+	}
+}
@@ -35,6 +35,15 @@ void IFC4X3::IfcCartesianTransformationOperator2D::readStepArguments( const std:
 	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator2D, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianTransformationOperator2D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Axis1, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Axis2, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_LocalOrigin, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator2D, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianTransformationOperator2D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCartesianTransformationOperator::getAttributes( vec_attributes );
@@ -43,6 +52,14 @@ void IFC4X3::IfcCartesianTransformationOperator2D::getAttributesInverse( std::ve
 {
 	IFC4X3::IfcCartesianTransformationOperator::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianTransformationOperator2D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator::visitAttributes( visitor );
+}
+void IFC4X3::IfcCartesianTransformationOperator2D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianTransformationOperator2D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCartesianTransformationOperator::setInverseCounterparts( ptr_self_entity );
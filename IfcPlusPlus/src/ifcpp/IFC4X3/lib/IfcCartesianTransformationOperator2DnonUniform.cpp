@@ -38,6 +38,16 @@ void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::readStepArguments(
 	if( num_args > 4 ){m_Scale2 = IfcReal::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator2DnonUniform, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Axis1, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Axis2, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_LocalOrigin, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Scale2 = IfcReal::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator2DnonUniform, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCartesianTransformationOperator2D::getAttributes( vec_attributes );
@@ -47,6 +57,15 @@ void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::getAttributesInvers
 {
 	IFC4X3::IfcCartesianTransformationOperator2D::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator2D::visitAttributes( visitor );
+	visitor.visitObject( 4, "Scale2", m_Scale2 );
+}
+void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator2D::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianTransformationOperator2DnonUniform::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCartesianTransformationOperator2D::setInverseCounterparts( ptr_self_entity );
@@ -44,6 +44,18 @@ void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::readStepArguments(
 	if( num_args > 6 ){m_Scale3 = IfcReal::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator3DnonUniform, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Axis1, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Axis2, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_LocalOrigin, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Scale = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_Axis3, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Scale2 = IfcReal::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Scale3 = IfcReal::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcCartesianTransformationOperator3DnonUniform, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCartesianTransformationOperator3D::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::getAttributesInvers
 {
 	IFC4X3::IfcCartesianTransformationOperator3D::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator3D::visitAttributes( visitor );
+	visitor.visitObject( 5, "Scale2", m_Scale2 );
+	visitor.visitObject( 6, "Scale3", m_Scale3 );
+}
+void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCartesianTransformationOperator3D::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCartesianTransformationOperator3DnonUniform::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCartesianTransformationOperator3D::setInverseCounterparts( ptr_self_entity );
@@ -36,6 +36,15 @@ void IFC4X3::IfcCenterLineProfileDef::readStepArguments( const std::vector<std::
 	if( num_args > 3 ){m_Thickness = IfcPositiveLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCenterLineProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCenterLineProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Curve, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Thickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCenterLineProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCenterLineProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcArbitraryOpenProfileDef::getAttributes( vec_attributes );
@@ -45,6 +54,15 @@ void IFC4X3::IfcCenterLineProfileDef::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcArbitraryOpenProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCenterLineProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcArbitraryOpenProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "Thickness", m_Thickness );
+}
+void IFC4X3::IfcCenterLineProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcArbitraryOpenProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCenterLineProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcArbitraryOpenProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -23,6 +23,10 @@ void IFC4X3::IfcChangeActionEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcChangeActionEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcChangeActionEnum> IFC4X3::IfcChangeActionEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcChangeActionEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcChangeActionEnum> IFC4X3::IfcChangeActionEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcChangeActionEnum> IFC4X3::IfcChangeActionEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcChangeActionEnum>(); }
+		return shared_ptr<IfcChangeActionEnum>( new IfcChangeActionEnum( IfcChangeActionEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
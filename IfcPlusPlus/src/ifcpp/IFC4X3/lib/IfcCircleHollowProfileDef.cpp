@@ -39,6 +39,16 @@ void IFC4X3::IfcCircleHollowProfileDef::readStepArguments( const std::vector<std
 	if( num_args > 4 ){m_WallThickness = IfcPositiveLengthMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCircleHollowProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCircleHollowProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_WallThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCircleHollowProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCircleHollowProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCircleProfileDef::getAttributes( vec_attributes );
@@ -48,6 +58,15 @@ void IFC4X3::IfcCircleHollowProfileDef::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcCircleProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCircleHollowProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCircleProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 4, "WallThickness", m_WallThickness );
+}
+void IFC4X3::IfcCircleHollowProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCircleProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCircleHollowProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCircleProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -36,6 +36,15 @@ void IFC4X3::IfcCircleProfileDef::readStepArguments( const std::vector<std::stri
 	if( num_args > 3 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCircleProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCircleProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCircleProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCircleProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributes( vec_attributes );
@@ -45,6 +54,15 @@ void IFC4X3::IfcCircleProfileDef::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCircleProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "Radius", m_Radius );
+}
+void IFC4X3::IfcCircleProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCircleProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcParameterizedProfileDef::setInverseCounterparts( ptr_self_entity );
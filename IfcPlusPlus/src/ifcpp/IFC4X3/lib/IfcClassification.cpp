@@ -67,6 +67,18 @@ void IFC4X3::IfcClassification::readStepArguments( const std::vector<std::string
 	if( num_args > 6 ){readTypeOfStringList( args[6], m_ReferenceTokens );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcClassification, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcClassification::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Source = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Edition = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_EditionDate = IfcDate::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Name = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Description = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Specification = IfcURIReference::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readTypeOfStringList( args[6], m_ReferenceTokens );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcClassification, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcClassification::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalInformation::getAttributes( vec_attributes );
@@ -102,6 +114,23 @@ void IFC4X3::IfcClassification::getAttributesInverse( std::vector<std::pair<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasReferences_inverse", HasReferences_inverse_vec_obj ) );
 }
+void IFC4X3::IfcClassification::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributes( visitor );
+	visitor.visitObject( 0, "Source", m_Source );
+	visitor.visitObject( 1, "Edition", m_Edition );
+	visitor.visitObject( 2, "EditionDate", m_EditionDate );
+	visitor.visitObject( 3, "Name", m_Name );
+	visitor.visitObject( 4, "Description", m_Description );
+	visitor.visitObject( 5, "Specification", m_Specification );
+	visitor.visitList( 6, "ReferenceTokens", AttributeVectorView<IfcIdentifier>( m_ReferenceTokens ) );
+}
+void IFC4X3::IfcClassification::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "ClassificationForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesClassification>( m_ClassificationForObjects_inverse ) );
+	visitor.visitList( 1, "HasReferences_inverse", AttributeInverseVectorView<IfcClassificationReference>( m_HasReferences_inverse ) );
+}
 void IFC4X3::IfcClassification::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalInformation::setInverseCounterparts( ptr_self_entity );
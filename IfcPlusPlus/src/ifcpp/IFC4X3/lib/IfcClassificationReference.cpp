@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcClassification.h"
 #include "ifcpp/IFC4X3/include/IfcClassificationReference.h"
 #include "ifcpp/IFC4X3/include/IfcClassificationReferenceSelect.h"
@@ -44,6 +45,17 @@ void IFC4X3::IfcClassificationReference::readStepArguments( const std::vector<st
 	if( num_args > 5 ){m_Sort = IfcIdentifier::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcClassificationReference, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcClassificationReference::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Location = IfcURIReference::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ReferencedSource = IfcClassificationReferenceSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Description = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Sort = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcClassificationReference, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcClassificationReference::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalReference::getAttributes( vec_attributes );
@@ -73,6 +85,19 @@ void IFC4X3::IfcClassificationReference::getAttributesInverse( std::vector<std::
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasReferences_inverse", HasReferences_inverse_vec_obj ) );
 }
+void IFC4X3::IfcClassificationReference::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributes( visitor );
+	visitor.visitObject( 3, "ReferencedSource", m_ReferencedSource );
+	visitor.visitObject( 4, "Description", m_Description );
+	visitor.visitObject( 5, "Sort", m_Sort );
+}
+void IFC4X3::IfcClassificationReference::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "ClassificationRefForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesClassification>( m_ClassificationRefForObjects_inverse ) );
+	visitor.visitList( 2, "HasReferences_inverse", AttributeInverseVectorView<IfcClassificationReference>( m_HasReferences_inverse ) );
+}
 void IFC4X3::IfcClassificationReference::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalReference::setInverseCounterparts( ptr_self_entity );
@@ -89,6 +114,20 @@ void IFC4X3::IfcClassificationReference::setInverseCounterparts( shared_ptr<Buil
 		ReferencedSource_IfcClassificationReference->m_HasReferences_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcClassificationReference::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcExternalReference::getInverseReferences( refs );
+	shared_ptr<IfcClassification>  ReferencedSource_IfcClassification = dynamic_pointer_cast<IfcClassification>( m_ReferencedSource );
+	if( ReferencedSource_IfcClassification )
+	{
+		refs.emplace_back( ReferencedSource_IfcClassification.get(), INVERSE_HasReferences );
+	}
+	shared_ptr<IfcClassificationReference>  ReferencedSource_IfcClassificationReference = dynamic_pointer_cast<IfcClassificationReference>( m_ReferencedSource );
+	if( ReferencedSource_IfcClassificationReference )
+	{
+		refs.emplace_back( ReferencedSource_IfcClassificationReference.get(), INVERSE_HasReferences );
+	}
+}
 void IFC4X3::IfcClassificationReference::unlinkFromInverseCounterparts()
 {
 	IfcExternalReference::unlinkFromInverseCounterparts();
@@ -139,3 +178,12 @@ void IFC4X3::IfcClassificationReference::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcClassificationReference::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExternalReference::getEntityReferences( refs );
+	BuildingEntity* ReferencedSource_entity = dynamic_cast<BuildingEntity*>( m_ReferencedSource.get() );
+	if( ReferencedSource_entity )
+	{
+		refs.push_back( ReferencedSource_entity );
+	}
+}
@@ -21,3 +21,10 @@ shared_ptr<IFC4X3::IfcClassificationSelect> IFC4X3::IfcClassificationSelect::cre
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcClassificationSelect> IFC4X3::IfcClassificationSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcClassificationSelect>(); }
+	shared_ptr<IfcClassificationSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcClosedShell::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_CfsFaces, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcClosedShell, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcClosedShell::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_CfsFaces, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcClosedShell, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcClosedShell::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectedFaceSet::getAttributes( vec_attributes );
@@ -32,6 +38,14 @@ void IFC4X3::IfcClosedShell::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcConnectedFaceSet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcClosedShell::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectedFaceSet::visitAttributes( visitor );
+}
+void IFC4X3::IfcClosedShell::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectedFaceSet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcClosedShell::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectedFaceSet::setInverseCounterparts( ptr_self_entity );
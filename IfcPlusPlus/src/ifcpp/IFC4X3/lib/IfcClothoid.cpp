@@ -28,6 +28,13 @@ void IFC4X3::IfcClothoid::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 1 ){m_ClothoidConstant = IfcLengthMeasure::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcClothoid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcClothoid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ClothoidConstant = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcClothoid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcClothoid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpiral::getAttributes( vec_attributes );
@@ -37,6 +44,15 @@ void IFC4X3::IfcClothoid::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcSpiral::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcClothoid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributes( visitor );
+	visitor.visitObject( 1, "ClothoidConstant", m_ClothoidConstant );
+}
+void IFC4X3::IfcClothoid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcClothoid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpiral::setInverseCounterparts( ptr_self_entity );
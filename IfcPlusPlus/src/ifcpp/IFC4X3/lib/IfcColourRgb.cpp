@@ -32,6 +32,15 @@ void IFC4X3::IfcColourRgb::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 3 ){m_Blue = IfcNormalisedRatioMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcColourRgb, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcColourRgb::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Red = IfcNormalisedRatioMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Green = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Blue = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcColourRgb, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcColourRgb::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcColourSpecification::getAttributes( vec_attributes );
@@ -43,6 +52,17 @@ void IFC4X3::IfcColourRgb::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcColourSpecification::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcColourRgb::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcColourSpecification::visitAttributes( visitor );
+	visitor.visitObject( 1, "Red", m_Red );
+	visitor.visitObject( 2, "Green", m_Green );
+	visitor.visitObject( 3, "Blue", m_Blue );
+}
+void IFC4X3::IfcColourRgb::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcColourSpecification::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcColourRgb::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcColourSpecification::setInverseCounterparts( ptr_self_entity );
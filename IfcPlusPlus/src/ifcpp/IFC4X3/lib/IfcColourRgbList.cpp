@@ -22,6 +22,12 @@ void IFC4X3::IfcColourRgbList::readStepArguments( const std::vector<std::string>
 	if( num_args > 0 ){readTypeOfRealList2D( args[0], m_ColourList );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcColourRgbList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcColourRgbList::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfRealList2D( args[0], m_ColourList );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcColourRgbList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcColourRgbList::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -39,6 +45,15 @@ void IFC4X3::IfcColourRgbList::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcColourRgbList::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitList2D( 0, "ColourList", AttributeVector2DView<IfcNormalisedRatioMeasure>( m_ColourList ) );
+}
+void IFC4X3::IfcColourRgbList::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcColourRgbList::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -22,6 +22,12 @@ void IFC4X3::IfcColourSpecification::readStepArguments( const std::vector<std::s
 	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcColourSpecification, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcColourSpecification::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcColourSpecification, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcColourSpecification::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -31,6 +37,15 @@ void IFC4X3::IfcColourSpecification::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcColourSpecification::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+}
+void IFC4X3::IfcColourSpecification::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcColourSpecification::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
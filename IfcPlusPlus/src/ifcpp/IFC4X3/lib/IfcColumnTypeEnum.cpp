@@ -25,6 +25,10 @@ void IFC4X3::IfcColumnTypeEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcColumnTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcColumnTypeEnum> IFC4X3::IfcColumnTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcColumnTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcColumnTypeEnum> IFC4X3::IfcColumnTypeEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcColumnTypeEnum> IFC4X3::IfcColumnTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcColumnTypeEnum>(); }
+		return shared_ptr<IfcColumnTypeEnum>( new IfcColumnTypeEnum( IfcColumnTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
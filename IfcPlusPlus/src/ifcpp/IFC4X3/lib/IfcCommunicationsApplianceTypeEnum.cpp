@@ -44,6 +44,10 @@ void IFC4X3::IfcCommunicationsApplianceTypeEnum::getStepParameter( std::stringst
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCommunicationsApplianceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCommunicationsApplianceTypeEnum> IFC4X3::IfcCommunicationsApplianceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCommunicationsApplianceTypeEnum>(); }
@@ -156,3 +160,12 @@ shared_ptr<IFC4X3::IfcCommunicationsApplianceTypeEnum> IFC4X3::IfcCommunications
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCommunicationsApplianceTypeEnum> IFC4X3::IfcCommunicationsApplianceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCommunicationsApplianceTypeEnum>(); }
+		return shared_ptr<IfcCommunicationsApplianceTypeEnum>( new IfcCommunicationsApplianceTypeEnum( IfcCommunicationsApplianceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
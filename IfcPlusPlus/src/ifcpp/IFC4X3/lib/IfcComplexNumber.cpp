@@ -17,6 +17,10 @@ void IFC4X3::IfcComplexNumber::getStepParameter( std::stringstream& stream, bool
 	writeRealList( stream, m_vec, false, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcComplexNumber::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeTyped( classID(), encoder.encodeRealArray( m_vec.data(), m_vec.size() ) );
+}
 shared_ptr<IFC4X3::IfcComplexNumber> IFC4X3::IfcComplexNumber::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcComplexNumber>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcComplexNumber> IFC4X3::IfcComplexNumber::createObjectFromS
 	readRealList( arg, type_object->m_vec );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcComplexNumber> IFC4X3::IfcComplexNumber::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcComplexNumber>(); }
+	shared_ptr<IfcComplexNumber> type_object( new IfcComplexNumber() );
+	readRealList( arg, type_object->m_vec );
+	return type_object;
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcComplexProperty.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
@@ -38,6 +39,15 @@ void IFC4X3::IfcComplexProperty::readStepArguments( const std::vector<std::strin
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_HasProperties, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcComplexProperty, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcComplexProperty::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UsageName = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_HasProperties, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcComplexProperty, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcComplexProperty::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProperty::getAttributes( vec_attributes );
@@ -50,6 +60,16 @@ void IFC4X3::IfcComplexProperty::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcComplexProperty::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProperty::visitAttributes( visitor );
+	visitor.visitObject( 2, "UsageName", m_UsageName );
+	visitor.visitList( 3, "HasProperties", AttributeVectorView<IfcProperty>( m_HasProperties ) );
+}
+void IFC4X3::IfcComplexProperty::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcComplexProperty::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProperty::setInverseCounterparts( ptr_self_entity );
@@ -63,6 +83,17 @@ void IFC4X3::IfcComplexProperty::setInverseCounterparts( shared_ptr<BuildingEnti
 		}
 	}
 }
+void IFC4X3::IfcComplexProperty::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcProperty::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasProperties.size(); ++i )
+	{
+		if( m_HasProperties[i] )
+		{
+			refs.emplace_back( m_HasProperties[i].get(), INVERSE_PartOfComplex );
+		}
+	}
+}
 void IFC4X3::IfcComplexProperty::unlinkFromInverseCounterparts()
 {
 	IfcProperty::unlinkFromInverseCounterparts();
@@ -92,3 +123,14 @@ void IFC4X3::IfcComplexProperty::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcComplexProperty::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProperty::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasProperties.size(); ++i )
+	{
+		if( m_HasProperties[i] )
+		{
+			refs.push_back( m_HasProperties[i].get() );
+		}
+	}
+}
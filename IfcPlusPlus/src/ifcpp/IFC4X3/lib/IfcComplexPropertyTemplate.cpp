@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcComplexPropertyTemplate.h"
 #include "ifcpp/IFC4X3/include/IfcComplexPropertyTemplateTypeEnum.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -48,6 +49,18 @@ void IFC4X3::IfcComplexPropertyTemplate::readStepArguments( const std::vector<st
 	if( num_args > 6 ){readEntityReferenceList( args[6], m_HasPropertyTemplates, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcComplexPropertyTemplate, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcComplexPropertyTemplate::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_UsageName = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_TemplateType = IfcComplexPropertyTemplateTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_HasPropertyTemplates, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcComplexPropertyTemplate, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcComplexPropertyTemplate::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyTemplate::getAttributes( vec_attributes );
@@ -61,6 +74,17 @@ void IFC4X3::IfcComplexPropertyTemplate::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcPropertyTemplate::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcComplexPropertyTemplate::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplate::visitAttributes( visitor );
+	visitor.visitObject( 4, "UsageName", m_UsageName );
+	visitor.visitObject( 5, "TemplateType", m_TemplateType );
+	visitor.visitList( 6, "HasPropertyTemplates", AttributeVectorView<IfcPropertyTemplate>( m_HasPropertyTemplates ) );
+}
+void IFC4X3::IfcComplexPropertyTemplate::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplate::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcComplexPropertyTemplate::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyTemplate::setInverseCounterparts( ptr_self_entity );
@@ -74,6 +98,17 @@ void IFC4X3::IfcComplexPropertyTemplate::setInverseCounterparts( shared_ptr<Buil
 		}
 	}
 }
+void IFC4X3::IfcComplexPropertyTemplate::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPropertyTemplate::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasPropertyTemplates.size(); ++i )
+	{
+		if( m_HasPropertyTemplates[i] )
+		{
+			refs.emplace_back( m_HasPropertyTemplates[i].get(), INVERSE_PartOfComplexTemplate );
+		}
+	}
+}
 void IFC4X3::IfcComplexPropertyTemplate::unlinkFromInverseCounterparts()
 {
 	IfcPropertyTemplate::unlinkFromInverseCounterparts();
@@ -103,3 +138,14 @@ void IFC4X3::IfcComplexPropertyTemplate::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcComplexPropertyTemplate::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertyTemplate::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasPropertyTemplates.size(); ++i )
+	{
+		if( m_HasPropertyTemplates[i] )
+		{
+			refs.push_back( m_HasPropertyTemplates[i].get() );
+		}
+	}
+}
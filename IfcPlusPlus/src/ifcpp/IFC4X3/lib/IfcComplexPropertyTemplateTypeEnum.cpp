@@ -20,6 +20,10 @@ void IFC4X3::IfcComplexPropertyTemplateTypeEnum::getStepParameter( std::stringst
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcComplexPropertyTemplateTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcComplexPropertyTemplateTypeEnum> IFC4X3::IfcComplexPropertyTemplateTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcComplexPropertyTemplateTypeEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcComplexPropertyTemplateTypeEnum> IFC4X3::IfcComplexPropert
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcComplexPropertyTemplateTypeEnum> IFC4X3::IfcComplexPropertyTemplateTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_Q_COMPLEX ) { return shared_ptr<IfcComplexPropertyTemplateTypeEnum>(); }
+		return shared_ptr<IfcComplexPropertyTemplateTypeEnum>( new IfcComplexPropertyTemplateTypeEnum( IfcComplexPropertyTemplateTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
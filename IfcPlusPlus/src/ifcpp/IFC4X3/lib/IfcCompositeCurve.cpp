@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCompositeCurve.h"
 #include "ifcpp/IFC4X3/include/IfcLogical.h"
 #include "ifcpp/IFC4X3/include/IfcPresentationLayerAssignment.h"
@@ -28,6 +29,13 @@ void IFC4X3::IfcCompositeCurve::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCompositeCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Segments, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCompositeCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedCurve::getAttributes( vec_attributes );
@@ -40,6 +48,16 @@ void IFC4X3::IfcCompositeCurve::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcBoundedCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCompositeCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributes( visitor );
+	visitor.visitList( 0, "Segments", AttributeVectorView<IfcSegment>( m_Segments ) );
+	visitor.visitObject( 1, "SelfIntersect", m_SelfIntersect );
+}
+void IFC4X3::IfcCompositeCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCompositeCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedCurve::setInverseCounterparts( ptr_self_entity );
@@ -53,6 +71,17 @@ void IFC4X3::IfcCompositeCurve::setInverseCounterparts( shared_ptr<BuildingEntit
 		}
 	}
 }
+void IFC4X3::IfcCompositeCurve::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcBoundedCurve::getInverseReferences( refs );
+	for( size_t i=0; i<m_Segments.size(); ++i )
+	{
+		if( m_Segments[i] )
+		{
+			refs.emplace_back( m_Segments[i].get(), INVERSE_UsingCurves );
+		}
+	}
+}
 void IFC4X3::IfcCompositeCurve::unlinkFromInverseCounterparts()
 {
 	IfcBoundedCurve::unlinkFromInverseCounterparts();
@@ -82,3 +111,14 @@ void IFC4X3::IfcCompositeCurve::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcCompositeCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedCurve::getEntityReferences( refs );
+	for( size_t i=0; i<m_Segments.size(); ++i )
+	{
+		if( m_Segments[i] )
+		{
+			refs.push_back( m_Segments[i].get() );
+		}
+	}
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcCompositeCurveOnSurface::readStepArguments( const std::vector<st
 	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurveOnSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCompositeCurveOnSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Segments, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurveOnSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCompositeCurveOnSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCompositeCurve::getAttributes( vec_attributes );
@@ -36,6 +43,14 @@ void IFC4X3::IfcCompositeCurveOnSurface::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcCompositeCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCompositeCurveOnSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurve::visitAttributes( visitor );
+}
+void IFC4X3::IfcCompositeCurveOnSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCompositeCurveOnSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCompositeCurve::setInverseCounterparts( ptr_self_entity );
@@ -33,6 +33,14 @@ void IFC4X3::IfcCompositeCurveSegment::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){readEntityReference( args[2], m_ParentCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurveSegment, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCompositeCurveSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Transition = IfcTransitionCode::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ParentCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCompositeCurveSegment, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCompositeCurveSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSegment::getAttributes( vec_attributes );
@@ -43,6 +51,16 @@ void IFC4X3::IfcCompositeCurveSegment::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcSegment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCompositeCurveSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSegment::visitAttributes( visitor );
+	visitor.visitObject( 1, "SameSense", m_SameSense );
+	visitor.visitObject( 2, "ParentCurve", m_ParentCurve );
+}
+void IFC4X3::IfcCompositeCurveSegment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSegment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCompositeCurveSegment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSegment::setInverseCounterparts( ptr_self_entity );
@@ -51,3 +69,11 @@ void IFC4X3::IfcCompositeCurveSegment::unlinkFromInverseCounterparts()
 {
 	IfcSegment::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCompositeCurveSegment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSegment::getEntityReferences( refs );
+	if( m_ParentCurve )
+	{
+		refs.push_back( m_ParentCurve.get() );
+	}
+}
@@ -35,6 +35,15 @@ void IFC4X3::IfcCompositeProfileDef::readStepArguments( const std::vector<std::s
 	if( num_args > 3 ){m_Label = IfcLabel::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCompositeProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCompositeProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Profiles, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Label = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcCompositeProfileDef, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCompositeProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProfileDef::getAttributes( vec_attributes );
@@ -47,6 +56,16 @@ void IFC4X3::IfcCompositeProfileDef::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCompositeProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributes( visitor );
+	visitor.visitList( 2, "Profiles", AttributeVectorView<IfcProfileDef>( m_Profiles ) );
+	visitor.visitObject( 3, "Label", m_Label );
+}
+void IFC4X3::IfcCompositeProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCompositeProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +74,14 @@ void IFC4X3::IfcCompositeProfileDef::unlinkFromInverseCounterparts()
 {
 	IfcProfileDef::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCompositeProfileDef::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProfileDef::getEntityReferences( refs );
+	for( size_t i=0; i<m_Profiles.size(); ++i )
+	{
+		if( m_Profiles[i] )
+		{
+			refs.push_back( m_Profiles[i].get() );
+		}
+	}
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcCompoundPlaneAngleMeasure::getStepParameter( std::stringstream&
 	writeIntList( stream, m_vec );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCompoundPlaneAngleMeasure::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeTyped( classID(), encoder.encodeIntegerArray( m_vec.data(), m_vec.size() ) );
+}
 shared_ptr<IFC4X3::IfcCompoundPlaneAngleMeasure> IFC4X3::IfcCompoundPlaneAngleMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCompoundPlaneAngleMeasure>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcCompoundPlaneAngleMeasure> IFC4X3::IfcCompoundPlaneAngleMe
 	readIntegerList( arg, type_object->m_vec );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCompoundPlaneAngleMeasure> IFC4X3::IfcCompoundPlaneAngleMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcCompoundPlaneAngleMeasure>(); }
+	shared_ptr<IfcCompoundPlaneAngleMeasure> type_object( new IfcCompoundPlaneAngleMeasure() );
+	readIntegerList( arg, type_object->m_vec );
+	return type_object;
+}
@@ -27,6 +27,10 @@ void IFC4X3::IfcCondenserTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCondenserTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCondenserTypeEnum> IFC4X3::IfcCondenserTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCondenserTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcCondenserTypeEnum> IFC4X3::IfcCondenserTypeEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCondenserTypeEnum> IFC4X3::IfcCondenserTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCondenserTypeEnum>(); }
+		return shared_ptr<IfcCondenserTypeEnum>( new IfcCondenserTypeEnum( IfcCondenserTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcConic::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcConic, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConic::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcConic, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConic::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcConic::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConic::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Position", m_Position );
+}
+void IFC4X3::IfcConic::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConic::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,12 @@ void IFC4X3::IfcConic::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConic::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	BuildingEntity* Position_entity = dynamic_cast<BuildingEntity*>( m_Position.get() );
+	if( Position_entity )
+	{
+		refs.push_back( Position_entity );
+	}
+}
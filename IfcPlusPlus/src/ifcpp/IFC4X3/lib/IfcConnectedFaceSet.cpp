@@ -24,6 +24,12 @@ void IFC4X3::IfcConnectedFaceSet::readStepArguments( const std::vector<std::stri
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_CfsFaces, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcConnectedFaceSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectedFaceSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_CfsFaces, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcConnectedFaceSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectedFaceSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -35,6 +41,15 @@ void IFC4X3::IfcConnectedFaceSet::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectedFaceSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "CfsFaces", AttributeVectorView<IfcFace>( m_CfsFaces ) );
+}
+void IFC4X3::IfcConnectedFaceSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectedFaceSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +58,14 @@ void IFC4X3::IfcConnectedFaceSet::unlinkFromInverseCounterparts()
 {
 	IfcTopologicalRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConnectedFaceSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTopologicalRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_CfsFaces.size(); ++i )
+	{
+		if( m_CfsFaces[i] )
+		{
+			refs.push_back( m_CfsFaces[i].get() );
+		}
+	}
+}
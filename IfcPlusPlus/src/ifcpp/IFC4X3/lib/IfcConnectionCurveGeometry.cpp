@@ -25,6 +25,13 @@ void IFC4X3::IfcConnectionCurveGeometry::readStepArguments( const std::vector<st
 	if( num_args > 1 ){m_CurveOnRelatedElement = IfcCurveOrEdgeCurve::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionCurveGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectionCurveGeometry::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_CurveOnRelatingElement = IfcCurveOrEdgeCurve::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CurveOnRelatedElement = IfcCurveOrEdgeCurve::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionCurveGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectionCurveGeometry::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectionGeometry::getAttributes( vec_attributes );
@@ -35,6 +42,16 @@ void IFC4X3::IfcConnectionCurveGeometry::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcConnectionGeometry::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectionCurveGeometry::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributes( visitor );
+	visitor.visitObject( 0, "CurveOnRelatingElement", m_CurveOnRelatingElement );
+	visitor.visitObject( 1, "CurveOnRelatedElement", m_CurveOnRelatedElement );
+}
+void IFC4X3::IfcConnectionCurveGeometry::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectionCurveGeometry::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectionGeometry::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +60,17 @@ void IFC4X3::IfcConnectionCurveGeometry::unlinkFromInverseCounterparts()
 {
 	IfcConnectionGeometry::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConnectionCurveGeometry::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConnectionGeometry::getEntityReferences( refs );
+	BuildingEntity* CurveOnRelatingElement_entity = dynamic_cast<BuildingEntity*>( m_CurveOnRelatingElement.get() );
+	if( CurveOnRelatingElement_entity )
+	{
+		refs.push_back( CurveOnRelatingElement_entity );
+	}
+	BuildingEntity* CurveOnRelatedElement_entity = dynamic_cast<BuildingEntity*>( m_CurveOnRelatedElement.get() );
+	if( CurveOnRelatedElement_entity )
+	{
+		refs.push_back( CurveOnRelatedElement_entity );
+	}
+}
@@ -17,12 +17,21 @@ void IFC4X3::IfcConnectionGeometry::getStepParameter( std::stringstream& stream,
 void IFC4X3::IfcConnectionGeometry::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcConnectionGeometry::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcConnectionGeometry::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
 void IFC4X3::IfcConnectionGeometry::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcConnectionGeometry::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcConnectionGeometry::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcConnectionGeometry::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
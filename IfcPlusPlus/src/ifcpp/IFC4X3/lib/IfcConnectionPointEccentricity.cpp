@@ -35,6 +35,16 @@ void IFC4X3::IfcConnectionPointEccentricity::readStepArguments( const std::vecto
 	if( num_args > 4 ){m_EccentricityInZ = IfcLengthMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcConnectionPointEccentricity, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectionPointEccentricity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_PointOnRelatingElement = IfcPointOrVertexPoint::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_PointOnRelatedElement = IfcPointOrVertexPoint::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_EccentricityInX = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_EccentricityInY = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EccentricityInZ = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcConnectionPointEccentricity, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectionPointEccentricity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectionPointGeometry::getAttributes( vec_attributes );
@@ -46,6 +56,17 @@ void IFC4X3::IfcConnectionPointEccentricity::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcConnectionPointGeometry::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectionPointEccentricity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionPointGeometry::visitAttributes( visitor );
+	visitor.visitObject( 2, "EccentricityInX", m_EccentricityInX );
+	visitor.visitObject( 3, "EccentricityInY", m_EccentricityInY );
+	visitor.visitObject( 4, "EccentricityInZ", m_EccentricityInZ );
+}
+void IFC4X3::IfcConnectionPointEccentricity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionPointGeometry::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectionPointEccentricity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectionPointGeometry::setInverseCounterparts( ptr_self_entity );
@@ -25,6 +25,13 @@ void IFC4X3::IfcConnectionPointGeometry::readStepArguments( const std::vector<st
 	if( num_args > 1 ){m_PointOnRelatedElement = IfcPointOrVertexPoint::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionPointGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectionPointGeometry::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_PointOnRelatingElement = IfcPointOrVertexPoint::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_PointOnRelatedElement = IfcPointOrVertexPoint::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionPointGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectionPointGeometry::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectionGeometry::getAttributes( vec_attributes );
@@ -35,6 +42,16 @@ void IFC4X3::IfcConnectionPointGeometry::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcConnectionGeometry::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectionPointGeometry::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributes( visitor );
+	visitor.visitObject( 0, "PointOnRelatingElement", m_PointOnRelatingElement );
+	visitor.visitObject( 1, "PointOnRelatedElement", m_PointOnRelatedElement );
+}
+void IFC4X3::IfcConnectionPointGeometry::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectionPointGeometry::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectionGeometry::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +60,17 @@ void IFC4X3::IfcConnectionPointGeometry::unlinkFromInverseCounterparts()
 {
 	IfcConnectionGeometry::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConnectionPointGeometry::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConnectionGeometry::getEntityReferences( refs );
+	BuildingEntity* PointOnRelatingElement_entity = dynamic_cast<BuildingEntity*>( m_PointOnRelatingElement.get() );
+	if( PointOnRelatingElement_entity )
+	{
+		refs.push_back( PointOnRelatingElement_entity );
+	}
+	BuildingEntity* PointOnRelatedElement_entity = dynamic_cast<BuildingEntity*>( m_PointOnRelatedElement.get() );
+	if( PointOnRelatedElement_entity )
+	{
+		refs.push_back( PointOnRelatedElement_entity );
+	}
+}
@@ -25,6 +25,13 @@ void IFC4X3::IfcConnectionSurfaceGeometry::readStepArguments( const std::vector<
 	if( num_args > 1 ){m_SurfaceOnRelatedElement = IfcSurfaceOrFaceSurface::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionSurfaceGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectionSurfaceGeometry::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SurfaceOnRelatingElement = IfcSurfaceOrFaceSurface::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SurfaceOnRelatedElement = IfcSurfaceOrFaceSurface::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionSurfaceGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectionSurfaceGeometry::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectionGeometry::getAttributes( vec_attributes );
@@ -35,6 +42,16 @@ void IFC4X3::IfcConnectionSurfaceGeometry::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcConnectionGeometry::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectionSurfaceGeometry::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributes( visitor );
+	visitor.visitObject( 0, "SurfaceOnRelatingElement", m_SurfaceOnRelatingElement );
+	visitor.visitObject( 1, "SurfaceOnRelatedElement", m_SurfaceOnRelatedElement );
+}
+void IFC4X3::IfcConnectionSurfaceGeometry::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectionSurfaceGeometry::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectionGeometry::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +60,17 @@ void IFC4X3::IfcConnectionSurfaceGeometry::unlinkFromInverseCounterparts()
 {
 	IfcConnectionGeometry::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConnectionSurfaceGeometry::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConnectionGeometry::getEntityReferences( refs );
+	BuildingEntity* SurfaceOnRelatingElement_entity = dynamic_cast<BuildingEntity*>( m_SurfaceOnRelatingElement.get() );
+	if( SurfaceOnRelatingElement_entity )
+	{
+		refs.push_back( SurfaceOnRelatingElement_entity );
+	}
+	BuildingEntity* SurfaceOnRelatedElement_entity = dynamic_cast<BuildingEntity*>( m_SurfaceOnRelatedElement.get() );
+	if( SurfaceOnRelatedElement_entity )
+	{
+		refs.push_back( SurfaceOnRelatedElement_entity );
+	}
+}
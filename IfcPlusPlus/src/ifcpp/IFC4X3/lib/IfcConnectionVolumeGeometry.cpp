@@ -25,6 +25,13 @@ void IFC4X3::IfcConnectionVolumeGeometry::readStepArguments( const std::vector<s
 	if( num_args > 1 ){m_VolumeOnRelatedElement = IfcSolidOrShell::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionVolumeGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConnectionVolumeGeometry::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_VolumeOnRelatingElement = IfcSolidOrShell::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_VolumeOnRelatedElement = IfcSolidOrShell::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcConnectionVolumeGeometry, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConnectionVolumeGeometry::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConnectionGeometry::getAttributes( vec_attributes );
@@ -35,6 +42,16 @@ void IFC4X3::IfcConnectionVolumeGeometry::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcConnectionGeometry::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConnectionVolumeGeometry::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributes( visitor );
+	visitor.visitObject( 0, "VolumeOnRelatingElement", m_VolumeOnRelatingElement );
+	visitor.visitObject( 1, "VolumeOnRelatedElement", m_VolumeOnRelatedElement );
+}
+void IFC4X3::IfcConnectionVolumeGeometry::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConnectionGeometry::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConnectionVolumeGeometry::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConnectionGeometry::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +60,17 @@ void IFC4X3::IfcConnectionVolumeGeometry::unlinkFromInverseCounterparts()
 {
 	IfcConnectionGeometry::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConnectionVolumeGeometry::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConnectionGeometry::getEntityReferences( refs );
+	BuildingEntity* VolumeOnRelatingElement_entity = dynamic_cast<BuildingEntity*>( m_VolumeOnRelatingElement.get() );
+	if( VolumeOnRelatingElement_entity )
+	{
+		refs.push_back( VolumeOnRelatingElement_entity );
+	}
+	BuildingEntity* VolumeOnRelatedElement_entity = dynamic_cast<BuildingEntity*>( m_VolumeOnRelatedElement.get() );
+	if( VolumeOnRelatedElement_entity )
+	{
+		refs.push_back( VolumeOnRelatedElement_entity );
+	}
+}
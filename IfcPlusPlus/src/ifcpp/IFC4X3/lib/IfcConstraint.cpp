@@ -46,6 +46,18 @@ void IFC4X3::IfcConstraint::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 6 ){m_UserDefinedGrade = IfcLabel::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcConstraint, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConstraint::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ConstraintGrade = IfcConstraintEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ConstraintSource = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_CreatingActor = IfcActorSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_CreationTime = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_UserDefinedGrade = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcConstraint, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConstraint::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -77,9 +89,32 @@ void IFC4X3::IfcConstraint::getAttributesInverse( std::vector<std::pair<std::str
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "PropertiesForConstraint_inverse", PropertiesForConstraint_inverse_vec_obj ) );
 }
+void IFC4X3::IfcConstraint::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "ConstraintGrade", m_ConstraintGrade );
+	visitor.visitObject( 3, "ConstraintSource", m_ConstraintSource );
+	visitor.visitObject( 4, "CreatingActor", m_CreatingActor );
+	visitor.visitObject( 5, "CreationTime", m_CreationTime );
+	visitor.visitObject( 6, "UserDefinedGrade", m_UserDefinedGrade );
+}
+void IFC4X3::IfcConstraint::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+	visitor.visitList( 1, "PropertiesForConstraint_inverse", AttributeInverseVectorView<IfcResourceConstraintRelationship>( m_PropertiesForConstraint_inverse ) );
+}
 void IFC4X3::IfcConstraint::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcConstraint::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcConstraint::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* CreatingActor_entity = dynamic_cast<BuildingEntity*>( m_CreatingActor.get() );
+	if( CreatingActor_entity )
+	{
+		refs.push_back( CreatingActor_entity );
+	}
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcConstraintEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcConstraintEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcConstraintEnum> IFC4X3::IfcConstraintEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcConstraintEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcConstraintEnum> IFC4X3::IfcConstraintEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcConstraintEnum> IFC4X3::IfcConstraintEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcConstraintEnum>(); }
+		return shared_ptr<IfcConstraintEnum>( new IfcConstraintEnum( IfcConstraintEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
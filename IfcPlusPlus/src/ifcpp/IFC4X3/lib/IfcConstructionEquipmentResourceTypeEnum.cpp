@@ -28,6 +28,10 @@ void IFC4X3::IfcConstructionEquipmentResourceTypeEnum::getStepParameter( std::st
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcConstructionEquipmentResourceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcConstructionEquipmentResourceTypeEnum> IFC4X3::IfcConstructionEquipmentResourceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcConstructionEquipmentResourceTypeEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcConstructionEquipmentResourceTypeEnum> IFC4X3::IfcConstruc
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcConstructionEquipmentResourceTypeEnum> IFC4X3::IfcConstructionEquipmentResourceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcConstructionEquipmentResourceTypeEnum>(); }
+		return shared_ptr<IfcConstructionEquipmentResourceTypeEnum>( new IfcConstructionEquipmentResourceTypeEnum( IfcConstructionEquipmentResourceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
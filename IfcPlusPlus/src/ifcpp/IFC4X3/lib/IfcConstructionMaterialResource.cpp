@@ -69,6 +69,22 @@ void IFC4X3::IfcConstructionMaterialResource::readStepArguments( const std::vect
 	if( num_args > 10 ){m_PredefinedType = IfcConstructionMaterialResourceTypeEnum::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcConstructionMaterialResource, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConstructionMaterialResource::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_Usage, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_BaseCosts, map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_BaseQuantity, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_PredefinedType = IfcConstructionMaterialResourceTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcConstructionMaterialResource, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConstructionMaterialResource::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConstructionResource::getAttributes( vec_attributes );
@@ -78,6 +94,15 @@ void IFC4X3::IfcConstructionMaterialResource::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcConstructionResource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConstructionMaterialResource::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstructionResource::visitAttributes( visitor );
+	visitor.visitObject( 10, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcConstructionMaterialResource::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstructionResource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConstructionMaterialResource::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConstructionResource::setInverseCounterparts( ptr_self_entity );
@@ -65,6 +65,21 @@ void IFC4X3::IfcConstructionResource::readStepArguments( const std::vector<std::
 	if( num_args > 9 ){readEntityReference( args[9], m_BaseQuantity, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcConstructionResource, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConstructionResource::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_Usage, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_BaseCosts, map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_BaseQuantity, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcConstructionResource, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConstructionResource::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResource::getAttributes( vec_attributes );
@@ -78,6 +93,17 @@ void IFC4X3::IfcConstructionResource::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcResource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConstructionResource::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResource::visitAttributes( visitor );
+	visitor.visitObject( 7, "Usage", m_Usage );
+	visitor.visitList( 8, "BaseCosts", AttributeVectorView<IfcAppliedValue>( m_BaseCosts ) );
+	visitor.visitObject( 9, "BaseQuantity", m_BaseQuantity );
+}
+void IFC4X3::IfcConstructionResource::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConstructionResource::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResource::setInverseCounterparts( ptr_self_entity );
@@ -86,3 +112,22 @@ void IFC4X3::IfcConstructionResource::unlinkFromInverseCounterparts()
 {
 	IfcResource::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConstructionResource::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResource::getEntityReferences( refs );
+	if( m_Usage )
+	{
+		refs.push_back( m_Usage.get() );
+	}
+	for( size_t i=0; i<m_BaseCosts.size(); ++i )
+	{
+		if( m_BaseCosts[i] )
+		{
+			refs.push_back( m_BaseCosts[i].get() );
+		}
+	}
+	if( m_BaseQuantity )
+	{
+		refs.push_back( m_BaseQuantity.get() );
+	}
+}
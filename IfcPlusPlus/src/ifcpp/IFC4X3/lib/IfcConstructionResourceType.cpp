@@ -66,6 +66,22 @@ void IFC4X3::IfcConstructionResourceType::readStepArguments( const std::vector<s
 	if( num_args > 10 ){readEntityReference( args[10], m_BaseQuantity, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcConstructionResourceType, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConstructionResourceType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongDescription = IfcText::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ResourceType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReferenceList( args[9], m_BaseCosts, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_BaseQuantity, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcConstructionResourceType, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConstructionResourceType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTypeResource::getAttributes( vec_attributes );
@@ -78,6 +94,16 @@ void IFC4X3::IfcConstructionResourceType::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcTypeResource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConstructionResourceType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeResource::visitAttributes( visitor );
+	visitor.visitList( 9, "BaseCosts", AttributeVectorView<IfcAppliedValue>( m_BaseCosts ) );
+	visitor.visitObject( 10, "BaseQuantity", m_BaseQuantity );
+}
+void IFC4X3::IfcConstructionResourceType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeResource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConstructionResourceType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTypeResource::setInverseCounterparts( ptr_self_entity );
@@ -86,3 +112,18 @@ void IFC4X3::IfcConstructionResourceType::unlinkFromInverseCounterparts()
 {
 	IfcTypeResource::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConstructionResourceType::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTypeResource::getEntityReferences( refs );
+	for( size_t i=0; i<m_BaseCosts.size(); ++i )
+	{
+		if( m_BaseCosts[i] )
+		{
+			refs.push_back( m_BaseCosts[i].get() );
+		}
+	}
+	if( m_BaseQuantity )
+	{
+		refs.push_back( m_BaseQuantity.get() );
+	}
+}
@@ -57,6 +57,20 @@ void IFC4X3::IfcContext::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 8 ){readEntityReference( args[8], m_UnitsInContext, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcContext, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcContext::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LongName = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Phase = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_RepresentationContexts, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_UnitsInContext, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcContext, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcContext::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectDefinition::getAttributes( vec_attributes );
@@ -90,6 +104,21 @@ void IFC4X3::IfcContext::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Declares_inverse", Declares_inverse_vec_obj ) );
 }
+void IFC4X3::IfcContext::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributes( visitor );
+	visitor.visitObject( 4, "ObjectType", m_ObjectType );
+	visitor.visitObject( 5, "LongName", m_LongName );
+	visitor.visitObject( 6, "Phase", m_Phase );
+	visitor.visitList( 7, "RepresentationContexts", AttributeVectorView<IfcRepresentationContext>( m_RepresentationContexts ) );
+	visitor.visitObject( 8, "UnitsInContext", m_UnitsInContext );
+}
+void IFC4X3::IfcContext::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 7, "IsDefinedBy_inverse", AttributeInverseVectorView<IfcRelDefinesByProperties>( m_IsDefinedBy_inverse ) );
+	visitor.visitList( 8, "Declares_inverse", AttributeInverseVectorView<IfcRelDeclares>( m_Declares_inverse ) );
+}
 void IFC4X3::IfcContext::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectDefinition::setInverseCounterparts( ptr_self_entity );
@@ -98,3 +127,18 @@ void IFC4X3::IfcContext::unlinkFromInverseCounterparts()
 {
 	IfcObjectDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcContext::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObjectDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_RepresentationContexts.size(); ++i )
+	{
+		if( m_RepresentationContexts[i] )
+		{
+			refs.push_back( m_RepresentationContexts[i].get() );
+		}
+	}
+	if( m_UnitsInContext )
+	{
+		refs.push_back( m_UnitsInContext.get() );
+	}
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcContextDependentMeasure::getStepParameter( std::stringstream& st
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcContextDependentMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcContextDependentMeasure> IFC4X3::IfcContextDependentMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcContextDependentMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcContextDependentMeasure> IFC4X3::IfcContextDependentMeasur
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcContextDependentMeasure> IFC4X3::IfcContextDependentMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcContextDependentMeasure>(); }
+	shared_ptr<IfcContextDependentMeasure> type_object( new IfcContextDependentMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcContextDependentUnit::readStepArguments( const std::vector<std::
 	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcContextDependentUnit, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcContextDependentUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Dimensions, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcContextDependentUnit, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcContextDependentUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcNamedUnit::getAttributes( vec_attributes );
@@ -49,6 +57,16 @@ void IFC4X3::IfcContextDependentUnit::getAttributesInverse( std::vector<std::pai
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReference_inverse", HasExternalReference_inverse_vec_obj ) );
 }
+void IFC4X3::IfcContextDependentUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributes( visitor );
+	visitor.visitObject( 2, "Name", m_Name );
+}
+void IFC4X3::IfcContextDependentUnit::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "HasExternalReference_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReference_inverse ) );
+}
 void IFC4X3::IfcContextDependentUnit::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcNamedUnit::setInverseCounterparts( ptr_self_entity );
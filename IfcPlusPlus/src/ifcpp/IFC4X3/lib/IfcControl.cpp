@@ -50,6 +50,17 @@ void IFC4X3::IfcControl::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcControl, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcControl::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcControl, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcControl::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObject::getAttributes( vec_attributes );
@@ -68,6 +79,16 @@ void IFC4X3::IfcControl::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Controls_inverse", Controls_inverse_vec_obj ) );
 }
+void IFC4X3::IfcControl::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributes( visitor );
+	visitor.visitObject( 5, "Identification", m_Identification );
+}
+void IFC4X3::IfcControl::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributesInverse( visitor );
+	visitor.visitList( 11, "Controls_inverse", AttributeInverseVectorView<IfcRelAssignsToControl>( m_Controls_inverse ) );
+}
 void IFC4X3::IfcControl::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObject::setInverseCounterparts( ptr_self_entity );
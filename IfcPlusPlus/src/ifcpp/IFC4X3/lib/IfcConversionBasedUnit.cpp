@@ -35,6 +35,15 @@ void IFC4X3::IfcConversionBasedUnit::readStepArguments( const std::vector<std::s
 	if( num_args > 3 ){readEntityReference( args[3], m_ConversionFactor, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcConversionBasedUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConversionBasedUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Dimensions, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_ConversionFactor, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcConversionBasedUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConversionBasedUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcNamedUnit::getAttributes( vec_attributes );
@@ -54,6 +63,17 @@ void IFC4X3::IfcConversionBasedUnit::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReference_inverse", HasExternalReference_inverse_vec_obj ) );
 }
+void IFC4X3::IfcConversionBasedUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributes( visitor );
+	visitor.visitObject( 2, "Name", m_Name );
+	visitor.visitObject( 3, "ConversionFactor", m_ConversionFactor );
+}
+void IFC4X3::IfcConversionBasedUnit::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "HasExternalReference_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReference_inverse ) );
+}
 void IFC4X3::IfcConversionBasedUnit::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcNamedUnit::setInverseCounterparts( ptr_self_entity );
@@ -62,3 +82,11 @@ void IFC4X3::IfcConversionBasedUnit::unlinkFromInverseCounterparts()
 {
 	IfcNamedUnit::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcConversionBasedUnit::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcNamedUnit::getEntityReferences( refs );
+	if( m_ConversionFactor )
+	{
+		refs.push_back( m_ConversionFactor.get() );
+	}
+}
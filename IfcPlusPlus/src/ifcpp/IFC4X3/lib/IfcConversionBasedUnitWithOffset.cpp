@@ -39,6 +39,16 @@ void IFC4X3::IfcConversionBasedUnitWithOffset::readStepArguments( const std::vec
 	if( num_args > 4 ){m_ConversionOffset = IfcReal::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcConversionBasedUnitWithOffset, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcConversionBasedUnitWithOffset::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Dimensions, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_ConversionFactor, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ConversionOffset = IfcReal::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcConversionBasedUnitWithOffset, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcConversionBasedUnitWithOffset::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConversionBasedUnit::getAttributes( vec_attributes );
@@ -48,6 +58,15 @@ void IFC4X3::IfcConversionBasedUnitWithOffset::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcConversionBasedUnit::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcConversionBasedUnitWithOffset::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConversionBasedUnit::visitAttributes( visitor );
+	visitor.visitObject( 4, "ConversionOffset", m_ConversionOffset );
+}
+void IFC4X3::IfcConversionBasedUnitWithOffset::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConversionBasedUnit::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcConversionBasedUnitWithOffset::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConversionBasedUnit::setInverseCounterparts( ptr_self_entity );
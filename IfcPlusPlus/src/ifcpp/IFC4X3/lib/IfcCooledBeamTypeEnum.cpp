@@ -22,6 +22,10 @@ void IFC4X3::IfcCooledBeamTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCooledBeamTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCooledBeamTypeEnum> IFC4X3::IfcCooledBeamTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCooledBeamTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcCooledBeamTypeEnum> IFC4X3::IfcCooledBeamTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCooledBeamTypeEnum> IFC4X3::IfcCooledBeamTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCooledBeamTypeEnum>(); }
+		return shared_ptr<IfcCooledBeamTypeEnum>( new IfcCooledBeamTypeEnum( IfcCooledBeamTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcCoolingTowerTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCoolingTowerTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCoolingTowerTypeEnum> IFC4X3::IfcCoolingTowerTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCoolingTowerTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcCoolingTowerTypeEnum> IFC4X3::IfcCoolingTowerTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCoolingTowerTypeEnum> IFC4X3::IfcCoolingTowerTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCoolingTowerTypeEnum>(); }
+		return shared_ptr<IfcCoolingTowerTypeEnum>( new IfcCoolingTowerTypeEnum( IfcCoolingTowerTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
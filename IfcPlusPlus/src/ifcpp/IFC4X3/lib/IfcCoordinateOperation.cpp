@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCoordinateOperation.h"
 #include "ifcpp/IFC4X3/include/IfcCoordinateReferenceSystem.h"
 #include "ifcpp/IFC4X3/include/IfcCoordinateReferenceSystemSelect.h"
@@ -27,6 +28,13 @@ void IFC4X3::IfcCoordinateOperation::readStepArguments( const std::vector<std::s
 	if( num_args > 1 ){readEntityReference( args[1], m_TargetCRS, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCoordinateOperation, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCoordinateOperation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SourceCRS = IfcCoordinateReferenceSystemSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TargetCRS, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCoordinateOperation, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCoordinateOperation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "SourceCRS", m_SourceCRS ) );
@@ -35,6 +43,14 @@ void IFC4X3::IfcCoordinateOperation::getAttributes( std::vector<std::pair<std::s
 void IFC4X3::IfcCoordinateOperation::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcCoordinateOperation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "SourceCRS", m_SourceCRS );
+	visitor.visitObject( 1, "TargetCRS", m_TargetCRS );
+}
+void IFC4X3::IfcCoordinateOperation::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcCoordinateOperation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcCoordinateOperation> ptr_self = dynamic_pointer_cast<IfcCoordinateOperation>( ptr_self_entity );
@@ -50,6 +66,19 @@ void IFC4X3::IfcCoordinateOperation::setInverseCounterparts( shared_ptr<Building
 		SourceCRS_IfcGeometricRepresentationContext->m_HasCoordinateOperation_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcCoordinateOperation::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	shared_ptr<IfcCoordinateReferenceSystem>  SourceCRS_IfcCoordinateReferenceSystem = dynamic_pointer_cast<IfcCoordinateReferenceSystem>( m_SourceCRS );
+	if( SourceCRS_IfcCoordinateReferenceSystem )
+	{
+		refs.emplace_back( SourceCRS_IfcCoordinateReferenceSystem.get(), INVERSE_HasCoordinateOperation );
+	}
+	shared_ptr<IfcGeometricRepresentationContext>  SourceCRS_IfcGeometricRepresentationContext = dynamic_pointer_cast<IfcGeometricRepresentationContext>( m_SourceCRS );
+	if( SourceCRS_IfcGeometricRepresentationContext )
+	{
+		refs.emplace_back( SourceCRS_IfcGeometricRepresentationContext.get(), INVERSE_HasCoordinateOperation );
+	}
+}
 void IFC4X3::IfcCoordinateOperation::unlinkFromInverseCounterparts()
 {
 	shared_ptr<IfcCoordinateReferenceSystem>  SourceCRS_IfcCoordinateReferenceSystem = dynamic_pointer_cast<IfcCoordinateReferenceSystem>( m_SourceCRS );
@@ -99,3 +128,15 @@ void IFC4X3::IfcCoordinateOperation::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcCoordinateOperation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* SourceCRS_entity = dynamic_cast<BuildingEntity*>( m_SourceCRS.get() );
+	if( SourceCRS_entity )
+	{
+		refs.push_back( SourceCRS_entity );
+	}
+	if( m_TargetCRS )
+	{
+		refs.push_back( m_TargetCRS.get() );
+	}
+}
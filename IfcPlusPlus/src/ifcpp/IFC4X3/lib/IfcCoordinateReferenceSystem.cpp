@@ -32,6 +32,14 @@ void IFC4X3::IfcCoordinateReferenceSystem::readStepArguments( const std::vector<
 	if( num_args > 2 ){m_GeodeticDatum = IfcIdentifier::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCoordinateReferenceSystem, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCoordinateReferenceSystem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_GeodeticDatum = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCoordinateReferenceSystem, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCoordinateReferenceSystem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -59,6 +67,17 @@ void IFC4X3::IfcCoordinateReferenceSystem::getAttributesInverse( std::vector<std
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "WellKnownText_inverse", WellKnownText_inverse_vec_obj ) );
 }
+void IFC4X3::IfcCoordinateReferenceSystem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "GeodeticDatum", m_GeodeticDatum );
+}
+void IFC4X3::IfcCoordinateReferenceSystem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasCoordinateOperation_inverse", AttributeInverseVectorView<IfcCoordinateOperation>( m_HasCoordinateOperation_inverse ) );
+	visitor.visitList( 1, "WellKnownText_inverse", AttributeInverseVectorView<IfcWellKnownText>( m_WellKnownText_inverse ) );
+}
 void IFC4X3::IfcCoordinateReferenceSystem::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
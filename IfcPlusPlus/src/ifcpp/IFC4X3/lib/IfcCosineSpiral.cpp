@@ -31,6 +31,14 @@ void IFC4X3::IfcCosineSpiral::readStepArguments( const std::vector<std::string>&
 	if( num_args > 2 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCosineSpiral, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCosineSpiral::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CosineTerm = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCosineSpiral, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCosineSpiral::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpiral::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcCosineSpiral::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcSpiral::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCosineSpiral::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributes( visitor );
+	visitor.visitObject( 1, "CosineTerm", m_CosineTerm );
+	visitor.visitObject( 2, "ConstantTerm", m_ConstantTerm );
+}
+void IFC4X3::IfcCosineSpiral::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCosineSpiral::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpiral::setInverseCounterparts( ptr_self_entity );
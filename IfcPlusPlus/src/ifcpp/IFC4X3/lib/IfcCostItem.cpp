@@ -62,6 +62,20 @@ void IFC4X3::IfcCostItem::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 8 ){readEntityReferenceList( args[8], m_CostQuantities, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcCostItem, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCostItem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PredefinedType = IfcCostItemTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_CostValues, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_CostQuantities, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcCostItem, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCostItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcControl::getAttributes( vec_attributes );
@@ -77,6 +91,17 @@ void IFC4X3::IfcCostItem::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCostItem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributes( visitor );
+	visitor.visitObject( 6, "PredefinedType", m_PredefinedType );
+	visitor.visitList( 7, "CostValues", AttributeVectorView<IfcCostValue>( m_CostValues ) );
+	visitor.visitList( 8, "CostQuantities", AttributeVectorView<IfcPhysicalQuantity>( m_CostQuantities ) );
+}
+void IFC4X3::IfcCostItem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCostItem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcControl::setInverseCounterparts( ptr_self_entity );
@@ -85,3 +110,21 @@ void IFC4X3::IfcCostItem::unlinkFromInverseCounterparts()
 {
 	IfcControl::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCostItem::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcControl::getEntityReferences( refs );
+	for( size_t i=0; i<m_CostValues.size(); ++i )
+	{
+		if( m_CostValues[i] )
+		{
+			refs.push_back( m_CostValues[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_CostQuantities.size(); ++i )
+	{
+		if( m_CostQuantities[i] )
+		{
+			refs.push_back( m_CostQuantities[i].get() );
+		}
+	}
+}
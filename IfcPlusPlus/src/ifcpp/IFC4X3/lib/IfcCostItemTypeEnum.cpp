@@ -20,6 +20,10 @@ void IFC4X3::IfcCostItemTypeEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCostItemTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCostItemTypeEnum> IFC4X3::IfcCostItemTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCostItemTypeEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcCostItemTypeEnum> IFC4X3::IfcCostItemTypeEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCostItemTypeEnum> IFC4X3::IfcCostItemTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCostItemTypeEnum>(); }
+		return shared_ptr<IfcCostItemTypeEnum>( new IfcCostItemTypeEnum( IfcCostItemTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
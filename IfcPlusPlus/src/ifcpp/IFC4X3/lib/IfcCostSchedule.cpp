@@ -64,6 +64,21 @@ void IFC4X3::IfcCostSchedule::readStepArguments( const std::vector<std::string>&
 	if( num_args > 9 ){m_UpdateDate = IfcDateTime::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcCostSchedule, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCostSchedule::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PredefinedType = IfcCostScheduleTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Status = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SubmittedOn = IfcDateTime::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_UpdateDate = IfcDateTime::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcCostSchedule, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCostSchedule::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcControl::getAttributes( vec_attributes );
@@ -76,6 +91,18 @@ void IFC4X3::IfcCostSchedule::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCostSchedule::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributes( visitor );
+	visitor.visitObject( 6, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 7, "Status", m_Status );
+	visitor.visitObject( 8, "SubmittedOn", m_SubmittedOn );
+	visitor.visitObject( 9, "UpdateDate", m_UpdateDate );
+}
+void IFC4X3::IfcCostSchedule::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCostSchedule::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcControl::setInverseCounterparts( ptr_self_entity );
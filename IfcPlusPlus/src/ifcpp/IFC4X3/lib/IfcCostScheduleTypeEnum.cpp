@@ -27,6 +27,10 @@ void IFC4X3::IfcCostScheduleTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCostScheduleTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcCostScheduleTypeEnum> IFC4X3::IfcCostScheduleTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCostScheduleTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcCostScheduleTypeEnum> IFC4X3::IfcCostScheduleTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCostScheduleTypeEnum> IFC4X3::IfcCostScheduleTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcCostScheduleTypeEnum>(); }
+		return shared_ptr<IfcCostScheduleTypeEnum>( new IfcCostScheduleTypeEnum( IfcCostScheduleTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
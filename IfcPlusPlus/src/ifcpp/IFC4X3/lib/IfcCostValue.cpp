@@ -56,6 +56,21 @@ void IFC4X3::IfcCostValue::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 9 ){readEntityReferenceList( args[9], m_Components, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcCostValue, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCostValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AppliedValue = IfcAppliedValueSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_UnitBasis, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableDate = IfcDate::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_FixedUntilDate = IfcDate::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Category = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Condition = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ArithmeticOperator = IfcArithmeticOperatorEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReferenceList( args[9], m_Components, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcCostValue, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCostValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAppliedValue::getAttributes( vec_attributes );
@@ -64,6 +79,14 @@ void IFC4X3::IfcCostValue::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcAppliedValue::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCostValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAppliedValue::visitAttributes( visitor );
+}
+void IFC4X3::IfcCostValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAppliedValue::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCostValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAppliedValue::setInverseCounterparts( ptr_self_entity );
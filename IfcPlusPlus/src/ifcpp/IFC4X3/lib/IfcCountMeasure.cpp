@@ -18,6 +18,10 @@ void IFC4X3::IfcCountMeasure::getStepParameter( std::stringstream& stream, bool
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCountMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcCountMeasure> IFC4X3::IfcCountMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCountMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcCountMeasure> IFC4X3::IfcCountMeasure::createObjectFromSTE
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCountMeasure> IFC4X3::IfcCountMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcCountMeasure>(); }
+	shared_ptr<IfcCountMeasure> type_object( new IfcCountMeasure() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
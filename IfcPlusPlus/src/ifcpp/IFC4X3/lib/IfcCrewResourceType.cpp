@@ -70,6 +70,23 @@ void IFC4X3::IfcCrewResourceType::readStepArguments( const std::vector<std::stri
 	if( num_args > 11 ){m_PredefinedType = IfcCrewResourceTypeEnum::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcCrewResourceType, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCrewResourceType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongDescription = IfcText::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ResourceType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReferenceList( args[9], m_BaseCosts, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_BaseQuantity, map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_PredefinedType = IfcCrewResourceTypeEnum::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcCrewResourceType, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCrewResourceType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConstructionResourceType::getAttributes( vec_attributes );
@@ -79,6 +96,15 @@ void IFC4X3::IfcCrewResourceType::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcConstructionResourceType::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCrewResourceType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstructionResourceType::visitAttributes( visitor );
+	visitor.visitObject( 11, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcCrewResourceType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstructionResourceType::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCrewResourceType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConstructionResourceType::setInverseCounterparts( ptr_self_entity );
@@ -21,3 +21,10 @@ shared_ptr<IFC4X3::IfcCsgSelect> IFC4X3::IfcCsgSelect::createObjectFromSTEP( con
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcCsgSelect> IFC4X3::IfcCsgSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcCsgSelect>(); }
+	shared_ptr<IfcCsgSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcCsgSolid::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 0 ){m_TreeRootExpression = IfcCsgSelect::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcCsgSolid, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCsgSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_TreeRootExpression = IfcCsgSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcCsgSolid, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCsgSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSolidModel::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcCsgSolid::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcSolidModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCsgSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributes( visitor );
+	visitor.visitObject( 0, "TreeRootExpression", m_TreeRootExpression );
+}
+void IFC4X3::IfcCsgSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCsgSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSolidModel::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,12 @@ void IFC4X3::IfcCsgSolid::unlinkFromInverseCounterparts()
 {
 	IfcSolidModel::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCsgSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSolidModel::getEntityReferences( refs );
+	BuildingEntity* TreeRootExpression_entity = dynamic_cast<BuildingEntity*>( m_TreeRootExpression.get() );
+	if( TreeRootExpression_entity )
+	{
+		refs.push_back( TreeRootExpression_entity );
+	}
+}
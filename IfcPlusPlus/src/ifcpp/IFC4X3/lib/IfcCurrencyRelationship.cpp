@@ -45,6 +45,18 @@ void IFC4X3::IfcCurrencyRelationship::readStepArguments( const std::vector<std::
 	if( num_args > 6 ){readEntityReference( args[6], m_RateSource, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcCurrencyRelationship, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurrencyRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingMonetaryUnit, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_RelatedMonetaryUnit, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ExchangeRate = IfcPositiveRatioMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RateDateTime = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RateSource, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcCurrencyRelationship, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurrencyRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -58,6 +70,19 @@ void IFC4X3::IfcCurrencyRelationship::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurrencyRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingMonetaryUnit", m_RelatingMonetaryUnit );
+	visitor.visitObject( 3, "RelatedMonetaryUnit", m_RelatedMonetaryUnit );
+	visitor.visitObject( 4, "ExchangeRate", m_ExchangeRate );
+	visitor.visitObject( 5, "RateDateTime", m_RateDateTime );
+	visitor.visitObject( 6, "RateSource", m_RateSource );
+}
+void IFC4X3::IfcCurrencyRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurrencyRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -66,3 +91,19 @@ void IFC4X3::IfcCurrencyRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurrencyRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingMonetaryUnit )
+	{
+		refs.push_back( m_RelatingMonetaryUnit.get() );
+	}
+	if( m_RelatedMonetaryUnit )
+	{
+		refs.push_back( m_RelatedMonetaryUnit.get() );
+	}
+	if( m_RateSource )
+	{
+		refs.push_back( m_RateSource.get() );
+	}
+}
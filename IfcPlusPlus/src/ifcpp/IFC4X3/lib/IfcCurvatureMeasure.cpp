@@ -18,6 +18,10 @@ void IFC4X3::IfcCurvatureMeasure::getStepParameter( std::stringstream& stream, b
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcCurvatureMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcCurvatureMeasure> IFC4X3::IfcCurvatureMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcCurvatureMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcCurvatureMeasure> IFC4X3::IfcCurvatureMeasure::createObjec
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcCurvatureMeasure> IFC4X3::IfcCurvatureMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcCurvatureMeasure>(); }
+	shared_ptr<IfcCurvatureMeasure> type_object( new IfcCurvatureMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcCurveBoundedPlane::readStepArguments( const std::vector<std::str
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_InnerBoundaries, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveBoundedPlane, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveBoundedPlane::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OuterBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_InnerBoundaries, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveBoundedPlane, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveBoundedPlane::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedSurface::getAttributes( vec_attributes );
@@ -44,6 +52,17 @@ void IFC4X3::IfcCurveBoundedPlane::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcBoundedSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveBoundedPlane::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisSurface", m_BasisSurface );
+	visitor.visitObject( 1, "OuterBoundary", m_OuterBoundary );
+	visitor.visitList( 2, "InnerBoundaries", AttributeVectorView<IfcCurve>( m_InnerBoundaries ) );
+}
+void IFC4X3::IfcCurveBoundedPlane::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveBoundedPlane::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedSurface::setInverseCounterparts( ptr_self_entity );
@@ -52,3 +71,22 @@ void IFC4X3::IfcCurveBoundedPlane::unlinkFromInverseCounterparts()
 {
 	IfcBoundedSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveBoundedPlane::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedSurface::getEntityReferences( refs );
+	if( m_BasisSurface )
+	{
+		refs.push_back( m_BasisSurface.get() );
+	}
+	if( m_OuterBoundary )
+	{
+		refs.push_back( m_OuterBoundary.get() );
+	}
+	for( size_t i=0; i<m_InnerBoundaries.size(); ++i )
+	{
+		if( m_InnerBoundaries[i] )
+		{
+			refs.push_back( m_InnerBoundaries[i].get() );
+		}
+	}
+}
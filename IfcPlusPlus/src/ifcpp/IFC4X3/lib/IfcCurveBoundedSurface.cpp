@@ -32,6 +32,14 @@ void IFC4X3::IfcCurveBoundedSurface::readStepArguments( const std::vector<std::s
 	if( num_args > 2 ){m_ImplicitOuter = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveBoundedSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveBoundedSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Boundaries, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ImplicitOuter = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveBoundedSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveBoundedSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedSurface::getAttributes( vec_attributes );
@@ -45,6 +53,17 @@ void IFC4X3::IfcCurveBoundedSurface::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcBoundedSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveBoundedSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisSurface", m_BasisSurface );
+	visitor.visitList( 1, "Boundaries", AttributeVectorView<IfcBoundaryCurve>( m_Boundaries ) );
+	visitor.visitObject( 2, "ImplicitOuter", m_ImplicitOuter );
+}
+void IFC4X3::IfcCurveBoundedSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveBoundedSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedSurface::setInverseCounterparts( ptr_self_entity );
@@ -53,3 +72,18 @@ void IFC4X3::IfcCurveBoundedSurface::unlinkFromInverseCounterparts()
 {
 	IfcBoundedSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveBoundedSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedSurface::getEntityReferences( refs );
+	if( m_BasisSurface )
+	{
+		refs.push_back( m_BasisSurface.get() );
+	}
+	for( size_t i=0; i<m_Boundaries.size(); ++i )
+	{
+		if( m_Boundaries[i] )
+		{
+			refs.push_back( m_Boundaries[i].get() );
+		}
+	}
+}
@@ -22,3 +22,10 @@ shared_ptr<IFC4X3::IfcCurveFontOrScaledCurveFontSelect> IFC4X3::IfcCurveFontOrSc
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcCurveFontOrScaledCurveFontSelect> IFC4X3::IfcCurveFontOrScaledCurveFontSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcCurveFontOrScaledCurveFontSelect>(); }
+	shared_ptr<IfcCurveFontOrScaledCurveFontSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
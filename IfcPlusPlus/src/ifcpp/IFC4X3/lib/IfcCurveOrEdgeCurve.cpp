@@ -21,3 +21,10 @@ shared_ptr<IFC4X3::IfcCurveOrEdgeCurve> IFC4X3::IfcCurveOrEdgeCurve::createObjec
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcCurveOrEdgeCurve> IFC4X3::IfcCurveOrEdgeCurve::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcCurveOrEdgeCurve>(); }
+	shared_ptr<IfcCurveOrEdgeCurve> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -40,6 +40,16 @@ void IFC4X3::IfcCurveSegment::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){readEntityReference( args[4], m_ParentCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCurveSegment, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Transition = IfcTransitionCode::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Placement, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SegmentStart = IfcCurveMeasureSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SegmentLength = IfcCurveMeasureSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ParentCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCurveSegment, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSegment::getAttributes( vec_attributes );
@@ -52,6 +62,18 @@ void IFC4X3::IfcCurveSegment::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcSegment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSegment::visitAttributes( visitor );
+	visitor.visitObject( 1, "Placement", m_Placement );
+	visitor.visitObject( 2, "SegmentStart", m_SegmentStart );
+	visitor.visitObject( 3, "SegmentLength", m_SegmentLength );
+	visitor.visitObject( 4, "ParentCurve", m_ParentCurve );
+}
+void IFC4X3::IfcCurveSegment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSegment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveSegment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSegment::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +82,15 @@ void IFC4X3::IfcCurveSegment::unlinkFromInverseCounterparts()
 {
 	IfcSegment::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveSegment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSegment::getEntityReferences( refs );
+	if( m_Placement )
+	{
+		refs.push_back( m_Placement.get() );
+	}
+	if( m_ParentCurve )
+	{
+		refs.push_back( m_ParentCurve.get() );
+	}
+}
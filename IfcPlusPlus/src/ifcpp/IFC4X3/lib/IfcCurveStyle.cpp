@@ -38,6 +38,16 @@ void IFC4X3::IfcCurveStyle::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 4 ){m_ModelOrDraughting = IfcBoolean::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCurveStyle, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CurveFont = IfcCurveFontOrScaledCurveFontSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CurveWidth = IfcSizeSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_CurveColour = IfcColour::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ModelOrDraughting = IfcBoolean::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcCurveStyle, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationStyle::getAttributes( vec_attributes );
@@ -50,6 +60,18 @@ void IFC4X3::IfcCurveStyle::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcPresentationStyle::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributes( visitor );
+	visitor.visitObject( 1, "CurveFont", m_CurveFont );
+	visitor.visitObject( 2, "CurveWidth", m_CurveWidth );
+	visitor.visitObject( 3, "CurveColour", m_CurveColour );
+	visitor.visitObject( 4, "ModelOrDraughting", m_ModelOrDraughting );
+}
+void IFC4X3::IfcCurveStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationStyle::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +80,17 @@ void IFC4X3::IfcCurveStyle::unlinkFromInverseCounterparts()
 {
 	IfcPresentationStyle::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveStyle::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationStyle::getEntityReferences( refs );
+	BuildingEntity* CurveFont_entity = dynamic_cast<BuildingEntity*>( m_CurveFont.get() );
+	if( CurveFont_entity )
+	{
+		refs.push_back( CurveFont_entity );
+	}
+	BuildingEntity* CurveColour_entity = dynamic_cast<BuildingEntity*>( m_CurveColour.get() );
+	if( CurveColour_entity )
+	{
+		refs.push_back( CurveColour_entity );
+	}
+}
@@ -26,6 +26,13 @@ void IFC4X3::IfcCurveStyleFont::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_PatternList, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFont, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveStyleFont::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_PatternList, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFont, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveStyleFont::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcCurveStyleFont::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveStyleFont::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitList( 1, "PatternList", AttributeVectorView<IfcCurveStyleFontPattern>( m_PatternList ) );
+}
+void IFC4X3::IfcCurveStyleFont::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveStyleFont::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,14 @@ void IFC4X3::IfcCurveStyleFont::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveStyleFont::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_PatternList.size(); ++i )
+	{
+		if( m_PatternList[i] )
+		{
+			refs.push_back( m_PatternList[i].get() );
+		}
+	}
+}
@@ -30,6 +30,14 @@ void IFC4X3::IfcCurveStyleFontAndScaling::readStepArguments( const std::vector<s
 	if( num_args > 2 ){m_CurveFontScaling = IfcPositiveRatioMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFontAndScaling, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveStyleFontAndScaling::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CurveStyleFont = IfcCurveStyleFontSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CurveFontScaling = IfcPositiveRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFontAndScaling, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveStyleFontAndScaling::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -41,6 +49,17 @@ void IFC4X3::IfcCurveStyleFontAndScaling::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveStyleFontAndScaling::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "CurveStyleFont", m_CurveStyleFont );
+	visitor.visitObject( 2, "CurveFontScaling", m_CurveFontScaling );
+}
+void IFC4X3::IfcCurveStyleFontAndScaling::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveStyleFontAndScaling::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +68,12 @@ void IFC4X3::IfcCurveStyleFontAndScaling::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcCurveStyleFontAndScaling::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	BuildingEntity* CurveStyleFont_entity = dynamic_cast<BuildingEntity*>( m_CurveStyleFont.get() );
+	if( CurveStyleFont_entity )
+	{
+		refs.push_back( CurveStyleFont_entity );
+	}
+}
@@ -26,6 +26,13 @@ void IFC4X3::IfcCurveStyleFontPattern::readStepArguments( const std::vector<std:
 	if( num_args > 1 ){m_InvisibleSegmentLength = IfcPositiveLengthMeasure::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFontPattern, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcCurveStyleFontPattern::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_VisibleSegmentLength = IfcLengthMeasure::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_InvisibleSegmentLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcCurveStyleFontPattern, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcCurveStyleFontPattern::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -36,6 +43,16 @@ void IFC4X3::IfcCurveStyleFontPattern::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcCurveStyleFontPattern::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "VisibleSegmentLength", m_VisibleSegmentLength );
+	visitor.visitObject( 1, "InvisibleSegmentLength", m_InvisibleSegmentLength );
+}
+void IFC4X3::IfcCurveStyleFontPattern::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcCurveStyleFontPattern::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
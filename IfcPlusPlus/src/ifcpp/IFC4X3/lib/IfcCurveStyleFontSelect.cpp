@@ -22,3 +22,10 @@ shared_ptr<IFC4X3::IfcCurveStyleFontSelect> IFC4X3::IfcCurveStyleFontSelect::cre
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcCurveStyleFontSelect> IFC4X3::IfcCurveStyleFontSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcCurveStyleFontSelect>(); }
+	shared_ptr<IfcCurveStyleFontSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
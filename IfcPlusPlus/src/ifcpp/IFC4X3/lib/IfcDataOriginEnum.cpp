@@ -23,6 +23,10 @@ void IFC4X3::IfcDataOriginEnum::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDataOriginEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDataOriginEnum> IFC4X3::IfcDataOriginEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDataOriginEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcDataOriginEnum> IFC4X3::IfcDataOriginEnum::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDataOriginEnum> IFC4X3::IfcDataOriginEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDataOriginEnum>(); }
+		return shared_ptr<IfcDataOriginEnum>( new IfcDataOriginEnum( IfcDataOriginEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
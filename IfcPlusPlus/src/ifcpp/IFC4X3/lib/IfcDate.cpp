@@ -18,6 +18,10 @@ void IFC4X3::IfcDate::getStepParameter( std::stringstream& stream, bool is_selec
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDate::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDate> IFC4X3::IfcDate::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDate>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcDate> IFC4X3::IfcDate::createObjectFromSTEP( const std::st
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDate> IFC4X3::IfcDate::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDate>(); }
+	shared_ptr<IfcDate> type_object( new IfcDate() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
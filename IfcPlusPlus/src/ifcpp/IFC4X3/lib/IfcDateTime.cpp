@@ -18,6 +18,10 @@ void IFC4X3::IfcDateTime::getStepParameter( std::stringstream& stream, bool is_s
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDateTime::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDateTime> IFC4X3::IfcDateTime::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDateTime>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcDateTime> IFC4X3::IfcDateTime::createObjectFromSTEP( const
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDateTime> IFC4X3::IfcDateTime::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDateTime>(); }
+	shared_ptr<IfcDateTime> type_object( new IfcDateTime() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcDayInMonthNumber::getStepParameter( std::stringstream& stream, b
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDayInMonthNumber::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDayInMonthNumber> IFC4X3::IfcDayInMonthNumber::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDayInMonthNumber>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcDayInMonthNumber> IFC4X3::IfcDayInMonthNumber::createObjec
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDayInMonthNumber> IFC4X3::IfcDayInMonthNumber::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDayInMonthNumber>(); }
+	shared_ptr<IfcDayInMonthNumber> type_object( new IfcDayInMonthNumber() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcDayInWeekNumber::getStepParameter( std::stringstream& stream, bo
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDayInWeekNumber::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDayInWeekNumber> IFC4X3::IfcDayInWeekNumber::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDayInWeekNumber>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcDayInWeekNumber> IFC4X3::IfcDayInWeekNumber::createObjectF
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDayInWeekNumber> IFC4X3::IfcDayInWeekNumber::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDayInWeekNumber>(); }
+	shared_ptr<IfcDayInWeekNumber> type_object( new IfcDayInWeekNumber() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -93,3 +93,10 @@ shared_ptr<IFC4X3::IfcDerivedMeasureValue> IFC4X3::IfcDerivedMeasureValue::creat
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcDerivedMeasureValue> IFC4X3::IfcDerivedMeasureValue::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcDerivedMeasureValue>(); }
+	shared_ptr<IfcDerivedMeasureValue> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
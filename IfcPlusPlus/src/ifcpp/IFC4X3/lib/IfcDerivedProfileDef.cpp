@@ -39,6 +39,16 @@ void IFC4X3::IfcDerivedProfileDef::readStepArguments( const std::vector<std::str
 	if( num_args > 4 ){m_Label = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDerivedProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDerivedProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ParentProfile, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_Operator, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Label = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDerivedProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDerivedProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProfileDef::getAttributes( vec_attributes );
@@ -50,6 +60,17 @@ void IFC4X3::IfcDerivedProfileDef::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDerivedProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 2, "ParentProfile", m_ParentProfile );
+	visitor.visitObject( 3, "Operator", m_Operator );
+	visitor.visitObject( 4, "Label", m_Label );
+}
+void IFC4X3::IfcDerivedProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDerivedProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +79,15 @@ void IFC4X3::IfcDerivedProfileDef::unlinkFromInverseCounterparts()
 {
 	IfcProfileDef::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcDerivedProfileDef::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProfileDef::getEntityReferences( refs );
+	if( m_ParentProfile )
+	{
+		refs.push_back( m_ParentProfile.get() );
+	}
+	if( m_Operator )
+	{
+		refs.push_back( m_Operator.get() );
+	}
+}
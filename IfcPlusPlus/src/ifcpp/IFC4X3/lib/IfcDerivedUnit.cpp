@@ -33,6 +33,15 @@ void IFC4X3::IfcDerivedUnit::readStepArguments( const std::vector<std::string>&
 	if( num_args > 3 ){m_Name = IfcLabel::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcDerivedUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDerivedUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Elements, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcDerivedUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedType = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Name = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcDerivedUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDerivedUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> Elements_vec_object( new AttributeObjectVector() );
@@ -45,9 +54,29 @@ void IFC4X3::IfcDerivedUnit::getAttributes( std::vector<std::pair<std::string, s
 void IFC4X3::IfcDerivedUnit::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcDerivedUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "Elements", AttributeVectorView<IfcDerivedUnitElement>( m_Elements ) );
+	visitor.visitObject( 1, "UnitType", m_UnitType );
+	visitor.visitObject( 2, "UserDefinedType", m_UserDefinedType );
+	visitor.visitObject( 3, "Name", m_Name );
+}
+void IFC4X3::IfcDerivedUnit::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcDerivedUnit::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcDerivedUnit::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcDerivedUnit::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Elements.size(); ++i )
+	{
+		if( m_Elements[i] )
+		{
+			refs.push_back( m_Elements[i].get() );
+		}
+	}
+}
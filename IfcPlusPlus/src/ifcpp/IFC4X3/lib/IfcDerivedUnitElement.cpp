@@ -25,6 +25,13 @@ void IFC4X3::IfcDerivedUnitElement::readStepArguments( const std::vector<std::st
 	if( num_args > 1 ){readIntegerValue( args[1], m_Exponent );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcDerivedUnitElement, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDerivedUnitElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Unit, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readIntegerValue( args[1], m_Exponent );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcDerivedUnitElement, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDerivedUnitElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Unit", m_Unit ) );
@@ -33,9 +40,24 @@ void IFC4X3::IfcDerivedUnitElement::getAttributes( std::vector<std::pair<std::st
 void IFC4X3::IfcDerivedUnitElement::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcDerivedUnitElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Unit", m_Unit );
+	visitor.visitInteger( 1, "Exponent", m_Exponent );
+}
+void IFC4X3::IfcDerivedUnitElement::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcDerivedUnitElement::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcDerivedUnitElement::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcDerivedUnitElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_Unit )
+	{
+		refs.push_back( m_Unit.get() );
+	}
+}
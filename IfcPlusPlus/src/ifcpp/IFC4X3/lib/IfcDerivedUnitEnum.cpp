@@ -71,6 +71,10 @@ void IFC4X3::IfcDerivedUnitEnum::getStepParameter( std::stringstream& stream, bo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDerivedUnitEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDerivedUnitEnum> IFC4X3::IfcDerivedUnitEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDerivedUnitEnum>(); }
@@ -291,3 +295,12 @@ shared_ptr<IFC4X3::IfcDerivedUnitEnum> IFC4X3::IfcDerivedUnitEnum::createObjectF
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDerivedUnitEnum> IFC4X3::IfcDerivedUnitEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_USERDEFINED ) { return shared_ptr<IfcDerivedUnitEnum>(); }
+		return shared_ptr<IfcDerivedUnitEnum>( new IfcDerivedUnitEnum( IfcDerivedUnitEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -19,6 +19,10 @@ void IFC4X3::IfcDescriptiveMeasure::getStepParameter( std::stringstream& stream,
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDescriptiveMeasure::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDescriptiveMeasure> IFC4X3::IfcDescriptiveMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDescriptiveMeasure>(); }
@@ -28,3 +32,10 @@ shared_ptr<IFC4X3::IfcDescriptiveMeasure> IFC4X3::IfcDescriptiveMeasure::createO
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDescriptiveMeasure> IFC4X3::IfcDescriptiveMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDescriptiveMeasure>(); }
+	shared_ptr<IfcDescriptiveMeasure> type_object( new IfcDescriptiveMeasure() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
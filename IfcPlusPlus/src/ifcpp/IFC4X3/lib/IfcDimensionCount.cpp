@@ -17,6 +17,10 @@ void IFC4X3::IfcDimensionCount::getStepParameter( std::stringstream& stream, boo
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDimensionCount::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDimensionCount> IFC4X3::IfcDimensionCount::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDimensionCount>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcDimensionCount> IFC4X3::IfcDimensionCount::createObjectFro
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDimensionCount> IFC4X3::IfcDimensionCount::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDimensionCount>(); }
+	shared_ptr<IfcDimensionCount> type_object( new IfcDimensionCount() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
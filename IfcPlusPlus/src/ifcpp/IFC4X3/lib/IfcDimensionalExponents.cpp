@@ -39,6 +39,18 @@ void IFC4X3::IfcDimensionalExponents::readStepArguments( const std::vector<std::
 	if( num_args > 6 ){readIntegerValue( args[6], m_LuminousIntensityExponent );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcDimensionalExponents, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDimensionalExponents::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readIntegerValue( args[0], m_LengthExponent );}
+	if( num_args > 1 ){readIntegerValue( args[1], m_MassExponent );}
+	if( num_args > 2 ){readIntegerValue( args[2], m_TimeExponent );}
+	if( num_args > 3 ){readIntegerValue( args[3], m_ElectricCurrentExponent );}
+	if( num_args > 4 ){readIntegerValue( args[4], m_ThermodynamicTemperatureExponent );}
+	if( num_args > 5 ){readIntegerValue( args[5], m_AmountOfSubstanceExponent );}
+	if( num_args > 6 ){readIntegerValue( args[6], m_LuminousIntensityExponent );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcDimensionalExponents, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDimensionalExponents::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "LengthExponent", shared_ptr<IntegerAttribute>( new IntegerAttribute( m_LengthExponent ) ) ) );
@@ -52,6 +64,19 @@ void IFC4X3::IfcDimensionalExponents::getAttributes( std::vector<std::pair<std::
 void IFC4X3::IfcDimensionalExponents::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcDimensionalExponents::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitInteger( 0, "LengthExponent", m_LengthExponent );
+	visitor.visitInteger( 1, "MassExponent", m_MassExponent );
+	visitor.visitInteger( 2, "TimeExponent", m_TimeExponent );
+	visitor.visitInteger( 3, "ElectricCurrentExponent", m_ElectricCurrentExponent );
+	visitor.visitInteger( 4, "ThermodynamicTemperatureExponent", m_ThermodynamicTemperatureExponent );
+	visitor.visitInteger( 5, "AmountOfSubstanceExponent", m_AmountOfSubstanceExponent );
+	visitor.visitInteger( 6, "LuminousIntensityExponent", m_LuminousIntensityExponent );
+}
+void IFC4X3::IfcDimensionalExponents::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcDimensionalExponents::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -20,6 +20,10 @@ void IFC4X3::IfcDirectionSenseEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDirectionSenseEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDirectionSenseEnum> IFC4X3::IfcDirectionSenseEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDirectionSenseEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcDirectionSenseEnum> IFC4X3::IfcDirectionSenseEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDirectionSenseEnum> IFC4X3::IfcDirectionSenseEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_POSITIVE ) { return shared_ptr<IfcDirectionSenseEnum>(); }
+		return shared_ptr<IfcDirectionSenseEnum>( new IfcDirectionSenseEnum( IfcDirectionSenseEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -39,6 +39,16 @@ void IFC4X3::IfcDirectrixCurveSweptAreaSolid::readStepArguments( const std::vect
 	if( num_args > 4 ){m_EndParam = IfcCurveMeasureSelect::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDirectrixCurveSweptAreaSolid, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDirectrixCurveSweptAreaSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartParam = IfcCurveMeasureSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EndParam = IfcCurveMeasureSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDirectrixCurveSweptAreaSolid, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDirectrixCurveSweptAreaSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSweptAreaSolid::getAttributes( vec_attributes );
@@ -50,6 +60,17 @@ void IFC4X3::IfcDirectrixCurveSweptAreaSolid::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcSweptAreaSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDirectrixCurveSweptAreaSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptAreaSolid::visitAttributes( visitor );
+	visitor.visitObject( 2, "Directrix", m_Directrix );
+	visitor.visitObject( 3, "StartParam", m_StartParam );
+	visitor.visitObject( 4, "EndParam", m_EndParam );
+}
+void IFC4X3::IfcDirectrixCurveSweptAreaSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptAreaSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDirectrixCurveSweptAreaSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSweptAreaSolid::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +79,11 @@ void IFC4X3::IfcDirectrixCurveSweptAreaSolid::unlinkFromInverseCounterparts()
 {
 	IfcSweptAreaSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcDirectrixCurveSweptAreaSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSweptAreaSolid::getEntityReferences( refs );
+	if( m_Directrix )
+	{
+		refs.push_back( m_Directrix.get() );
+	}
+}
@@ -43,6 +43,17 @@ void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::readStepArguments( cons
 	if( num_args > 5 ){readEntityReference( args[5], m_FixedReference, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcDirectrixDerivedReferenceSweptAreaSolid, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartParam = IfcCurveMeasureSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EndParam = IfcCurveMeasureSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_FixedReference, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcDirectrixDerivedReferenceSweptAreaSolid, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFixedReferenceSweptAreaSolid::getAttributes( vec_attributes );
@@ -51,6 +62,14 @@ void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::getAttributesInverse( s
 {
 	IFC4X3::IfcFixedReferenceSweptAreaSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFixedReferenceSweptAreaSolid::visitAttributes( visitor );
+}
+void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFixedReferenceSweptAreaSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDirectrixDerivedReferenceSweptAreaSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFixedReferenceSweptAreaSolid::setInverseCounterparts( ptr_self_entity );
@@ -41,6 +41,10 @@ void IFC4X3::IfcDiscreteAccessoryTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDiscreteAccessoryTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDiscreteAccessoryTypeEnum> IFC4X3::IfcDiscreteAccessoryTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDiscreteAccessoryTypeEnum>(); }
@@ -141,3 +145,12 @@ shared_ptr<IFC4X3::IfcDiscreteAccessoryTypeEnum> IFC4X3::IfcDiscreteAccessoryTyp
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDiscreteAccessoryTypeEnum> IFC4X3::IfcDiscreteAccessoryTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDiscreteAccessoryTypeEnum>(); }
+		return shared_ptr<IfcDiscreteAccessoryTypeEnum>( new IfcDiscreteAccessoryTypeEnum( IfcDiscreteAccessoryTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -55,6 +55,18 @@ void IFC4X3::IfcDistributionCircuit::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){m_PredefinedType = IfcDistributionSystemEnum::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcDistributionCircuit, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDistributionCircuit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LongName = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PredefinedType = IfcDistributionSystemEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcDistributionCircuit, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDistributionCircuit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcDistributionSystem::getAttributes( vec_attributes );
@@ -63,6 +75,14 @@ void IFC4X3::IfcDistributionCircuit::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcDistributionSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDistributionCircuit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionSystem::visitAttributes( visitor );
+}
+void IFC4X3::IfcDistributionCircuit::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDistributionCircuit::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcDistributionSystem::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +71,19 @@ void IFC4X3::IfcDistributionElement::readStepArguments( const std::vector<std::s
 	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcDistributionElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDistributionElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcDistributionElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDistributionElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcElement::getAttributes( vec_attributes );
@@ -88,6 +101,15 @@ void IFC4X3::IfcDistributionElement::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasPorts_inverse", HasPorts_inverse_vec_obj ) );
 }
+void IFC4X3::IfcDistributionElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElement::visitAttributes( visitor );
+}
+void IFC4X3::IfcDistributionElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElement::visitAttributesInverse( visitor );
+	visitor.visitList( 26, "HasPorts_inverse", AttributeInverseVectorView<IfcRelConnectsPortToElement>( m_HasPorts_inverse ) );
+}
 void IFC4X3::IfcDistributionElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcElement::setInverseCounterparts( ptr_self_entity );
@@ -72,6 +72,19 @@ void IFC4X3::IfcDistributionFlowElement::readStepArguments( const std::vector<st
 	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcDistributionFlowElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDistributionFlowElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcDistributionFlowElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDistributionFlowElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcDistributionElement::getAttributes( vec_attributes );
@@ -89,6 +102,15 @@ void IFC4X3::IfcDistributionFlowElement::getAttributesInverse( std::vector<std::
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasControlElements_inverse", HasControlElements_inverse_vec_obj ) );
 }
+void IFC4X3::IfcDistributionFlowElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionElement::visitAttributes( visitor );
+}
+void IFC4X3::IfcDistributionFlowElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDistributionElement::visitAttributesInverse( visitor );
+	visitor.visitList( 27, "HasControlElements_inverse", AttributeInverseVectorView<IfcRelFlowControlElements>( m_HasControlElements_inverse ) );
+}
 void IFC4X3::IfcDistributionFlowElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcDistributionElement::setInverseCounterparts( ptr_self_entity );
@@ -70,6 +70,21 @@ void IFC4X3::IfcDistributionPort::readStepArguments( const std::vector<std::stri
 	if( num_args > 9 ){m_SystemType = IfcDistributionSystemEnum::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcDistributionPort, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDistributionPort::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_FlowDirection = IfcFlowDirectionEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcDistributionPortTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_SystemType = IfcDistributionSystemEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcDistributionPort, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDistributionPort::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPort::getAttributes( vec_attributes );
@@ -81,6 +96,17 @@ void IFC4X3::IfcDistributionPort::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcPort::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDistributionPort::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPort::visitAttributes( visitor );
+	visitor.visitObject( 7, "FlowDirection", m_FlowDirection );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 9, "SystemType", m_SystemType );
+}
+void IFC4X3::IfcDistributionPort::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPort::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDistributionPort::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPort::setInverseCounterparts( ptr_self_entity );
@@ -25,6 +25,10 @@ void IFC4X3::IfcDistributionPortTypeEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDistributionPortTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDistributionPortTypeEnum> IFC4X3::IfcDistributionPortTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDistributionPortTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcDistributionPortTypeEnum> IFC4X3::IfcDistributionPortTypeE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDistributionPortTypeEnum> IFC4X3::IfcDistributionPortTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDistributionPortTypeEnum>(); }
+		return shared_ptr<IfcDistributionPortTypeEnum>( new IfcDistributionPortTypeEnum( IfcDistributionPortTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
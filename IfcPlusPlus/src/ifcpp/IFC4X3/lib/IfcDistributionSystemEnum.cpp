@@ -69,6 +69,10 @@ void IFC4X3::IfcDistributionSystemEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDistributionSystemEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDistributionSystemEnum> IFC4X3::IfcDistributionSystemEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDistributionSystemEnum>(); }
@@ -281,3 +285,12 @@ shared_ptr<IFC4X3::IfcDistributionSystemEnum> IFC4X3::IfcDistributionSystemEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDistributionSystemEnum> IFC4X3::IfcDistributionSystemEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDistributionSystemEnum>(); }
+		return shared_ptr<IfcDistributionSystemEnum>( new IfcDistributionSystemEnum( IfcDistributionSystemEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
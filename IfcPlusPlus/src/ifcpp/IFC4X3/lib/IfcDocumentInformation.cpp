@@ -102,6 +102,28 @@ void IFC4X3::IfcDocumentInformation::readStepArguments( const std::vector<std::s
 	if( num_args > 16 ){m_Status = IfcDocumentStatusEnum::createObjectFromSTEP( args[16], map, errorStream, entityIdNotFound );}
 	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcDocumentInformation, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDocumentInformation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Name = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Location = IfcURIReference::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Purpose = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_IntendedUse = IfcText::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Scope = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Revision = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_DocumentOwner = IfcActorSelect::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readSelectList( args[9], m_Editors, "IFCACTORSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_CreationTime = IfcDateTime::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_LastRevisionTime = IfcDateTime::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_ElectronicFormat = IfcIdentifier::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_ValidFrom = IfcDate::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_ValidUntil = IfcDate::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_Confidentiality = IfcDocumentConfidentialityEnum::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_Status = IfcDocumentStatusEnum::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcDocumentInformation, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDocumentInformation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalInformation::getAttributes( vec_attributes );
@@ -165,6 +187,35 @@ void IFC4X3::IfcDocumentInformation::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "IsPointer_inverse", IsPointer_inverse_vec_obj ) );
 }
+void IFC4X3::IfcDocumentInformation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributes( visitor );
+	visitor.visitObject( 0, "Identification", m_Identification );
+	visitor.visitObject( 1, "Name", m_Name );
+	visitor.visitObject( 2, "Description", m_Description );
+	visitor.visitObject( 3, "Location", m_Location );
+	visitor.visitObject( 4, "Purpose", m_Purpose );
+	visitor.visitObject( 5, "IntendedUse", m_IntendedUse );
+	visitor.visitObject( 6, "Scope", m_Scope );
+	visitor.visitObject( 7, "Revision", m_Revision );
+	visitor.visitObject( 8, "DocumentOwner", m_DocumentOwner );
+	visitor.visitList( 9, "Editors", AttributeVectorView<IfcActorSelect>( m_Editors ) );
+	visitor.visitObject( 10, "CreationTime", m_CreationTime );
+	visitor.visitObject( 11, "LastRevisionTime", m_LastRevisionTime );
+	visitor.visitObject( 12, "ElectronicFormat", m_ElectronicFormat );
+	visitor.visitObject( 13, "ValidFrom", m_ValidFrom );
+	visitor.visitObject( 14, "ValidUntil", m_ValidUntil );
+	visitor.visitObject( 15, "Confidentiality", m_Confidentiality );
+	visitor.visitObject( 16, "Status", m_Status );
+}
+void IFC4X3::IfcDocumentInformation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "DocumentInfoForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesDocument>( m_DocumentInfoForObjects_inverse ) );
+	visitor.visitList( 1, "HasDocumentReferences_inverse", AttributeInverseVectorView<IfcDocumentReference>( m_HasDocumentReferences_inverse ) );
+	visitor.visitList( 2, "IsPointedTo_inverse", AttributeInverseVectorView<IfcDocumentInformationRelationship>( m_IsPointedTo_inverse ) );
+	visitor.visitList( 3, "IsPointer_inverse", AttributeInverseVectorView<IfcDocumentInformationRelationship>( m_IsPointer_inverse ) );
+}
 void IFC4X3::IfcDocumentInformation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalInformation::setInverseCounterparts( ptr_self_entity );
@@ -173,3 +224,20 @@ void IFC4X3::IfcDocumentInformation::unlinkFromInverseCounterparts()
 {
 	IfcExternalInformation::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcDocumentInformation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExternalInformation::getEntityReferences( refs );
+	BuildingEntity* DocumentOwner_entity = dynamic_cast<BuildingEntity*>( m_DocumentOwner.get() );
+	if( DocumentOwner_entity )
+	{
+		refs.push_back( DocumentOwner_entity );
+	}
+	for( size_t i=0; i<m_Editors.size(); ++i )
+	{
+		BuildingEntity* Editors_entity = dynamic_cast<BuildingEntity*>( m_Editors[i].get() );
+		if( Editors_entity )
+		{
+			refs.push_back( Editors_entity );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentInformation.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentInformationRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -36,6 +37,16 @@ void IFC4X3::IfcDocumentInformationRelationship::readStepArguments( const std::v
 	if( num_args > 4 ){m_RelationshipType = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDocumentInformationRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDocumentInformationRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingDocument, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedDocuments, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelationshipType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDocumentInformationRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDocumentInformationRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -49,6 +60,17 @@ void IFC4X3::IfcDocumentInformationRelationship::getAttributesInverse( std::vect
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDocumentInformationRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingDocument", m_RelatingDocument );
+	visitor.visitList( 3, "RelatedDocuments", AttributeVectorView<IfcDocumentInformation>( m_RelatedDocuments ) );
+	visitor.visitObject( 4, "RelationshipType", m_RelationshipType );
+}
+void IFC4X3::IfcDocumentInformationRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDocumentInformationRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,21 @@ void IFC4X3::IfcDocumentInformationRelationship::setInverseCounterparts( shared_
 		m_RelatingDocument->m_IsPointer_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcDocumentInformationRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedDocuments.size(); ++i )
+	{
+		if( m_RelatedDocuments[i] )
+		{
+			refs.emplace_back( m_RelatedDocuments[i].get(), INVERSE_IsPointedTo );
+		}
+	}
+	if( m_RelatingDocument )
+	{
+		refs.emplace_back( m_RelatingDocument.get(), INVERSE_IsPointer );
+	}
+}
 void IFC4X3::IfcDocumentInformationRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -117,3 +154,18 @@ void IFC4X3::IfcDocumentInformationRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcDocumentInformationRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingDocument )
+	{
+		refs.push_back( m_RelatingDocument.get() );
+	}
+	for( size_t i=0; i<m_RelatedDocuments.size(); ++i )
+	{
+		if( m_RelatedDocuments[i] )
+		{
+			refs.push_back( m_RelatedDocuments[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentInformation.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentReference.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
@@ -40,6 +41,16 @@ void IFC4X3::IfcDocumentReference::readStepArguments( const std::vector<std::str
 	if( num_args > 4 ){readEntityReference( args[4], m_ReferencedDocument, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDocumentReference, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDocumentReference::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Location = IfcURIReference::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ReferencedDocument, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcDocumentReference, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDocumentReference::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalReference::getAttributes( vec_attributes );
@@ -59,6 +70,17 @@ void IFC4X3::IfcDocumentReference::getAttributesInverse( std::vector<std::pair<s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "DocumentRefForObjects_inverse", DocumentRefForObjects_inverse_vec_obj ) );
 }
+void IFC4X3::IfcDocumentReference::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributes( visitor );
+	visitor.visitObject( 3, "Description", m_Description );
+	visitor.visitObject( 4, "ReferencedDocument", m_ReferencedDocument );
+}
+void IFC4X3::IfcDocumentReference::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "DocumentRefForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesDocument>( m_DocumentRefForObjects_inverse ) );
+}
 void IFC4X3::IfcDocumentReference::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalReference::setInverseCounterparts( ptr_self_entity );
@@ -69,6 +91,14 @@ void IFC4X3::IfcDocumentReference::setInverseCounterparts( shared_ptr<BuildingEn
 		m_ReferencedDocument->m_HasDocumentReferences_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcDocumentReference::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcExternalReference::getInverseReferences( refs );
+	if( m_ReferencedDocument )
+	{
+		refs.emplace_back( m_ReferencedDocument.get(), INVERSE_HasDocumentReferences );
+	}
+}
 void IFC4X3::IfcDocumentReference::unlinkFromInverseCounterparts()
 {
 	IfcExternalReference::unlinkFromInverseCounterparts();
@@ -95,3 +125,11 @@ void IFC4X3::IfcDocumentReference::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcDocumentReference::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExternalReference::getEntityReferences( refs );
+	if( m_ReferencedDocument )
+	{
+		refs.push_back( m_ReferencedDocument.get() );
+	}
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcDocumentStatusEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDocumentStatusEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDocumentStatusEnum> IFC4X3::IfcDocumentStatusEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDocumentStatusEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcDocumentStatusEnum> IFC4X3::IfcDocumentStatusEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDocumentStatusEnum> IFC4X3::IfcDocumentStatusEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDocumentStatusEnum>(); }
+		return shared_ptr<IfcDocumentStatusEnum>( new IfcDocumentStatusEnum( IfcDocumentStatusEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
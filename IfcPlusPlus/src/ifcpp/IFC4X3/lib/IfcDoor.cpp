@@ -88,6 +88,24 @@ void IFC4X3::IfcDoor::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 12 ){m_UserDefinedOperationType = IfcLabel::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcDoor, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDoor::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_OverallHeight = IfcPositiveLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_OverallWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_PredefinedType = IfcDoorTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_OperationType = IfcDoorTypeOperationEnum::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_UserDefinedOperationType = IfcLabel::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcDoor, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDoor::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBuiltElement::getAttributes( vec_attributes );
@@ -101,6 +119,19 @@ void IFC4X3::IfcDoor::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcBuiltElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDoor::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElement::visitAttributes( visitor );
+	visitor.visitObject( 8, "OverallHeight", m_OverallHeight );
+	visitor.visitObject( 9, "OverallWidth", m_OverallWidth );
+	visitor.visitObject( 10, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 11, "OperationType", m_OperationType );
+	visitor.visitObject( 12, "UserDefinedOperationType", m_UserDefinedOperationType );
+}
+void IFC4X3::IfcDoor::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDoor::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBuiltElement::setInverseCounterparts( ptr_self_entity );
@@ -82,6 +82,28 @@ void IFC4X3::IfcDoorLiningProperties::readStepArguments( const std::vector<std::
 	if( num_args > 16 ){m_LiningToPanelOffsetY = IfcLengthMeasure::createObjectFromSTEP( args[16], map, errorStream, entityIdNotFound );}
 	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcDoorLiningProperties, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDoorLiningProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_LiningDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LiningThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ThresholdDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_ThresholdThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_TransomThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_TransomOffset = IfcLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_LiningOffset = IfcLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_ThresholdOffset = IfcLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_CasingThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_CasingDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){readEntityReference( args[14], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_LiningToPanelOffsetX = IfcLengthMeasure::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_LiningToPanelOffsetY = IfcLengthMeasure::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcDoorLiningProperties, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDoorLiningProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributes( vec_attributes );
@@ -103,6 +125,27 @@ void IFC4X3::IfcDoorLiningProperties::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDoorLiningProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "LiningDepth", m_LiningDepth );
+	visitor.visitObject( 5, "LiningThickness", m_LiningThickness );
+	visitor.visitObject( 6, "ThresholdDepth", m_ThresholdDepth );
+	visitor.visitObject( 7, "ThresholdThickness", m_ThresholdThickness );
+	visitor.visitObject( 8, "TransomThickness", m_TransomThickness );
+	visitor.visitObject( 9, "TransomOffset", m_TransomOffset );
+	visitor.visitObject( 10, "LiningOffset", m_LiningOffset );
+	visitor.visitObject( 11, "ThresholdOffset", m_ThresholdOffset );
+	visitor.visitObject( 12, "CasingThickness", m_CasingThickness );
+	visitor.visitObject( 13, "CasingDepth", m_CasingDepth );
+	visitor.visitObject( 14, "ShapeAspectStyle", m_ShapeAspectStyle );
+	visitor.visitObject( 15, "LiningToPanelOffsetX", m_LiningToPanelOffsetX );
+	visitor.visitObject( 16, "LiningToPanelOffsetY", m_LiningToPanelOffsetY );
+}
+void IFC4X3::IfcDoorLiningProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDoorLiningProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedPropertySet::setInverseCounterparts( ptr_self_entity );
@@ -111,3 +154,11 @@ void IFC4X3::IfcDoorLiningProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedPropertySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcDoorLiningProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedPropertySet::getEntityReferences( refs );
+	if( m_ShapeAspectStyle )
+	{
+		refs.push_back( m_ShapeAspectStyle.get() );
+	}
+}
@@ -22,6 +22,10 @@ void IFC4X3::IfcDoorPanelPositionEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDoorPanelPositionEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDoorPanelPositionEnum> IFC4X3::IfcDoorPanelPositionEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDoorPanelPositionEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcDoorPanelPositionEnum> IFC4X3::IfcDoorPanelPositionEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDoorPanelPositionEnum> IFC4X3::IfcDoorPanelPositionEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDoorPanelPositionEnum>(); }
+		return shared_ptr<IfcDoorPanelPositionEnum>( new IfcDoorPanelPositionEnum( IfcDoorPanelPositionEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -59,6 +59,20 @@ void IFC4X3::IfcDoorPanelProperties::readStepArguments( const std::vector<std::s
 	if( num_args > 8 ){readEntityReference( args[8], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcDoorPanelProperties, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDoorPanelProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_PanelDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PanelOperation = IfcDoorPanelOperationEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PanelWidth = IfcNormalisedRatioMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PanelPosition = IfcDoorPanelPositionEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcDoorPanelProperties, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDoorPanelProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributes( vec_attributes );
@@ -72,6 +86,19 @@ void IFC4X3::IfcDoorPanelProperties::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDoorPanelProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "PanelDepth", m_PanelDepth );
+	visitor.visitObject( 5, "PanelOperation", m_PanelOperation );
+	visitor.visitObject( 6, "PanelWidth", m_PanelWidth );
+	visitor.visitObject( 7, "PanelPosition", m_PanelPosition );
+	visitor.visitObject( 8, "ShapeAspectStyle", m_ShapeAspectStyle );
+}
+void IFC4X3::IfcDoorPanelProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDoorPanelProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedPropertySet::setInverseCounterparts( ptr_self_entity );
@@ -80,3 +107,11 @@ void IFC4X3::IfcDoorPanelProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedPropertySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcDoorPanelProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedPropertySet::getEntityReferences( refs );
+	if( m_ShapeAspectStyle )
+	{
+		refs.push_back( m_ShapeAspectStyle.get() );
+	}
+}
@@ -71,6 +71,23 @@ void IFC4X3::IfcDoorStyle::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 11 ){m_Sizeable = IfcBoolean::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcDoorStyle, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDoorStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_OperationType = IfcDoorStyleOperationEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_ConstructionType = IfcDoorStyleConstructionEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_ParameterTakesPrecedence = IfcBoolean::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_Sizeable = IfcBoolean::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcDoorStyle, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDoorStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTypeProduct::getAttributes( vec_attributes );
@@ -83,6 +100,18 @@ void IFC4X3::IfcDoorStyle::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcTypeProduct::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDoorStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeProduct::visitAttributes( visitor );
+	visitor.visitObject( 8, "OperationType", m_OperationType );
+	visitor.visitObject( 9, "ConstructionType", m_ConstructionType );
+	visitor.visitObject( 10, "ParameterTakesPrecedence", m_ParameterTakesPrecedence );
+	visitor.visitObject( 11, "Sizeable", m_Sizeable );
+}
+void IFC4X3::IfcDoorStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeProduct::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDoorStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTypeProduct::setInverseCounterparts( ptr_self_entity );
@@ -36,6 +36,10 @@ void IFC4X3::IfcDoorStyleOperationEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDoorStyleOperationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDoorStyleOperationEnum> IFC4X3::IfcDoorStyleOperationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDoorStyleOperationEnum>(); }
@@ -116,3 +120,12 @@ shared_ptr<IFC4X3::IfcDoorStyleOperationEnum> IFC4X3::IfcDoorStyleOperationEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDoorStyleOperationEnum> IFC4X3::IfcDoorStyleOperationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDoorStyleOperationEnum>(); }
+		return shared_ptr<IfcDoorStyleOperationEnum>( new IfcDoorStyleOperationEnum( IfcDoorStyleOperationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
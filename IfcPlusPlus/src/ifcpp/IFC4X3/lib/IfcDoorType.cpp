@@ -74,6 +74,24 @@ void IFC4X3::IfcDoorType::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 12 ){m_UserDefinedOperationType = IfcLabel::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcDoorType, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcDoorType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ElementType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcDoorTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_OperationType = IfcDoorTypeOperationEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_ParameterTakesPrecedence = IfcBoolean::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_UserDefinedOperationType = IfcLabel::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcDoorType, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcDoorType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBuiltElementType::getAttributes( vec_attributes );
@@ -86,6 +104,18 @@ void IFC4X3::IfcDoorType::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcBuiltElementType::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcDoorType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElementType::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 10, "OperationType", m_OperationType );
+	visitor.visitObject( 11, "ParameterTakesPrecedence", m_ParameterTakesPrecedence );
+	visitor.visitObject( 12, "UserDefinedOperationType", m_UserDefinedOperationType );
+}
+void IFC4X3::IfcDoorType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElementType::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcDoorType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBuiltElementType::setInverseCounterparts( ptr_self_entity );
@@ -25,6 +25,10 @@ void IFC4X3::IfcDoorTypeEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDoorTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDoorTypeEnum> IFC4X3::IfcDoorTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDoorTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcDoorTypeEnum> IFC4X3::IfcDoorTypeEnum::createObjectFromSTE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDoorTypeEnum> IFC4X3::IfcDoorTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDoorTypeEnum>(); }
+		return shared_ptr<IfcDoorTypeEnum>( new IfcDoorTypeEnum( IfcDoorTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -43,6 +43,10 @@ void IFC4X3::IfcDoorTypeOperationEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDoorTypeOperationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcDoorTypeOperationEnum> IFC4X3::IfcDoorTypeOperationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDoorTypeOperationEnum>(); }
@@ -151,3 +155,12 @@ shared_ptr<IFC4X3::IfcDoorTypeOperationEnum> IFC4X3::IfcDoorTypeOperationEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDoorTypeOperationEnum> IFC4X3::IfcDoorTypeOperationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcDoorTypeOperationEnum>(); }
+		return shared_ptr<IfcDoorTypeOperationEnum>( new IfcDoorTypeOperationEnum( IfcDoorTypeOperationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
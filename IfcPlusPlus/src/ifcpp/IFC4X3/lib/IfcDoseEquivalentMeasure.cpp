@@ -18,6 +18,10 @@ void IFC4X3::IfcDoseEquivalentMeasure::getStepParameter( std::stringstream& stre
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDoseEquivalentMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDoseEquivalentMeasure> IFC4X3::IfcDoseEquivalentMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDoseEquivalentMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcDoseEquivalentMeasure> IFC4X3::IfcDoseEquivalentMeasure::c
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDoseEquivalentMeasure> IFC4X3::IfcDoseEquivalentMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDoseEquivalentMeasure>(); }
+	shared_ptr<IfcDoseEquivalentMeasure> type_object( new IfcDoseEquivalentMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -19,6 +19,10 @@ void IFC4X3::IfcDuration::getStepParameter( std::stringstream& stream, bool is_s
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDuration::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDuration> IFC4X3::IfcDuration::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDuration>(); }
@@ -28,3 +32,10 @@ shared_ptr<IFC4X3::IfcDuration> IFC4X3::IfcDuration::createObjectFromSTEP( const
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDuration> IFC4X3::IfcDuration::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDuration>(); }
+	shared_ptr<IfcDuration> type_object( new IfcDuration() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcDynamicViscosityMeasure::getStepParameter( std::stringstream& st
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcDynamicViscosityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcDynamicViscosityMeasure> IFC4X3::IfcDynamicViscosityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcDynamicViscosityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcDynamicViscosityMeasure> IFC4X3::IfcDynamicViscosityMeasur
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcDynamicViscosityMeasure> IFC4X3::IfcDynamicViscosityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcDynamicViscosityMeasure>(); }
+	shared_ptr<IfcDynamicViscosityMeasure> type_object( new IfcDynamicViscosityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -27,6 +27,13 @@ void IFC4X3::IfcEdge::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 1 ){readEntityReference( args[1], m_EdgeEnd, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcEdge, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEdge::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_EdgeStart, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_EdgeEnd, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcEdge, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEdge::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -37,6 +44,16 @@ void IFC4X3::IfcEdge::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEdge::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "EdgeStart", m_EdgeStart );
+	visitor.visitObject( 1, "EdgeEnd", m_EdgeEnd );
+}
+void IFC4X3::IfcEdge::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEdge::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -45,3 +62,15 @@ void IFC4X3::IfcEdge::unlinkFromInverseCounterparts()
 {
 	IfcTopologicalRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcEdge::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTopologicalRepresentationItem::getEntityReferences( refs );
+	if( m_EdgeStart )
+	{
+		refs.push_back( m_EdgeStart.get() );
+	}
+	if( m_EdgeEnd )
+	{
+		refs.push_back( m_EdgeEnd.get() );
+	}
+}
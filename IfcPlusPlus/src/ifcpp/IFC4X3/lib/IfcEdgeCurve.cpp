@@ -35,6 +35,15 @@ void IFC4X3::IfcEdgeCurve::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 3 ){m_SameSense = IfcBoolean::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcEdgeCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEdgeCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_EdgeStart, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_EdgeEnd, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_EdgeGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcEdgeCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEdgeCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcEdge::getAttributes( vec_attributes );
@@ -45,6 +54,16 @@ void IFC4X3::IfcEdgeCurve::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcEdge::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEdgeCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributes( visitor );
+	visitor.visitObject( 2, "EdgeGeometry", m_EdgeGeometry );
+	visitor.visitObject( 3, "SameSense", m_SameSense );
+}
+void IFC4X3::IfcEdgeCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEdgeCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcEdge::setInverseCounterparts( ptr_self_entity );
@@ -53,3 +72,11 @@ void IFC4X3::IfcEdgeCurve::unlinkFromInverseCounterparts()
 {
 	IfcEdge::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcEdgeCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcEdge::getEntityReferences( refs );
+	if( m_EdgeGeometry )
+	{
+		refs.push_back( m_EdgeGeometry.get() );
+	}
+}
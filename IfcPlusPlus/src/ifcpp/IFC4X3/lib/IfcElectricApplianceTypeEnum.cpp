@@ -36,6 +36,10 @@ void IFC4X3::IfcElectricApplianceTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricApplianceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricApplianceTypeEnum> IFC4X3::IfcElectricApplianceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricApplianceTypeEnum>(); }
@@ -116,3 +120,12 @@ shared_ptr<IFC4X3::IfcElectricApplianceTypeEnum> IFC4X3::IfcElectricApplianceTyp
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricApplianceTypeEnum> IFC4X3::IfcElectricApplianceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcElectricApplianceTypeEnum>(); }
+		return shared_ptr<IfcElectricApplianceTypeEnum>( new IfcElectricApplianceTypeEnum( IfcElectricApplianceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcElectricChargeMeasure::getStepParameter( std::stringstream& stre
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricChargeMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricChargeMeasure> IFC4X3::IfcElectricChargeMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricChargeMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcElectricChargeMeasure> IFC4X3::IfcElectricChargeMeasure::c
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricChargeMeasure> IFC4X3::IfcElectricChargeMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcElectricChargeMeasure>(); }
+	shared_ptr<IfcElectricChargeMeasure> type_object( new IfcElectricChargeMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcElectricConductanceMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricConductanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricConductanceMeasure> IFC4X3::IfcElectricConductanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricConductanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcElectricConductanceMeasure> IFC4X3::IfcElectricConductance
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricConductanceMeasure> IFC4X3::IfcElectricConductanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcElectricConductanceMeasure>(); }
+	shared_ptr<IfcElectricConductanceMeasure> type_object( new IfcElectricConductanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
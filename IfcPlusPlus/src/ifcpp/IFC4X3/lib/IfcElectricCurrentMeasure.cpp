@@ -18,6 +18,10 @@ void IFC4X3::IfcElectricCurrentMeasure::getStepParameter( std::stringstream& str
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricCurrentMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricCurrentMeasure> IFC4X3::IfcElectricCurrentMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricCurrentMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcElectricCurrentMeasure> IFC4X3::IfcElectricCurrentMeasure:
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricCurrentMeasure> IFC4X3::IfcElectricCurrentMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcElectricCurrentMeasure>(); }
+	shared_ptr<IfcElectricCurrentMeasure> type_object( new IfcElectricCurrentMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -29,6 +29,10 @@ void IFC4X3::IfcElectricFlowStorageDeviceTypeEnum::getStepParameter( std::string
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricFlowStorageDeviceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricFlowStorageDeviceTypeEnum> IFC4X3::IfcElectricFlowStorageDeviceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricFlowStorageDeviceTypeEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcElectricFlowStorageDeviceTypeEnum> IFC4X3::IfcElectricFlow
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricFlowStorageDeviceTypeEnum> IFC4X3::IfcElectricFlowStorageDeviceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcElectricFlowStorageDeviceTypeEnum>(); }
+		return shared_ptr<IfcElectricFlowStorageDeviceTypeEnum>( new IfcElectricFlowStorageDeviceTypeEnum( IfcElectricFlowStorageDeviceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -21,6 +21,10 @@ void IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum::getStepParameter( std::stri
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum> IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricFlowTreatmentDeviceTypeEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum> IFC4X3::IfcElectricFl
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum> IFC4X3::IfcElectricFlowTreatmentDeviceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcElectricFlowTreatmentDeviceTypeEnum>(); }
+		return shared_ptr<IfcElectricFlowTreatmentDeviceTypeEnum>( new IfcElectricFlowTreatmentDeviceTypeEnum( IfcElectricFlowTreatmentDeviceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcElectricResistanceMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricResistanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricResistanceMeasure> IFC4X3::IfcElectricResistanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricResistanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcElectricResistanceMeasure> IFC4X3::IfcElectricResistanceMe
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricResistanceMeasure> IFC4X3::IfcElectricResistanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcElectricResistanceMeasure>(); }
+	shared_ptr<IfcElectricResistanceMeasure> type_object( new IfcElectricResistanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcElectricTimeControlTypeEnum::getStepParameter( std::stringstream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElectricTimeControlTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElectricTimeControlTypeEnum> IFC4X3::IfcElectricTimeControlTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElectricTimeControlTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcElectricTimeControlTypeEnum> IFC4X3::IfcElectricTimeContro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElectricTimeControlTypeEnum> IFC4X3::IfcElectricTimeControlTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcElectricTimeControlTypeEnum>(); }
+		return shared_ptr<IfcElectricTimeControlTypeEnum>( new IfcElectricTimeControlTypeEnum( IfcElectricTimeControlTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
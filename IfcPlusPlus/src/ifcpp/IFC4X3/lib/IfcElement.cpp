@@ -70,6 +70,19 @@ void IFC4X3::IfcElement::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProduct::getAttributes( vec_attributes );
@@ -187,6 +200,27 @@ void IFC4X3::IfcElement::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasSurfaceFeatures_inverse", HasSurfaceFeatures_inverse_vec_obj ) );
 }
+void IFC4X3::IfcElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributes( visitor );
+	visitor.visitObject( 7, "Tag", m_Tag );
+}
+void IFC4X3::IfcElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributesInverse( visitor );
+	visitor.visitList( 14, "FillsVoids_inverse", AttributeInverseVectorView<IfcRelFillsElement>( m_FillsVoids_inverse ) );
+	visitor.visitList( 15, "ConnectedTo_inverse", AttributeInverseVectorView<IfcRelConnectsElements>( m_ConnectedTo_inverse ) );
+	visitor.visitList( 16, "IsInterferedByElements_inverse", AttributeInverseVectorView<IfcRelInterferesElements>( m_IsInterferedByElements_inverse ) );
+	visitor.visitList( 17, "InterferesElements_inverse", AttributeInverseVectorView<IfcRelInterferesElements>( m_InterferesElements_inverse ) );
+	visitor.visitList( 18, "HasProjections_inverse", AttributeInverseVectorView<IfcRelProjectsElement>( m_HasProjections_inverse ) );
+	visitor.visitList( 19, "HasOpenings_inverse", AttributeInverseVectorView<IfcRelVoidsElement>( m_HasOpenings_inverse ) );
+	visitor.visitList( 20, "IsConnectionRealization_inverse", AttributeInverseVectorView<IfcRelConnectsWithRealizingElements>( m_IsConnectionRealization_inverse ) );
+	visitor.visitList( 21, "ProvidesBoundaries_inverse", AttributeInverseVectorView<IfcRelSpaceBoundary>( m_ProvidesBoundaries_inverse ) );
+	visitor.visitList( 22, "ConnectedFrom_inverse", AttributeInverseVectorView<IfcRelConnectsElements>( m_ConnectedFrom_inverse ) );
+	visitor.visitList( 23, "ContainedInStructure_inverse", AttributeInverseVectorView<IfcRelContainedInSpatialStructure>( m_ContainedInStructure_inverse ) );
+	visitor.visitList( 24, "HasCoverings_inverse", AttributeInverseVectorView<IfcRelCoversBldgElements>( m_HasCoverings_inverse ) );
+	visitor.visitList( 25, "HasSurfaceFeatures_inverse", AttributeInverseVectorView<IfcRelAdheresToElement>( m_HasSurfaceFeatures_inverse ) );
+}
 void IFC4X3::IfcElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProduct::setInverseCounterparts( ptr_self_entity );
@@ -48,6 +48,10 @@ void IFC4X3::IfcElementAssemblyTypeEnum::getStepParameter( std::stringstream& st
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElementAssemblyTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElementAssemblyTypeEnum> IFC4X3::IfcElementAssemblyTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElementAssemblyTypeEnum>(); }
@@ -176,3 +180,12 @@ shared_ptr<IFC4X3::IfcElementAssemblyTypeEnum> IFC4X3::IfcElementAssemblyTypeEnu
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElementAssemblyTypeEnum> IFC4X3::IfcElementAssemblyTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcElementAssemblyTypeEnum>(); }
+		return shared_ptr<IfcElementAssemblyTypeEnum>( new IfcElementAssemblyTypeEnum( IfcElementAssemblyTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -21,6 +21,10 @@ void IFC4X3::IfcElementCompositionEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcElementCompositionEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcElementCompositionEnum> IFC4X3::IfcElementCompositionEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcElementCompositionEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcElementCompositionEnum> IFC4X3::IfcElementCompositionEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcElementCompositionEnum> IFC4X3::IfcElementCompositionEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_PARTIAL ) { return shared_ptr<IfcElementCompositionEnum>(); }
+		return shared_ptr<IfcElementCompositionEnum>( new IfcElementCompositionEnum( IfcElementCompositionEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
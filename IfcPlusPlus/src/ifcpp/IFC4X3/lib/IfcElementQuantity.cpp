@@ -46,6 +46,17 @@ void IFC4X3::IfcElementQuantity::readStepArguments( const std::vector<std::strin
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_Quantities, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcElementQuantity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcElementQuantity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MethodOfMeasurement = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_Quantities, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcElementQuantity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcElementQuantity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcQuantitySet::getAttributes( vec_attributes );
@@ -58,6 +69,16 @@ void IFC4X3::IfcElementQuantity::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcQuantitySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcElementQuantity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcQuantitySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "MethodOfMeasurement", m_MethodOfMeasurement );
+	visitor.visitList( 5, "Quantities", AttributeVectorView<IfcPhysicalQuantity>( m_Quantities ) );
+}
+void IFC4X3::IfcElementQuantity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcQuantitySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcElementQuantity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcQuantitySet::setInverseCounterparts( ptr_self_entity );
@@ -66,3 +87,14 @@ void IFC4X3::IfcElementQuantity::unlinkFromInverseCounterparts()
 {
 	IfcQuantitySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcElementQuantity::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcQuantitySet::getEntityReferences( refs );
+	for( size_t i=0; i<m_Quantities.size(); ++i )
+	{
+		if( m_Quantities[i] )
+		{
+			refs.push_back( m_Quantities[i].get() );
+		}
+	}
+}
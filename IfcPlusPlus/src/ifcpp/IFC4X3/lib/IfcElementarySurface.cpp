@@ -24,6 +24,12 @@ void IFC4X3::IfcElementarySurface::readStepArguments( const std::vector<std::str
 	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcElementarySurface, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcElementarySurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcElementarySurface, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcElementarySurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurface::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcElementarySurface::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcElementarySurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "Position", m_Position );
+}
+void IFC4X3::IfcElementarySurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcElementarySurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurface::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,11 @@ void IFC4X3::IfcElementarySurface::unlinkFromInverseCounterparts()
 {
 	IfcSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcElementarySurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSurface::getEntityReferences( refs );
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcEllipse::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 2 ){m_SemiAxis2 = IfcPositiveLengthMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcEllipse, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEllipse::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SemiAxis1 = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SemiAxis2 = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcEllipse, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEllipse::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConic::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcEllipse::getAttributesInverse( std::vector<std::pair<std::string
 {
 	IFC4X3::IfcConic::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEllipse::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConic::visitAttributes( visitor );
+	visitor.visitObject( 1, "SemiAxis1", m_SemiAxis1 );
+	visitor.visitObject( 2, "SemiAxis2", m_SemiAxis2 );
+}
+void IFC4X3::IfcEllipse::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConic::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEllipse::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConic::setInverseCounterparts( ptr_self_entity );
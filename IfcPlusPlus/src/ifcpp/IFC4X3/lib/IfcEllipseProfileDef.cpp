@@ -39,6 +39,16 @@ void IFC4X3::IfcEllipseProfileDef::readStepArguments( const std::vector<std::str
 	if( num_args > 4 ){m_SemiAxis2 = IfcPositiveLengthMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcEllipseProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEllipseProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SemiAxis1 = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_SemiAxis2 = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcEllipseProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEllipseProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributes( vec_attributes );
@@ -49,6 +59,16 @@ void IFC4X3::IfcEllipseProfileDef::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEllipseProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "SemiAxis1", m_SemiAxis1 );
+	visitor.visitObject( 4, "SemiAxis2", m_SemiAxis2 );
+}
+void IFC4X3::IfcEllipseProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEllipseProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcParameterizedProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcEnergyMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcEnergyMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcEnergyMeasure> IFC4X3::IfcEnergyMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcEnergyMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcEnergyMeasure> IFC4X3::IfcEnergyMeasure::createObjectFromS
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcEnergyMeasure> IFC4X3::IfcEnergyMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcEnergyMeasure>(); }
+	shared_ptr<IfcEnergyMeasure> type_object( new IfcEnergyMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
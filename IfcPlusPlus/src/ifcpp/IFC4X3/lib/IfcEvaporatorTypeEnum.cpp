@@ -26,6 +26,10 @@ void IFC4X3::IfcEvaporatorTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcEvaporatorTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcEvaporatorTypeEnum> IFC4X3::IfcEvaporatorTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcEvaporatorTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcEvaporatorTypeEnum> IFC4X3::IfcEvaporatorTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcEvaporatorTypeEnum> IFC4X3::IfcEvaporatorTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcEvaporatorTypeEnum>(); }
+		return shared_ptr<IfcEvaporatorTypeEnum>( new IfcEvaporatorTypeEnum( IfcEvaporatorTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -69,6 +69,22 @@ void IFC4X3::IfcEvent::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 10 ){readEntityReference( args[10], m_EventOccurenceTime, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcEvent, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEvent::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcEventTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_EventTriggerType = IfcEventTriggerTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_UserDefinedEventTriggerType = IfcLabel::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_EventOccurenceTime, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcEvent, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEvent::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProcess::getAttributes( vec_attributes );
@@ -81,6 +97,18 @@ void IFC4X3::IfcEvent::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcProcess::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEvent::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributes( visitor );
+	visitor.visitObject( 7, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 8, "EventTriggerType", m_EventTriggerType );
+	visitor.visitObject( 9, "UserDefinedEventTriggerType", m_UserDefinedEventTriggerType );
+	visitor.visitObject( 10, "EventOccurenceTime", m_EventOccurenceTime );
+}
+void IFC4X3::IfcEvent::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEvent::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProcess::setInverseCounterparts( ptr_self_entity );
@@ -89,3 +117,11 @@ void IFC4X3::IfcEvent::unlinkFromInverseCounterparts()
 {
 	IfcProcess::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcEvent::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProcess::getEntityReferences( refs );
+	if( m_EventOccurenceTime )
+	{
+		refs.push_back( m_EventOccurenceTime.get() );
+	}
+}
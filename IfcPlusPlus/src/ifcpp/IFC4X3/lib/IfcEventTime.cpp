@@ -42,6 +42,18 @@ void IFC4X3::IfcEventTime::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 6 ){m_ScheduleDate = IfcDateTime::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcEventTime, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEventTime::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ActualDate = IfcDateTime::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EarlyDate = IfcDateTime::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LateDate = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ScheduleDate = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcEventTime, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEventTime::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSchedulingTime::getAttributes( vec_attributes );
@@ -54,6 +66,18 @@ void IFC4X3::IfcEventTime::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcSchedulingTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEventTime::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributes( visitor );
+	visitor.visitObject( 3, "ActualDate", m_ActualDate );
+	visitor.visitObject( 4, "EarlyDate", m_EarlyDate );
+	visitor.visitObject( 5, "LateDate", m_LateDate );
+	visitor.visitObject( 6, "ScheduleDate", m_ScheduleDate );
+}
+void IFC4X3::IfcEventTime::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEventTime::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSchedulingTime::setInverseCounterparts( ptr_self_entity );
@@ -69,6 +69,23 @@ void IFC4X3::IfcEventType::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 11 ){m_UserDefinedEventTriggerType = IfcLabel::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcEventType, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcEventType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongDescription = IfcText::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ProcessType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcEventTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_EventTriggerType = IfcEventTriggerTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_UserDefinedEventTriggerType = IfcLabel::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcEventType, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcEventType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTypeProcess::getAttributes( vec_attributes );
@@ -80,6 +97,17 @@ void IFC4X3::IfcEventType::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcTypeProcess::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcEventType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeProcess::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 10, "EventTriggerType", m_EventTriggerType );
+	visitor.visitObject( 11, "UserDefinedEventTriggerType", m_UserDefinedEventTriggerType );
+}
+void IFC4X3::IfcEventType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeProcess::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcEventType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTypeProcess::setInverseCounterparts( ptr_self_entity );
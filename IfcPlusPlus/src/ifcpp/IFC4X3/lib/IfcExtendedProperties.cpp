@@ -31,6 +31,14 @@ void IFC4X3::IfcExtendedProperties::readStepArguments( const std::vector<std::st
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_Properties, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExtendedProperties, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExtendedProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Properties, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExtendedProperties, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExtendedProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributes( vec_attributes );
@@ -44,6 +52,17 @@ void IFC4X3::IfcExtendedProperties::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcExtendedProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitList( 2, "Properties", AttributeVectorView<IfcProperty>( m_Properties ) );
+}
+void IFC4X3::IfcExtendedProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcExtendedProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyAbstraction::setInverseCounterparts( ptr_self_entity );
@@ -52,3 +71,14 @@ void IFC4X3::IfcExtendedProperties::unlinkFromInverseCounterparts()
 {
 	IfcPropertyAbstraction::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcExtendedProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertyAbstraction::getEntityReferences( refs );
+	for( size_t i=0; i<m_Properties.size(); ++i )
+	{
+		if( m_Properties[i] )
+		{
+			refs.push_back( m_Properties[i].get() );
+		}
+	}
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcExternalReference::readStepArguments( const std::vector<std::str
 	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExternalReference, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExternalReference::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Location = IfcURIReference::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExternalReference, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExternalReference::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Location", m_Location ) );
@@ -49,6 +57,16 @@ void IFC4X3::IfcExternalReference::getAttributesInverse( std::vector<std::pair<s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ExternalReferenceForResources_inverse", ExternalReferenceForResources_inverse_vec_obj ) );
 }
+void IFC4X3::IfcExternalReference::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Location", m_Location );
+	visitor.visitObject( 1, "Identification", m_Identification );
+	visitor.visitObject( 2, "Name", m_Name );
+}
+void IFC4X3::IfcExternalReference::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "ExternalReferenceForResources_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_ExternalReferenceForResources_inverse ) );
+}
 void IFC4X3::IfcExternalReference::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
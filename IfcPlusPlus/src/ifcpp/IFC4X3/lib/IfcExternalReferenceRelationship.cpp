@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcActorRole.h"
 #include "ifcpp/IFC4X3/include/IfcAppliedValue.h"
 #include "ifcpp/IFC4X3/include/IfcApproval.h"
@@ -63,6 +64,15 @@ void IFC4X3::IfcExternalReferenceRelationship::readStepArguments( const std::vec
 	if( num_args > 3 ){readSelectList( args[3], m_RelatedResourceObjects, "IFCRESOURCEOBJECTSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcExternalReferenceRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExternalReferenceRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingReference, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readSelectList( args[3], m_RelatedResourceObjects, "IFCRESOURCEOBJECTSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcExternalReferenceRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExternalReferenceRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -75,6 +85,16 @@ void IFC4X3::IfcExternalReferenceRelationship::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcExternalReferenceRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingReference", m_RelatingReference );
+	visitor.visitList( 3, "RelatedResourceObjects", AttributeVectorView<IfcResourceObjectSelect>( m_RelatedResourceObjects ) );
+}
+void IFC4X3::IfcExternalReferenceRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcExternalReferenceRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -148,6 +168,77 @@ void IFC4X3::IfcExternalReferenceRelationship::setInverseCounterparts( shared_pt
 		m_RelatingReference->m_ExternalReferenceForResources_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcExternalReferenceRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		shared_ptr<IfcActorRole>  RelatedResourceObjects_IfcActorRole = dynamic_pointer_cast<IfcActorRole>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcActorRole )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcActorRole.get(), INVERSE_HasExternalReference );
+		}
+		shared_ptr<IfcAppliedValue>  RelatedResourceObjects_IfcAppliedValue = dynamic_pointer_cast<IfcAppliedValue>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcAppliedValue )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcAppliedValue.get(), INVERSE_HasExternalReference );
+		}
+		shared_ptr<IfcApproval>  RelatedResourceObjects_IfcApproval = dynamic_pointer_cast<IfcApproval>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcApproval )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcApproval.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcConstraint>  RelatedResourceObjects_IfcConstraint = dynamic_pointer_cast<IfcConstraint>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcConstraint )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcConstraint.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcContextDependentUnit>  RelatedResourceObjects_IfcContextDependentUnit = dynamic_pointer_cast<IfcContextDependentUnit>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcContextDependentUnit )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcContextDependentUnit.get(), INVERSE_HasExternalReference );
+		}
+		shared_ptr<IfcConversionBasedUnit>  RelatedResourceObjects_IfcConversionBasedUnit = dynamic_pointer_cast<IfcConversionBasedUnit>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcConversionBasedUnit )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcConversionBasedUnit.get(), INVERSE_HasExternalReference );
+		}
+		shared_ptr<IfcMaterialDefinition>  RelatedResourceObjects_IfcMaterialDefinition = dynamic_pointer_cast<IfcMaterialDefinition>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcMaterialDefinition )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcMaterialDefinition.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcPhysicalQuantity>  RelatedResourceObjects_IfcPhysicalQuantity = dynamic_pointer_cast<IfcPhysicalQuantity>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcPhysicalQuantity )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcPhysicalQuantity.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcProfileDef>  RelatedResourceObjects_IfcProfileDef = dynamic_pointer_cast<IfcProfileDef>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcProfileDef )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcProfileDef.get(), INVERSE_HasExternalReference );
+		}
+		shared_ptr<IfcPropertyAbstraction>  RelatedResourceObjects_IfcPropertyAbstraction = dynamic_pointer_cast<IfcPropertyAbstraction>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcPropertyAbstraction )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcPropertyAbstraction.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcShapeAspect>  RelatedResourceObjects_IfcShapeAspect = dynamic_pointer_cast<IfcShapeAspect>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcShapeAspect )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcShapeAspect.get(), INVERSE_HasExternalReferences );
+		}
+		shared_ptr<IfcTimeSeries>  RelatedResourceObjects_IfcTimeSeries = dynamic_pointer_cast<IfcTimeSeries>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcTimeSeries )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcTimeSeries.get(), INVERSE_HasExternalReference );
+		}
+	}
+	if( m_RelatingReference )
+	{
+		refs.emplace_back( m_RelatingReference.get(), INVERSE_ExternalReferenceForResources );
+	}
+}
 void IFC4X3::IfcExternalReferenceRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -453,3 +544,19 @@ void IFC4X3::IfcExternalReferenceRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcExternalReferenceRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingReference )
+	{
+		refs.push_back( m_RelatingReference.get() );
+	}
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		BuildingEntity* RelatedResourceObjects_entity = dynamic_cast<BuildingEntity*>( m_RelatedResourceObjects[i].get() );
+		if( RelatedResourceObjects_entity )
+		{
+			refs.push_back( RelatedResourceObjects_entity );
+		}
+	}
+}
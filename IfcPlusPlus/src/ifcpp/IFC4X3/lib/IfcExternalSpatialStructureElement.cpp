@@ -62,6 +62,19 @@ void IFC4X3::IfcExternalSpatialStructureElement::readStepArguments( const std::v
 	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcExternalSpatialStructureElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExternalSpatialStructureElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcExternalSpatialStructureElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExternalSpatialStructureElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpatialElement::getAttributes( vec_attributes );
@@ -70,6 +83,14 @@ void IFC4X3::IfcExternalSpatialStructureElement::getAttributesInverse( std::vect
 {
 	IFC4X3::IfcSpatialElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcExternalSpatialStructureElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialElement::visitAttributes( visitor );
+}
+void IFC4X3::IfcExternalSpatialStructureElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcExternalSpatialStructureElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpatialElement::setInverseCounterparts( ptr_self_entity );
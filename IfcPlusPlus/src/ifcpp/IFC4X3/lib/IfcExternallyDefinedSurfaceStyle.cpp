@@ -31,6 +31,14 @@ void IFC4X3::IfcExternallyDefinedSurfaceStyle::readStepArguments( const std::vec
 	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExternallyDefinedSurfaceStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExternallyDefinedSurfaceStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Location = IfcURIReference::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcExternallyDefinedSurfaceStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExternallyDefinedSurfaceStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalReference::getAttributes( vec_attributes );
@@ -39,6 +47,14 @@ void IFC4X3::IfcExternallyDefinedSurfaceStyle::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcExternalReference::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcExternallyDefinedSurfaceStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributes( visitor );
+}
+void IFC4X3::IfcExternallyDefinedSurfaceStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcExternallyDefinedSurfaceStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalReference::setInverseCounterparts( ptr_self_entity );
@@ -39,6 +39,16 @@ void IFC4X3::IfcExtrudedAreaSolidTapered::readStepArguments( const std::vector<s
 	if( num_args > 4 ){readEntityReference( args[4], m_EndSweptArea, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcExtrudedAreaSolidTapered, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcExtrudedAreaSolidTapered::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ExtrudedDirection, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Depth = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_EndSweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcExtrudedAreaSolidTapered, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcExtrudedAreaSolidTapered::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExtrudedAreaSolid::getAttributes( vec_attributes );
@@ -48,6 +58,15 @@ void IFC4X3::IfcExtrudedAreaSolidTapered::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcExtrudedAreaSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcExtrudedAreaSolidTapered::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExtrudedAreaSolid::visitAttributes( visitor );
+	visitor.visitObject( 4, "EndSweptArea", m_EndSweptArea );
+}
+void IFC4X3::IfcExtrudedAreaSolidTapered::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExtrudedAreaSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcExtrudedAreaSolidTapered::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExtrudedAreaSolid::setInverseCounterparts( ptr_self_entity );
@@ -56,3 +75,11 @@ void IFC4X3::IfcExtrudedAreaSolidTapered::unlinkFromInverseCounterparts()
 {
 	IfcExtrudedAreaSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcExtrudedAreaSolidTapered::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExtrudedAreaSolid::getEntityReferences( refs );
+	if( m_EndSweptArea )
+	{
+		refs.push_back( m_EndSweptArea.get() );
+	}
+}
@@ -25,6 +25,12 @@ void IFC4X3::IfcFace::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_Bounds, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcFace, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFace::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Bounds, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcFace, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFace::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -45,6 +51,16 @@ void IFC4X3::IfcFace::getAttributesInverse( std::vector<std::pair<std::string, s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasTextureMaps_inverse", HasTextureMaps_inverse_vec_obj ) );
 }
+void IFC4X3::IfcFace::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "Bounds", AttributeVectorView<IfcFaceBound>( m_Bounds ) );
+}
+void IFC4X3::IfcFace::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "HasTextureMaps_inverse", AttributeInverseVectorView<IfcTextureMap>( m_HasTextureMaps_inverse ) );
+}
 void IFC4X3::IfcFace::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -53,3 +69,14 @@ void IFC4X3::IfcFace::unlinkFromInverseCounterparts()
 {
 	IfcTopologicalRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFace::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTopologicalRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_Bounds.size(); ++i )
+	{
+		if( m_Bounds[i] )
+		{
+			refs.push_back( m_Bounds[i].get() );
+		}
+	}
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcFaceBasedSurfaceModel::readStepArguments( const std::vector<std:
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_FbsmFaces, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcFaceBasedSurfaceModel, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFaceBasedSurfaceModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_FbsmFaces, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcFaceBasedSurfaceModel, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFaceBasedSurfaceModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -35,6 +41,15 @@ void IFC4X3::IfcFaceBasedSurfaceModel::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFaceBasedSurfaceModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "FbsmFaces", AttributeVectorView<IfcConnectedFaceSet>( m_FbsmFaces ) );
+}
+void IFC4X3::IfcFaceBasedSurfaceModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFaceBasedSurfaceModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +58,14 @@ void IFC4X3::IfcFaceBasedSurfaceModel::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFaceBasedSurfaceModel::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_FbsmFaces.size(); ++i )
+	{
+		if( m_FbsmFaces[i] )
+		{
+			refs.push_back( m_FbsmFaces[i].get() );
+		}
+	}
+}
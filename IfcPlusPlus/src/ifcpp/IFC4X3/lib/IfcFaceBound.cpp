@@ -28,6 +28,13 @@ void IFC4X3::IfcFaceBound::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 1 ){m_Orientation = IfcBoolean::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFaceBound, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFaceBound::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Bound, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Orientation = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFaceBound, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFaceBound::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcFaceBound::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFaceBound::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Bound", m_Bound );
+	visitor.visitObject( 1, "Orientation", m_Orientation );
+}
+void IFC4X3::IfcFaceBound::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFaceBound::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,11 @@ void IFC4X3::IfcFaceBound::unlinkFromInverseCounterparts()
 {
 	IfcTopologicalRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFaceBound::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTopologicalRepresentationItem::getEntityReferences( refs );
+	if( m_Bound )
+	{
+		refs.push_back( m_Bound.get() );
+	}
+}
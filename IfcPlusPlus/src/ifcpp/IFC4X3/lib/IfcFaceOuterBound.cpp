@@ -28,6 +28,13 @@ void IFC4X3::IfcFaceOuterBound::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){m_Orientation = IfcBoolean::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFaceOuterBound, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFaceOuterBound::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Bound, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Orientation = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFaceOuterBound, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFaceOuterBound::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFaceBound::getAttributes( vec_attributes );
@@ -36,6 +43,14 @@ void IFC4X3::IfcFaceOuterBound::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcFaceBound::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFaceOuterBound::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFaceBound::visitAttributes( visitor );
+}
+void IFC4X3::IfcFaceOuterBound::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFaceBound::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFaceOuterBound::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFaceBound::setInverseCounterparts( ptr_self_entity );
@@ -33,6 +33,14 @@ void IFC4X3::IfcFaceSurface::readStepArguments( const std::vector<std::string>&
 	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFaceSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFaceSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Bounds, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_FaceSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFaceSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFaceSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFace::getAttributes( vec_attributes );
@@ -43,6 +51,16 @@ void IFC4X3::IfcFaceSurface::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcFace::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFaceSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFace::visitAttributes( visitor );
+	visitor.visitObject( 1, "FaceSurface", m_FaceSurface );
+	visitor.visitObject( 2, "SameSense", m_SameSense );
+}
+void IFC4X3::IfcFaceSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFace::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFaceSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFace::setInverseCounterparts( ptr_self_entity );
@@ -51,3 +69,11 @@ void IFC4X3::IfcFaceSurface::unlinkFromInverseCounterparts()
 {
 	IfcFace::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFaceSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcFace::getEntityReferences( refs );
+	if( m_FaceSurface )
+	{
+		refs.push_back( m_FaceSurface.get() );
+	}
+}
@@ -27,6 +27,13 @@ void IFC4X3::IfcFacetedBrepWithVoids::readStepArguments( const std::vector<std::
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_Voids, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFacetedBrepWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFacetedBrepWithVoids::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Voids, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcFacetedBrepWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFacetedBrepWithVoids::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFacetedBrep::getAttributes( vec_attributes );
@@ -38,6 +45,15 @@ void IFC4X3::IfcFacetedBrepWithVoids::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcFacetedBrep::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFacetedBrepWithVoids::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacetedBrep::visitAttributes( visitor );
+	visitor.visitList( 1, "Voids", AttributeVectorView<IfcClosedShell>( m_Voids ) );
+}
+void IFC4X3::IfcFacetedBrepWithVoids::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFacetedBrep::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFacetedBrepWithVoids::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFacetedBrep::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +62,14 @@ void IFC4X3::IfcFacetedBrepWithVoids::unlinkFromInverseCounterparts()
 {
 	IfcFacetedBrep::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFacetedBrepWithVoids::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcFacetedBrep::getEntityReferences( refs );
+	for( size_t i=0; i<m_Voids.size(); ++i )
+	{
+		if( m_Voids[i] )
+		{
+			refs.push_back( m_Voids[i].get() );
+		}
+	}
+}
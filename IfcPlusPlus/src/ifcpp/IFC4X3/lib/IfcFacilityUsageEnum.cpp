@@ -24,6 +24,10 @@ void IFC4X3::IfcFacilityUsageEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFacilityUsageEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcFacilityUsageEnum> IFC4X3::IfcFacilityUsageEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFacilityUsageEnum>(); }
@@ -56,3 +60,12 @@ shared_ptr<IFC4X3::IfcFacilityUsageEnum> IFC4X3::IfcFacilityUsageEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFacilityUsageEnum> IFC4X3::IfcFacilityUsageEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcFacilityUsageEnum>(); }
+		return shared_ptr<IfcFacilityUsageEnum>( new IfcFacilityUsageEnum( IfcFacilityUsageEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
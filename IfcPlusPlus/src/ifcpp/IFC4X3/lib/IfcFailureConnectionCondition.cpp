@@ -41,6 +41,18 @@ void IFC4X3::IfcFailureConnectionCondition::readStepArguments( const std::vector
 	if( num_args > 6 ){m_CompressionFailureZ = IfcForceMeasure::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcFailureConnectionCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFailureConnectionCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TensionFailureX = IfcForceMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TensionFailureY = IfcForceMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TensionFailureZ = IfcForceMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_CompressionFailureX = IfcForceMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_CompressionFailureY = IfcForceMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_CompressionFailureZ = IfcForceMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcFailureConnectionCondition, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFailureConnectionCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralConnectionCondition::getAttributes( vec_attributes );
@@ -55,6 +67,20 @@ void IFC4X3::IfcFailureConnectionCondition::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcStructuralConnectionCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFailureConnectionCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnectionCondition::visitAttributes( visitor );
+	visitor.visitObject( 1, "TensionFailureX", m_TensionFailureX );
+	visitor.visitObject( 2, "TensionFailureY", m_TensionFailureY );
+	visitor.visitObject( 3, "TensionFailureZ", m_TensionFailureZ );
+	visitor.visitObject( 4, "CompressionFailureX", m_CompressionFailureX );
+	visitor.visitObject( 5, "CompressionFailureY", m_CompressionFailureY );
+	visitor.visitObject( 6, "CompressionFailureZ", m_CompressionFailureZ );
+}
+void IFC4X3::IfcFailureConnectionCondition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnectionCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFailureConnectionCondition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralConnectionCondition::setInverseCounterparts( ptr_self_entity );
@@ -23,6 +23,10 @@ void IFC4X3::IfcFastenerTypeEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFastenerTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcFastenerTypeEnum> IFC4X3::IfcFastenerTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFastenerTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcFastenerTypeEnum> IFC4X3::IfcFastenerTypeEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFastenerTypeEnum> IFC4X3::IfcFastenerTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcFastenerTypeEnum>(); }
+		return shared_ptr<IfcFastenerTypeEnum>( new IfcFastenerTypeEnum( IfcFastenerTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -47,6 +47,14 @@ void IFC4X3::IfcFillAreaStyle::readStepArguments( const std::vector<std::string>
 	if( num_args > 2 ){m_ModelOrDraughting = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFillAreaStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readSelectList( args[1], m_FillStyles, "IFCFILLSTYLESELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ModelOrDraughting = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFillAreaStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationStyle::getAttributes( vec_attributes );
@@ -59,6 +67,16 @@ void IFC4X3::IfcFillAreaStyle::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcPresentationStyle::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFillAreaStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributes( visitor );
+	visitor.visitList( 1, "FillStyles", AttributeVectorView<IfcFillStyleSelect>( m_FillStyles ) );
+	visitor.visitObject( 2, "ModelOrDraughting", m_ModelOrDraughting );
+}
+void IFC4X3::IfcFillAreaStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFillAreaStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationStyle::setInverseCounterparts( ptr_self_entity );
@@ -67,3 +85,15 @@ void IFC4X3::IfcFillAreaStyle::unlinkFromInverseCounterparts()
 {
 	IfcPresentationStyle::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFillAreaStyle::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationStyle::getEntityReferences( refs );
+	for( size_t i=0; i<m_FillStyles.size(); ++i )
+	{
+		BuildingEntity* FillStyles_entity = dynamic_cast<BuildingEntity*>( m_FillStyles[i].get() );
+		if( FillStyles_entity )
+		{
+			refs.push_back( FillStyles_entity );
+		}
+	}
+}
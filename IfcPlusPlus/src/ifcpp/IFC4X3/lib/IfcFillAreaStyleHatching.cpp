@@ -39,6 +39,16 @@ void IFC4X3::IfcFillAreaStyleHatching::readStepArguments( const std::vector<std:
 	if( num_args > 4 ){m_HatchLineAngle = IfcPlaneAngleMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyleHatching, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFillAreaStyleHatching::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_HatchLineAppearance, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_StartOfNextHatchLine = IfcHatchLineDistanceSelect::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_PointOfReferenceHatchLine, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_PatternStart, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_HatchLineAngle = IfcPlaneAngleMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyleHatching, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFillAreaStyleHatching::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -52,6 +62,19 @@ void IFC4X3::IfcFillAreaStyleHatching::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFillAreaStyleHatching::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "HatchLineAppearance", m_HatchLineAppearance );
+	visitor.visitObject( 1, "StartOfNextHatchLine", m_StartOfNextHatchLine );
+	visitor.visitObject( 2, "PointOfReferenceHatchLine", m_PointOfReferenceHatchLine );
+	visitor.visitObject( 3, "PatternStart", m_PatternStart );
+	visitor.visitObject( 4, "HatchLineAngle", m_HatchLineAngle );
+}
+void IFC4X3::IfcFillAreaStyleHatching::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFillAreaStyleHatching::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +83,24 @@ void IFC4X3::IfcFillAreaStyleHatching::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFillAreaStyleHatching::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	if( m_HatchLineAppearance )
+	{
+		refs.push_back( m_HatchLineAppearance.get() );
+	}
+	BuildingEntity* StartOfNextHatchLine_entity = dynamic_cast<BuildingEntity*>( m_StartOfNextHatchLine.get() );
+	if( StartOfNextHatchLine_entity )
+	{
+		refs.push_back( StartOfNextHatchLine_entity );
+	}
+	if( m_PointOfReferenceHatchLine )
+	{
+		refs.push_back( m_PointOfReferenceHatchLine.get() );
+	}
+	if( m_PatternStart )
+	{
+		refs.push_back( m_PatternStart.get() );
+	}
+}
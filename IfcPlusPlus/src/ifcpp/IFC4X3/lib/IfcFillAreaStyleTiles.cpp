@@ -31,6 +31,14 @@ void IFC4X3::IfcFillAreaStyleTiles::readStepArguments( const std::vector<std::st
 	if( num_args > 2 ){m_TilingScale = IfcPositiveRatioMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyleTiles, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcFillAreaStyleTiles::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_TilingPattern, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Tiles, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TilingScale = IfcPositiveRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcFillAreaStyleTiles, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcFillAreaStyleTiles::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -46,6 +54,17 @@ void IFC4X3::IfcFillAreaStyleTiles::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcFillAreaStyleTiles::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "TilingPattern", AttributeVectorView<IfcVector>( m_TilingPattern ) );
+	visitor.visitList( 1, "Tiles", AttributeVectorView<IfcStyledItem>( m_Tiles ) );
+	visitor.visitObject( 2, "TilingScale", m_TilingScale );
+}
+void IFC4X3::IfcFillAreaStyleTiles::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcFillAreaStyleTiles::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +73,21 @@ void IFC4X3::IfcFillAreaStyleTiles::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcFillAreaStyleTiles::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_TilingPattern.size(); ++i )
+	{
+		if( m_TilingPattern[i] )
+		{
+			refs.push_back( m_TilingPattern[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_Tiles.size(); ++i )
+	{
+		if( m_Tiles[i] )
+		{
+			refs.push_back( m_Tiles[i].get() );
+		}
+	}
+}
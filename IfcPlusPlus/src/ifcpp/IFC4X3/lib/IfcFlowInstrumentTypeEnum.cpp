@@ -30,6 +30,10 @@ void IFC4X3::IfcFlowInstrumentTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFlowInstrumentTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcFlowInstrumentTypeEnum> IFC4X3::IfcFlowInstrumentTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFlowInstrumentTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcFlowInstrumentTypeEnum> IFC4X3::IfcFlowInstrumentTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFlowInstrumentTypeEnum> IFC4X3::IfcFlowInstrumentTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcFlowInstrumentTypeEnum>(); }
+		return shared_ptr<IfcFlowInstrumentTypeEnum>( new IfcFlowInstrumentTypeEnum( IfcFlowInstrumentTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
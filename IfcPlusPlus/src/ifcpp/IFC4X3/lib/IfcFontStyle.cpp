@@ -17,6 +17,10 @@ void IFC4X3::IfcFontStyle::getStepParameter( std::stringstream& stream, bool is_
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFontStyle::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcFontStyle> IFC4X3::IfcFontStyle::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFontStyle>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcFontStyle> IFC4X3::IfcFontStyle::createObjectFromSTEP( con
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFontStyle> IFC4X3::IfcFontStyle::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcFontStyle>(); }
+	shared_ptr<IfcFontStyle> type_object( new IfcFontStyle() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
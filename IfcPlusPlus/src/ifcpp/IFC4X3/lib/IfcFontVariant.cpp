@@ -17,6 +17,10 @@ void IFC4X3::IfcFontVariant::getStepParameter( std::stringstream& stream, bool i
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFontVariant::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcFontVariant> IFC4X3::IfcFontVariant::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFontVariant>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcFontVariant> IFC4X3::IfcFontVariant::createObjectFromSTEP(
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFontVariant> IFC4X3::IfcFontVariant::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcFontVariant>(); }
+	shared_ptr<IfcFontVariant> type_object( new IfcFontVariant() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
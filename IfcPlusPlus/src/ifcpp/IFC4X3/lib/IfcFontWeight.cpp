@@ -17,6 +17,10 @@ void IFC4X3::IfcFontWeight::getStepParameter( std::stringstream& stream, bool is
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFontWeight::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcFontWeight> IFC4X3::IfcFontWeight::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFontWeight>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcFontWeight> IFC4X3::IfcFontWeight::createObjectFromSTEP( c
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFontWeight> IFC4X3::IfcFontWeight::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcFontWeight>(); }
+	shared_ptr<IfcFontWeight> type_object( new IfcFontWeight() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
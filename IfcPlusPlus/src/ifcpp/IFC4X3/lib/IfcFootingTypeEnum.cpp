@@ -25,6 +25,10 @@ void IFC4X3::IfcFootingTypeEnum::getStepParameter( std::stringstream& stream, bo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFootingTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcFootingTypeEnum> IFC4X3::IfcFootingTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFootingTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcFootingTypeEnum> IFC4X3::IfcFootingTypeEnum::createObjectF
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFootingTypeEnum> IFC4X3::IfcFootingTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcFootingTypeEnum>(); }
+		return shared_ptr<IfcFootingTypeEnum>( new IfcFootingTypeEnum( IfcFootingTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcForceMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcForceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcForceMeasure> IFC4X3::IfcForceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcForceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcForceMeasure> IFC4X3::IfcForceMeasure::createObjectFromSTE
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcForceMeasure> IFC4X3::IfcForceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcForceMeasure>(); }
+	shared_ptr<IfcForceMeasure> type_object( new IfcForceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
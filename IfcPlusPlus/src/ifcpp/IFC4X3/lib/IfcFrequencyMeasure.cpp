@@ -18,6 +18,10 @@ void IFC4X3::IfcFrequencyMeasure::getStepParameter( std::stringstream& stream, b
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFrequencyMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcFrequencyMeasure> IFC4X3::IfcFrequencyMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFrequencyMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcFrequencyMeasure> IFC4X3::IfcFrequencyMeasure::createObjec
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFrequencyMeasure> IFC4X3::IfcFrequencyMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcFrequencyMeasure>(); }
+	shared_ptr<IfcFrequencyMeasure> type_object( new IfcFrequencyMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -28,6 +28,10 @@ void IFC4X3::IfcFurnitureTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcFurnitureTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcFurnitureTypeEnum> IFC4X3::IfcFurnitureTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcFurnitureTypeEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcFurnitureTypeEnum> IFC4X3::IfcFurnitureTypeEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcFurnitureTypeEnum> IFC4X3::IfcFurnitureTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcFurnitureTypeEnum>(); }
+		return shared_ptr<IfcFurnitureTypeEnum>( new IfcFurnitureTypeEnum( IfcFurnitureTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -42,6 +42,17 @@ void IFC4X3::IfcGeographicCRS::readStepArguments( const std::vector<std::string>
 	if( num_args > 5 ){readEntityReference( args[5], m_HeightUnit, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcGeographicCRS, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGeographicCRS::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_GeodeticDatum = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_PrimeMeridian = IfcIdentifier::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_AngleUnit, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_HeightUnit, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcGeographicCRS, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGeographicCRS::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCoordinateReferenceSystem::getAttributes( vec_attributes );
@@ -53,6 +64,17 @@ void IFC4X3::IfcGeographicCRS::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcCoordinateReferenceSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGeographicCRS::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateReferenceSystem::visitAttributes( visitor );
+	visitor.visitObject( 3, "PrimeMeridian", m_PrimeMeridian );
+	visitor.visitObject( 4, "AngleUnit", m_AngleUnit );
+	visitor.visitObject( 5, "HeightUnit", m_HeightUnit );
+}
+void IFC4X3::IfcGeographicCRS::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateReferenceSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGeographicCRS::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCoordinateReferenceSystem::setInverseCounterparts( ptr_self_entity );
@@ -61,3 +83,15 @@ void IFC4X3::IfcGeographicCRS::unlinkFromInverseCounterparts()
 {
 	IfcCoordinateReferenceSystem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcGeographicCRS::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCoordinateReferenceSystem::getEntityReferences( refs );
+	if( m_AngleUnit )
+	{
+		refs.push_back( m_AngleUnit.get() );
+	}
+	if( m_HeightUnit )
+	{
+		refs.push_back( m_HeightUnit.get() );
+	}
+}
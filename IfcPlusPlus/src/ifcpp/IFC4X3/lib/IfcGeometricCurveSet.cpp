@@ -41,6 +41,12 @@ void IFC4X3::IfcGeometricCurveSet::readStepArguments( const std::vector<std::str
 	if( num_args > 0 ){readSelectList( args[0], m_Elements, "IFCGEOMETRICSETSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcGeometricCurveSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGeometricCurveSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_Elements, "IFCGEOMETRICSETSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcGeometricCurveSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGeometricCurveSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricSet::getAttributes( vec_attributes );
@@ -49,6 +55,14 @@ void IFC4X3::IfcGeometricCurveSet::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcGeometricSet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGeometricCurveSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricSet::visitAttributes( visitor );
+}
+void IFC4X3::IfcGeometricCurveSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricSet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGeometricCurveSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricSet::setInverseCounterparts( ptr_self_entity );
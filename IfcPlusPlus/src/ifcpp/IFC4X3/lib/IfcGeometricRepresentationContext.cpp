@@ -44,6 +44,17 @@ void IFC4X3::IfcGeometricRepresentationContext::readStepArguments( const std::ve
 	if( num_args > 5 ){readEntityReference( args[5], m_TrueNorth, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcGeometricRepresentationContext, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGeometricRepresentationContext::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ContextIdentifier = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ContextType = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CoordinateSpaceDimension = IfcDimensionCount::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Precision = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_WorldCoordinateSystem = IfcAxis2Placement::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_TrueNorth, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcGeometricRepresentationContext, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGeometricRepresentationContext::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRepresentationContext::getAttributes( vec_attributes );
@@ -74,6 +85,20 @@ void IFC4X3::IfcGeometricRepresentationContext::getAttributesInverse( std::vecto
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasCoordinateOperation_inverse", HasCoordinateOperation_inverse_vec_obj ) );
 }
+void IFC4X3::IfcGeometricRepresentationContext::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationContext::visitAttributes( visitor );
+	visitor.visitObject( 2, "CoordinateSpaceDimension", m_CoordinateSpaceDimension );
+	visitor.visitObject( 3, "Precision", m_Precision );
+	visitor.visitObject( 4, "WorldCoordinateSystem", m_WorldCoordinateSystem );
+	visitor.visitObject( 5, "TrueNorth", m_TrueNorth );
+}
+void IFC4X3::IfcGeometricRepresentationContext::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationContext::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "HasSubContexts_inverse", AttributeInverseVectorView<IfcGeometricRepresentationSubContext>( m_HasSubContexts_inverse ) );
+	visitor.visitList( 2, "HasCoordinateOperation_inverse", AttributeInverseVectorView<IfcCoordinateOperation>( m_HasCoordinateOperation_inverse ) );
+}
 void IFC4X3::IfcGeometricRepresentationContext::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRepresentationContext::setInverseCounterparts( ptr_self_entity );
@@ -82,3 +107,16 @@ void IFC4X3::IfcGeometricRepresentationContext::unlinkFromInverseCounterparts()
 {
 	IfcRepresentationContext::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcGeometricRepresentationContext::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRepresentationContext::getEntityReferences( refs );
+	BuildingEntity* WorldCoordinateSystem_entity = dynamic_cast<BuildingEntity*>( m_WorldCoordinateSystem.get() );
+	if( WorldCoordinateSystem_entity )
+	{
+		refs.push_back( WorldCoordinateSystem_entity );
+	}
+	if( m_TrueNorth )
+	{
+		refs.push_back( m_TrueNorth.get() );
+	}
+}
@@ -19,6 +19,9 @@ void IFC4X3::IfcGeometricRepresentationItem::getStepParameter( std::stringstream
 void IFC4X3::IfcGeometricRepresentationItem::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcGeometricRepresentationItem::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcGeometricRepresentationItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRepresentationItem::getAttributes( vec_attributes );
@@ -27,6 +30,14 @@ void IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGeometricRepresentationItem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributes( visitor );
+}
+void IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGeometricRepresentationItem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAxis2Placement.h"
 #include "ifcpp/IFC4X3/include/IfcCoordinateOperation.h"
 #include "ifcpp/IFC4X3/include/IfcDimensionCount.h"
@@ -58,6 +59,21 @@ void IFC4X3::IfcGeometricRepresentationSubContext::readStepArguments( const std:
 	if( num_args > 9 ){m_UserDefinedTargetView = IfcLabel::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcGeometricRepresentationSubContext, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGeometricRepresentationSubContext::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ContextIdentifier = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ContextType = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CoordinateSpaceDimension = IfcDimensionCount::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Precision = IfcReal::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_WorldCoordinateSystem = IfcAxis2Placement::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_TrueNorth, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_ParentContext, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_TargetScale = IfcPositiveRatioMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_TargetView = IfcGeometricProjectionEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_UserDefinedTargetView = IfcLabel::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcGeometricRepresentationSubContext, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGeometricRepresentationSubContext::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationContext::getAttributes( vec_attributes );
@@ -70,6 +86,18 @@ void IFC4X3::IfcGeometricRepresentationSubContext::getAttributesInverse( std::ve
 {
 	IFC4X3::IfcGeometricRepresentationContext::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGeometricRepresentationSubContext::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationContext::visitAttributes( visitor );
+	visitor.visitObject( 6, "ParentContext", m_ParentContext );
+	visitor.visitObject( 7, "TargetScale", m_TargetScale );
+	visitor.visitObject( 8, "TargetView", m_TargetView );
+	visitor.visitObject( 9, "UserDefinedTargetView", m_UserDefinedTargetView );
+}
+void IFC4X3::IfcGeometricRepresentationSubContext::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationContext::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGeometricRepresentationSubContext::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationContext::setInverseCounterparts( ptr_self_entity );
@@ -80,6 +108,14 @@ void IFC4X3::IfcGeometricRepresentationSubContext::setInverseCounterparts( share
 		m_ParentContext->m_HasSubContexts_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcGeometricRepresentationSubContext::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcGeometricRepresentationContext::getInverseReferences( refs );
+	if( m_ParentContext )
+	{
+		refs.emplace_back( m_ParentContext.get(), INVERSE_HasSubContexts );
+	}
+}
 void IFC4X3::IfcGeometricRepresentationSubContext::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationContext::unlinkFromInverseCounterparts();
@@ -106,3 +142,11 @@ void IFC4X3::IfcGeometricRepresentationSubContext::unlinkFromInverseCounterparts
 		}
 	}
 }
+void IFC4X3::IfcGeometricRepresentationSubContext::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationContext::getEntityReferences( refs );
+	if( m_ParentContext )
+	{
+		refs.push_back( m_ParentContext.get() );
+	}
+}
@@ -41,6 +41,12 @@ void IFC4X3::IfcGeometricSet::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readSelectList( args[0], m_Elements, "IFCGEOMETRICSETSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcGeometricSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGeometricSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_Elements, "IFCGEOMETRICSETSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcGeometricSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGeometricSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -52,6 +58,15 @@ void IFC4X3::IfcGeometricSet::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGeometricSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "Elements", AttributeVectorView<IfcGeometricSetSelect>( m_Elements ) );
+}
+void IFC4X3::IfcGeometricSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGeometricSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +75,15 @@ void IFC4X3::IfcGeometricSet::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcGeometricSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_Elements.size(); ++i )
+	{
+		BuildingEntity* Elements_entity = dynamic_cast<BuildingEntity*>( m_Elements[i].get() );
+		if( Elements_entity )
+		{
+			refs.push_back( Elements_entity );
+		}
+	}
+}
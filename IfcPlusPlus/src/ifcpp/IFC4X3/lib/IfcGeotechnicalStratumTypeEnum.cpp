@@ -23,6 +23,10 @@ void IFC4X3::IfcGeotechnicalStratumTypeEnum::getStepParameter( std::stringstream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcGeotechnicalStratumTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcGeotechnicalStratumTypeEnum> IFC4X3::IfcGeotechnicalStratumTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcGeotechnicalStratumTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcGeotechnicalStratumTypeEnum> IFC4X3::IfcGeotechnicalStratu
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcGeotechnicalStratumTypeEnum> IFC4X3::IfcGeotechnicalStratumTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcGeotechnicalStratumTypeEnum>(); }
+		return shared_ptr<IfcGeotechnicalStratumTypeEnum>( new IfcGeotechnicalStratumTypeEnum( IfcGeotechnicalStratumTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
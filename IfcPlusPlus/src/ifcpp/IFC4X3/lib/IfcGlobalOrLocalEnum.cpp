@@ -20,6 +20,10 @@ void IFC4X3::IfcGlobalOrLocalEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcGlobalOrLocalEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcGlobalOrLocalEnum> IFC4X3::IfcGlobalOrLocalEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcGlobalOrLocalEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcGlobalOrLocalEnum> IFC4X3::IfcGlobalOrLocalEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcGlobalOrLocalEnum> IFC4X3::IfcGlobalOrLocalEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_LOCAL_COORDS ) { return shared_ptr<IfcGlobalOrLocalEnum>(); }
+		return shared_ptr<IfcGlobalOrLocalEnum>( new IfcGlobalOrLocalEnum( IfcGlobalOrLocalEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcGloballyUniqueId::getStepParameter( std::stringstream& stream, b
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcGloballyUniqueId::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcGloballyUniqueId> IFC4X3::IfcGloballyUniqueId::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcGloballyUniqueId>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcGloballyUniqueId> IFC4X3::IfcGloballyUniqueId::createObjec
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcGloballyUniqueId> IFC4X3::IfcGloballyUniqueId::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcGloballyUniqueId>(); }
+	shared_ptr<IfcGloballyUniqueId> type_object( new IfcGloballyUniqueId() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -36,6 +36,15 @@ void IFC4X3::IfcGradientCurve::readStepArguments( const std::vector<std::string>
 	if( num_args > 3 ){readEntityReference( args[3], m_EndPoint, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcGradientCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGradientCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Segments, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_BaseCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_EndPoint, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcGradientCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGradientCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCompositeCurve::getAttributes( vec_attributes );
@@ -46,6 +55,16 @@ void IFC4X3::IfcGradientCurve::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcCompositeCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGradientCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurve::visitAttributes( visitor );
+	visitor.visitObject( 2, "BaseCurve", m_BaseCurve );
+	visitor.visitObject( 3, "EndPoint", m_EndPoint );
+}
+void IFC4X3::IfcGradientCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGradientCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCompositeCurve::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +73,15 @@ void IFC4X3::IfcGradientCurve::unlinkFromInverseCounterparts()
 {
 	IfcCompositeCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcGradientCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCompositeCurve::getEntityReferences( refs );
+	if( m_BaseCurve )
+	{
+		refs.push_back( m_BaseCurve.get() );
+	}
+	if( m_EndPoint )
+	{
+		refs.push_back( m_EndPoint.get() );
+	}
+}
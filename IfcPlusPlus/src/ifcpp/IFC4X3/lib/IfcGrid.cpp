@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcGrid.h"
 #include "ifcpp/IFC4X3/include/IfcGridAxis.h"
@@ -71,6 +72,22 @@ void IFC4X3::IfcGrid::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 10 ){m_PredefinedType = IfcGridTypeEnum::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcGrid, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGrid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_UAxes, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_VAxes, map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReferenceList( args[9], m_WAxes, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_PredefinedType = IfcGridTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcGrid, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGrid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPositioningElement::getAttributes( vec_attributes );
@@ -89,6 +106,18 @@ void IFC4X3::IfcGrid::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcPositioningElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGrid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPositioningElement::visitAttributes( visitor );
+	visitor.visitList( 7, "UAxes", AttributeVectorView<IfcGridAxis>( m_UAxes ) );
+	visitor.visitList( 8, "VAxes", AttributeVectorView<IfcGridAxis>( m_VAxes ) );
+	visitor.visitList( 9, "WAxes", AttributeVectorView<IfcGridAxis>( m_WAxes ) );
+	visitor.visitObject( 10, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcGrid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPositioningElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGrid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPositioningElement::setInverseCounterparts( ptr_self_entity );
@@ -116,6 +145,31 @@ void IFC4X3::IfcGrid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_sel
 		}
 	}
 }
+void IFC4X3::IfcGrid::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPositioningElement::getInverseReferences( refs );
+	for( size_t i=0; i<m_UAxes.size(); ++i )
+	{
+		if( m_UAxes[i] )
+		{
+			refs.emplace_back( m_UAxes[i].get(), INVERSE_PartOfU );
+		}
+	}
+	for( size_t i=0; i<m_VAxes.size(); ++i )
+	{
+		if( m_VAxes[i] )
+		{
+			refs.emplace_back( m_VAxes[i].get(), INVERSE_PartOfV );
+		}
+	}
+	for( size_t i=0; i<m_WAxes.size(); ++i )
+	{
+		if( m_WAxes[i] )
+		{
+			refs.emplace_back( m_WAxes[i].get(), INVERSE_PartOfW );
+		}
+	}
+}
 void IFC4X3::IfcGrid::unlinkFromInverseCounterparts()
 {
 	IfcPositioningElement::unlinkFromInverseCounterparts();
@@ -195,3 +249,28 @@ void IFC4X3::IfcGrid::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcGrid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPositioningElement::getEntityReferences( refs );
+	for( size_t i=0; i<m_UAxes.size(); ++i )
+	{
+		if( m_UAxes[i] )
+		{
+			refs.push_back( m_UAxes[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_VAxes.size(); ++i )
+	{
+		if( m_VAxes[i] )
+		{
+			refs.push_back( m_VAxes[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_WAxes.size(); ++i )
+	{
+		if( m_WAxes[i] )
+		{
+			refs.push_back( m_WAxes[i].get() );
+		}
+	}
+}
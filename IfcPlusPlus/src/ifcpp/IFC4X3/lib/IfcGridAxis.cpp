@@ -32,6 +32,14 @@ void IFC4X3::IfcGridAxis::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcGridAxis, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGridAxis::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_AxisTag = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_AxisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcGridAxis, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGridAxis::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "AxisTag", m_AxisTag ) );
@@ -77,9 +85,29 @@ void IFC4X3::IfcGridAxis::getAttributesInverse( std::vector<std::pair<std::strin
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasIntersections_inverse", HasIntersections_inverse_vec_obj ) );
 }
+void IFC4X3::IfcGridAxis::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "AxisTag", m_AxisTag );
+	visitor.visitObject( 1, "AxisCurve", m_AxisCurve );
+	visitor.visitObject( 2, "SameSense", m_SameSense );
+}
+void IFC4X3::IfcGridAxis::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "PartOfW_inverse", AttributeInverseVectorView<IfcGrid>( m_PartOfW_inverse ) );
+	visitor.visitList( 1, "PartOfV_inverse", AttributeInverseVectorView<IfcGrid>( m_PartOfV_inverse ) );
+	visitor.visitList( 2, "PartOfU_inverse", AttributeInverseVectorView<IfcGrid>( m_PartOfU_inverse ) );
+	visitor.visitList( 3, "HasIntersections_inverse", AttributeInverseVectorView<IfcVirtualGridIntersection>( m_HasIntersections_inverse ) );
+}
 void IFC4X3::IfcGridAxis::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcGridAxis::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcGridAxis::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_AxisCurve )
+	{
+		refs.push_back( m_AxisCurve.get() );
+	}
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcGridPlacement::readStepArguments( const std::vector<std::string>
 	if( num_args > 2 ){m_PlacementRefDirection = IfcGridPlacementDirectionSelect::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcGridPlacement, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGridPlacement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_PlacementRelTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_PlacementLocation, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_PlacementRefDirection = IfcGridPlacementDirectionSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcGridPlacement, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGridPlacement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectPlacement::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcGridPlacement::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcObjectPlacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcGridPlacement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributes( visitor );
+	visitor.visitObject( 1, "PlacementLocation", m_PlacementLocation );
+	visitor.visitObject( 2, "PlacementRefDirection", m_PlacementRefDirection );
+}
+void IFC4X3::IfcGridPlacement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcGridPlacement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectPlacement::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +67,16 @@ void IFC4X3::IfcGridPlacement::unlinkFromInverseCounterparts()
 {
 	IfcObjectPlacement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcGridPlacement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObjectPlacement::getEntityReferences( refs );
+	if( m_PlacementLocation )
+	{
+		refs.push_back( m_PlacementLocation.get() );
+	}
+	BuildingEntity* PlacementRefDirection_entity = dynamic_cast<BuildingEntity*>( m_PlacementRefDirection.get() );
+	if( PlacementRefDirection_entity )
+	{
+		refs.push_back( PlacementRefDirection_entity );
+	}
+}
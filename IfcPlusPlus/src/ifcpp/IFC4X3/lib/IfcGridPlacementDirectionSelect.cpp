@@ -21,3 +21,10 @@ shared_ptr<IFC4X3::IfcGridPlacementDirectionSelect> IFC4X3::IfcGridPlacementDire
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcGridPlacementDirectionSelect> IFC4X3::IfcGridPlacementDirectionSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcGridPlacementDirectionSelect>(); }
+	shared_ptr<IfcGridPlacementDirectionSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
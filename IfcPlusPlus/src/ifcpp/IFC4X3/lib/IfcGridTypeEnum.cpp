@@ -24,6 +24,10 @@ void IFC4X3::IfcGridTypeEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcGridTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcGridTypeEnum> IFC4X3::IfcGridTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcGridTypeEnum>(); }
@@ -56,3 +60,12 @@ shared_ptr<IFC4X3::IfcGridTypeEnum> IFC4X3::IfcGridTypeEnum::createObjectFromSTE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcGridTypeEnum> IFC4X3::IfcGridTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcGridTypeEnum>(); }
+		return shared_ptr<IfcGridTypeEnum>( new IfcGridTypeEnum( IfcGridTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
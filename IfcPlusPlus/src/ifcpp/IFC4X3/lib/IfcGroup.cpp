@@ -47,6 +47,16 @@ void IFC4X3::IfcGroup::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcGroup, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcGroup::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcGroup, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcGroup::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObject::getAttributes( vec_attributes );
@@ -73,6 +83,16 @@ void IFC4X3::IfcGroup::getAttributesInverse( std::vector<std::pair<std::string,
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ReferencedInStructures_inverse", ReferencedInStructures_inverse_vec_obj ) );
 }
+void IFC4X3::IfcGroup::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributes( visitor );
+}
+void IFC4X3::IfcGroup::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributesInverse( visitor );
+	visitor.visitList( 11, "IsGroupedBy_inverse", AttributeInverseVectorView<IfcRelAssignsToGroup>( m_IsGroupedBy_inverse ) );
+	visitor.visitList( 12, "ReferencedInStructures_inverse", AttributeInverseVectorView<IfcRelReferencedInSpatialStructure>( m_ReferencedInStructures_inverse ) );
+}
 void IFC4X3::IfcGroup::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObject::setInverseCounterparts( ptr_self_entity );
@@ -22,3 +22,10 @@ shared_ptr<IFC4X3::IfcHatchLineDistanceSelect> IFC4X3::IfcHatchLineDistanceSelec
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcHatchLineDistanceSelect> IFC4X3::IfcHatchLineDistanceSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcHatchLineDistanceSelect>(); }
+	shared_ptr<IfcHatchLineDistanceSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
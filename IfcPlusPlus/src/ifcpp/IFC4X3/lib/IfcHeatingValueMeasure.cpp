@@ -18,6 +18,10 @@ void IFC4X3::IfcHeatingValueMeasure::getStepParameter( std::stringstream& stream
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcHeatingValueMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcHeatingValueMeasure> IFC4X3::IfcHeatingValueMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcHeatingValueMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcHeatingValueMeasure> IFC4X3::IfcHeatingValueMeasure::creat
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcHeatingValueMeasure> IFC4X3::IfcHeatingValueMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcHeatingValueMeasure>(); }
+	shared_ptr<IfcHeatingValueMeasure> type_object( new IfcHeatingValueMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
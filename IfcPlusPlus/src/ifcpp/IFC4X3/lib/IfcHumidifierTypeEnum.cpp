@@ -33,6 +33,10 @@ void IFC4X3::IfcHumidifierTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcHumidifierTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcHumidifierTypeEnum> IFC4X3::IfcHumidifierTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcHumidifierTypeEnum>(); }
@@ -101,3 +105,12 @@ shared_ptr<IFC4X3::IfcHumidifierTypeEnum> IFC4X3::IfcHumidifierTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcHumidifierTypeEnum> IFC4X3::IfcHumidifierTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcHumidifierTypeEnum>(); }
+		return shared_ptr<IfcHumidifierTypeEnum>( new IfcHumidifierTypeEnum( IfcHumidifierTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -56,6 +56,21 @@ void IFC4X3::IfcIShapeProfileDef::readStepArguments( const std::vector<std::stri
 	if( num_args > 9 ){m_FlangeSlope = IfcPlaneAngleMeasure::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcIShapeProfileDef, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIShapeProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_OverallWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_OverallDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_WebThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_FlangeThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_FilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_FlangeEdgeRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_FlangeSlope = IfcPlaneAngleMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcIShapeProfileDef, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIShapeProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributes( vec_attributes );
@@ -71,6 +86,21 @@ void IFC4X3::IfcIShapeProfileDef::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcParameterizedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIShapeProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 3, "OverallWidth", m_OverallWidth );
+	visitor.visitObject( 4, "OverallDepth", m_OverallDepth );
+	visitor.visitObject( 5, "WebThickness", m_WebThickness );
+	visitor.visitObject( 6, "FlangeThickness", m_FlangeThickness );
+	visitor.visitObject( 7, "FilletRadius", m_FilletRadius );
+	visitor.visitObject( 8, "FlangeEdgeRadius", m_FlangeEdgeRadius );
+	visitor.visitObject( 9, "FlangeSlope", m_FlangeSlope );
+}
+void IFC4X3::IfcIShapeProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcParameterizedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIShapeProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcParameterizedProfileDef::setInverseCounterparts( ptr_self_entity );
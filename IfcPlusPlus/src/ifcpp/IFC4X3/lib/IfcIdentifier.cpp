@@ -18,6 +18,10 @@ void IFC4X3::IfcIdentifier::getStepParameter( std::stringstream& stream, bool is
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcIdentifier::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcIdentifier> IFC4X3::IfcIdentifier::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcIdentifier>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcIdentifier> IFC4X3::IfcIdentifier::createObjectFromSTEP( c
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcIdentifier> IFC4X3::IfcIdentifier::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcIdentifier>(); }
+	shared_ptr<IfcIdentifier> type_object( new IfcIdentifier() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcIlluminanceMeasure::getStepParameter( std::stringstream& stream,
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcIlluminanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcIlluminanceMeasure> IFC4X3::IfcIlluminanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcIlluminanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcIlluminanceMeasure> IFC4X3::IfcIlluminanceMeasure::createO
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcIlluminanceMeasure> IFC4X3::IfcIlluminanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcIlluminanceMeasure>(); }
+	shared_ptr<IfcIlluminanceMeasure> type_object( new IfcIlluminanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
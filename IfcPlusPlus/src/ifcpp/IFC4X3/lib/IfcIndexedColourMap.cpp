@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcColourRgbList.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedColourMap.h"
 #include "ifcpp/IFC4X3/include/IfcNormalisedRatioMeasure.h"
@@ -51,6 +52,15 @@ void IFC4X3::IfcIndexedColourMap::readStepArguments( const std::vector<std::stri
 	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_ColourIndex );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedColourMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedColourMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_MappedTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Opacity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Colours, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_ColourIndex );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedColourMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedColourMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -65,6 +75,18 @@ void IFC4X3::IfcIndexedColourMap::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedColourMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "MappedTo", m_MappedTo );
+	visitor.visitObject( 1, "Opacity", m_Opacity );
+	visitor.visitObject( 2, "Colours", m_Colours );
+	visitor.visitList( 3, "ColourIndex", AttributeVectorView<IfcPositiveInteger>( m_ColourIndex ) );
+}
+void IFC4X3::IfcIndexedColourMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedColourMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -75,6 +97,14 @@ void IFC4X3::IfcIndexedColourMap::setInverseCounterparts( shared_ptr<BuildingEnt
 		m_MappedTo->m_HasColours_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcIndexedColourMap::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPresentationItem::getInverseReferences( refs );
+	if( m_MappedTo )
+	{
+		refs.emplace_back( m_MappedTo.get(), INVERSE_HasColours );
+	}
+}
 void IFC4X3::IfcIndexedColourMap::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
@@ -101,3 +131,15 @@ void IFC4X3::IfcIndexedColourMap::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcIndexedColourMap::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	if( m_MappedTo )
+	{
+		refs.push_back( m_MappedTo.get() );
+	}
+	if( m_Colours )
+	{
+		refs.push_back( m_Colours.get() );
+	}
+}
@@ -53,6 +53,14 @@ void IFC4X3::IfcIndexedPolyCurve::readStepArguments( const std::vector<std::stri
 	if( num_args > 2 ){m_SelfIntersect = IfcBoolean::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolyCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedPolyCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Points, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readSelectList( args[1], m_Segments, "IFCSEGMENTINDEXSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SelfIntersect = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolyCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedPolyCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedCurve::getAttributes( vec_attributes );
@@ -66,6 +74,17 @@ void IFC4X3::IfcIndexedPolyCurve::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcBoundedCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedPolyCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Points", m_Points );
+	visitor.visitList( 1, "Segments", AttributeVectorView<IfcSegmentIndexSelect>( m_Segments ) );
+	visitor.visitObject( 2, "SelfIntersect", m_SelfIntersect );
+}
+void IFC4X3::IfcIndexedPolyCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedPolyCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedCurve::setInverseCounterparts( ptr_self_entity );
@@ -74,3 +93,11 @@ void IFC4X3::IfcIndexedPolyCurve::unlinkFromInverseCounterparts()
 {
 	IfcBoundedCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcIndexedPolyCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedCurve::getEntityReferences( refs );
+	if( m_Points )
+	{
+		refs.push_back( m_Points.get() );
+	}
+}
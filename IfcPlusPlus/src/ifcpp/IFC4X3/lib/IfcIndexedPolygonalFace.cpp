@@ -43,6 +43,12 @@ void IFC4X3::IfcIndexedPolygonalFace::readStepArguments( const std::vector<std::
 	if( num_args > 0 ){readTypeOfIntegerList( args[0], m_CoordIndex );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalFace, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedPolygonalFace::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfIntegerList( args[0], m_CoordIndex );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalFace, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedPolygonalFace::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTessellatedItem::getAttributes( vec_attributes );
@@ -72,6 +78,17 @@ void IFC4X3::IfcIndexedPolygonalFace::getAttributesInverse( std::vector<std::pai
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasTexCoords_inverse", HasTexCoords_inverse_vec_obj ) );
 }
+void IFC4X3::IfcIndexedPolygonalFace::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedItem::visitAttributes( visitor );
+	visitor.visitList( 0, "CoordIndex", AttributeVectorView<IfcPositiveInteger>( m_CoordIndex ) );
+}
+void IFC4X3::IfcIndexedPolygonalFace::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedItem::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "ToFaceSet_inverse", AttributeInverseVectorView<IfcPolygonalFaceSet>( m_ToFaceSet_inverse ) );
+	visitor.visitList( 3, "HasTexCoords_inverse", AttributeInverseVectorView<IfcTextureCoordinateIndices>( m_HasTexCoords_inverse ) );
+}
 void IFC4X3::IfcIndexedPolygonalFace::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTessellatedItem::setInverseCounterparts( ptr_self_entity );
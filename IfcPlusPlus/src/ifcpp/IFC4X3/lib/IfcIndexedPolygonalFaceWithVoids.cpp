@@ -46,6 +46,13 @@ void IFC4X3::IfcIndexedPolygonalFaceWithVoids::readStepArguments( const std::vec
 	if( num_args > 1 ){readTypeOfIntegerList2D( args[1], m_InnerCoordIndices );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalFaceWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedPolygonalFaceWithVoids::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfIntegerList( args[0], m_CoordIndex );}
+	if( num_args > 1 ){readTypeOfIntegerList2D( args[1], m_InnerCoordIndices );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalFaceWithVoids, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedPolygonalFaceWithVoids::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcIndexedPolygonalFace::getAttributes( vec_attributes );
@@ -63,6 +70,15 @@ void IFC4X3::IfcIndexedPolygonalFaceWithVoids::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcIndexedPolygonalFace::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedPolygonalFaceWithVoids::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedPolygonalFace::visitAttributes( visitor );
+	visitor.visitList2D( 1, "InnerCoordIndices", AttributeVector2DView<IfcPositiveInteger>( m_InnerCoordIndices ) );
+}
+void IFC4X3::IfcIndexedPolygonalFaceWithVoids::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedPolygonalFace::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedPolygonalFaceWithVoids::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcIndexedPolygonalFace::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedPolygonalTextureMap.h"
 #include "ifcpp/IFC4X3/include/IfcSurfaceTexture.h"
 #include "ifcpp/IFC4X3/include/IfcTessellatedFaceSet.h"
@@ -34,6 +35,15 @@ void IFC4X3::IfcIndexedPolygonalTextureMap::readStepArguments( const std::vector
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_TexCoordIndices, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalTextureMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedPolygonalTextureMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Maps, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_MappedTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_TexCoords, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_TexCoordIndices, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedPolygonalTextureMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedPolygonalTextureMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcIndexedTextureMap::getAttributes( vec_attributes );
@@ -45,6 +55,15 @@ void IFC4X3::IfcIndexedPolygonalTextureMap::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcIndexedTextureMap::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedPolygonalTextureMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedTextureMap::visitAttributes( visitor );
+	visitor.visitList( 3, "TexCoordIndices", AttributeVectorView<IfcTextureCoordinateIndices>( m_TexCoordIndices ) );
+}
+void IFC4X3::IfcIndexedPolygonalTextureMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedTextureMap::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedPolygonalTextureMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcIndexedTextureMap::setInverseCounterparts( ptr_self_entity );
@@ -58,6 +77,17 @@ void IFC4X3::IfcIndexedPolygonalTextureMap::setInverseCounterparts( shared_ptr<B
 		}
 	}
 }
+void IFC4X3::IfcIndexedPolygonalTextureMap::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcIndexedTextureMap::getInverseReferences( refs );
+	for( size_t i=0; i<m_TexCoordIndices.size(); ++i )
+	{
+		if( m_TexCoordIndices[i] )
+		{
+			refs.emplace_back( m_TexCoordIndices[i].get(), INVERSE_ToTexMap );
+		}
+	}
+}
 void IFC4X3::IfcIndexedPolygonalTextureMap::unlinkFromInverseCounterparts()
 {
 	IfcIndexedTextureMap::unlinkFromInverseCounterparts();
@@ -77,3 +107,14 @@ void IFC4X3::IfcIndexedPolygonalTextureMap::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcIndexedPolygonalTextureMap::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcIndexedTextureMap::getEntityReferences( refs );
+	for( size_t i=0; i<m_TexCoordIndices.size(); ++i )
+	{
+		if( m_TexCoordIndices[i] )
+		{
+			refs.push_back( m_TexCoordIndices[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedTextureMap.h"
 #include "ifcpp/IFC4X3/include/IfcSurfaceTexture.h"
 #include "ifcpp/IFC4X3/include/IfcTessellatedFaceSet.h"
@@ -30,6 +31,14 @@ void IFC4X3::IfcIndexedTextureMap::readStepArguments( const std::vector<std::str
 	if( num_args > 2 ){readEntityReference( args[2], m_TexCoords, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcIndexedTextureMap, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedTextureMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Maps, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_MappedTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_TexCoords, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcIndexedTextureMap, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedTextureMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTextureCoordinate::getAttributes( vec_attributes );
@@ -40,6 +49,16 @@ void IFC4X3::IfcIndexedTextureMap::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcTextureCoordinate::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedTextureMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributes( visitor );
+	visitor.visitObject( 1, "MappedTo", m_MappedTo );
+	visitor.visitObject( 2, "TexCoords", m_TexCoords );
+}
+void IFC4X3::IfcIndexedTextureMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedTextureMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTextureCoordinate::setInverseCounterparts( ptr_self_entity );
@@ -50,6 +69,14 @@ void IFC4X3::IfcIndexedTextureMap::setInverseCounterparts( shared_ptr<BuildingEn
 		m_MappedTo->m_HasTextures_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcIndexedTextureMap::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcTextureCoordinate::getInverseReferences( refs );
+	if( m_MappedTo )
+	{
+		refs.emplace_back( m_MappedTo.get(), INVERSE_HasTextures );
+	}
+}
 void IFC4X3::IfcIndexedTextureMap::unlinkFromInverseCounterparts()
 {
 	IfcTextureCoordinate::unlinkFromInverseCounterparts();
@@ -76,3 +103,15 @@ void IFC4X3::IfcIndexedTextureMap::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcIndexedTextureMap::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTextureCoordinate::getEntityReferences( refs );
+	if( m_MappedTo )
+	{
+		refs.push_back( m_MappedTo.get() );
+	}
+	if( m_TexCoords )
+	{
+		refs.push_back( m_TexCoords.get() );
+	}
+}
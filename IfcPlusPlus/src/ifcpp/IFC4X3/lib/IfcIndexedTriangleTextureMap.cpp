@@ -34,6 +34,15 @@ void IFC4X3::IfcIndexedTriangleTextureMap::readStepArguments( const std::vector<
 	if( num_args > 3 ){readTypeOfIntegerList2D( args[3], m_TexCoordIndex );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedTriangleTextureMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIndexedTriangleTextureMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Maps, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_MappedTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_TexCoords, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList2D( args[3], m_TexCoordIndex );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcIndexedTriangleTextureMap, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIndexedTriangleTextureMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcIndexedTextureMap::getAttributes( vec_attributes );
@@ -51,6 +60,15 @@ void IFC4X3::IfcIndexedTriangleTextureMap::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcIndexedTextureMap::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIndexedTriangleTextureMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedTextureMap::visitAttributes( visitor );
+	visitor.visitList2D( 3, "TexCoordIndex", AttributeVector2DView<IfcPositiveInteger>( m_TexCoordIndex ) );
+}
+void IFC4X3::IfcIndexedTriangleTextureMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcIndexedTextureMap::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIndexedTriangleTextureMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcIndexedTextureMap::setInverseCounterparts( ptr_self_entity );
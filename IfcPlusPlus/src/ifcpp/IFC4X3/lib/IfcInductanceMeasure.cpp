@@ -18,6 +18,10 @@ void IFC4X3::IfcInductanceMeasure::getStepParameter( std::stringstream& stream,
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcInductanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcInductanceMeasure> IFC4X3::IfcInductanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcInductanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcInductanceMeasure> IFC4X3::IfcInductanceMeasure::createObj
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcInductanceMeasure> IFC4X3::IfcInductanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcInductanceMeasure>(); }
+	shared_ptr<IfcInductanceMeasure> type_object( new IfcInductanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
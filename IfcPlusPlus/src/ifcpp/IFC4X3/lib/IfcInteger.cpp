@@ -18,6 +18,10 @@ void IFC4X3::IfcInteger::getStepParameter( std::stringstream& stream, bool is_se
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcInteger::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcInteger> IFC4X3::IfcInteger::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcInteger>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcInteger> IFC4X3::IfcInteger::createObjectFromSTEP( const s
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcInteger> IFC4X3::IfcInteger::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcInteger>(); }
+	shared_ptr<IfcInteger> type_object( new IfcInteger() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcIntegerCountRateMeasure::getStepParameter( std::stringstream& st
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcIntegerCountRateMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcIntegerCountRateMeasure> IFC4X3::IfcIntegerCountRateMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcIntegerCountRateMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcIntegerCountRateMeasure> IFC4X3::IfcIntegerCountRateMeasur
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcIntegerCountRateMeasure> IFC4X3::IfcIntegerCountRateMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcIntegerCountRateMeasure>(); }
+	shared_ptr<IfcIntegerCountRateMeasure> type_object( new IfcIntegerCountRateMeasure() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -70,6 +70,22 @@ void IFC4X3::IfcInventory::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 10 ){readEntityReference( args[10], m_OriginalValue, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcInventory, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcInventory::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PredefinedType = IfcInventoryTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Jurisdiction = IfcActorSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_ResponsiblePersons, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_LastUpdateDate = IfcDate::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_CurrentValue, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_OriginalValue, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcInventory, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcInventory::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGroup::getAttributes( vec_attributes );
@@ -86,6 +102,20 @@ void IFC4X3::IfcInventory::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcGroup::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcInventory::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributes( visitor );
+	visitor.visitObject( 5, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 6, "Jurisdiction", m_Jurisdiction );
+	visitor.visitList( 7, "ResponsiblePersons", AttributeVectorView<IfcPerson>( m_ResponsiblePersons ) );
+	visitor.visitObject( 8, "LastUpdateDate", m_LastUpdateDate );
+	visitor.visitObject( 9, "CurrentValue", m_CurrentValue );
+	visitor.visitObject( 10, "OriginalValue", m_OriginalValue );
+}
+void IFC4X3::IfcInventory::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcInventory::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGroup::setInverseCounterparts( ptr_self_entity );
@@ -94,3 +124,27 @@ void IFC4X3::IfcInventory::unlinkFromInverseCounterparts()
 {
 	IfcGroup::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcInventory::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGroup::getEntityReferences( refs );
+	BuildingEntity* Jurisdiction_entity = dynamic_cast<BuildingEntity*>( m_Jurisdiction.get() );
+	if( Jurisdiction_entity )
+	{
+		refs.push_back( Jurisdiction_entity );
+	}
+	for( size_t i=0; i<m_ResponsiblePersons.size(); ++i )
+	{
+		if( m_ResponsiblePersons[i] )
+		{
+			refs.push_back( m_ResponsiblePersons[i].get() );
+		}
+	}
+	if( m_CurrentValue )
+	{
+		refs.push_back( m_CurrentValue.get() );
+	}
+	if( m_OriginalValue )
+	{
+		refs.push_back( m_OriginalValue.get() );
+	}
+}
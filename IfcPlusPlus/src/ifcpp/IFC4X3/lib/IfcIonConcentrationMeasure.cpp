@@ -18,6 +18,10 @@ void IFC4X3::IfcIonConcentrationMeasure::getStepParameter( std::stringstream& st
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcIonConcentrationMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcIonConcentrationMeasure> IFC4X3::IfcIonConcentrationMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcIonConcentrationMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcIonConcentrationMeasure> IFC4X3::IfcIonConcentrationMeasur
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcIonConcentrationMeasure> IFC4X3::IfcIonConcentrationMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcIonConcentrationMeasure>(); }
+	shared_ptr<IfcIonConcentrationMeasure> type_object( new IfcIonConcentrationMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
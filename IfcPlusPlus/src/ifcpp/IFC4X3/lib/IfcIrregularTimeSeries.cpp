@@ -53,6 +53,20 @@ void IFC4X3::IfcIrregularTimeSeries::readStepArguments( const std::vector<std::s
 	if( num_args > 8 ){readEntityReferenceList( args[8], m_Values, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcIrregularTimeSeries, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIrregularTimeSeries::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_StartTime = IfcDateTime::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_EndTime = IfcDateTime::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_TimeSeriesDataType = IfcTimeSeriesDataTypeEnum::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Unit = IfcUnit::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_Values, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcIrregularTimeSeries, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIrregularTimeSeries::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTimeSeries::getAttributes( vec_attributes );
@@ -64,6 +78,15 @@ void IFC4X3::IfcIrregularTimeSeries::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcTimeSeries::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcIrregularTimeSeries::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTimeSeries::visitAttributes( visitor );
+	visitor.visitList( 8, "Values", AttributeVectorView<IfcIrregularTimeSeriesValue>( m_Values ) );
+}
+void IFC4X3::IfcIrregularTimeSeries::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTimeSeries::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcIrregularTimeSeries::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTimeSeries::setInverseCounterparts( ptr_self_entity );
@@ -72,3 +95,14 @@ void IFC4X3::IfcIrregularTimeSeries::unlinkFromInverseCounterparts()
 {
 	IfcTimeSeries::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcIrregularTimeSeries::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTimeSeries::getEntityReferences( refs );
+	for( size_t i=0; i<m_Values.size(); ++i )
+	{
+		if( m_Values[i] )
+		{
+			refs.push_back( m_Values[i].get() );
+		}
+	}
+}
@@ -43,6 +43,13 @@ void IFC4X3::IfcIrregularTimeSeriesValue::readStepArguments( const std::vector<s
 	if( num_args > 1 ){readSelectList( args[1], m_ListValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcIrregularTimeSeriesValue, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcIrregularTimeSeriesValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_TimeStamp = IfcDateTime::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readSelectList( args[1], m_ListValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcIrregularTimeSeriesValue, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcIrregularTimeSeriesValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "TimeStamp", m_TimeStamp ) );
@@ -53,6 +60,14 @@ void IFC4X3::IfcIrregularTimeSeriesValue::getAttributes( std::vector<std::pair<s
 void IFC4X3::IfcIrregularTimeSeriesValue::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcIrregularTimeSeriesValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "TimeStamp", m_TimeStamp );
+	visitor.visitList( 1, "ListValues", AttributeVectorView<IfcValue>( m_ListValues ) );
+}
+void IFC4X3::IfcIrregularTimeSeriesValue::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcIrregularTimeSeriesValue::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -20,6 +20,10 @@ void IFC4X3::IfcKerbTypeEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcKerbTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcKerbTypeEnum> IFC4X3::IfcKerbTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcKerbTypeEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcKerbTypeEnum> IFC4X3::IfcKerbTypeEnum::createObjectFromSTE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcKerbTypeEnum> IFC4X3::IfcKerbTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcKerbTypeEnum>(); }
+		return shared_ptr<IfcKerbTypeEnum>( new IfcKerbTypeEnum( IfcKerbTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcKinematicViscosityMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcKinematicViscosityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcKinematicViscosityMeasure> IFC4X3::IfcKinematicViscosityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcKinematicViscosityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcKinematicViscosityMeasure> IFC4X3::IfcKinematicViscosityMe
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcKinematicViscosityMeasure> IFC4X3::IfcKinematicViscosityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcKinematicViscosityMeasure>(); }
+	shared_ptr<IfcKinematicViscosityMeasure> type_object( new IfcKinematicViscosityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -22,6 +22,10 @@ void IFC4X3::IfcKnotType::getStepParameter( std::stringstream& stream, bool is_s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcKnotType::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcKnotType> IFC4X3::IfcKnotType::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcKnotType>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcKnotType> IFC4X3::IfcKnotType::createObjectFromSTEP( const
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcKnotType> IFC4X3::IfcKnotType::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UNSPECIFIED ) { return shared_ptr<IfcKnotType>(); }
+		return shared_ptr<IfcKnotType>( new IfcKnotType( IfcKnotTypeEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcLabel::getStepParameter( std::stringstream& stream, bool is_sele
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLabel::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLabel> IFC4X3::IfcLabel::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLabel>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcLabel> IFC4X3::IfcLabel::createObjectFromSTEP( const std::
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLabel> IFC4X3::IfcLabel::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLabel>(); }
+	shared_ptr<IfcLabel> type_object( new IfcLabel() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -39,6 +39,10 @@ void IFC4X3::IfcLaborResourceTypeEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLaborResourceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLaborResourceTypeEnum> IFC4X3::IfcLaborResourceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLaborResourceTypeEnum>(); }
@@ -131,3 +135,12 @@ shared_ptr<IFC4X3::IfcLaborResourceTypeEnum> IFC4X3::IfcLaborResourceTypeEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLaborResourceTypeEnum> IFC4X3::IfcLaborResourceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcLaborResourceTypeEnum>(); }
+		return shared_ptr<IfcLaborResourceTypeEnum>( new IfcLaborResourceTypeEnum( IfcLaborResourceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
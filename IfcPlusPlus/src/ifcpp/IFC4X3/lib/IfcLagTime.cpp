@@ -37,6 +37,16 @@ void IFC4X3::IfcLagTime::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 4 ){m_DurationType = IfcTaskDurationEnum::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcLagTime, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLagTime::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_LagValue = IfcTimeOrRatioSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_DurationType = IfcTaskDurationEnum::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcLagTime, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLagTime::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSchedulingTime::getAttributes( vec_attributes );
@@ -47,6 +57,16 @@ void IFC4X3::IfcLagTime::getAttributesInverse( std::vector<std::pair<std::string
 {
 	IFC4X3::IfcSchedulingTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLagTime::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributes( visitor );
+	visitor.visitObject( 3, "LagValue", m_LagValue );
+	visitor.visitObject( 4, "DurationType", m_DurationType );
+}
+void IFC4X3::IfcLagTime::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLagTime::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSchedulingTime::setInverseCounterparts( ptr_self_entity );
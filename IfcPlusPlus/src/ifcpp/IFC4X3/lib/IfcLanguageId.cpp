@@ -25,3 +25,10 @@ shared_ptr<IFC4X3::IfcLanguageId> IFC4X3::IfcLanguageId::createObjectFromSTEP( c
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLanguageId> IFC4X3::IfcLanguageId::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLanguageId>(); }
+	shared_ptr<IfcLanguageId> type_object( new IfcLanguageId() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
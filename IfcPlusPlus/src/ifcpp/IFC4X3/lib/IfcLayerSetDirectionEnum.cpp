@@ -21,6 +21,10 @@ void IFC4X3::IfcLayerSetDirectionEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLayerSetDirectionEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLayerSetDirectionEnum> IFC4X3::IfcLayerSetDirectionEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLayerSetDirectionEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcLayerSetDirectionEnum> IFC4X3::IfcLayerSetDirectionEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLayerSetDirectionEnum> IFC4X3::IfcLayerSetDirectionEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_AXIS3 ) { return shared_ptr<IfcLayerSetDirectionEnum>(); }
+		return shared_ptr<IfcLayerSetDirectionEnum>( new IfcLayerSetDirectionEnum( IfcLayerSetDirectionEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
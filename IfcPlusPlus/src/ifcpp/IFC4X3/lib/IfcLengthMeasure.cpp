@@ -21,6 +21,10 @@ void IFC4X3::IfcLengthMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLengthMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLengthMeasure> IFC4X3::IfcLengthMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLengthMeasure>(); }
@@ -30,3 +34,10 @@ shared_ptr<IFC4X3::IfcLengthMeasure> IFC4X3::IfcLengthMeasure::createObjectFromS
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLengthMeasure> IFC4X3::IfcLengthMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLengthMeasure>(); }
+	shared_ptr<IfcLengthMeasure> type_object( new IfcLengthMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
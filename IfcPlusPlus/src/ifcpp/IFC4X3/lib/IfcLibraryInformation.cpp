@@ -43,6 +43,17 @@ void IFC4X3::IfcLibraryInformation::readStepArguments( const std::vector<std::st
 	if( num_args > 5 ){m_Description = IfcText::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcLibraryInformation, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLibraryInformation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Version = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Publisher = IfcActorSelect::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_VersionDate = IfcDateTime::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Location = IfcURIReference::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Description = IfcText::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcLibraryInformation, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLibraryInformation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalInformation::getAttributes( vec_attributes );
@@ -75,6 +86,22 @@ void IFC4X3::IfcLibraryInformation::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasLibraryReferences_inverse", HasLibraryReferences_inverse_vec_obj ) );
 }
+void IFC4X3::IfcLibraryInformation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Version", m_Version );
+	visitor.visitObject( 2, "Publisher", m_Publisher );
+	visitor.visitObject( 3, "VersionDate", m_VersionDate );
+	visitor.visitObject( 4, "Location", m_Location );
+	visitor.visitObject( 5, "Description", m_Description );
+}
+void IFC4X3::IfcLibraryInformation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalInformation::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "LibraryInfoForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesLibrary>( m_LibraryInfoForObjects_inverse ) );
+	visitor.visitList( 1, "HasLibraryReferences_inverse", AttributeInverseVectorView<IfcLibraryReference>( m_HasLibraryReferences_inverse ) );
+}
 void IFC4X3::IfcLibraryInformation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalInformation::setInverseCounterparts( ptr_self_entity );
@@ -83,3 +110,12 @@ void IFC4X3::IfcLibraryInformation::unlinkFromInverseCounterparts()
 {
 	IfcExternalInformation::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLibraryInformation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExternalInformation::getEntityReferences( refs );
+	BuildingEntity* Publisher_entity = dynamic_cast<BuildingEntity*>( m_Publisher.get() );
+	if( Publisher_entity )
+	{
+		refs.push_back( Publisher_entity );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -44,6 +45,17 @@ void IFC4X3::IfcLibraryReference::readStepArguments( const std::vector<std::stri
 	if( num_args > 5 ){readEntityReference( args[5], m_ReferencedLibrary, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcLibraryReference, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLibraryReference::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Location = IfcURIReference::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Language = IfcLanguageId::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ReferencedLibrary, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcLibraryReference, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLibraryReference::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExternalReference::getAttributes( vec_attributes );
@@ -64,6 +76,18 @@ void IFC4X3::IfcLibraryReference::getAttributesInverse( std::vector<std::pair<st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "LibraryRefForObjects_inverse", LibraryRefForObjects_inverse_vec_obj ) );
 }
+void IFC4X3::IfcLibraryReference::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributes( visitor );
+	visitor.visitObject( 3, "Description", m_Description );
+	visitor.visitObject( 4, "Language", m_Language );
+	visitor.visitObject( 5, "ReferencedLibrary", m_ReferencedLibrary );
+}
+void IFC4X3::IfcLibraryReference::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExternalReference::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "LibraryRefForObjects_inverse", AttributeInverseVectorView<IfcRelAssociatesLibrary>( m_LibraryRefForObjects_inverse ) );
+}
 void IFC4X3::IfcLibraryReference::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExternalReference::setInverseCounterparts( ptr_self_entity );
@@ -74,6 +98,14 @@ void IFC4X3::IfcLibraryReference::setInverseCounterparts( shared_ptr<BuildingEnt
 		m_ReferencedLibrary->m_HasLibraryReferences_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcLibraryReference::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcExternalReference::getInverseReferences( refs );
+	if( m_ReferencedLibrary )
+	{
+		refs.emplace_back( m_ReferencedLibrary.get(), INVERSE_HasLibraryReferences );
+	}
+}
 void IFC4X3::IfcLibraryReference::unlinkFromInverseCounterparts()
 {
 	IfcExternalReference::unlinkFromInverseCounterparts();
@@ -100,3 +132,11 @@ void IFC4X3::IfcLibraryReference::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcLibraryReference::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExternalReference::getEntityReferences( refs );
+	if( m_ReferencedLibrary )
+	{
+		refs.push_back( m_ReferencedLibrary.get() );
+	}
+}
@@ -22,6 +22,10 @@ void IFC4X3::IfcLightDistributionCurveEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLightDistributionCurveEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLightDistributionCurveEnum> IFC4X3::IfcLightDistributionCurveEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLightDistributionCurveEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcLightDistributionCurveEnum> IFC4X3::IfcLightDistributionCu
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLightDistributionCurveEnum> IFC4X3::IfcLightDistributionCurveEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcLightDistributionCurveEnum>(); }
+		return shared_ptr<IfcLightDistributionCurveEnum>( new IfcLightDistributionCurveEnum( IfcLightDistributionCurveEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -29,6 +29,14 @@ void IFC4X3::IfcLightDistributionData::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){readTypeOfRealList( args[2], m_LuminousIntensity );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcLightDistributionData, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightDistributionData::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_MainPlaneAngle = IfcPlaneAngleMeasure::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList( args[1], m_SecondaryPlaneAngle );}
+	if( num_args > 2 ){readTypeOfRealList( args[2], m_LuminousIntensity );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcLightDistributionData, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightDistributionData::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "MainPlaneAngle", m_MainPlaneAngle ) );
@@ -42,6 +50,15 @@ void IFC4X3::IfcLightDistributionData::getAttributes( std::vector<std::pair<std:
 void IFC4X3::IfcLightDistributionData::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcLightDistributionData::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "MainPlaneAngle", m_MainPlaneAngle );
+	visitor.visitList( 1, "SecondaryPlaneAngle", AttributeVectorView<IfcPlaneAngleMeasure>( m_SecondaryPlaneAngle ) );
+	visitor.visitList( 2, "LuminousIntensity", AttributeVectorView<IfcLuminousIntensityDistributionMeasure>( m_LuminousIntensity ) );
+}
+void IFC4X3::IfcLightDistributionData::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcLightDistributionData::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -29,6 +29,10 @@ void IFC4X3::IfcLightEmissionSourceEnum::getStepParameter( std::stringstream& st
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLightEmissionSourceEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLightEmissionSourceEnum> IFC4X3::IfcLightEmissionSourceEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLightEmissionSourceEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcLightEmissionSourceEnum> IFC4X3::IfcLightEmissionSourceEnu
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLightEmissionSourceEnum> IFC4X3::IfcLightEmissionSourceEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcLightEmissionSourceEnum>(); }
+		return shared_ptr<IfcLightEmissionSourceEnum>( new IfcLightEmissionSourceEnum( IfcLightEmissionSourceEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcLightFixtureTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLightFixtureTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLightFixtureTypeEnum> IFC4X3::IfcLightFixtureTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLightFixtureTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcLightFixtureTypeEnum> IFC4X3::IfcLightFixtureTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLightFixtureTypeEnum> IFC4X3::IfcLightFixtureTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcLightFixtureTypeEnum>(); }
+		return shared_ptr<IfcLightFixtureTypeEnum>( new IfcLightFixtureTypeEnum( IfcLightFixtureTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
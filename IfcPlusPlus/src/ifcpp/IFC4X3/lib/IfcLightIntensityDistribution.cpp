@@ -26,6 +26,13 @@ void IFC4X3::IfcLightIntensityDistribution::readStepArguments( const std::vector
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_DistributionData, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLightIntensityDistribution, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightIntensityDistribution::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_LightDistributionCurve = IfcLightDistributionCurveEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_DistributionData, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLightIntensityDistribution, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightIntensityDistribution::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "LightDistributionCurve", m_LightDistributionCurve ) );
@@ -36,9 +43,27 @@ void IFC4X3::IfcLightIntensityDistribution::getAttributes( std::vector<std::pair
 void IFC4X3::IfcLightIntensityDistribution::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcLightIntensityDistribution::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "LightDistributionCurve", m_LightDistributionCurve );
+	visitor.visitList( 1, "DistributionData", AttributeVectorView<IfcLightDistributionData>( m_DistributionData ) );
+}
+void IFC4X3::IfcLightIntensityDistribution::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcLightIntensityDistribution::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcLightIntensityDistribution::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcLightIntensityDistribution::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_DistributionData.size(); ++i )
+	{
+		if( m_DistributionData[i] )
+		{
+			refs.push_back( m_DistributionData[i].get() );
+		}
+	}
+}
@@ -35,6 +35,15 @@ void IFC4X3::IfcLightSourceAmbient::readStepArguments( const std::vector<std::st
 	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcLightSourceAmbient, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightSourceAmbient::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_LightColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AmbientIntensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcLightSourceAmbient, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightSourceAmbient::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLightSource::getAttributes( vec_attributes );
@@ -43,6 +52,14 @@ void IFC4X3::IfcLightSourceAmbient::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcLightSource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLightSourceAmbient::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributes( visitor );
+}
+void IFC4X3::IfcLightSourceAmbient::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLightSourceAmbient::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLightSource::setInverseCounterparts( ptr_self_entity );
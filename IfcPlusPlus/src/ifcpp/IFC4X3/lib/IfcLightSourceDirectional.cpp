@@ -39,6 +39,16 @@ void IFC4X3::IfcLightSourceDirectional::readStepArguments( const std::vector<std
 	if( num_args > 4 ){readEntityReference( args[4], m_Orientation, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcLightSourceDirectional, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightSourceDirectional::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_LightColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AmbientIntensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_Orientation, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcLightSourceDirectional, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightSourceDirectional::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLightSource::getAttributes( vec_attributes );
@@ -48,6 +58,15 @@ void IFC4X3::IfcLightSourceDirectional::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcLightSource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLightSourceDirectional::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributes( visitor );
+	visitor.visitObject( 4, "Orientation", m_Orientation );
+}
+void IFC4X3::IfcLightSourceDirectional::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLightSourceDirectional::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLightSource::setInverseCounterparts( ptr_self_entity );
@@ -56,3 +75,11 @@ void IFC4X3::IfcLightSourceDirectional::unlinkFromInverseCounterparts()
 {
 	IfcLightSource::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLightSourceDirectional::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcLightSource::getEntityReferences( refs );
+	if( m_Orientation )
+	{
+		refs.push_back( m_Orientation.get() );
+	}
+}
@@ -58,6 +58,21 @@ void IFC4X3::IfcLightSourceGoniometric::readStepArguments( const std::vector<std
 	if( num_args > 9 ){m_LightDistributionDataSource = IfcLightDistributionDataSourceSelect::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcLightSourceGoniometric, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightSourceGoniometric::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_LightColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AmbientIntensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ColourAppearance, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ColourTemperature = IfcThermodynamicTemperatureMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LuminousFlux = IfcLuminousFluxMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_LightEmissionSource = IfcLightEmissionSourceEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_LightDistributionDataSource = IfcLightDistributionDataSourceSelect::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcLightSourceGoniometric, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightSourceGoniometric::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLightSource::getAttributes( vec_attributes );
@@ -72,6 +87,20 @@ void IFC4X3::IfcLightSourceGoniometric::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcLightSource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLightSourceGoniometric::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributes( visitor );
+	visitor.visitObject( 4, "Position", m_Position );
+	visitor.visitObject( 5, "ColourAppearance", m_ColourAppearance );
+	visitor.visitObject( 6, "ColourTemperature", m_ColourTemperature );
+	visitor.visitObject( 7, "LuminousFlux", m_LuminousFlux );
+	visitor.visitObject( 8, "LightEmissionSource", m_LightEmissionSource );
+	visitor.visitObject( 9, "LightDistributionDataSource", m_LightDistributionDataSource );
+}
+void IFC4X3::IfcLightSourceGoniometric::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLightSourceGoniometric::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLightSource::setInverseCounterparts( ptr_self_entity );
@@ -80,3 +109,20 @@ void IFC4X3::IfcLightSourceGoniometric::unlinkFromInverseCounterparts()
 {
 	IfcLightSource::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLightSourceGoniometric::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcLightSource::getEntityReferences( refs );
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+	if( m_ColourAppearance )
+	{
+		refs.push_back( m_ColourAppearance.get() );
+	}
+	BuildingEntity* LightDistributionDataSource_entity = dynamic_cast<BuildingEntity*>( m_LightDistributionDataSource.get() );
+	if( LightDistributionDataSource_entity )
+	{
+		refs.push_back( LightDistributionDataSource_entity );
+	}
+}
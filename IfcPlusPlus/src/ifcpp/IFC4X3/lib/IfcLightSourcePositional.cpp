@@ -53,6 +53,20 @@ void IFC4X3::IfcLightSourcePositional::readStepArguments( const std::vector<std:
 	if( num_args > 8 ){m_QuadricAttenuation = IfcReal::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcLightSourcePositional, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightSourcePositional::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_LightColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AmbientIntensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ConstantAttenuation = IfcReal::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_DistanceAttenuation = IfcReal::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_QuadricAttenuation = IfcReal::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcLightSourcePositional, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightSourcePositional::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLightSource::getAttributes( vec_attributes );
@@ -66,6 +80,19 @@ void IFC4X3::IfcLightSourcePositional::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcLightSource::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLightSourcePositional::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributes( visitor );
+	visitor.visitObject( 4, "Position", m_Position );
+	visitor.visitObject( 5, "Radius", m_Radius );
+	visitor.visitObject( 6, "ConstantAttenuation", m_ConstantAttenuation );
+	visitor.visitObject( 7, "DistanceAttenuation", m_DistanceAttenuation );
+	visitor.visitObject( 8, "QuadricAttenuation", m_QuadricAttenuation );
+}
+void IFC4X3::IfcLightSourcePositional::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSource::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLightSourcePositional::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLightSource::setInverseCounterparts( ptr_self_entity );
@@ -74,3 +101,11 @@ void IFC4X3::IfcLightSourcePositional::unlinkFromInverseCounterparts()
 {
 	IfcLightSource::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLightSourcePositional::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcLightSource::getEntityReferences( refs );
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+}
@@ -67,6 +67,24 @@ void IFC4X3::IfcLightSourceSpot::readStepArguments( const std::vector<std::strin
 	if( num_args > 12 ){m_BeamWidthAngle = IfcPositivePlaneAngleMeasure::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcLightSourceSpot, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLightSourceSpot::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_LightColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_AmbientIntensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Intensity = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ConstantAttenuation = IfcReal::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_DistanceAttenuation = IfcReal::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_QuadricAttenuation = IfcReal::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_Orientation, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_ConcentrationExponent = IfcReal::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_SpreadAngle = IfcPositivePlaneAngleMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_BeamWidthAngle = IfcPositivePlaneAngleMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcLightSourceSpot, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLightSourceSpot::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLightSourcePositional::getAttributes( vec_attributes );
@@ -79,6 +97,18 @@ void IFC4X3::IfcLightSourceSpot::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcLightSourcePositional::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLightSourceSpot::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSourcePositional::visitAttributes( visitor );
+	visitor.visitObject( 9, "Orientation", m_Orientation );
+	visitor.visitObject( 10, "ConcentrationExponent", m_ConcentrationExponent );
+	visitor.visitObject( 11, "SpreadAngle", m_SpreadAngle );
+	visitor.visitObject( 12, "BeamWidthAngle", m_BeamWidthAngle );
+}
+void IFC4X3::IfcLightSourceSpot::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLightSourcePositional::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLightSourceSpot::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLightSourcePositional::setInverseCounterparts( ptr_self_entity );
@@ -87,3 +117,11 @@ void IFC4X3::IfcLightSourceSpot::unlinkFromInverseCounterparts()
 {
 	IfcLightSourcePositional::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLightSourceSpot::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcLightSourcePositional::getEntityReferences( refs );
+	if( m_Orientation )
+	{
+		refs.push_back( m_Orientation.get() );
+	}
+}
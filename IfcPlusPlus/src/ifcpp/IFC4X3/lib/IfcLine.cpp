@@ -28,6 +28,13 @@ void IFC4X3::IfcLine::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 1 ){readEntityReference( args[1], m_Dir, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLine, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLine::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Pnt, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Dir, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLine, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLine::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcLine::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLine::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Pnt", m_Pnt );
+	visitor.visitObject( 1, "Dir", m_Dir );
+}
+void IFC4X3::IfcLine::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLine::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,15 @@ void IFC4X3::IfcLine::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLine::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	if( m_Pnt )
+	{
+		refs.push_back( m_Pnt.get() );
+	}
+	if( m_Dir )
+	{
+		refs.push_back( m_Dir.get() );
+	}
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcLineIndex::getStepParameter( std::stringstream& stream, bool is_
 	writeTypeOfIntList( stream, m_vec, false );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLineIndex::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeTyped( classID(), [&]() { return encoder.encodeList( AttributeVectorView<IfcPositiveInteger>( m_vec ) ); } );
+}
 shared_ptr<IFC4X3::IfcLineIndex> IFC4X3::IfcLineIndex::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLineIndex>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcLineIndex> IFC4X3::IfcLineIndex::createObjectFromSTEP( con
 	readTypeOfIntegerList( arg, type_object->m_vec );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLineIndex> IFC4X3::IfcLineIndex::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLineIndex>(); }
+	shared_ptr<IfcLineIndex> type_object( new IfcLineIndex() );
+	readTypeOfIntegerList( arg, type_object->m_vec );
+	return type_object;
+}
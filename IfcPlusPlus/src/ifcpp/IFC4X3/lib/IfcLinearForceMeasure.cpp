@@ -18,6 +18,10 @@ void IFC4X3::IfcLinearForceMeasure::getStepParameter( std::stringstream& stream,
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLinearForceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLinearForceMeasure> IFC4X3::IfcLinearForceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLinearForceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcLinearForceMeasure> IFC4X3::IfcLinearForceMeasure::createO
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLinearForceMeasure> IFC4X3::IfcLinearForceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLinearForceMeasure>(); }
+	shared_ptr<IfcLinearForceMeasure> type_object( new IfcLinearForceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
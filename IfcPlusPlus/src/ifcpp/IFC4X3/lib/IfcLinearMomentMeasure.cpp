@@ -18,6 +18,10 @@ void IFC4X3::IfcLinearMomentMeasure::getStepParameter( std::stringstream& stream
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLinearMomentMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLinearMomentMeasure> IFC4X3::IfcLinearMomentMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLinearMomentMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcLinearMomentMeasure> IFC4X3::IfcLinearMomentMeasure::creat
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLinearMomentMeasure> IFC4X3::IfcLinearMomentMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLinearMomentMeasure>(); }
+	shared_ptr<IfcLinearMomentMeasure> type_object( new IfcLinearMomentMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
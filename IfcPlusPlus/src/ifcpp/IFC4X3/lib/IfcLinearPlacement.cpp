@@ -31,6 +31,14 @@ void IFC4X3::IfcLinearPlacement::readStepArguments( const std::vector<std::strin
 	if( num_args > 2 ){readEntityReference( args[2], m_CartesianPosition, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcLinearPlacement, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLinearPlacement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_PlacementRelTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_RelativePlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_CartesianPosition, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcLinearPlacement, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLinearPlacement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectPlacement::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcLinearPlacement::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcObjectPlacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLinearPlacement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributes( visitor );
+	visitor.visitObject( 1, "RelativePlacement", m_RelativePlacement );
+	visitor.visitObject( 2, "CartesianPosition", m_CartesianPosition );
+}
+void IFC4X3::IfcLinearPlacement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLinearPlacement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectPlacement::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +67,15 @@ void IFC4X3::IfcLinearPlacement::unlinkFromInverseCounterparts()
 {
 	IfcObjectPlacement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLinearPlacement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObjectPlacement::getEntityReferences( refs );
+	if( m_RelativePlacement )
+	{
+		refs.push_back( m_RelativePlacement.get() );
+	}
+	if( m_CartesianPosition )
+	{
+		refs.push_back( m_CartesianPosition.get() );
+	}
+}
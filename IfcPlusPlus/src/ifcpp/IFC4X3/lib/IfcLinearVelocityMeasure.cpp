@@ -18,6 +18,10 @@ void IFC4X3::IfcLinearVelocityMeasure::getStepParameter( std::stringstream& stre
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLinearVelocityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLinearVelocityMeasure> IFC4X3::IfcLinearVelocityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLinearVelocityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcLinearVelocityMeasure> IFC4X3::IfcLinearVelocityMeasure::c
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLinearVelocityMeasure> IFC4X3::IfcLinearVelocityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLinearVelocityMeasure>(); }
+	shared_ptr<IfcLinearVelocityMeasure> type_object( new IfcLinearVelocityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
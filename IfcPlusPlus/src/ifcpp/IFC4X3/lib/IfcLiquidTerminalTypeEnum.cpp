@@ -22,6 +22,10 @@ void IFC4X3::IfcLiquidTerminalTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLiquidTerminalTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLiquidTerminalTypeEnum> IFC4X3::IfcLiquidTerminalTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLiquidTerminalTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcLiquidTerminalTypeEnum> IFC4X3::IfcLiquidTerminalTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLiquidTerminalTypeEnum> IFC4X3::IfcLiquidTerminalTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcLiquidTerminalTypeEnum>(); }
+		return shared_ptr<IfcLiquidTerminalTypeEnum>( new IfcLiquidTerminalTypeEnum( IfcLiquidTerminalTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -27,6 +27,13 @@ void IFC4X3::IfcLocalPlacement::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){m_RelativePlacement = IfcAxis2Placement::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLocalPlacement, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcLocalPlacement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_PlacementRelTo, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RelativePlacement = IfcAxis2Placement::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcLocalPlacement, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcLocalPlacement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectPlacement::getAttributes( vec_attributes );
@@ -36,6 +43,15 @@ void IFC4X3::IfcLocalPlacement::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcObjectPlacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLocalPlacement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributes( visitor );
+	visitor.visitObject( 1, "RelativePlacement", m_RelativePlacement );
+}
+void IFC4X3::IfcLocalPlacement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectPlacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLocalPlacement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectPlacement::setInverseCounterparts( ptr_self_entity );
@@ -44,3 +60,12 @@ void IFC4X3::IfcLocalPlacement::unlinkFromInverseCounterparts()
 {
 	IfcObjectPlacement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcLocalPlacement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObjectPlacement::getEntityReferences( refs );
+	BuildingEntity* RelativePlacement_entity = dynamic_cast<BuildingEntity*>( m_RelativePlacement.get() );
+	if( RelativePlacement_entity )
+	{
+		refs.push_back( RelativePlacement_entity );
+	}
+}
@@ -29,6 +29,10 @@ void IFC4X3::IfcLogical::getStepParameter( std::stringstream& stream, bool is_se
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLogical::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeLogical( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLogical> IFC4X3::IfcLogical::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLogical>(); }
@@ -38,3 +42,10 @@ shared_ptr<IFC4X3::IfcLogical> IFC4X3::IfcLogical::createObjectFromSTEP( const s
 	readLogical( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLogical> IFC4X3::IfcLogical::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLogical>(); }
+	shared_ptr<IfcLogical> type_object( new IfcLogical() );
+	readLogical( arg, type_object->m_value );
+	return type_object;
+}
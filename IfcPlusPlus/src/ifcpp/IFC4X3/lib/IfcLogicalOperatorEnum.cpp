@@ -23,6 +23,10 @@ void IFC4X3::IfcLogicalOperatorEnum::getStepParameter( std::stringstream& stream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLogicalOperatorEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcLogicalOperatorEnum> IFC4X3::IfcLogicalOperatorEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLogicalOperatorEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcLogicalOperatorEnum> IFC4X3::IfcLogicalOperatorEnum::creat
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLogicalOperatorEnum> IFC4X3::IfcLogicalOperatorEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_LOGICALXOR ) { return shared_ptr<IfcLogicalOperatorEnum>(); }
+		return shared_ptr<IfcLogicalOperatorEnum>( new IfcLogicalOperatorEnum( IfcLogicalOperatorEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
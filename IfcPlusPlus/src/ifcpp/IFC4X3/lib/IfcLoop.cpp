@@ -19,6 +19,9 @@ void IFC4X3::IfcLoop::getStepParameter( std::stringstream& stream, bool /*is_sel
 void IFC4X3::IfcLoop::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcLoop::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcLoop::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -27,6 +30,14 @@ void IFC4X3::IfcLoop::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcLoop::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+}
+void IFC4X3::IfcLoop::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcLoop::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcLuminousIntensityMeasure::getStepParameter( std::stringstream& s
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcLuminousIntensityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcLuminousIntensityMeasure> IFC4X3::IfcLuminousIntensityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcLuminousIntensityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcLuminousIntensityMeasure> IFC4X3::IfcLuminousIntensityMeas
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcLuminousIntensityMeasure> IFC4X3::IfcLuminousIntensityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcLuminousIntensityMeasure>(); }
+	shared_ptr<IfcLuminousIntensityMeasure> type_object( new IfcLuminousIntensityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcMagneticFluxDensityMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMagneticFluxDensityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcMagneticFluxDensityMeasure> IFC4X3::IfcMagneticFluxDensityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMagneticFluxDensityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcMagneticFluxDensityMeasure> IFC4X3::IfcMagneticFluxDensity
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMagneticFluxDensityMeasure> IFC4X3::IfcMagneticFluxDensityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcMagneticFluxDensityMeasure>(); }
+	shared_ptr<IfcMagneticFluxDensityMeasure> type_object( new IfcMagneticFluxDensityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcManifoldSolidBrep::readStepArguments( const std::vector<std::str
 	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcManifoldSolidBrep, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcManifoldSolidBrep::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Outer, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcManifoldSolidBrep, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcManifoldSolidBrep::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSolidModel::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcManifoldSolidBrep::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcSolidModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcManifoldSolidBrep::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributes( visitor );
+	visitor.visitObject( 0, "Outer", m_Outer );
+}
+void IFC4X3::IfcManifoldSolidBrep::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcManifoldSolidBrep::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSolidModel::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,11 @@ void IFC4X3::IfcManifoldSolidBrep::unlinkFromInverseCounterparts()
 {
 	IfcSolidModel::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcManifoldSolidBrep::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSolidModel::getEntityReferences( refs );
+	if( m_Outer )
+	{
+		refs.push_back( m_Outer.get() );
+	}
+}
@@ -46,6 +46,19 @@ void IFC4X3::IfcMapConversion::readStepArguments( const std::vector<std::string>
 	if( num_args > 7 ){m_Scale = IfcReal::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcMapConversion, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMapConversion::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SourceCRS = IfcCoordinateReferenceSystemSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TargetCRS, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Eastings = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Northings = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_OrthogonalHeight = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_XAxisAbscissa = IfcReal::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_XAxisOrdinate = IfcReal::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Scale = IfcReal::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcMapConversion, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMapConversion::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCoordinateOperation::getAttributes( vec_attributes );
@@ -60,6 +73,20 @@ void IFC4X3::IfcMapConversion::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcCoordinateOperation::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMapConversion::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateOperation::visitAttributes( visitor );
+	visitor.visitObject( 2, "Eastings", m_Eastings );
+	visitor.visitObject( 3, "Northings", m_Northings );
+	visitor.visitObject( 4, "OrthogonalHeight", m_OrthogonalHeight );
+	visitor.visitObject( 5, "XAxisAbscissa", m_XAxisAbscissa );
+	visitor.visitObject( 6, "XAxisOrdinate", m_XAxisOrdinate );
+	visitor.visitObject( 7, "Scale", m_Scale );
+}
+void IFC4X3::IfcMapConversion::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateOperation::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMapConversion::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCoordinateOperation::setInverseCounterparts( ptr_self_entity );
@@ -55,6 +55,22 @@ void IFC4X3::IfcMapConversionScaled::readStepArguments( const std::vector<std::s
 	if( num_args > 10 ){m_FactorZ = IfcReal::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcMapConversionScaled, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMapConversionScaled::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SourceCRS = IfcCoordinateReferenceSystemSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TargetCRS, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Eastings = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Northings = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_OrthogonalHeight = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_XAxisAbscissa = IfcReal::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_XAxisOrdinate = IfcReal::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Scale = IfcReal::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_FactorX = IfcReal::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_FactorY = IfcReal::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_FactorZ = IfcReal::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcMapConversionScaled, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMapConversionScaled::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMapConversion::getAttributes( vec_attributes );
@@ -66,6 +82,17 @@ void IFC4X3::IfcMapConversionScaled::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcMapConversion::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMapConversionScaled::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMapConversion::visitAttributes( visitor );
+	visitor.visitObject( 8, "FactorX", m_FactorX );
+	visitor.visitObject( 9, "FactorY", m_FactorY );
+	visitor.visitObject( 10, "FactorZ", m_FactorZ );
+}
+void IFC4X3::IfcMapConversionScaled::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMapConversion::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMapConversionScaled::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMapConversion::setInverseCounterparts( ptr_self_entity );
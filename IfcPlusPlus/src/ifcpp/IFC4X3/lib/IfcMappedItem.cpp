@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCartesianTransformationOperator.h"
 #include "ifcpp/IFC4X3/include/IfcMappedItem.h"
 #include "ifcpp/IFC4X3/include/IfcPresentationLayerAssignment.h"
@@ -28,6 +29,13 @@ void IFC4X3::IfcMappedItem::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 1 ){readEntityReference( args[1], m_MappingTarget, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMappedItem, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMappedItem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_MappingSource, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_MappingTarget, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMappedItem, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMappedItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRepresentationItem::getAttributes( vec_attributes );
@@ -38,6 +46,16 @@ void IFC4X3::IfcMappedItem::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMappedItem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "MappingSource", m_MappingSource );
+	visitor.visitObject( 1, "MappingTarget", m_MappingTarget );
+}
+void IFC4X3::IfcMappedItem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMappedItem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -48,6 +66,14 @@ void IFC4X3::IfcMappedItem::setInverseCounterparts( shared_ptr<BuildingEntity> p
 		m_MappingSource->m_MapUsage_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcMappedItem::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRepresentationItem::getInverseReferences( refs );
+	if( m_MappingSource )
+	{
+		refs.emplace_back( m_MappingSource.get(), INVERSE_MapUsage );
+	}
+}
 void IFC4X3::IfcMappedItem::unlinkFromInverseCounterparts()
 {
 	IfcRepresentationItem::unlinkFromInverseCounterparts();
@@ -74,3 +100,15 @@ void IFC4X3::IfcMappedItem::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcMappedItem::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRepresentationItem::getEntityReferences( refs );
+	if( m_MappingSource )
+	{
+		refs.push_back( m_MappingSource.get() );
+	}
+	if( m_MappingTarget )
+	{
+		refs.push_back( m_MappingTarget.get() );
+	}
+}
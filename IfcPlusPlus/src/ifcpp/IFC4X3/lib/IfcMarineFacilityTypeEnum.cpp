@@ -39,6 +39,10 @@ void IFC4X3::IfcMarineFacilityTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMarineFacilityTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcMarineFacilityTypeEnum> IFC4X3::IfcMarineFacilityTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMarineFacilityTypeEnum>(); }
@@ -131,3 +135,12 @@ shared_ptr<IFC4X3::IfcMarineFacilityTypeEnum> IFC4X3::IfcMarineFacilityTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMarineFacilityTypeEnum> IFC4X3::IfcMarineFacilityTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcMarineFacilityTypeEnum>(); }
+		return shared_ptr<IfcMarineFacilityTypeEnum>( new IfcMarineFacilityTypeEnum( IfcMarineFacilityTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
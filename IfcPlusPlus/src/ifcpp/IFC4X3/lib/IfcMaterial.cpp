@@ -34,6 +34,14 @@ void IFC4X3::IfcMaterial::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 2 ){m_Category = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterial, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterial::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Category = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterial, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterial::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -72,6 +80,20 @@ void IFC4X3::IfcMaterial::getAttributesInverse( std::vector<std::pair<std::strin
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "RelatesTo_inverse", RelatesTo_inverse_vec_obj ) );
 }
+void IFC4X3::IfcMaterial::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "Category", m_Category );
+}
+void IFC4X3::IfcMaterial::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 3, "HasRepresentation_inverse", AttributeInverseVectorView<IfcMaterialDefinitionRepresentation>( m_HasRepresentation_inverse ) );
+	visitor.visitList( 4, "IsRelatedWith_inverse", AttributeInverseVectorView<IfcMaterialRelationship>( m_IsRelatedWith_inverse ) );
+	visitor.visitList( 5, "RelatesTo_inverse", AttributeInverseVectorView<IfcMaterialRelationship>( m_RelatesTo_inverse ) );
+}
 void IFC4X3::IfcMaterial::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
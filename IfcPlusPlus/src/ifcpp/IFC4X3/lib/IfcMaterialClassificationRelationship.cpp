@@ -43,6 +43,13 @@ void IFC4X3::IfcMaterialClassificationRelationship::readStepArguments( const std
 	if( num_args > 1 ){readEntityReference( args[1], m_ClassifiedMaterial, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMaterialClassificationRelationship, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialClassificationRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_MaterialClassifications, "IFCCLASSIFICATIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_ClassifiedMaterial, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMaterialClassificationRelationship, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialClassificationRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> MaterialClassifications_vec_object( new AttributeObjectVector() );
@@ -53,9 +60,32 @@ void IFC4X3::IfcMaterialClassificationRelationship::getAttributes( std::vector<s
 void IFC4X3::IfcMaterialClassificationRelationship::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcMaterialClassificationRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "MaterialClassifications", AttributeVectorView<IfcClassificationSelect>( m_MaterialClassifications ) );
+	visitor.visitObject( 1, "ClassifiedMaterial", m_ClassifiedMaterial );
+}
+void IFC4X3::IfcMaterialClassificationRelationship::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcMaterialClassificationRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcMaterialClassificationRelationship::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcMaterialClassificationRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_MaterialClassifications.size(); ++i )
+	{
+		BuildingEntity* MaterialClassifications_entity = dynamic_cast<BuildingEntity*>( m_MaterialClassifications[i].get() );
+		if( MaterialClassifications_entity )
+		{
+			refs.push_back( MaterialClassifications_entity );
+		}
+	}
+	if( m_ClassifiedMaterial )
+	{
+		refs.push_back( m_ClassifiedMaterial.get() );
+	}
+}
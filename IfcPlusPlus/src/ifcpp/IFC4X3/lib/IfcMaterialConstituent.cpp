@@ -41,6 +41,16 @@ void IFC4X3::IfcMaterialConstituent::readStepArguments( const std::vector<std::s
 	if( num_args > 4 ){m_Category = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialConstituent, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialConstituent::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Material, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Fraction = IfcNormalisedRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Category = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialConstituent, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialConstituent::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -55,6 +65,20 @@ void IFC4X3::IfcMaterialConstituent::getAttributesInverse( std::vector<std::pair
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 	vec_attributes_inverse.emplace_back( std::make_pair( "ToMaterialConstituentSet_inverse", shared_ptr<BuildingEntity>( m_ToMaterialConstituentSet_inverse ) ) );
 }
+void IFC4X3::IfcMaterialConstituent::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "Material", m_Material );
+	visitor.visitObject( 3, "Fraction", m_Fraction );
+	visitor.visitObject( 4, "Category", m_Category );
+}
+void IFC4X3::IfcMaterialConstituent::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+	visitor.visitObject( 3, "ToMaterialConstituentSet_inverse", m_ToMaterialConstituentSet_inverse.lock() );
+}
 void IFC4X3::IfcMaterialConstituent::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -63,3 +87,11 @@ void IFC4X3::IfcMaterialConstituent::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialConstituent::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	if( m_Material )
+	{
+		refs.push_back( m_Material.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcMaterialConstituent.h"
@@ -33,6 +34,14 @@ void IFC4X3::IfcMaterialConstituentSet::readStepArguments( const std::vector<std
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_MaterialConstituents, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialConstituentSet, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialConstituentSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_MaterialConstituents, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialConstituentSet, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialConstituentSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -46,6 +55,17 @@ void IFC4X3::IfcMaterialConstituentSet::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialConstituentSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitList( 2, "MaterialConstituents", AttributeVectorView<IfcMaterialConstituent>( m_MaterialConstituents ) );
+}
+void IFC4X3::IfcMaterialConstituentSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialConstituentSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -59,6 +79,17 @@ void IFC4X3::IfcMaterialConstituentSet::setInverseCounterparts( shared_ptr<Build
 		}
 	}
 }
+void IFC4X3::IfcMaterialConstituentSet::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcMaterialDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_MaterialConstituents.size(); ++i )
+	{
+		if( m_MaterialConstituents[i] )
+		{
+			refs.emplace_back( m_MaterialConstituents[i].get(), INVERSE_ToMaterialConstituentSet );
+		}
+	}
+}
 void IFC4X3::IfcMaterialConstituentSet::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
@@ -78,3 +109,14 @@ void IFC4X3::IfcMaterialConstituentSet::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcMaterialConstituentSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_MaterialConstituents.size(); ++i )
+	{
+		if( m_MaterialConstituents[i] )
+		{
+			refs.push_back( m_MaterialConstituents[i].get() );
+		}
+	}
+}
@@ -20,6 +20,9 @@ void IFC4X3::IfcMaterialDefinition::getStepParameter( std::stringstream& stream,
 void IFC4X3::IfcMaterialDefinition::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcMaterialDefinition::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcMaterialDefinition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
@@ -53,6 +56,15 @@ void IFC4X3::IfcMaterialDefinition::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasProperties_inverse", HasProperties_inverse_vec_obj ) );
 }
+void IFC4X3::IfcMaterialDefinition::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcMaterialDefinition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "AssociatedTo_inverse", AttributeInverseVectorView<IfcRelAssociatesMaterial>( m_AssociatedTo_inverse ) );
+	visitor.visitList( 1, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+	visitor.visitList( 2, "HasProperties_inverse", AttributeInverseVectorView<IfcMaterialProperties>( m_HasProperties_inverse ) );
+}
 void IFC4X3::IfcMaterialDefinition::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcMaterial.h"
 #include "ifcpp/IFC4X3/include/IfcMaterialDefinitionRepresentation.h"
@@ -34,6 +35,15 @@ void IFC4X3::IfcMaterialDefinitionRepresentation::readStepArguments( const std::
 	if( num_args > 3 ){readEntityReference( args[3], m_RepresentedMaterial, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcMaterialDefinitionRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialDefinitionRepresentation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Representations, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_RepresentedMaterial, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcMaterialDefinitionRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialDefinitionRepresentation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProductRepresentation::getAttributes( vec_attributes );
@@ -43,6 +53,15 @@ void IFC4X3::IfcMaterialDefinitionRepresentation::getAttributesInverse( std::vec
 {
 	IFC4X3::IfcProductRepresentation::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialDefinitionRepresentation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProductRepresentation::visitAttributes( visitor );
+	visitor.visitObject( 3, "RepresentedMaterial", m_RepresentedMaterial );
+}
+void IFC4X3::IfcMaterialDefinitionRepresentation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProductRepresentation::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialDefinitionRepresentation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProductRepresentation::setInverseCounterparts( ptr_self_entity );
@@ -53,6 +72,14 @@ void IFC4X3::IfcMaterialDefinitionRepresentation::setInverseCounterparts( shared
 		m_RepresentedMaterial->m_HasRepresentation_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcMaterialDefinitionRepresentation::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcProductRepresentation::getInverseReferences( refs );
+	if( m_RepresentedMaterial )
+	{
+		refs.emplace_back( m_RepresentedMaterial.get(), INVERSE_HasRepresentation );
+	}
+}
 void IFC4X3::IfcMaterialDefinitionRepresentation::unlinkFromInverseCounterparts()
 {
 	IfcProductRepresentation::unlinkFromInverseCounterparts();
@@ -79,3 +106,11 @@ void IFC4X3::IfcMaterialDefinitionRepresentation::unlinkFromInverseCounterparts(
 		}
 	}
 }
+void IFC4X3::IfcMaterialDefinitionRepresentation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProductRepresentation::getEntityReferences( refs );
+	if( m_RepresentedMaterial )
+	{
+		refs.push_back( m_RepresentedMaterial.get() );
+	}
+}
@@ -49,6 +49,18 @@ void IFC4X3::IfcMaterialLayer::readStepArguments( const std::vector<std::string>
 	if( num_args > 6 ){m_Priority = IfcInteger::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayer, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialLayer::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Material, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LayerThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_IsVentilated = IfcLogical::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Name = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Description = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Category = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Priority = IfcInteger::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayer, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialLayer::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -65,6 +77,22 @@ void IFC4X3::IfcMaterialLayer::getAttributesInverse( std::vector<std::pair<std::
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 	vec_attributes_inverse.emplace_back( std::make_pair( "ToMaterialLayerSet_inverse", shared_ptr<BuildingEntity>( m_ToMaterialLayerSet_inverse ) ) );
 }
+void IFC4X3::IfcMaterialLayer::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Material", m_Material );
+	visitor.visitObject( 1, "LayerThickness", m_LayerThickness );
+	visitor.visitObject( 2, "IsVentilated", m_IsVentilated );
+	visitor.visitObject( 3, "Name", m_Name );
+	visitor.visitObject( 4, "Description", m_Description );
+	visitor.visitObject( 5, "Category", m_Category );
+	visitor.visitObject( 6, "Priority", m_Priority );
+}
+void IFC4X3::IfcMaterialLayer::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+	visitor.visitObject( 3, "ToMaterialLayerSet_inverse", m_ToMaterialLayerSet_inverse.lock() );
+}
 void IFC4X3::IfcMaterialLayer::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -73,3 +101,11 @@ void IFC4X3::IfcMaterialLayer::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialLayer::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	if( m_Material )
+	{
+		refs.push_back( m_Material.get() );
+	}
+}
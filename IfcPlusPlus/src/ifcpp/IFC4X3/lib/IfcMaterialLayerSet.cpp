@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcMaterialLayer.h"
@@ -33,6 +34,14 @@ void IFC4X3::IfcMaterialLayerSet::readStepArguments( const std::vector<std::stri
 	if( num_args > 2 ){m_Description = IfcText::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerSet, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialLayerSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_MaterialLayers, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LayerSetName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerSet, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialLayerSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -46,6 +55,17 @@ void IFC4X3::IfcMaterialLayerSet::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialLayerSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitList( 0, "MaterialLayers", AttributeVectorView<IfcMaterialLayer>( m_MaterialLayers ) );
+	visitor.visitObject( 1, "LayerSetName", m_LayerSetName );
+	visitor.visitObject( 2, "Description", m_Description );
+}
+void IFC4X3::IfcMaterialLayerSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialLayerSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -59,6 +79,17 @@ void IFC4X3::IfcMaterialLayerSet::setInverseCounterparts( shared_ptr<BuildingEnt
 		}
 	}
 }
+void IFC4X3::IfcMaterialLayerSet::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcMaterialDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_MaterialLayers.size(); ++i )
+	{
+		if( m_MaterialLayers[i] )
+		{
+			refs.emplace_back( m_MaterialLayers[i].get(), INVERSE_ToMaterialLayerSet );
+		}
+	}
+}
 void IFC4X3::IfcMaterialLayerSet::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
@@ -78,3 +109,14 @@ void IFC4X3::IfcMaterialLayerSet::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcMaterialLayerSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_MaterialLayers.size(); ++i )
+	{
+		if( m_MaterialLayers[i] )
+		{
+			refs.push_back( m_MaterialLayers[i].get() );
+		}
+	}
+}
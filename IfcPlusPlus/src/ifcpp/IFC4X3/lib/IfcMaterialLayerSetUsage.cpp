@@ -39,6 +39,16 @@ void IFC4X3::IfcMaterialLayerSetUsage::readStepArguments( const std::vector<std:
 	if( num_args > 4 ){m_ReferenceExtent = IfcPositiveLengthMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerSetUsage, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialLayerSetUsage::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ForLayerSet, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LayerSetDirection = IfcLayerSetDirectionEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_DirectionSense = IfcDirectionSenseEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_OffsetFromReferenceLine = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ReferenceExtent = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerSetUsage, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialLayerSetUsage::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialUsageDefinition::getAttributes( vec_attributes );
@@ -52,6 +62,19 @@ void IFC4X3::IfcMaterialLayerSetUsage::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcMaterialUsageDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialLayerSetUsage::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialUsageDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "ForLayerSet", m_ForLayerSet );
+	visitor.visitObject( 1, "LayerSetDirection", m_LayerSetDirection );
+	visitor.visitObject( 2, "DirectionSense", m_DirectionSense );
+	visitor.visitObject( 3, "OffsetFromReferenceLine", m_OffsetFromReferenceLine );
+	visitor.visitObject( 4, "ReferenceExtent", m_ReferenceExtent );
+}
+void IFC4X3::IfcMaterialLayerSetUsage::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialUsageDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialLayerSetUsage::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialUsageDefinition::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +83,11 @@ void IFC4X3::IfcMaterialLayerSetUsage::unlinkFromInverseCounterparts()
 {
 	IfcMaterialUsageDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialLayerSetUsage::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialUsageDefinition::getEntityReferences( refs );
+	if( m_ForLayerSet )
+	{
+		refs.push_back( m_ForLayerSet.get() );
+	}
+}
@@ -57,6 +57,20 @@ void IFC4X3::IfcMaterialLayerWithOffsets::readStepArguments( const std::vector<s
 	if( num_args > 8 ){readTypeOfRealList( args[8], m_OffsetValues );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerWithOffsets, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialLayerWithOffsets::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Material, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LayerThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_IsVentilated = IfcLogical::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Name = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Description = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Category = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Priority = IfcInteger::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_OffsetDirection = IfcLayerSetDirectionEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readTypeOfRealList( args[8], m_OffsetValues );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcMaterialLayerWithOffsets, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialLayerWithOffsets::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialLayer::getAttributes( vec_attributes );
@@ -69,6 +83,16 @@ void IFC4X3::IfcMaterialLayerWithOffsets::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcMaterialLayer::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialLayerWithOffsets::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialLayer::visitAttributes( visitor );
+	visitor.visitObject( 7, "OffsetDirection", m_OffsetDirection );
+	visitor.visitList( 8, "OffsetValues", AttributeVectorView<IfcLengthMeasure>( m_OffsetValues ) );
+}
+void IFC4X3::IfcMaterialLayerWithOffsets::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialLayer::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialLayerWithOffsets::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialLayer::setInverseCounterparts( ptr_self_entity );
@@ -22,6 +22,12 @@ void IFC4X3::IfcMaterialList::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_Materials, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcMaterialList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialList::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Materials, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcMaterialList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialList::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> Materials_vec_object( new AttributeObjectVector() );
@@ -31,9 +37,26 @@ void IFC4X3::IfcMaterialList::getAttributes( std::vector<std::pair<std::string,
 void IFC4X3::IfcMaterialList::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcMaterialList::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "Materials", AttributeVectorView<IfcMaterial>( m_Materials ) );
+}
+void IFC4X3::IfcMaterialList::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcMaterialList::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcMaterialList::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcMaterialList::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Materials.size(); ++i )
+	{
+		if( m_Materials[i] )
+		{
+			refs.push_back( m_Materials[i].get() );
+		}
+	}
+}
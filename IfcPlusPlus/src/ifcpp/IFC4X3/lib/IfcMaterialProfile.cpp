@@ -45,6 +45,17 @@ void IFC4X3::IfcMaterialProfile::readStepArguments( const std::vector<std::strin
 	if( num_args > 5 ){m_Category = IfcLabel::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfile, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialProfile::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Material, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_Profile, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Priority = IfcInteger::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Category = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfile, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialProfile::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -60,6 +71,21 @@ void IFC4X3::IfcMaterialProfile::getAttributesInverse( std::vector<std::pair<std
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 	vec_attributes_inverse.emplace_back( std::make_pair( "ToMaterialProfileSet_inverse", shared_ptr<BuildingEntity>( m_ToMaterialProfileSet_inverse ) ) );
 }
+void IFC4X3::IfcMaterialProfile::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitObject( 2, "Material", m_Material );
+	visitor.visitObject( 3, "Profile", m_Profile );
+	visitor.visitObject( 4, "Priority", m_Priority );
+	visitor.visitObject( 5, "Category", m_Category );
+}
+void IFC4X3::IfcMaterialProfile::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+	visitor.visitObject( 3, "ToMaterialProfileSet_inverse", m_ToMaterialProfileSet_inverse.lock() );
+}
 void IFC4X3::IfcMaterialProfile::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -68,3 +94,15 @@ void IFC4X3::IfcMaterialProfile::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialProfile::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	if( m_Material )
+	{
+		refs.push_back( m_Material.get() );
+	}
+	if( m_Profile )
+	{
+		refs.push_back( m_Profile.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCompositeProfileDef.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -37,6 +38,15 @@ void IFC4X3::IfcMaterialProfileSet::readStepArguments( const std::vector<std::st
 	if( num_args > 3 ){readEntityReference( args[3], m_CompositeProfile, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialProfileSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_MaterialProfiles, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_CompositeProfile, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialProfileSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialDefinition::getAttributes( vec_attributes );
@@ -51,6 +61,18 @@ void IFC4X3::IfcMaterialProfileSet::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcMaterialDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialProfileSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitList( 2, "MaterialProfiles", AttributeVectorView<IfcMaterialProfile>( m_MaterialProfiles ) );
+	visitor.visitObject( 3, "CompositeProfile", m_CompositeProfile );
+}
+void IFC4X3::IfcMaterialProfileSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialProfileSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialDefinition::setInverseCounterparts( ptr_self_entity );
@@ -64,6 +86,17 @@ void IFC4X3::IfcMaterialProfileSet::setInverseCounterparts( shared_ptr<BuildingE
 		}
 	}
 }
+void IFC4X3::IfcMaterialProfileSet::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcMaterialDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_MaterialProfiles.size(); ++i )
+	{
+		if( m_MaterialProfiles[i] )
+		{
+			refs.emplace_back( m_MaterialProfiles[i].get(), INVERSE_ToMaterialProfileSet );
+		}
+	}
+}
 void IFC4X3::IfcMaterialProfileSet::unlinkFromInverseCounterparts()
 {
 	IfcMaterialDefinition::unlinkFromInverseCounterparts();
@@ -83,3 +116,18 @@ void IFC4X3::IfcMaterialProfileSet::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcMaterialProfileSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_MaterialProfiles.size(); ++i )
+	{
+		if( m_MaterialProfiles[i] )
+		{
+			refs.push_back( m_MaterialProfiles[i].get() );
+		}
+	}
+	if( m_CompositeProfile )
+	{
+		refs.push_back( m_CompositeProfile.get() );
+	}
+}
@@ -31,6 +31,14 @@ void IFC4X3::IfcMaterialProfileSetUsage::readStepArguments( const std::vector<st
 	if( num_args > 2 ){m_ReferenceExtent = IfcPositiveLengthMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSetUsage, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialProfileSetUsage::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ForProfileSet, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CardinalPoint = IfcCardinalPointReference::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ReferenceExtent = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSetUsage, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialProfileSetUsage::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialUsageDefinition::getAttributes( vec_attributes );
@@ -42,6 +50,17 @@ void IFC4X3::IfcMaterialProfileSetUsage::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcMaterialUsageDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialProfileSetUsage::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialUsageDefinition::visitAttributes( visitor );
+	visitor.visitObject( 0, "ForProfileSet", m_ForProfileSet );
+	visitor.visitObject( 1, "CardinalPoint", m_CardinalPoint );
+	visitor.visitObject( 2, "ReferenceExtent", m_ReferenceExtent );
+}
+void IFC4X3::IfcMaterialProfileSetUsage::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialUsageDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialProfileSetUsage::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialUsageDefinition::setInverseCounterparts( ptr_self_entity );
@@ -50,3 +69,11 @@ void IFC4X3::IfcMaterialProfileSetUsage::unlinkFromInverseCounterparts()
 {
 	IfcMaterialUsageDefinition::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialProfileSetUsage::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialUsageDefinition::getEntityReferences( refs );
+	if( m_ForProfileSet )
+	{
+		refs.push_back( m_ForProfileSet.get() );
+	}
+}
@@ -37,6 +37,16 @@ void IFC4X3::IfcMaterialProfileSetUsageTapering::readStepArguments( const std::v
 	if( num_args > 4 ){m_CardinalEndPoint = IfcCardinalPointReference::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSetUsageTapering, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialProfileSetUsageTapering::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ForProfileSet, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_CardinalPoint = IfcCardinalPointReference::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ReferenceExtent = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_ForProfileEndSet, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_CardinalEndPoint = IfcCardinalPointReference::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileSetUsageTapering, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialProfileSetUsageTapering::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialProfileSetUsage::getAttributes( vec_attributes );
@@ -47,6 +57,16 @@ void IFC4X3::IfcMaterialProfileSetUsageTapering::getAttributesInverse( std::vect
 {
 	IFC4X3::IfcMaterialProfileSetUsage::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialProfileSetUsageTapering::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialProfileSetUsage::visitAttributes( visitor );
+	visitor.visitObject( 3, "ForProfileEndSet", m_ForProfileEndSet );
+	visitor.visitObject( 4, "CardinalEndPoint", m_CardinalEndPoint );
+}
+void IFC4X3::IfcMaterialProfileSetUsageTapering::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialProfileSetUsage::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialProfileSetUsageTapering::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialProfileSetUsage::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +75,11 @@ void IFC4X3::IfcMaterialProfileSetUsageTapering::unlinkFromInverseCounterparts()
 {
 	IfcMaterialProfileSetUsage::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMaterialProfileSetUsageTapering::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcMaterialProfileSetUsage::getEntityReferences( refs );
+	if( m_ForProfileEndSet )
+	{
+		refs.push_back( m_ForProfileEndSet.get() );
+	}
+}
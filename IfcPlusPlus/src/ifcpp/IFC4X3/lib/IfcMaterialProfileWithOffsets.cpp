@@ -49,6 +49,18 @@ void IFC4X3::IfcMaterialProfileWithOffsets::readStepArguments( const std::vector
 	if( num_args > 6 ){readTypeOfRealList( args[6], m_OffsetValues );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileWithOffsets, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialProfileWithOffsets::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Material, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_Profile, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Priority = IfcInteger::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Category = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readTypeOfRealList( args[6], m_OffsetValues );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcMaterialProfileWithOffsets, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialProfileWithOffsets::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcMaterialProfile::getAttributes( vec_attributes );
@@ -60,6 +72,15 @@ void IFC4X3::IfcMaterialProfileWithOffsets::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcMaterialProfile::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialProfileWithOffsets::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialProfile::visitAttributes( visitor );
+	visitor.visitList( 6, "OffsetValues", AttributeVectorView<IfcLengthMeasure>( m_OffsetValues ) );
+}
+void IFC4X3::IfcMaterialProfileWithOffsets::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcMaterialProfile::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialProfileWithOffsets::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcMaterialProfile::setInverseCounterparts( ptr_self_entity );
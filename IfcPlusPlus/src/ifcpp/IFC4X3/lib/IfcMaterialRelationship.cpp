@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcMaterial.h"
 #include "ifcpp/IFC4X3/include/IfcMaterialRelationship.h"
@@ -36,6 +37,16 @@ void IFC4X3::IfcMaterialRelationship::readStepArguments( const std::vector<std::
 	if( num_args > 4 ){m_MaterialExpression = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMaterialRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingMaterial, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedMaterials, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MaterialExpression = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMaterialRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMaterialRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -49,6 +60,17 @@ void IFC4X3::IfcMaterialRelationship::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMaterialRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingMaterial", m_RelatingMaterial );
+	visitor.visitList( 3, "RelatedMaterials", AttributeVectorView<IfcMaterial>( m_RelatedMaterials ) );
+	visitor.visitObject( 4, "MaterialExpression", m_MaterialExpression );
+}
+void IFC4X3::IfcMaterialRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMaterialRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,21 @@ void IFC4X3::IfcMaterialRelationship::setInverseCounterparts( shared_ptr<Buildin
 		m_RelatingMaterial->m_RelatesTo_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcMaterialRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedMaterials.size(); ++i )
+	{
+		if( m_RelatedMaterials[i] )
+		{
+			refs.emplace_back( m_RelatedMaterials[i].get(), INVERSE_IsRelatedWith );
+		}
+	}
+	if( m_RelatingMaterial )
+	{
+		refs.emplace_back( m_RelatingMaterial.get(), INVERSE_RelatesTo );
+	}
+}
 void IFC4X3::IfcMaterialRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -117,3 +154,18 @@ void IFC4X3::IfcMaterialRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcMaterialRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingMaterial )
+	{
+		refs.push_back( m_RelatingMaterial.get() );
+	}
+	for( size_t i=0; i<m_RelatedMaterials.size(); ++i )
+	{
+		if( m_RelatedMaterials[i] )
+		{
+			refs.push_back( m_RelatedMaterials[i].get() );
+		}
+	}
+}
@@ -18,6 +18,9 @@ void IFC4X3::IfcMaterialUsageDefinition::getStepParameter( std::stringstream& st
 void IFC4X3::IfcMaterialUsageDefinition::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcMaterialUsageDefinition::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcMaterialUsageDefinition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
@@ -33,6 +36,13 @@ void IFC4X3::IfcMaterialUsageDefinition::getAttributesInverse( std::vector<std::
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "AssociatedTo_inverse", AssociatedTo_inverse_vec_obj ) );
 }
+void IFC4X3::IfcMaterialUsageDefinition::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcMaterialUsageDefinition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "AssociatedTo_inverse", AttributeInverseVectorView<IfcRelAssociatesMaterial>( m_AssociatedTo_inverse ) );
+}
 void IFC4X3::IfcMaterialUsageDefinition::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
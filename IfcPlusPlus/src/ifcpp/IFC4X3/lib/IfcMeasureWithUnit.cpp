@@ -26,6 +26,13 @@ void IFC4X3::IfcMeasureWithUnit::readStepArguments( const std::vector<std::strin
 	if( num_args > 1 ){m_UnitComponent = IfcUnit::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMeasureWithUnit, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMeasureWithUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ValueComponent = IfcValue::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitComponent = IfcUnit::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcMeasureWithUnit, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMeasureWithUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ValueComponent", m_ValueComponent ) );
@@ -34,9 +41,25 @@ void IFC4X3::IfcMeasureWithUnit::getAttributes( std::vector<std::pair<std::strin
 void IFC4X3::IfcMeasureWithUnit::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcMeasureWithUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ValueComponent", m_ValueComponent );
+	visitor.visitObject( 1, "UnitComponent", m_UnitComponent );
+}
+void IFC4X3::IfcMeasureWithUnit::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcMeasureWithUnit::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcMeasureWithUnit::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcMeasureWithUnit::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* UnitComponent_entity = dynamic_cast<BuildingEntity*>( m_UnitComponent.get() );
+	if( UnitComponent_entity )
+	{
+		refs.push_back( UnitComponent_entity );
+	}
+}
@@ -35,6 +35,10 @@ void IFC4X3::IfcMechanicalFastenerTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMechanicalFastenerTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcMechanicalFastenerTypeEnum> IFC4X3::IfcMechanicalFastenerTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMechanicalFastenerTypeEnum>(); }
@@ -111,3 +115,12 @@ shared_ptr<IFC4X3::IfcMechanicalFastenerTypeEnum> IFC4X3::IfcMechanicalFastenerT
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMechanicalFastenerTypeEnum> IFC4X3::IfcMechanicalFastenerTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcMechanicalFastenerTypeEnum>(); }
+		return shared_ptr<IfcMechanicalFastenerTypeEnum>( new IfcMechanicalFastenerTypeEnum( IfcMechanicalFastenerTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
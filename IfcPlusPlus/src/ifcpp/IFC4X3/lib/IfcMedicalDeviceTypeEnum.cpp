@@ -25,6 +25,10 @@ void IFC4X3::IfcMedicalDeviceTypeEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMedicalDeviceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcMedicalDeviceTypeEnum> IFC4X3::IfcMedicalDeviceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMedicalDeviceTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcMedicalDeviceTypeEnum> IFC4X3::IfcMedicalDeviceTypeEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMedicalDeviceTypeEnum> IFC4X3::IfcMedicalDeviceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcMedicalDeviceTypeEnum>(); }
+		return shared_ptr<IfcMedicalDeviceTypeEnum>( new IfcMedicalDeviceTypeEnum( IfcMedicalDeviceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -61,6 +61,22 @@ void IFC4X3::IfcMetric::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 10 ){readEntityReference( args[10], m_ReferencePath, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcMetric, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMetric::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ConstraintGrade = IfcConstraintEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ConstraintSource = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_CreatingActor = IfcActorSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_CreationTime = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_UserDefinedGrade = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Benchmark = IfcBenchmarkEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ValueSource = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_DataValue = IfcMetricValueSelect::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_ReferencePath, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcMetric, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMetric::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConstraint::getAttributes( vec_attributes );
@@ -73,6 +89,18 @@ void IFC4X3::IfcMetric::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcConstraint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMetric::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstraint::visitAttributes( visitor );
+	visitor.visitObject( 7, "Benchmark", m_Benchmark );
+	visitor.visitObject( 8, "ValueSource", m_ValueSource );
+	visitor.visitObject( 9, "DataValue", m_DataValue );
+	visitor.visitObject( 10, "ReferencePath", m_ReferencePath );
+}
+void IFC4X3::IfcMetric::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstraint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMetric::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConstraint::setInverseCounterparts( ptr_self_entity );
@@ -81,3 +109,16 @@ void IFC4X3::IfcMetric::unlinkFromInverseCounterparts()
 {
 	IfcConstraint::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcMetric::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConstraint::getEntityReferences( refs );
+	BuildingEntity* DataValue_entity = dynamic_cast<BuildingEntity*>( m_DataValue.get() );
+	if( DataValue_entity )
+	{
+		refs.push_back( DataValue_entity );
+	}
+	if( m_ReferencePath )
+	{
+		refs.push_back( m_ReferencePath.get() );
+	}
+}
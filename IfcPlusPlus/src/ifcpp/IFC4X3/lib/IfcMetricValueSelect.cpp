@@ -134,3 +134,10 @@ shared_ptr<IFC4X3::IfcMetricValueSelect> IFC4X3::IfcMetricValueSelect::createObj
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcMetricValueSelect> IFC4X3::IfcMetricValueSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcMetricValueSelect>(); }
+	shared_ptr<IfcMetricValueSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -39,6 +39,16 @@ void IFC4X3::IfcMirroredProfileDef::readStepArguments( const std::vector<std::st
 	if( num_args > 4 ){m_Label = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMirroredProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMirroredProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ParentProfile, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_Operator, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Label = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcMirroredProfileDef, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMirroredProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcDerivedProfileDef::getAttributes( vec_attributes );
@@ -47,6 +57,14 @@ void IFC4X3::IfcMirroredProfileDef::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcDerivedProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcMirroredProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDerivedProfileDef::visitAttributes( visitor );
+}
+void IFC4X3::IfcMirroredProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDerivedProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcMirroredProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcDerivedProfileDef::setInverseCounterparts( ptr_self_entity );
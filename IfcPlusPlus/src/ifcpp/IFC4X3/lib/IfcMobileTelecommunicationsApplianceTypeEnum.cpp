@@ -33,6 +33,10 @@ void IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum::getStepParameter( std
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum> IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMobileTelecommunicationsApplianceTypeEnum>(); }
@@ -101,3 +105,12 @@ shared_ptr<IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum> IFC4X3::IfcMobi
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum> IFC4X3::IfcMobileTelecommunicationsApplianceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcMobileTelecommunicationsApplianceTypeEnum>(); }
+		return shared_ptr<IfcMobileTelecommunicationsApplianceTypeEnum>( new IfcMobileTelecommunicationsApplianceTypeEnum( IfcMobileTelecommunicationsApplianceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -23,3 +23,10 @@ shared_ptr<IFC4X3::IfcModulusOfSubgradeReactionSelect> IFC4X3::IfcModulusOfSubgr
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcModulusOfSubgradeReactionSelect> IFC4X3::IfcModulusOfSubgradeReactionSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcModulusOfSubgradeReactionSelect>(); }
+	shared_ptr<IfcModulusOfSubgradeReactionSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
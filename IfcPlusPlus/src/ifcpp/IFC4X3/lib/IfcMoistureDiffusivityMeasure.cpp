@@ -18,6 +18,10 @@ void IFC4X3::IfcMoistureDiffusivityMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMoistureDiffusivityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcMoistureDiffusivityMeasure> IFC4X3::IfcMoistureDiffusivityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMoistureDiffusivityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcMoistureDiffusivityMeasure> IFC4X3::IfcMoistureDiffusivity
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMoistureDiffusivityMeasure> IFC4X3::IfcMoistureDiffusivityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcMoistureDiffusivityMeasure>(); }
+	shared_ptr<IfcMoistureDiffusivityMeasure> type_object( new IfcMoistureDiffusivityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcMonetaryMeasure::getStepParameter( std::stringstream& stream, bo
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMonetaryMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcMonetaryMeasure> IFC4X3::IfcMonetaryMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMonetaryMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcMonetaryMeasure> IFC4X3::IfcMonetaryMeasure::createObjectF
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMonetaryMeasure> IFC4X3::IfcMonetaryMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcMonetaryMeasure>(); }
+	shared_ptr<IfcMonetaryMeasure> type_object( new IfcMonetaryMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
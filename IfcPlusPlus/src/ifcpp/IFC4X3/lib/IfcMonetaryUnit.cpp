@@ -22,6 +22,12 @@ void IFC4X3::IfcMonetaryUnit::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){m_Currency = IfcLabel::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcMonetaryUnit, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcMonetaryUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Currency = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcMonetaryUnit, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcMonetaryUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Currency", m_Currency ) );
@@ -29,6 +35,13 @@ void IFC4X3::IfcMonetaryUnit::getAttributes( std::vector<std::pair<std::string,
 void IFC4X3::IfcMonetaryUnit::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcMonetaryUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Currency", m_Currency );
+}
+void IFC4X3::IfcMonetaryUnit::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcMonetaryUnit::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -17,6 +17,10 @@ void IFC4X3::IfcMonthInYearNumber::getStepParameter( std::stringstream& stream,
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcMonthInYearNumber::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcMonthInYearNumber> IFC4X3::IfcMonthInYearNumber::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcMonthInYearNumber>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcMonthInYearNumber> IFC4X3::IfcMonthInYearNumber::createObj
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcMonthInYearNumber> IFC4X3::IfcMonthInYearNumber::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcMonthInYearNumber>(); }
+	shared_ptr<IfcMonthInYearNumber> type_object( new IfcMonthInYearNumber() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -26,6 +26,13 @@ void IFC4X3::IfcNamedUnit::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcNamedUnit, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcNamedUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Dimensions, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcNamedUnit, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcNamedUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Dimensions", m_Dimensions ) );
@@ -34,9 +41,24 @@ void IFC4X3::IfcNamedUnit::getAttributes( std::vector<std::pair<std::string, sha
 void IFC4X3::IfcNamedUnit::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcNamedUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Dimensions", m_Dimensions );
+	visitor.visitObject( 1, "UnitType", m_UnitType );
+}
+void IFC4X3::IfcNamedUnit::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcNamedUnit::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcNamedUnit::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcNamedUnit::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_Dimensions )
+	{
+		refs.push_back( m_Dimensions.get() );
+	}
+}
@@ -26,3 +26,10 @@ shared_ptr<IFC4X3::IfcNonNegativeLengthMeasure> IFC4X3::IfcNonNegativeLengthMeas
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcNonNegativeLengthMeasure> IFC4X3::IfcNonNegativeLengthMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcNonNegativeLengthMeasure>(); }
+	shared_ptr<IfcNonNegativeLengthMeasure> type_object( new IfcNonNegativeLengthMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
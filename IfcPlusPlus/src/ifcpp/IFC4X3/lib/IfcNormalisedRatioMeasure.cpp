@@ -28,3 +28,10 @@ shared_ptr<IFC4X3::IfcNormalisedRatioMeasure> IFC4X3::IfcNormalisedRatioMeasure:
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcNormalisedRatioMeasure> IFC4X3::IfcNormalisedRatioMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcNormalisedRatioMeasure>(); }
+	shared_ptr<IfcNormalisedRatioMeasure> type_object( new IfcNormalisedRatioMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
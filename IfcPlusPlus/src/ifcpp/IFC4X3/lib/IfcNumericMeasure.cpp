@@ -18,6 +18,10 @@ void IFC4X3::IfcNumericMeasure::getStepParameter( std::stringstream& stream, boo
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcNumericMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcNumericMeasure> IFC4X3::IfcNumericMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcNumericMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcNumericMeasure> IFC4X3::IfcNumericMeasure::createObjectFro
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcNumericMeasure> IFC4X3::IfcNumericMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcNumericMeasure>(); }
+	shared_ptr<IfcNumericMeasure> type_object( new IfcNumericMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -45,6 +45,16 @@ void IFC4X3::IfcObject::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcObject, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcObject::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcObject, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcObject::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectDefinition::getAttributes( vec_attributes );
@@ -90,6 +100,19 @@ void IFC4X3::IfcObject::getAttributesInverse( std::vector<std::pair<std::string,
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "IsDefinedBy_inverse", IsDefinedBy_inverse_vec_obj ) );
 }
+void IFC4X3::IfcObject::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributes( visitor );
+	visitor.visitObject( 4, "ObjectType", m_ObjectType );
+}
+void IFC4X3::IfcObject::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 7, "IsDeclaredBy_inverse", AttributeInverseVectorView<IfcRelDefinesByObject>( m_IsDeclaredBy_inverse ) );
+	visitor.visitList( 8, "Declares_inverse", AttributeInverseVectorView<IfcRelDefinesByObject>( m_Declares_inverse ) );
+	visitor.visitList( 9, "IsTypedBy_inverse", AttributeInverseVectorView<IfcRelDefinesByType>( m_IsTypedBy_inverse ) );
+	visitor.visitList( 10, "IsDefinedBy_inverse", AttributeInverseVectorView<IfcRelDefinesByProperties>( m_IsDefinedBy_inverse ) );
+}
 void IFC4X3::IfcObject::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectDefinition::setInverseCounterparts( ptr_self_entity );
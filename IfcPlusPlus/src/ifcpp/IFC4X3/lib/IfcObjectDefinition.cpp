@@ -39,6 +39,15 @@ void IFC4X3::IfcObjectDefinition::readStepArguments( const std::vector<std::stri
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcObjectDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcObjectDefinition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcObjectDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcObjectDefinition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRoot::getAttributes( vec_attributes );
@@ -110,6 +119,21 @@ void IFC4X3::IfcObjectDefinition::getAttributesInverse( std::vector<std::pair<st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasAssociations_inverse", HasAssociations_inverse_vec_obj ) );
 }
+void IFC4X3::IfcObjectDefinition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRoot::visitAttributes( visitor );
+}
+void IFC4X3::IfcObjectDefinition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRoot::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "HasAssignments_inverse", AttributeInverseVectorView<IfcRelAssigns>( m_HasAssignments_inverse ) );
+	visitor.visitList( 1, "Nests_inverse", AttributeInverseVectorView<IfcRelNests>( m_Nests_inverse ) );
+	visitor.visitList( 2, "IsNestedBy_inverse", AttributeInverseVectorView<IfcRelNests>( m_IsNestedBy_inverse ) );
+	visitor.visitList( 3, "HasContext_inverse", AttributeInverseVectorView<IfcRelDeclares>( m_HasContext_inverse ) );
+	visitor.visitList( 4, "IsDecomposedBy_inverse", AttributeInverseVectorView<IfcRelAggregates>( m_IsDecomposedBy_inverse ) );
+	visitor.visitList( 5, "Decomposes_inverse", AttributeInverseVectorView<IfcRelAggregates>( m_Decomposes_inverse ) );
+	visitor.visitList( 6, "HasAssociations_inverse", AttributeInverseVectorView<IfcRelAssociates>( m_HasAssociations_inverse ) );
+}
 void IFC4X3::IfcObjectDefinition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRoot::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcObjectPlacement.h"
 #include "ifcpp/IFC4X3/include/IfcProduct.h"
 
@@ -22,6 +23,12 @@ void IFC4X3::IfcObjectPlacement::readStepArguments( const std::vector<std::strin
 	if( num_args > 0 ){readEntityReference( args[0], m_PlacementRelTo, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcObjectPlacement, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcObjectPlacement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_PlacementRelTo, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcObjectPlacement, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcObjectPlacement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "PlacementRelTo", m_PlacementRelTo ) );
@@ -47,6 +54,15 @@ void IFC4X3::IfcObjectPlacement::getAttributesInverse( std::vector<std::pair<std
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ReferencedByPlacements_inverse", ReferencedByPlacements_inverse_vec_obj ) );
 }
+void IFC4X3::IfcObjectPlacement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "PlacementRelTo", m_PlacementRelTo );
+}
+void IFC4X3::IfcObjectPlacement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "PlacesObject_inverse", AttributeInverseVectorView<IfcProduct>( m_PlacesObject_inverse ) );
+	visitor.visitList( 1, "ReferencedByPlacements_inverse", AttributeInverseVectorView<IfcObjectPlacement>( m_ReferencedByPlacements_inverse ) );
+}
 void IFC4X3::IfcObjectPlacement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcObjectPlacement> ptr_self = dynamic_pointer_cast<IfcObjectPlacement>( ptr_self_entity );
@@ -56,6 +72,13 @@ void IFC4X3::IfcObjectPlacement::setInverseCounterparts( shared_ptr<BuildingEnti
 		m_PlacementRelTo->m_ReferencedByPlacements_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcObjectPlacement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_PlacementRelTo )
+	{
+		refs.emplace_back( m_PlacementRelTo.get(), INVERSE_ReferencedByPlacements );
+	}
+}
 void IFC4X3::IfcObjectPlacement::unlinkFromInverseCounterparts()
 {
 	if( m_PlacementRelTo )
@@ -81,3 +104,10 @@ void IFC4X3::IfcObjectPlacement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcObjectPlacement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_PlacementRelTo )
+	{
+		refs.push_back( m_PlacementRelTo.get() );
+	}
+}
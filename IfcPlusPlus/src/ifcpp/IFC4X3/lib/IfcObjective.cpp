@@ -61,6 +61,22 @@ void IFC4X3::IfcObjective::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 10 ){m_UserDefinedQualifier = IfcLabel::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcObjective, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcObjective::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ConstraintGrade = IfcConstraintEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ConstraintSource = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_CreatingActor = IfcActorSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_CreationTime = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_UserDefinedGrade = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_BenchmarkValues, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_LogicalAggregator = IfcLogicalOperatorEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_ObjectiveQualifier = IfcObjectiveEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_UserDefinedQualifier = IfcLabel::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcObjective, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcObjective::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcConstraint::getAttributes( vec_attributes );
@@ -75,6 +91,18 @@ void IFC4X3::IfcObjective::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcConstraint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcObjective::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstraint::visitAttributes( visitor );
+	visitor.visitList( 7, "BenchmarkValues", AttributeVectorView<IfcConstraint>( m_BenchmarkValues ) );
+	visitor.visitObject( 8, "LogicalAggregator", m_LogicalAggregator );
+	visitor.visitObject( 9, "ObjectiveQualifier", m_ObjectiveQualifier );
+	visitor.visitObject( 10, "UserDefinedQualifier", m_UserDefinedQualifier );
+}
+void IFC4X3::IfcObjective::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcConstraint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcObjective::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcConstraint::setInverseCounterparts( ptr_self_entity );
@@ -83,3 +111,14 @@ void IFC4X3::IfcObjective::unlinkFromInverseCounterparts()
 {
 	IfcConstraint::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcObjective::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcConstraint::getEntityReferences( refs );
+	for( size_t i=0; i<m_BenchmarkValues.size(); ++i )
+	{
+		if( m_BenchmarkValues[i] )
+		{
+			refs.push_back( m_BenchmarkValues[i].get() );
+		}
+	}
+}
@@ -31,6 +31,10 @@ void IFC4X3::IfcObjectiveEnum::getStepParameter( std::stringstream& stream, bool
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcObjectiveEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcObjectiveEnum> IFC4X3::IfcObjectiveEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcObjectiveEnum>(); }
@@ -91,3 +95,12 @@ shared_ptr<IFC4X3::IfcObjectiveEnum> IFC4X3::IfcObjectiveEnum::createObjectFromS
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcObjectiveEnum> IFC4X3::IfcObjectiveEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcObjectiveEnum>(); }
+		return shared_ptr<IfcObjectiveEnum>( new IfcObjectiveEnum( IfcObjectiveEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
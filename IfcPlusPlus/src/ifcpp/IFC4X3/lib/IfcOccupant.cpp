@@ -54,6 +54,18 @@ void IFC4X3::IfcOccupant::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 6 ){m_PredefinedType = IfcOccupantTypeEnum::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcOccupant, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOccupant::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_TheActor = IfcActorSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PredefinedType = IfcOccupantTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcOccupant, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOccupant::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcActor::getAttributes( vec_attributes );
@@ -63,6 +75,15 @@ void IFC4X3::IfcOccupant::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcActor::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOccupant::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcActor::visitAttributes( visitor );
+	visitor.visitObject( 6, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcOccupant::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcActor::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOccupant::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcActor::setInverseCounterparts( ptr_self_entity );
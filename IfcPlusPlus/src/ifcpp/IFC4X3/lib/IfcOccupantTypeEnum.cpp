@@ -27,6 +27,10 @@ void IFC4X3::IfcOccupantTypeEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcOccupantTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcOccupantTypeEnum> IFC4X3::IfcOccupantTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcOccupantTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcOccupantTypeEnum> IFC4X3::IfcOccupantTypeEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcOccupantTypeEnum> IFC4X3::IfcOccupantTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcOccupantTypeEnum>(); }
+		return shared_ptr<IfcOccupantTypeEnum>( new IfcOccupantTypeEnum( IfcOccupantTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcOffsetCurve::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOffsetCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOffsetCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcOffsetCurve::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOffsetCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisCurve", m_BasisCurve );
+}
+void IFC4X3::IfcOffsetCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOffsetCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,11 @@ void IFC4X3::IfcOffsetCurve::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcOffsetCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	if( m_BasisCurve )
+	{
+		refs.push_back( m_BasisCurve.get() );
+	}
+}
@@ -32,6 +32,14 @@ void IFC4X3::IfcOffsetCurve2D::readStepArguments( const std::vector<std::string>
 	if( num_args > 2 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve2D, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOffsetCurve2D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Distance = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve2D, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOffsetCurve2D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcOffsetCurve::getAttributes( vec_attributes );
@@ -42,6 +50,16 @@ void IFC4X3::IfcOffsetCurve2D::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcOffsetCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOffsetCurve2D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributes( visitor );
+	visitor.visitObject( 1, "Distance", m_Distance );
+	visitor.visitObject( 2, "SelfIntersect", m_SelfIntersect );
+}
+void IFC4X3::IfcOffsetCurve2D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOffsetCurve2D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcOffsetCurve::setInverseCounterparts( ptr_self_entity );
@@ -36,6 +36,15 @@ void IFC4X3::IfcOffsetCurve3D::readStepArguments( const std::vector<std::string>
 	if( num_args > 3 ){readEntityReference( args[3], m_RefDirection, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve3D, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOffsetCurve3D::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Distance = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_RefDirection, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurve3D, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOffsetCurve3D::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcOffsetCurve::getAttributes( vec_attributes );
@@ -47,6 +56,17 @@ void IFC4X3::IfcOffsetCurve3D::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcOffsetCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOffsetCurve3D::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributes( visitor );
+	visitor.visitObject( 1, "Distance", m_Distance );
+	visitor.visitObject( 2, "SelfIntersect", m_SelfIntersect );
+	visitor.visitObject( 3, "RefDirection", m_RefDirection );
+}
+void IFC4X3::IfcOffsetCurve3D::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOffsetCurve3D::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcOffsetCurve::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +75,11 @@ void IFC4X3::IfcOffsetCurve3D::unlinkFromInverseCounterparts()
 {
 	IfcOffsetCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcOffsetCurve3D::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcOffsetCurve::getEntityReferences( refs );
+	if( m_RefDirection )
+	{
+		refs.push_back( m_RefDirection.get() );
+	}
+}
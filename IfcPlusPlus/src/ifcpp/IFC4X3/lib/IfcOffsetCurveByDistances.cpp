@@ -32,6 +32,14 @@ void IFC4X3::IfcOffsetCurveByDistances::readStepArguments( const std::vector<std
 	if( num_args > 2 ){m_Tag = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurveByDistances, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOffsetCurveByDistances::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_OffsetValues, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Tag = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcOffsetCurveByDistances, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOffsetCurveByDistances::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcOffsetCurve::getAttributes( vec_attributes );
@@ -44,6 +52,16 @@ void IFC4X3::IfcOffsetCurveByDistances::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcOffsetCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOffsetCurveByDistances::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributes( visitor );
+	visitor.visitList( 1, "OffsetValues", AttributeVectorView<IfcPointByDistanceExpression>( m_OffsetValues ) );
+	visitor.visitObject( 2, "Tag", m_Tag );
+}
+void IFC4X3::IfcOffsetCurveByDistances::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcOffsetCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOffsetCurveByDistances::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcOffsetCurve::setInverseCounterparts( ptr_self_entity );
@@ -52,3 +70,14 @@ void IFC4X3::IfcOffsetCurveByDistances::unlinkFromInverseCounterparts()
 {
 	IfcOffsetCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcOffsetCurveByDistances::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcOffsetCurve::getEntityReferences( refs );
+	for( size_t i=0; i<m_OffsetValues.size(); ++i )
+	{
+		if( m_OffsetValues[i] )
+		{
+			refs.push_back( m_OffsetValues[i].get() );
+		}
+	}
+}
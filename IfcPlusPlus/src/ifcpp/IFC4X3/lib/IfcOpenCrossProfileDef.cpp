@@ -85,6 +85,18 @@ void IFC4X3::IfcOpenCrossProfileDef::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){readEntityReference( args[6], m_OffsetPoint, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcOpenCrossProfileDef, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOpenCrossProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_HorizontalWidths = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfRealList( args[3], m_Widths );}
+	if( num_args > 4 ){readTypeOfRealList( args[4], m_Slopes );}
+	if( num_args > 5 ){readTypeOfStringList( args[5], m_Tags );}
+	if( num_args > 6 ){readEntityReference( args[6], m_OffsetPoint, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcOpenCrossProfileDef, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOpenCrossProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProfileDef::getAttributes( vec_attributes );
@@ -104,6 +116,19 @@ void IFC4X3::IfcOpenCrossProfileDef::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOpenCrossProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 2, "HorizontalWidths", m_HorizontalWidths );
+	visitor.visitList( 3, "Widths", AttributeVectorView<IfcNonNegativeLengthMeasure>( m_Widths ) );
+	visitor.visitList( 4, "Slopes", AttributeVectorView<IfcPlaneAngleMeasure>( m_Slopes ) );
+	visitor.visitList( 5, "Tags", AttributeVectorView<IfcLabel>( m_Tags ) );
+	visitor.visitObject( 6, "OffsetPoint", m_OffsetPoint );
+}
+void IFC4X3::IfcOpenCrossProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOpenCrossProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProfileDef::setInverseCounterparts( ptr_self_entity );
@@ -112,3 +137,11 @@ void IFC4X3::IfcOpenCrossProfileDef::unlinkFromInverseCounterparts()
 {
 	IfcProfileDef::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcOpenCrossProfileDef::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProfileDef::getEntityReferences( refs );
+	if( m_OffsetPoint )
+	{
+		refs.push_back( m_OffsetPoint.get() );
+	}
+}
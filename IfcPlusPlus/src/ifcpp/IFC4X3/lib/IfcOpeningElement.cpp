@@ -74,6 +74,20 @@ void IFC4X3::IfcOpeningElement::readStepArguments( const std::vector<std::string
 	if( num_args > 8 ){m_PredefinedType = IfcOpeningElementTypeEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcOpeningElement, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOpeningElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcOpeningElementTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcOpeningElement, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOpeningElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcFeatureElementSubtraction::getAttributes( vec_attributes );
@@ -92,6 +106,16 @@ void IFC4X3::IfcOpeningElement::getAttributesInverse( std::vector<std::pair<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasFillings_inverse", HasFillings_inverse_vec_obj ) );
 }
+void IFC4X3::IfcOpeningElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFeatureElementSubtraction::visitAttributes( visitor );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcOpeningElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcFeatureElementSubtraction::visitAttributesInverse( visitor );
+	visitor.visitList( 27, "HasFillings_inverse", AttributeInverseVectorView<IfcRelFillsElement>( m_HasFillings_inverse ) );
+}
 void IFC4X3::IfcOpeningElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcFeatureElementSubtraction::setInverseCounterparts( ptr_self_entity );
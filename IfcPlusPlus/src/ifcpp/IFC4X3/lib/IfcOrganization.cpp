@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcActorRole.h"
 #include "ifcpp/IFC4X3/include/IfcAddress.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
@@ -40,6 +41,16 @@ void IFC4X3::IfcOrganization::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){readEntityReferenceList( args[4], m_Addresses, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcOrganization, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOrganization::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Name = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_Roles, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_Addresses, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcOrganization, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOrganization::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Identification", m_Identification ) );
@@ -82,6 +93,20 @@ void IFC4X3::IfcOrganization::getAttributesInverse( std::vector<std::pair<std::s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Engages_inverse", Engages_inverse_vec_obj ) );
 }
+void IFC4X3::IfcOrganization::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Identification", m_Identification );
+	visitor.visitObject( 1, "Name", m_Name );
+	visitor.visitObject( 2, "Description", m_Description );
+	visitor.visitList( 3, "Roles", AttributeVectorView<IfcActorRole>( m_Roles ) );
+	visitor.visitList( 4, "Addresses", AttributeVectorView<IfcAddress>( m_Addresses ) );
+}
+void IFC4X3::IfcOrganization::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "IsRelatedBy_inverse", AttributeInverseVectorView<IfcOrganizationRelationship>( m_IsRelatedBy_inverse ) );
+	visitor.visitList( 1, "Relates_inverse", AttributeInverseVectorView<IfcOrganizationRelationship>( m_Relates_inverse ) );
+	visitor.visitList( 2, "Engages_inverse", AttributeInverseVectorView<IfcPersonAndOrganization>( m_Engages_inverse ) );
+}
 void IFC4X3::IfcOrganization::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcOrganization> ptr_self = dynamic_pointer_cast<IfcOrganization>( ptr_self_entity );
@@ -94,6 +119,16 @@ void IFC4X3::IfcOrganization::setInverseCounterparts( shared_ptr<BuildingEntity>
 		}
 	}
 }
+void IFC4X3::IfcOrganization::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	for( size_t i=0; i<m_Addresses.size(); ++i )
+	{
+		if( m_Addresses[i] )
+		{
+			refs.emplace_back( m_Addresses[i].get(), INVERSE_OfOrganization );
+		}
+	}
+}
 void IFC4X3::IfcOrganization::unlinkFromInverseCounterparts()
 {
 	for( size_t i=0; i<m_Addresses.size(); ++i )
@@ -122,3 +157,20 @@ void IFC4X3::IfcOrganization::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcOrganization::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Roles.size(); ++i )
+	{
+		if( m_Roles[i] )
+		{
+			refs.push_back( m_Roles[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_Addresses.size(); ++i )
+	{
+		if( m_Addresses[i] )
+		{
+			refs.push_back( m_Addresses[i].get() );
+		}
+	}
+}
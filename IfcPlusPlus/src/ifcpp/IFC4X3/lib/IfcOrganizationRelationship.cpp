@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcOrganization.h"
 #include "ifcpp/IFC4X3/include/IfcOrganizationRelationship.h"
@@ -33,6 +34,15 @@ void IFC4X3::IfcOrganizationRelationship::readStepArguments( const std::vector<s
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedOrganizations, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOrganizationRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOrganizationRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingOrganization, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_RelatedOrganizations, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOrganizationRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOrganizationRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -45,6 +55,16 @@ void IFC4X3::IfcOrganizationRelationship::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOrganizationRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingOrganization", m_RelatingOrganization );
+	visitor.visitList( 3, "RelatedOrganizations", AttributeVectorView<IfcOrganization>( m_RelatedOrganizations ) );
+}
+void IFC4X3::IfcOrganizationRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOrganizationRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -62,6 +82,21 @@ void IFC4X3::IfcOrganizationRelationship::setInverseCounterparts( shared_ptr<Bui
 		m_RelatingOrganization->m_Relates_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcOrganizationRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedOrganizations.size(); ++i )
+	{
+		if( m_RelatedOrganizations[i] )
+		{
+			refs.emplace_back( m_RelatedOrganizations[i].get(), INVERSE_IsRelatedBy );
+		}
+	}
+	if( m_RelatingOrganization )
+	{
+		refs.emplace_back( m_RelatingOrganization.get(), INVERSE_Relates );
+	}
+}
 void IFC4X3::IfcOrganizationRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -113,3 +148,18 @@ void IFC4X3::IfcOrganizationRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcOrganizationRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingOrganization )
+	{
+		refs.push_back( m_RelatingOrganization.get() );
+	}
+	for( size_t i=0; i<m_RelatedOrganizations.size(); ++i )
+	{
+		if( m_RelatedOrganizations[i] )
+		{
+			refs.push_back( m_RelatedOrganizations[i].get() );
+		}
+	}
+}
@@ -35,6 +35,15 @@ void IFC4X3::IfcOrientedEdge::readStepArguments( const std::vector<std::string>&
 	if( num_args > 3 ){m_Orientation = IfcBoolean::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOrientedEdge, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOrientedEdge::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_EdgeStart, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_EdgeEnd, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_EdgeElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Orientation = IfcBoolean::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcOrientedEdge, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOrientedEdge::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcEdge::getAttributes( vec_attributes );
@@ -45,6 +54,16 @@ void IFC4X3::IfcOrientedEdge::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcEdge::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOrientedEdge::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributes( visitor );
+	visitor.visitObject( 2, "EdgeElement", m_EdgeElement );
+	visitor.visitObject( 3, "Orientation", m_Orientation );
+}
+void IFC4X3::IfcOrientedEdge::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOrientedEdge::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcEdge::setInverseCounterparts( ptr_self_entity );
@@ -53,3 +72,11 @@ void IFC4X3::IfcOrientedEdge::unlinkFromInverseCounterparts()
 {
 	IfcEdge::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcOrientedEdge::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcEdge::getEntityReferences( refs );
+	if( m_EdgeElement )
+	{
+		refs.push_back( m_EdgeElement.get() );
+	}
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcOuterBoundaryCurve::readStepArguments( const std::vector<std::st
 	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcOuterBoundaryCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOuterBoundaryCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Segments, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcOuterBoundaryCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOuterBoundaryCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundaryCurve::getAttributes( vec_attributes );
@@ -36,6 +43,14 @@ void IFC4X3::IfcOuterBoundaryCurve::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcBoundaryCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcOuterBoundaryCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCurve::visitAttributes( visitor );
+}
+void IFC4X3::IfcOuterBoundaryCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundaryCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcOuterBoundaryCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundaryCurve::setInverseCounterparts( ptr_self_entity );
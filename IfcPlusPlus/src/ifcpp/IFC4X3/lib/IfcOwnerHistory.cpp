@@ -47,6 +47,19 @@ void IFC4X3::IfcOwnerHistory::readStepArguments( const std::vector<std::string>&
 	if( num_args > 7 ){m_CreationDate = IfcTimeStamp::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcOwnerHistory, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcOwnerHistory::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_OwningUser, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwningApplication, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_State = IfcStateEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ChangeAction = IfcChangeActionEnum::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_LastModifiedDate = IfcTimeStamp::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_LastModifyingUser, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_LastModifyingApplication, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_CreationDate = IfcTimeStamp::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcOwnerHistory, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcOwnerHistory::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "OwningUser", m_OwningUser ) );
@@ -61,9 +74,42 @@ void IFC4X3::IfcOwnerHistory::getAttributes( std::vector<std::pair<std::string,
 void IFC4X3::IfcOwnerHistory::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcOwnerHistory::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "OwningUser", m_OwningUser );
+	visitor.visitObject( 1, "OwningApplication", m_OwningApplication );
+	visitor.visitObject( 2, "State", m_State );
+	visitor.visitObject( 3, "ChangeAction", m_ChangeAction );
+	visitor.visitObject( 4, "LastModifiedDate", m_LastModifiedDate );
+	visitor.visitObject( 5, "LastModifyingUser", m_LastModifyingUser );
+	visitor.visitObject( 6, "LastModifyingApplication", m_LastModifyingApplication );
+	visitor.visitObject( 7, "CreationDate", m_CreationDate );
+}
+void IFC4X3::IfcOwnerHistory::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcOwnerHistory::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcOwnerHistory::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcOwnerHistory::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_OwningUser )
+	{
+		refs.push_back( m_OwningUser.get() );
+	}
+	if( m_OwningApplication )
+	{
+		refs.push_back( m_OwningApplication.get() );
+	}
+	if( m_LastModifyingUser )
+	{
+		refs.push_back( m_LastModifyingUser.get() );
+	}
+	if( m_LastModifyingApplication )
+	{
+		refs.push_back( m_LastModifyingApplication.get() );
+	}
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcPHMeasure::getStepParameter( std::stringstream& stream, bool is_
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPHMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcPHMeasure> IFC4X3::IfcPHMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPHMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcPHMeasure> IFC4X3::IfcPHMeasure::createObjectFromSTEP( con
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPHMeasure> IFC4X3::IfcPHMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPHMeasure>(); }
+	shared_ptr<IfcPHMeasure> type_object( new IfcPHMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
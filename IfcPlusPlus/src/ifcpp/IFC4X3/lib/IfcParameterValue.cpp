@@ -20,6 +20,10 @@ void IFC4X3::IfcParameterValue::getStepParameter( std::stringstream& stream, boo
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcParameterValue::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcParameterValue> IFC4X3::IfcParameterValue::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcParameterValue>(); }
@@ -29,3 +33,10 @@ shared_ptr<IFC4X3::IfcParameterValue> IFC4X3::IfcParameterValue::createObjectFro
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcParameterValue> IFC4X3::IfcParameterValue::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcParameterValue>(); }
+	shared_ptr<IfcParameterValue> type_object( new IfcParameterValue() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcPath::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_EdgeList, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPath, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPath::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_EdgeList, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPath, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPath::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributes( vec_attributes );
@@ -35,6 +41,15 @@ void IFC4X3::IfcPath::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcTopologicalRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPath::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "EdgeList", AttributeVectorView<IfcOrientedEdge>( m_EdgeList ) );
+}
+void IFC4X3::IfcPath::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTopologicalRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPath::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTopologicalRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +58,14 @@ void IFC4X3::IfcPath::unlinkFromInverseCounterparts()
 {
 	IfcTopologicalRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPath::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTopologicalRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_EdgeList.size(); ++i )
+	{
+		if( m_EdgeList[i] )
+		{
+			refs.push_back( m_EdgeList[i].get() );
+		}
+	}
+}
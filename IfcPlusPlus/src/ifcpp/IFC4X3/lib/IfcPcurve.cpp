@@ -28,6 +28,13 @@ void IFC4X3::IfcPcurve::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 1 ){readEntityReference( args[1], m_ReferenceCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPcurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPcurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_ReferenceCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPcurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPcurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcPcurve::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPcurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisSurface", m_BasisSurface );
+	visitor.visitObject( 1, "ReferenceCurve", m_ReferenceCurve );
+}
+void IFC4X3::IfcPcurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPcurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,15 @@ void IFC4X3::IfcPcurve::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPcurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	if( m_BasisSurface )
+	{
+		refs.push_back( m_BasisSurface.get() );
+	}
+	if( m_ReferenceCurve )
+	{
+		refs.push_back( m_ReferenceCurve.get() );
+	}
+}
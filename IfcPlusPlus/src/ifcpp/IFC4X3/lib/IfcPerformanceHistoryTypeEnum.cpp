@@ -20,6 +20,10 @@ void IFC4X3::IfcPerformanceHistoryTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPerformanceHistoryTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcPerformanceHistoryTypeEnum> IFC4X3::IfcPerformanceHistoryTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPerformanceHistoryTypeEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcPerformanceHistoryTypeEnum> IFC4X3::IfcPerformanceHistoryT
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPerformanceHistoryTypeEnum> IFC4X3::IfcPerformanceHistoryTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcPerformanceHistoryTypeEnum>(); }
+		return shared_ptr<IfcPerformanceHistoryTypeEnum>( new IfcPerformanceHistoryTypeEnum( IfcPerformanceHistoryTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -23,6 +23,10 @@ void IFC4X3::IfcPermeableCoveringOperationEnum::getStepParameter( std::stringstr
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPermeableCoveringOperationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcPermeableCoveringOperationEnum> IFC4X3::IfcPermeableCoveringOperationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPermeableCoveringOperationEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcPermeableCoveringOperationEnum> IFC4X3::IfcPermeableCoveri
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPermeableCoveringOperationEnum> IFC4X3::IfcPermeableCoveringOperationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcPermeableCoveringOperationEnum>(); }
+		return shared_ptr<IfcPermeableCoveringOperationEnum>( new IfcPermeableCoveringOperationEnum( IfcPermeableCoveringOperationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -58,6 +58,20 @@ void IFC4X3::IfcPermeableCoveringProperties::readStepArguments( const std::vecto
 	if( num_args > 8 ){readEntityReference( args[8], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPermeableCoveringProperties, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPermeableCoveringProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_OperationType = IfcPermeableCoveringOperationEnum::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PanelPosition = IfcWindowPanelPositionEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_FrameDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_FrameThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPermeableCoveringProperties, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPermeableCoveringProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributes( vec_attributes );
@@ -71,6 +85,19 @@ void IFC4X3::IfcPermeableCoveringProperties::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPermeableCoveringProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "OperationType", m_OperationType );
+	visitor.visitObject( 5, "PanelPosition", m_PanelPosition );
+	visitor.visitObject( 6, "FrameDepth", m_FrameDepth );
+	visitor.visitObject( 7, "FrameThickness", m_FrameThickness );
+	visitor.visitObject( 8, "ShapeAspectStyle", m_ShapeAspectStyle );
+}
+void IFC4X3::IfcPermeableCoveringProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPermeableCoveringProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedPropertySet::setInverseCounterparts( ptr_self_entity );
@@ -79,3 +106,11 @@ void IFC4X3::IfcPermeableCoveringProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedPropertySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPermeableCoveringProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedPropertySet::getEntityReferences( refs );
+	if( m_ShapeAspectStyle )
+	{
+		refs.push_back( m_ShapeAspectStyle.get() );
+	}
+}
@@ -60,6 +60,20 @@ void IFC4X3::IfcPermit::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 8 ){m_LongDescription = IfcText::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPermit, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPermit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_PredefinedType = IfcPermitTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Status = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_LongDescription = IfcText::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPermit, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPermit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcControl::getAttributes( vec_attributes );
@@ -71,6 +85,17 @@ void IFC4X3::IfcPermit::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPermit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributes( visitor );
+	visitor.visitObject( 6, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 7, "Status", m_Status );
+	visitor.visitObject( 8, "LongDescription", m_LongDescription );
+}
+void IFC4X3::IfcPermit::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPermit::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcControl::setInverseCounterparts( ptr_self_entity );
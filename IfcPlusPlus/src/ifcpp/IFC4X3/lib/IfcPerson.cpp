@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcActorRole.h"
 #include "ifcpp/IFC4X3/include/IfcAddress.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
@@ -110,6 +111,19 @@ void IFC4X3::IfcPerson::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 7 ){readEntityReferenceList( args[7], m_Addresses, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPerson, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPerson::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_FamilyName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_GivenName = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfStringList( args[3], m_MiddleNames );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_PrefixTitles );}
+	if( num_args > 5 ){readTypeOfStringList( args[5], m_SuffixTitles );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_Roles, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_Addresses, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPerson, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPerson::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Identification", m_Identification ) );
@@ -143,6 +157,21 @@ void IFC4X3::IfcPerson::getAttributesInverse( std::vector<std::pair<std::string,
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "EngagedIn_inverse", EngagedIn_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPerson::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Identification", m_Identification );
+	visitor.visitObject( 1, "FamilyName", m_FamilyName );
+	visitor.visitObject( 2, "GivenName", m_GivenName );
+	visitor.visitList( 3, "MiddleNames", AttributeVectorView<IfcLabel>( m_MiddleNames ) );
+	visitor.visitList( 4, "PrefixTitles", AttributeVectorView<IfcLabel>( m_PrefixTitles ) );
+	visitor.visitList( 5, "SuffixTitles", AttributeVectorView<IfcLabel>( m_SuffixTitles ) );
+	visitor.visitList( 6, "Roles", AttributeVectorView<IfcActorRole>( m_Roles ) );
+	visitor.visitList( 7, "Addresses", AttributeVectorView<IfcAddress>( m_Addresses ) );
+}
+void IFC4X3::IfcPerson::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "EngagedIn_inverse", AttributeInverseVectorView<IfcPersonAndOrganization>( m_EngagedIn_inverse ) );
+}
 void IFC4X3::IfcPerson::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcPerson> ptr_self = dynamic_pointer_cast<IfcPerson>( ptr_self_entity );
@@ -155,6 +184,16 @@ void IFC4X3::IfcPerson::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_s
 		}
 	}
 }
+void IFC4X3::IfcPerson::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	for( size_t i=0; i<m_Addresses.size(); ++i )
+	{
+		if( m_Addresses[i] )
+		{
+			refs.emplace_back( m_Addresses[i].get(), INVERSE_OfPerson );
+		}
+	}
+}
 void IFC4X3::IfcPerson::unlinkFromInverseCounterparts()
 {
 	for( size_t i=0; i<m_Addresses.size(); ++i )
@@ -183,3 +222,20 @@ void IFC4X3::IfcPerson::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPerson::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Roles.size(); ++i )
+	{
+		if( m_Roles[i] )
+		{
+			refs.push_back( m_Roles[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_Addresses.size(); ++i )
+	{
+		if( m_Addresses[i] )
+		{
+			refs.push_back( m_Addresses[i].get() );
+		}
+	}
+}
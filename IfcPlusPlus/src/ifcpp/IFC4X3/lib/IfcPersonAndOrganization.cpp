@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcActorRole.h"
 #include "ifcpp/IFC4X3/include/IfcOrganization.h"
 #include "ifcpp/IFC4X3/include/IfcPerson.h"
@@ -30,6 +31,14 @@ void IFC4X3::IfcPersonAndOrganization::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_Roles, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPersonAndOrganization, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPersonAndOrganization::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ThePerson, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TheOrganization, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Roles, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPersonAndOrganization, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPersonAndOrganization::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ThePerson", m_ThePerson ) );
@@ -41,6 +50,15 @@ void IFC4X3::IfcPersonAndOrganization::getAttributes( std::vector<std::pair<std:
 void IFC4X3::IfcPersonAndOrganization::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcPersonAndOrganization::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ThePerson", m_ThePerson );
+	visitor.visitObject( 1, "TheOrganization", m_TheOrganization );
+	visitor.visitList( 2, "Roles", AttributeVectorView<IfcActorRole>( m_Roles ) );
+}
+void IFC4X3::IfcPersonAndOrganization::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcPersonAndOrganization::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcPersonAndOrganization> ptr_self = dynamic_pointer_cast<IfcPersonAndOrganization>( ptr_self_entity );
@@ -54,6 +72,17 @@ void IFC4X3::IfcPersonAndOrganization::setInverseCounterparts( shared_ptr<Buildi
 		m_ThePerson->m_EngagedIn_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcPersonAndOrganization::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_TheOrganization )
+	{
+		refs.emplace_back( m_TheOrganization.get(), INVERSE_Engages );
+	}
+	if( m_ThePerson )
+	{
+		refs.emplace_back( m_ThePerson.get(), INVERSE_EngagedIn );
+	}
+}
 void IFC4X3::IfcPersonAndOrganization::unlinkFromInverseCounterparts()
 {
 	if( m_TheOrganization )
@@ -101,3 +130,21 @@ void IFC4X3::IfcPersonAndOrganization::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPersonAndOrganization::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_ThePerson )
+	{
+		refs.push_back( m_ThePerson.get() );
+	}
+	if( m_TheOrganization )
+	{
+		refs.push_back( m_TheOrganization.get() );
+	}
+	for( size_t i=0; i<m_Roles.size(); ++i )
+	{
+		if( m_Roles[i] )
+		{
+			refs.push_back( m_Roles[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcPhysicalComplexQuantity.h"
@@ -40,6 +41,17 @@ void IFC4X3::IfcPhysicalComplexQuantity::readStepArguments( const std::vector<st
 	if( num_args > 5 ){m_Usage = IfcLabel::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcPhysicalComplexQuantity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPhysicalComplexQuantity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_HasQuantities, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Discrimination = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Quality = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Usage = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcPhysicalComplexQuantity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPhysicalComplexQuantity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPhysicalQuantity::getAttributes( vec_attributes );
@@ -54,6 +66,18 @@ void IFC4X3::IfcPhysicalComplexQuantity::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcPhysicalQuantity::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPhysicalComplexQuantity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalQuantity::visitAttributes( visitor );
+	visitor.visitList( 2, "HasQuantities", AttributeVectorView<IfcPhysicalQuantity>( m_HasQuantities ) );
+	visitor.visitObject( 3, "Discrimination", m_Discrimination );
+	visitor.visitObject( 4, "Quality", m_Quality );
+	visitor.visitObject( 5, "Usage", m_Usage );
+}
+void IFC4X3::IfcPhysicalComplexQuantity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalQuantity::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPhysicalComplexQuantity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPhysicalQuantity::setInverseCounterparts( ptr_self_entity );
@@ -67,6 +91,17 @@ void IFC4X3::IfcPhysicalComplexQuantity::setInverseCounterparts( shared_ptr<Buil
 		}
 	}
 }
+void IFC4X3::IfcPhysicalComplexQuantity::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPhysicalQuantity::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasQuantities.size(); ++i )
+	{
+		if( m_HasQuantities[i] )
+		{
+			refs.emplace_back( m_HasQuantities[i].get(), INVERSE_PartOfComplex );
+		}
+	}
+}
 void IFC4X3::IfcPhysicalComplexQuantity::unlinkFromInverseCounterparts()
 {
 	IfcPhysicalQuantity::unlinkFromInverseCounterparts();
@@ -96,3 +131,14 @@ void IFC4X3::IfcPhysicalComplexQuantity::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPhysicalComplexQuantity::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPhysicalQuantity::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasQuantities.size(); ++i )
+	{
+		if( m_HasQuantities[i] )
+		{
+			refs.push_back( m_HasQuantities[i].get() );
+		}
+	}
+}
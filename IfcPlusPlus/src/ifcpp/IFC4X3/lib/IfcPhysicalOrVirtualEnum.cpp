@@ -21,6 +21,10 @@ void IFC4X3::IfcPhysicalOrVirtualEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPhysicalOrVirtualEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcPhysicalOrVirtualEnum> IFC4X3::IfcPhysicalOrVirtualEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPhysicalOrVirtualEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcPhysicalOrVirtualEnum> IFC4X3::IfcPhysicalOrVirtualEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPhysicalOrVirtualEnum> IFC4X3::IfcPhysicalOrVirtualEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcPhysicalOrVirtualEnum>(); }
+		return shared_ptr<IfcPhysicalOrVirtualEnum>( new IfcPhysicalOrVirtualEnum( IfcPhysicalOrVirtualEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcPhysicalQuantity::readStepArguments( const std::vector<std::stri
 	if( num_args > 1 ){m_Description = IfcText::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPhysicalQuantity, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPhysicalQuantity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPhysicalQuantity, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPhysicalQuantity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -54,6 +61,16 @@ void IFC4X3::IfcPhysicalQuantity::getAttributesInverse( std::vector<std::pair<st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "PartOfComplex_inverse", PartOfComplex_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPhysicalQuantity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+}
+void IFC4X3::IfcPhysicalQuantity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+	visitor.visitList( 1, "PartOfComplex_inverse", AttributeInverseVectorView<IfcPhysicalComplexQuantity>( m_PartOfComplex_inverse ) );
+}
 void IFC4X3::IfcPhysicalQuantity::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
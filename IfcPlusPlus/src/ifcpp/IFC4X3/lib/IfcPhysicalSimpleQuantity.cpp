@@ -32,6 +32,14 @@ void IFC4X3::IfcPhysicalSimpleQuantity::readStepArguments( const std::vector<std
 	if( num_args > 2 ){readEntityReference( args[2], m_Unit, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPhysicalSimpleQuantity, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPhysicalSimpleQuantity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Unit, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPhysicalSimpleQuantity, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPhysicalSimpleQuantity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPhysicalQuantity::getAttributes( vec_attributes );
@@ -41,6 +49,15 @@ void IFC4X3::IfcPhysicalSimpleQuantity::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcPhysicalQuantity::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPhysicalSimpleQuantity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalQuantity::visitAttributes( visitor );
+	visitor.visitObject( 2, "Unit", m_Unit );
+}
+void IFC4X3::IfcPhysicalSimpleQuantity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalQuantity::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPhysicalSimpleQuantity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPhysicalQuantity::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +66,11 @@ void IFC4X3::IfcPhysicalSimpleQuantity::unlinkFromInverseCounterparts()
 {
 	IfcPhysicalQuantity::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPhysicalSimpleQuantity::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPhysicalQuantity::getEntityReferences( refs );
+	if( m_Unit )
+	{
+		refs.push_back( m_Unit.get() );
+	}
+}
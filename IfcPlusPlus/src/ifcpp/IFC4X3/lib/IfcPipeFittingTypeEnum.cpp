@@ -27,6 +27,10 @@ void IFC4X3::IfcPipeFittingTypeEnum::getStepParameter( std::stringstream& stream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPipeFittingTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcPipeFittingTypeEnum> IFC4X3::IfcPipeFittingTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPipeFittingTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcPipeFittingTypeEnum> IFC4X3::IfcPipeFittingTypeEnum::creat
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPipeFittingTypeEnum> IFC4X3::IfcPipeFittingTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcPipeFittingTypeEnum>(); }
+		return shared_ptr<IfcPipeFittingTypeEnum>( new IfcPipeFittingTypeEnum( IfcPipeFittingTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
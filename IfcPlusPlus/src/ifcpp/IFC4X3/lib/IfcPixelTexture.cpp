@@ -90,6 +90,20 @@ void IFC4X3::IfcPixelTexture::readStepArguments( const std::vector<std::string>&
 	if( num_args > 8 ){readTypeOfStringList( args[8], m_Pixel );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPixelTexture, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPixelTexture::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_RepeatS = IfcBoolean::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepeatT = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Mode = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_TextureTransform, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_Parameter );}
+	if( num_args > 5 ){m_Width = IfcInteger::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Height = IfcInteger::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_ColourComponents = IfcInteger::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readTypeOfStringList( args[8], m_Pixel );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcPixelTexture, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPixelTexture::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurfaceTexture::getAttributes( vec_attributes );
@@ -104,6 +118,18 @@ void IFC4X3::IfcPixelTexture::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcSurfaceTexture::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPixelTexture::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceTexture::visitAttributes( visitor );
+	visitor.visitObject( 5, "Width", m_Width );
+	visitor.visitObject( 6, "Height", m_Height );
+	visitor.visitObject( 7, "ColourComponents", m_ColourComponents );
+	visitor.visitList( 8, "Pixel", AttributeVectorView<IfcBinary>( m_Pixel ) );
+}
+void IFC4X3::IfcPixelTexture::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceTexture::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPixelTexture::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurfaceTexture::setInverseCounterparts( ptr_self_entity );
@@ -31,6 +31,14 @@ void IFC4X3::IfcPlanarBox::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 2 ){m_Placement = IfcAxis2Placement::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPlanarBox, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPlanarBox::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SizeInX = IfcLengthMeasure::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SizeInY = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Placement = IfcAxis2Placement::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPlanarBox, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPlanarBox::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPlanarExtent::getAttributes( vec_attributes );
@@ -40,6 +48,15 @@ void IFC4X3::IfcPlanarBox::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcPlanarExtent::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPlanarBox::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlanarExtent::visitAttributes( visitor );
+	visitor.visitObject( 2, "Placement", m_Placement );
+}
+void IFC4X3::IfcPlanarBox::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPlanarExtent::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPlanarBox::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPlanarExtent::setInverseCounterparts( ptr_self_entity );
@@ -48,3 +65,12 @@ void IFC4X3::IfcPlanarBox::unlinkFromInverseCounterparts()
 {
 	IfcPlanarExtent::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPlanarBox::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPlanarExtent::getEntityReferences( refs );
+	BuildingEntity* Placement_entity = dynamic_cast<BuildingEntity*>( m_Placement.get() );
+	if( Placement_entity )
+	{
+		refs.push_back( Placement_entity );
+	}
+}
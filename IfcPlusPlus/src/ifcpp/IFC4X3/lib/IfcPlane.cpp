@@ -24,6 +24,12 @@ void IFC4X3::IfcPlane::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPlane, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPlane::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPlane, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPlane::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcElementarySurface::getAttributes( vec_attributes );
@@ -32,6 +38,14 @@ void IFC4X3::IfcPlane::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcElementarySurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPlane::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributes( visitor );
+}
+void IFC4X3::IfcPlane::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPlane::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcElementarySurface::setInverseCounterparts( ptr_self_entity );
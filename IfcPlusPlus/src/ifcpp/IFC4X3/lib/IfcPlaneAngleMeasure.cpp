@@ -19,6 +19,10 @@ void IFC4X3::IfcPlaneAngleMeasure::getStepParameter( std::stringstream& stream,
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPlaneAngleMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcPlaneAngleMeasure> IFC4X3::IfcPlaneAngleMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPlaneAngleMeasure>(); }
@@ -28,3 +32,10 @@ shared_ptr<IFC4X3::IfcPlaneAngleMeasure> IFC4X3::IfcPlaneAngleMeasure::createObj
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPlaneAngleMeasure> IFC4X3::IfcPlaneAngleMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPlaneAngleMeasure>(); }
+	shared_ptr<IfcPlaneAngleMeasure> type_object( new IfcPlaneAngleMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
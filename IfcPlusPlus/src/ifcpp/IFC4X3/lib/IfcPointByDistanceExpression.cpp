@@ -38,6 +38,16 @@ void IFC4X3::IfcPointByDistanceExpression::readStepArguments( const std::vector<
 	if( num_args > 4 ){readEntityReference( args[4], m_BasisCurve, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPointByDistanceExpression, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPointByDistanceExpression::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_DistanceAlong = IfcCurveMeasureSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_OffsetLateral = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_OffsetVertical = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_OffsetLongitudinal = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPointByDistanceExpression, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPointByDistanceExpression::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPoint::getAttributes( vec_attributes );
@@ -51,6 +61,19 @@ void IFC4X3::IfcPointByDistanceExpression::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcPoint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPointByDistanceExpression::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributes( visitor );
+	visitor.visitObject( 0, "DistanceAlong", m_DistanceAlong );
+	visitor.visitObject( 1, "OffsetLateral", m_OffsetLateral );
+	visitor.visitObject( 2, "OffsetVertical", m_OffsetVertical );
+	visitor.visitObject( 3, "OffsetLongitudinal", m_OffsetLongitudinal );
+	visitor.visitObject( 4, "BasisCurve", m_BasisCurve );
+}
+void IFC4X3::IfcPointByDistanceExpression::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPointByDistanceExpression::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPoint::setInverseCounterparts( ptr_self_entity );
@@ -59,3 +82,11 @@ void IFC4X3::IfcPointByDistanceExpression::unlinkFromInverseCounterparts()
 {
 	IfcPoint::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPointByDistanceExpression::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPoint::getEntityReferences( refs );
+	if( m_BasisCurve )
+	{
+		refs.push_back( m_BasisCurve.get() );
+	}
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcPointOnCurve::readStepArguments( const std::vector<std::string>&
 	if( num_args > 1 ){m_PointParameter = IfcParameterValue::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPointOnCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPointOnCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_PointParameter = IfcParameterValue::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPointOnCurve, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPointOnCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPoint::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcPointOnCurve::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcPoint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPointOnCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisCurve", m_BasisCurve );
+	visitor.visitObject( 1, "PointParameter", m_PointParameter );
+}
+void IFC4X3::IfcPointOnCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPointOnCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPoint::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,11 @@ void IFC4X3::IfcPointOnCurve::unlinkFromInverseCounterparts()
 {
 	IfcPoint::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPointOnCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPoint::getEntityReferences( refs );
+	if( m_BasisCurve )
+	{
+		refs.push_back( m_BasisCurve.get() );
+	}
+}
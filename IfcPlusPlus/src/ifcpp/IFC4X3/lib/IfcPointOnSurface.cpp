@@ -31,6 +31,14 @@ void IFC4X3::IfcPointOnSurface::readStepArguments( const std::vector<std::string
 	if( num_args > 2 ){m_PointParameterV = IfcParameterValue::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPointOnSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPointOnSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_PointParameterU = IfcParameterValue::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_PointParameterV = IfcParameterValue::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPointOnSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPointOnSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPoint::getAttributes( vec_attributes );
@@ -42,6 +50,17 @@ void IFC4X3::IfcPointOnSurface::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcPoint::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPointOnSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisSurface", m_BasisSurface );
+	visitor.visitObject( 1, "PointParameterU", m_PointParameterU );
+	visitor.visitObject( 2, "PointParameterV", m_PointParameterV );
+}
+void IFC4X3::IfcPointOnSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPoint::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPointOnSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPoint::setInverseCounterparts( ptr_self_entity );
@@ -50,3 +69,11 @@ void IFC4X3::IfcPointOnSurface::unlinkFromInverseCounterparts()
 {
 	IfcPoint::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPointOnSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPoint::getEntityReferences( refs );
+	if( m_BasisSurface )
+	{
+		refs.push_back( m_BasisSurface.get() );
+	}
+}
@@ -36,6 +36,15 @@ void IFC4X3::IfcPolygonalBoundedHalfSpace::readStepArguments( const std::vector<
 	if( num_args > 3 ){readEntityReference( args[3], m_PolygonalBoundary, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolygonalBoundedHalfSpace, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPolygonalBoundedHalfSpace::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BaseSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_AgreementFlag = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_PolygonalBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolygonalBoundedHalfSpace, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPolygonalBoundedHalfSpace::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcHalfSpaceSolid::getAttributes( vec_attributes );
@@ -46,6 +55,16 @@ void IFC4X3::IfcPolygonalBoundedHalfSpace::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcHalfSpaceSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPolygonalBoundedHalfSpace::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcHalfSpaceSolid::visitAttributes( visitor );
+	visitor.visitObject( 2, "Position", m_Position );
+	visitor.visitObject( 3, "PolygonalBoundary", m_PolygonalBoundary );
+}
+void IFC4X3::IfcPolygonalBoundedHalfSpace::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcHalfSpaceSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPolygonalBoundedHalfSpace::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcHalfSpaceSolid::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +73,15 @@ void IFC4X3::IfcPolygonalBoundedHalfSpace::unlinkFromInverseCounterparts()
 {
 	IfcHalfSpaceSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPolygonalBoundedHalfSpace::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcHalfSpaceSolid::getEntityReferences( refs );
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+	if( m_PolygonalBoundary )
+	{
+		refs.push_back( m_PolygonalBoundary.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcBoolean.h"
 #include "ifcpp/IFC4X3/include/IfcCartesianPointList3D.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedColourMap.h"
@@ -59,6 +60,15 @@ void IFC4X3::IfcPolygonalFaceSet::readStepArguments( const std::vector<std::stri
 	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_PnIndex );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolygonalFaceSet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPolygonalFaceSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Coordinates, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Closed = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Faces, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_PnIndex );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolygonalFaceSet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPolygonalFaceSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTessellatedFaceSet::getAttributes( vec_attributes );
@@ -74,6 +84,17 @@ void IFC4X3::IfcPolygonalFaceSet::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcTessellatedFaceSet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPolygonalFaceSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedFaceSet::visitAttributes( visitor );
+	visitor.visitObject( 1, "Closed", m_Closed );
+	visitor.visitList( 2, "Faces", AttributeVectorView<IfcIndexedPolygonalFace>( m_Faces ) );
+	visitor.visitList( 3, "PnIndex", AttributeVectorView<IfcPositiveInteger>( m_PnIndex ) );
+}
+void IFC4X3::IfcPolygonalFaceSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedFaceSet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPolygonalFaceSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTessellatedFaceSet::setInverseCounterparts( ptr_self_entity );
@@ -87,6 +108,17 @@ void IFC4X3::IfcPolygonalFaceSet::setInverseCounterparts( shared_ptr<BuildingEnt
 		}
 	}
 }
+void IFC4X3::IfcPolygonalFaceSet::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcTessellatedFaceSet::getInverseReferences( refs );
+	for( size_t i=0; i<m_Faces.size(); ++i )
+	{
+		if( m_Faces[i] )
+		{
+			refs.emplace_back( m_Faces[i].get(), INVERSE_ToFaceSet );
+		}
+	}
+}
 void IFC4X3::IfcPolygonalFaceSet::unlinkFromInverseCounterparts()
 {
 	IfcTessellatedFaceSet::unlinkFromInverseCounterparts();
@@ -116,3 +148,14 @@ void IFC4X3::IfcPolygonalFaceSet::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPolygonalFaceSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTessellatedFaceSet::getEntityReferences( refs );
+	for( size_t i=0; i<m_Faces.size(); ++i )
+	{
+		if( m_Faces[i] )
+		{
+			refs.push_back( m_Faces[i].get() );
+		}
+	}
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcPolyline::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_Points, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPolyline, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPolyline::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Points, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcPolyline, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPolyline::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedCurve::getAttributes( vec_attributes );
@@ -35,6 +41,15 @@ void IFC4X3::IfcPolyline::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcBoundedCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPolyline::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributes( visitor );
+	visitor.visitList( 0, "Points", AttributeVectorView<IfcCartesianPoint>( m_Points ) );
+}
+void IFC4X3::IfcPolyline::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPolyline::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedCurve::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +58,14 @@ void IFC4X3::IfcPolyline::unlinkFromInverseCounterparts()
 {
 	IfcBoundedCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPolyline::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedCurve::getEntityReferences( refs );
+	for( size_t i=0; i<m_Points.size(); ++i )
+	{
+		if( m_Points[i] )
+		{
+			refs.push_back( m_Points[i].get() );
+		}
+	}
+}
@@ -34,6 +34,15 @@ void IFC4X3::IfcPolynomialCurve::readStepArguments( const std::vector<std::strin
 	if( num_args > 3 ){readTypeOfRealList( args[3], m_CoefficientsZ );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolynomialCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPolynomialCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList( args[1], m_CoefficientsX );}
+	if( num_args > 2 ){readTypeOfRealList( args[2], m_CoefficientsY );}
+	if( num_args > 3 ){readTypeOfRealList( args[3], m_CoefficientsZ );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPolynomialCurve, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPolynomialCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -52,6 +61,18 @@ void IFC4X3::IfcPolynomialCurve::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPolynomialCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Position", m_Position );
+	visitor.visitList( 1, "CoefficientsX", AttributeVectorView<IfcReal>( m_CoefficientsX ) );
+	visitor.visitList( 2, "CoefficientsY", AttributeVectorView<IfcReal>( m_CoefficientsY ) );
+	visitor.visitList( 3, "CoefficientsZ", AttributeVectorView<IfcReal>( m_CoefficientsZ ) );
+}
+void IFC4X3::IfcPolynomialCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPolynomialCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +81,11 @@ void IFC4X3::IfcPolynomialCurve::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPolynomialCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+}
@@ -58,6 +58,18 @@ void IFC4X3::IfcPort::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPort, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPort::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPort, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPort::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProduct::getAttributes( vec_attributes );
@@ -93,6 +105,17 @@ void IFC4X3::IfcPort::getAttributesInverse( std::vector<std::pair<std::string, s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ConnectedTo_inverse", ConnectedTo_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPort::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributes( visitor );
+}
+void IFC4X3::IfcPort::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributesInverse( visitor );
+	visitor.visitList( 14, "ContainedIn_inverse", AttributeInverseVectorView<IfcRelConnectsPortToElement>( m_ContainedIn_inverse ) );
+	visitor.visitList( 15, "ConnectedFrom_inverse", AttributeInverseVectorView<IfcRelConnectsPorts>( m_ConnectedFrom_inverse ) );
+	visitor.visitList( 16, "ConnectedTo_inverse", AttributeInverseVectorView<IfcRelConnectsPorts>( m_ConnectedTo_inverse ) );
+}
 void IFC4X3::IfcPort::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProduct::setInverseCounterparts( ptr_self_entity );
@@ -57,6 +57,18 @@ void IFC4X3::IfcPositioningElement::readStepArguments( const std::vector<std::st
 	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPositioningElement, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPositioningElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPositioningElement, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPositioningElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProduct::getAttributes( vec_attributes );
@@ -83,6 +95,16 @@ void IFC4X3::IfcPositioningElement::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Positions_inverse", Positions_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPositioningElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributes( visitor );
+}
+void IFC4X3::IfcPositioningElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributesInverse( visitor );
+	visitor.visitList( 14, "ContainedInStructure_inverse", AttributeInverseVectorView<IfcRelContainedInSpatialStructure>( m_ContainedInStructure_inverse ) );
+	visitor.visitList( 15, "Positions_inverse", AttributeInverseVectorView<IfcRelPositions>( m_Positions_inverse ) );
+}
 void IFC4X3::IfcPositioningElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProduct::setInverseCounterparts( ptr_self_entity );
@@ -26,3 +26,10 @@ shared_ptr<IFC4X3::IfcPositiveInteger> IFC4X3::IfcPositiveInteger::createObjectF
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPositiveInteger> IFC4X3::IfcPositiveInteger::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPositiveInteger>(); }
+	shared_ptr<IfcPositiveInteger> type_object( new IfcPositiveInteger() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
@@ -28,3 +28,10 @@ shared_ptr<IFC4X3::IfcPositiveLengthMeasure> IFC4X3::IfcPositiveLengthMeasure::c
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPositiveLengthMeasure> IFC4X3::IfcPositiveLengthMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPositiveLengthMeasure>(); }
+	shared_ptr<IfcPositiveLengthMeasure> type_object( new IfcPositiveLengthMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -26,3 +26,10 @@ shared_ptr<IFC4X3::IfcPositivePlaneAngleMeasure> IFC4X3::IfcPositivePlaneAngleMe
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPositivePlaneAngleMeasure> IFC4X3::IfcPositivePlaneAngleMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPositivePlaneAngleMeasure>(); }
+	shared_ptr<IfcPositivePlaneAngleMeasure> type_object( new IfcPositivePlaneAngleMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
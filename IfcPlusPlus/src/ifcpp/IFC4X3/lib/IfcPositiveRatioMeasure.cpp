@@ -27,3 +27,10 @@ shared_ptr<IFC4X3::IfcPositiveRatioMeasure> IFC4X3::IfcPositiveRatioMeasure::cre
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPositiveRatioMeasure> IFC4X3::IfcPositiveRatioMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPositiveRatioMeasure>(); }
+	shared_ptr<IfcPositiveRatioMeasure> type_object( new IfcPositiveRatioMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
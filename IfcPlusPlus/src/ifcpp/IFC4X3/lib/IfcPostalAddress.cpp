@@ -74,6 +74,21 @@ void IFC4X3::IfcPostalAddress::readStepArguments( const std::vector<std::string>
 	if( num_args > 9 ){m_Country = IfcLabel::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcPostalAddress, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPostalAddress::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Purpose = IfcAddressTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedPurpose = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_InternalLocation = IfcLabel::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_AddressLines );}
+	if( num_args > 5 ){m_PostalBox = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Town = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Region = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PostalCode = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Country = IfcLabel::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcPostalAddress, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPostalAddress::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAddress::getAttributes( vec_attributes );
@@ -91,6 +106,21 @@ void IFC4X3::IfcPostalAddress::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcAddress::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPostalAddress::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAddress::visitAttributes( visitor );
+	visitor.visitObject( 3, "InternalLocation", m_InternalLocation );
+	visitor.visitList( 4, "AddressLines", AttributeVectorView<IfcLabel>( m_AddressLines ) );
+	visitor.visitObject( 5, "PostalBox", m_PostalBox );
+	visitor.visitObject( 6, "Town", m_Town );
+	visitor.visitObject( 7, "Region", m_Region );
+	visitor.visitObject( 8, "PostalCode", m_PostalCode );
+	visitor.visitObject( 9, "Country", m_Country );
+}
+void IFC4X3::IfcPostalAddress::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAddress::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPostalAddress::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAddress::setInverseCounterparts( ptr_self_entity );
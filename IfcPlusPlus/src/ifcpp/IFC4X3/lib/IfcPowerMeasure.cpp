@@ -18,6 +18,10 @@ void IFC4X3::IfcPowerMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPowerMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcPowerMeasure> IFC4X3::IfcPowerMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPowerMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcPowerMeasure> IFC4X3::IfcPowerMeasure::createObjectFromSTE
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPowerMeasure> IFC4X3::IfcPowerMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPowerMeasure>(); }
+	shared_ptr<IfcPowerMeasure> type_object( new IfcPowerMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,9 @@ void IFC4X3::IfcPreDefinedProperties::getStepParameter( std::stringstream& strea
 void IFC4X3::IfcPreDefinedProperties::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcPreDefinedProperties::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcPreDefinedProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributes( vec_attributes );
@@ -26,6 +29,14 @@ void IFC4X3::IfcPreDefinedProperties::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPreDefinedProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributes( visitor );
+}
+void IFC4X3::IfcPreDefinedProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPreDefinedProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyAbstraction::setInverseCounterparts( ptr_self_entity );
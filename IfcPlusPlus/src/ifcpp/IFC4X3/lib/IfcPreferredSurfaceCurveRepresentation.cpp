@@ -21,6 +21,10 @@ void IFC4X3::IfcPreferredSurfaceCurveRepresentation::getStepParameter( std::stri
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPreferredSurfaceCurveRepresentation::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcPreferredSurfaceCurveRepresentation> IFC4X3::IfcPreferredSurfaceCurveRepresentation::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPreferredSurfaceCurveRepresentation>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcPreferredSurfaceCurveRepresentation> IFC4X3::IfcPreferredS
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPreferredSurfaceCurveRepresentation> IFC4X3::IfcPreferredSurfaceCurveRepresentation::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_PCURVE_S2 ) { return shared_ptr<IfcPreferredSurfaceCurveRepresentation>(); }
+		return shared_ptr<IfcPreferredSurfaceCurveRepresentation>( new IfcPreferredSurfaceCurveRepresentation( IfcPreferredSurfaceCurveRepresentationEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
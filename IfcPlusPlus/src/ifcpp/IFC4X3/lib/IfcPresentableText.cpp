@@ -17,6 +17,10 @@ void IFC4X3::IfcPresentableText::getStepParameter( std::stringstream& stream, bo
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPresentableText::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcPresentableText> IFC4X3::IfcPresentableText::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPresentableText>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcPresentableText> IFC4X3::IfcPresentableText::createObjectF
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPresentableText> IFC4X3::IfcPresentableText::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPresentableText>(); }
+	shared_ptr<IfcPresentableText> type_object( new IfcPresentableText() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
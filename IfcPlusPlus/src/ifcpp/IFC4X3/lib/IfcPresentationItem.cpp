@@ -17,12 +17,21 @@ void IFC4X3::IfcPresentationItem::getStepParameter( std::stringstream& stream, b
 void IFC4X3::IfcPresentationItem::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcPresentationItem::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcPresentationItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
 void IFC4X3::IfcPresentationItem::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcPresentationItem::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcPresentationItem::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcPresentationItem::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
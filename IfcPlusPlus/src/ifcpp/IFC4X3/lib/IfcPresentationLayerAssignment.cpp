@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcLayeredItem.h"
@@ -53,6 +54,15 @@ void IFC4X3::IfcPresentationLayerAssignment::readStepArguments( const std::vecto
 	if( num_args > 3 ){m_Identifier = IfcIdentifier::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPresentationLayerAssignment, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPresentationLayerAssignment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_AssignedItems, "IFCLAYEREDITEM", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Identifier = IfcIdentifier::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPresentationLayerAssignment, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPresentationLayerAssignment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -65,6 +75,16 @@ void IFC4X3::IfcPresentationLayerAssignment::getAttributes( std::vector<std::pai
 void IFC4X3::IfcPresentationLayerAssignment::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcPresentationLayerAssignment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitList( 2, "AssignedItems", AttributeVectorView<IfcLayeredItem>( m_AssignedItems ) );
+	visitor.visitObject( 3, "Identifier", m_Identifier );
+}
+void IFC4X3::IfcPresentationLayerAssignment::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcPresentationLayerAssignment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcPresentationLayerAssignment> ptr_self = dynamic_pointer_cast<IfcPresentationLayerAssignment>( ptr_self_entity );
@@ -83,6 +103,22 @@ void IFC4X3::IfcPresentationLayerAssignment::setInverseCounterparts( shared_ptr<
 		}
 	}
 }
+void IFC4X3::IfcPresentationLayerAssignment::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	for( size_t i=0; i<m_AssignedItems.size(); ++i )
+	{
+		shared_ptr<IfcRepresentation>  AssignedItems_IfcRepresentation = dynamic_pointer_cast<IfcRepresentation>( m_AssignedItems[i] );
+		if( AssignedItems_IfcRepresentation )
+		{
+			refs.emplace_back( AssignedItems_IfcRepresentation.get(), INVERSE_LayerAssignments );
+		}
+		shared_ptr<IfcRepresentationItem>  AssignedItems_IfcRepresentationItem = dynamic_pointer_cast<IfcRepresentationItem>( m_AssignedItems[i] );
+		if( AssignedItems_IfcRepresentationItem )
+		{
+			refs.emplace_back( AssignedItems_IfcRepresentationItem.get(), INVERSE_LayerAssignment );
+		}
+	}
+}
 void IFC4X3::IfcPresentationLayerAssignment::unlinkFromInverseCounterparts()
 {
 	for( size_t i=0; i<m_AssignedItems.size(); ++i )
@@ -135,3 +171,14 @@ void IFC4X3::IfcPresentationLayerAssignment::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPresentationLayerAssignment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_AssignedItems.size(); ++i )
+	{
+		BuildingEntity* AssignedItems_entity = dynamic_cast<BuildingEntity*>( m_AssignedItems[i].get() );
+		if( AssignedItems_entity )
+		{
+			refs.push_back( AssignedItems_entity );
+		}
+	}
+}
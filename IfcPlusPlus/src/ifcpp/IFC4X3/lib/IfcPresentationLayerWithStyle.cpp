@@ -65,6 +65,19 @@ void IFC4X3::IfcPresentationLayerWithStyle::readStepArguments( const std::vector
 	if( num_args > 7 ){readEntityReferenceList( args[7], m_LayerStyles, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPresentationLayerWithStyle, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPresentationLayerWithStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_AssignedItems, "IFCLAYEREDITEM", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Identifier = IfcIdentifier::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_LayerOn = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LayerFrozen = IfcLogical::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LayerBlocked = IfcLogical::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_LayerStyles, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPresentationLayerWithStyle, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPresentationLayerWithStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationLayerAssignment::getAttributes( vec_attributes );
@@ -79,6 +92,18 @@ void IFC4X3::IfcPresentationLayerWithStyle::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcPresentationLayerAssignment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPresentationLayerWithStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationLayerAssignment::visitAttributes( visitor );
+	visitor.visitObject( 4, "LayerOn", m_LayerOn );
+	visitor.visitObject( 5, "LayerFrozen", m_LayerFrozen );
+	visitor.visitObject( 6, "LayerBlocked", m_LayerBlocked );
+	visitor.visitList( 7, "LayerStyles", AttributeVectorView<IfcPresentationStyle>( m_LayerStyles ) );
+}
+void IFC4X3::IfcPresentationLayerWithStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationLayerAssignment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPresentationLayerWithStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationLayerAssignment::setInverseCounterparts( ptr_self_entity );
@@ -87,3 +112,14 @@ void IFC4X3::IfcPresentationLayerWithStyle::unlinkFromInverseCounterparts()
 {
 	IfcPresentationLayerAssignment::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPresentationLayerWithStyle::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationLayerAssignment::getEntityReferences( refs );
+	for( size_t i=0; i<m_LayerStyles.size(); ++i )
+	{
+		if( m_LayerStyles[i] )
+		{
+			refs.push_back( m_LayerStyles[i].get() );
+		}
+	}
+}
@@ -26,6 +26,13 @@ void IFC4X3::IfcPresentationStyleAssignment::readStepArguments( const std::vecto
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_Styles, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPresentationStyleAssignment, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPresentationStyleAssignment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Styles, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcPresentationStyleAssignment, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPresentationStyleAssignment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationStyle::getAttributes( vec_attributes );
@@ -37,6 +44,15 @@ void IFC4X3::IfcPresentationStyleAssignment::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcPresentationStyle::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPresentationStyleAssignment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributes( visitor );
+	visitor.visitList( 1, "Styles", AttributeVectorView<IfcPresentationStyle>( m_Styles ) );
+}
+void IFC4X3::IfcPresentationStyleAssignment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPresentationStyleAssignment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationStyle::setInverseCounterparts( ptr_self_entity );
@@ -45,3 +61,14 @@ void IFC4X3::IfcPresentationStyleAssignment::unlinkFromInverseCounterparts()
 {
 	IfcPresentationStyle::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPresentationStyleAssignment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationStyle::getEntityReferences( refs );
+	for( size_t i=0; i<m_Styles.size(); ++i )
+	{
+		if( m_Styles[i] )
+		{
+			refs.push_back( m_Styles[i].get() );
+		}
+	}
+}
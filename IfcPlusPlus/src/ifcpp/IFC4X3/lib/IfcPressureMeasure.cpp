@@ -18,6 +18,10 @@ void IFC4X3::IfcPressureMeasure::getStepParameter( std::stringstream& stream, bo
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPressureMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcPressureMeasure> IFC4X3::IfcPressureMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPressureMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcPressureMeasure> IFC4X3::IfcPressureMeasure::createObjectF
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPressureMeasure> IFC4X3::IfcPressureMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPressureMeasure>(); }
+	shared_ptr<IfcPressureMeasure> type_object( new IfcPressureMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
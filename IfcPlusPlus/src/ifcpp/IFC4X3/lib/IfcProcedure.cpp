@@ -58,6 +58,19 @@ void IFC4X3::IfcProcedure::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 7 ){m_PredefinedType = IfcProcedureTypeEnum::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcProcedure, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProcedure::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcProcedureTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcProcedure, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProcedure::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProcess::getAttributes( vec_attributes );
@@ -67,6 +80,15 @@ void IFC4X3::IfcProcedure::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcProcess::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcProcedure::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributes( visitor );
+	visitor.visitObject( 7, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcProcedure::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcProcedure::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProcess::setInverseCounterparts( ptr_self_entity );
@@ -27,6 +27,10 @@ void IFC4X3::IfcProcedureTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProcedureTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProcedureTypeEnum> IFC4X3::IfcProcedureTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProcedureTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcProcedureTypeEnum> IFC4X3::IfcProcedureTypeEnum::createObj
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProcedureTypeEnum> IFC4X3::IfcProcedureTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcProcedureTypeEnum>(); }
+		return shared_ptr<IfcProcedureTypeEnum>( new IfcProcedureTypeEnum( IfcProcedureTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
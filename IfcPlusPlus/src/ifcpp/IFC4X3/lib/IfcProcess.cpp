@@ -54,6 +54,18 @@ void IFC4X3::IfcProcess::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProcess, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProcess::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProcess, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProcess::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObject::getAttributes( vec_attributes );
@@ -91,6 +103,19 @@ void IFC4X3::IfcProcess::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "OperatesOn_inverse", OperatesOn_inverse_vec_obj ) );
 }
+void IFC4X3::IfcProcess::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributes( visitor );
+	visitor.visitObject( 5, "Identification", m_Identification );
+	visitor.visitObject( 6, "LongDescription", m_LongDescription );
+}
+void IFC4X3::IfcProcess::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributesInverse( visitor );
+	visitor.visitList( 11, "IsPredecessorTo_inverse", AttributeInverseVectorView<IfcRelSequence>( m_IsPredecessorTo_inverse ) );
+	visitor.visitList( 12, "IsSuccessorFrom_inverse", AttributeInverseVectorView<IfcRelSequence>( m_IsSuccessorFrom_inverse ) );
+	visitor.visitList( 13, "OperatesOn_inverse", AttributeInverseVectorView<IfcRelAssignsToProcess>( m_OperatesOn_inverse ) );
+}
 void IFC4X3::IfcProcess::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObject::setInverseCounterparts( ptr_self_entity );
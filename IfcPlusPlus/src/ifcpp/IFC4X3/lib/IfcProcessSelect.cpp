@@ -21,3 +21,10 @@ shared_ptr<IFC4X3::IfcProcessSelect> IFC4X3::IfcProcessSelect::createObjectFromS
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcProcessSelect> IFC4X3::IfcProcessSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcProcessSelect>(); }
+	shared_ptr<IfcProcessSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
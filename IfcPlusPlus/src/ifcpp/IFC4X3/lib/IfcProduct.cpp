@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcObjectPlacement.h"
@@ -57,6 +58,18 @@ void IFC4X3::IfcProduct::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProduct, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProduct::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProduct, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProduct::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObject::getAttributes( vec_attributes );
@@ -94,6 +107,19 @@ void IFC4X3::IfcProduct::getAttributesInverse( std::vector<std::pair<std::string
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ReferencedInStructures_inverse", ReferencedInStructures_inverse_vec_obj ) );
 }
+void IFC4X3::IfcProduct::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributes( visitor );
+	visitor.visitObject( 5, "ObjectPlacement", m_ObjectPlacement );
+	visitor.visitObject( 6, "Representation", m_Representation );
+}
+void IFC4X3::IfcProduct::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObject::visitAttributesInverse( visitor );
+	visitor.visitList( 11, "ReferencedBy_inverse", AttributeInverseVectorView<IfcRelAssignsToProduct>( m_ReferencedBy_inverse ) );
+	visitor.visitList( 12, "PositionedRelativeTo_inverse", AttributeInverseVectorView<IfcRelPositions>( m_PositionedRelativeTo_inverse ) );
+	visitor.visitList( 13, "ReferencedInStructures_inverse", AttributeInverseVectorView<IfcRelReferencedInSpatialStructure>( m_ReferencedInStructures_inverse ) );
+}
 void IFC4X3::IfcProduct::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObject::setInverseCounterparts( ptr_self_entity );
@@ -109,6 +135,19 @@ void IFC4X3::IfcProduct::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_
 		Representation_IfcProductDefinitionShape->m_ShapeOfProduct_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcProduct::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcObject::getInverseReferences( refs );
+	if( m_ObjectPlacement )
+	{
+		refs.emplace_back( m_ObjectPlacement.get(), INVERSE_PlacesObject );
+	}
+	shared_ptr<IfcProductDefinitionShape>  Representation_IfcProductDefinitionShape = dynamic_pointer_cast<IfcProductDefinitionShape>( m_Representation );
+	if( Representation_IfcProductDefinitionShape )
+	{
+		refs.emplace_back( Representation_IfcProductDefinitionShape.get(), INVERSE_ShapeOfProduct );
+	}
+}
 void IFC4X3::IfcProduct::unlinkFromInverseCounterparts()
 {
 	IfcObject::unlinkFromInverseCounterparts();
@@ -158,3 +197,15 @@ void IFC4X3::IfcProduct::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcProduct::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObject::getEntityReferences( refs );
+	if( m_ObjectPlacement )
+	{
+		refs.push_back( m_ObjectPlacement.get() );
+	}
+	if( m_Representation )
+	{
+		refs.push_back( m_Representation.get() );
+	}
+}
@@ -32,6 +32,14 @@ void IFC4X3::IfcProductDefinitionShape::readStepArguments( const std::vector<std
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_Representations, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcProductDefinitionShape, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProductDefinitionShape::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Representations, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcProductDefinitionShape, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProductDefinitionShape::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProductRepresentation::getAttributes( vec_attributes );
@@ -58,6 +66,16 @@ void IFC4X3::IfcProductDefinitionShape::getAttributesInverse( std::vector<std::p
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasShapeAspects_inverse", HasShapeAspects_inverse_vec_obj ) );
 }
+void IFC4X3::IfcProductDefinitionShape::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProductRepresentation::visitAttributes( visitor );
+}
+void IFC4X3::IfcProductDefinitionShape::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProductRepresentation::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "ShapeOfProduct_inverse", AttributeInverseVectorView<IfcProduct>( m_ShapeOfProduct_inverse ) );
+	visitor.visitList( 1, "HasShapeAspects_inverse", AttributeInverseVectorView<IfcShapeAspect>( m_HasShapeAspects_inverse ) );
+}
 void IFC4X3::IfcProductDefinitionShape::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProductRepresentation::setInverseCounterparts( ptr_self_entity );
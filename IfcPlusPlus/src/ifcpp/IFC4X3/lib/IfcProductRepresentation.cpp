@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcProductRepresentation.h"
 #include "ifcpp/IFC4X3/include/IfcRepresentation.h"
@@ -30,6 +31,14 @@ void IFC4X3::IfcProductRepresentation::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_Representations, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcProductRepresentation, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProductRepresentation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Representations, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcProductRepresentation, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProductRepresentation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -41,6 +50,15 @@ void IFC4X3::IfcProductRepresentation::getAttributes( std::vector<std::pair<std:
 void IFC4X3::IfcProductRepresentation::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcProductRepresentation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Description", m_Description );
+	visitor.visitList( 2, "Representations", AttributeVectorView<IfcRepresentation>( m_Representations ) );
+}
+void IFC4X3::IfcProductRepresentation::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcProductRepresentation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcProductRepresentation> ptr_self = dynamic_pointer_cast<IfcProductRepresentation>( ptr_self_entity );
@@ -53,6 +71,16 @@ void IFC4X3::IfcProductRepresentation::setInverseCounterparts( shared_ptr<Buildi
 		}
 	}
 }
+void IFC4X3::IfcProductRepresentation::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	for( size_t i=0; i<m_Representations.size(); ++i )
+	{
+		if( m_Representations[i] )
+		{
+			refs.emplace_back( m_Representations[i].get(), INVERSE_OfProductRepresentation );
+		}
+	}
+}
 void IFC4X3::IfcProductRepresentation::unlinkFromInverseCounterparts()
 {
 	for( size_t i=0; i<m_Representations.size(); ++i )
@@ -81,3 +109,13 @@ void IFC4X3::IfcProductRepresentation::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcProductRepresentation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Representations.size(); ++i )
+	{
+		if( m_Representations[i] )
+		{
+			refs.push_back( m_Representations[i].get() );
+		}
+	}
+}
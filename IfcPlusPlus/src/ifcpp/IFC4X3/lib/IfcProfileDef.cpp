@@ -28,6 +28,13 @@ void IFC4X3::IfcProfileDef::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcProfileDef, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcProfileDef, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ProfileType", m_ProfileType ) );
@@ -54,6 +61,16 @@ void IFC4X3::IfcProfileDef::getAttributesInverse( std::vector<std::pair<std::str
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasProperties_inverse", HasProperties_inverse_vec_obj ) );
 }
+void IFC4X3::IfcProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ProfileType", m_ProfileType );
+	visitor.visitObject( 1, "ProfileName", m_ProfileName );
+}
+void IFC4X3::IfcProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReference_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReference_inverse ) );
+	visitor.visitList( 1, "HasProperties_inverse", AttributeInverseVectorView<IfcProfileProperties>( m_HasProperties_inverse ) );
+}
 void IFC4X3::IfcProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
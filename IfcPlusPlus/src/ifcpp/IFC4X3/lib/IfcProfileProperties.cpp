@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
 #include "ifcpp/IFC4X3/include/IfcProfileDef.h"
@@ -35,6 +36,15 @@ void IFC4X3::IfcProfileProperties::readStepArguments( const std::vector<std::str
 	if( num_args > 3 ){readEntityReference( args[3], m_ProfileDefinition, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcProfileProperties, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProfileProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Properties, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_ProfileDefinition, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcProfileProperties, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProfileProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcExtendedProperties::getAttributes( vec_attributes );
@@ -44,6 +54,15 @@ void IFC4X3::IfcProfileProperties::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcExtendedProperties::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcProfileProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExtendedProperties::visitAttributes( visitor );
+	visitor.visitObject( 3, "ProfileDefinition", m_ProfileDefinition );
+}
+void IFC4X3::IfcProfileProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcExtendedProperties::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcProfileProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcExtendedProperties::setInverseCounterparts( ptr_self_entity );
@@ -54,6 +73,14 @@ void IFC4X3::IfcProfileProperties::setInverseCounterparts( shared_ptr<BuildingEn
 		m_ProfileDefinition->m_HasProperties_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcProfileProperties::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcExtendedProperties::getInverseReferences( refs );
+	if( m_ProfileDefinition )
+	{
+		refs.emplace_back( m_ProfileDefinition.get(), INVERSE_HasProperties );
+	}
+}
 void IFC4X3::IfcProfileProperties::unlinkFromInverseCounterparts()
 {
 	IfcExtendedProperties::unlinkFromInverseCounterparts();
@@ -80,3 +107,11 @@ void IFC4X3::IfcProfileProperties::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcProfileProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcExtendedProperties::getEntityReferences( refs );
+	if( m_ProfileDefinition )
+	{
+		refs.push_back( m_ProfileDefinition.get() );
+	}
+}
@@ -57,6 +57,20 @@ void IFC4X3::IfcProject::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 8 ){readEntityReference( args[8], m_UnitsInContext, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcProject, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProject::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LongName = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Phase = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_RepresentationContexts, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_UnitsInContext, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcProject, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProject::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcContext::getAttributes( vec_attributes );
@@ -65,6 +79,14 @@ void IFC4X3::IfcProject::getAttributesInverse( std::vector<std::pair<std::string
 {
 	IFC4X3::IfcContext::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcProject::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcContext::visitAttributes( visitor );
+}
+void IFC4X3::IfcProject::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcContext::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcProject::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcContext::setInverseCounterparts( ptr_self_entity );
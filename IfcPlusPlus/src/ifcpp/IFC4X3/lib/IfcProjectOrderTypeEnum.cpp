@@ -25,6 +25,10 @@ void IFC4X3::IfcProjectOrderTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProjectOrderTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProjectOrderTypeEnum> IFC4X3::IfcProjectOrderTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProjectOrderTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcProjectOrderTypeEnum> IFC4X3::IfcProjectOrderTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProjectOrderTypeEnum> IFC4X3::IfcProjectOrderTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcProjectOrderTypeEnum>(); }
+		return shared_ptr<IfcProjectOrderTypeEnum>( new IfcProjectOrderTypeEnum( IfcProjectOrderTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
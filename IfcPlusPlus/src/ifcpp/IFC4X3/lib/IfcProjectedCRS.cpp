@@ -45,6 +45,18 @@ void IFC4X3::IfcProjectedCRS::readStepArguments( const std::vector<std::string>&
 	if( num_args > 6 ){readEntityReference( args[6], m_MapUnit, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProjectedCRS, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProjectedCRS::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_GeodeticDatum = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_VerticalDatum = IfcIdentifier::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MapProjection = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_MapZone = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_MapUnit, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcProjectedCRS, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProjectedCRS::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCoordinateReferenceSystem::getAttributes( vec_attributes );
@@ -57,6 +69,18 @@ void IFC4X3::IfcProjectedCRS::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcCoordinateReferenceSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcProjectedCRS::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateReferenceSystem::visitAttributes( visitor );
+	visitor.visitObject( 3, "VerticalDatum", m_VerticalDatum );
+	visitor.visitObject( 4, "MapProjection", m_MapProjection );
+	visitor.visitObject( 5, "MapZone", m_MapZone );
+	visitor.visitObject( 6, "MapUnit", m_MapUnit );
+}
+void IFC4X3::IfcProjectedCRS::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateReferenceSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcProjectedCRS::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCoordinateReferenceSystem::setInverseCounterparts( ptr_self_entity );
@@ -65,3 +89,11 @@ void IFC4X3::IfcProjectedCRS::unlinkFromInverseCounterparts()
 {
 	IfcCoordinateReferenceSystem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcProjectedCRS::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCoordinateReferenceSystem::getEntityReferences( refs );
+	if( m_MapUnit )
+	{
+		refs.push_back( m_MapUnit.get() );
+	}
+}
@@ -20,6 +20,10 @@ void IFC4X3::IfcProjectedOrTrueLengthEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProjectedOrTrueLengthEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProjectedOrTrueLengthEnum> IFC4X3::IfcProjectedOrTrueLengthEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProjectedOrTrueLengthEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcProjectedOrTrueLengthEnum> IFC4X3::IfcProjectedOrTrueLengt
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProjectedOrTrueLengthEnum> IFC4X3::IfcProjectedOrTrueLengthEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_TRUE_LENGTH ) { return shared_ptr<IfcProjectedOrTrueLengthEnum>(); }
+		return shared_ptr<IfcProjectedOrTrueLengthEnum>( new IfcProjectedOrTrueLengthEnum( IfcProjectedOrTrueLengthEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
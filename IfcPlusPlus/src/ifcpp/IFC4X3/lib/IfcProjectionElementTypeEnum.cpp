@@ -22,6 +22,10 @@ void IFC4X3::IfcProjectionElementTypeEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProjectionElementTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProjectionElementTypeEnum> IFC4X3::IfcProjectionElementTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProjectionElementTypeEnum>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcProjectionElementTypeEnum> IFC4X3::IfcProjectionElementTyp
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProjectionElementTypeEnum> IFC4X3::IfcProjectionElementTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcProjectionElementTypeEnum>(); }
+		return shared_ptr<IfcProjectionElementTypeEnum>( new IfcProjectionElementTypeEnum( IfcProjectionElementTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -32,6 +32,13 @@ void IFC4X3::IfcProperty::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 1 ){m_Specification = IfcText::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcProperty, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcProperty::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcProperty, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcProperty::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributes( vec_attributes );
@@ -96,6 +103,22 @@ void IFC4X3::IfcProperty::getAttributesInverse( std::vector<std::pair<std::strin
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasApprovals_inverse", HasApprovals_inverse_vec_obj ) );
 }
+void IFC4X3::IfcProperty::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitObject( 1, "Specification", m_Specification );
+}
+void IFC4X3::IfcProperty::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "PartOfPset_inverse", AttributeInverseVectorView<IfcPropertySet>( m_PartOfPset_inverse ) );
+	visitor.visitList( 2, "PropertyForDependance_inverse", AttributeInverseVectorView<IfcPropertyDependencyRelationship>( m_PropertyForDependance_inverse ) );
+	visitor.visitList( 3, "PropertyDependsOn_inverse", AttributeInverseVectorView<IfcPropertyDependencyRelationship>( m_PropertyDependsOn_inverse ) );
+	visitor.visitList( 4, "PartOfComplex_inverse", AttributeInverseVectorView<IfcComplexProperty>( m_PartOfComplex_inverse ) );
+	visitor.visitList( 5, "HasConstraints_inverse", AttributeInverseVectorView<IfcResourceConstraintRelationship>( m_HasConstraints_inverse ) );
+	visitor.visitList( 6, "HasApprovals_inverse", AttributeInverseVectorView<IfcResourceApprovalRelationship>( m_HasApprovals_inverse ) );
+}
 void IFC4X3::IfcProperty::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyAbstraction::setInverseCounterparts( ptr_self_entity );
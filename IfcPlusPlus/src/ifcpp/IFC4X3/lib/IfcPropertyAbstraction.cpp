@@ -18,6 +18,9 @@ void IFC4X3::IfcPropertyAbstraction::getStepParameter( std::stringstream& stream
 void IFC4X3::IfcPropertyAbstraction::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcPropertyAbstraction::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcPropertyAbstraction::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
@@ -33,6 +36,13 @@ void IFC4X3::IfcPropertyAbstraction::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReferences_inverse", HasExternalReferences_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPropertyAbstraction::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcPropertyAbstraction::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+}
 void IFC4X3::IfcPropertyAbstraction::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
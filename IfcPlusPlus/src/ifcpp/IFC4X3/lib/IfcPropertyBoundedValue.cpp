@@ -46,6 +46,17 @@ void IFC4X3::IfcPropertyBoundedValue::readStepArguments( const std::vector<std::
 	if( num_args > 5 ){m_SetPointValue = IfcValue::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcPropertyBoundedValue, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyBoundedValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UpperBoundValue = IfcValue::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_LowerBoundValue = IfcValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Unit = IfcUnit::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_SetPointValue = IfcValue::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcPropertyBoundedValue, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyBoundedValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSimpleProperty::getAttributes( vec_attributes );
@@ -58,6 +69,18 @@ void IFC4X3::IfcPropertyBoundedValue::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcSimpleProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyBoundedValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributes( visitor );
+	visitor.visitObject( 2, "UpperBoundValue", m_UpperBoundValue );
+	visitor.visitObject( 3, "LowerBoundValue", m_LowerBoundValue );
+	visitor.visitObject( 4, "Unit", m_Unit );
+	visitor.visitObject( 5, "SetPointValue", m_SetPointValue );
+}
+void IFC4X3::IfcPropertyBoundedValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyBoundedValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSimpleProperty::setInverseCounterparts( ptr_self_entity );
@@ -66,3 +89,12 @@ void IFC4X3::IfcPropertyBoundedValue::unlinkFromInverseCounterparts()
 {
 	IfcSimpleProperty::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertyBoundedValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSimpleProperty::getEntityReferences( refs );
+	BuildingEntity* Unit_entity = dynamic_cast<BuildingEntity*>( m_Unit.get() );
+	if( Unit_entity )
+	{
+		refs.push_back( Unit_entity );
+	}
+}
@@ -36,6 +36,15 @@ void IFC4X3::IfcPropertyDefinition::readStepArguments( const std::vector<std::st
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyDefinition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyDefinition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRoot::getAttributes( vec_attributes );
@@ -62,6 +71,16 @@ void IFC4X3::IfcPropertyDefinition::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasAssociations_inverse", HasAssociations_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPropertyDefinition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRoot::visitAttributes( visitor );
+}
+void IFC4X3::IfcPropertyDefinition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRoot::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "HasContext_inverse", AttributeInverseVectorView<IfcRelDeclares>( m_HasContext_inverse ) );
+	visitor.visitList( 1, "HasAssociations_inverse", AttributeInverseVectorView<IfcRelAssociates>( m_HasAssociations_inverse ) );
+}
 void IFC4X3::IfcPropertyDefinition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRoot::setInverseCounterparts( ptr_self_entity );
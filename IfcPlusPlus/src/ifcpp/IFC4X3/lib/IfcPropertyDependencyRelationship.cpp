@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcProperty.h"
 #include "ifcpp/IFC4X3/include/IfcPropertyDependencyRelationship.h"
@@ -36,6 +37,16 @@ void IFC4X3::IfcPropertyDependencyRelationship::readStepArguments( const std::ve
 	if( num_args > 4 ){m_Expression = IfcText::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPropertyDependencyRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyDependencyRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_DependingProperty, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_DependantProperty, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Expression = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPropertyDependencyRelationship, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyDependencyRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -47,6 +58,17 @@ void IFC4X3::IfcPropertyDependencyRelationship::getAttributesInverse( std::vecto
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyDependencyRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "DependingProperty", m_DependingProperty );
+	visitor.visitObject( 3, "DependantProperty", m_DependantProperty );
+	visitor.visitObject( 4, "Expression", m_Expression );
+}
+void IFC4X3::IfcPropertyDependencyRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyDependencyRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -61,6 +83,18 @@ void IFC4X3::IfcPropertyDependencyRelationship::setInverseCounterparts( shared_p
 		m_DependingProperty->m_PropertyForDependance_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcPropertyDependencyRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	if( m_DependantProperty )
+	{
+		refs.emplace_back( m_DependantProperty.get(), INVERSE_PropertyDependsOn );
+	}
+	if( m_DependingProperty )
+	{
+		refs.emplace_back( m_DependingProperty.get(), INVERSE_PropertyForDependance );
+	}
+}
 void IFC4X3::IfcPropertyDependencyRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -109,3 +143,15 @@ void IFC4X3::IfcPropertyDependencyRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPropertyDependencyRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_DependingProperty )
+	{
+		refs.push_back( m_DependingProperty.get() );
+	}
+	if( m_DependantProperty )
+	{
+		refs.push_back( m_DependantProperty.get() );
+	}
+}
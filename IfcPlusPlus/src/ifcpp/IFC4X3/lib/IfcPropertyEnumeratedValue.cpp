@@ -61,6 +61,15 @@ void IFC4X3::IfcPropertyEnumeratedValue::readStepArguments( const std::vector<st
 	if( num_args > 3 ){readEntityReference( args[3], m_EnumerationReference, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyEnumeratedValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyEnumeratedValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_EnumerationValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_EnumerationReference, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyEnumeratedValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyEnumeratedValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSimpleProperty::getAttributes( vec_attributes );
@@ -73,6 +82,16 @@ void IFC4X3::IfcPropertyEnumeratedValue::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcSimpleProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyEnumeratedValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributes( visitor );
+	visitor.visitList( 2, "EnumerationValues", AttributeVectorView<IfcValue>( m_EnumerationValues ) );
+	visitor.visitObject( 3, "EnumerationReference", m_EnumerationReference );
+}
+void IFC4X3::IfcPropertyEnumeratedValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyEnumeratedValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSimpleProperty::setInverseCounterparts( ptr_self_entity );
@@ -81,3 +100,11 @@ void IFC4X3::IfcPropertyEnumeratedValue::unlinkFromInverseCounterparts()
 {
 	IfcSimpleProperty::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertyEnumeratedValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSimpleProperty::getEntityReferences( refs );
+	if( m_EnumerationReference )
+	{
+		refs.push_back( m_EnumerationReference.get() );
+	}
+}
@@ -48,6 +48,14 @@ void IFC4X3::IfcPropertyEnumeration::readStepArguments( const std::vector<std::s
 	if( num_args > 2 ){m_Unit = IfcUnit::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPropertyEnumeration, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyEnumeration::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readSelectList( args[1], m_EnumerationValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Unit = IfcUnit::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcPropertyEnumeration, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyEnumeration::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributes( vec_attributes );
@@ -61,6 +69,17 @@ void IFC4X3::IfcPropertyEnumeration::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcPropertyAbstraction::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyEnumeration::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributes( visitor );
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitList( 1, "EnumerationValues", AttributeVectorView<IfcValue>( m_EnumerationValues ) );
+	visitor.visitObject( 2, "Unit", m_Unit );
+}
+void IFC4X3::IfcPropertyEnumeration::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyAbstraction::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyEnumeration::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyAbstraction::setInverseCounterparts( ptr_self_entity );
@@ -69,3 +88,12 @@ void IFC4X3::IfcPropertyEnumeration::unlinkFromInverseCounterparts()
 {
 	IfcPropertyAbstraction::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertyEnumeration::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertyAbstraction::getEntityReferences( refs );
+	BuildingEntity* Unit_entity = dynamic_cast<BuildingEntity*>( m_Unit.get() );
+	if( Unit_entity )
+	{
+		refs.push_back( Unit_entity );
+	}
+}
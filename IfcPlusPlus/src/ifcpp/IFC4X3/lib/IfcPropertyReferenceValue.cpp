@@ -39,6 +39,15 @@ void IFC4X3::IfcPropertyReferenceValue::readStepArguments( const std::vector<std
 	if( num_args > 3 ){m_PropertyReference = IfcObjectReferenceSelect::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyReferenceValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyReferenceValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UsageName = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_PropertyReference = IfcObjectReferenceSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyReferenceValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyReferenceValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSimpleProperty::getAttributes( vec_attributes );
@@ -49,6 +58,16 @@ void IFC4X3::IfcPropertyReferenceValue::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcSimpleProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyReferenceValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributes( visitor );
+	visitor.visitObject( 2, "UsageName", m_UsageName );
+	visitor.visitObject( 3, "PropertyReference", m_PropertyReference );
+}
+void IFC4X3::IfcPropertyReferenceValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyReferenceValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSimpleProperty::setInverseCounterparts( ptr_self_entity );
@@ -57,3 +76,12 @@ void IFC4X3::IfcPropertyReferenceValue::unlinkFromInverseCounterparts()
 {
 	IfcSimpleProperty::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertyReferenceValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSimpleProperty::getEntityReferences( refs );
+	BuildingEntity* PropertyReference_entity = dynamic_cast<BuildingEntity*>( m_PropertyReference.get() );
+	if( PropertyReference_entity )
+	{
+		refs.push_back( PropertyReference_entity );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcOwnerHistory.h"
@@ -43,6 +44,16 @@ void IFC4X3::IfcPropertySet::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){readEntityReferenceList( args[4], m_HasProperties, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPropertySet, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertySet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_HasProperties, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcPropertySet, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertySet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertySetDefinition::getAttributes( vec_attributes );
@@ -54,6 +65,15 @@ void IFC4X3::IfcPropertySet::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcPropertySetDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertySet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertySetDefinition::visitAttributes( visitor );
+	visitor.visitList( 4, "HasProperties", AttributeVectorView<IfcProperty>( m_HasProperties ) );
+}
+void IFC4X3::IfcPropertySet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertySetDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertySet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertySetDefinition::setInverseCounterparts( ptr_self_entity );
@@ -67,6 +87,17 @@ void IFC4X3::IfcPropertySet::setInverseCounterparts( shared_ptr<BuildingEntity>
 		}
 	}
 }
+void IFC4X3::IfcPropertySet::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPropertySetDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasProperties.size(); ++i )
+	{
+		if( m_HasProperties[i] )
+		{
+			refs.emplace_back( m_HasProperties[i].get(), INVERSE_PartOfPset );
+		}
+	}
+}
 void IFC4X3::IfcPropertySet::unlinkFromInverseCounterparts()
 {
 	IfcPropertySetDefinition::unlinkFromInverseCounterparts();
@@ -96,3 +127,14 @@ void IFC4X3::IfcPropertySet::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPropertySet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertySetDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasProperties.size(); ++i )
+	{
+		if( m_HasProperties[i] )
+		{
+			refs.push_back( m_HasProperties[i].get() );
+		}
+	}
+}
@@ -39,6 +39,15 @@ void IFC4X3::IfcPropertySetDefinition::readStepArguments( const std::vector<std:
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertySetDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertySetDefinition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertySetDefinition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertySetDefinition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyDefinition::getAttributes( vec_attributes );
@@ -74,6 +83,17 @@ void IFC4X3::IfcPropertySetDefinition::getAttributesInverse( std::vector<std::pa
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "DefinesOccurrence_inverse", DefinesOccurrence_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPropertySetDefinition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyDefinition::visitAttributes( visitor );
+}
+void IFC4X3::IfcPropertySetDefinition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "DefinesType_inverse", AttributeInverseVectorView<IfcTypeObject>( m_DefinesType_inverse ) );
+	visitor.visitList( 3, "IsDefinedBy_inverse", AttributeInverseVectorView<IfcRelDefinesByTemplate>( m_IsDefinedBy_inverse ) );
+	visitor.visitList( 4, "DefinesOccurrence_inverse", AttributeInverseVectorView<IfcRelDefinesByProperties>( m_DefinesOccurrence_inverse ) );
+}
 void IFC4X3::IfcPropertySetDefinition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyDefinition::setInverseCounterparts( ptr_self_entity );
@@ -22,3 +22,10 @@ shared_ptr<IFC4X3::IfcPropertySetDefinitionSelect> IFC4X3::IfcPropertySetDefinit
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcPropertySetDefinitionSelect> IFC4X3::IfcPropertySetDefinitionSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcPropertySetDefinitionSelect>(); }
+	shared_ptr<IfcPropertySetDefinitionSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcPropertySetDefinitionSet::getStepParameter( std::stringstream& s
 	writeEntityList( stream, m_vec );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcPropertySetDefinitionSet::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeTyped( classID(), [&]() { return encoder.encodeList( AttributeVectorView<IfcPropertySetDefinition>( m_vec ) ); } );
+}
 shared_ptr<IFC4X3::IfcPropertySetDefinitionSet> IFC4X3::IfcPropertySetDefinitionSet::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcPropertySetDefinitionSet>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcPropertySetDefinitionSet> IFC4X3::IfcPropertySetDefinition
 	readEntityReferenceList(  arg, type_object->m_vec, map, errorStream, entityIdNotFound );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcPropertySetDefinitionSet> IFC4X3::IfcPropertySetDefinitionSet::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcPropertySetDefinitionSet>(); }
+	shared_ptr<IfcPropertySetDefinitionSet> type_object( new IfcPropertySetDefinitionSet() );
+	readEntityReferenceList( arg, type_object->m_vec, map, errorStream, entityIdNotFound );
+	return type_object;
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -49,6 +50,18 @@ void IFC4X3::IfcPropertySetTemplate::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){readEntityReferenceList( args[6], m_HasPropertyTemplates, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPropertySetTemplate, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertySetTemplate::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_TemplateType = IfcPropertySetTemplateTypeEnum::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_ApplicableEntity = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_HasPropertyTemplates, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcPropertySetTemplate, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertySetTemplate::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyTemplateDefinition::getAttributes( vec_attributes );
@@ -71,6 +84,18 @@ void IFC4X3::IfcPropertySetTemplate::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Defines_inverse", Defines_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPropertySetTemplate::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplateDefinition::visitAttributes( visitor );
+	visitor.visitObject( 4, "TemplateType", m_TemplateType );
+	visitor.visitObject( 5, "ApplicableEntity", m_ApplicableEntity );
+	visitor.visitList( 6, "HasPropertyTemplates", AttributeVectorView<IfcPropertyTemplate>( m_HasPropertyTemplates ) );
+}
+void IFC4X3::IfcPropertySetTemplate::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplateDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "Defines_inverse", AttributeInverseVectorView<IfcRelDefinesByTemplate>( m_Defines_inverse ) );
+}
 void IFC4X3::IfcPropertySetTemplate::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyTemplateDefinition::setInverseCounterparts( ptr_self_entity );
@@ -84,6 +109,17 @@ void IFC4X3::IfcPropertySetTemplate::setInverseCounterparts( shared_ptr<Building
 		}
 	}
 }
+void IFC4X3::IfcPropertySetTemplate::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPropertyTemplateDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasPropertyTemplates.size(); ++i )
+	{
+		if( m_HasPropertyTemplates[i] )
+		{
+			refs.emplace_back( m_HasPropertyTemplates[i].get(), INVERSE_PartOfPsetTemplate );
+		}
+	}
+}
 void IFC4X3::IfcPropertySetTemplate::unlinkFromInverseCounterparts()
 {
 	IfcPropertyTemplateDefinition::unlinkFromInverseCounterparts();
@@ -113,3 +149,14 @@ void IFC4X3::IfcPropertySetTemplate::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcPropertySetTemplate::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertyTemplateDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasPropertyTemplates.size(); ++i )
+	{
+		if( m_HasPropertyTemplates[i] )
+		{
+			refs.push_back( m_HasPropertyTemplates[i].get() );
+		}
+	}
+}
@@ -40,6 +40,15 @@ void IFC4X3::IfcPropertySingleValue::readStepArguments( const std::vector<std::s
 	if( num_args > 3 ){m_Unit = IfcUnit::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertySingleValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertySingleValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_NominalValue = IfcValue::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Unit = IfcUnit::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertySingleValue, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertySingleValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSimpleProperty::getAttributes( vec_attributes );
@@ -50,6 +59,16 @@ void IFC4X3::IfcPropertySingleValue::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcSimpleProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertySingleValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributes( visitor );
+	visitor.visitObject( 2, "NominalValue", m_NominalValue );
+	visitor.visitObject( 3, "Unit", m_Unit );
+}
+void IFC4X3::IfcPropertySingleValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertySingleValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSimpleProperty::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +77,12 @@ void IFC4X3::IfcPropertySingleValue::unlinkFromInverseCounterparts()
 {
 	IfcSimpleProperty::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertySingleValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSimpleProperty::getEntityReferences( refs );
+	BuildingEntity* Unit_entity = dynamic_cast<BuildingEntity*>( m_Unit.get() );
+	if( Unit_entity )
+	{
+		refs.push_back( Unit_entity );
+	}
+}
@@ -95,6 +95,19 @@ void IFC4X3::IfcPropertyTableValue::readStepArguments( const std::vector<std::st
 	if( num_args > 7 ){m_CurveInterpolation = IfcCurveInterpolationEnum::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPropertyTableValue, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyTableValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_DefiningValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readSelectList( args[3], m_DefinedValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Expression = IfcText::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_DefiningUnit = IfcUnit::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_DefinedUnit = IfcUnit::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_CurveInterpolation = IfcCurveInterpolationEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcPropertyTableValue, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyTableValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSimpleProperty::getAttributes( vec_attributes );
@@ -113,6 +126,20 @@ void IFC4X3::IfcPropertyTableValue::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcSimpleProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcPropertyTableValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributes( visitor );
+	visitor.visitList( 2, "DefiningValues", AttributeVectorView<IfcValue>( m_DefiningValues ) );
+	visitor.visitList( 3, "DefinedValues", AttributeVectorView<IfcValue>( m_DefinedValues ) );
+	visitor.visitObject( 4, "Expression", m_Expression );
+	visitor.visitObject( 5, "DefiningUnit", m_DefiningUnit );
+	visitor.visitObject( 6, "DefinedUnit", m_DefinedUnit );
+	visitor.visitObject( 7, "CurveInterpolation", m_CurveInterpolation );
+}
+void IFC4X3::IfcPropertyTableValue::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSimpleProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcPropertyTableValue::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSimpleProperty::setInverseCounterparts( ptr_self_entity );
@@ -121,3 +148,17 @@ void IFC4X3::IfcPropertyTableValue::unlinkFromInverseCounterparts()
 {
 	IfcSimpleProperty::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcPropertyTableValue::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSimpleProperty::getEntityReferences( refs );
+	BuildingEntity* DefiningUnit_entity = dynamic_cast<BuildingEntity*>( m_DefiningUnit.get() );
+	if( DefiningUnit_entity )
+	{
+		refs.push_back( DefiningUnit_entity );
+	}
+	BuildingEntity* DefinedUnit_entity = dynamic_cast<BuildingEntity*>( m_DefinedUnit.get() );
+	if( DefinedUnit_entity )
+	{
+		refs.push_back( DefinedUnit_entity );
+	}
+}
@@ -38,6 +38,15 @@ void IFC4X3::IfcPropertyTemplate::readStepArguments( const std::vector<std::stri
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyTemplate, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcPropertyTemplate::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcPropertyTemplate, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcPropertyTemplate::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyTemplateDefinition::getAttributes( vec_attributes );
@@ -64,6 +73,16 @@ void IFC4X3::IfcPropertyTemplate::getAttributesInverse( std::vector<std::pair<st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "PartOfPsetTemplate_inverse", PartOfPsetTemplate_inverse_vec_obj ) );
 }
+void IFC4X3::IfcPropertyTemplate::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplateDefinition::visitAttributes( visitor );
+}
+void IFC4X3::IfcPropertyTemplate::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplateDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "PartOfComplexTemplate_inverse", AttributeInverseVectorView<IfcComplexPropertyTemplate>( m_PartOfComplexTemplate_inverse ) );
+	visitor.visitList( 3, "PartOfPsetTemplate_inverse", AttributeInverseVectorView<IfcPropertySetTemplate>( m_PartOfPsetTemplate_inverse ) );
+}
 void IFC4X3::IfcPropertyTemplate::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyTemplateDefinition::setInverseCounterparts( ptr_self_entity );
@@ -24,6 +24,10 @@ void IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum::getStepParameter( std::str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum> IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProtectiveDeviceTrippingUnitTypeEnum>(); }
@@ -56,3 +60,12 @@ shared_ptr<IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum> IFC4X3::IfcProtectiv
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum> IFC4X3::IfcProtectiveDeviceTrippingUnitTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcProtectiveDeviceTrippingUnitTypeEnum>(); }
+		return shared_ptr<IfcProtectiveDeviceTrippingUnitTypeEnum>( new IfcProtectiveDeviceTrippingUnitTypeEnum( IfcProtectiveDeviceTrippingUnitTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
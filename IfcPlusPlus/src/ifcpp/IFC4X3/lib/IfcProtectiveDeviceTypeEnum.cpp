@@ -30,6 +30,10 @@ void IFC4X3::IfcProtectiveDeviceTypeEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcProtectiveDeviceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcProtectiveDeviceTypeEnum> IFC4X3::IfcProtectiveDeviceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcProtectiveDeviceTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcProtectiveDeviceTypeEnum> IFC4X3::IfcProtectiveDeviceTypeE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcProtectiveDeviceTypeEnum> IFC4X3::IfcProtectiveDeviceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcProtectiveDeviceTypeEnum>(); }
+		return shared_ptr<IfcProtectiveDeviceTypeEnum>( new IfcProtectiveDeviceTypeEnum( IfcProtectiveDeviceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -39,6 +39,16 @@ void IFC4X3::IfcQuantityNumber::readStepArguments( const std::vector<std::string
 	if( num_args > 4 ){m_Formula = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcQuantityNumber, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcQuantityNumber::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Unit, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_NumberValue = IfcNumericMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Formula = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcQuantityNumber, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcQuantityNumber::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPhysicalSimpleQuantity::getAttributes( vec_attributes );
@@ -49,6 +59,16 @@ void IFC4X3::IfcQuantityNumber::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcPhysicalSimpleQuantity::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcQuantityNumber::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalSimpleQuantity::visitAttributes( visitor );
+	visitor.visitObject( 3, "NumberValue", m_NumberValue );
+	visitor.visitObject( 4, "Formula", m_Formula );
+}
+void IFC4X3::IfcQuantityNumber::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPhysicalSimpleQuantity::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcQuantityNumber::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPhysicalSimpleQuantity::setInverseCounterparts( ptr_self_entity );
@@ -39,6 +39,15 @@ void IFC4X3::IfcQuantitySet::readStepArguments( const std::vector<std::string>&
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcQuantitySet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcQuantitySet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcQuantitySet, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcQuantitySet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertySetDefinition::getAttributes( vec_attributes );
@@ -47,6 +56,14 @@ void IFC4X3::IfcQuantitySet::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcPropertySetDefinition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcQuantitySet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertySetDefinition::visitAttributes( visitor );
+}
+void IFC4X3::IfcQuantitySet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertySetDefinition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcQuantitySet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertySetDefinition::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcRadioActivityMeasure::getStepParameter( std::stringstream& strea
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRadioActivityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcRadioActivityMeasure> IFC4X3::IfcRadioActivityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRadioActivityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcRadioActivityMeasure> IFC4X3::IfcRadioActivityMeasure::cre
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRadioActivityMeasure> IFC4X3::IfcRadioActivityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcRadioActivityMeasure>(); }
+	shared_ptr<IfcRadioActivityMeasure> type_object( new IfcRadioActivityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
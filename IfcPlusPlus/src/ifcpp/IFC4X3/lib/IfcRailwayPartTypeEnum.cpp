@@ -29,6 +29,10 @@ void IFC4X3::IfcRailwayPartTypeEnum::getStepParameter( std::stringstream& stream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRailwayPartTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcRailwayPartTypeEnum> IFC4X3::IfcRailwayPartTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRailwayPartTypeEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcRailwayPartTypeEnum> IFC4X3::IfcRailwayPartTypeEnum::creat
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRailwayPartTypeEnum> IFC4X3::IfcRailwayPartTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcRailwayPartTypeEnum>(); }
+		return shared_ptr<IfcRailwayPartTypeEnum>( new IfcRailwayPartTypeEnum( IfcRailwayPartTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -20,6 +20,10 @@ void IFC4X3::IfcRatioMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRatioMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcRatioMeasure> IFC4X3::IfcRatioMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRatioMeasure>(); }
@@ -29,3 +33,10 @@ shared_ptr<IFC4X3::IfcRatioMeasure> IFC4X3::IfcRatioMeasure::createObjectFromSTE
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRatioMeasure> IFC4X3::IfcRatioMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcRatioMeasure>(); }
+	shared_ptr<IfcRatioMeasure> type_object( new IfcRatioMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -54,6 +54,20 @@ void IFC4X3::IfcRationalBSplineCurveWithKnots::readStepArguments( const std::vec
 	if( num_args > 8 ){readTypeOfRealList( args[8], m_WeightsData );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRationalBSplineCurveWithKnots, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRationalBSplineCurveWithKnots::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Degree = IfcInteger::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_ControlPointsList, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_CurveForm = IfcBSplineCurveForm::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ClosedCurve = IfcLogical::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_SelfIntersect = IfcLogical::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readTypeOfIntegerList( args[5], m_KnotMultiplicities );}
+	if( num_args > 6 ){readTypeOfRealList( args[6], m_Knots );}
+	if( num_args > 7 ){m_KnotSpec = IfcKnotType::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readTypeOfRealList( args[8], m_WeightsData );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRationalBSplineCurveWithKnots, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRationalBSplineCurveWithKnots::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBSplineCurveWithKnots::getAttributes( vec_attributes );
@@ -65,6 +79,15 @@ void IFC4X3::IfcRationalBSplineCurveWithKnots::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcBSplineCurveWithKnots::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRationalBSplineCurveWithKnots::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineCurveWithKnots::visitAttributes( visitor );
+	visitor.visitList( 8, "WeightsData", AttributeVectorView<IfcReal>( m_WeightsData ) );
+}
+void IFC4X3::IfcRationalBSplineCurveWithKnots::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBSplineCurveWithKnots::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRationalBSplineCurveWithKnots::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBSplineCurveWithKnots::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcReal::getStepParameter( std::stringstream& stream, bool is_selec
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcReal::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcReal> IFC4X3::IfcReal::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcReal>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcReal> IFC4X3::IfcReal::createObjectFromSTEP( const std::st
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcReal> IFC4X3::IfcReal::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcReal>(); }
+	shared_ptr<IfcReal> type_object( new IfcReal() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -49,6 +49,19 @@ void IFC4X3::IfcRectangleHollowProfileDef::readStepArguments( const std::vector<
 	if( num_args > 7 ){m_OuterFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRectangleHollowProfileDef, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRectangleHollowProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_XDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_YDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_WallThickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_InnerFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_OuterFilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRectangleHollowProfileDef, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRectangleHollowProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRectangleProfileDef::getAttributes( vec_attributes );
@@ -60,6 +73,17 @@ void IFC4X3::IfcRectangleHollowProfileDef::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcRectangleProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRectangleHollowProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRectangleProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 5, "WallThickness", m_WallThickness );
+	visitor.visitObject( 6, "InnerFilletRadius", m_InnerFilletRadius );
+	visitor.visitObject( 7, "OuterFilletRadius", m_OuterFilletRadius );
+}
+void IFC4X3::IfcRectangleHollowProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRectangleProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRectangleHollowProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRectangleProfileDef::setInverseCounterparts( ptr_self_entity );
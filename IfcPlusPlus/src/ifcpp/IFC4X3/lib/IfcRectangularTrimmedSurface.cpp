@@ -44,6 +44,18 @@ void IFC4X3::IfcRectangularTrimmedSurface::readStepArguments( const std::vector<
 	if( num_args > 6 ){m_Vsense = IfcBoolean::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRectangularTrimmedSurface, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRectangularTrimmedSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisSurface, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_U1 = IfcParameterValue::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_V1 = IfcParameterValue::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_U2 = IfcParameterValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_V2 = IfcParameterValue::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Usense = IfcBoolean::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Vsense = IfcBoolean::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRectangularTrimmedSurface, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRectangularTrimmedSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedSurface::getAttributes( vec_attributes );
@@ -59,6 +71,21 @@ void IFC4X3::IfcRectangularTrimmedSurface::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcBoundedSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRectangularTrimmedSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisSurface", m_BasisSurface );
+	visitor.visitObject( 1, "U1", m_U1 );
+	visitor.visitObject( 2, "V1", m_V1 );
+	visitor.visitObject( 3, "U2", m_U2 );
+	visitor.visitObject( 4, "V2", m_V2 );
+	visitor.visitObject( 5, "Usense", m_Usense );
+	visitor.visitObject( 6, "Vsense", m_Vsense );
+}
+void IFC4X3::IfcRectangularTrimmedSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRectangularTrimmedSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedSurface::setInverseCounterparts( ptr_self_entity );
@@ -67,3 +94,11 @@ void IFC4X3::IfcRectangularTrimmedSurface::unlinkFromInverseCounterparts()
 {
 	IfcBoundedSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcRectangularTrimmedSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedSurface::getEntityReferences( refs );
+	if( m_BasisSurface )
+	{
+		refs.push_back( m_BasisSurface.get() );
+	}
+}
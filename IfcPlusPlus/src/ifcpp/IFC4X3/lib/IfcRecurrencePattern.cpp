@@ -48,6 +48,19 @@ void IFC4X3::IfcRecurrencePattern::readStepArguments( const std::vector<std::str
 	if( num_args > 7 ){readEntityReferenceList( args[7], m_TimePeriods, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRecurrencePattern, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRecurrencePattern::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_RecurrenceType = IfcRecurrenceTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfIntegerList( args[1], m_DayComponent );}
+	if( num_args > 2 ){readTypeOfIntegerList( args[2], m_WeekdayComponent );}
+	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_MonthComponent );}
+	if( num_args > 4 ){m_Position = IfcInteger::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Interval = IfcInteger::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Occurrences = IfcInteger::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_TimePeriods, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRecurrencePattern, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRecurrencePattern::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "RecurrenceType", m_RecurrenceType ) );
@@ -70,9 +83,33 @@ void IFC4X3::IfcRecurrencePattern::getAttributes( std::vector<std::pair<std::str
 void IFC4X3::IfcRecurrencePattern::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcRecurrencePattern::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "RecurrenceType", m_RecurrenceType );
+	visitor.visitList( 1, "DayComponent", AttributeVectorView<IfcDayInMonthNumber>( m_DayComponent ) );
+	visitor.visitList( 2, "WeekdayComponent", AttributeVectorView<IfcDayInWeekNumber>( m_WeekdayComponent ) );
+	visitor.visitList( 3, "MonthComponent", AttributeVectorView<IfcMonthInYearNumber>( m_MonthComponent ) );
+	visitor.visitObject( 4, "Position", m_Position );
+	visitor.visitObject( 5, "Interval", m_Interval );
+	visitor.visitObject( 6, "Occurrences", m_Occurrences );
+	visitor.visitList( 7, "TimePeriods", AttributeVectorView<IfcTimePeriod>( m_TimePeriods ) );
+}
+void IFC4X3::IfcRecurrencePattern::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcRecurrencePattern::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcRecurrencePattern::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcRecurrencePattern::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_TimePeriods.size(); ++i )
+	{
+		if( m_TimePeriods[i] )
+		{
+			refs.push_back( m_TimePeriods[i].get() );
+		}
+	}
+}
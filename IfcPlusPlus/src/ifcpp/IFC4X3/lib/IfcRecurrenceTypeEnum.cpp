@@ -26,6 +26,10 @@ void IFC4X3::IfcRecurrenceTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRecurrenceTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcRecurrenceTypeEnum> IFC4X3::IfcRecurrenceTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRecurrenceTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcRecurrenceTypeEnum> IFC4X3::IfcRecurrenceTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRecurrenceTypeEnum> IFC4X3::IfcRecurrenceTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_YEARLY_BY_POSITION ) { return shared_ptr<IfcRecurrenceTypeEnum>(); }
+		return shared_ptr<IfcRecurrenceTypeEnum>( new IfcRecurrenceTypeEnum( IfcRecurrenceTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -36,6 +36,16 @@ void IFC4X3::IfcReference::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 4 ){readEntityReference( args[4], m_InnerReference, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcReference, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReference::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_TypeIdentifier = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_AttributeIdentifier = IfcIdentifier::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_InstanceName = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList( args[3], m_ListPositions );}
+	if( num_args > 4 ){readEntityReference( args[4], m_InnerReference, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcReference, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReference::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "TypeIdentifier", m_TypeIdentifier ) );
@@ -49,9 +59,27 @@ void IFC4X3::IfcReference::getAttributes( std::vector<std::pair<std::string, sha
 void IFC4X3::IfcReference::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcReference::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "TypeIdentifier", m_TypeIdentifier );
+	visitor.visitObject( 1, "AttributeIdentifier", m_AttributeIdentifier );
+	visitor.visitObject( 2, "InstanceName", m_InstanceName );
+	visitor.visitList( 3, "ListPositions", AttributeVectorView<IfcInteger>( m_ListPositions ) );
+	visitor.visitObject( 4, "InnerReference", m_InnerReference );
+}
+void IFC4X3::IfcReference::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcReference::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcReference::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcReference::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_InnerReference )
+	{
+		refs.push_back( m_InnerReference.get() );
+	}
+}
@@ -29,6 +29,10 @@ void IFC4X3::IfcReflectanceMethodEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcReflectanceMethodEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcReflectanceMethodEnum> IFC4X3::IfcReflectanceMethodEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcReflectanceMethodEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcReflectanceMethodEnum> IFC4X3::IfcReflectanceMethodEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcReflectanceMethodEnum> IFC4X3::IfcReflectanceMethodEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcReflectanceMethodEnum>(); }
+		return shared_ptr<IfcReflectanceMethodEnum>( new IfcReflectanceMethodEnum( IfcReflectanceMethodEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -43,6 +43,17 @@ void IFC4X3::IfcReinforcementBarProperties::readStepArguments( const std::vector
 	if( num_args > 5 ){m_BarCount = IfcCountMeasure::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcReinforcementBarProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcementBarProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_TotalCrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SteelGrade = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_BarSurface = IfcReinforcingBarSurfaceEnum::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_EffectiveDepth = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_NominalBarDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_BarCount = IfcCountMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcReinforcementBarProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcementBarProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributes( vec_attributes );
@@ -57,6 +68,20 @@ void IFC4X3::IfcReinforcementBarProperties::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcementBarProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributes( visitor );
+	visitor.visitObject( 0, "TotalCrossSectionArea", m_TotalCrossSectionArea );
+	visitor.visitObject( 1, "SteelGrade", m_SteelGrade );
+	visitor.visitObject( 2, "BarSurface", m_BarSurface );
+	visitor.visitObject( 3, "EffectiveDepth", m_EffectiveDepth );
+	visitor.visitObject( 4, "NominalBarDiameter", m_NominalBarDiameter );
+	visitor.visitObject( 5, "BarCount", m_BarCount );
+}
+void IFC4X3::IfcReinforcementBarProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcementBarProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedProperties::setInverseCounterparts( ptr_self_entity );
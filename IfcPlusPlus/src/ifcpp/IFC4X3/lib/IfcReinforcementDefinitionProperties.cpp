@@ -46,6 +46,17 @@ void IFC4X3::IfcReinforcementDefinitionProperties::readStepArguments( const std:
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_ReinforcementSectionDefinitions, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcReinforcementDefinitionProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcementDefinitionProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_DefinitionType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_ReinforcementSectionDefinitions, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcReinforcementDefinitionProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcementDefinitionProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributes( vec_attributes );
@@ -58,6 +69,16 @@ void IFC4X3::IfcReinforcementDefinitionProperties::getAttributesInverse( std::ve
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcementDefinitionProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "DefinitionType", m_DefinitionType );
+	visitor.visitList( 5, "ReinforcementSectionDefinitions", AttributeVectorView<IfcSectionReinforcementProperties>( m_ReinforcementSectionDefinitions ) );
+}
+void IFC4X3::IfcReinforcementDefinitionProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcementDefinitionProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedPropertySet::setInverseCounterparts( ptr_self_entity );
@@ -66,3 +87,14 @@ void IFC4X3::IfcReinforcementDefinitionProperties::unlinkFromInverseCounterparts
 {
 	IfcPreDefinedPropertySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcReinforcementDefinitionProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedPropertySet::getEntityReferences( refs );
+	for( size_t i=0; i<m_ReinforcementSectionDefinitions.size(); ++i )
+	{
+		if( m_ReinforcementSectionDefinitions[i] )
+		{
+			refs.push_back( m_ReinforcementSectionDefinitions[i].get() );
+		}
+	}
+}
@@ -92,6 +92,25 @@ void IFC4X3::IfcReinforcingBar::readStepArguments( const std::vector<std::string
 	if( num_args > 13 ){m_BarSurface = IfcReinforcingBarSurfaceEnum::createObjectFromSTEP( args[13], map, errorStream, entityIdNotFound );}
 	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcReinforcingBar, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcingBar::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SteelGrade = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_NominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_CrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_BarLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_PredefinedType = IfcReinforcingBarTypeEnum::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_BarSurface = IfcReinforcingBarSurfaceEnum::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcReinforcingBar, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcingBar::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcReinforcingElement::getAttributes( vec_attributes );
@@ -105,6 +124,19 @@ void IFC4X3::IfcReinforcingBar::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcReinforcingElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcingBar::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributes( visitor );
+	visitor.visitObject( 9, "NominalDiameter", m_NominalDiameter );
+	visitor.visitObject( 10, "CrossSectionArea", m_CrossSectionArea );
+	visitor.visitObject( 11, "BarLength", m_BarLength );
+	visitor.visitObject( 12, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 13, "BarSurface", m_BarSurface );
+}
+void IFC4X3::IfcReinforcingBar::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcingBar::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcReinforcingElement::setInverseCounterparts( ptr_self_entity );
@@ -28,6 +28,10 @@ void IFC4X3::IfcReinforcingBarRoleEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcReinforcingBarRoleEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcReinforcingBarRoleEnum> IFC4X3::IfcReinforcingBarRoleEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcReinforcingBarRoleEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcReinforcingBarRoleEnum> IFC4X3::IfcReinforcingBarRoleEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcReinforcingBarRoleEnum> IFC4X3::IfcReinforcingBarRoleEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcReinforcingBarRoleEnum>(); }
+		return shared_ptr<IfcReinforcingBarRoleEnum>( new IfcReinforcingBarRoleEnum( IfcReinforcingBarRoleEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
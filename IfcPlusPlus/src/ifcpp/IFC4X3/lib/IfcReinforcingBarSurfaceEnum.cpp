@@ -20,6 +20,10 @@ void IFC4X3::IfcReinforcingBarSurfaceEnum::getStepParameter( std::stringstream&
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcReinforcingBarSurfaceEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcReinforcingBarSurfaceEnum> IFC4X3::IfcReinforcingBarSurfaceEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcReinforcingBarSurfaceEnum>(); }
@@ -36,3 +40,12 @@ shared_ptr<IFC4X3::IfcReinforcingBarSurfaceEnum> IFC4X3::IfcReinforcingBarSurfac
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcReinforcingBarSurfaceEnum> IFC4X3::IfcReinforcingBarSurfaceEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_TEXTURED ) { return shared_ptr<IfcReinforcingBarSurfaceEnum>(); }
+		return shared_ptr<IfcReinforcingBarSurfaceEnum>( new IfcReinforcingBarSurfaceEnum( IfcReinforcingBarSurfaceEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
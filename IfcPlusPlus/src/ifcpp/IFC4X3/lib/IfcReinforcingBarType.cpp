@@ -106,6 +106,27 @@ void IFC4X3::IfcReinforcingBarType::readStepArguments( const std::vector<std::st
 	if( num_args > 15 ){readSelectList( args[15], m_BendingParameters, "IFCBENDINGPARAMETERSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 16 ){ errorStream << "Wrong parameter count for entity IfcReinforcingBarType, expecting 16, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcingBarType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ElementType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcReinforcingBarTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_NominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_CrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_BarLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_BarSurface = IfcReinforcingBarSurfaceEnum::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_BendingShapeCode = IfcLabel::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){readSelectList( args[15], m_BendingParameters, "IFCBENDINGPARAMETERSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 16 ){ errorStream << "Wrong parameter count for entity IfcReinforcingBarType, expecting 16, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcingBarType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcReinforcingElementType::getAttributes( vec_attributes );
@@ -123,6 +144,21 @@ void IFC4X3::IfcReinforcingBarType::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcReinforcingElementType::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcingBarType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElementType::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 10, "NominalDiameter", m_NominalDiameter );
+	visitor.visitObject( 11, "CrossSectionArea", m_CrossSectionArea );
+	visitor.visitObject( 12, "BarLength", m_BarLength );
+	visitor.visitObject( 13, "BarSurface", m_BarSurface );
+	visitor.visitObject( 14, "BendingShapeCode", m_BendingShapeCode );
+	visitor.visitList( 15, "BendingParameters", AttributeVectorView<IfcBendingParameterSelect>( m_BendingParameters ) );
+}
+void IFC4X3::IfcReinforcingBarType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElementType::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcingBarType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcReinforcingElementType::setInverseCounterparts( ptr_self_entity );
@@ -29,6 +29,10 @@ void IFC4X3::IfcReinforcingBarTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcReinforcingBarTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcReinforcingBarTypeEnum> IFC4X3::IfcReinforcingBarTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcReinforcingBarTypeEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcReinforcingBarTypeEnum> IFC4X3::IfcReinforcingBarTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcReinforcingBarTypeEnum> IFC4X3::IfcReinforcingBarTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcReinforcingBarTypeEnum>(); }
+		return shared_ptr<IfcReinforcingBarTypeEnum>( new IfcReinforcingBarTypeEnum( IfcReinforcingBarTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -103,6 +103,29 @@ void IFC4X3::IfcReinforcingMesh::readStepArguments( const std::vector<std::strin
 	if( num_args > 17 ){m_PredefinedType = IfcReinforcingMeshTypeEnum::createObjectFromSTEP( args[17], map, errorStream, entityIdNotFound );}
 	if( num_args != 18 ){ errorStream << "Wrong parameter count for entity IfcReinforcingMesh, expecting 18, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcingMesh::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SteelGrade = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_MeshLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_MeshWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_LongitudinalBarNominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_TransverseBarNominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_LongitudinalBarCrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_TransverseBarCrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_LongitudinalBarSpacing = IfcPositiveLengthMeasure::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_TransverseBarSpacing = IfcPositiveLengthMeasure::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args > 17 ){m_PredefinedType = IfcReinforcingMeshTypeEnum::createObjectFromBinary( args[17], map, errorStream, entityIdNotFound );}
+	if( num_args != 18 ){ errorStream << "Wrong parameter count for entity IfcReinforcingMesh, expecting 18, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcingMesh::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcReinforcingElement::getAttributes( vec_attributes );
@@ -120,6 +143,23 @@ void IFC4X3::IfcReinforcingMesh::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcReinforcingElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcingMesh::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributes( visitor );
+	visitor.visitObject( 9, "MeshLength", m_MeshLength );
+	visitor.visitObject( 10, "MeshWidth", m_MeshWidth );
+	visitor.visitObject( 11, "LongitudinalBarNominalDiameter", m_LongitudinalBarNominalDiameter );
+	visitor.visitObject( 12, "TransverseBarNominalDiameter", m_TransverseBarNominalDiameter );
+	visitor.visitObject( 13, "LongitudinalBarCrossSectionArea", m_LongitudinalBarCrossSectionArea );
+	visitor.visitObject( 14, "TransverseBarCrossSectionArea", m_TransverseBarCrossSectionArea );
+	visitor.visitObject( 15, "LongitudinalBarSpacing", m_LongitudinalBarSpacing );
+	visitor.visitObject( 16, "TransverseBarSpacing", m_TransverseBarSpacing );
+	visitor.visitObject( 17, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcReinforcingMesh::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcingMesh::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcReinforcingElement::setInverseCounterparts( ptr_self_entity );
@@ -117,6 +117,31 @@ void IFC4X3::IfcReinforcingMeshType::readStepArguments( const std::vector<std::s
 	if( num_args > 19 ){readSelectList( args[19], m_BendingParameters, "IFCBENDINGPARAMETERSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 20 ){ errorStream << "Wrong parameter count for entity IfcReinforcingMeshType, expecting 20, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReinforcingMeshType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ElementType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcReinforcingMeshTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_MeshLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_MeshWidth = IfcPositiveLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_LongitudinalBarNominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_TransverseBarNominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_LongitudinalBarCrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_TransverseBarCrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_LongitudinalBarSpacing = IfcPositiveLengthMeasure::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args > 17 ){m_TransverseBarSpacing = IfcPositiveLengthMeasure::createObjectFromBinary( args[17], map, errorStream, entityIdNotFound );}
+	if( num_args > 18 ){m_BendingShapeCode = IfcLabel::createObjectFromBinary( args[18], map, errorStream, entityIdNotFound );}
+	if( num_args > 19 ){readSelectList( args[19], m_BendingParameters, "IFCBENDINGPARAMETERSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 20 ){ errorStream << "Wrong parameter count for entity IfcReinforcingMeshType, expecting 20, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReinforcingMeshType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcReinforcingElementType::getAttributes( vec_attributes );
@@ -138,6 +163,25 @@ void IFC4X3::IfcReinforcingMeshType::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcReinforcingElementType::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReinforcingMeshType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElementType::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 10, "MeshLength", m_MeshLength );
+	visitor.visitObject( 11, "MeshWidth", m_MeshWidth );
+	visitor.visitObject( 12, "LongitudinalBarNominalDiameter", m_LongitudinalBarNominalDiameter );
+	visitor.visitObject( 13, "TransverseBarNominalDiameter", m_TransverseBarNominalDiameter );
+	visitor.visitObject( 14, "LongitudinalBarCrossSectionArea", m_LongitudinalBarCrossSectionArea );
+	visitor.visitObject( 15, "TransverseBarCrossSectionArea", m_TransverseBarCrossSectionArea );
+	visitor.visitObject( 16, "LongitudinalBarSpacing", m_LongitudinalBarSpacing );
+	visitor.visitObject( 17, "TransverseBarSpacing", m_TransverseBarSpacing );
+	visitor.visitObject( 18, "BendingShapeCode", m_BendingShapeCode );
+	visitor.visitList( 19, "BendingParameters", AttributeVectorView<IfcBendingParameterSelect>( m_BendingParameters ) );
+}
+void IFC4X3::IfcReinforcingMeshType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElementType::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReinforcingMeshType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcReinforcingElementType::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelAdheresToElement::readStepArguments( const std::vector<std::s
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedSurfaceFeatures, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAdheresToElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAdheresToElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedSurfaceFeatures, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAdheresToElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAdheresToElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDecomposes::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelAdheresToElement::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcRelDecomposes::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAdheresToElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingElement", m_RelatingElement );
+	visitor.visitList( 5, "RelatedSurfaceFeatures", AttributeVectorView<IfcSurfaceFeature>( m_RelatedSurfaceFeatures ) );
+}
+void IFC4X3::IfcRelAdheresToElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAdheresToElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDecomposes::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelAdheresToElement::setInverseCounterparts( shared_ptr<Building
 		m_RelatingElement->m_HasSurfaceFeatures_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAdheresToElement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDecomposes::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedSurfaceFeatures.size(); ++i )
+	{
+		if( m_RelatedSurfaceFeatures[i] )
+		{
+			refs.emplace_back( m_RelatedSurfaceFeatures[i].get(), INVERSE_AdheresToElement );
+		}
+	}
+	if( m_RelatingElement )
+	{
+		refs.emplace_back( m_RelatingElement.get(), INVERSE_HasSurfaceFeatures );
+	}
+}
 void IFC4X3::IfcRelAdheresToElement::unlinkFromInverseCounterparts()
 {
 	IfcRelDecomposes::unlinkFromInverseCounterparts();
@@ -112,3 +149,18 @@ void IFC4X3::IfcRelAdheresToElement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAdheresToElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDecomposes::getEntityReferences( refs );
+	if( m_RelatingElement )
+	{
+		refs.push_back( m_RelatingElement.get() );
+	}
+	for( size_t i=0; i<m_RelatedSurfaceFeatures.size(); ++i )
+	{
+		if( m_RelatedSurfaceFeatures[i] )
+		{
+			refs.push_back( m_RelatedSurfaceFeatures[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcObjectDefinition.h"
@@ -41,6 +42,17 @@ void IFC4X3::IfcRelAggregates::readStepArguments( const std::vector<std::string>
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedObjects, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAggregates, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAggregates::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingObject, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAggregates, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAggregates::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDecomposes::getAttributes( vec_attributes );
@@ -53,6 +65,16 @@ void IFC4X3::IfcRelAggregates::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcRelDecomposes::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAggregates::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingObject", m_RelatingObject );
+	visitor.visitList( 5, "RelatedObjects", AttributeVectorView<IfcObjectDefinition>( m_RelatedObjects ) );
+}
+void IFC4X3::IfcRelAggregates::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAggregates::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDecomposes::setInverseCounterparts( ptr_self_entity );
@@ -70,6 +92,21 @@ void IFC4X3::IfcRelAggregates::setInverseCounterparts( shared_ptr<BuildingEntity
 		m_RelatingObject->m_IsDecomposedBy_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAggregates::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDecomposes::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.emplace_back( m_RelatedObjects[i].get(), INVERSE_Decomposes );
+		}
+	}
+	if( m_RelatingObject )
+	{
+		refs.emplace_back( m_RelatingObject.get(), INVERSE_IsDecomposedBy );
+	}
+}
 void IFC4X3::IfcRelAggregates::unlinkFromInverseCounterparts()
 {
 	IfcRelDecomposes::unlinkFromInverseCounterparts();
@@ -121,3 +158,18 @@ void IFC4X3::IfcRelAggregates::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAggregates::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDecomposes::getEntityReferences( refs );
+	if( m_RelatingObject )
+	{
+		refs.push_back( m_RelatingObject.get() );
+	}
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.push_back( m_RelatedObjects[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcObjectDefinition.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelAssigns::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssigns, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssigns::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssigns, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssigns::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelationship::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelAssigns::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssigns::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedObjects", AttributeVectorView<IfcObjectDefinition>( m_RelatedObjects ) );
+	visitor.visitObject( 5, "RelatedObjectsType", m_RelatedObjectsType );
+}
+void IFC4X3::IfcRelAssigns::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssigns::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelationship::setInverseCounterparts( ptr_self_entity );
@@ -67,6 +89,17 @@ void IFC4X3::IfcRelAssigns::setInverseCounterparts( shared_ptr<BuildingEntity> p
 		}
 	}
 }
+void IFC4X3::IfcRelAssigns::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.emplace_back( m_RelatedObjects[i].get(), INVERSE_HasAssignments );
+		}
+	}
+}
 void IFC4X3::IfcRelAssigns::unlinkFromInverseCounterparts()
 {
 	IfcRelationship::unlinkFromInverseCounterparts();
@@ -96,3 +129,14 @@ void IFC4X3::IfcRelAssigns::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssigns::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelationship::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.push_back( m_RelatedObjects[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcActor.h"
 #include "ifcpp/IFC4X3/include/IfcActorRole.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -50,6 +51,19 @@ void IFC4X3::IfcRelAssignsToActor::readStepArguments( const std::vector<std::str
 	if( num_args > 7 ){readEntityReference( args[7], m_ActingRole, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToActor, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssignsToActor::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatingActor, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_ActingRole, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToActor, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssignsToActor::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssigns::getAttributes( vec_attributes );
@@ -60,6 +74,16 @@ void IFC4X3::IfcRelAssignsToActor::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcRelAssigns::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssignsToActor::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributes( visitor );
+	visitor.visitObject( 6, "RelatingActor", m_RelatingActor );
+	visitor.visitObject( 7, "ActingRole", m_ActingRole );
+}
+void IFC4X3::IfcRelAssignsToActor::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssignsToActor::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssigns::setInverseCounterparts( ptr_self_entity );
@@ -70,6 +94,14 @@ void IFC4X3::IfcRelAssignsToActor::setInverseCounterparts( shared_ptr<BuildingEn
 		m_RelatingActor->m_IsActingUpon_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssignsToActor::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssigns::getInverseReferences( refs );
+	if( m_RelatingActor )
+	{
+		refs.emplace_back( m_RelatingActor.get(), INVERSE_IsActingUpon );
+	}
+}
 void IFC4X3::IfcRelAssignsToActor::unlinkFromInverseCounterparts()
 {
 	IfcRelAssigns::unlinkFromInverseCounterparts();
@@ -96,3 +128,15 @@ void IFC4X3::IfcRelAssignsToActor::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssignsToActor::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssigns::getEntityReferences( refs );
+	if( m_RelatingActor )
+	{
+		refs.push_back( m_RelatingActor.get() );
+	}
+	if( m_ActingRole )
+	{
+		refs.push_back( m_ActingRole.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcControl.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -46,6 +47,18 @@ void IFC4X3::IfcRelAssignsToControl::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){readEntityReference( args[6], m_RelatingControl, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToControl, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssignsToControl::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatingControl, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToControl, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssignsToControl::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssigns::getAttributes( vec_attributes );
@@ -55,6 +68,15 @@ void IFC4X3::IfcRelAssignsToControl::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcRelAssigns::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssignsToControl::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributes( visitor );
+	visitor.visitObject( 6, "RelatingControl", m_RelatingControl );
+}
+void IFC4X3::IfcRelAssignsToControl::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssignsToControl::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssigns::setInverseCounterparts( ptr_self_entity );
@@ -65,6 +87,14 @@ void IFC4X3::IfcRelAssignsToControl::setInverseCounterparts( shared_ptr<Building
 		m_RelatingControl->m_Controls_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssignsToControl::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssigns::getInverseReferences( refs );
+	if( m_RelatingControl )
+	{
+		refs.emplace_back( m_RelatingControl.get(), INVERSE_Controls );
+	}
+}
 void IFC4X3::IfcRelAssignsToControl::unlinkFromInverseCounterparts()
 {
 	IfcRelAssigns::unlinkFromInverseCounterparts();
@@ -91,3 +121,11 @@ void IFC4X3::IfcRelAssignsToControl::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssignsToControl::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssigns::getEntityReferences( refs );
+	if( m_RelatingControl )
+	{
+		refs.push_back( m_RelatingControl.get() );
+	}
+}
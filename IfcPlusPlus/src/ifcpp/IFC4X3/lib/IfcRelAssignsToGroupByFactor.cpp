@@ -50,6 +50,19 @@ void IFC4X3::IfcRelAssignsToGroupByFactor::readStepArguments( const std::vector<
 	if( num_args > 7 ){m_Factor = IfcRatioMeasure::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToGroupByFactor, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssignsToGroupByFactor::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatingGroup, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Factor = IfcRatioMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToGroupByFactor, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssignsToGroupByFactor::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssignsToGroup::getAttributes( vec_attributes );
@@ -59,6 +72,15 @@ void IFC4X3::IfcRelAssignsToGroupByFactor::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcRelAssignsToGroup::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssignsToGroupByFactor::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssignsToGroup::visitAttributes( visitor );
+	visitor.visitObject( 7, "Factor", m_Factor );
+}
+void IFC4X3::IfcRelAssignsToGroupByFactor::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssignsToGroup::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssignsToGroupByFactor::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssignsToGroup::setInverseCounterparts( ptr_self_entity );
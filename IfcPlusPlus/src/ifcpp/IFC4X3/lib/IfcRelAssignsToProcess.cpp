@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcMeasureWithUnit.h"
@@ -52,6 +53,19 @@ void IFC4X3::IfcRelAssignsToProcess::readStepArguments( const std::vector<std::s
 	if( num_args > 7 ){readEntityReference( args[7], m_QuantityInProcess, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToProcess, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssignsToProcess::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RelatingProcess = IfcProcessSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_QuantityInProcess, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToProcess, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssignsToProcess::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssigns::getAttributes( vec_attributes );
@@ -62,6 +76,16 @@ void IFC4X3::IfcRelAssignsToProcess::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcRelAssigns::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssignsToProcess::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributes( visitor );
+	visitor.visitObject( 6, "RelatingProcess", m_RelatingProcess );
+	visitor.visitObject( 7, "QuantityInProcess", m_QuantityInProcess );
+}
+void IFC4X3::IfcRelAssignsToProcess::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssignsToProcess::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssigns::setInverseCounterparts( ptr_self_entity );
@@ -78,6 +102,20 @@ void IFC4X3::IfcRelAssignsToProcess::setInverseCounterparts( shared_ptr<Building
 		RelatingProcess_IfcTypeProcess->m_OperatesOn_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssignsToProcess::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssigns::getInverseReferences( refs );
+	shared_ptr<IfcProcess>  RelatingProcess_IfcProcess = dynamic_pointer_cast<IfcProcess>( m_RelatingProcess );
+	if( RelatingProcess_IfcProcess )
+	{
+		refs.emplace_back( RelatingProcess_IfcProcess.get(), INVERSE_OperatesOn );
+	}
+	shared_ptr<IfcTypeProcess>  RelatingProcess_IfcTypeProcess = dynamic_pointer_cast<IfcTypeProcess>( m_RelatingProcess );
+	if( RelatingProcess_IfcTypeProcess )
+	{
+		refs.emplace_back( RelatingProcess_IfcTypeProcess.get(), INVERSE_OperatesOn );
+	}
+}
 void IFC4X3::IfcRelAssignsToProcess::unlinkFromInverseCounterparts()
 {
 	IfcRelAssigns::unlinkFromInverseCounterparts();
@@ -128,3 +166,16 @@ void IFC4X3::IfcRelAssignsToProcess::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssignsToProcess::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssigns::getEntityReferences( refs );
+	BuildingEntity* RelatingProcess_entity = dynamic_cast<BuildingEntity*>( m_RelatingProcess.get() );
+	if( RelatingProcess_entity )
+	{
+		refs.push_back( RelatingProcess_entity );
+	}
+	if( m_QuantityInProcess )
+	{
+		refs.push_back( m_QuantityInProcess.get() );
+	}
+}
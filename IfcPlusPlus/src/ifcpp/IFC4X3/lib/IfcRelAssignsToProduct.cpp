@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcObjectDefinition.h"
@@ -48,6 +49,18 @@ void IFC4X3::IfcRelAssignsToProduct::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){m_RelatingProduct = IfcProductSelect::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToProduct, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssignsToProduct::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedObjectsType = IfcStrippedOptional::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RelatingProduct = IfcProductSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssignsToProduct, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssignsToProduct::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssigns::getAttributes( vec_attributes );
@@ -57,6 +70,15 @@ void IFC4X3::IfcRelAssignsToProduct::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcRelAssigns::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssignsToProduct::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributes( visitor );
+	visitor.visitObject( 6, "RelatingProduct", m_RelatingProduct );
+}
+void IFC4X3::IfcRelAssignsToProduct::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssigns::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssignsToProduct::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssigns::setInverseCounterparts( ptr_self_entity );
@@ -73,6 +95,20 @@ void IFC4X3::IfcRelAssignsToProduct::setInverseCounterparts( shared_ptr<Building
 		RelatingProduct_IfcTypeProduct->m_ReferencedBy_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssignsToProduct::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssigns::getInverseReferences( refs );
+	shared_ptr<IfcProduct>  RelatingProduct_IfcProduct = dynamic_pointer_cast<IfcProduct>( m_RelatingProduct );
+	if( RelatingProduct_IfcProduct )
+	{
+		refs.emplace_back( RelatingProduct_IfcProduct.get(), INVERSE_ReferencedBy );
+	}
+	shared_ptr<IfcTypeProduct>  RelatingProduct_IfcTypeProduct = dynamic_pointer_cast<IfcTypeProduct>( m_RelatingProduct );
+	if( RelatingProduct_IfcTypeProduct )
+	{
+		refs.emplace_back( RelatingProduct_IfcTypeProduct.get(), INVERSE_ReferencedBy );
+	}
+}
 void IFC4X3::IfcRelAssignsToProduct::unlinkFromInverseCounterparts()
 {
 	IfcRelAssigns::unlinkFromInverseCounterparts();
@@ -123,3 +159,12 @@ void IFC4X3::IfcRelAssignsToProduct::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssignsToProduct::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssigns::getEntityReferences( refs );
+	BuildingEntity* RelatingProduct_entity = dynamic_cast<BuildingEntity*>( m_RelatingProduct.get() );
+	if( RelatingProduct_entity )
+	{
+		refs.push_back( RelatingProduct_entity );
+	}
+}
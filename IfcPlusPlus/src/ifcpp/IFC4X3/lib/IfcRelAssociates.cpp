@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -57,6 +58,16 @@ void IFC4X3::IfcRelAssociates::readStepArguments( const std::vector<std::string>
 	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcRelAssociates, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociates::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcRelAssociates, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociates::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelationship::getAttributes( vec_attributes );
@@ -68,6 +79,15 @@ void IFC4X3::IfcRelAssociates::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociates::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedObjects", AttributeVectorView<IfcDefinitionSelect>( m_RelatedObjects ) );
+}
+void IFC4X3::IfcRelAssociates::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociates::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelationship::setInverseCounterparts( ptr_self_entity );
@@ -87,6 +107,23 @@ void IFC4X3::IfcRelAssociates::setInverseCounterparts( shared_ptr<BuildingEntity
 		}
 	}
 }
+void IFC4X3::IfcRelAssociates::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		shared_ptr<IfcObjectDefinition>  RelatedObjects_IfcObjectDefinition = dynamic_pointer_cast<IfcObjectDefinition>( m_RelatedObjects[i] );
+		if( RelatedObjects_IfcObjectDefinition )
+		{
+			refs.emplace_back( RelatedObjects_IfcObjectDefinition.get(), INVERSE_HasAssociations );
+		}
+		shared_ptr<IfcPropertyDefinition>  RelatedObjects_IfcPropertyDefinition = dynamic_pointer_cast<IfcPropertyDefinition>( m_RelatedObjects[i] );
+		if( RelatedObjects_IfcPropertyDefinition )
+		{
+			refs.emplace_back( RelatedObjects_IfcPropertyDefinition.get(), INVERSE_HasAssociations );
+		}
+	}
+}
 void IFC4X3::IfcRelAssociates::unlinkFromInverseCounterparts()
 {
 	IfcRelationship::unlinkFromInverseCounterparts();
@@ -140,3 +177,15 @@ void IFC4X3::IfcRelAssociates::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociates::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelationship::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		BuildingEntity* RelatedObjects_entity = dynamic_cast<BuildingEntity*>( m_RelatedObjects[i].get() );
+		if( RelatedObjects_entity )
+		{
+			refs.push_back( RelatedObjects_entity );
+		}
+	}
+}
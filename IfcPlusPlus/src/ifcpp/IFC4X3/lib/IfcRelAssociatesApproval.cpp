@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcApproval.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -59,6 +60,17 @@ void IFC4X3::IfcRelAssociatesApproval::readStepArguments( const std::vector<std:
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatingApproval, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesApproval, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesApproval::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingApproval, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesApproval, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesApproval::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -68,6 +80,15 @@ void IFC4X3::IfcRelAssociatesApproval::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesApproval::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "RelatingApproval", m_RelatingApproval );
+}
+void IFC4X3::IfcRelAssociatesApproval::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesApproval::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -78,6 +99,14 @@ void IFC4X3::IfcRelAssociatesApproval::setInverseCounterparts( shared_ptr<Buildi
 		m_RelatingApproval->m_ApprovedObjects_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssociatesApproval::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssociates::getInverseReferences( refs );
+	if( m_RelatingApproval )
+	{
+		refs.emplace_back( m_RelatingApproval.get(), INVERSE_ApprovedObjects );
+	}
+}
 void IFC4X3::IfcRelAssociatesApproval::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
@@ -104,3 +133,11 @@ void IFC4X3::IfcRelAssociatesApproval::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociatesApproval::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	if( m_RelatingApproval )
+	{
+		refs.push_back( m_RelatingApproval.get() );
+	}
+}
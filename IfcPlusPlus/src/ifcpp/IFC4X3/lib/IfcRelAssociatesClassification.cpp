@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcClassification.h"
 #include "ifcpp/IFC4X3/include/IfcClassificationReference.h"
 #include "ifcpp/IFC4X3/include/IfcClassificationSelect.h"
@@ -61,6 +62,17 @@ void IFC4X3::IfcRelAssociatesClassification::readStepArguments( const std::vecto
 	if( num_args > 5 ){m_RelatingClassification = IfcClassificationSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesClassification, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesClassification::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatingClassification = IfcClassificationSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesClassification, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesClassification::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -70,6 +82,15 @@ void IFC4X3::IfcRelAssociatesClassification::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesClassification::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "RelatingClassification", m_RelatingClassification );
+}
+void IFC4X3::IfcRelAssociatesClassification::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesClassification::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -86,6 +107,20 @@ void IFC4X3::IfcRelAssociatesClassification::setInverseCounterparts( shared_ptr<
 		RelatingClassification_IfcClassificationReference->m_ClassificationRefForObjects_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssociatesClassification::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssociates::getInverseReferences( refs );
+	shared_ptr<IfcClassification>  RelatingClassification_IfcClassification = dynamic_pointer_cast<IfcClassification>( m_RelatingClassification );
+	if( RelatingClassification_IfcClassification )
+	{
+		refs.emplace_back( RelatingClassification_IfcClassification.get(), INVERSE_ClassificationForObjects );
+	}
+	shared_ptr<IfcClassificationReference>  RelatingClassification_IfcClassificationReference = dynamic_pointer_cast<IfcClassificationReference>( m_RelatingClassification );
+	if( RelatingClassification_IfcClassificationReference )
+	{
+		refs.emplace_back( RelatingClassification_IfcClassificationReference.get(), INVERSE_ClassificationRefForObjects );
+	}
+}
 void IFC4X3::IfcRelAssociatesClassification::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
@@ -136,3 +171,12 @@ void IFC4X3::IfcRelAssociatesClassification::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociatesClassification::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	BuildingEntity* RelatingClassification_entity = dynamic_cast<BuildingEntity*>( m_RelatingClassification.get() );
+	if( RelatingClassification_entity )
+	{
+		refs.push_back( RelatingClassification_entity );
+	}
+}
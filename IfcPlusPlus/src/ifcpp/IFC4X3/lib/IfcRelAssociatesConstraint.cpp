@@ -62,6 +62,18 @@ void IFC4X3::IfcRelAssociatesConstraint::readStepArguments( const std::vector<st
 	if( num_args > 6 ){readEntityReference( args[6], m_RelatingConstraint, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesConstraint, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesConstraint::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Intent = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatingConstraint, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesConstraint, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesConstraint::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -72,6 +84,16 @@ void IFC4X3::IfcRelAssociatesConstraint::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesConstraint::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "Intent", m_Intent );
+	visitor.visitObject( 6, "RelatingConstraint", m_RelatingConstraint );
+}
+void IFC4X3::IfcRelAssociatesConstraint::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesConstraint::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -80,3 +102,11 @@ void IFC4X3::IfcRelAssociatesConstraint::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcRelAssociatesConstraint::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	if( m_RelatingConstraint )
+	{
+		refs.push_back( m_RelatingConstraint.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentInformation.h"
 #include "ifcpp/IFC4X3/include/IfcDocumentReference.h"
@@ -61,6 +62,17 @@ void IFC4X3::IfcRelAssociatesDocument::readStepArguments( const std::vector<std:
 	if( num_args > 5 ){m_RelatingDocument = IfcDocumentSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesDocument, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesDocument::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatingDocument = IfcDocumentSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesDocument, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesDocument::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -70,6 +82,15 @@ void IFC4X3::IfcRelAssociatesDocument::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesDocument::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "RelatingDocument", m_RelatingDocument );
+}
+void IFC4X3::IfcRelAssociatesDocument::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesDocument::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -86,6 +107,20 @@ void IFC4X3::IfcRelAssociatesDocument::setInverseCounterparts( shared_ptr<Buildi
 		RelatingDocument_IfcDocumentReference->m_DocumentRefForObjects_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssociatesDocument::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssociates::getInverseReferences( refs );
+	shared_ptr<IfcDocumentInformation>  RelatingDocument_IfcDocumentInformation = dynamic_pointer_cast<IfcDocumentInformation>( m_RelatingDocument );
+	if( RelatingDocument_IfcDocumentInformation )
+	{
+		refs.emplace_back( RelatingDocument_IfcDocumentInformation.get(), INVERSE_DocumentInfoForObjects );
+	}
+	shared_ptr<IfcDocumentReference>  RelatingDocument_IfcDocumentReference = dynamic_pointer_cast<IfcDocumentReference>( m_RelatingDocument );
+	if( RelatingDocument_IfcDocumentReference )
+	{
+		refs.emplace_back( RelatingDocument_IfcDocumentReference.get(), INVERSE_DocumentRefForObjects );
+	}
+}
 void IFC4X3::IfcRelAssociatesDocument::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
@@ -136,3 +171,12 @@ void IFC4X3::IfcRelAssociatesDocument::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociatesDocument::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	BuildingEntity* RelatingDocument_entity = dynamic_cast<BuildingEntity*>( m_RelatingDocument.get() );
+	if( RelatingDocument_entity )
+	{
+		refs.push_back( RelatingDocument_entity );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -61,6 +62,17 @@ void IFC4X3::IfcRelAssociatesLibrary::readStepArguments( const std::vector<std::
 	if( num_args > 5 ){m_RelatingLibrary = IfcLibrarySelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesLibrary, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesLibrary::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatingLibrary = IfcLibrarySelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesLibrary, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesLibrary::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -70,6 +82,15 @@ void IFC4X3::IfcRelAssociatesLibrary::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesLibrary::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "RelatingLibrary", m_RelatingLibrary );
+}
+void IFC4X3::IfcRelAssociatesLibrary::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesLibrary::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -86,6 +107,20 @@ void IFC4X3::IfcRelAssociatesLibrary::setInverseCounterparts( shared_ptr<Buildin
 		RelatingLibrary_IfcLibraryReference->m_LibraryRefForObjects_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssociatesLibrary::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssociates::getInverseReferences( refs );
+	shared_ptr<IfcLibraryInformation>  RelatingLibrary_IfcLibraryInformation = dynamic_pointer_cast<IfcLibraryInformation>( m_RelatingLibrary );
+	if( RelatingLibrary_IfcLibraryInformation )
+	{
+		refs.emplace_back( RelatingLibrary_IfcLibraryInformation.get(), INVERSE_LibraryInfoForObjects );
+	}
+	shared_ptr<IfcLibraryReference>  RelatingLibrary_IfcLibraryReference = dynamic_pointer_cast<IfcLibraryReference>( m_RelatingLibrary );
+	if( RelatingLibrary_IfcLibraryReference )
+	{
+		refs.emplace_back( RelatingLibrary_IfcLibraryReference.get(), INVERSE_LibraryRefForObjects );
+	}
+}
 void IFC4X3::IfcRelAssociatesLibrary::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
@@ -136,3 +171,12 @@ void IFC4X3::IfcRelAssociatesLibrary::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociatesLibrary::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	BuildingEntity* RelatingLibrary_entity = dynamic_cast<BuildingEntity*>( m_RelatingLibrary.get() );
+	if( RelatingLibrary_entity )
+	{
+		refs.push_back( RelatingLibrary_entity );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -61,6 +62,17 @@ void IFC4X3::IfcRelAssociatesMaterial::readStepArguments( const std::vector<std:
 	if( num_args > 5 ){m_RelatingMaterial = IfcMaterialSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesMaterial, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelAssociatesMaterial::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedObjects, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatingMaterial = IfcMaterialSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelAssociatesMaterial, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelAssociatesMaterial::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelAssociates::getAttributes( vec_attributes );
@@ -70,6 +82,15 @@ void IFC4X3::IfcRelAssociatesMaterial::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcRelAssociates::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelAssociatesMaterial::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributes( visitor );
+	visitor.visitObject( 5, "RelatingMaterial", m_RelatingMaterial );
+}
+void IFC4X3::IfcRelAssociatesMaterial::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelAssociates::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelAssociatesMaterial::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelAssociates::setInverseCounterparts( ptr_self_entity );
@@ -86,6 +107,20 @@ void IFC4X3::IfcRelAssociatesMaterial::setInverseCounterparts( shared_ptr<Buildi
 		RelatingMaterial_IfcMaterialUsageDefinition->m_AssociatedTo_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelAssociatesMaterial::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelAssociates::getInverseReferences( refs );
+	shared_ptr<IfcMaterialDefinition>  RelatingMaterial_IfcMaterialDefinition = dynamic_pointer_cast<IfcMaterialDefinition>( m_RelatingMaterial );
+	if( RelatingMaterial_IfcMaterialDefinition )
+	{
+		refs.emplace_back( RelatingMaterial_IfcMaterialDefinition.get(), INVERSE_AssociatedTo );
+	}
+	shared_ptr<IfcMaterialUsageDefinition>  RelatingMaterial_IfcMaterialUsageDefinition = dynamic_pointer_cast<IfcMaterialUsageDefinition>( m_RelatingMaterial );
+	if( RelatingMaterial_IfcMaterialUsageDefinition )
+	{
+		refs.emplace_back( RelatingMaterial_IfcMaterialUsageDefinition.get(), INVERSE_AssociatedTo );
+	}
+}
 void IFC4X3::IfcRelAssociatesMaterial::unlinkFromInverseCounterparts()
 {
 	IfcRelAssociates::unlinkFromInverseCounterparts();
@@ -136,3 +171,12 @@ void IFC4X3::IfcRelAssociatesMaterial::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelAssociatesMaterial::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelAssociates::getEntityReferences( refs );
+	BuildingEntity* RelatingMaterial_entity = dynamic_cast<BuildingEntity*>( m_RelatingMaterial.get() );
+	if( RelatingMaterial_entity )
+	{
+		refs.push_back( RelatingMaterial_entity );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -45,6 +46,18 @@ void IFC4X3::IfcRelConnectsElements::readStepArguments( const std::vector<std::s
 	if( num_args > 6 ){readEntityReference( args[6], m_RelatedElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsElements, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatedElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsElements, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -56,6 +69,17 @@ void IFC4X3::IfcRelConnectsElements::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "ConnectionGeometry", m_ConnectionGeometry );
+	visitor.visitObject( 5, "RelatingElement", m_RelatingElement );
+	visitor.visitObject( 6, "RelatedElement", m_RelatedElement );
+}
+void IFC4X3::IfcRelConnectsElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -70,6 +94,18 @@ void IFC4X3::IfcRelConnectsElements::setInverseCounterparts( shared_ptr<Building
 		m_RelatingElement->m_ConnectedTo_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelConnectsElements::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedElement )
+	{
+		refs.emplace_back( m_RelatedElement.get(), INVERSE_ConnectedFrom );
+	}
+	if( m_RelatingElement )
+	{
+		refs.emplace_back( m_RelatingElement.get(), INVERSE_ConnectedTo );
+	}
+}
 void IFC4X3::IfcRelConnectsElements::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -118,3 +154,19 @@ void IFC4X3::IfcRelConnectsElements::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsElements::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_ConnectionGeometry )
+	{
+		refs.push_back( m_ConnectionGeometry.get() );
+	}
+	if( m_RelatingElement )
+	{
+		refs.push_back( m_RelatingElement.get() );
+	}
+	if( m_RelatedElement )
+	{
+		refs.push_back( m_RelatedElement.get() );
+	}
+}
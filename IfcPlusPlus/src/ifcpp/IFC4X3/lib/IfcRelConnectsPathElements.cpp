@@ -59,6 +59,22 @@ void IFC4X3::IfcRelConnectsPathElements::readStepArguments( const std::vector<st
 	if( num_args > 10 ){m_RelatingConnectionType = IfcConnectionTypeEnum::createObjectFromSTEP( args[10], map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPathElements, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsPathElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatedElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readTypeOfIntegerList( args[7], m_RelatingPriorities );}
+	if( num_args > 8 ){readTypeOfIntegerList( args[8], m_RelatedPriorities );}
+	if( num_args > 9 ){m_RelatedConnectionType = IfcConnectionTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_RelatingConnectionType = IfcConnectionTypeEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPathElements, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsPathElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnectsElements::getAttributes( vec_attributes );
@@ -75,6 +91,18 @@ void IFC4X3::IfcRelConnectsPathElements::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcRelConnectsElements::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsPathElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsElements::visitAttributes( visitor );
+	visitor.visitList( 7, "RelatingPriorities", AttributeVectorView<IfcInteger>( m_RelatingPriorities ) );
+	visitor.visitList( 8, "RelatedPriorities", AttributeVectorView<IfcInteger>( m_RelatedPriorities ) );
+	visitor.visitObject( 9, "RelatedConnectionType", m_RelatedConnectionType );
+	visitor.visitObject( 10, "RelatingConnectionType", m_RelatingConnectionType );
+}
+void IFC4X3::IfcRelConnectsPathElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsElements::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsPathElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnectsElements::setInverseCounterparts( ptr_self_entity );
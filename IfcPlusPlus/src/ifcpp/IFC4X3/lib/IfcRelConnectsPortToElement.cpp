@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDistributionElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelConnectsPortToElement::readStepArguments( const std::vector<s
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatedElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPortToElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsPortToElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingPort, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPortToElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsPortToElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -52,6 +64,16 @@ void IFC4X3::IfcRelConnectsPortToElement::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsPortToElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingPort", m_RelatingPort );
+	visitor.visitObject( 5, "RelatedElement", m_RelatedElement );
+}
+void IFC4X3::IfcRelConnectsPortToElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsPortToElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,18 @@ void IFC4X3::IfcRelConnectsPortToElement::setInverseCounterparts( shared_ptr<Bui
 		m_RelatingPort->m_ContainedIn_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelConnectsPortToElement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedElement )
+	{
+		refs.emplace_back( m_RelatedElement.get(), INVERSE_HasPorts );
+	}
+	if( m_RelatingPort )
+	{
+		refs.emplace_back( m_RelatingPort.get(), INVERSE_ContainedIn );
+	}
+}
 void IFC4X3::IfcRelConnectsPortToElement::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -114,3 +148,15 @@ void IFC4X3::IfcRelConnectsPortToElement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsPortToElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingPort )
+	{
+		refs.push_back( m_RelatingPort.get() );
+	}
+	if( m_RelatedElement )
+	{
+		refs.push_back( m_RelatedElement.get() );
+	}
+}
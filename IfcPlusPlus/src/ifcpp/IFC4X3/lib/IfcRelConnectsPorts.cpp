@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -45,6 +46,18 @@ void IFC4X3::IfcRelConnectsPorts::readStepArguments( const std::vector<std::stri
 	if( num_args > 6 ){readEntityReference( args[6], m_RealizingElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPorts, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsPorts::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingPort, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedPort, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RealizingElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsPorts, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsPorts::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -56,6 +69,17 @@ void IFC4X3::IfcRelConnectsPorts::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsPorts::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingPort", m_RelatingPort );
+	visitor.visitObject( 5, "RelatedPort", m_RelatedPort );
+	visitor.visitObject( 6, "RealizingElement", m_RealizingElement );
+}
+void IFC4X3::IfcRelConnectsPorts::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsPorts::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -70,6 +94,18 @@ void IFC4X3::IfcRelConnectsPorts::setInverseCounterparts( shared_ptr<BuildingEnt
 		m_RelatingPort->m_ConnectedTo_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelConnectsPorts::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedPort )
+	{
+		refs.emplace_back( m_RelatedPort.get(), INVERSE_ConnectedFrom );
+	}
+	if( m_RelatingPort )
+	{
+		refs.emplace_back( m_RelatingPort.get(), INVERSE_ConnectedTo );
+	}
+}
 void IFC4X3::IfcRelConnectsPorts::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -118,3 +154,19 @@ void IFC4X3::IfcRelConnectsPorts::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsPorts::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingPort )
+	{
+		refs.push_back( m_RelatingPort.get() );
+	}
+	if( m_RelatedPort )
+	{
+		refs.push_back( m_RelatedPort.get() );
+	}
+	if( m_RealizingElement )
+	{
+		refs.push_back( m_RealizingElement.get() );
+	}
+}
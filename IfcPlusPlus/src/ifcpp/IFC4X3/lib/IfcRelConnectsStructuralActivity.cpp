@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcOwnerHistory.h"
@@ -43,6 +44,17 @@ void IFC4X3::IfcRelConnectsStructuralActivity::readStepArguments( const std::vec
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatedStructuralActivity, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsStructuralActivity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsStructuralActivity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelatingElement = IfcStructuralActivityAssignmentSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedStructuralActivity, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsStructuralActivity, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsStructuralActivity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -53,6 +65,16 @@ void IFC4X3::IfcRelConnectsStructuralActivity::getAttributesInverse( std::vector
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsStructuralActivity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingElement", m_RelatingElement );
+	visitor.visitObject( 5, "RelatedStructuralActivity", m_RelatedStructuralActivity );
+}
+void IFC4X3::IfcRelConnectsStructuralActivity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsStructuralActivity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -68,6 +90,19 @@ void IFC4X3::IfcRelConnectsStructuralActivity::setInverseCounterparts( shared_pt
 		RelatingElement_IfcStructuralItem->m_AssignedStructuralActivity_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelConnectsStructuralActivity::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedStructuralActivity )
+	{
+		refs.emplace_back( m_RelatedStructuralActivity.get(), INVERSE_AssignedToStructuralItem );
+	}
+	shared_ptr<IfcStructuralItem>  RelatingElement_IfcStructuralItem = dynamic_pointer_cast<IfcStructuralItem>( m_RelatingElement );
+	if( RelatingElement_IfcStructuralItem )
+	{
+		refs.emplace_back( RelatingElement_IfcStructuralItem.get(), INVERSE_AssignedStructuralActivity );
+	}
+}
 void IFC4X3::IfcRelConnectsStructuralActivity::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -117,3 +152,16 @@ void IFC4X3::IfcRelConnectsStructuralActivity::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsStructuralActivity::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	BuildingEntity* RelatingElement_entity = dynamic_cast<BuildingEntity*>( m_RelatingElement.get() );
+	if( RelatingElement_entity )
+	{
+		refs.push_back( RelatingElement_entity );
+	}
+	if( m_RelatedStructuralActivity )
+	{
+		refs.push_back( m_RelatedStructuralActivity.get() );
+	}
+}
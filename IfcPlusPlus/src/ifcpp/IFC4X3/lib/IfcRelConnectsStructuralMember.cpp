@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAxis2Placement3D.h"
 #include "ifcpp/IFC4X3/include/IfcBoundaryCondition.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -58,6 +59,21 @@ void IFC4X3::IfcRelConnectsStructuralMember::readStepArguments( const std::vecto
 	if( num_args > 9 ){readEntityReference( args[9], m_ConditionCoordinateSystem, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsStructuralMember, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsStructuralMember::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingStructuralMember, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedStructuralConnection, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_AppliedCondition, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AdditionalConditions, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SupportedLength = IfcLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_ConditionCoordinateSystem, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsStructuralMember, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsStructuralMember::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -72,6 +88,20 @@ void IFC4X3::IfcRelConnectsStructuralMember::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsStructuralMember::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingStructuralMember", m_RelatingStructuralMember );
+	visitor.visitObject( 5, "RelatedStructuralConnection", m_RelatedStructuralConnection );
+	visitor.visitObject( 6, "AppliedCondition", m_AppliedCondition );
+	visitor.visitObject( 7, "AdditionalConditions", m_AdditionalConditions );
+	visitor.visitObject( 8, "SupportedLength", m_SupportedLength );
+	visitor.visitObject( 9, "ConditionCoordinateSystem", m_ConditionCoordinateSystem );
+}
+void IFC4X3::IfcRelConnectsStructuralMember::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsStructuralMember::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -86,6 +116,18 @@ void IFC4X3::IfcRelConnectsStructuralMember::setInverseCounterparts( shared_ptr<
 		m_RelatingStructuralMember->m_ConnectedBy_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelConnectsStructuralMember::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedStructuralConnection )
+	{
+		refs.emplace_back( m_RelatedStructuralConnection.get(), INVERSE_ConnectsStructuralMembers );
+	}
+	if( m_RelatingStructuralMember )
+	{
+		refs.emplace_back( m_RelatingStructuralMember.get(), INVERSE_ConnectedBy );
+	}
+}
 void IFC4X3::IfcRelConnectsStructuralMember::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -134,3 +176,27 @@ void IFC4X3::IfcRelConnectsStructuralMember::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsStructuralMember::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingStructuralMember )
+	{
+		refs.push_back( m_RelatingStructuralMember.get() );
+	}
+	if( m_RelatedStructuralConnection )
+	{
+		refs.push_back( m_RelatedStructuralConnection.get() );
+	}
+	if( m_AppliedCondition )
+	{
+		refs.push_back( m_AppliedCondition.get() );
+	}
+	if( m_AdditionalConditions )
+	{
+		refs.push_back( m_AdditionalConditions.get() );
+	}
+	if( m_ConditionCoordinateSystem )
+	{
+		refs.push_back( m_ConditionCoordinateSystem.get() );
+	}
+}
@@ -62,6 +62,22 @@ void IFC4X3::IfcRelConnectsWithEccentricity::readStepArguments( const std::vecto
 	if( num_args > 10 ){readEntityReference( args[10], m_ConnectionConstraint, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsWithEccentricity, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsWithEccentricity::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingStructuralMember, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedStructuralConnection, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_AppliedCondition, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AdditionalConditions, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SupportedLength = IfcLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_ConditionCoordinateSystem, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_ConnectionConstraint, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsWithEccentricity, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsWithEccentricity::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnectsStructuralMember::getAttributes( vec_attributes );
@@ -71,6 +87,15 @@ void IFC4X3::IfcRelConnectsWithEccentricity::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcRelConnectsStructuralMember::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsWithEccentricity::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsStructuralMember::visitAttributes( visitor );
+	visitor.visitObject( 10, "ConnectionConstraint", m_ConnectionConstraint );
+}
+void IFC4X3::IfcRelConnectsWithEccentricity::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsStructuralMember::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsWithEccentricity::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnectsStructuralMember::setInverseCounterparts( ptr_self_entity );
@@ -79,3 +104,11 @@ void IFC4X3::IfcRelConnectsWithEccentricity::unlinkFromInverseCounterparts()
 {
 	IfcRelConnectsStructuralMember::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcRelConnectsWithEccentricity::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnectsStructuralMember::getEntityReferences( refs );
+	if( m_ConnectionConstraint )
+	{
+		refs.push_back( m_ConnectionConstraint.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -51,6 +52,20 @@ void IFC4X3::IfcRelConnectsWithRealizingElements::readStepArguments( const std::
 	if( num_args > 8 ){m_ConnectionType = IfcLabel::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsWithRealizingElements, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelConnectsWithRealizingElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_RelatedElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_RealizingElements, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ConnectionType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelConnectsWithRealizingElements, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelConnectsWithRealizingElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnectsElements::getAttributes( vec_attributes );
@@ -63,6 +78,16 @@ void IFC4X3::IfcRelConnectsWithRealizingElements::getAttributesInverse( std::vec
 {
 	IFC4X3::IfcRelConnectsElements::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelConnectsWithRealizingElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsElements::visitAttributes( visitor );
+	visitor.visitList( 7, "RealizingElements", AttributeVectorView<IfcElement>( m_RealizingElements ) );
+	visitor.visitObject( 8, "ConnectionType", m_ConnectionType );
+}
+void IFC4X3::IfcRelConnectsWithRealizingElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnectsElements::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelConnectsWithRealizingElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnectsElements::setInverseCounterparts( ptr_self_entity );
@@ -76,6 +101,17 @@ void IFC4X3::IfcRelConnectsWithRealizingElements::setInverseCounterparts( shared
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsWithRealizingElements::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnectsElements::getInverseReferences( refs );
+	for( size_t i=0; i<m_RealizingElements.size(); ++i )
+	{
+		if( m_RealizingElements[i] )
+		{
+			refs.emplace_back( m_RealizingElements[i].get(), INVERSE_IsConnectionRealization );
+		}
+	}
+}
 void IFC4X3::IfcRelConnectsWithRealizingElements::unlinkFromInverseCounterparts()
 {
 	IfcRelConnectsElements::unlinkFromInverseCounterparts();
@@ -105,3 +141,14 @@ void IFC4X3::IfcRelConnectsWithRealizingElements::unlinkFromInverseCounterparts(
 		}
 	}
 }
+void IFC4X3::IfcRelConnectsWithRealizingElements::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnectsElements::getEntityReferences( refs );
+	for( size_t i=0; i<m_RealizingElements.size(); ++i )
+	{
+		if( m_RealizingElements[i] )
+		{
+			refs.push_back( m_RealizingElements[i].get() );
+		}
+	}
+}
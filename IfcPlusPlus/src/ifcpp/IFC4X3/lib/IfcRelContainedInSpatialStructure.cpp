@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAnnotation.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -45,6 +46,17 @@ void IFC4X3::IfcRelContainedInSpatialStructure::readStepArguments( const std::ve
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatingStructure, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelContainedInSpatialStructure, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelContainedInSpatialStructure::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedElements, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingStructure, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelContainedInSpatialStructure, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelContainedInSpatialStructure::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -57,6 +69,16 @@ void IFC4X3::IfcRelContainedInSpatialStructure::getAttributesInverse( std::vecto
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelContainedInSpatialStructure::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedElements", AttributeVectorView<IfcProduct>( m_RelatedElements ) );
+	visitor.visitObject( 5, "RelatingStructure", m_RelatingStructure );
+}
+void IFC4X3::IfcRelContainedInSpatialStructure::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelContainedInSpatialStructure::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -85,6 +107,32 @@ void IFC4X3::IfcRelContainedInSpatialStructure::setInverseCounterparts( shared_p
 		m_RelatingStructure->m_ContainsElements_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelContainedInSpatialStructure::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedElements.size(); ++i )
+	{
+		shared_ptr<IfcAnnotation>  RelatedElements_IfcAnnotation = dynamic_pointer_cast<IfcAnnotation>( m_RelatedElements[i] );
+		if( RelatedElements_IfcAnnotation )
+		{
+			refs.emplace_back( RelatedElements_IfcAnnotation.get(), INVERSE_ContainedInStructure );
+		}
+		shared_ptr<IfcElement>  RelatedElements_IfcElement = dynamic_pointer_cast<IfcElement>( m_RelatedElements[i] );
+		if( RelatedElements_IfcElement )
+		{
+			refs.emplace_back( RelatedElements_IfcElement.get(), INVERSE_ContainedInStructure );
+		}
+		shared_ptr<IfcPositioningElement>  RelatedElements_IfcPositioningElement = dynamic_pointer_cast<IfcPositioningElement>( m_RelatedElements[i] );
+		if( RelatedElements_IfcPositioningElement )
+		{
+			refs.emplace_back( RelatedElements_IfcPositioningElement.get(), INVERSE_ContainedInStructure );
+		}
+	}
+	if( m_RelatingStructure )
+	{
+		refs.emplace_back( m_RelatingStructure.get(), INVERSE_ContainsElements );
+	}
+}
 void IFC4X3::IfcRelContainedInSpatialStructure::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -183,3 +231,18 @@ void IFC4X3::IfcRelContainedInSpatialStructure::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelContainedInSpatialStructure::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedElements.size(); ++i )
+	{
+		if( m_RelatedElements[i] )
+		{
+			refs.push_back( m_RelatedElements[i].get() );
+		}
+	}
+	if( m_RelatingStructure )
+	{
+		refs.push_back( m_RelatingStructure.get() );
+	}
+}
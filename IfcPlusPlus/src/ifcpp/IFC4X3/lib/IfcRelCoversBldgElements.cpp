@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCovering.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelCoversBldgElements::readStepArguments( const std::vector<std:
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedCoverings, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelCoversBldgElements, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelCoversBldgElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedCoverings, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelCoversBldgElements, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelCoversBldgElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelCoversBldgElements::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelCoversBldgElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingBuildingElement", m_RelatingBuildingElement );
+	visitor.visitList( 5, "RelatedCoverings", AttributeVectorView<IfcCovering>( m_RelatedCoverings ) );
+}
+void IFC4X3::IfcRelCoversBldgElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelCoversBldgElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelCoversBldgElements::setInverseCounterparts( shared_ptr<Buildi
 		m_RelatingBuildingElement->m_HasCoverings_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelCoversBldgElements::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedCoverings.size(); ++i )
+	{
+		if( m_RelatedCoverings[i] )
+		{
+			refs.emplace_back( m_RelatedCoverings[i].get(), INVERSE_CoversElements );
+		}
+	}
+	if( m_RelatingBuildingElement )
+	{
+		refs.emplace_back( m_RelatingBuildingElement.get(), INVERSE_HasCoverings );
+	}
+}
 void IFC4X3::IfcRelCoversBldgElements::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -122,3 +159,18 @@ void IFC4X3::IfcRelCoversBldgElements::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelCoversBldgElements::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingBuildingElement )
+	{
+		refs.push_back( m_RelatingBuildingElement.get() );
+	}
+	for( size_t i=0; i<m_RelatedCoverings.size(); ++i )
+	{
+		if( m_RelatedCoverings[i] )
+		{
+			refs.push_back( m_RelatedCoverings[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCovering.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelCoversSpaces::readStepArguments( const std::vector<std::strin
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedCoverings, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelCoversSpaces, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelCoversSpaces::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingSpace, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedCoverings, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelCoversSpaces, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelCoversSpaces::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelCoversSpaces::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelCoversSpaces::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingSpace", m_RelatingSpace );
+	visitor.visitList( 5, "RelatedCoverings", AttributeVectorView<IfcCovering>( m_RelatedCoverings ) );
+}
+void IFC4X3::IfcRelCoversSpaces::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelCoversSpaces::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelCoversSpaces::setInverseCounterparts( shared_ptr<BuildingEnti
 		m_RelatingSpace->m_HasCoverings_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelCoversSpaces::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedCoverings.size(); ++i )
+	{
+		if( m_RelatedCoverings[i] )
+		{
+			refs.emplace_back( m_RelatedCoverings[i].get(), INVERSE_CoversSpaces );
+		}
+	}
+	if( m_RelatingSpace )
+	{
+		refs.emplace_back( m_RelatingSpace.get(), INVERSE_HasCoverings );
+	}
+}
 void IFC4X3::IfcRelCoversSpaces::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -122,3 +159,18 @@ void IFC4X3::IfcRelCoversSpaces::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelCoversSpaces::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingSpace )
+	{
+		refs.push_back( m_RelatingSpace.get() );
+	}
+	for( size_t i=0; i<m_RelatedCoverings.size(); ++i )
+	{
+		if( m_RelatedCoverings[i] )
+		{
+			refs.push_back( m_RelatedCoverings[i].get() );
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcContext.h"
 #include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -61,6 +62,17 @@ void IFC4X3::IfcRelDeclares::readStepArguments( const std::vector<std::string>&
 	if( num_args > 5 ){readSelectList( args[5], m_RelatedDefinitions, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDeclares, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelDeclares::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingContext, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readSelectList( args[5], m_RelatedDefinitions, "IFCDEFINITIONSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDeclares, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelDeclares::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelationship::getAttributes( vec_attributes );
@@ -73,6 +85,16 @@ void IFC4X3::IfcRelDeclares::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelDeclares::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingContext", m_RelatingContext );
+	visitor.visitList( 5, "RelatedDefinitions", AttributeVectorView<IfcDefinitionSelect>( m_RelatedDefinitions ) );
+}
+void IFC4X3::IfcRelDeclares::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelDeclares::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelationship::setInverseCounterparts( ptr_self_entity );
@@ -96,6 +118,27 @@ void IFC4X3::IfcRelDeclares::setInverseCounterparts( shared_ptr<BuildingEntity>
 		m_RelatingContext->m_Declares_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelDeclares::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedDefinitions.size(); ++i )
+	{
+		shared_ptr<IfcObjectDefinition>  RelatedDefinitions_IfcObjectDefinition = dynamic_pointer_cast<IfcObjectDefinition>( m_RelatedDefinitions[i] );
+		if( RelatedDefinitions_IfcObjectDefinition )
+		{
+			refs.emplace_back( RelatedDefinitions_IfcObjectDefinition.get(), INVERSE_HasContext );
+		}
+		shared_ptr<IfcPropertyDefinition>  RelatedDefinitions_IfcPropertyDefinition = dynamic_pointer_cast<IfcPropertyDefinition>( m_RelatedDefinitions[i] );
+		if( RelatedDefinitions_IfcPropertyDefinition )
+		{
+			refs.emplace_back( RelatedDefinitions_IfcPropertyDefinition.get(), INVERSE_HasContext );
+		}
+	}
+	if( m_RelatingContext )
+	{
+		refs.emplace_back( m_RelatingContext.get(), INVERSE_Declares );
+	}
+}
 void IFC4X3::IfcRelDeclares::unlinkFromInverseCounterparts()
 {
 	IfcRelationship::unlinkFromInverseCounterparts();
@@ -171,3 +214,19 @@ void IFC4X3::IfcRelDeclares::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelDeclares::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelationship::getEntityReferences( refs );
+	if( m_RelatingContext )
+	{
+		refs.push_back( m_RelatingContext.get() );
+	}
+	for( size_t i=0; i<m_RelatedDefinitions.size(); ++i )
+	{
+		BuildingEntity* RelatedDefinitions_entity = dynamic_cast<BuildingEntity*>( m_RelatedDefinitions[i].get() );
+		if( RelatedDefinitions_entity )
+		{
+			refs.push_back( RelatedDefinitions_entity );
+		}
+	}
+}
@@ -34,6 +34,15 @@ void IFC4X3::IfcRelDecomposes::readStepArguments( const std::vector<std::string>
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRelDecomposes, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelDecomposes::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRelDecomposes, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelDecomposes::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelationship::getAttributes( vec_attributes );
@@ -42,6 +51,14 @@ void IFC4X3::IfcRelDecomposes::getAttributesInverse( std::vector<std::pair<std::
 {
 	IFC4X3::IfcRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelDecomposes::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributes( visitor );
+}
+void IFC4X3::IfcRelDecomposes::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelDecomposes::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelationship::setInverseCounterparts( ptr_self_entity );
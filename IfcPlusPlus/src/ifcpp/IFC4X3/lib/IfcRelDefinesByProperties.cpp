@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcContext.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -12,6 +13,7 @@
 #include "ifcpp/IFC4X3/include/IfcOwnerHistory.h"
 #include "ifcpp/IFC4X3/include/IfcPropertySetDefinition.h"
 #include "ifcpp/IFC4X3/include/IfcPropertySetDefinitionSelect.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySetDefinitionSet.h"
 #include "ifcpp/IFC4X3/include/IfcRelDefinesByProperties.h"
 #include "ifcpp/IFC4X3/include/IfcText.h"
 
@@ -45,6 +47,17 @@ void IFC4X3::IfcRelDefinesByProperties::readStepArguments( const std::vector<std
 	if( num_args > 5 ){m_RelatingPropertyDefinition = IfcPropertySetDefinitionSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDefinesByProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelDefinesByProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatingPropertyDefinition = IfcPropertySetDefinitionSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDefinesByProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelDefinesByProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDefines::getAttributes( vec_attributes );
@@ -57,6 +70,16 @@ void IFC4X3::IfcRelDefinesByProperties::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcRelDefines::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelDefinesByProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDefines::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedObjects", AttributeVectorView<IfcObjectDefinition>( m_RelatedObjects ) );
+	visitor.visitObject( 5, "RelatingPropertyDefinition", m_RelatingPropertyDefinition );
+}
+void IFC4X3::IfcRelDefinesByProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDefines::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelDefinesByProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDefines::setInverseCounterparts( ptr_self_entity );
@@ -81,6 +104,28 @@ void IFC4X3::IfcRelDefinesByProperties::setInverseCounterparts( shared_ptr<Build
 		RelatingPropertyDefinition_IfcPropertySetDefinition->m_DefinesOccurrence_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelDefinesByProperties::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDefines::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		shared_ptr<IfcContext>  RelatedObjects_IfcContext = dynamic_pointer_cast<IfcContext>( m_RelatedObjects[i] );
+		if( RelatedObjects_IfcContext )
+		{
+			refs.emplace_back( RelatedObjects_IfcContext.get(), INVERSE_IsDefinedBy );
+		}
+		shared_ptr<IfcObject>  RelatedObjects_IfcObject = dynamic_pointer_cast<IfcObject>( m_RelatedObjects[i] );
+		if( RelatedObjects_IfcObject )
+		{
+			refs.emplace_back( RelatedObjects_IfcObject.get(), INVERSE_IsDefinedBy );
+		}
+	}
+	shared_ptr<IfcPropertySetDefinition>  RelatingPropertyDefinition_IfcPropertySetDefinition = dynamic_pointer_cast<IfcPropertySetDefinition>( m_RelatingPropertyDefinition );
+	if( RelatingPropertyDefinition_IfcPropertySetDefinition )
+	{
+		refs.emplace_back( RelatingPropertyDefinition_IfcPropertySetDefinition.get(), INVERSE_DefinesOccurrence );
+	}
+}
 void IFC4X3::IfcRelDefinesByProperties::unlinkFromInverseCounterparts()
 {
 	IfcRelDefines::unlinkFromInverseCounterparts();
@@ -157,3 +202,30 @@ void IFC4X3::IfcRelDefinesByProperties::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelDefinesByProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDefines::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.push_back( m_RelatedObjects[i].get() );
+		}
+	}
+	BuildingEntity* RelatingPropertyDefinition_entity = dynamic_cast<BuildingEntity*>( m_RelatingPropertyDefinition.get() );
+	if( RelatingPropertyDefinition_entity )
+	{
+		refs.push_back( RelatingPropertyDefinition_entity );
+	}
+	IfcPropertySetDefinitionSet* RelatingPropertyDefinition_set = dynamic_cast<IfcPropertySetDefinitionSet*>( m_RelatingPropertyDefinition.get() );
+	if( RelatingPropertyDefinition_set )
+	{
+		for( size_t k=0; k<RelatingPropertyDefinition_set->m_vec.size(); ++k )
+		{
+			if( RelatingPropertyDefinition_set->m_vec[k] )
+			{
+				refs.push_back( RelatingPropertyDefinition_set->m_vec[k].get() );
+			}
+		}
+	}
+}
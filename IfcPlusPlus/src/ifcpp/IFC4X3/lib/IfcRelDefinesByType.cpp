@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcObject.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelDefinesByType::readStepArguments( const std::vector<std::stri
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatingType, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDefinesByType, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelDefinesByType::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedObjects, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingType, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelDefinesByType, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelDefinesByType::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDefines::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelDefinesByType::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcRelDefines::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelDefinesByType::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDefines::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedObjects", AttributeVectorView<IfcObject>( m_RelatedObjects ) );
+	visitor.visitObject( 5, "RelatingType", m_RelatingType );
+}
+void IFC4X3::IfcRelDefinesByType::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDefines::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelDefinesByType::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDefines::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelDefinesByType::setInverseCounterparts( shared_ptr<BuildingEnt
 		m_RelatingType->m_Types_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelDefinesByType::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDefines::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.emplace_back( m_RelatedObjects[i].get(), INVERSE_IsTypedBy );
+		}
+	}
+	if( m_RelatingType )
+	{
+		refs.emplace_back( m_RelatingType.get(), INVERSE_Types );
+	}
+}
 void IFC4X3::IfcRelDefinesByType::unlinkFromInverseCounterparts()
 {
 	IfcRelDefines::unlinkFromInverseCounterparts();
@@ -122,3 +159,18 @@ void IFC4X3::IfcRelDefinesByType::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelDefinesByType::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDefines::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedObjects.size(); ++i )
+	{
+		if( m_RelatedObjects[i] )
+		{
+			refs.push_back( m_RelatedObjects[i].get() );
+		}
+	}
+	if( m_RelatingType )
+	{
+		refs.push_back( m_RelatingType.get() );
+	}
+}
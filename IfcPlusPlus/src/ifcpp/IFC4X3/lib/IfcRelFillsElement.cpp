@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelFillsElement::readStepArguments( const std::vector<std::strin
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatedBuildingElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelFillsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelFillsElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingOpeningElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelFillsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelFillsElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -52,6 +64,16 @@ void IFC4X3::IfcRelFillsElement::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelFillsElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingOpeningElement", m_RelatingOpeningElement );
+	visitor.visitObject( 5, "RelatedBuildingElement", m_RelatedBuildingElement );
+}
+void IFC4X3::IfcRelFillsElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelFillsElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,18 @@ void IFC4X3::IfcRelFillsElement::setInverseCounterparts( shared_ptr<BuildingEnti
 		m_RelatingOpeningElement->m_HasFillings_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelFillsElement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedBuildingElement )
+	{
+		refs.emplace_back( m_RelatedBuildingElement.get(), INVERSE_FillsVoids );
+	}
+	if( m_RelatingOpeningElement )
+	{
+		refs.emplace_back( m_RelatingOpeningElement.get(), INVERSE_HasFillings );
+	}
+}
 void IFC4X3::IfcRelFillsElement::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -114,3 +148,15 @@ void IFC4X3::IfcRelFillsElement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelFillsElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingOpeningElement )
+	{
+		refs.push_back( m_RelatingOpeningElement.get() );
+	}
+	if( m_RelatedBuildingElement )
+	{
+		refs.push_back( m_RelatedBuildingElement.get() );
+	}
+}
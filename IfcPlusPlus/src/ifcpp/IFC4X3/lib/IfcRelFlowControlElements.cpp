@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcDistributionControlElement.h"
 #include "ifcpp/IFC4X3/include/IfcDistributionFlowElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelFlowControlElements::readStepArguments( const std::vector<std
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatingFlowElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelFlowControlElements, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelFlowControlElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReferenceList( args[4], m_RelatedControlElements, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingFlowElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelFlowControlElements, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelFlowControlElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelFlowControlElements::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelFlowControlElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedControlElements", AttributeVectorView<IfcDistributionControlElement>( m_RelatedControlElements ) );
+	visitor.visitObject( 5, "RelatingFlowElement", m_RelatingFlowElement );
+}
+void IFC4X3::IfcRelFlowControlElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelFlowControlElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelFlowControlElements::setInverseCounterparts( shared_ptr<Build
 		m_RelatingFlowElement->m_HasControlElements_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelFlowControlElements::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedControlElements.size(); ++i )
+	{
+		if( m_RelatedControlElements[i] )
+		{
+			refs.emplace_back( m_RelatedControlElements[i].get(), INVERSE_AssignedToFlowElement );
+		}
+	}
+	if( m_RelatingFlowElement )
+	{
+		refs.emplace_back( m_RelatingFlowElement.get(), INVERSE_HasControlElements );
+	}
+}
 void IFC4X3::IfcRelFlowControlElements::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -122,3 +159,18 @@ void IFC4X3::IfcRelFlowControlElements::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelFlowControlElements::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedControlElements.size(); ++i )
+	{
+		if( m_RelatedControlElements[i] )
+		{
+			refs.push_back( m_RelatedControlElements[i].get() );
+		}
+	}
+	if( m_RelatingFlowElement )
+	{
+		refs.push_back( m_RelatingFlowElement.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -59,6 +60,21 @@ void IFC4X3::IfcRelInterferesElements::readStepArguments( const std::vector<std:
 	if( num_args > 9 ){readEntityReference( args[9], m_InterferenceSpace, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelInterferesElements, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelInterferesElements::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelatingElement = IfcInterferenceSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RelatedElement = IfcInterferenceSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_InterferenceGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_InterferenceType = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ImpliedOrder = IfcLogical::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_InterferenceSpace, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelInterferesElements, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelInterferesElements::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -73,6 +89,20 @@ void IFC4X3::IfcRelInterferesElements::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelInterferesElements::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingElement", m_RelatingElement );
+	visitor.visitObject( 5, "RelatedElement", m_RelatedElement );
+	visitor.visitObject( 6, "InterferenceGeometry", m_InterferenceGeometry );
+	visitor.visitObject( 7, "InterferenceType", m_InterferenceType );
+	visitor.visitObject( 8, "ImpliedOrder", m_ImpliedOrder );
+	visitor.visitObject( 9, "InterferenceSpace", m_InterferenceSpace );
+}
+void IFC4X3::IfcRelInterferesElements::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelInterferesElements::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -99,6 +129,30 @@ void IFC4X3::IfcRelInterferesElements::setInverseCounterparts( shared_ptr<Buildi
 		RelatingElement_IfcSpatialElement->m_InterferesElements_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelInterferesElements::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	shared_ptr<IfcElement>  RelatedElement_IfcElement = dynamic_pointer_cast<IfcElement>( m_RelatedElement );
+	if( RelatedElement_IfcElement )
+	{
+		refs.emplace_back( RelatedElement_IfcElement.get(), INVERSE_IsInterferedByElements );
+	}
+	shared_ptr<IfcSpatialElement>  RelatedElement_IfcSpatialElement = dynamic_pointer_cast<IfcSpatialElement>( m_RelatedElement );
+	if( RelatedElement_IfcSpatialElement )
+	{
+		refs.emplace_back( RelatedElement_IfcSpatialElement.get(), INVERSE_IsInterferedByElements );
+	}
+	shared_ptr<IfcElement>  RelatingElement_IfcElement = dynamic_pointer_cast<IfcElement>( m_RelatingElement );
+	if( RelatingElement_IfcElement )
+	{
+		refs.emplace_back( RelatingElement_IfcElement.get(), INVERSE_InterferesElements );
+	}
+	shared_ptr<IfcSpatialElement>  RelatingElement_IfcSpatialElement = dynamic_pointer_cast<IfcSpatialElement>( m_RelatingElement );
+	if( RelatingElement_IfcSpatialElement )
+	{
+		refs.emplace_back( RelatingElement_IfcSpatialElement.get(), INVERSE_InterferesElements );
+	}
+}
 void IFC4X3::IfcRelInterferesElements::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -195,3 +249,25 @@ void IFC4X3::IfcRelInterferesElements::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelInterferesElements::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	BuildingEntity* RelatingElement_entity = dynamic_cast<BuildingEntity*>( m_RelatingElement.get() );
+	if( RelatingElement_entity )
+	{
+		refs.push_back( RelatingElement_entity );
+	}
+	BuildingEntity* RelatedElement_entity = dynamic_cast<BuildingEntity*>( m_RelatedElement.get() );
+	if( RelatedElement_entity )
+	{
+		refs.push_back( RelatedElement_entity );
+	}
+	if( m_InterferenceGeometry )
+	{
+		refs.push_back( m_InterferenceGeometry.get() );
+	}
+	if( m_InterferenceSpace )
+	{
+		refs.push_back( m_InterferenceSpace.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcFeatureElementAddition.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelProjectsElement::readStepArguments( const std::vector<std::st
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatedFeatureElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelProjectsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelProjectsElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedFeatureElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelProjectsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelProjectsElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDecomposes::getAttributes( vec_attributes );
@@ -52,6 +64,16 @@ void IFC4X3::IfcRelProjectsElement::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcRelDecomposes::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelProjectsElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingElement", m_RelatingElement );
+	visitor.visitObject( 5, "RelatedFeatureElement", m_RelatedFeatureElement );
+}
+void IFC4X3::IfcRelProjectsElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelProjectsElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDecomposes::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,18 @@ void IFC4X3::IfcRelProjectsElement::setInverseCounterparts( shared_ptr<BuildingE
 		m_RelatingElement->m_HasProjections_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelProjectsElement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDecomposes::getInverseReferences( refs );
+	if( m_RelatedFeatureElement )
+	{
+		refs.emplace_back( m_RelatedFeatureElement.get(), INVERSE_ProjectsElements );
+	}
+	if( m_RelatingElement )
+	{
+		refs.emplace_back( m_RelatingElement.get(), INVERSE_HasProjections );
+	}
+}
 void IFC4X3::IfcRelProjectsElement::unlinkFromInverseCounterparts()
 {
 	IfcRelDecomposes::unlinkFromInverseCounterparts();
@@ -104,3 +138,15 @@ void IFC4X3::IfcRelProjectsElement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelProjectsElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDecomposes::getEntityReferences( refs );
+	if( m_RelatingElement )
+	{
+		refs.push_back( m_RelatingElement.get() );
+	}
+	if( m_RelatedFeatureElement )
+	{
+		refs.push_back( m_RelatedFeatureElement.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcGroup.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -62,6 +63,17 @@ void IFC4X3::IfcRelReferencedInSpatialStructure::readStepArguments( const std::v
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatingStructure, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelReferencedInSpatialStructure, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelReferencedInSpatialStructure::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readSelectList( args[4], m_RelatedElements, "IFCSPATIALREFERENCESELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatingStructure, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelReferencedInSpatialStructure, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelReferencedInSpatialStructure::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -74,6 +86,16 @@ void IFC4X3::IfcRelReferencedInSpatialStructure::getAttributesInverse( std::vect
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelReferencedInSpatialStructure::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitList( 4, "RelatedElements", AttributeVectorView<IfcSpatialReferenceSelect>( m_RelatedElements ) );
+	visitor.visitObject( 5, "RelatingStructure", m_RelatingStructure );
+}
+void IFC4X3::IfcRelReferencedInSpatialStructure::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelReferencedInSpatialStructure::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -102,6 +124,32 @@ void IFC4X3::IfcRelReferencedInSpatialStructure::setInverseCounterparts( shared_
 		m_RelatingStructure->m_ReferencesElements_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelReferencedInSpatialStructure::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedElements.size(); ++i )
+	{
+		shared_ptr<IfcGroup>  RelatedElements_IfcGroup = dynamic_pointer_cast<IfcGroup>( m_RelatedElements[i] );
+		if( RelatedElements_IfcGroup )
+		{
+			refs.emplace_back( RelatedElements_IfcGroup.get(), INVERSE_ReferencedInStructures );
+		}
+		shared_ptr<IfcProduct>  RelatedElements_IfcProduct = dynamic_pointer_cast<IfcProduct>( m_RelatedElements[i] );
+		if( RelatedElements_IfcProduct )
+		{
+			refs.emplace_back( RelatedElements_IfcProduct.get(), INVERSE_ReferencedInStructures );
+		}
+		shared_ptr<IfcSystem>  RelatedElements_IfcSystem = dynamic_pointer_cast<IfcSystem>( m_RelatedElements[i] );
+		if( RelatedElements_IfcSystem )
+		{
+			refs.emplace_back( RelatedElements_IfcSystem.get(), INVERSE_ServicesFacilities );
+		}
+	}
+	if( m_RelatingStructure )
+	{
+		refs.emplace_back( m_RelatingStructure.get(), INVERSE_ReferencesElements );
+	}
+}
 void IFC4X3::IfcRelReferencedInSpatialStructure::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -200,3 +248,19 @@ void IFC4X3::IfcRelReferencedInSpatialStructure::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelReferencedInSpatialStructure::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedElements.size(); ++i )
+	{
+		BuildingEntity* RelatedElements_entity = dynamic_cast<BuildingEntity*>( m_RelatedElements[i].get() );
+		if( RelatedElements_entity )
+		{
+			refs.push_back( RelatedElements_entity );
+		}
+	}
+	if( m_RelatingStructure )
+	{
+		refs.push_back( m_RelatingStructure.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcLagTime.h"
@@ -52,6 +53,20 @@ void IFC4X3::IfcRelSequence::readStepArguments( const std::vector<std::string>&
 	if( num_args > 8 ){m_UserDefinedSequenceType = IfcLabel::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelSequence, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelSequence::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingProcess, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedProcess, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_TimeLag, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_SequenceType = IfcSequenceEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_UserDefinedSequenceType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelSequence, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelSequence::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -65,6 +80,19 @@ void IFC4X3::IfcRelSequence::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelSequence::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingProcess", m_RelatingProcess );
+	visitor.visitObject( 5, "RelatedProcess", m_RelatedProcess );
+	visitor.visitObject( 6, "TimeLag", m_TimeLag );
+	visitor.visitObject( 7, "SequenceType", m_SequenceType );
+	visitor.visitObject( 8, "UserDefinedSequenceType", m_UserDefinedSequenceType );
+}
+void IFC4X3::IfcRelSequence::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelSequence::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -79,6 +107,18 @@ void IFC4X3::IfcRelSequence::setInverseCounterparts( shared_ptr<BuildingEntity>
 		m_RelatingProcess->m_IsPredecessorTo_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelSequence::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedProcess )
+	{
+		refs.emplace_back( m_RelatedProcess.get(), INVERSE_IsSuccessorFrom );
+	}
+	if( m_RelatingProcess )
+	{
+		refs.emplace_back( m_RelatingProcess.get(), INVERSE_IsPredecessorTo );
+	}
+}
 void IFC4X3::IfcRelSequence::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -127,3 +167,19 @@ void IFC4X3::IfcRelSequence::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelSequence::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingProcess )
+	{
+		refs.push_back( m_RelatingProcess.get() );
+	}
+	if( m_RelatedProcess )
+	{
+		refs.push_back( m_RelatedProcess.get() );
+	}
+	if( m_TimeLag )
+	{
+		refs.push_back( m_TimeLag.get() );
+	}
+}
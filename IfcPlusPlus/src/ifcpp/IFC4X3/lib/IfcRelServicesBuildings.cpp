@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcOwnerHistory.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelServicesBuildings::readStepArguments( const std::vector<std::
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedBuildings, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelServicesBuildings, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelServicesBuildings::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingSystem, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_RelatedBuildings, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelServicesBuildings, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelServicesBuildings::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -54,6 +66,16 @@ void IFC4X3::IfcRelServicesBuildings::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelServicesBuildings::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingSystem", m_RelatingSystem );
+	visitor.visitList( 5, "RelatedBuildings", AttributeVectorView<IfcSpatialElement>( m_RelatedBuildings ) );
+}
+void IFC4X3::IfcRelServicesBuildings::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelServicesBuildings::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +93,21 @@ void IFC4X3::IfcRelServicesBuildings::setInverseCounterparts( shared_ptr<Buildin
 		m_RelatingSystem->m_ServicesBuildings_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelServicesBuildings::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedBuildings.size(); ++i )
+	{
+		if( m_RelatedBuildings[i] )
+		{
+			refs.emplace_back( m_RelatedBuildings[i].get(), INVERSE_ServicedBySystems );
+		}
+	}
+	if( m_RelatingSystem )
+	{
+		refs.emplace_back( m_RelatingSystem.get(), INVERSE_ServicesBuildings );
+	}
+}
 void IFC4X3::IfcRelServicesBuildings::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -122,3 +159,18 @@ void IFC4X3::IfcRelServicesBuildings::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelServicesBuildings::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	if( m_RelatingSystem )
+	{
+		refs.push_back( m_RelatingSystem.get() );
+	}
+	for( size_t i=0; i<m_RelatedBuildings.size(); ++i )
+	{
+		if( m_RelatedBuildings[i] )
+		{
+			refs.push_back( m_RelatedBuildings[i].get() );
+		}
+	}
+}
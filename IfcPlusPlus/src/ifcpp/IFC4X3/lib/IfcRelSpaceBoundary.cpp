@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcExternalSpatialElement.h"
@@ -56,6 +57,20 @@ void IFC4X3::IfcRelSpaceBoundary::readStepArguments( const std::vector<std::stri
 	if( num_args > 8 ){m_InternalOrExternalBoundary = IfcInternalOrExternalEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelSpaceBoundary::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelatingSpace = IfcSpaceBoundarySelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PhysicalOrVirtualBoundary = IfcPhysicalOrVirtualEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_InternalOrExternalBoundary = IfcInternalOrExternalEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelSpaceBoundary::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelConnects::getAttributes( vec_attributes );
@@ -69,6 +84,19 @@ void IFC4X3::IfcRelSpaceBoundary::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcRelConnects::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelSpaceBoundary::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingSpace", m_RelatingSpace );
+	visitor.visitObject( 5, "RelatedBuildingElement", m_RelatedBuildingElement );
+	visitor.visitObject( 6, "ConnectionGeometry", m_ConnectionGeometry );
+	visitor.visitObject( 7, "PhysicalOrVirtualBoundary", m_PhysicalOrVirtualBoundary );
+	visitor.visitObject( 8, "InternalOrExternalBoundary", m_InternalOrExternalBoundary );
+}
+void IFC4X3::IfcRelSpaceBoundary::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelConnects::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelSpaceBoundary::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelConnects::setInverseCounterparts( ptr_self_entity );
@@ -89,6 +117,24 @@ void IFC4X3::IfcRelSpaceBoundary::setInverseCounterparts( shared_ptr<BuildingEnt
 		RelatingSpace_IfcSpace->m_BoundedBy_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelConnects::getInverseReferences( refs );
+	if( m_RelatedBuildingElement )
+	{
+		refs.emplace_back( m_RelatedBuildingElement.get(), INVERSE_ProvidesBoundaries );
+	}
+	shared_ptr<IfcExternalSpatialElement>  RelatingSpace_IfcExternalSpatialElement = dynamic_pointer_cast<IfcExternalSpatialElement>( m_RelatingSpace );
+	if( RelatingSpace_IfcExternalSpatialElement )
+	{
+		refs.emplace_back( RelatingSpace_IfcExternalSpatialElement.get(), INVERSE_BoundedBy );
+	}
+	shared_ptr<IfcSpace>  RelatingSpace_IfcSpace = dynamic_pointer_cast<IfcSpace>( m_RelatingSpace );
+	if( RelatingSpace_IfcSpace )
+	{
+		refs.emplace_back( RelatingSpace_IfcSpace.get(), INVERSE_BoundedBy );
+	}
+}
 void IFC4X3::IfcRelSpaceBoundary::unlinkFromInverseCounterparts()
 {
 	IfcRelConnects::unlinkFromInverseCounterparts();
@@ -161,3 +207,20 @@ void IFC4X3::IfcRelSpaceBoundary::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelConnects::getEntityReferences( refs );
+	BuildingEntity* RelatingSpace_entity = dynamic_cast<BuildingEntity*>( m_RelatingSpace.get() );
+	if( RelatingSpace_entity )
+	{
+		refs.push_back( RelatingSpace_entity );
+	}
+	if( m_RelatedBuildingElement )
+	{
+		refs.push_back( m_RelatedBuildingElement.get() );
+	}
+	if( m_ConnectionGeometry )
+	{
+		refs.push_back( m_ConnectionGeometry.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -57,6 +58,21 @@ void IFC4X3::IfcRelSpaceBoundary1stLevel::readStepArguments( const std::vector<s
 	if( num_args > 9 ){readEntityReference( args[9], m_ParentBoundary, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary1stLevel, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelSpaceBoundary1stLevel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelatingSpace = IfcSpaceBoundarySelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PhysicalOrVirtualBoundary = IfcPhysicalOrVirtualEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_InternalOrExternalBoundary = IfcInternalOrExternalEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_ParentBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary1stLevel, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelSpaceBoundary1stLevel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelSpaceBoundary::getAttributes( vec_attributes );
@@ -75,6 +91,16 @@ void IFC4X3::IfcRelSpaceBoundary1stLevel::getAttributesInverse( std::vector<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "InnerBoundaries_inverse", InnerBoundaries_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRelSpaceBoundary1stLevel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelSpaceBoundary::visitAttributes( visitor );
+	visitor.visitObject( 9, "ParentBoundary", m_ParentBoundary );
+}
+void IFC4X3::IfcRelSpaceBoundary1stLevel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelSpaceBoundary::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "InnerBoundaries_inverse", AttributeInverseVectorView<IfcRelSpaceBoundary1stLevel>( m_InnerBoundaries_inverse ) );
+}
 void IFC4X3::IfcRelSpaceBoundary1stLevel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelSpaceBoundary::setInverseCounterparts( ptr_self_entity );
@@ -85,6 +111,14 @@ void IFC4X3::IfcRelSpaceBoundary1stLevel::setInverseCounterparts( shared_ptr<Bui
 		m_ParentBoundary->m_InnerBoundaries_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary1stLevel::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelSpaceBoundary::getInverseReferences( refs );
+	if( m_ParentBoundary )
+	{
+		refs.emplace_back( m_ParentBoundary.get(), INVERSE_InnerBoundaries );
+	}
+}
 void IFC4X3::IfcRelSpaceBoundary1stLevel::unlinkFromInverseCounterparts()
 {
 	IfcRelSpaceBoundary::unlinkFromInverseCounterparts();
@@ -111,3 +145,11 @@ void IFC4X3::IfcRelSpaceBoundary1stLevel::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary1stLevel::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelSpaceBoundary::getEntityReferences( refs );
+	if( m_ParentBoundary )
+	{
+		refs.push_back( m_ParentBoundary.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -61,6 +62,22 @@ void IFC4X3::IfcRelSpaceBoundary2ndLevel::readStepArguments( const std::vector<s
 	if( num_args > 10 ){readEntityReference( args[10], m_CorrespondingBoundary, map, errorStream, entityIdNotFound );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary2ndLevel, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelSpaceBoundary2ndLevel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RelatingSpace = IfcSpaceBoundarySelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_ConnectionGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PhysicalOrVirtualBoundary = IfcPhysicalOrVirtualEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_InternalOrExternalBoundary = IfcInternalOrExternalEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_ParentBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readEntityReference( args[10], m_CorrespondingBoundary, map, errorStream, entityIdNotFound );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcRelSpaceBoundary2ndLevel, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelSpaceBoundary2ndLevel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelSpaceBoundary1stLevel::getAttributes( vec_attributes );
@@ -79,6 +96,16 @@ void IFC4X3::IfcRelSpaceBoundary2ndLevel::getAttributesInverse( std::vector<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Corresponds_inverse", Corresponds_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRelSpaceBoundary2ndLevel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelSpaceBoundary1stLevel::visitAttributes( visitor );
+	visitor.visitObject( 10, "CorrespondingBoundary", m_CorrespondingBoundary );
+}
+void IFC4X3::IfcRelSpaceBoundary2ndLevel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelSpaceBoundary1stLevel::visitAttributesInverse( visitor );
+	visitor.visitList( 1, "Corresponds_inverse", AttributeInverseVectorView<IfcRelSpaceBoundary2ndLevel>( m_Corresponds_inverse ) );
+}
 void IFC4X3::IfcRelSpaceBoundary2ndLevel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelSpaceBoundary1stLevel::setInverseCounterparts( ptr_self_entity );
@@ -89,6 +116,14 @@ void IFC4X3::IfcRelSpaceBoundary2ndLevel::setInverseCounterparts( shared_ptr<Bui
 		m_CorrespondingBoundary->m_Corresponds_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary2ndLevel::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelSpaceBoundary1stLevel::getInverseReferences( refs );
+	if( m_CorrespondingBoundary )
+	{
+		refs.emplace_back( m_CorrespondingBoundary.get(), INVERSE_Corresponds );
+	}
+}
 void IFC4X3::IfcRelSpaceBoundary2ndLevel::unlinkFromInverseCounterparts()
 {
 	IfcRelSpaceBoundary1stLevel::unlinkFromInverseCounterparts();
@@ -115,3 +150,11 @@ void IFC4X3::IfcRelSpaceBoundary2ndLevel::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelSpaceBoundary2ndLevel::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelSpaceBoundary1stLevel::getEntityReferences( refs );
+	if( m_CorrespondingBoundary )
+	{
+		refs.push_back( m_CorrespondingBoundary.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcElement.h"
 #include "ifcpp/IFC4X3/include/IfcFeatureElementSubtraction.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -42,6 +43,17 @@ void IFC4X3::IfcRelVoidsElement::readStepArguments( const std::vector<std::strin
 	if( num_args > 5 ){readEntityReference( args[5], m_RelatedOpeningElement, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelVoidsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRelVoidsElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_RelatingBuildingElement, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_RelatedOpeningElement, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRelVoidsElement, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRelVoidsElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRelDecomposes::getAttributes( vec_attributes );
@@ -52,6 +64,16 @@ void IFC4X3::IfcRelVoidsElement::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcRelDecomposes::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRelVoidsElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributes( visitor );
+	visitor.visitObject( 4, "RelatingBuildingElement", m_RelatingBuildingElement );
+	visitor.visitObject( 5, "RelatedOpeningElement", m_RelatedOpeningElement );
+}
+void IFC4X3::IfcRelVoidsElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRelDecomposes::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRelVoidsElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRelDecomposes::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +88,18 @@ void IFC4X3::IfcRelVoidsElement::setInverseCounterparts( shared_ptr<BuildingEnti
 		m_RelatingBuildingElement->m_HasOpenings_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRelVoidsElement::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRelDecomposes::getInverseReferences( refs );
+	if( m_RelatedOpeningElement )
+	{
+		refs.emplace_back( m_RelatedOpeningElement.get(), INVERSE_VoidsElements );
+	}
+	if( m_RelatingBuildingElement )
+	{
+		refs.emplace_back( m_RelatingBuildingElement.get(), INVERSE_HasOpenings );
+	}
+}
 void IFC4X3::IfcRelVoidsElement::unlinkFromInverseCounterparts()
 {
 	IfcRelDecomposes::unlinkFromInverseCounterparts();
@@ -104,3 +138,15 @@ void IFC4X3::IfcRelVoidsElement::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRelVoidsElement::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRelDecomposes::getEntityReferences( refs );
+	if( m_RelatingBuildingElement )
+	{
+		refs.push_back( m_RelatingBuildingElement.get() );
+	}
+	if( m_RelatedOpeningElement )
+	{
+		refs.push_back( m_RelatedOpeningElement.get() );
+	}
+}
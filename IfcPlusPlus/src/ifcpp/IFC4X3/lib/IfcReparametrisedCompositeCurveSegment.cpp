@@ -37,6 +37,15 @@ void IFC4X3::IfcReparametrisedCompositeCurveSegment::readStepArguments( const st
 	if( num_args > 3 ){m_ParamLength = IfcParameterValue::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcReparametrisedCompositeCurveSegment, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcReparametrisedCompositeCurveSegment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Transition = IfcTransitionCode::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SameSense = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ParentCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ParamLength = IfcParameterValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcReparametrisedCompositeCurveSegment, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcReparametrisedCompositeCurveSegment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCompositeCurveSegment::getAttributes( vec_attributes );
@@ -46,6 +55,15 @@ void IFC4X3::IfcReparametrisedCompositeCurveSegment::getAttributesInverse( std::
 {
 	IFC4X3::IfcCompositeCurveSegment::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcReparametrisedCompositeCurveSegment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurveSegment::visitAttributes( visitor );
+	visitor.visitObject( 3, "ParamLength", m_ParamLength );
+}
+void IFC4X3::IfcReparametrisedCompositeCurveSegment::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCompositeCurveSegment::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcReparametrisedCompositeCurveSegment::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCompositeCurveSegment::setInverseCounterparts( ptr_self_entity );
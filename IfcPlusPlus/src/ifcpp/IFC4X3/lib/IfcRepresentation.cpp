@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcPresentationLayerAssignment.h"
 #include "ifcpp/IFC4X3/include/IfcProductRepresentation.h"
@@ -36,6 +37,15 @@ void IFC4X3::IfcRepresentation::readStepArguments( const std::vector<std::string
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRepresentation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ContextOfItems, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepresentationIdentifier = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_RepresentationType = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRepresentation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ContextOfItems", m_ContextOfItems ) );
@@ -75,6 +85,19 @@ void IFC4X3::IfcRepresentation::getAttributesInverse( std::vector<std::pair<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "OfProductRepresentation_inverse", OfProductRepresentation_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRepresentation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ContextOfItems", m_ContextOfItems );
+	visitor.visitObject( 1, "RepresentationIdentifier", m_RepresentationIdentifier );
+	visitor.visitObject( 2, "RepresentationType", m_RepresentationType );
+	visitor.visitList( 3, "Items", AttributeVectorView<IfcRepresentationItem>( m_Items ) );
+}
+void IFC4X3::IfcRepresentation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "RepresentationMap_inverse", AttributeInverseVectorView<IfcRepresentationMap>( m_RepresentationMap_inverse ) );
+	visitor.visitList( 1, "LayerAssignments_inverse", AttributeInverseVectorView<IfcPresentationLayerAssignment>( m_LayerAssignments_inverse ) );
+	visitor.visitList( 2, "OfProductRepresentation_inverse", AttributeInverseVectorView<IfcProductRepresentation>( m_OfProductRepresentation_inverse ) );
+}
 void IFC4X3::IfcRepresentation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcRepresentation> ptr_self = dynamic_pointer_cast<IfcRepresentation>( ptr_self_entity );
@@ -84,6 +107,13 @@ void IFC4X3::IfcRepresentation::setInverseCounterparts( shared_ptr<BuildingEntit
 		m_ContextOfItems->m_RepresentationsInContext_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRepresentation::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_ContextOfItems )
+	{
+		refs.emplace_back( m_ContextOfItems.get(), INVERSE_RepresentationsInContext );
+	}
+}
 void IFC4X3::IfcRepresentation::unlinkFromInverseCounterparts()
 {
 	if( m_ContextOfItems )
@@ -109,3 +139,17 @@ void IFC4X3::IfcRepresentation::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRepresentation::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_ContextOfItems )
+	{
+		refs.push_back( m_ContextOfItems.get() );
+	}
+	for( size_t i=0; i<m_Items.size(); ++i )
+	{
+		if( m_Items[i] )
+		{
+			refs.push_back( m_Items[i].get() );
+		}
+	}
+}
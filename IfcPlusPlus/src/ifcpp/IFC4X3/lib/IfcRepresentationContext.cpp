@@ -26,6 +26,13 @@ void IFC4X3::IfcRepresentationContext::readStepArguments( const std::vector<std:
 	if( num_args > 1 ){m_ContextType = IfcLabel::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcRepresentationContext, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRepresentationContext::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ContextIdentifier = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ContextType = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcRepresentationContext, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRepresentationContext::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "ContextIdentifier", m_ContextIdentifier ) );
@@ -43,6 +50,15 @@ void IFC4X3::IfcRepresentationContext::getAttributesInverse( std::vector<std::pa
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "RepresentationsInContext_inverse", RepresentationsInContext_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRepresentationContext::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ContextIdentifier", m_ContextIdentifier );
+	visitor.visitObject( 1, "ContextType", m_ContextType );
+}
+void IFC4X3::IfcRepresentationContext::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "RepresentationsInContext_inverse", AttributeInverseVectorView<IfcRepresentation>( m_RepresentationsInContext_inverse ) );
+}
 void IFC4X3::IfcRepresentationContext::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -19,6 +19,9 @@ void IFC4X3::IfcRepresentationItem::getStepParameter( std::stringstream& stream,
 void IFC4X3::IfcRepresentationItem::readStepArguments( const std::vector<std::string>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 }
+void IFC4X3::IfcRepresentationItem::readBinaryArguments( const std::vector<SnapshotArgument>& /*args*/, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+}
 void IFC4X3::IfcRepresentationItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 }
@@ -43,6 +46,14 @@ void IFC4X3::IfcRepresentationItem::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "StyledByItem_inverse", StyledByItem_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRepresentationItem::visitAttributes( AttributeVisitor& /*visitor*/ ) const
+{
+}
+void IFC4X3::IfcRepresentationItem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "LayerAssignment_inverse", AttributeInverseVectorView<IfcPresentationLayerAssignment>( m_LayerAssignment_inverse ) );
+	visitor.visitList( 1, "StyledByItem_inverse", AttributeInverseVectorView<IfcStyledItem>( m_StyledByItem_inverse ) );
+}
 void IFC4X3::IfcRepresentationItem::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
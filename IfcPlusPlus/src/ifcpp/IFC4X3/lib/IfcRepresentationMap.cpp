@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAxis2Placement.h"
 #include "ifcpp/IFC4X3/include/IfcMappedItem.h"
 #include "ifcpp/IFC4X3/include/IfcRepresentation.h"
@@ -28,6 +29,13 @@ void IFC4X3::IfcRepresentationMap::readStepArguments( const std::vector<std::str
 	if( num_args > 1 ){readEntityReference( args[1], m_MappedRepresentation, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcRepresentationMap, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRepresentationMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_MappingOrigin = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_MappedRepresentation, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcRepresentationMap, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRepresentationMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "MappingOrigin", m_MappingOrigin ) );
@@ -54,6 +62,16 @@ void IFC4X3::IfcRepresentationMap::getAttributesInverse( std::vector<std::pair<s
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "MapUsage_inverse", MapUsage_inverse_vec_obj ) );
 }
+void IFC4X3::IfcRepresentationMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "MappingOrigin", m_MappingOrigin );
+	visitor.visitObject( 1, "MappedRepresentation", m_MappedRepresentation );
+}
+void IFC4X3::IfcRepresentationMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasShapeAspects_inverse", AttributeInverseVectorView<IfcShapeAspect>( m_HasShapeAspects_inverse ) );
+	visitor.visitList( 1, "MapUsage_inverse", AttributeInverseVectorView<IfcMappedItem>( m_MapUsage_inverse ) );
+}
 void IFC4X3::IfcRepresentationMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcRepresentationMap> ptr_self = dynamic_pointer_cast<IfcRepresentationMap>( ptr_self_entity );
@@ -63,6 +81,13 @@ void IFC4X3::IfcRepresentationMap::setInverseCounterparts( shared_ptr<BuildingEn
 		m_MappedRepresentation->m_RepresentationMap_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcRepresentationMap::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_MappedRepresentation )
+	{
+		refs.emplace_back( m_MappedRepresentation.get(), INVERSE_RepresentationMap );
+	}
+}
 void IFC4X3::IfcRepresentationMap::unlinkFromInverseCounterparts()
 {
 	if( m_MappedRepresentation )
@@ -88,3 +113,15 @@ void IFC4X3::IfcRepresentationMap::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcRepresentationMap::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* MappingOrigin_entity = dynamic_cast<BuildingEntity*>( m_MappingOrigin.get() );
+	if( MappingOrigin_entity )
+	{
+		refs.push_back( MappingOrigin_entity );
+	}
+	if( m_MappedRepresentation )
+	{
+		refs.push_back( m_MappedRepresentation.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcApproval.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcProperty.h"
@@ -52,6 +53,15 @@ void IFC4X3::IfcResourceApprovalRelationship::readStepArguments( const std::vect
 	if( num_args > 3 ){readEntityReference( args[3], m_RelatingApproval, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcResourceApprovalRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcResourceApprovalRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_RelatedResourceObjects, "IFCRESOURCEOBJECTSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_RelatingApproval, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcResourceApprovalRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcResourceApprovalRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -64,6 +74,16 @@ void IFC4X3::IfcResourceApprovalRelationship::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcResourceApprovalRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitList( 2, "RelatedResourceObjects", AttributeVectorView<IfcResourceObjectSelect>( m_RelatedResourceObjects ) );
+	visitor.visitObject( 3, "RelatingApproval", m_RelatingApproval );
+}
+void IFC4X3::IfcResourceApprovalRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcResourceApprovalRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -82,6 +102,22 @@ void IFC4X3::IfcResourceApprovalRelationship::setInverseCounterparts( shared_ptr
 		m_RelatingApproval->m_ApprovedResources_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcResourceApprovalRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		shared_ptr<IfcProperty>  RelatedResourceObjects_IfcProperty = dynamic_pointer_cast<IfcProperty>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcProperty )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcProperty.get(), INVERSE_HasApprovals );
+		}
+	}
+	if( m_RelatingApproval )
+	{
+		refs.emplace_back( m_RelatingApproval.get(), INVERSE_ApprovedResources );
+	}
+}
 void IFC4X3::IfcResourceApprovalRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -134,3 +170,19 @@ void IFC4X3::IfcResourceApprovalRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcResourceApprovalRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		BuildingEntity* RelatedResourceObjects_entity = dynamic_cast<BuildingEntity*>( m_RelatedResourceObjects[i].get() );
+		if( RelatedResourceObjects_entity )
+		{
+			refs.push_back( RelatedResourceObjects_entity );
+		}
+	}
+	if( m_RelatingApproval )
+	{
+		refs.push_back( m_RelatingApproval.get() );
+	}
+}
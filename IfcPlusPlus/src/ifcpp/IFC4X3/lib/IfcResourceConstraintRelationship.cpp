@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcConstraint.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcProperty.h"
@@ -52,6 +53,15 @@ void IFC4X3::IfcResourceConstraintRelationship::readStepArguments( const std::ve
 	if( num_args > 3 ){readSelectList( args[3], m_RelatedResourceObjects, "IFCRESOURCEOBJECTSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcResourceConstraintRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcResourceConstraintRelationship::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_RelatingConstraint, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readSelectList( args[3], m_RelatedResourceObjects, "IFCRESOURCEOBJECTSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcResourceConstraintRelationship, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcResourceConstraintRelationship::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributes( vec_attributes );
@@ -64,6 +74,16 @@ void IFC4X3::IfcResourceConstraintRelationship::getAttributesInverse( std::vecto
 {
 	IFC4X3::IfcResourceLevelRelationship::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcResourceConstraintRelationship::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributes( visitor );
+	visitor.visitObject( 2, "RelatingConstraint", m_RelatingConstraint );
+	visitor.visitList( 3, "RelatedResourceObjects", AttributeVectorView<IfcResourceObjectSelect>( m_RelatedResourceObjects ) );
+}
+void IFC4X3::IfcResourceConstraintRelationship::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcResourceLevelRelationship::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcResourceConstraintRelationship::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcResourceLevelRelationship::setInverseCounterparts( ptr_self_entity );
@@ -82,6 +102,22 @@ void IFC4X3::IfcResourceConstraintRelationship::setInverseCounterparts( shared_p
 		m_RelatingConstraint->m_PropertiesForConstraint_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcResourceConstraintRelationship::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcResourceLevelRelationship::getInverseReferences( refs );
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		shared_ptr<IfcProperty>  RelatedResourceObjects_IfcProperty = dynamic_pointer_cast<IfcProperty>( m_RelatedResourceObjects[i] );
+		if( RelatedResourceObjects_IfcProperty )
+		{
+			refs.emplace_back( RelatedResourceObjects_IfcProperty.get(), INVERSE_HasConstraints );
+		}
+	}
+	if( m_RelatingConstraint )
+	{
+		refs.emplace_back( m_RelatingConstraint.get(), INVERSE_PropertiesForConstraint );
+	}
+}
 void IFC4X3::IfcResourceConstraintRelationship::unlinkFromInverseCounterparts()
 {
 	IfcResourceLevelRelationship::unlinkFromInverseCounterparts();
@@ -134,3 +170,19 @@ void IFC4X3::IfcResourceConstraintRelationship::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcResourceConstraintRelationship::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcResourceLevelRelationship::getEntityReferences( refs );
+	if( m_RelatingConstraint )
+	{
+		refs.push_back( m_RelatingConstraint.get() );
+	}
+	for( size_t i=0; i<m_RelatedResourceObjects.size(); ++i )
+	{
+		BuildingEntity* RelatedResourceObjects_entity = dynamic_cast<BuildingEntity*>( m_RelatedResourceObjects[i].get() );
+		if( RelatedResourceObjects_entity )
+		{
+			refs.push_back( RelatedResourceObjects_entity );
+		}
+	}
+}
@@ -78,6 +78,29 @@ void IFC4X3::IfcResourceTime::readStepArguments( const std::vector<std::string>&
 	if( num_args > 17 ){m_Completion = IfcPositiveRatioMeasure::createObjectFromSTEP( args[17], map, errorStream, entityIdNotFound );}
 	if( num_args != 18 ){ errorStream << "Wrong parameter count for entity IfcResourceTime, expecting 18, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcResourceTime::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ScheduleWork = IfcDuration::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ScheduleUsage = IfcPositiveRatioMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_ScheduleStart = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ScheduleFinish = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_ScheduleContour = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_LevelingDelay = IfcDuration::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_IsOverAllocated = IfcBoolean::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_StatusTime = IfcDateTime::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_ActualWork = IfcDuration::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_ActualUsage = IfcPositiveRatioMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_ActualStart = IfcDateTime::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_ActualFinish = IfcDateTime::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_RemainingWork = IfcDuration::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_RemainingUsage = IfcPositiveRatioMeasure::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args > 17 ){m_Completion = IfcPositiveRatioMeasure::createObjectFromBinary( args[17], map, errorStream, entityIdNotFound );}
+	if( num_args != 18 ){ errorStream << "Wrong parameter count for entity IfcResourceTime, expecting 18, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcResourceTime::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSchedulingTime::getAttributes( vec_attributes );
@@ -101,6 +124,29 @@ void IFC4X3::IfcResourceTime::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcSchedulingTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcResourceTime::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributes( visitor );
+	visitor.visitObject( 3, "ScheduleWork", m_ScheduleWork );
+	visitor.visitObject( 4, "ScheduleUsage", m_ScheduleUsage );
+	visitor.visitObject( 5, "ScheduleStart", m_ScheduleStart );
+	visitor.visitObject( 6, "ScheduleFinish", m_ScheduleFinish );
+	visitor.visitObject( 7, "ScheduleContour", m_ScheduleContour );
+	visitor.visitObject( 8, "LevelingDelay", m_LevelingDelay );
+	visitor.visitObject( 9, "IsOverAllocated", m_IsOverAllocated );
+	visitor.visitObject( 10, "StatusTime", m_StatusTime );
+	visitor.visitObject( 11, "ActualWork", m_ActualWork );
+	visitor.visitObject( 12, "ActualUsage", m_ActualUsage );
+	visitor.visitObject( 13, "ActualStart", m_ActualStart );
+	visitor.visitObject( 14, "ActualFinish", m_ActualFinish );
+	visitor.visitObject( 15, "RemainingWork", m_RemainingWork );
+	visitor.visitObject( 16, "RemainingUsage", m_RemainingUsage );
+	visitor.visitObject( 17, "Completion", m_Completion );
+}
+void IFC4X3::IfcResourceTime::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcResourceTime::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSchedulingTime::setInverseCounterparts( ptr_self_entity );
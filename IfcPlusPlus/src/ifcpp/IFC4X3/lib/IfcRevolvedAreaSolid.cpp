@@ -36,6 +36,15 @@ void IFC4X3::IfcRevolvedAreaSolid::readStepArguments( const std::vector<std::str
 	if( num_args > 3 ){m_Angle = IfcPlaneAngleMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRevolvedAreaSolid, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRevolvedAreaSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Axis, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Angle = IfcPlaneAngleMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRevolvedAreaSolid, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRevolvedAreaSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSweptAreaSolid::getAttributes( vec_attributes );
@@ -46,6 +55,16 @@ void IFC4X3::IfcRevolvedAreaSolid::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcSweptAreaSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRevolvedAreaSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptAreaSolid::visitAttributes( visitor );
+	visitor.visitObject( 2, "Axis", m_Axis );
+	visitor.visitObject( 3, "Angle", m_Angle );
+}
+void IFC4X3::IfcRevolvedAreaSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptAreaSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRevolvedAreaSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSweptAreaSolid::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +73,11 @@ void IFC4X3::IfcRevolvedAreaSolid::unlinkFromInverseCounterparts()
 {
 	IfcSweptAreaSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcRevolvedAreaSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSweptAreaSolid::getEntityReferences( refs );
+	if( m_Axis )
+	{
+		refs.push_back( m_Axis.get() );
+	}
+}
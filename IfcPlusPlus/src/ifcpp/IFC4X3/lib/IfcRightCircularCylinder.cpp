@@ -31,6 +31,14 @@ void IFC4X3::IfcRightCircularCylinder::readStepArguments( const std::vector<std:
 	if( num_args > 2 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcRightCircularCylinder, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRightCircularCylinder::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Height = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcRightCircularCylinder, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRightCircularCylinder::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcRightCircularCylinder::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRightCircularCylinder::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributes( visitor );
+	visitor.visitObject( 1, "Height", m_Height );
+	visitor.visitObject( 2, "Radius", m_Radius );
+}
+void IFC4X3::IfcRightCircularCylinder::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRightCircularCylinder::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCsgPrimitive3D::setInverseCounterparts( ptr_self_entity );
@@ -37,6 +37,16 @@ void IFC4X3::IfcRigidOperation::readStepArguments( const std::vector<std::string
 	if( num_args > 4 ){m_Height = IfcLengthMeasure::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcRigidOperation, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRigidOperation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SourceCRS = IfcCoordinateReferenceSystemSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TargetCRS, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_FirstCoordinate = IfcMeasureValue::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SecondCoordinate = IfcMeasureValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_Height = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcRigidOperation, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRigidOperation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCoordinateOperation::getAttributes( vec_attributes );
@@ -48,6 +58,17 @@ void IFC4X3::IfcRigidOperation::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcCoordinateOperation::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRigidOperation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateOperation::visitAttributes( visitor );
+	visitor.visitObject( 2, "FirstCoordinate", m_FirstCoordinate );
+	visitor.visitObject( 3, "SecondCoordinate", m_SecondCoordinate );
+	visitor.visitObject( 4, "Height", m_Height );
+}
+void IFC4X3::IfcRigidOperation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCoordinateOperation::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRigidOperation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCoordinateOperation::setInverseCounterparts( ptr_self_entity );
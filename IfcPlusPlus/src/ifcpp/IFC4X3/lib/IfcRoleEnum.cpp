@@ -41,6 +41,10 @@ void IFC4X3::IfcRoleEnum::getStepParameter( std::stringstream& stream, bool is_s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRoleEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcRoleEnum> IFC4X3::IfcRoleEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRoleEnum>(); }
@@ -141,3 +145,12 @@ shared_ptr<IFC4X3::IfcRoleEnum> IFC4X3::IfcRoleEnum::createObjectFromSTEP( const
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRoleEnum> IFC4X3::IfcRoleEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_USERDEFINED ) { return shared_ptr<IfcRoleEnum>(); }
+		return shared_ptr<IfcRoleEnum>( new IfcRoleEnum( IfcRoleEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
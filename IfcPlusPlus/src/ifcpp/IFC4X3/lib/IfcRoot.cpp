@@ -34,6 +34,15 @@ void IFC4X3::IfcRoot::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 3 ){m_Description = IfcText::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRoot, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRoot::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcRoot, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRoot::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "GlobalId", m_GlobalId ) );
@@ -44,9 +53,26 @@ void IFC4X3::IfcRoot::getAttributes( std::vector<std::pair<std::string, shared_p
 void IFC4X3::IfcRoot::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcRoot::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "GlobalId", m_GlobalId );
+	visitor.visitObject( 1, "OwnerHistory", m_OwnerHistory );
+	visitor.visitObject( 2, "Name", m_Name );
+	visitor.visitObject( 3, "Description", m_Description );
+}
+void IFC4X3::IfcRoot::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcRoot::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcRoot::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcRoot::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_OwnerHistory )
+	{
+		refs.push_back( m_OwnerHistory.get() );
+	}
+}
@@ -19,6 +19,10 @@ void IFC4X3::IfcRotationalStiffnessMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcRotationalStiffnessMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcRotationalStiffnessMeasure> IFC4X3::IfcRotationalStiffnessMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcRotationalStiffnessMeasure>(); }
@@ -28,3 +32,10 @@ shared_ptr<IFC4X3::IfcRotationalStiffnessMeasure> IFC4X3::IfcRotationalStiffness
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcRotationalStiffnessMeasure> IFC4X3::IfcRotationalStiffnessMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcRotationalStiffnessMeasure>(); }
+	shared_ptr<IfcRotationalStiffnessMeasure> type_object( new IfcRotationalStiffnessMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
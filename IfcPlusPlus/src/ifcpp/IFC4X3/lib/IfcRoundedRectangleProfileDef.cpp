@@ -42,6 +42,17 @@ void IFC4X3::IfcRoundedRectangleProfileDef::readStepArguments( const std::vector
 	if( num_args > 5 ){m_RoundingRadius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRoundedRectangleProfileDef, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcRoundedRectangleProfileDef::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_ProfileType = IfcProfileTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ProfileName = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_XDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_YDim = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RoundingRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcRoundedRectangleProfileDef, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcRoundedRectangleProfileDef::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRectangleProfileDef::getAttributes( vec_attributes );
@@ -51,6 +62,15 @@ void IFC4X3::IfcRoundedRectangleProfileDef::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcRectangleProfileDef::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcRoundedRectangleProfileDef::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRectangleProfileDef::visitAttributes( visitor );
+	visitor.visitObject( 5, "RoundingRadius", m_RoundingRadius );
+}
+void IFC4X3::IfcRoundedRectangleProfileDef::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRectangleProfileDef::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcRoundedRectangleProfileDef::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRectangleProfileDef::setInverseCounterparts( ptr_self_entity );
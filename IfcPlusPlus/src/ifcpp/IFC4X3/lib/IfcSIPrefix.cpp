@@ -34,6 +34,10 @@ void IFC4X3::IfcSIPrefix::getStepParameter( std::stringstream& stream, bool is_s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSIPrefix::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSIPrefix> IFC4X3::IfcSIPrefix::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSIPrefix>(); }
@@ -106,3 +110,12 @@ shared_ptr<IFC4X3::IfcSIPrefix> IFC4X3::IfcSIPrefix::createObjectFromSTEP( const
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSIPrefix> IFC4X3::IfcSIPrefix::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_TERA ) { return shared_ptr<IfcSIPrefix>(); }
+		return shared_ptr<IfcSIPrefix>( new IfcSIPrefix( IfcSIPrefixEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
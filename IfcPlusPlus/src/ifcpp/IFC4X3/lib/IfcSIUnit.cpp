@@ -34,6 +34,15 @@ void IFC4X3::IfcSIUnit::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 3 ){m_Name = IfcSIUnitName::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSIUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSIUnit::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Dimensions, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_UnitType = IfcUnitEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Prefix = IfcSIPrefix::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Name = IfcSIUnitName::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSIUnit, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSIUnit::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcNamedUnit::getAttributes( vec_attributes );
@@ -44,6 +53,16 @@ void IFC4X3::IfcSIUnit::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcNamedUnit::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSIUnit::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributes( visitor );
+	visitor.visitObject( 2, "Prefix", m_Prefix );
+	visitor.visitObject( 3, "Name", m_Name );
+}
+void IFC4X3::IfcSIUnit::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcNamedUnit::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSIUnit::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcNamedUnit::setInverseCounterparts( ptr_self_entity );
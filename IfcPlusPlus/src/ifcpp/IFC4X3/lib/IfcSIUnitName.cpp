@@ -48,6 +48,10 @@ void IFC4X3::IfcSIUnitName::getStepParameter( std::stringstream& stream, bool is
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSIUnitName::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSIUnitName> IFC4X3::IfcSIUnitName::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSIUnitName>(); }
@@ -176,3 +180,12 @@ shared_ptr<IFC4X3::IfcSIUnitName> IFC4X3::IfcSIUnitName::createObjectFromSTEP( c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSIUnitName> IFC4X3::IfcSIUnitName::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_WEBER ) { return shared_ptr<IfcSIUnitName>(); }
+		return shared_ptr<IfcSIUnitName>( new IfcSIUnitName( IfcSIUnitNameEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
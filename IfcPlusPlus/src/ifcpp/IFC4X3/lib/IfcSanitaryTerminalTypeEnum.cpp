@@ -30,6 +30,10 @@ void IFC4X3::IfcSanitaryTerminalTypeEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSanitaryTerminalTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSanitaryTerminalTypeEnum> IFC4X3::IfcSanitaryTerminalTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSanitaryTerminalTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcSanitaryTerminalTypeEnum> IFC4X3::IfcSanitaryTerminalTypeE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSanitaryTerminalTypeEnum> IFC4X3::IfcSanitaryTerminalTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcSanitaryTerminalTypeEnum>(); }
+		return shared_ptr<IfcSanitaryTerminalTypeEnum>( new IfcSanitaryTerminalTypeEnum( IfcSanitaryTerminalTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
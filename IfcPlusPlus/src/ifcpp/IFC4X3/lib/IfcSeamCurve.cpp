@@ -32,6 +32,14 @@ void IFC4X3::IfcSeamCurve::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 2 ){m_MasterRepresentation = IfcPreferredSurfaceCurveRepresentation::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSeamCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSeamCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Curve3D, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_AssociatedGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_MasterRepresentation = IfcPreferredSurfaceCurveRepresentation::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSeamCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSeamCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurfaceCurve::getAttributes( vec_attributes );
@@ -40,6 +48,14 @@ void IFC4X3::IfcSeamCurve::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcSurfaceCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSeamCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceCurve::visitAttributes( visitor );
+}
+void IFC4X3::IfcSeamCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSeamCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurfaceCurve::setInverseCounterparts( ptr_self_entity );
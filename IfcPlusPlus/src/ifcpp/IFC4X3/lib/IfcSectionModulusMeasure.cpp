@@ -18,6 +18,10 @@ void IFC4X3::IfcSectionModulusMeasure::getStepParameter( std::stringstream& stre
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSectionModulusMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcSectionModulusMeasure> IFC4X3::IfcSectionModulusMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSectionModulusMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcSectionModulusMeasure> IFC4X3::IfcSectionModulusMeasure::c
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSectionModulusMeasure> IFC4X3::IfcSectionModulusMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcSectionModulusMeasure>(); }
+	shared_ptr<IfcSectionModulusMeasure> type_object( new IfcSectionModulusMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
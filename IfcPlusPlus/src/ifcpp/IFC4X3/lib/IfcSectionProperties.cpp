@@ -30,6 +30,14 @@ void IFC4X3::IfcSectionProperties::readStepArguments( const std::vector<std::str
 	if( num_args > 2 ){readEntityReference( args[2], m_EndProfile, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionProperties, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_SectionType = IfcSectionTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_StartProfile, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_EndProfile, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionProperties, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributes( vec_attributes );
@@ -41,6 +49,17 @@ void IFC4X3::IfcSectionProperties::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributes( visitor );
+	visitor.visitObject( 0, "SectionType", m_SectionType );
+	visitor.visitObject( 1, "StartProfile", m_StartProfile );
+	visitor.visitObject( 2, "EndProfile", m_EndProfile );
+}
+void IFC4X3::IfcSectionProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedProperties::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +68,15 @@ void IFC4X3::IfcSectionProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedProperties::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedProperties::getEntityReferences( refs );
+	if( m_StartProfile )
+	{
+		refs.push_back( m_StartProfile.get() );
+	}
+	if( m_EndProfile )
+	{
+		refs.push_back( m_EndProfile.get() );
+	}
+}
@@ -41,6 +41,17 @@ void IFC4X3::IfcSectionReinforcementProperties::readStepArguments( const std::ve
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_CrossSectionReinforcementDefinitions, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSectionReinforcementProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionReinforcementProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_LongitudinalStartPosition = IfcLengthMeasure::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LongitudinalEndPosition = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TransversePosition = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ReinforcementRole = IfcReinforcingBarRoleEnum::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_SectionDefinition, map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_CrossSectionReinforcementDefinitions, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSectionReinforcementProperties, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionReinforcementProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributes( vec_attributes );
@@ -57,6 +68,20 @@ void IFC4X3::IfcSectionReinforcementProperties::getAttributesInverse( std::vecto
 {
 	IFC4X3::IfcPreDefinedProperties::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionReinforcementProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributes( visitor );
+	visitor.visitObject( 0, "LongitudinalStartPosition", m_LongitudinalStartPosition );
+	visitor.visitObject( 1, "LongitudinalEndPosition", m_LongitudinalEndPosition );
+	visitor.visitObject( 2, "TransversePosition", m_TransversePosition );
+	visitor.visitObject( 3, "ReinforcementRole", m_ReinforcementRole );
+	visitor.visitObject( 4, "SectionDefinition", m_SectionDefinition );
+	visitor.visitList( 5, "CrossSectionReinforcementDefinitions", AttributeVectorView<IfcReinforcementBarProperties>( m_CrossSectionReinforcementDefinitions ) );
+}
+void IFC4X3::IfcSectionReinforcementProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedProperties::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionReinforcementProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedProperties::setInverseCounterparts( ptr_self_entity );
@@ -65,3 +90,18 @@ void IFC4X3::IfcSectionReinforcementProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedProperties::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionReinforcementProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedProperties::getEntityReferences( refs );
+	if( m_SectionDefinition )
+	{
+		refs.push_back( m_SectionDefinition.get() );
+	}
+	for( size_t i=0; i<m_CrossSectionReinforcementDefinitions.size(); ++i )
+	{
+		if( m_CrossSectionReinforcementDefinitions[i] )
+		{
+			refs.push_back( m_CrossSectionReinforcementDefinitions[i].get() );
+		}
+	}
+}
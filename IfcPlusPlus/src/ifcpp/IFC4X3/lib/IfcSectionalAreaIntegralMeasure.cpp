@@ -18,6 +18,10 @@ void IFC4X3::IfcSectionalAreaIntegralMeasure::getStepParameter( std::stringstrea
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSectionalAreaIntegralMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcSectionalAreaIntegralMeasure> IFC4X3::IfcSectionalAreaIntegralMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSectionalAreaIntegralMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcSectionalAreaIntegralMeasure> IFC4X3::IfcSectionalAreaInte
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSectionalAreaIntegralMeasure> IFC4X3::IfcSectionalAreaIntegralMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcSectionalAreaIntegralMeasure>(); }
+	shared_ptr<IfcSectionalAreaIntegralMeasure> type_object( new IfcSectionalAreaIntegralMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcSectionedSolid::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){readEntityReferenceList( args[1], m_CrossSections, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSectionedSolid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionedSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_CrossSections, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSectionedSolid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionedSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSolidModel::getAttributes( vec_attributes );
@@ -40,6 +47,16 @@ void IFC4X3::IfcSectionedSolid::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSolidModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionedSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributes( visitor );
+	visitor.visitObject( 0, "Directrix", m_Directrix );
+	visitor.visitList( 1, "CrossSections", AttributeVectorView<IfcProfileDef>( m_CrossSections ) );
+}
+void IFC4X3::IfcSectionedSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionedSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSolidModel::setInverseCounterparts( ptr_self_entity );
@@ -48,3 +65,18 @@ void IFC4X3::IfcSectionedSolid::unlinkFromInverseCounterparts()
 {
 	IfcSolidModel::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionedSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSolidModel::getEntityReferences( refs );
+	if( m_Directrix )
+	{
+		refs.push_back( m_Directrix.get() );
+	}
+	for( size_t i=0; i<m_CrossSections.size(); ++i )
+	{
+		if( m_CrossSections[i] )
+		{
+			refs.push_back( m_CrossSections[i].get() );
+		}
+	}
+}
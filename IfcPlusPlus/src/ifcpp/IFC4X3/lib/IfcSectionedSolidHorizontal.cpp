@@ -32,6 +32,14 @@ void IFC4X3::IfcSectionedSolidHorizontal::readStepArguments( const std::vector<s
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSectionPositions, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSolidHorizontal, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionedSolidHorizontal::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_CrossSections, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSectionPositions, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSolidHorizontal, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionedSolidHorizontal::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSectionedSolid::getAttributes( vec_attributes );
@@ -43,6 +51,15 @@ void IFC4X3::IfcSectionedSolidHorizontal::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcSectionedSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionedSolidHorizontal::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSectionedSolid::visitAttributes( visitor );
+	visitor.visitList( 2, "CrossSectionPositions", AttributeVectorView<IfcAxis2PlacementLinear>( m_CrossSectionPositions ) );
+}
+void IFC4X3::IfcSectionedSolidHorizontal::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSectionedSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionedSolidHorizontal::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSectionedSolid::setInverseCounterparts( ptr_self_entity );
@@ -51,3 +68,14 @@ void IFC4X3::IfcSectionedSolidHorizontal::unlinkFromInverseCounterparts()
 {
 	IfcSectionedSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionedSolidHorizontal::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSectionedSolid::getEntityReferences( refs );
+	for( size_t i=0; i<m_CrossSectionPositions.size(); ++i )
+	{
+		if( m_CrossSectionPositions[i] )
+		{
+			refs.push_back( m_CrossSectionPositions[i].get() );
+		}
+	}
+}
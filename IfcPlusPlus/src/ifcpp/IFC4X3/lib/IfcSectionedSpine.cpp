@@ -32,6 +32,14 @@ void IFC4X3::IfcSectionedSpine::readStepArguments( const std::vector<std::string
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSectionPositions, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSpine, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionedSpine::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SpineCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_CrossSections, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSectionPositions, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSpine, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionedSpine::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -47,6 +55,17 @@ void IFC4X3::IfcSectionedSpine::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionedSpine::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "SpineCurve", m_SpineCurve );
+	visitor.visitList( 1, "CrossSections", AttributeVectorView<IfcProfileDef>( m_CrossSections ) );
+	visitor.visitList( 2, "CrossSectionPositions", AttributeVectorView<IfcAxis2Placement3D>( m_CrossSectionPositions ) );
+}
+void IFC4X3::IfcSectionedSpine::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionedSpine::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +74,25 @@ void IFC4X3::IfcSectionedSpine::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionedSpine::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	if( m_SpineCurve )
+	{
+		refs.push_back( m_SpineCurve.get() );
+	}
+	for( size_t i=0; i<m_CrossSections.size(); ++i )
+	{
+		if( m_CrossSections[i] )
+		{
+			refs.push_back( m_CrossSections[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_CrossSectionPositions.size(); ++i )
+	{
+		if( m_CrossSectionPositions[i] )
+		{
+			refs.push_back( m_CrossSectionPositions[i].get() );
+		}
+	}
+}
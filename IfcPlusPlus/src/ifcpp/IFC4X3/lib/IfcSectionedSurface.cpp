@@ -32,6 +32,14 @@ void IFC4X3::IfcSectionedSurface::readStepArguments( const std::vector<std::stri
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSections, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSectionedSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_CrossSectionPositions, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_CrossSections, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSectionedSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSectionedSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurface::getAttributes( vec_attributes );
@@ -47,6 +55,17 @@ void IFC4X3::IfcSectionedSurface::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSectionedSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "Directrix", m_Directrix );
+	visitor.visitList( 1, "CrossSectionPositions", AttributeVectorView<IfcAxis2PlacementLinear>( m_CrossSectionPositions ) );
+	visitor.visitList( 2, "CrossSections", AttributeVectorView<IfcProfileDef>( m_CrossSections ) );
+}
+void IFC4X3::IfcSectionedSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSectionedSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurface::setInverseCounterparts( ptr_self_entity );
@@ -55,3 +74,25 @@ void IFC4X3::IfcSectionedSurface::unlinkFromInverseCounterparts()
 {
 	IfcSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSectionedSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSurface::getEntityReferences( refs );
+	if( m_Directrix )
+	{
+		refs.push_back( m_Directrix.get() );
+	}
+	for( size_t i=0; i<m_CrossSectionPositions.size(); ++i )
+	{
+		if( m_CrossSectionPositions[i] )
+		{
+			refs.push_back( m_CrossSectionPositions[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_CrossSections.size(); ++i )
+	{
+		if( m_CrossSections[i] )
+		{
+			refs.push_back( m_CrossSections[i].get() );
+		}
+	}
+}
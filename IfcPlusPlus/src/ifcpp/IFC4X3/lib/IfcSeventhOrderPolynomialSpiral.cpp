@@ -49,6 +49,20 @@ void IFC4X3::IfcSeventhOrderPolynomialSpiral::readStepArguments( const std::vect
 	if( num_args > 8 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcSeventhOrderPolynomialSpiral, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSeventhOrderPolynomialSpiral::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SepticTerm = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SexticTerm = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_QuinticTerm = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_QuarticTerm = IfcLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_CubicTerm = IfcLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_QuadraticTerm = IfcLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LinearTerm = IfcLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcSeventhOrderPolynomialSpiral, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSeventhOrderPolynomialSpiral::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpiral::getAttributes( vec_attributes );
@@ -65,6 +79,22 @@ void IFC4X3::IfcSeventhOrderPolynomialSpiral::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcSpiral::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSeventhOrderPolynomialSpiral::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributes( visitor );
+	visitor.visitObject( 1, "SepticTerm", m_SepticTerm );
+	visitor.visitObject( 2, "SexticTerm", m_SexticTerm );
+	visitor.visitObject( 3, "QuinticTerm", m_QuinticTerm );
+	visitor.visitObject( 4, "QuarticTerm", m_QuarticTerm );
+	visitor.visitObject( 5, "CubicTerm", m_CubicTerm );
+	visitor.visitObject( 6, "QuadraticTerm", m_QuadraticTerm );
+	visitor.visitObject( 7, "LinearTerm", m_LinearTerm );
+	visitor.visitObject( 8, "ConstantTerm", m_ConstantTerm );
+}
+void IFC4X3::IfcSeventhOrderPolynomialSpiral::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSeventhOrderPolynomialSpiral::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpiral::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcLogical.h"
@@ -41,6 +42,16 @@ void IFC4X3::IfcShapeAspect::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){m_PartOfProductDefinitionShape = IfcProductRepresentationSelect::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcShapeAspect, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcShapeAspect::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_ShapeRepresentations, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Name = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ProductDefinitional = IfcLogical::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_PartOfProductDefinitionShape = IfcProductRepresentationSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcShapeAspect, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcShapeAspect::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> ShapeRepresentations_vec_object( new AttributeObjectVector() );
@@ -63,6 +74,18 @@ void IFC4X3::IfcShapeAspect::getAttributesInverse( std::vector<std::pair<std::st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasExternalReferences_inverse", HasExternalReferences_inverse_vec_obj ) );
 }
+void IFC4X3::IfcShapeAspect::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "ShapeRepresentations", AttributeVectorView<IfcShapeModel>( m_ShapeRepresentations ) );
+	visitor.visitObject( 1, "Name", m_Name );
+	visitor.visitObject( 2, "Description", m_Description );
+	visitor.visitObject( 3, "ProductDefinitional", m_ProductDefinitional );
+	visitor.visitObject( 4, "PartOfProductDefinitionShape", m_PartOfProductDefinitionShape );
+}
+void IFC4X3::IfcShapeAspect::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "HasExternalReferences_inverse", AttributeInverseVectorView<IfcExternalReferenceRelationship>( m_HasExternalReferences_inverse ) );
+}
 void IFC4X3::IfcShapeAspect::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcShapeAspect> ptr_self = dynamic_pointer_cast<IfcShapeAspect>( ptr_self_entity );
@@ -85,6 +108,26 @@ void IFC4X3::IfcShapeAspect::setInverseCounterparts( shared_ptr<BuildingEntity>
 		}
 	}
 }
+void IFC4X3::IfcShapeAspect::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	shared_ptr<IfcProductDefinitionShape>  PartOfProductDefinitionShape_IfcProductDefinitionShape = dynamic_pointer_cast<IfcProductDefinitionShape>( m_PartOfProductDefinitionShape );
+	if( PartOfProductDefinitionShape_IfcProductDefinitionShape )
+	{
+		refs.emplace_back( PartOfProductDefinitionShape_IfcProductDefinitionShape.get(), INVERSE_HasShapeAspects );
+	}
+	shared_ptr<IfcRepresentationMap>  PartOfProductDefinitionShape_IfcRepresentationMap = dynamic_pointer_cast<IfcRepresentationMap>( m_PartOfProductDefinitionShape );
+	if( PartOfProductDefinitionShape_IfcRepresentationMap )
+	{
+		refs.emplace_back( PartOfProductDefinitionShape_IfcRepresentationMap.get(), INVERSE_HasShapeAspects );
+	}
+	for( size_t i=0; i<m_ShapeRepresentations.size(); ++i )
+	{
+		if( m_ShapeRepresentations[i] )
+		{
+			refs.emplace_back( m_ShapeRepresentations[i].get(), INVERSE_OfShapeAspect );
+		}
+	}
+}
 void IFC4X3::IfcShapeAspect::unlinkFromInverseCounterparts()
 {
 	shared_ptr<IfcProductDefinitionShape>  PartOfProductDefinitionShape_IfcProductDefinitionShape = dynamic_pointer_cast<IfcProductDefinitionShape>( m_PartOfProductDefinitionShape );
@@ -159,3 +202,18 @@ void IFC4X3::IfcShapeAspect::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcShapeAspect::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_ShapeRepresentations.size(); ++i )
+	{
+		if( m_ShapeRepresentations[i] )
+		{
+			refs.push_back( m_ShapeRepresentations[i].get() );
+		}
+	}
+	BuildingEntity* PartOfProductDefinitionShape_entity = dynamic_cast<BuildingEntity*>( m_PartOfProductDefinitionShape.get() );
+	if( PartOfProductDefinitionShape_entity )
+	{
+		refs.push_back( PartOfProductDefinitionShape_entity );
+	}
+}
@@ -37,6 +37,15 @@ void IFC4X3::IfcShapeModel::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcShapeModel, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcShapeModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ContextOfItems, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepresentationIdentifier = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_RepresentationType = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcShapeModel, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcShapeModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRepresentation::getAttributes( vec_attributes );
@@ -54,6 +63,15 @@ void IFC4X3::IfcShapeModel::getAttributesInverse( std::vector<std::pair<std::str
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "OfShapeAspect_inverse", OfShapeAspect_inverse_vec_obj ) );
 }
+void IFC4X3::IfcShapeModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentation::visitAttributes( visitor );
+}
+void IFC4X3::IfcShapeModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentation::visitAttributesInverse( visitor );
+	visitor.visitList( 3, "OfShapeAspect_inverse", AttributeInverseVectorView<IfcShapeAspect>( m_OfShapeAspect_inverse ) );
+}
 void IFC4X3::IfcShapeModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRepresentation::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcShearModulusMeasure::getStepParameter( std::stringstream& stream
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcShearModulusMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcShearModulusMeasure> IFC4X3::IfcShearModulusMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcShearModulusMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcShearModulusMeasure> IFC4X3::IfcShearModulusMeasure::creat
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcShearModulusMeasure> IFC4X3::IfcShearModulusMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcShearModulusMeasure>(); }
+	shared_ptr<IfcShearModulusMeasure> type_object( new IfcShearModulusMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -41,6 +41,12 @@ void IFC4X3::IfcShellBasedSurfaceModel::readStepArguments( const std::vector<std
 	if( num_args > 0 ){readSelectList( args[0], m_SbsmBoundary, "IFCSHELL", map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcShellBasedSurfaceModel, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcShellBasedSurfaceModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_SbsmBoundary, "IFCSHELL", map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcShellBasedSurfaceModel, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcShellBasedSurfaceModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributes( vec_attributes );
@@ -52,6 +58,15 @@ void IFC4X3::IfcShellBasedSurfaceModel::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcGeometricRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcShellBasedSurfaceModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "SbsmBoundary", AttributeVectorView<IfcShell>( m_SbsmBoundary ) );
+}
+void IFC4X3::IfcShellBasedSurfaceModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGeometricRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcShellBasedSurfaceModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGeometricRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +75,15 @@ void IFC4X3::IfcShellBasedSurfaceModel::unlinkFromInverseCounterparts()
 {
 	IfcGeometricRepresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcShellBasedSurfaceModel::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGeometricRepresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_SbsmBoundary.size(); ++i )
+	{
+		BuildingEntity* SbsmBoundary_entity = dynamic_cast<BuildingEntity*>( m_SbsmBoundary[i].get() );
+		if( SbsmBoundary_entity )
+		{
+			refs.push_back( SbsmBoundary_entity );
+		}
+	}
+}
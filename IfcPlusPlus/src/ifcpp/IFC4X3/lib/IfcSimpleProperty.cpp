@@ -32,6 +32,13 @@ void IFC4X3::IfcSimpleProperty::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){m_Specification = IfcText::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSimpleProperty, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSimpleProperty::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Specification = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSimpleProperty, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSimpleProperty::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProperty::getAttributes( vec_attributes );
@@ -40,6 +47,14 @@ void IFC4X3::IfcSimpleProperty::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcProperty::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSimpleProperty::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProperty::visitAttributes( visitor );
+}
+void IFC4X3::IfcSimpleProperty::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProperty::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSimpleProperty::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProperty::setInverseCounterparts( ptr_self_entity );
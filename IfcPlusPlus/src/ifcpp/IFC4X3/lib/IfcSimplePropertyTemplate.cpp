@@ -66,6 +66,23 @@ void IFC4X3::IfcSimplePropertyTemplate::readStepArguments( const std::vector<std
 	if( num_args > 11 ){m_AccessState = IfcStateEnum::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcSimplePropertyTemplate, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSimplePropertyTemplate::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_TemplateType = IfcSimplePropertyTemplateTypeEnum::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PrimaryMeasureType = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_SecondaryMeasureType = IfcLabel::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_Enumerators, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PrimaryUnit = IfcUnit::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_SecondaryUnit = IfcUnit::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_Expression = IfcLabel::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_AccessState = IfcStateEnum::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcSimplePropertyTemplate, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSimplePropertyTemplate::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPropertyTemplate::getAttributes( vec_attributes );
@@ -82,6 +99,22 @@ void IFC4X3::IfcSimplePropertyTemplate::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcPropertyTemplate::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSimplePropertyTemplate::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplate::visitAttributes( visitor );
+	visitor.visitObject( 4, "TemplateType", m_TemplateType );
+	visitor.visitObject( 5, "PrimaryMeasureType", m_PrimaryMeasureType );
+	visitor.visitObject( 6, "SecondaryMeasureType", m_SecondaryMeasureType );
+	visitor.visitObject( 7, "Enumerators", m_Enumerators );
+	visitor.visitObject( 8, "PrimaryUnit", m_PrimaryUnit );
+	visitor.visitObject( 9, "SecondaryUnit", m_SecondaryUnit );
+	visitor.visitObject( 10, "Expression", m_Expression );
+	visitor.visitObject( 11, "AccessState", m_AccessState );
+}
+void IFC4X3::IfcSimplePropertyTemplate::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPropertyTemplate::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSimplePropertyTemplate::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPropertyTemplate::setInverseCounterparts( ptr_self_entity );
@@ -90,3 +123,21 @@ void IFC4X3::IfcSimplePropertyTemplate::unlinkFromInverseCounterparts()
 {
 	IfcPropertyTemplate::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSimplePropertyTemplate::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPropertyTemplate::getEntityReferences( refs );
+	if( m_Enumerators )
+	{
+		refs.push_back( m_Enumerators.get() );
+	}
+	BuildingEntity* PrimaryUnit_entity = dynamic_cast<BuildingEntity*>( m_PrimaryUnit.get() );
+	if( PrimaryUnit_entity )
+	{
+		refs.push_back( PrimaryUnit_entity );
+	}
+	BuildingEntity* SecondaryUnit_entity = dynamic_cast<BuildingEntity*>( m_SecondaryUnit.get() );
+	if( SecondaryUnit_entity )
+	{
+		refs.push_back( SecondaryUnit_entity );
+	}
+}
@@ -31,6 +31,10 @@ void IFC4X3::IfcSimplePropertyTemplateTypeEnum::getStepParameter( std::stringstr
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSimplePropertyTemplateTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSimplePropertyTemplateTypeEnum> IFC4X3::IfcSimplePropertyTemplateTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSimplePropertyTemplateTypeEnum>(); }
@@ -91,3 +95,12 @@ shared_ptr<IFC4X3::IfcSimplePropertyTemplateTypeEnum> IFC4X3::IfcSimplePropertyT
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSimplePropertyTemplateTypeEnum> IFC4X3::IfcSimplePropertyTemplateTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_Q_WEIGHT ) { return shared_ptr<IfcSimplePropertyTemplateTypeEnum>(); }
+		return shared_ptr<IfcSimplePropertyTemplateTypeEnum>( new IfcSimplePropertyTemplateTypeEnum( IfcSimplePropertyTemplateTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
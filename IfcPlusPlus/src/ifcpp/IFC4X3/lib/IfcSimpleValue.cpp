@@ -37,3 +37,10 @@ shared_ptr<IFC4X3::IfcSimpleValue> IFC4X3::IfcSimpleValue::createObjectFromSTEP(
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcSimpleValue> IFC4X3::IfcSimpleValue::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcSimpleValue>(); }
+	shared_ptr<IfcSimpleValue> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -34,6 +34,15 @@ void IFC4X3::IfcSineSpiral::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 3 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSineSpiral, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSineSpiral::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Position = IfcAxis2Placement::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SineTerm = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_LinearTerm = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ConstantTerm = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSineSpiral, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSineSpiral::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpiral::getAttributes( vec_attributes );
@@ -45,6 +54,17 @@ void IFC4X3::IfcSineSpiral::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcSpiral::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSineSpiral::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributes( visitor );
+	visitor.visitObject( 1, "SineTerm", m_SineTerm );
+	visitor.visitObject( 2, "LinearTerm", m_LinearTerm );
+	visitor.visitObject( 3, "ConstantTerm", m_ConstantTerm );
+}
+void IFC4X3::IfcSineSpiral::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpiral::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSineSpiral::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpiral::setInverseCounterparts( ptr_self_entity );
@@ -84,6 +84,25 @@ void IFC4X3::IfcSite::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 13 ){readEntityReference( args[13], m_SiteAddress, map, errorStream, entityIdNotFound );}
 	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcSite, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSite::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_CompositionType = IfcElementCompositionEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_RefLatitude = IfcCompoundPlaneAngleMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_RefLongitude = IfcCompoundPlaneAngleMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_RefElevation = IfcLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_LandTitleNumber = IfcLabel::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){readEntityReference( args[13], m_SiteAddress, map, errorStream, entityIdNotFound );}
+	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcSite, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSite::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSpatialStructureElement::getAttributes( vec_attributes );
@@ -97,6 +116,19 @@ void IFC4X3::IfcSite::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcSpatialStructureElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSite::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialStructureElement::visitAttributes( visitor );
+	visitor.visitObject( 9, "RefLatitude", m_RefLatitude );
+	visitor.visitObject( 10, "RefLongitude", m_RefLongitude );
+	visitor.visitObject( 11, "RefElevation", m_RefElevation );
+	visitor.visitObject( 12, "LandTitleNumber", m_LandTitleNumber );
+	visitor.visitObject( 13, "SiteAddress", m_SiteAddress );
+}
+void IFC4X3::IfcSite::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSpatialStructureElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSite::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSpatialStructureElement::setInverseCounterparts( ptr_self_entity );
@@ -105,3 +137,11 @@ void IFC4X3::IfcSite::unlinkFromInverseCounterparts()
 {
 	IfcSpatialStructureElement::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSite::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSpatialStructureElement::getEntityReferences( refs );
+	if( m_SiteAddress )
+	{
+		refs.push_back( m_SiteAddress.get() );
+	}
+}
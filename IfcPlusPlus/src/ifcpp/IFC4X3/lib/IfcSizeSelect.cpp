@@ -27,3 +27,10 @@ shared_ptr<IFC4X3::IfcSizeSelect> IFC4X3::IfcSizeSelect::createObjectFromSTEP( c
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcSizeSelect> IFC4X3::IfcSizeSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcSizeSelect>(); }
+	shared_ptr<IfcSizeSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
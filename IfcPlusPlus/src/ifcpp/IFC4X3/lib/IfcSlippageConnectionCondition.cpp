@@ -32,6 +32,15 @@ void IFC4X3::IfcSlippageConnectionCondition::readStepArguments( const std::vecto
 	if( num_args > 3 ){m_SlippageZ = IfcLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSlippageConnectionCondition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSlippageConnectionCondition::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_SlippageX = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_SlippageY = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SlippageZ = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSlippageConnectionCondition, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSlippageConnectionCondition::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralConnectionCondition::getAttributes( vec_attributes );
@@ -43,6 +52,17 @@ void IFC4X3::IfcSlippageConnectionCondition::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcStructuralConnectionCondition::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSlippageConnectionCondition::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnectionCondition::visitAttributes( visitor );
+	visitor.visitObject( 1, "SlippageX", m_SlippageX );
+	visitor.visitObject( 2, "SlippageY", m_SlippageY );
+	visitor.visitObject( 3, "SlippageZ", m_SlippageZ );
+}
+void IFC4X3::IfcSlippageConnectionCondition::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnectionCondition::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSlippageConnectionCondition::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralConnectionCondition::setInverseCounterparts( ptr_self_entity );
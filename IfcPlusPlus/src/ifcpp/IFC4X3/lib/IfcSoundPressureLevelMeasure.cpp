@@ -18,6 +18,10 @@ void IFC4X3::IfcSoundPressureLevelMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSoundPressureLevelMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcSoundPressureLevelMeasure> IFC4X3::IfcSoundPressureLevelMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSoundPressureLevelMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcSoundPressureLevelMeasure> IFC4X3::IfcSoundPressureLevelMe
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSoundPressureLevelMeasure> IFC4X3::IfcSoundPressureLevelMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcSoundPressureLevelMeasure>(); }
+	shared_ptr<IfcSoundPressureLevelMeasure> type_object( new IfcSoundPressureLevelMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
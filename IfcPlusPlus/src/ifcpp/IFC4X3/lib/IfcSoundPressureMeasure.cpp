@@ -18,6 +18,10 @@ void IFC4X3::IfcSoundPressureMeasure::getStepParameter( std::stringstream& strea
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSoundPressureMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcSoundPressureMeasure> IFC4X3::IfcSoundPressureMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSoundPressureMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcSoundPressureMeasure> IFC4X3::IfcSoundPressureMeasure::cre
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSoundPressureMeasure> IFC4X3::IfcSoundPressureMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcSoundPressureMeasure>(); }
+	shared_ptr<IfcSoundPressureMeasure> type_object( new IfcSoundPressureMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -62,6 +62,19 @@ void IFC4X3::IfcSpatialElement::readStepArguments( const std::vector<std::string
 	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcSpatialElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSpatialElement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongName = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcSpatialElement, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSpatialElement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProduct::getAttributes( vec_attributes );
@@ -116,6 +129,20 @@ void IFC4X3::IfcSpatialElement::getAttributesInverse( std::vector<std::pair<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "InterferesElements_inverse", InterferesElements_inverse_vec_obj ) );
 }
+void IFC4X3::IfcSpatialElement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributes( visitor );
+	visitor.visitObject( 7, "LongName", m_LongName );
+}
+void IFC4X3::IfcSpatialElement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProduct::visitAttributesInverse( visitor );
+	visitor.visitList( 14, "ContainsElements_inverse", AttributeInverseVectorView<IfcRelContainedInSpatialStructure>( m_ContainsElements_inverse ) );
+	visitor.visitList( 15, "ServicedBySystems_inverse", AttributeInverseVectorView<IfcRelServicesBuildings>( m_ServicedBySystems_inverse ) );
+	visitor.visitList( 16, "ReferencesElements_inverse", AttributeInverseVectorView<IfcRelReferencedInSpatialStructure>( m_ReferencesElements_inverse ) );
+	visitor.visitList( 17, "IsInterferedByElements_inverse", AttributeInverseVectorView<IfcRelInterferesElements>( m_IsInterferedByElements_inverse ) );
+	visitor.visitList( 18, "InterferesElements_inverse", AttributeInverseVectorView<IfcRelInterferesElements>( m_InterferesElements_inverse ) );
+}
 void IFC4X3::IfcSpatialElement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProduct::setInverseCounterparts( ptr_self_entity );
@@ -30,6 +30,10 @@ void IFC4X3::IfcSpatialZoneTypeEnum::getStepParameter( std::stringstream& stream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSpatialZoneTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSpatialZoneTypeEnum> IFC4X3::IfcSpatialZoneTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSpatialZoneTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcSpatialZoneTypeEnum> IFC4X3::IfcSpatialZoneTypeEnum::creat
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSpatialZoneTypeEnum> IFC4X3::IfcSpatialZoneTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcSpatialZoneTypeEnum>(); }
+		return shared_ptr<IfcSpatialZoneTypeEnum>( new IfcSpatialZoneTypeEnum( IfcSpatialZoneTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
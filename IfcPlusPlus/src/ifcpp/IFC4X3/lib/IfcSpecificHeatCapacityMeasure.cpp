@@ -18,6 +18,10 @@ void IFC4X3::IfcSpecificHeatCapacityMeasure::getStepParameter( std::stringstream
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSpecificHeatCapacityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcSpecificHeatCapacityMeasure> IFC4X3::IfcSpecificHeatCapacityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSpecificHeatCapacityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcSpecificHeatCapacityMeasure> IFC4X3::IfcSpecificHeatCapaci
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSpecificHeatCapacityMeasure> IFC4X3::IfcSpecificHeatCapacityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcSpecificHeatCapacityMeasure>(); }
+	shared_ptr<IfcSpecificHeatCapacityMeasure> type_object( new IfcSpecificHeatCapacityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
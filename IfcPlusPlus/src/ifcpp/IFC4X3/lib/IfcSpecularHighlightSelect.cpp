@@ -23,3 +23,10 @@ shared_ptr<IFC4X3::IfcSpecularHighlightSelect> IFC4X3::IfcSpecularHighlightSelec
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcSpecularHighlightSelect> IFC4X3::IfcSpecularHighlightSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcSpecularHighlightSelect>(); }
+	shared_ptr<IfcSpecularHighlightSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcSphere::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSphere, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSphere::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSphere, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSphere::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributes( vec_attributes );
@@ -37,6 +44,15 @@ void IFC4X3::IfcSphere::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcCsgPrimitive3D::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSphere::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributes( visitor );
+	visitor.visitObject( 1, "Radius", m_Radius );
+}
+void IFC4X3::IfcSphere::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCsgPrimitive3D::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSphere::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCsgPrimitive3D::setInverseCounterparts( ptr_self_entity );
@@ -28,6 +28,13 @@ void IFC4X3::IfcSphericalSurface::readStepArguments( const std::vector<std::stri
 	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSphericalSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSphericalSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSphericalSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSphericalSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcElementarySurface::getAttributes( vec_attributes );
@@ -37,6 +44,15 @@ void IFC4X3::IfcSphericalSurface::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcElementarySurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSphericalSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributes( visitor );
+	visitor.visitObject( 1, "Radius", m_Radius );
+}
+void IFC4X3::IfcSphericalSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSphericalSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcElementarySurface::setInverseCounterparts( ptr_self_entity );
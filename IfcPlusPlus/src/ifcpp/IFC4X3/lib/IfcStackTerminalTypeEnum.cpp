@@ -23,6 +23,10 @@ void IFC4X3::IfcStackTerminalTypeEnum::getStepParameter( std::stringstream& stre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcStackTerminalTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcStackTerminalTypeEnum> IFC4X3::IfcStackTerminalTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcStackTerminalTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcStackTerminalTypeEnum> IFC4X3::IfcStackTerminalTypeEnum::c
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcStackTerminalTypeEnum> IFC4X3::IfcStackTerminalTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcStackTerminalTypeEnum>(); }
+		return shared_ptr<IfcStackTerminalTypeEnum>( new IfcStackTerminalTypeEnum( IfcStackTerminalTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
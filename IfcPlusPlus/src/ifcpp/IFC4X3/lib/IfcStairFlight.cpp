@@ -88,6 +88,24 @@ void IFC4X3::IfcStairFlight::readStepArguments( const std::vector<std::string>&
 	if( num_args > 12 ){m_PredefinedType = IfcStairFlightTypeEnum::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcStairFlight, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStairFlight::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_NumberOfRisers = IfcInteger::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_NumberOfTreads = IfcInteger::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_RiserHeight = IfcPositiveLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_TreadLength = IfcPositiveLengthMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_PredefinedType = IfcStairFlightTypeEnum::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcStairFlight, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStairFlight::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBuiltElement::getAttributes( vec_attributes );
@@ -101,6 +119,19 @@ void IFC4X3::IfcStairFlight::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcBuiltElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStairFlight::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElement::visitAttributes( visitor );
+	visitor.visitObject( 8, "NumberOfRisers", m_NumberOfRisers );
+	visitor.visitObject( 9, "NumberOfTreads", m_NumberOfTreads );
+	visitor.visitObject( 10, "RiserHeight", m_RiserHeight );
+	visitor.visitObject( 11, "TreadLength", m_TreadLength );
+	visitor.visitObject( 12, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcStairFlight::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBuiltElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStairFlight::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBuiltElement::setInverseCounterparts( ptr_self_entity );
@@ -25,6 +25,10 @@ void IFC4X3::IfcStairFlightTypeEnum::getStepParameter( std::stringstream& stream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcStairFlightTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcStairFlightTypeEnum> IFC4X3::IfcStairFlightTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcStairFlightTypeEnum>(); }
@@ -61,3 +65,12 @@ shared_ptr<IFC4X3::IfcStairFlightTypeEnum> IFC4X3::IfcStairFlightTypeEnum::creat
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcStairFlightTypeEnum> IFC4X3::IfcStairFlightTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcStairFlightTypeEnum>(); }
+		return shared_ptr<IfcStairFlightTypeEnum>( new IfcStairFlightTypeEnum( IfcStairFlightTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
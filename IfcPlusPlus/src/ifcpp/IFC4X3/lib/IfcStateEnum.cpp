@@ -23,6 +23,10 @@ void IFC4X3::IfcStateEnum::getStepParameter( std::stringstream& stream, bool is_
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcStateEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcStateEnum> IFC4X3::IfcStateEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcStateEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcStateEnum> IFC4X3::IfcStateEnum::createObjectFromSTEP( con
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcStateEnum> IFC4X3::IfcStateEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_READWRITELOCKED ) { return shared_ptr<IfcStateEnum>(); }
+		return shared_ptr<IfcStateEnum>( new IfcStateEnum( IfcStateEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
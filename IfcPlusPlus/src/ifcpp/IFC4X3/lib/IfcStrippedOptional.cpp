@@ -24,6 +24,10 @@ void IFC4X3::IfcStrippedOptional::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcStrippedOptional::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeBool( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcStrippedOptional> IFC4X3::IfcStrippedOptional::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcStrippedOptional>(); }
@@ -33,3 +37,10 @@ shared_ptr<IFC4X3::IfcStrippedOptional> IFC4X3::IfcStrippedOptional::createObjec
 	readBool( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcStrippedOptional> IFC4X3::IfcStrippedOptional::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcStrippedOptional>(); }
+	shared_ptr<IfcStrippedOptional> type_object( new IfcStrippedOptional() );
+	readBool( arg, type_object->m_value );
+	return type_object;
+}
@@ -69,6 +69,21 @@ void IFC4X3::IfcStructuralAction::readStepArguments( const std::vector<std::stri
 	if( num_args > 9 ){m_DestabilizingLoad = IfcBoolean::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralAction, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralAction::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AppliedLoad, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_GlobalOrLocal = IfcGlobalOrLocalEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_DestabilizingLoad = IfcBoolean::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralAction, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralAction::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralActivity::getAttributes( vec_attributes );
@@ -78,6 +93,15 @@ void IFC4X3::IfcStructuralAction::getAttributesInverse( std::vector<std::pair<st
 {
 	IFC4X3::IfcStructuralActivity::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralAction::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralActivity::visitAttributes( visitor );
+	visitor.visitObject( 9, "DestabilizingLoad", m_DestabilizingLoad );
+}
+void IFC4X3::IfcStructuralAction::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralActivity::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralAction::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralActivity::setInverseCounterparts( ptr_self_entity );
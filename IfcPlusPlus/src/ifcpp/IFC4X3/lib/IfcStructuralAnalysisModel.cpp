@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAnalysisModelTypeEnum.h"
 #include "ifcpp/IFC4X3/include/IfcAxis2Placement3D.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -68,6 +69,21 @@ void IFC4X3::IfcStructuralAnalysisModel::readStepArguments( const std::vector<st
 	if( num_args > 9 ){readEntityReference( args[9], m_SharedPlacement, map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralAnalysisModel, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralAnalysisModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PredefinedType = IfcAnalysisModelTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_OrientationOf2DPlane, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_LoadedBy, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReferenceList( args[8], m_HasResults, map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){readEntityReference( args[9], m_SharedPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralAnalysisModel, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralAnalysisModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSystem::getAttributes( vec_attributes );
@@ -85,6 +101,19 @@ void IFC4X3::IfcStructuralAnalysisModel::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralAnalysisModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributes( visitor );
+	visitor.visitObject( 5, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 6, "OrientationOf2DPlane", m_OrientationOf2DPlane );
+	visitor.visitList( 7, "LoadedBy", AttributeVectorView<IfcStructuralLoadGroup>( m_LoadedBy ) );
+	visitor.visitList( 8, "HasResults", AttributeVectorView<IfcStructuralResultGroup>( m_HasResults ) );
+	visitor.visitObject( 9, "SharedPlacement", m_SharedPlacement );
+}
+void IFC4X3::IfcStructuralAnalysisModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralAnalysisModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSystem::setInverseCounterparts( ptr_self_entity );
@@ -105,6 +134,24 @@ void IFC4X3::IfcStructuralAnalysisModel::setInverseCounterparts( shared_ptr<Buil
 		}
 	}
 }
+void IFC4X3::IfcStructuralAnalysisModel::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcSystem::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasResults.size(); ++i )
+	{
+		if( m_HasResults[i] )
+		{
+			refs.emplace_back( m_HasResults[i].get(), INVERSE_ResultGroupFor );
+		}
+	}
+	for( size_t i=0; i<m_LoadedBy.size(); ++i )
+	{
+		if( m_LoadedBy[i] )
+		{
+			refs.emplace_back( m_LoadedBy[i].get(), INVERSE_LoadGroupFor );
+		}
+	}
+}
 void IFC4X3::IfcStructuralAnalysisModel::unlinkFromInverseCounterparts()
 {
 	IfcSystem::unlinkFromInverseCounterparts();
@@ -159,3 +206,29 @@ void IFC4X3::IfcStructuralAnalysisModel::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcStructuralAnalysisModel::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSystem::getEntityReferences( refs );
+	if( m_OrientationOf2DPlane )
+	{
+		refs.push_back( m_OrientationOf2DPlane.get() );
+	}
+	for( size_t i=0; i<m_LoadedBy.size(); ++i )
+	{
+		if( m_LoadedBy[i] )
+		{
+			refs.push_back( m_LoadedBy[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_HasResults.size(); ++i )
+	{
+		if( m_HasResults[i] )
+		{
+			refs.push_back( m_HasResults[i].get() );
+		}
+	}
+	if( m_SharedPlacement )
+	{
+		refs.push_back( m_SharedPlacement.get() );
+	}
+}
@@ -62,6 +62,19 @@ void IFC4X3::IfcStructuralConnection::readStepArguments( const std::vector<std::
 	if( num_args > 7 ){readEntityReference( args[7], m_AppliedCondition, map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralConnection, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralConnection::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AppliedCondition, map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralConnection, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralConnection::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralItem::getAttributes( vec_attributes );
@@ -80,6 +93,16 @@ void IFC4X3::IfcStructuralConnection::getAttributesInverse( std::vector<std::pai
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ConnectsStructuralMembers_inverse", ConnectsStructuralMembers_inverse_vec_obj ) );
 }
+void IFC4X3::IfcStructuralConnection::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralItem::visitAttributes( visitor );
+	visitor.visitObject( 7, "AppliedCondition", m_AppliedCondition );
+}
+void IFC4X3::IfcStructuralConnection::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralItem::visitAttributesInverse( visitor );
+	visitor.visitList( 15, "ConnectsStructuralMembers_inverse", AttributeInverseVectorView<IfcRelConnectsStructuralMember>( m_ConnectsStructuralMembers_inverse ) );
+}
 void IFC4X3::IfcStructuralConnection::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralItem::setInverseCounterparts( ptr_self_entity );
@@ -88,3 +111,11 @@ void IFC4X3::IfcStructuralConnection::unlinkFromInverseCounterparts()
 {
 	IfcStructuralItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcStructuralConnection::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcStructuralItem::getEntityReferences( refs );
+	if( m_AppliedCondition )
+	{
+		refs.push_back( m_AppliedCondition.get() );
+	}
+}
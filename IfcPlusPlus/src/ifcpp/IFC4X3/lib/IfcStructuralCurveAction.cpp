@@ -77,6 +77,23 @@ void IFC4X3::IfcStructuralCurveAction::readStepArguments( const std::vector<std:
 	if( num_args > 11 ){m_PredefinedType = IfcStructuralCurveActivityTypeEnum::createObjectFromSTEP( args[11], map, errorStream, entityIdNotFound );}
 	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveAction, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralCurveAction::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AppliedLoad, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_GlobalOrLocal = IfcGlobalOrLocalEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_DestabilizingLoad = IfcBoolean::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_ProjectedOrTrue = IfcProjectedOrTrueLengthEnum::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_PredefinedType = IfcStructuralCurveActivityTypeEnum::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args != 12 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveAction, expecting 12, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralCurveAction::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralAction::getAttributes( vec_attributes );
@@ -87,6 +104,16 @@ void IFC4X3::IfcStructuralCurveAction::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcStructuralAction::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralCurveAction::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralAction::visitAttributes( visitor );
+	visitor.visitObject( 10, "ProjectedOrTrue", m_ProjectedOrTrue );
+	visitor.visitObject( 11, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcStructuralCurveAction::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralAction::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralCurveAction::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralAction::setInverseCounterparts( ptr_self_entity );
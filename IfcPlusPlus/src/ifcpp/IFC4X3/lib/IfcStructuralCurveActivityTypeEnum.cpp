@@ -27,6 +27,10 @@ void IFC4X3::IfcStructuralCurveActivityTypeEnum::getStepParameter( std::stringst
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcStructuralCurveActivityTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcStructuralCurveActivityTypeEnum> IFC4X3::IfcStructuralCurveActivityTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcStructuralCurveActivityTypeEnum>(); }
@@ -71,3 +75,12 @@ shared_ptr<IFC4X3::IfcStructuralCurveActivityTypeEnum> IFC4X3::IfcStructuralCurv
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcStructuralCurveActivityTypeEnum> IFC4X3::IfcStructuralCurveActivityTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcStructuralCurveActivityTypeEnum>(); }
+		return shared_ptr<IfcStructuralCurveActivityTypeEnum>( new IfcStructuralCurveActivityTypeEnum( IfcStructuralCurveActivityTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -66,6 +66,20 @@ void IFC4X3::IfcStructuralCurveMember::readStepArguments( const std::vector<std:
 	if( num_args > 8 ){readEntityReference( args[8], m_Axis, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveMember, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralCurveMember::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcStructuralCurveMemberTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_Axis, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveMember, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralCurveMember::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralMember::getAttributes( vec_attributes );
@@ -76,6 +90,16 @@ void IFC4X3::IfcStructuralCurveMember::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcStructuralMember::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralCurveMember::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralMember::visitAttributes( visitor );
+	visitor.visitObject( 7, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 8, "Axis", m_Axis );
+}
+void IFC4X3::IfcStructuralCurveMember::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralMember::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralCurveMember::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralMember::setInverseCounterparts( ptr_self_entity );
@@ -84,3 +108,11 @@ void IFC4X3::IfcStructuralCurveMember::unlinkFromInverseCounterparts()
 {
 	IfcStructuralMember::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcStructuralCurveMember::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcStructuralMember::getEntityReferences( refs );
+	if( m_Axis )
+	{
+		refs.push_back( m_Axis.get() );
+	}
+}
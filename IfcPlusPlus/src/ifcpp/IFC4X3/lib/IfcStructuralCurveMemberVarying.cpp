@@ -66,6 +66,20 @@ void IFC4X3::IfcStructuralCurveMemberVarying::readStepArguments( const std::vect
 	if( num_args > 8 ){readEntityReference( args[8], m_Axis, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveMemberVarying, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralCurveMemberVarying::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcStructuralCurveMemberTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_Axis, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralCurveMemberVarying, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralCurveMemberVarying::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralCurveMember::getAttributes( vec_attributes );
@@ -74,6 +88,14 @@ void IFC4X3::IfcStructuralCurveMemberVarying::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcStructuralCurveMember::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralCurveMemberVarying::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralCurveMember::visitAttributes( visitor );
+}
+void IFC4X3::IfcStructuralCurveMemberVarying::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralCurveMember::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralCurveMemberVarying::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralCurveMember::setInverseCounterparts( ptr_self_entity );
@@ -71,6 +71,22 @@ void IFC4X3::IfcStructuralLoadCase::readStepArguments( const std::vector<std::st
 	if( num_args > 10 ){readTypeOfRealList( args[10], m_SelfWeightCoefficients );}
 	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadCase, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadCase::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PredefinedType = IfcLoadGroupTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ActionType = IfcActionTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_ActionSource = IfcActionSourceTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_Coefficient = IfcRatioMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Purpose = IfcLabel::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){readTypeOfRealList( args[10], m_SelfWeightCoefficients );}
+	if( num_args != 11 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadCase, expecting 11, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadCase::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadGroup::getAttributes( vec_attributes );
@@ -82,6 +98,15 @@ void IFC4X3::IfcStructuralLoadCase::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcStructuralLoadGroup::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadCase::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadGroup::visitAttributes( visitor );
+	visitor.visitList( 10, "SelfWeightCoefficients", AttributeVectorView<IfcRatioMeasure>( m_SelfWeightCoefficients ) );
+}
+void IFC4X3::IfcStructuralLoadCase::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadGroup::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadCase::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadGroup::setInverseCounterparts( ptr_self_entity );
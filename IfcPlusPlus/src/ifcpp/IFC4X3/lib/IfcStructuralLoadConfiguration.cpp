@@ -30,6 +30,14 @@ void IFC4X3::IfcStructuralLoadConfiguration::readStepArguments( const std::vecto
 	if( num_args > 2 ){readTypeOfRealList2D( args[2], m_Locations );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadConfiguration, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadConfiguration::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Values, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readTypeOfRealList2D( args[2], m_Locations );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadConfiguration, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadConfiguration::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoad::getAttributes( vec_attributes );
@@ -50,6 +58,16 @@ void IFC4X3::IfcStructuralLoadConfiguration::getAttributesInverse( std::vector<s
 {
 	IFC4X3::IfcStructuralLoad::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadConfiguration::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoad::visitAttributes( visitor );
+	visitor.visitList( 1, "Values", AttributeVectorView<IfcStructuralLoadOrResult>( m_Values ) );
+	visitor.visitList2D( 2, "Locations", AttributeVector2DView<IfcLengthMeasure>( m_Locations ) );
+}
+void IFC4X3::IfcStructuralLoadConfiguration::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoad::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadConfiguration::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoad::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +76,14 @@ void IFC4X3::IfcStructuralLoadConfiguration::unlinkFromInverseCounterparts()
 {
 	IfcStructuralLoad::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcStructuralLoadConfiguration::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcStructuralLoad::getEntityReferences( refs );
+	for( size_t i=0; i<m_Values.size(); ++i )
+	{
+		if( m_Values[i] )
+		{
+			refs.push_back( m_Values[i].get() );
+		}
+	}
+}
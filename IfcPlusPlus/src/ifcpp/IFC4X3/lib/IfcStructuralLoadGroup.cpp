@@ -68,6 +68,21 @@ void IFC4X3::IfcStructuralLoadGroup::readStepArguments( const std::vector<std::s
 	if( num_args > 9 ){m_Purpose = IfcLabel::createObjectFromSTEP( args[9], map, errorStream, entityIdNotFound );}
 	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadGroup, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadGroup::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_PredefinedType = IfcLoadGroupTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ActionType = IfcActionTypeEnum::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_ActionSource = IfcActionSourceTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_Coefficient = IfcRatioMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Purpose = IfcLabel::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args != 10 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadGroup, expecting 10, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadGroup::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGroup::getAttributes( vec_attributes );
@@ -99,6 +114,21 @@ void IFC4X3::IfcStructuralLoadGroup::getAttributesInverse( std::vector<std::pair
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "LoadGroupFor_inverse", LoadGroupFor_inverse_vec_obj ) );
 }
+void IFC4X3::IfcStructuralLoadGroup::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributes( visitor );
+	visitor.visitObject( 5, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 6, "ActionType", m_ActionType );
+	visitor.visitObject( 7, "ActionSource", m_ActionSource );
+	visitor.visitObject( 8, "Coefficient", m_Coefficient );
+	visitor.visitObject( 9, "Purpose", m_Purpose );
+}
+void IFC4X3::IfcStructuralLoadGroup::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributesInverse( visitor );
+	visitor.visitList( 13, "SourceOfResultGroup_inverse", AttributeInverseVectorView<IfcStructuralResultGroup>( m_SourceOfResultGroup_inverse ) );
+	visitor.visitList( 14, "LoadGroupFor_inverse", AttributeInverseVectorView<IfcStructuralAnalysisModel>( m_LoadGroupFor_inverse ) );
+}
 void IFC4X3::IfcStructuralLoadGroup::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGroup::setInverseCounterparts( ptr_self_entity );
@@ -42,6 +42,18 @@ void IFC4X3::IfcStructuralLoadLinearForce::readStepArguments( const std::vector<
 	if( num_args > 6 ){m_LinearMomentZ = IfcLinearMomentMeasure::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadLinearForce, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadLinearForce::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_LinearForceX = IfcLinearForceMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_LinearForceY = IfcLinearForceMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_LinearForceZ = IfcLinearForceMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_LinearMomentX = IfcLinearMomentMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LinearMomentY = IfcLinearMomentMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LinearMomentZ = IfcLinearMomentMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadLinearForce, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadLinearForce::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributes( vec_attributes );
@@ -56,6 +68,20 @@ void IFC4X3::IfcStructuralLoadLinearForce::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadLinearForce::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributes( visitor );
+	visitor.visitObject( 1, "LinearForceX", m_LinearForceX );
+	visitor.visitObject( 2, "LinearForceY", m_LinearForceY );
+	visitor.visitObject( 3, "LinearForceZ", m_LinearForceZ );
+	visitor.visitObject( 4, "LinearMomentX", m_LinearMomentX );
+	visitor.visitObject( 5, "LinearMomentY", m_LinearMomentY );
+	visitor.visitObject( 6, "LinearMomentZ", m_LinearMomentZ );
+}
+void IFC4X3::IfcStructuralLoadLinearForce::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadLinearForce::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadStatic::setInverseCounterparts( ptr_self_entity );
@@ -22,6 +22,12 @@ void IFC4X3::IfcStructuralLoadOrResult::readStepArguments( const std::vector<std
 	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadOrResult, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadOrResult::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadOrResult, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadOrResult::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoad::getAttributes( vec_attributes );
@@ -30,6 +36,14 @@ void IFC4X3::IfcStructuralLoadOrResult::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcStructuralLoad::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadOrResult::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoad::visitAttributes( visitor );
+}
+void IFC4X3::IfcStructuralLoadOrResult::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoad::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadOrResult::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoad::setInverseCounterparts( ptr_self_entity );
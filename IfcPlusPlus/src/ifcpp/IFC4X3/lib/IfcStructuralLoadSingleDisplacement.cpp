@@ -42,6 +42,18 @@ void IFC4X3::IfcStructuralLoadSingleDisplacement::readStepArguments( const std::
 	if( num_args > 6 ){m_RotationalDisplacementRZ = IfcPlaneAngleMeasure::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleDisplacement, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadSingleDisplacement::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DisplacementX = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_DisplacementY = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_DisplacementZ = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RotationalDisplacementRX = IfcPlaneAngleMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RotationalDisplacementRY = IfcPlaneAngleMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RotationalDisplacementRZ = IfcPlaneAngleMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleDisplacement, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadSingleDisplacement::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributes( vec_attributes );
@@ -56,6 +68,20 @@ void IFC4X3::IfcStructuralLoadSingleDisplacement::getAttributesInverse( std::vec
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadSingleDisplacement::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributes( visitor );
+	visitor.visitObject( 1, "DisplacementX", m_DisplacementX );
+	visitor.visitObject( 2, "DisplacementY", m_DisplacementY );
+	visitor.visitObject( 3, "DisplacementZ", m_DisplacementZ );
+	visitor.visitObject( 4, "RotationalDisplacementRX", m_RotationalDisplacementRX );
+	visitor.visitObject( 5, "RotationalDisplacementRY", m_RotationalDisplacementRY );
+	visitor.visitObject( 6, "RotationalDisplacementRZ", m_RotationalDisplacementRZ );
+}
+void IFC4X3::IfcStructuralLoadSingleDisplacement::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadSingleDisplacement::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadStatic::setInverseCounterparts( ptr_self_entity );
@@ -46,6 +46,19 @@ void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::readStepArguments( c
 	if( num_args > 7 ){m_Distortion = IfcCurvatureMeasure::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleDisplacementDistortion, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DisplacementX = IfcLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_DisplacementY = IfcLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_DisplacementZ = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_RotationalDisplacementRX = IfcPlaneAngleMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_RotationalDisplacementRY = IfcPlaneAngleMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_RotationalDisplacementRZ = IfcPlaneAngleMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Distortion = IfcCurvatureMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleDisplacementDistortion, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadSingleDisplacement::getAttributes( vec_attributes );
@@ -55,6 +68,15 @@ void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::getAttributesInverse
 {
 	IFC4X3::IfcStructuralLoadSingleDisplacement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadSingleDisplacement::visitAttributes( visitor );
+	visitor.visitObject( 7, "Distortion", m_Distortion );
+}
+void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadSingleDisplacement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadSingleDisplacementDistortion::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadSingleDisplacement::setInverseCounterparts( ptr_self_entity );
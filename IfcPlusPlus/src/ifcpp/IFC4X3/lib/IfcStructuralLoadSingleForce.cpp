@@ -42,6 +42,18 @@ void IFC4X3::IfcStructuralLoadSingleForce::readStepArguments( const std::vector<
 	if( num_args > 6 ){m_MomentZ = IfcTorqueMeasure::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleForce, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadSingleForce::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ForceX = IfcForceMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ForceY = IfcForceMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ForceZ = IfcForceMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MomentX = IfcTorqueMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_MomentY = IfcTorqueMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_MomentZ = IfcTorqueMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleForce, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadSingleForce::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributes( vec_attributes );
@@ -56,6 +68,20 @@ void IFC4X3::IfcStructuralLoadSingleForce::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadSingleForce::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributes( visitor );
+	visitor.visitObject( 1, "ForceX", m_ForceX );
+	visitor.visitObject( 2, "ForceY", m_ForceY );
+	visitor.visitObject( 3, "ForceZ", m_ForceZ );
+	visitor.visitObject( 4, "MomentX", m_MomentX );
+	visitor.visitObject( 5, "MomentY", m_MomentY );
+	visitor.visitObject( 6, "MomentZ", m_MomentZ );
+}
+void IFC4X3::IfcStructuralLoadSingleForce::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadSingleForce::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadStatic::setInverseCounterparts( ptr_self_entity );
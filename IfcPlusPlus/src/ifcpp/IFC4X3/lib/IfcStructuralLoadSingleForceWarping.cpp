@@ -46,6 +46,19 @@ void IFC4X3::IfcStructuralLoadSingleForceWarping::readStepArguments( const std::
 	if( num_args > 7 ){m_WarpingMoment = IfcWarpingMomentMeasure::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleForceWarping, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadSingleForceWarping::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_ForceX = IfcForceMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_ForceY = IfcForceMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_ForceZ = IfcForceMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MomentX = IfcTorqueMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_MomentY = IfcTorqueMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_MomentZ = IfcTorqueMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_WarpingMoment = IfcWarpingMomentMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadSingleForceWarping, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadSingleForceWarping::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadSingleForce::getAttributes( vec_attributes );
@@ -55,6 +68,15 @@ void IFC4X3::IfcStructuralLoadSingleForceWarping::getAttributesInverse( std::vec
 {
 	IFC4X3::IfcStructuralLoadSingleForce::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadSingleForceWarping::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadSingleForce::visitAttributes( visitor );
+	visitor.visitObject( 7, "WarpingMoment", m_WarpingMoment );
+}
+void IFC4X3::IfcStructuralLoadSingleForceWarping::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadSingleForce::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadSingleForceWarping::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadSingleForce::setInverseCounterparts( ptr_self_entity );
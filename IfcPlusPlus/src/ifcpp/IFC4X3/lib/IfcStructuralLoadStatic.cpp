@@ -22,6 +22,12 @@ void IFC4X3::IfcStructuralLoadStatic::readStepArguments( const std::vector<std::
 	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromSTEP( args[0], map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadStatic, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadStatic::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadStatic, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadStatic::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadOrResult::getAttributes( vec_attributes );
@@ -30,6 +36,14 @@ void IFC4X3::IfcStructuralLoadStatic::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcStructuralLoadOrResult::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadStatic::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadOrResult::visitAttributes( visitor );
+}
+void IFC4X3::IfcStructuralLoadStatic::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadOrResult::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadStatic::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadOrResult::setInverseCounterparts( ptr_self_entity );
@@ -32,6 +32,15 @@ void IFC4X3::IfcStructuralLoadTemperature::readStepArguments( const std::vector<
 	if( num_args > 3 ){m_DeltaTZ = IfcThermodynamicTemperatureMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadTemperature, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralLoadTemperature::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DeltaTConstant = IfcThermodynamicTemperatureMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_DeltaTY = IfcThermodynamicTemperatureMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_DeltaTZ = IfcThermodynamicTemperatureMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcStructuralLoadTemperature, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralLoadTemperature::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributes( vec_attributes );
@@ -43,6 +52,17 @@ void IFC4X3::IfcStructuralLoadTemperature::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcStructuralLoadStatic::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralLoadTemperature::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributes( visitor );
+	visitor.visitObject( 1, "DeltaTConstant", m_DeltaTConstant );
+	visitor.visitObject( 2, "DeltaTY", m_DeltaTY );
+	visitor.visitObject( 3, "DeltaTZ", m_DeltaTZ );
+}
+void IFC4X3::IfcStructuralLoadTemperature::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadStatic::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralLoadTemperature::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadStatic::setInverseCounterparts( ptr_self_entity );
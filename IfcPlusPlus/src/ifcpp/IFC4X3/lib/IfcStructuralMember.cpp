@@ -58,6 +58,18 @@ void IFC4X3::IfcStructuralMember::readStepArguments( const std::vector<std::stri
 	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralMember, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralMember::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcStructuralMember, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralMember::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralItem::getAttributes( vec_attributes );
@@ -75,6 +87,15 @@ void IFC4X3::IfcStructuralMember::getAttributesInverse( std::vector<std::pair<st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ConnectedBy_inverse", ConnectedBy_inverse_vec_obj ) );
 }
+void IFC4X3::IfcStructuralMember::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralItem::visitAttributes( visitor );
+}
+void IFC4X3::IfcStructuralMember::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralItem::visitAttributesInverse( visitor );
+	visitor.visitList( 15, "ConnectedBy_inverse", AttributeInverseVectorView<IfcRelConnectsStructuralMember>( m_ConnectedBy_inverse ) );
+}
 void IFC4X3::IfcStructuralMember::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralItem::setInverseCounterparts( ptr_self_entity );
@@ -66,6 +66,20 @@ void IFC4X3::IfcStructuralPointConnection::readStepArguments( const std::vector<
 	if( num_args > 8 ){readEntityReference( args[8], m_ConditionCoordinateSystem, map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralPointConnection, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralPointConnection::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReference( args[7], m_AppliedCondition, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readEntityReference( args[8], m_ConditionCoordinateSystem, map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralPointConnection, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralPointConnection::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralConnection::getAttributes( vec_attributes );
@@ -75,6 +89,15 @@ void IFC4X3::IfcStructuralPointConnection::getAttributesInverse( std::vector<std
 {
 	IFC4X3::IfcStructuralConnection::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralPointConnection::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnection::visitAttributes( visitor );
+	visitor.visitObject( 8, "ConditionCoordinateSystem", m_ConditionCoordinateSystem );
+}
+void IFC4X3::IfcStructuralPointConnection::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralConnection::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralPointConnection::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralConnection::setInverseCounterparts( ptr_self_entity );
@@ -83,3 +106,11 @@ void IFC4X3::IfcStructuralPointConnection::unlinkFromInverseCounterparts()
 {
 	IfcStructuralConnection::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcStructuralPointConnection::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcStructuralConnection::getEntityReferences( refs );
+	if( m_ConditionCoordinateSystem )
+	{
+		refs.push_back( m_ConditionCoordinateSystem.get() );
+	}
+}
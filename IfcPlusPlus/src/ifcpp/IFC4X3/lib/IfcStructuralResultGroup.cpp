@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcAnalysisTheoryTypeEnum.h"
 #include "ifcpp/IFC4X3/include/IfcBoolean.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
@@ -60,6 +61,19 @@ void IFC4X3::IfcStructuralResultGroup::readStepArguments( const std::vector<std:
 	if( num_args > 7 ){m_IsLinear = IfcBoolean::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralResultGroup, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralResultGroup::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_TheoryType = IfcAnalysisTheoryTypeEnum::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_ResultForLoadGroup, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_IsLinear = IfcBoolean::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcStructuralResultGroup, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralResultGroup::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGroup::getAttributes( vec_attributes );
@@ -80,6 +94,18 @@ void IFC4X3::IfcStructuralResultGroup::getAttributesInverse( std::vector<std::pa
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ResultGroupFor_inverse", ResultGroupFor_inverse_vec_obj ) );
 }
+void IFC4X3::IfcStructuralResultGroup::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributes( visitor );
+	visitor.visitObject( 5, "TheoryType", m_TheoryType );
+	visitor.visitObject( 6, "ResultForLoadGroup", m_ResultForLoadGroup );
+	visitor.visitObject( 7, "IsLinear", m_IsLinear );
+}
+void IFC4X3::IfcStructuralResultGroup::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributesInverse( visitor );
+	visitor.visitList( 13, "ResultGroupFor_inverse", AttributeInverseVectorView<IfcStructuralAnalysisModel>( m_ResultGroupFor_inverse ) );
+}
 void IFC4X3::IfcStructuralResultGroup::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGroup::setInverseCounterparts( ptr_self_entity );
@@ -90,6 +116,14 @@ void IFC4X3::IfcStructuralResultGroup::setInverseCounterparts( shared_ptr<Buildi
 		m_ResultForLoadGroup->m_SourceOfResultGroup_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcStructuralResultGroup::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcGroup::getInverseReferences( refs );
+	if( m_ResultForLoadGroup )
+	{
+		refs.emplace_back( m_ResultForLoadGroup.get(), INVERSE_SourceOfResultGroup );
+	}
+}
 void IFC4X3::IfcStructuralResultGroup::unlinkFromInverseCounterparts()
 {
 	IfcGroup::unlinkFromInverseCounterparts();
@@ -116,3 +150,11 @@ void IFC4X3::IfcStructuralResultGroup::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcStructuralResultGroup::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcGroup::getEntityReferences( refs );
+	if( m_ResultForLoadGroup )
+	{
+		refs.push_back( m_ResultForLoadGroup.get() );
+	}
+}
@@ -66,6 +66,20 @@ void IFC4X3::IfcStructuralSurfaceMemberVarying::readStepArguments( const std::ve
 	if( num_args > 8 ){m_Thickness = IfcPositiveLengthMeasure::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralSurfaceMemberVarying, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStructuralSurfaceMemberVarying::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_PredefinedType = IfcStructuralSurfaceMemberTypeEnum::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_Thickness = IfcPositiveLengthMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcStructuralSurfaceMemberVarying, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStructuralSurfaceMemberVarying::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralSurfaceMember::getAttributes( vec_attributes );
@@ -74,6 +88,14 @@ void IFC4X3::IfcStructuralSurfaceMemberVarying::getAttributesInverse( std::vecto
 {
 	IFC4X3::IfcStructuralSurfaceMember::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStructuralSurfaceMemberVarying::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralSurfaceMember::visitAttributes( visitor );
+}
+void IFC4X3::IfcStructuralSurfaceMemberVarying::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralSurfaceMember::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStructuralSurfaceMemberVarying::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralSurfaceMember::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
 #include "ifcpp/IFC4X3/include/IfcPresentationLayerAssignment.h"
 #include "ifcpp/IFC4X3/include/IfcPresentationStyle.h"
@@ -31,6 +32,14 @@ void IFC4X3::IfcStyledItem::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcStyledItem, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStyledItem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Item, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Styles, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcStyledItem, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStyledItem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcRepresentationItem::getAttributes( vec_attributes );
@@ -44,6 +53,17 @@ void IFC4X3::IfcStyledItem::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcRepresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStyledItem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Item", m_Item );
+	visitor.visitList( 1, "Styles", AttributeVectorView<IfcPresentationStyle>( m_Styles ) );
+	visitor.visitObject( 2, "Name", m_Name );
+}
+void IFC4X3::IfcStyledItem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcRepresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStyledItem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcRepresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -54,6 +74,14 @@ void IFC4X3::IfcStyledItem::setInverseCounterparts( shared_ptr<BuildingEntity> p
 		m_Item->m_StyledByItem_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcStyledItem::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcRepresentationItem::getInverseReferences( refs );
+	if( m_Item )
+	{
+		refs.emplace_back( m_Item.get(), INVERSE_StyledByItem );
+	}
+}
 void IFC4X3::IfcStyledItem::unlinkFromInverseCounterparts()
 {
 	IfcRepresentationItem::unlinkFromInverseCounterparts();
@@ -80,3 +108,18 @@ void IFC4X3::IfcStyledItem::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcStyledItem::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcRepresentationItem::getEntityReferences( refs );
+	if( m_Item )
+	{
+		refs.push_back( m_Item.get() );
+	}
+	for( size_t i=0; i<m_Styles.size(); ++i )
+	{
+		if( m_Styles[i] )
+		{
+			refs.push_back( m_Styles[i].get() );
+		}
+	}
+}
@@ -36,6 +36,15 @@ void IFC4X3::IfcStyledRepresentation::readStepArguments( const std::vector<std::
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcStyledRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcStyledRepresentation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ContextOfItems, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepresentationIdentifier = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_RepresentationType = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcStyledRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcStyledRepresentation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStyleModel::getAttributes( vec_attributes );
@@ -44,6 +53,14 @@ void IFC4X3::IfcStyledRepresentation::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcStyleModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcStyledRepresentation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStyleModel::visitAttributes( visitor );
+}
+void IFC4X3::IfcStyledRepresentation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStyleModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcStyledRepresentation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStyleModel::setInverseCounterparts( ptr_self_entity );
@@ -31,6 +31,14 @@ void IFC4X3::IfcSubedge::readStepArguments( const std::vector<std::string>& args
 	if( num_args > 2 ){readEntityReference( args[2], m_ParentEdge, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSubedge, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSubedge::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_EdgeStart, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_EdgeEnd, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ParentEdge, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSubedge, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSubedge::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcEdge::getAttributes( vec_attributes );
@@ -40,6 +48,15 @@ void IFC4X3::IfcSubedge::getAttributesInverse( std::vector<std::pair<std::string
 {
 	IFC4X3::IfcEdge::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSubedge::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributes( visitor );
+	visitor.visitObject( 2, "ParentEdge", m_ParentEdge );
+}
+void IFC4X3::IfcSubedge::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcEdge::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSubedge::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcEdge::setInverseCounterparts( ptr_self_entity );
@@ -48,3 +65,11 @@ void IFC4X3::IfcSubedge::unlinkFromInverseCounterparts()
 {
 	IfcEdge::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSubedge::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcEdge::getEntityReferences( refs );
+	if( m_ParentEdge )
+	{
+		refs.push_back( m_ParentEdge.get() );
+	}
+}
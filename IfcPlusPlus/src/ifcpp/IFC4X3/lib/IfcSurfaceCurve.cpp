@@ -32,6 +32,14 @@ void IFC4X3::IfcSurfaceCurve::readStepArguments( const std::vector<std::string>&
 	if( num_args > 2 ){m_MasterRepresentation = IfcPreferredSurfaceCurveRepresentation::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Curve3D, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_AssociatedGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_MasterRepresentation = IfcPreferredSurfaceCurveRepresentation::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceCurve, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcCurve::getAttributes( vec_attributes );
@@ -45,6 +53,17 @@ void IFC4X3::IfcSurfaceCurve::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "Curve3D", m_Curve3D );
+	visitor.visitList( 1, "AssociatedGeometry", AttributeVectorView<IfcPcurve>( m_AssociatedGeometry ) );
+	visitor.visitObject( 2, "MasterRepresentation", m_MasterRepresentation );
+}
+void IFC4X3::IfcSurfaceCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcCurve::setInverseCounterparts( ptr_self_entity );
@@ -53,3 +72,18 @@ void IFC4X3::IfcSurfaceCurve::unlinkFromInverseCounterparts()
 {
 	IfcCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcCurve::getEntityReferences( refs );
+	if( m_Curve3D )
+	{
+		refs.push_back( m_Curve3D.get() );
+	}
+	for( size_t i=0; i<m_AssociatedGeometry.size(); ++i )
+	{
+		if( m_AssociatedGeometry[i] )
+		{
+			refs.push_back( m_AssociatedGeometry[i].get() );
+		}
+	}
+}
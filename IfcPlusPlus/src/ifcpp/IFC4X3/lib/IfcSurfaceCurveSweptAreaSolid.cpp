@@ -43,6 +43,17 @@ void IFC4X3::IfcSurfaceCurveSweptAreaSolid::readStepArguments( const std::vector
 	if( num_args > 5 ){readEntityReference( args[5], m_ReferenceSurface, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSurfaceCurveSweptAreaSolid, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceCurveSweptAreaSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartParam = IfcCurveMeasureSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EndParam = IfcCurveMeasureSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ReferenceSurface, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSurfaceCurveSweptAreaSolid, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceCurveSweptAreaSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcDirectrixCurveSweptAreaSolid::getAttributes( vec_attributes );
@@ -52,6 +63,15 @@ void IFC4X3::IfcSurfaceCurveSweptAreaSolid::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcDirectrixCurveSweptAreaSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceCurveSweptAreaSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDirectrixCurveSweptAreaSolid::visitAttributes( visitor );
+	visitor.visitObject( 5, "ReferenceSurface", m_ReferenceSurface );
+}
+void IFC4X3::IfcSurfaceCurveSweptAreaSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcDirectrixCurveSweptAreaSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceCurveSweptAreaSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcDirectrixCurveSweptAreaSolid::setInverseCounterparts( ptr_self_entity );
@@ -60,3 +80,11 @@ void IFC4X3::IfcSurfaceCurveSweptAreaSolid::unlinkFromInverseCounterparts()
 {
 	IfcDirectrixCurveSweptAreaSolid::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceCurveSweptAreaSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcDirectrixCurveSweptAreaSolid::getEntityReferences( refs );
+	if( m_ReferenceSurface )
+	{
+		refs.push_back( m_ReferenceSurface.get() );
+	}
+}
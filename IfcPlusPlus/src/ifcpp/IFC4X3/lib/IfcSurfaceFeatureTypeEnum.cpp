@@ -31,6 +31,10 @@ void IFC4X3::IfcSurfaceFeatureTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSurfaceFeatureTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSurfaceFeatureTypeEnum> IFC4X3::IfcSurfaceFeatureTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSurfaceFeatureTypeEnum>(); }
@@ -91,3 +95,12 @@ shared_ptr<IFC4X3::IfcSurfaceFeatureTypeEnum> IFC4X3::IfcSurfaceFeatureTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSurfaceFeatureTypeEnum> IFC4X3::IfcSurfaceFeatureTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcSurfaceFeatureTypeEnum>(); }
+		return shared_ptr<IfcSurfaceFeatureTypeEnum>( new IfcSurfaceFeatureTypeEnum( IfcSurfaceFeatureTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
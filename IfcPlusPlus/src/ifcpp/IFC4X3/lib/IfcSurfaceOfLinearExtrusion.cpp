@@ -36,6 +36,15 @@ void IFC4X3::IfcSurfaceOfLinearExtrusion::readStepArguments( const std::vector<s
 	if( num_args > 3 ){m_Depth = IfcLengthMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceOfLinearExtrusion, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceOfLinearExtrusion::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_ExtrudedDirection, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Depth = IfcLengthMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceOfLinearExtrusion, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceOfLinearExtrusion::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSweptSurface::getAttributes( vec_attributes );
@@ -46,6 +55,16 @@ void IFC4X3::IfcSurfaceOfLinearExtrusion::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcSweptSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceOfLinearExtrusion::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptSurface::visitAttributes( visitor );
+	visitor.visitObject( 2, "ExtrudedDirection", m_ExtrudedDirection );
+	visitor.visitObject( 3, "Depth", m_Depth );
+}
+void IFC4X3::IfcSurfaceOfLinearExtrusion::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceOfLinearExtrusion::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSweptSurface::setInverseCounterparts( ptr_self_entity );
@@ -54,3 +73,11 @@ void IFC4X3::IfcSurfaceOfLinearExtrusion::unlinkFromInverseCounterparts()
 {
 	IfcSweptSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceOfLinearExtrusion::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSweptSurface::getEntityReferences( refs );
+	if( m_ExtrudedDirection )
+	{
+		refs.push_back( m_ExtrudedDirection.get() );
+	}
+}
@@ -32,6 +32,14 @@ void IFC4X3::IfcSurfaceOfRevolution::readStepArguments( const std::vector<std::s
 	if( num_args > 2 ){readEntityReference( args[2], m_AxisPosition, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceOfRevolution, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceOfRevolution::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_AxisPosition, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceOfRevolution, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceOfRevolution::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSweptSurface::getAttributes( vec_attributes );
@@ -41,6 +49,15 @@ void IFC4X3::IfcSurfaceOfRevolution::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcSweptSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceOfRevolution::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptSurface::visitAttributes( visitor );
+	visitor.visitObject( 2, "AxisPosition", m_AxisPosition );
+}
+void IFC4X3::IfcSurfaceOfRevolution::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceOfRevolution::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSweptSurface::setInverseCounterparts( ptr_self_entity );
@@ -49,3 +66,11 @@ void IFC4X3::IfcSurfaceOfRevolution::unlinkFromInverseCounterparts()
 {
 	IfcSweptSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceOfRevolution::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSweptSurface::getEntityReferences( refs );
+	if( m_AxisPosition )
+	{
+		refs.push_back( m_AxisPosition.get() );
+	}
+}
@@ -33,6 +33,15 @@ void IFC4X3::IfcSurfaceReinforcementArea::readStepArguments( const std::vector<s
 	if( num_args > 3 ){m_ShearReinforcement = IfcRatioMeasure::createObjectFromSTEP( args[3], map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceReinforcementArea, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceReinforcementArea::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList( args[1], m_SurfaceReinforcement1 );}
+	if( num_args > 2 ){readTypeOfRealList( args[2], m_SurfaceReinforcement2 );}
+	if( num_args > 3 ){m_ShearReinforcement = IfcRatioMeasure::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceReinforcementArea, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceReinforcementArea::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcStructuralLoadOrResult::getAttributes( vec_attributes );
@@ -48,6 +57,17 @@ void IFC4X3::IfcSurfaceReinforcementArea::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcStructuralLoadOrResult::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceReinforcementArea::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadOrResult::visitAttributes( visitor );
+	visitor.visitList( 1, "SurfaceReinforcement1", AttributeVectorView<IfcLengthMeasure>( m_SurfaceReinforcement1 ) );
+	visitor.visitList( 2, "SurfaceReinforcement2", AttributeVectorView<IfcLengthMeasure>( m_SurfaceReinforcement2 ) );
+	visitor.visitObject( 3, "ShearReinforcement", m_ShearReinforcement );
+}
+void IFC4X3::IfcSurfaceReinforcementArea::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcStructuralLoadOrResult::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceReinforcementArea::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcStructuralLoadOrResult::setInverseCounterparts( ptr_self_entity );
@@ -21,6 +21,10 @@ void IFC4X3::IfcSurfaceSide::getStepParameter( std::stringstream& stream, bool i
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcSurfaceSide::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcSurfaceSide> IFC4X3::IfcSurfaceSide::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcSurfaceSide>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcSurfaceSide> IFC4X3::IfcSurfaceSide::createObjectFromSTEP(
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcSurfaceSide> IFC4X3::IfcSurfaceSide::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_POSITIVE ) { return shared_ptr<IfcSurfaceSide>(); }
+		return shared_ptr<IfcSurfaceSide>( new IfcSurfaceSide( IfcSurfaceSideEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -47,6 +47,14 @@ void IFC4X3::IfcSurfaceStyle::readStepArguments( const std::vector<std::string>&
 	if( num_args > 2 ){readSelectList( args[2], m_Styles, "IFCSURFACESTYLEELEMENTSELECT", map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Side = IfcSurfaceSide::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_Styles, "IFCSURFACESTYLEELEMENTSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyle, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationStyle::getAttributes( vec_attributes );
@@ -59,6 +67,16 @@ void IFC4X3::IfcSurfaceStyle::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcPresentationStyle::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributes( visitor );
+	visitor.visitObject( 1, "Side", m_Side );
+	visitor.visitList( 2, "Styles", AttributeVectorView<IfcSurfaceStyleElementSelect>( m_Styles ) );
+}
+void IFC4X3::IfcSurfaceStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationStyle::setInverseCounterparts( ptr_self_entity );
@@ -67,3 +85,15 @@ void IFC4X3::IfcSurfaceStyle::unlinkFromInverseCounterparts()
 {
 	IfcPresentationStyle::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceStyle::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationStyle::getEntityReferences( refs );
+	for( size_t i=0; i<m_Styles.size(); ++i )
+	{
+		BuildingEntity* Styles_entity = dynamic_cast<BuildingEntity*>( m_Styles[i].get() );
+		if( Styles_entity )
+		{
+			refs.push_back( Styles_entity );
+		}
+	}
+}
@@ -31,6 +31,15 @@ void IFC4X3::IfcSurfaceStyleLighting::readStepArguments( const std::vector<std::
 	if( num_args > 3 ){readEntityReference( args[3], m_ReflectanceColour, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleLighting, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceStyleLighting::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_DiffuseTransmissionColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_DiffuseReflectionColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_TransmissionColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_ReflectanceColour, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleLighting, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceStyleLighting::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -43,6 +52,18 @@ void IFC4X3::IfcSurfaceStyleLighting::getAttributesInverse( std::vector<std::pai
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceStyleLighting::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "DiffuseTransmissionColour", m_DiffuseTransmissionColour );
+	visitor.visitObject( 1, "DiffuseReflectionColour", m_DiffuseReflectionColour );
+	visitor.visitObject( 2, "TransmissionColour", m_TransmissionColour );
+	visitor.visitObject( 3, "ReflectanceColour", m_ReflectanceColour );
+}
+void IFC4X3::IfcSurfaceStyleLighting::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceStyleLighting::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -51,3 +72,23 @@ void IFC4X3::IfcSurfaceStyleLighting::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceStyleLighting::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	if( m_DiffuseTransmissionColour )
+	{
+		refs.push_back( m_DiffuseTransmissionColour.get() );
+	}
+	if( m_DiffuseReflectionColour )
+	{
+		refs.push_back( m_DiffuseReflectionColour.get() );
+	}
+	if( m_TransmissionColour )
+	{
+		refs.push_back( m_TransmissionColour.get() );
+	}
+	if( m_ReflectanceColour )
+	{
+		refs.push_back( m_ReflectanceColour.get() );
+	}
+}
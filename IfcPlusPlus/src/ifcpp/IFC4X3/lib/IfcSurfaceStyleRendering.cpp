@@ -50,6 +50,20 @@ void IFC4X3::IfcSurfaceStyleRendering::readStepArguments( const std::vector<std:
 	if( num_args > 8 ){m_ReflectanceMethod = IfcReflectanceMethodEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleRendering, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceStyleRendering::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SurfaceColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Transparency = IfcNormalisedRatioMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_DiffuseColour = IfcColourOrFactor::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TransmissionColour = IfcColourOrFactor::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_DiffuseTransmissionColour = IfcColourOrFactor::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_ReflectionColour = IfcColourOrFactor::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_SpecularColour = IfcColourOrFactor::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_SpecularHighlight = IfcSpecularHighlightSelect::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ReflectanceMethod = IfcReflectanceMethodEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleRendering, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceStyleRendering::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurfaceStyleShading::getAttributes( vec_attributes );
@@ -65,6 +79,21 @@ void IFC4X3::IfcSurfaceStyleRendering::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcSurfaceStyleShading::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceStyleRendering::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceStyleShading::visitAttributes( visitor );
+	visitor.visitObject( 2, "DiffuseColour", m_DiffuseColour );
+	visitor.visitObject( 3, "TransmissionColour", m_TransmissionColour );
+	visitor.visitObject( 4, "DiffuseTransmissionColour", m_DiffuseTransmissionColour );
+	visitor.visitObject( 5, "ReflectionColour", m_ReflectionColour );
+	visitor.visitObject( 6, "SpecularColour", m_SpecularColour );
+	visitor.visitObject( 7, "SpecularHighlight", m_SpecularHighlight );
+	visitor.visitObject( 8, "ReflectanceMethod", m_ReflectanceMethod );
+}
+void IFC4X3::IfcSurfaceStyleRendering::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurfaceStyleShading::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceStyleRendering::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurfaceStyleShading::setInverseCounterparts( ptr_self_entity );
@@ -73,3 +102,32 @@ void IFC4X3::IfcSurfaceStyleRendering::unlinkFromInverseCounterparts()
 {
 	IfcSurfaceStyleShading::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceStyleRendering::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSurfaceStyleShading::getEntityReferences( refs );
+	BuildingEntity* DiffuseColour_entity = dynamic_cast<BuildingEntity*>( m_DiffuseColour.get() );
+	if( DiffuseColour_entity )
+	{
+		refs.push_back( DiffuseColour_entity );
+	}
+	BuildingEntity* TransmissionColour_entity = dynamic_cast<BuildingEntity*>( m_TransmissionColour.get() );
+	if( TransmissionColour_entity )
+	{
+		refs.push_back( TransmissionColour_entity );
+	}
+	BuildingEntity* DiffuseTransmissionColour_entity = dynamic_cast<BuildingEntity*>( m_DiffuseTransmissionColour.get() );
+	if( DiffuseTransmissionColour_entity )
+	{
+		refs.push_back( DiffuseTransmissionColour_entity );
+	}
+	BuildingEntity* ReflectionColour_entity = dynamic_cast<BuildingEntity*>( m_ReflectionColour.get() );
+	if( ReflectionColour_entity )
+	{
+		refs.push_back( ReflectionColour_entity );
+	}
+	BuildingEntity* SpecularColour_entity = dynamic_cast<BuildingEntity*>( m_SpecularColour.get() );
+	if( SpecularColour_entity )
+	{
+		refs.push_back( SpecularColour_entity );
+	}
+}
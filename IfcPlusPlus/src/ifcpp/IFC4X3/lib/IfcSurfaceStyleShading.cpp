@@ -26,6 +26,13 @@ void IFC4X3::IfcSurfaceStyleShading::readStepArguments( const std::vector<std::s
 	if( num_args > 1 ){m_Transparency = IfcNormalisedRatioMeasure::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleShading, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceStyleShading::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SurfaceColour, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Transparency = IfcNormalisedRatioMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleShading, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceStyleShading::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -36,6 +43,16 @@ void IFC4X3::IfcSurfaceStyleShading::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceStyleShading::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "SurfaceColour", m_SurfaceColour );
+	visitor.visitObject( 1, "Transparency", m_Transparency );
+}
+void IFC4X3::IfcSurfaceStyleShading::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceStyleShading::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -44,3 +61,11 @@ void IFC4X3::IfcSurfaceStyleShading::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceStyleShading::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	if( m_SurfaceColour )
+	{
+		refs.push_back( m_SurfaceColour.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcSurfaceStyleWithTextures.h"
 #include "ifcpp/IFC4X3/include/IfcSurfaceTexture.h"
 
@@ -22,6 +23,12 @@ void IFC4X3::IfcSurfaceStyleWithTextures::readStepArguments( const std::vector<s
 	if( num_args > 0 ){readEntityReferenceList( args[0], m_Textures, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleWithTextures, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceStyleWithTextures::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Textures, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcSurfaceStyleWithTextures, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceStyleWithTextures::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -33,6 +40,15 @@ void IFC4X3::IfcSurfaceStyleWithTextures::getAttributesInverse( std::vector<std:
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSurfaceStyleWithTextures::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitList( 0, "Textures", AttributeVectorView<IfcSurfaceTexture>( m_Textures ) );
+}
+void IFC4X3::IfcSurfaceStyleWithTextures::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSurfaceStyleWithTextures::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -46,6 +62,17 @@ void IFC4X3::IfcSurfaceStyleWithTextures::setInverseCounterparts( shared_ptr<Bui
 		}
 	}
 }
+void IFC4X3::IfcSurfaceStyleWithTextures::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcPresentationItem::getInverseReferences( refs );
+	for( size_t i=0; i<m_Textures.size(); ++i )
+	{
+		if( m_Textures[i] )
+		{
+			refs.emplace_back( m_Textures[i].get(), INVERSE_UsedInStyles );
+		}
+	}
+}
 void IFC4X3::IfcSurfaceStyleWithTextures::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
@@ -75,3 +102,14 @@ void IFC4X3::IfcSurfaceStyleWithTextures::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcSurfaceStyleWithTextures::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	for( size_t i=0; i<m_Textures.size(); ++i )
+	{
+		if( m_Textures[i] )
+		{
+			refs.push_back( m_Textures[i].get() );
+		}
+	}
+}
@@ -59,6 +59,16 @@ void IFC4X3::IfcSurfaceTexture::readStepArguments( const std::vector<std::string
 	if( num_args > 4 ){readTypeOfStringList( args[4], m_Parameter );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSurfaceTexture, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSurfaceTexture::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_RepeatS = IfcBoolean::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepeatT = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Mode = IfcIdentifier::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_TextureTransform, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_Parameter );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSurfaceTexture, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSurfaceTexture::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -92,6 +102,21 @@ void IFC4X3::IfcSurfaceTexture::getAttributesInverse( std::vector<std::pair<std:
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "UsedInStyles_inverse", UsedInStyles_inverse_vec_obj ) );
 }
+void IFC4X3::IfcSurfaceTexture::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "RepeatS", m_RepeatS );
+	visitor.visitObject( 1, "RepeatT", m_RepeatT );
+	visitor.visitObject( 2, "Mode", m_Mode );
+	visitor.visitObject( 3, "TextureTransform", m_TextureTransform );
+	visitor.visitList( 4, "Parameter", AttributeVectorView<IfcIdentifier>( m_Parameter ) );
+}
+void IFC4X3::IfcSurfaceTexture::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+	visitor.visitList( 0, "IsMappedBy_inverse", AttributeInverseVectorView<IfcTextureCoordinate>( m_IsMappedBy_inverse ) );
+	visitor.visitList( 1, "UsedInStyles_inverse", AttributeInverseVectorView<IfcSurfaceStyleWithTextures>( m_UsedInStyles_inverse ) );
+}
 void IFC4X3::IfcSurfaceTexture::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -100,3 +125,11 @@ void IFC4X3::IfcSurfaceTexture::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSurfaceTexture::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	if( m_TextureTransform )
+	{
+		refs.push_back( m_TextureTransform.get() );
+	}
+}
@@ -28,6 +28,13 @@ void IFC4X3::IfcSweptAreaSolid::readStepArguments( const std::vector<std::string
 	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSweptAreaSolid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSweptAreaSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptArea, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSweptAreaSolid, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSweptAreaSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSolidModel::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcSweptAreaSolid::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSolidModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSweptAreaSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributes( visitor );
+	visitor.visitObject( 0, "SweptArea", m_SweptArea );
+	visitor.visitObject( 1, "Position", m_Position );
+}
+void IFC4X3::IfcSweptAreaSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSweptAreaSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSolidModel::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,15 @@ void IFC4X3::IfcSweptAreaSolid::unlinkFromInverseCounterparts()
 {
 	IfcSolidModel::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSweptAreaSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSolidModel::getEntityReferences( refs );
+	if( m_SweptArea )
+	{
+		refs.push_back( m_SweptArea.get() );
+	}
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+}
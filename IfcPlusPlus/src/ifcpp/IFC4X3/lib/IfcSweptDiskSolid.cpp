@@ -38,6 +38,16 @@ void IFC4X3::IfcSweptDiskSolid::readStepArguments( const std::vector<std::string
 	if( num_args > 4 ){m_EndParam = IfcParameterValue::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSweptDiskSolid, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSweptDiskSolid::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_InnerRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartParam = IfcParameterValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EndParam = IfcParameterValue::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSweptDiskSolid, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSweptDiskSolid::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSolidModel::getAttributes( vec_attributes );
@@ -51,6 +61,19 @@ void IFC4X3::IfcSweptDiskSolid::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcSolidModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSweptDiskSolid::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributes( visitor );
+	visitor.visitObject( 0, "Directrix", m_Directrix );
+	visitor.visitObject( 1, "Radius", m_Radius );
+	visitor.visitObject( 2, "InnerRadius", m_InnerRadius );
+	visitor.visitObject( 3, "StartParam", m_StartParam );
+	visitor.visitObject( 4, "EndParam", m_EndParam );
+}
+void IFC4X3::IfcSweptDiskSolid::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSolidModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSweptDiskSolid::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSolidModel::setInverseCounterparts( ptr_self_entity );
@@ -59,3 +82,11 @@ void IFC4X3::IfcSweptDiskSolid::unlinkFromInverseCounterparts()
 {
 	IfcSolidModel::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSweptDiskSolid::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSolidModel::getEntityReferences( refs );
+	if( m_Directrix )
+	{
+		refs.push_back( m_Directrix.get() );
+	}
+}
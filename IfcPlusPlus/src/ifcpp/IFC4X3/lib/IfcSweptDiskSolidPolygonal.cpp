@@ -42,6 +42,17 @@ void IFC4X3::IfcSweptDiskSolidPolygonal::readStepArguments( const std::vector<st
 	if( num_args > 5 ){m_FilletRadius = IfcNonNegativeLengthMeasure::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSweptDiskSolidPolygonal, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSweptDiskSolidPolygonal::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Directrix, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Radius = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_InnerRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_StartParam = IfcParameterValue::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_EndParam = IfcParameterValue::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_FilletRadius = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcSweptDiskSolidPolygonal, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSweptDiskSolidPolygonal::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSweptDiskSolid::getAttributes( vec_attributes );
@@ -51,6 +62,15 @@ void IFC4X3::IfcSweptDiskSolidPolygonal::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcSweptDiskSolid::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSweptDiskSolidPolygonal::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptDiskSolid::visitAttributes( visitor );
+	visitor.visitObject( 5, "FilletRadius", m_FilletRadius );
+}
+void IFC4X3::IfcSweptDiskSolidPolygonal::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSweptDiskSolid::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSweptDiskSolidPolygonal::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSweptDiskSolid::setInverseCounterparts( ptr_self_entity );
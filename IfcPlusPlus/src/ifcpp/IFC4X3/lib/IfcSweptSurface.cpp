@@ -28,6 +28,13 @@ void IFC4X3::IfcSweptSurface::readStepArguments( const std::vector<std::string>&
 	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSweptSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSweptSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_SweptCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcSweptSurface, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSweptSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSurface::getAttributes( vec_attributes );
@@ -38,6 +45,16 @@ void IFC4X3::IfcSweptSurface::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcSurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcSweptSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributes( visitor );
+	visitor.visitObject( 0, "SweptCurve", m_SweptCurve );
+	visitor.visitObject( 1, "Position", m_Position );
+}
+void IFC4X3::IfcSweptSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcSweptSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSurface::setInverseCounterparts( ptr_self_entity );
@@ -46,3 +63,15 @@ void IFC4X3::IfcSweptSurface::unlinkFromInverseCounterparts()
 {
 	IfcSurface::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcSweptSurface::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSurface::getEntityReferences( refs );
+	if( m_SweptCurve )
+	{
+		refs.push_back( m_SweptCurve.get() );
+	}
+	if( m_Position )
+	{
+		refs.push_back( m_Position.get() );
+	}
+}
@@ -48,6 +48,16 @@ void IFC4X3::IfcSystem::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSystem, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcSystem::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcSystem, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcSystem::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcGroup::getAttributes( vec_attributes );
@@ -74,6 +84,16 @@ void IFC4X3::IfcSystem::getAttributesInverse( std::vector<std::pair<std::string,
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ServicesFacilities_inverse", ServicesFacilities_inverse_vec_obj ) );
 }
+void IFC4X3::IfcSystem::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributes( visitor );
+}
+void IFC4X3::IfcSystem::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcGroup::visitAttributesInverse( visitor );
+	visitor.visitList( 13, "ServicesBuildings_inverse", AttributeInverseVectorView<IfcRelServicesBuildings>( m_ServicesBuildings_inverse ) );
+	visitor.visitList( 14, "ServicesFacilities_inverse", AttributeInverseVectorView<IfcRelReferencedInSpatialStructure>( m_ServicesFacilities_inverse ) );
+}
 void IFC4X3::IfcSystem::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcGroup::setInverseCounterparts( ptr_self_entity );
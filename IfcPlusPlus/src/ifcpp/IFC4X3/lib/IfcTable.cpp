@@ -30,6 +30,14 @@ void IFC4X3::IfcTable::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 2 ){readEntityReferenceList( args[2], m_Columns, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTable, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTable::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Rows, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReferenceList( args[2], m_Columns, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTable, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTable::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Name", m_Name ) );
@@ -43,9 +51,35 @@ void IFC4X3::IfcTable::getAttributes( std::vector<std::pair<std::string, shared_
 void IFC4X3::IfcTable::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcTable::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Name", m_Name );
+	visitor.visitList( 1, "Rows", AttributeVectorView<IfcTableRow>( m_Rows ) );
+	visitor.visitList( 2, "Columns", AttributeVectorView<IfcTableColumn>( m_Columns ) );
+}
+void IFC4X3::IfcTable::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcTable::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcTable::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcTable::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Rows.size(); ++i )
+	{
+		if( m_Rows[i] )
+		{
+			refs.push_back( m_Rows[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_Columns.size(); ++i )
+	{
+		if( m_Columns[i] )
+		{
+			refs.push_back( m_Columns[i].get() );
+		}
+	}
+}
@@ -38,6 +38,16 @@ void IFC4X3::IfcTableColumn::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){readEntityReference( args[4], m_ReferencePath, map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTableColumn, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTableColumn::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Identifier = IfcIdentifier::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Name = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Description = IfcText::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Unit = IfcUnit::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){readEntityReference( args[4], m_ReferencePath, map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTableColumn, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTableColumn::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "Identifier", m_Identifier ) );
@@ -49,9 +59,32 @@ void IFC4X3::IfcTableColumn::getAttributes( std::vector<std::pair<std::string, s
 void IFC4X3::IfcTableColumn::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcTableColumn::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "Identifier", m_Identifier );
+	visitor.visitObject( 1, "Name", m_Name );
+	visitor.visitObject( 2, "Description", m_Description );
+	visitor.visitObject( 3, "Unit", m_Unit );
+	visitor.visitObject( 4, "ReferencePath", m_ReferencePath );
+}
+void IFC4X3::IfcTableColumn::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcTableColumn::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcTableColumn::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcTableColumn::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	BuildingEntity* Unit_entity = dynamic_cast<BuildingEntity*>( m_Unit.get() );
+	if( Unit_entity )
+	{
+		refs.push_back( Unit_entity );
+	}
+	if( m_ReferencePath )
+	{
+		refs.push_back( m_ReferencePath.get() );
+	}
+}
@@ -47,6 +47,13 @@ void IFC4X3::IfcTableRow::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 1 ){m_IsHeading = IfcBoolean::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTableRow, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTableRow::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_RowCells, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_IsHeading = IfcBoolean::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTableRow, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTableRow::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> RowCells_vec_object( new AttributeObjectVector() );
@@ -57,6 +64,14 @@ void IFC4X3::IfcTableRow::getAttributes( std::vector<std::pair<std::string, shar
 void IFC4X3::IfcTableRow::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcTableRow::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "RowCells", AttributeVectorView<IfcValue>( m_RowCells ) );
+	visitor.visitObject( 1, "IsHeading", m_IsHeading );
+}
+void IFC4X3::IfcTableRow::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcTableRow::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -76,6 +76,24 @@ void IFC4X3::IfcTask::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 12 ){m_PredefinedType = IfcTaskTypeEnum::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcTask, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTask::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LongDescription = IfcText::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Status = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_WorkMethod = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_IsMilestone = IfcBoolean::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_Priority = IfcInteger::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){readEntityReference( args[11], m_TaskTime, map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_PredefinedType = IfcTaskTypeEnum::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcTask, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTask::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcProcess::getAttributes( vec_attributes );
@@ -90,6 +108,20 @@ void IFC4X3::IfcTask::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcProcess::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTask::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributes( visitor );
+	visitor.visitObject( 7, "Status", m_Status );
+	visitor.visitObject( 8, "WorkMethod", m_WorkMethod );
+	visitor.visitObject( 9, "IsMilestone", m_IsMilestone );
+	visitor.visitObject( 10, "Priority", m_Priority );
+	visitor.visitObject( 11, "TaskTime", m_TaskTime );
+	visitor.visitObject( 12, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcTask::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcProcess::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTask::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcProcess::setInverseCounterparts( ptr_self_entity );
@@ -98,3 +130,11 @@ void IFC4X3::IfcTask::unlinkFromInverseCounterparts()
 {
 	IfcProcess::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTask::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcProcess::getEntityReferences( refs );
+	if( m_TaskTime )
+	{
+		refs.push_back( m_TaskTime.get() );
+	}
+}
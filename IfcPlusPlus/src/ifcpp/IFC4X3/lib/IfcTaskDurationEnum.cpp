@@ -21,6 +21,10 @@ void IFC4X3::IfcTaskDurationEnum::getStepParameter( std::stringstream& stream, b
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTaskDurationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTaskDurationEnum> IFC4X3::IfcTaskDurationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTaskDurationEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcTaskDurationEnum> IFC4X3::IfcTaskDurationEnum::createObjec
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTaskDurationEnum> IFC4X3::IfcTaskDurationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcTaskDurationEnum>(); }
+		return shared_ptr<IfcTaskDurationEnum>( new IfcTaskDurationEnum( IfcTaskDurationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
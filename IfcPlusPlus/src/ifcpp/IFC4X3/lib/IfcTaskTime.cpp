@@ -85,6 +85,31 @@ void IFC4X3::IfcTaskTime::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 19 ){m_Completion = IfcPositiveRatioMeasure::createObjectFromSTEP( args[19], map, errorStream, entityIdNotFound );}
 	if( num_args != 20 ){ errorStream << "Wrong parameter count for entity IfcTaskTime, expecting 20, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTaskTime::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_DurationType = IfcTaskDurationEnum::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ScheduleDuration = IfcDuration::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_ScheduleStart = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ScheduleFinish = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_EarlyStart = IfcDateTime::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_EarlyFinish = IfcDateTime::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_LateStart = IfcDateTime::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_LateFinish = IfcDateTime::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_FreeFloat = IfcDuration::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_TotalFloat = IfcDuration::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_IsCritical = IfcBoolean::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_StatusTime = IfcDateTime::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_ActualDuration = IfcDuration::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_ActualStart = IfcDateTime::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args > 17 ){m_ActualFinish = IfcDateTime::createObjectFromBinary( args[17], map, errorStream, entityIdNotFound );}
+	if( num_args > 18 ){m_RemainingTime = IfcDuration::createObjectFromBinary( args[18], map, errorStream, entityIdNotFound );}
+	if( num_args > 19 ){m_Completion = IfcPositiveRatioMeasure::createObjectFromBinary( args[19], map, errorStream, entityIdNotFound );}
+	if( num_args != 20 ){ errorStream << "Wrong parameter count for entity IfcTaskTime, expecting 20, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTaskTime::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSchedulingTime::getAttributes( vec_attributes );
@@ -110,6 +135,31 @@ void IFC4X3::IfcTaskTime::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcSchedulingTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTaskTime::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributes( visitor );
+	visitor.visitObject( 3, "DurationType", m_DurationType );
+	visitor.visitObject( 4, "ScheduleDuration", m_ScheduleDuration );
+	visitor.visitObject( 5, "ScheduleStart", m_ScheduleStart );
+	visitor.visitObject( 6, "ScheduleFinish", m_ScheduleFinish );
+	visitor.visitObject( 7, "EarlyStart", m_EarlyStart );
+	visitor.visitObject( 8, "EarlyFinish", m_EarlyFinish );
+	visitor.visitObject( 9, "LateStart", m_LateStart );
+	visitor.visitObject( 10, "LateFinish", m_LateFinish );
+	visitor.visitObject( 11, "FreeFloat", m_FreeFloat );
+	visitor.visitObject( 12, "TotalFloat", m_TotalFloat );
+	visitor.visitObject( 13, "IsCritical", m_IsCritical );
+	visitor.visitObject( 14, "StatusTime", m_StatusTime );
+	visitor.visitObject( 15, "ActualDuration", m_ActualDuration );
+	visitor.visitObject( 16, "ActualStart", m_ActualStart );
+	visitor.visitObject( 17, "ActualFinish", m_ActualFinish );
+	visitor.visitObject( 18, "RemainingTime", m_RemainingTime );
+	visitor.visitObject( 19, "Completion", m_Completion );
+}
+void IFC4X3::IfcTaskTime::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTaskTime::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSchedulingTime::setInverseCounterparts( ptr_self_entity );
@@ -89,6 +89,32 @@ void IFC4X3::IfcTaskTimeRecurring::readStepArguments( const std::vector<std::str
 	if( num_args > 20 ){readEntityReference( args[20], m_Recurrence, map, errorStream, entityIdNotFound );}
 	if( num_args != 21 ){ errorStream << "Wrong parameter count for entity IfcTaskTimeRecurring, expecting 21, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTaskTimeRecurring::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_DurationType = IfcTaskDurationEnum::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ScheduleDuration = IfcDuration::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_ScheduleStart = IfcDateTime::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_ScheduleFinish = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_EarlyStart = IfcDateTime::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_EarlyFinish = IfcDateTime::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_LateStart = IfcDateTime::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_LateFinish = IfcDateTime::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_FreeFloat = IfcDuration::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_TotalFloat = IfcDuration::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_IsCritical = IfcBoolean::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_StatusTime = IfcDateTime::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_ActualDuration = IfcDuration::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_ActualStart = IfcDateTime::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args > 17 ){m_ActualFinish = IfcDateTime::createObjectFromBinary( args[17], map, errorStream, entityIdNotFound );}
+	if( num_args > 18 ){m_RemainingTime = IfcDuration::createObjectFromBinary( args[18], map, errorStream, entityIdNotFound );}
+	if( num_args > 19 ){m_Completion = IfcPositiveRatioMeasure::createObjectFromBinary( args[19], map, errorStream, entityIdNotFound );}
+	if( num_args > 20 ){readEntityReference( args[20], m_Recurrence, map, errorStream, entityIdNotFound );}
+	if( num_args != 21 ){ errorStream << "Wrong parameter count for entity IfcTaskTimeRecurring, expecting 21, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTaskTimeRecurring::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTaskTime::getAttributes( vec_attributes );
@@ -98,6 +124,15 @@ void IFC4X3::IfcTaskTimeRecurring::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcTaskTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTaskTimeRecurring::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTaskTime::visitAttributes( visitor );
+	visitor.visitObject( 20, "Recurrence", m_Recurrence );
+}
+void IFC4X3::IfcTaskTimeRecurring::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTaskTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTaskTimeRecurring::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTaskTime::setInverseCounterparts( ptr_self_entity );
@@ -106,3 +141,11 @@ void IFC4X3::IfcTaskTimeRecurring::unlinkFromInverseCounterparts()
 {
 	IfcTaskTime::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTaskTimeRecurring::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTaskTime::getEntityReferences( refs );
+	if( m_Recurrence )
+	{
+		refs.push_back( m_Recurrence.get() );
+	}
+}
@@ -135,6 +135,20 @@ void IFC4X3::IfcTelecomAddress::readStepArguments( const std::vector<std::string
 	if( num_args > 8 ){readTypeOfStringList( args[8], m_MessagingIDs );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcTelecomAddress, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTelecomAddress::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Purpose = IfcAddressTypeEnum::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Description = IfcText::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedPurpose = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfStringList( args[3], m_TelephoneNumbers );}
+	if( num_args > 4 ){readTypeOfStringList( args[4], m_FacsimileNumbers );}
+	if( num_args > 5 ){m_PagerNumber = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readTypeOfStringList( args[6], m_ElectronicMailAddresses );}
+	if( num_args > 7 ){m_WWWHomePageURL = IfcURIReference::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){readTypeOfStringList( args[8], m_MessagingIDs );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcTelecomAddress, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTelecomAddress::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcAddress::getAttributes( vec_attributes );
@@ -157,6 +171,20 @@ void IFC4X3::IfcTelecomAddress::getAttributesInverse( std::vector<std::pair<std:
 {
 	IFC4X3::IfcAddress::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTelecomAddress::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAddress::visitAttributes( visitor );
+	visitor.visitList( 3, "TelephoneNumbers", AttributeVectorView<IfcLabel>( m_TelephoneNumbers ) );
+	visitor.visitList( 4, "FacsimileNumbers", AttributeVectorView<IfcLabel>( m_FacsimileNumbers ) );
+	visitor.visitObject( 5, "PagerNumber", m_PagerNumber );
+	visitor.visitList( 6, "ElectronicMailAddresses", AttributeVectorView<IfcLabel>( m_ElectronicMailAddresses ) );
+	visitor.visitObject( 7, "WWWHomePageURL", m_WWWHomePageURL );
+	visitor.visitList( 8, "MessagingIDs", AttributeVectorView<IfcURIReference>( m_MessagingIDs ) );
+}
+void IFC4X3::IfcTelecomAddress::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcAddress::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTelecomAddress::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcAddress::setInverseCounterparts( ptr_self_entity );
@@ -103,6 +103,28 @@ void IFC4X3::IfcTendon::readStepArguments( const std::vector<std::string>& args,
 	if( num_args > 16 ){m_MinCurvatureRadius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[16], map, errorStream, entityIdNotFound );}
 	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcTendon, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTendon::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReference( args[5], m_ObjectPlacement, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReference( args[6], m_Representation, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcIdentifier::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_SteelGrade = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_PredefinedType = IfcTendonTypeEnum::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_NominalDiameter = IfcPositiveLengthMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_CrossSectionArea = IfcAreaMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_TensionForce = IfcForceMeasure::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_PreStress = IfcPressureMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_FrictionCoefficient = IfcNormalisedRatioMeasure::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_AnchorageSlip = IfcPositiveLengthMeasure::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args > 16 ){m_MinCurvatureRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[16], map, errorStream, entityIdNotFound );}
+	if( num_args != 17 ){ errorStream << "Wrong parameter count for entity IfcTendon, expecting 17, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTendon::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcReinforcingElement::getAttributes( vec_attributes );
@@ -119,6 +141,22 @@ void IFC4X3::IfcTendon::getAttributesInverse( std::vector<std::pair<std::string,
 {
 	IFC4X3::IfcReinforcingElement::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTendon::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributes( visitor );
+	visitor.visitObject( 9, "PredefinedType", m_PredefinedType );
+	visitor.visitObject( 10, "NominalDiameter", m_NominalDiameter );
+	visitor.visitObject( 11, "CrossSectionArea", m_CrossSectionArea );
+	visitor.visitObject( 12, "TensionForce", m_TensionForce );
+	visitor.visitObject( 13, "PreStress", m_PreStress );
+	visitor.visitObject( 14, "FrictionCoefficient", m_FrictionCoefficient );
+	visitor.visitObject( 15, "AnchorageSlip", m_AnchorageSlip );
+	visitor.visitObject( 16, "MinCurvatureRadius", m_MinCurvatureRadius );
+}
+void IFC4X3::IfcTendon::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcReinforcingElement::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTendon::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcReinforcingElement::setInverseCounterparts( ptr_self_entity );
@@ -23,6 +23,10 @@ void IFC4X3::IfcTendonAnchorTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTendonAnchorTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTendonAnchorTypeEnum> IFC4X3::IfcTendonAnchorTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTendonAnchorTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcTendonAnchorTypeEnum> IFC4X3::IfcTendonAnchorTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTendonAnchorTypeEnum> IFC4X3::IfcTendonAnchorTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcTendonAnchorTypeEnum>(); }
+		return shared_ptr<IfcTendonAnchorTypeEnum>( new IfcTendonAnchorTypeEnum( IfcTendonAnchorTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
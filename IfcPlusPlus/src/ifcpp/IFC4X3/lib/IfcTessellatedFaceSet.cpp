@@ -26,6 +26,12 @@ void IFC4X3::IfcTessellatedFaceSet::readStepArguments( const std::vector<std::st
 	if( num_args > 0 ){readEntityReference( args[0], m_Coordinates, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTessellatedFaceSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTessellatedFaceSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Coordinates, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTessellatedFaceSet, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTessellatedFaceSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTessellatedItem::getAttributes( vec_attributes );
@@ -53,6 +59,17 @@ void IFC4X3::IfcTessellatedFaceSet::getAttributesInverse( std::vector<std::pair<
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "HasTextures_inverse", HasTextures_inverse_vec_obj ) );
 }
+void IFC4X3::IfcTessellatedFaceSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Coordinates", m_Coordinates );
+}
+void IFC4X3::IfcTessellatedFaceSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedItem::visitAttributesInverse( visitor );
+	visitor.visitList( 2, "HasColours_inverse", AttributeInverseVectorView<IfcIndexedColourMap>( m_HasColours_inverse ) );
+	visitor.visitList( 3, "HasTextures_inverse", AttributeInverseVectorView<IfcIndexedTextureMap>( m_HasTextures_inverse ) );
+}
 void IFC4X3::IfcTessellatedFaceSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTessellatedItem::setInverseCounterparts( ptr_self_entity );
@@ -61,3 +78,11 @@ void IFC4X3::IfcTessellatedFaceSet::unlinkFromInverseCounterparts()
 {
 	IfcTessellatedItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTessellatedFaceSet::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTessellatedItem::getEntityReferences( refs );
+	if( m_Coordinates )
+	{
+		refs.push_back( m_Coordinates.get() );
+	}
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcTextAlignment::getStepParameter( std::stringstream& stream, bool
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTextAlignment::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTextAlignment> IFC4X3::IfcTextAlignment::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTextAlignment>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcTextAlignment> IFC4X3::IfcTextAlignment::createObjectFromS
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTextAlignment> IFC4X3::IfcTextAlignment::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTextAlignment>(); }
+	shared_ptr<IfcTextAlignment> type_object( new IfcTextAlignment() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -17,6 +17,10 @@ void IFC4X3::IfcTextDecoration::getStepParameter( std::stringstream& stream, boo
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTextDecoration::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTextDecoration> IFC4X3::IfcTextDecoration::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTextDecoration>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcTextDecoration> IFC4X3::IfcTextDecoration::createObjectFro
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTextDecoration> IFC4X3::IfcTextDecoration::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTextDecoration>(); }
+	shared_ptr<IfcTextDecoration> type_object( new IfcTextDecoration() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
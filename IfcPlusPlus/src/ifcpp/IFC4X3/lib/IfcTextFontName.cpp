@@ -17,6 +17,10 @@ void IFC4X3::IfcTextFontName::getStepParameter( std::stringstream& stream, bool
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTextFontName::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTextFontName> IFC4X3::IfcTextFontName::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTextFontName>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcTextFontName> IFC4X3::IfcTextFontName::createObjectFromSTE
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTextFontName> IFC4X3::IfcTextFontName::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTextFontName>(); }
+	shared_ptr<IfcTextFontName> type_object( new IfcTextFontName() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
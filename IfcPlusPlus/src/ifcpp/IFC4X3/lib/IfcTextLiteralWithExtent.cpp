@@ -40,6 +40,16 @@ void IFC4X3::IfcTextLiteralWithExtent::readStepArguments( const std::vector<std:
 	if( num_args > 4 ){m_BoxAlignment = IfcBoxAlignment::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTextLiteralWithExtent, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextLiteralWithExtent::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Literal = IfcPresentableText::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Placement = IfcAxis2Placement::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Path = IfcTextPath::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_Extent, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_BoxAlignment = IfcBoxAlignment::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTextLiteralWithExtent, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextLiteralWithExtent::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTextLiteral::getAttributes( vec_attributes );
@@ -50,6 +60,16 @@ void IFC4X3::IfcTextLiteralWithExtent::getAttributesInverse( std::vector<std::pa
 {
 	IFC4X3::IfcTextLiteral::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextLiteralWithExtent::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextLiteral::visitAttributes( visitor );
+	visitor.visitObject( 3, "Extent", m_Extent );
+	visitor.visitObject( 4, "BoxAlignment", m_BoxAlignment );
+}
+void IFC4X3::IfcTextLiteralWithExtent::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextLiteral::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextLiteralWithExtent::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTextLiteral::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +78,11 @@ void IFC4X3::IfcTextLiteralWithExtent::unlinkFromInverseCounterparts()
 {
 	IfcTextLiteral::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTextLiteralWithExtent::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTextLiteral::getEntityReferences( refs );
+	if( m_Extent )
+	{
+		refs.push_back( m_Extent.get() );
+	}
+}
@@ -22,6 +22,10 @@ void IFC4X3::IfcTextPath::getStepParameter( std::stringstream& stream, bool is_s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTextPath::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTextPath> IFC4X3::IfcTextPath::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTextPath>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcTextPath> IFC4X3::IfcTextPath::createObjectFromSTEP( const
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTextPath> IFC4X3::IfcTextPath::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UP ) { return shared_ptr<IfcTextPath>(); }
+		return shared_ptr<IfcTextPath>( new IfcTextPath( IfcTextPathEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -38,6 +38,16 @@ void IFC4X3::IfcTextStyle::readStepArguments( const std::vector<std::string>& ar
 	if( num_args > 4 ){m_ModelOrDraughting = IfcBoolean::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTextStyle, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextStyle::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TextCharacterAppearance, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_TextStyle, map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_TextFontStyle = IfcTextFontSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ModelOrDraughting = IfcBoolean::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTextStyle, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextStyle::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationStyle::getAttributes( vec_attributes );
@@ -50,6 +60,18 @@ void IFC4X3::IfcTextStyle::getAttributesInverse( std::vector<std::pair<std::stri
 {
 	IFC4X3::IfcPresentationStyle::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextStyle::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributes( visitor );
+	visitor.visitObject( 1, "TextCharacterAppearance", m_TextCharacterAppearance );
+	visitor.visitObject( 2, "TextStyle", m_TextStyle );
+	visitor.visitObject( 3, "TextFontStyle", m_TextFontStyle );
+	visitor.visitObject( 4, "ModelOrDraughting", m_ModelOrDraughting );
+}
+void IFC4X3::IfcTextStyle::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationStyle::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextStyle::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationStyle::setInverseCounterparts( ptr_self_entity );
@@ -58,3 +80,20 @@ void IFC4X3::IfcTextStyle::unlinkFromInverseCounterparts()
 {
 	IfcPresentationStyle::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTextStyle::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationStyle::getEntityReferences( refs );
+	if( m_TextCharacterAppearance )
+	{
+		refs.push_back( m_TextCharacterAppearance.get() );
+	}
+	if( m_TextStyle )
+	{
+		refs.push_back( m_TextStyle.get() );
+	}
+	BuildingEntity* TextFontStyle_entity = dynamic_cast<BuildingEntity*>( m_TextFontStyle.get() );
+	if( TextFontStyle_entity )
+	{
+		refs.push_back( TextFontStyle_entity );
+	}
+}
@@ -59,6 +59,17 @@ void IFC4X3::IfcTextStyleFontModel::readStepArguments( const std::vector<std::st
 	if( num_args > 5 ){m_FontSize = IfcSizeSelect::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTextStyleFontModel, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextStyleFontModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfStringList( args[1], m_FontFamily );}
+	if( num_args > 2 ){m_FontStyle = IfcFontStyle::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_FontVariant = IfcFontVariant::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_FontWeight = IfcFontWeight::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_FontSize = IfcSizeSelect::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTextStyleFontModel, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextStyleFontModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedTextFont::getAttributes( vec_attributes );
@@ -74,6 +85,19 @@ void IFC4X3::IfcTextStyleFontModel::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcPreDefinedTextFont::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextStyleFontModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedTextFont::visitAttributes( visitor );
+	visitor.visitList( 1, "FontFamily", AttributeVectorView<IfcTextFontName>( m_FontFamily ) );
+	visitor.visitObject( 2, "FontStyle", m_FontStyle );
+	visitor.visitObject( 3, "FontVariant", m_FontVariant );
+	visitor.visitObject( 4, "FontWeight", m_FontWeight );
+	visitor.visitObject( 5, "FontSize", m_FontSize );
+}
+void IFC4X3::IfcTextStyleFontModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedTextFont::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextStyleFontModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedTextFont::setInverseCounterparts( ptr_self_entity );
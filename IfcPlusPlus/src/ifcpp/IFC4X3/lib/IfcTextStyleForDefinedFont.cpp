@@ -25,6 +25,13 @@ void IFC4X3::IfcTextStyleForDefinedFont::readStepArguments( const std::vector<st
 	if( num_args > 1 ){m_BackgroundColour = IfcColour::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTextStyleForDefinedFont, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextStyleForDefinedFont::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Colour = IfcColour::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_BackgroundColour = IfcColour::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTextStyleForDefinedFont, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextStyleForDefinedFont::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -35,6 +42,16 @@ void IFC4X3::IfcTextStyleForDefinedFont::getAttributesInverse( std::vector<std::
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextStyleForDefinedFont::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "Colour", m_Colour );
+	visitor.visitObject( 1, "BackgroundColour", m_BackgroundColour );
+}
+void IFC4X3::IfcTextStyleForDefinedFont::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextStyleForDefinedFont::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -43,3 +60,17 @@ void IFC4X3::IfcTextStyleForDefinedFont::unlinkFromInverseCounterparts()
 {
 	IfcPresentationItem::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTextStyleForDefinedFont::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPresentationItem::getEntityReferences( refs );
+	BuildingEntity* Colour_entity = dynamic_cast<BuildingEntity*>( m_Colour.get() );
+	if( Colour_entity )
+	{
+		refs.push_back( Colour_entity );
+	}
+	BuildingEntity* BackgroundColour_entity = dynamic_cast<BuildingEntity*>( m_BackgroundColour.get() );
+	if( BackgroundColour_entity )
+	{
+		refs.push_back( BackgroundColour_entity );
+	}
+}
@@ -43,6 +43,18 @@ void IFC4X3::IfcTextStyleTextModel::readStepArguments( const std::vector<std::st
 	if( num_args > 6 ){m_LineHeight = IfcSizeSelect::createObjectFromSTEP( args[6], map, errorStream, entityIdNotFound );}
 	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcTextStyleTextModel, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextStyleTextModel::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_TextIndent = IfcSizeSelect::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_TextAlign = IfcTextAlignment::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_TextDecoration = IfcTextDecoration::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_LetterSpacing = IfcSizeSelect::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_WordSpacing = IfcSizeSelect::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_TextTransform = IfcTextTransformation::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_LineHeight = IfcSizeSelect::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args != 7 ){ errorStream << "Wrong parameter count for entity IfcTextStyleTextModel, expecting 7, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextStyleTextModel::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -58,6 +70,21 @@ void IFC4X3::IfcTextStyleTextModel::getAttributesInverse( std::vector<std::pair<
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextStyleTextModel::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitObject( 0, "TextIndent", m_TextIndent );
+	visitor.visitObject( 1, "TextAlign", m_TextAlign );
+	visitor.visitObject( 2, "TextDecoration", m_TextDecoration );
+	visitor.visitObject( 3, "LetterSpacing", m_LetterSpacing );
+	visitor.visitObject( 4, "WordSpacing", m_WordSpacing );
+	visitor.visitObject( 5, "TextTransform", m_TextTransform );
+	visitor.visitObject( 6, "LineHeight", m_LineHeight );
+}
+void IFC4X3::IfcTextStyleTextModel::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextStyleTextModel::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
@@ -17,6 +17,10 @@ void IFC4X3::IfcTextTransformation::getStepParameter( std::stringstream& stream,
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTextTransformation::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTextTransformation> IFC4X3::IfcTextTransformation::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTextTransformation>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcTextTransformation> IFC4X3::IfcTextTransformation::createO
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTextTransformation> IFC4X3::IfcTextTransformation::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTextTransformation>(); }
+	shared_ptr<IfcTextTransformation> type_object( new IfcTextTransformation() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
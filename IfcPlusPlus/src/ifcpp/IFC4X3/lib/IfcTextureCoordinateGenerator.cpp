@@ -30,6 +30,14 @@ void IFC4X3::IfcTextureCoordinateGenerator::readStepArguments( const std::vector
 	if( num_args > 2 ){readTypeOfRealList( args[2], m_Parameter );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateGenerator, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextureCoordinateGenerator::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Maps, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_Mode = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readTypeOfRealList( args[2], m_Parameter );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateGenerator, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextureCoordinateGenerator::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTextureCoordinate::getAttributes( vec_attributes );
@@ -42,6 +50,16 @@ void IFC4X3::IfcTextureCoordinateGenerator::getAttributesInverse( std::vector<st
 {
 	IFC4X3::IfcTextureCoordinate::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextureCoordinateGenerator::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributes( visitor );
+	visitor.visitObject( 1, "Mode", m_Mode );
+	visitor.visitList( 2, "Parameter", AttributeVectorView<IfcReal>( m_Parameter ) );
+}
+void IFC4X3::IfcTextureCoordinateGenerator::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextureCoordinateGenerator::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTextureCoordinate::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedPolygonalFace.h"
 #include "ifcpp/IFC4X3/include/IfcIndexedPolygonalTextureMap.h"
 #include "ifcpp/IFC4X3/include/IfcPositiveInteger.h"
@@ -44,6 +45,13 @@ void IFC4X3::IfcTextureCoordinateIndices::readStepArguments( const std::vector<s
 	if( num_args > 1 ){readEntityReference( args[1], m_TexCoordsOf, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateIndices, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextureCoordinateIndices::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfIntegerList( args[0], m_TexCoordIndex );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TexCoordsOf, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateIndices, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextureCoordinateIndices::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> TexCoordIndex_vec_object( new AttributeObjectVector() );
@@ -55,6 +63,15 @@ void IFC4X3::IfcTextureCoordinateIndices::getAttributesInverse( std::vector<std:
 {
 	vec_attributes_inverse.emplace_back( std::make_pair( "ToTexMap_inverse", shared_ptr<BuildingEntity>( m_ToTexMap_inverse ) ) );
 }
+void IFC4X3::IfcTextureCoordinateIndices::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "TexCoordIndex", AttributeVectorView<IfcPositiveInteger>( m_TexCoordIndex ) );
+	visitor.visitObject( 1, "TexCoordsOf", m_TexCoordsOf );
+}
+void IFC4X3::IfcTextureCoordinateIndices::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "ToTexMap_inverse", m_ToTexMap_inverse.lock() );
+}
 void IFC4X3::IfcTextureCoordinateIndices::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcTextureCoordinateIndices> ptr_self = dynamic_pointer_cast<IfcTextureCoordinateIndices>( ptr_self_entity );
@@ -64,6 +81,13 @@ void IFC4X3::IfcTextureCoordinateIndices::setInverseCounterparts( shared_ptr<Bui
 		m_TexCoordsOf->m_HasTexCoords_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcTextureCoordinateIndices::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_TexCoordsOf )
+	{
+		refs.emplace_back( m_TexCoordsOf.get(), INVERSE_HasTexCoords );
+	}
+}
 void IFC4X3::IfcTextureCoordinateIndices::unlinkFromInverseCounterparts()
 {
 	if( m_TexCoordsOf )
@@ -89,3 +113,10 @@ void IFC4X3::IfcTextureCoordinateIndices::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcTextureCoordinateIndices::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_TexCoordsOf )
+	{
+		refs.push_back( m_TexCoordsOf.get() );
+	}
+}
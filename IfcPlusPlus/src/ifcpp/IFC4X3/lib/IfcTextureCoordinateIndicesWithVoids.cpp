@@ -47,6 +47,14 @@ void IFC4X3::IfcTextureCoordinateIndicesWithVoids::readStepArguments( const std:
 	if( num_args > 2 ){readTypeOfIntegerList2D( args[2], m_InnerTexCoordIndices );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateIndicesWithVoids, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextureCoordinateIndicesWithVoids::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfIntegerList( args[0], m_TexCoordIndex );}
+	if( num_args > 1 ){readEntityReference( args[1], m_TexCoordsOf, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readTypeOfIntegerList2D( args[2], m_InnerTexCoordIndices );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureCoordinateIndicesWithVoids, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextureCoordinateIndicesWithVoids::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTextureCoordinateIndices::getAttributes( vec_attributes );
@@ -64,6 +72,15 @@ void IFC4X3::IfcTextureCoordinateIndicesWithVoids::getAttributesInverse( std::ve
 {
 	IFC4X3::IfcTextureCoordinateIndices::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextureCoordinateIndicesWithVoids::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinateIndices::visitAttributes( visitor );
+	visitor.visitList2D( 2, "InnerTexCoordIndices", AttributeVector2DView<IfcPositiveInteger>( m_InnerTexCoordIndices ) );
+}
+void IFC4X3::IfcTextureCoordinateIndicesWithVoids::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinateIndices::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextureCoordinateIndicesWithVoids::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTextureCoordinateIndices::setInverseCounterparts( ptr_self_entity );
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcFace.h"
 #include "ifcpp/IFC4X3/include/IfcSurfaceTexture.h"
 #include "ifcpp/IFC4X3/include/IfcTextureMap.h"
@@ -30,6 +31,14 @@ void IFC4X3::IfcTextureMap::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 2 ){readEntityReference( args[2], m_MappedTo, map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureMap, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextureMap::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_Maps, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReferenceList( args[1], m_Vertices, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readEntityReference( args[2], m_MappedTo, map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcTextureMap, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextureMap::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTextureCoordinate::getAttributes( vec_attributes );
@@ -42,6 +51,16 @@ void IFC4X3::IfcTextureMap::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcTextureCoordinate::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextureMap::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributes( visitor );
+	visitor.visitList( 1, "Vertices", AttributeVectorView<IfcTextureVertex>( m_Vertices ) );
+	visitor.visitObject( 2, "MappedTo", m_MappedTo );
+}
+void IFC4X3::IfcTextureMap::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTextureCoordinate::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextureMap::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTextureCoordinate::setInverseCounterparts( ptr_self_entity );
@@ -52,6 +71,14 @@ void IFC4X3::IfcTextureMap::setInverseCounterparts( shared_ptr<BuildingEntity> p
 		m_MappedTo->m_HasTextureMaps_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcTextureMap::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcTextureCoordinate::getInverseReferences( refs );
+	if( m_MappedTo )
+	{
+		refs.emplace_back( m_MappedTo.get(), INVERSE_HasTextureMaps );
+	}
+}
 void IFC4X3::IfcTextureMap::unlinkFromInverseCounterparts()
 {
 	IfcTextureCoordinate::unlinkFromInverseCounterparts();
@@ -78,3 +105,18 @@ void IFC4X3::IfcTextureMap::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcTextureMap::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTextureCoordinate::getEntityReferences( refs );
+	for( size_t i=0; i<m_Vertices.size(); ++i )
+	{
+		if( m_Vertices[i] )
+		{
+			refs.push_back( m_Vertices[i].get() );
+		}
+	}
+	if( m_MappedTo )
+	{
+		refs.push_back( m_MappedTo.get() );
+	}
+}
@@ -22,6 +22,12 @@ void IFC4X3::IfcTextureVertexList::readStepArguments( const std::vector<std::str
 	if( num_args > 0 ){readTypeOfRealList2D( args[0], m_TexCoordsList );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTextureVertexList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTextureVertexList::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& errorStream, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readTypeOfRealList2D( args[0], m_TexCoordsList );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTextureVertexList, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTextureVertexList::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPresentationItem::getAttributes( vec_attributes );
@@ -39,6 +45,15 @@ void IFC4X3::IfcTextureVertexList::getAttributesInverse( std::vector<std::pair<s
 {
 	IFC4X3::IfcPresentationItem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTextureVertexList::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributes( visitor );
+	visitor.visitList2D( 0, "TexCoordsList", AttributeVector2DView<IfcParameterValue>( m_TexCoordsList ) );
+}
+void IFC4X3::IfcTextureVertexList::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPresentationItem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTextureVertexList::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPresentationItem::setInverseCounterparts( ptr_self_entity );
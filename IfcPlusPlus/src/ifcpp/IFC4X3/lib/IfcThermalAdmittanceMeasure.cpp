@@ -18,6 +18,10 @@ void IFC4X3::IfcThermalAdmittanceMeasure::getStepParameter( std::stringstream& s
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcThermalAdmittanceMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcThermalAdmittanceMeasure> IFC4X3::IfcThermalAdmittanceMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcThermalAdmittanceMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcThermalAdmittanceMeasure> IFC4X3::IfcThermalAdmittanceMeas
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcThermalAdmittanceMeasure> IFC4X3::IfcThermalAdmittanceMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcThermalAdmittanceMeasure>(); }
+	shared_ptr<IfcThermalAdmittanceMeasure> type_object( new IfcThermalAdmittanceMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
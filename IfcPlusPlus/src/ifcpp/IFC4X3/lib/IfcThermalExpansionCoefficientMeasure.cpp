@@ -18,6 +18,10 @@ void IFC4X3::IfcThermalExpansionCoefficientMeasure::getStepParameter( std::strin
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcThermalExpansionCoefficientMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcThermalExpansionCoefficientMeasure> IFC4X3::IfcThermalExpansionCoefficientMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcThermalExpansionCoefficientMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcThermalExpansionCoefficientMeasure> IFC4X3::IfcThermalExpa
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcThermalExpansionCoefficientMeasure> IFC4X3::IfcThermalExpansionCoefficientMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcThermalExpansionCoefficientMeasure>(); }
+	shared_ptr<IfcThermalExpansionCoefficientMeasure> type_object( new IfcThermalExpansionCoefficientMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
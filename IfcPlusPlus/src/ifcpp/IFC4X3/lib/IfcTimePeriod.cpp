@@ -25,6 +25,13 @@ void IFC4X3::IfcTimePeriod::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 1 ){m_EndTime = IfcTime::createObjectFromSTEP( args[1], map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTimePeriod, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTimePeriod::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_StartTime = IfcTime::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_EndTime = IfcTime::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcTimePeriod, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTimePeriod::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "StartTime", m_StartTime ) );
@@ -33,6 +40,14 @@ void IFC4X3::IfcTimePeriod::getAttributes( std::vector<std::pair<std::string, sh
 void IFC4X3::IfcTimePeriod::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcTimePeriod::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "StartTime", m_StartTime );
+	visitor.visitObject( 1, "EndTime", m_EndTime );
+}
+void IFC4X3::IfcTimePeriod::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcTimePeriod::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
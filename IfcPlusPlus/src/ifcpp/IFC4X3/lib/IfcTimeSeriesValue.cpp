@@ -39,6 +39,12 @@ void IFC4X3::IfcTimeSeriesValue::readStepArguments( const std::vector<std::strin
 	if( num_args > 0 ){readSelectList( args[0], m_ListValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTimeSeriesValue, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTimeSeriesValue::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_ListValues, "IFCVALUE", map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcTimeSeriesValue, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTimeSeriesValue::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> ListValues_vec_object( new AttributeObjectVector() );
@@ -48,6 +54,13 @@ void IFC4X3::IfcTimeSeriesValue::getAttributes( std::vector<std::pair<std::strin
 void IFC4X3::IfcTimeSeriesValue::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcTimeSeriesValue::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "ListValues", AttributeVectorView<IfcValue>( m_ListValues ) );
+}
+void IFC4X3::IfcTimeSeriesValue::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcTimeSeriesValue::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
@@ -18,6 +18,10 @@ void IFC4X3::IfcTimeStamp::getStepParameter( std::stringstream& stream, bool is_
 	stream << m_value;
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTimeStamp::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeInteger( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTimeStamp> IFC4X3::IfcTimeStamp::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTimeStamp>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcTimeStamp> IFC4X3::IfcTimeStamp::createObjectFromSTEP( con
 	readInteger( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTimeStamp> IFC4X3::IfcTimeStamp::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTimeStamp>(); }
+	shared_ptr<IfcTimeStamp> type_object( new IfcTimeStamp() );
+	readInteger( arg, type_object->m_value );
+	return type_object;
+}
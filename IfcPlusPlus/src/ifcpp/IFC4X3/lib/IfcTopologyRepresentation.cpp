@@ -37,6 +37,15 @@ void IFC4X3::IfcTopologyRepresentation::readStepArguments( const std::vector<std
 	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
 	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcTopologyRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTopologyRepresentation::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_ContextOfItems, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_RepresentationIdentifier = IfcLabel::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_RepresentationType = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReferenceList( args[3], m_Items, map, errorStream, entityIdNotFound );}
+	if( num_args != 4 ){ errorStream << "Wrong parameter count for entity IfcTopologyRepresentation, expecting 4, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTopologyRepresentation::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcShapeModel::getAttributes( vec_attributes );
@@ -45,6 +54,14 @@ void IFC4X3::IfcTopologyRepresentation::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcShapeModel::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTopologyRepresentation::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcShapeModel::visitAttributes( visitor );
+}
+void IFC4X3::IfcTopologyRepresentation::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcShapeModel::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTopologyRepresentation::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcShapeModel::setInverseCounterparts( ptr_self_entity );
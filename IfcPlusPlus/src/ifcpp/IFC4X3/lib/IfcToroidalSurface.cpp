@@ -31,6 +31,14 @@ void IFC4X3::IfcToroidalSurface::readStepArguments( const std::vector<std::strin
 	if( num_args > 2 ){m_MinorRadius = IfcPositiveLengthMeasure::createObjectFromSTEP( args[2], map, errorStream, entityIdNotFound );}
 	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcToroidalSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcToroidalSurface::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Position, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_MajorRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_MinorRadius = IfcPositiveLengthMeasure::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args != 3 ){ errorStream << "Wrong parameter count for entity IfcToroidalSurface, expecting 3, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcToroidalSurface::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcElementarySurface::getAttributes( vec_attributes );
@@ -41,6 +49,16 @@ void IFC4X3::IfcToroidalSurface::getAttributesInverse( std::vector<std::pair<std
 {
 	IFC4X3::IfcElementarySurface::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcToroidalSurface::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributes( visitor );
+	visitor.visitObject( 1, "MajorRadius", m_MajorRadius );
+	visitor.visitObject( 2, "MinorRadius", m_MinorRadius );
+}
+void IFC4X3::IfcToroidalSurface::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcElementarySurface::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcToroidalSurface::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcElementarySurface::setInverseCounterparts( ptr_self_entity );
@@ -18,6 +18,10 @@ void IFC4X3::IfcTorqueMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTorqueMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcTorqueMeasure> IFC4X3::IfcTorqueMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTorqueMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcTorqueMeasure> IFC4X3::IfcTorqueMeasure::createObjectFromS
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTorqueMeasure> IFC4X3::IfcTorqueMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcTorqueMeasure>(); }
+	shared_ptr<IfcTorqueMeasure> type_object( new IfcTorqueMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
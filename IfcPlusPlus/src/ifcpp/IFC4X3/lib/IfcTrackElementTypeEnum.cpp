@@ -28,6 +28,10 @@ void IFC4X3::IfcTrackElementTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTrackElementTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTrackElementTypeEnum> IFC4X3::IfcTrackElementTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTrackElementTypeEnum>(); }
@@ -76,3 +80,12 @@ shared_ptr<IFC4X3::IfcTrackElementTypeEnum> IFC4X3::IfcTrackElementTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTrackElementTypeEnum> IFC4X3::IfcTrackElementTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcTrackElementTypeEnum>(); }
+		return shared_ptr<IfcTrackElementTypeEnum>( new IfcTrackElementTypeEnum( IfcTrackElementTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
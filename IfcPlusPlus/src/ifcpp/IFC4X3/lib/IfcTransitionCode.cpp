@@ -22,6 +22,10 @@ void IFC4X3::IfcTransitionCode::getStepParameter( std::stringstream& stream, boo
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTransitionCode::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTransitionCode> IFC4X3::IfcTransitionCode::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTransitionCode>(); }
@@ -46,3 +50,12 @@ shared_ptr<IFC4X3::IfcTransitionCode> IFC4X3::IfcTransitionCode::createObjectFro
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTransitionCode> IFC4X3::IfcTransitionCode::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_DISCONTINUOUS ) { return shared_ptr<IfcTransitionCode>(); }
+		return shared_ptr<IfcTransitionCode>( new IfcTransitionCode( IfcTransitionCodeEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
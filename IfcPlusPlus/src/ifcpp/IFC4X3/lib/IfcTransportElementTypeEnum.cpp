@@ -26,6 +26,10 @@ void IFC4X3::IfcTransportElementTypeEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTransportElementTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTransportElementTypeEnum> IFC4X3::IfcTransportElementTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTransportElementTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcTransportElementTypeEnum> IFC4X3::IfcTransportElementTypeE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTransportElementTypeEnum> IFC4X3::IfcTransportElementTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcTransportElementTypeEnum>(); }
+		return shared_ptr<IfcTransportElementTypeEnum>( new IfcTransportElementTypeEnum( IfcTransportElementTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -62,6 +62,16 @@ void IFC4X3::IfcTriangulatedFaceSet::readStepArguments( const std::vector<std::s
 	if( num_args > 4 ){readTypeOfIntegerList( args[4], m_PnIndex );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTriangulatedFaceSet, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTriangulatedFaceSet::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Coordinates, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList2D( args[1], m_Normals );}
+	if( num_args > 2 ){m_Closed = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList2D( args[3], m_CoordIndex );}
+	if( num_args > 4 ){readTypeOfIntegerList( args[4], m_PnIndex );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTriangulatedFaceSet, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTriangulatedFaceSet::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTessellatedFaceSet::getAttributes( vec_attributes );
@@ -92,6 +102,18 @@ void IFC4X3::IfcTriangulatedFaceSet::getAttributesInverse( std::vector<std::pair
 {
 	IFC4X3::IfcTessellatedFaceSet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTriangulatedFaceSet::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedFaceSet::visitAttributes( visitor );
+	visitor.visitList2D( 1, "Normals", AttributeVector2DView<IfcParameterValue>( m_Normals ) );
+	visitor.visitObject( 2, "Closed", m_Closed );
+	visitor.visitList2D( 3, "CoordIndex", AttributeVector2DView<IfcPositiveInteger>( m_CoordIndex ) );
+	visitor.visitList( 4, "PnIndex", AttributeVectorView<IfcPositiveInteger>( m_PnIndex ) );
+}
+void IFC4X3::IfcTriangulatedFaceSet::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTessellatedFaceSet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTriangulatedFaceSet::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTessellatedFaceSet::setInverseCounterparts( ptr_self_entity );
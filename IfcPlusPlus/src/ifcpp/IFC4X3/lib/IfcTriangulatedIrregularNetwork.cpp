@@ -66,6 +66,17 @@ void IFC4X3::IfcTriangulatedIrregularNetwork::readStepArguments( const std::vect
 	if( num_args > 5 ){readTypeOfIntegerList( args[5], m_Flags );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTriangulatedIrregularNetwork, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTriangulatedIrregularNetwork::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_Coordinates, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList2D( args[1], m_Normals );}
+	if( num_args > 2 ){m_Closed = IfcBoolean::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readTypeOfIntegerList2D( args[3], m_CoordIndex );}
+	if( num_args > 4 ){readTypeOfIntegerList( args[4], m_PnIndex );}
+	if( num_args > 5 ){readTypeOfIntegerList( args[5], m_Flags );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTriangulatedIrregularNetwork, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTriangulatedIrregularNetwork::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTriangulatedFaceSet::getAttributes( vec_attributes );
@@ -77,6 +88,15 @@ void IFC4X3::IfcTriangulatedIrregularNetwork::getAttributesInverse( std::vector<
 {
 	IFC4X3::IfcTriangulatedFaceSet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTriangulatedIrregularNetwork::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTriangulatedFaceSet::visitAttributes( visitor );
+	visitor.visitList( 5, "Flags", AttributeVectorView<IfcInteger>( m_Flags ) );
+}
+void IFC4X3::IfcTriangulatedIrregularNetwork::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTriangulatedFaceSet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTriangulatedIrregularNetwork::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTriangulatedFaceSet::setInverseCounterparts( ptr_self_entity );
@@ -73,6 +73,16 @@ void IFC4X3::IfcTrimmedCurve::readStepArguments( const std::vector<std::string>&
 	if( num_args > 4 ){m_MasterRepresentation = IfcTrimmingPreference::createObjectFromSTEP( args[4], map, errorStream, entityIdNotFound );}
 	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTrimmedCurve, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTrimmedCurve::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_BasisCurve, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readSelectList( args[1], m_Trim1, "IFCTRIMMINGSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){readSelectList( args[2], m_Trim2, "IFCTRIMMINGSELECT", map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_SenseAgreement = IfcBoolean::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_MasterRepresentation = IfcTrimmingPreference::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args != 5 ){ errorStream << "Wrong parameter count for entity IfcTrimmedCurve, expecting 5, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTrimmedCurve::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcBoundedCurve::getAttributes( vec_attributes );
@@ -90,6 +100,19 @@ void IFC4X3::IfcTrimmedCurve::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcBoundedCurve::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcTrimmedCurve::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributes( visitor );
+	visitor.visitObject( 0, "BasisCurve", m_BasisCurve );
+	visitor.visitList( 1, "Trim1", AttributeVectorView<IfcTrimmingSelect>( m_Trim1 ) );
+	visitor.visitList( 2, "Trim2", AttributeVectorView<IfcTrimmingSelect>( m_Trim2 ) );
+	visitor.visitObject( 3, "SenseAgreement", m_SenseAgreement );
+	visitor.visitObject( 4, "MasterRepresentation", m_MasterRepresentation );
+}
+void IFC4X3::IfcTrimmedCurve::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcBoundedCurve::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcTrimmedCurve::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcBoundedCurve::setInverseCounterparts( ptr_self_entity );
@@ -98,3 +121,27 @@ void IFC4X3::IfcTrimmedCurve::unlinkFromInverseCounterparts()
 {
 	IfcBoundedCurve::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTrimmedCurve::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcBoundedCurve::getEntityReferences( refs );
+	if( m_BasisCurve )
+	{
+		refs.push_back( m_BasisCurve.get() );
+	}
+	for( size_t i=0; i<m_Trim1.size(); ++i )
+	{
+		BuildingEntity* Trim1_entity = dynamic_cast<BuildingEntity*>( m_Trim1[i].get() );
+		if( Trim1_entity )
+		{
+			refs.push_back( Trim1_entity );
+		}
+	}
+	for( size_t i=0; i<m_Trim2.size(); ++i )
+	{
+		BuildingEntity* Trim2_entity = dynamic_cast<BuildingEntity*>( m_Trim2[i].get() );
+		if( Trim2_entity )
+		{
+			refs.push_back( Trim2_entity );
+		}
+	}
+}
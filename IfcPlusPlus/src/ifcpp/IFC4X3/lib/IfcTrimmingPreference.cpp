@@ -21,6 +21,10 @@ void IFC4X3::IfcTrimmingPreference::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTrimmingPreference::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTrimmingPreference> IFC4X3::IfcTrimmingPreference::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTrimmingPreference>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcTrimmingPreference> IFC4X3::IfcTrimmingPreference::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTrimmingPreference> IFC4X3::IfcTrimmingPreference::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_UNSPECIFIED ) { return shared_ptr<IfcTrimmingPreference>(); }
+		return shared_ptr<IfcTrimmingPreference>( new IfcTrimmingPreference( IfcTrimmingPreferenceEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -21,6 +21,10 @@ void IFC4X3::IfcTubeBundleTypeEnum::getStepParameter( std::stringstream& stream,
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcTubeBundleTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcTubeBundleTypeEnum> IFC4X3::IfcTubeBundleTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcTubeBundleTypeEnum>(); }
@@ -41,3 +45,12 @@ shared_ptr<IFC4X3::IfcTubeBundleTypeEnum> IFC4X3::IfcTubeBundleTypeEnum::createO
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcTubeBundleTypeEnum> IFC4X3::IfcTubeBundleTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcTubeBundleTypeEnum>(); }
+		return shared_ptr<IfcTubeBundleTypeEnum>( new IfcTubeBundleTypeEnum( IfcTubeBundleTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGloballyUniqueId.h"
 #include "ifcpp/IFC4X3/include/IfcIdentifier.h"
 #include "ifcpp/IFC4X3/include/IfcLabel.h"
@@ -48,6 +49,17 @@ void IFC4X3::IfcTypeObject::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTypeObject, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTypeObject::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcTypeObject, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTypeObject::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcObjectDefinition::getAttributes( vec_attributes );
@@ -69,6 +81,17 @@ void IFC4X3::IfcTypeObject::getAttributesInverse( std::vector<std::pair<std::str
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "Types_inverse", Types_inverse_vec_obj ) );
 }
+void IFC4X3::IfcTypeObject::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributes( visitor );
+	visitor.visitObject( 4, "ApplicableOccurrence", m_ApplicableOccurrence );
+	visitor.visitList( 5, "HasPropertySets", AttributeVectorView<IfcPropertySetDefinition>( m_HasPropertySets ) );
+}
+void IFC4X3::IfcTypeObject::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcObjectDefinition::visitAttributesInverse( visitor );
+	visitor.visitList( 7, "Types_inverse", AttributeInverseVectorView<IfcRelDefinesByType>( m_Types_inverse ) );
+}
 void IFC4X3::IfcTypeObject::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcObjectDefinition::setInverseCounterparts( ptr_self_entity );
@@ -82,6 +105,17 @@ void IFC4X3::IfcTypeObject::setInverseCounterparts( shared_ptr<BuildingEntity> p
 		}
 	}
 }
+void IFC4X3::IfcTypeObject::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	IfcObjectDefinition::getInverseReferences( refs );
+	for( size_t i=0; i<m_HasPropertySets.size(); ++i )
+	{
+		if( m_HasPropertySets[i] )
+		{
+			refs.emplace_back( m_HasPropertySets[i].get(), INVERSE_DefinesType );
+		}
+	}
+}
 void IFC4X3::IfcTypeObject::unlinkFromInverseCounterparts()
 {
 	IfcObjectDefinition::unlinkFromInverseCounterparts();
@@ -111,3 +145,14 @@ void IFC4X3::IfcTypeObject::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcTypeObject::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcObjectDefinition::getEntityReferences( refs );
+	for( size_t i=0; i<m_HasPropertySets.size(); ++i )
+	{
+		if( m_HasPropertySets[i] )
+		{
+			refs.push_back( m_HasPropertySets[i].get() );
+		}
+	}
+}
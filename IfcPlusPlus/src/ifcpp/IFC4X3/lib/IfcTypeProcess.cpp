@@ -58,6 +58,20 @@ void IFC4X3::IfcTypeProcess::readStepArguments( const std::vector<std::string>&
 	if( num_args > 8 ){m_ProcessType = IfcLabel::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcTypeProcess, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTypeProcess::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_LongDescription = IfcText::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_ProcessType = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcTypeProcess, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTypeProcess::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTypeObject::getAttributes( vec_attributes );
@@ -78,6 +92,18 @@ void IFC4X3::IfcTypeProcess::getAttributesInverse( std::vector<std::pair<std::st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "OperatesOn_inverse", OperatesOn_inverse_vec_obj ) );
 }
+void IFC4X3::IfcTypeProcess::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeObject::visitAttributes( visitor );
+	visitor.visitObject( 6, "Identification", m_Identification );
+	visitor.visitObject( 7, "LongDescription", m_LongDescription );
+	visitor.visitObject( 8, "ProcessType", m_ProcessType );
+}
+void IFC4X3::IfcTypeProcess::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeObject::visitAttributesInverse( visitor );
+	visitor.visitList( 8, "OperatesOn_inverse", AttributeInverseVectorView<IfcRelAssignsToProcess>( m_OperatesOn_inverse ) );
+}
 void IFC4X3::IfcTypeProcess::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTypeObject::setInverseCounterparts( ptr_self_entity );
@@ -56,6 +56,19 @@ void IFC4X3::IfcTypeProduct::readStepArguments( const std::vector<std::string>&
 	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromSTEP( args[7], map, errorStream, entityIdNotFound );}
 	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcTypeProduct, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcTypeProduct::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ApplicableOccurrence = IfcIdentifier::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){readEntityReferenceList( args[5], m_HasPropertySets, map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_RepresentationMaps, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_Tag = IfcLabel::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args != 8 ){ errorStream << "Wrong parameter count for entity IfcTypeProduct, expecting 8, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcTypeProduct::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcTypeObject::getAttributes( vec_attributes );
@@ -77,6 +90,17 @@ void IFC4X3::IfcTypeProduct::getAttributesInverse( std::vector<std::pair<std::st
 	}
 	vec_attributes_inverse.emplace_back( std::make_pair( "ReferencedBy_inverse", ReferencedBy_inverse_vec_obj ) );
 }
+void IFC4X3::IfcTypeProduct::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeObject::visitAttributes( visitor );
+	visitor.visitList( 6, "RepresentationMaps", AttributeVectorView<IfcRepresentationMap>( m_RepresentationMaps ) );
+	visitor.visitObject( 7, "Tag", m_Tag );
+}
+void IFC4X3::IfcTypeProduct::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcTypeObject::visitAttributesInverse( visitor );
+	visitor.visitList( 8, "ReferencedBy_inverse", AttributeInverseVectorView<IfcRelAssignsToProduct>( m_ReferencedBy_inverse ) );
+}
 void IFC4X3::IfcTypeProduct::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcTypeObject::setInverseCounterparts( ptr_self_entity );
@@ -85,3 +109,14 @@ void IFC4X3::IfcTypeProduct::unlinkFromInverseCounterparts()
 {
 	IfcTypeObject::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcTypeProduct::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcTypeObject::getEntityReferences( refs );
+	for( size_t i=0; i<m_RepresentationMaps.size(); ++i )
+	{
+		if( m_RepresentationMaps[i] )
+		{
+			refs.push_back( m_RepresentationMaps[i].get() );
+		}
+	}
+}
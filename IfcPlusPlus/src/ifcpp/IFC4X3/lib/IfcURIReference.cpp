@@ -18,6 +18,10 @@ void IFC4X3::IfcURIReference::getStepParameter( std::stringstream& stream, bool
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcURIReference::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcURIReference> IFC4X3::IfcURIReference::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcURIReference>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcURIReference> IFC4X3::IfcURIReference::createObjectFromSTE
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcURIReference> IFC4X3::IfcURIReference::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcURIReference>(); }
+	shared_ptr<IfcURIReference> type_object( new IfcURIReference() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -39,6 +39,12 @@ void IFC4X3::IfcUnitAssignment::readStepArguments( const std::vector<std::string
 	if( num_args > 0 ){readSelectList( args[0], m_Units, "IFCUNIT", map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcUnitAssignment, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcUnitAssignment::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readSelectList( args[0], m_Units, "IFCUNIT", map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcUnitAssignment, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcUnitAssignment::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> Units_vec_object( new AttributeObjectVector() );
@@ -48,9 +54,27 @@ void IFC4X3::IfcUnitAssignment::getAttributes( std::vector<std::pair<std::string
 void IFC4X3::IfcUnitAssignment::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcUnitAssignment::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "Units", AttributeVectorView<IfcUnit>( m_Units ) );
+}
+void IFC4X3::IfcUnitAssignment::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcUnitAssignment::setInverseCounterparts( shared_ptr<BuildingEntity> )
 {
 }
 void IFC4X3::IfcUnitAssignment::unlinkFromInverseCounterparts()
 {
 }
+void IFC4X3::IfcUnitAssignment::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_Units.size(); ++i )
+	{
+		BuildingEntity* Units_entity = dynamic_cast<BuildingEntity*>( m_Units[i].get() );
+		if( Units_entity )
+		{
+			refs.push_back( Units_entity );
+		}
+	}
+}
@@ -48,6 +48,10 @@ void IFC4X3::IfcUnitEnum::getStepParameter( std::stringstream& stream, bool is_s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcUnitEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcUnitEnum> IFC4X3::IfcUnitEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcUnitEnum>(); }
@@ -176,3 +180,12 @@ shared_ptr<IFC4X3::IfcUnitEnum> IFC4X3::IfcUnitEnum::createObjectFromSTEP( const
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcUnitEnum> IFC4X3::IfcUnitEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_USERDEFINED ) { return shared_ptr<IfcUnitEnum>(); }
+		return shared_ptr<IfcUnitEnum>( new IfcUnitEnum( IfcUnitEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -30,6 +30,10 @@ void IFC4X3::IfcUnitaryControlElementTypeEnum::getStepParameter( std::stringstre
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcUnitaryControlElementTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcUnitaryControlElementTypeEnum> IFC4X3::IfcUnitaryControlElementTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcUnitaryControlElementTypeEnum>(); }
@@ -86,3 +90,12 @@ shared_ptr<IFC4X3::IfcUnitaryControlElementTypeEnum> IFC4X3::IfcUnitaryControlEl
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcUnitaryControlElementTypeEnum> IFC4X3::IfcUnitaryControlElementTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcUnitaryControlElementTypeEnum>(); }
+		return shared_ptr<IfcUnitaryControlElementTypeEnum>( new IfcUnitaryControlElementTypeEnum( IfcUnitaryControlElementTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
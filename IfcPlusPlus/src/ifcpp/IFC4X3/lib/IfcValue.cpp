@@ -135,3 +135,10 @@ shared_ptr<IFC4X3::IfcValue> IFC4X3::IfcValue::createObjectFromSTEP( const std::
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcValue> IFC4X3::IfcValue::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcValue>(); }
+	shared_ptr<IfcValue> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcVaporPermeabilityMeasure::getStepParameter( std::stringstream& s
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcVaporPermeabilityMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcVaporPermeabilityMeasure> IFC4X3::IfcVaporPermeabilityMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcVaporPermeabilityMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcVaporPermeabilityMeasure> IFC4X3::IfcVaporPermeabilityMeas
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcVaporPermeabilityMeasure> IFC4X3::IfcVaporPermeabilityMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcVaporPermeabilityMeasure>(); }
+	shared_ptr<IfcVaporPermeabilityMeasure> type_object( new IfcVaporPermeabilityMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcVertexLoop::readStepArguments( const std::vector<std::string>& a
 	if( num_args > 0 ){readEntityReference( args[0], m_LoopVertex, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcVertexLoop, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcVertexLoop::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_LoopVertex, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcVertexLoop, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcVertexLoop::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcLoop::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcVertexLoop::getAttributesInverse( std::vector<std::pair<std::str
 {
 	IFC4X3::IfcLoop::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcVertexLoop::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLoop::visitAttributes( visitor );
+	visitor.visitObject( 0, "LoopVertex", m_LoopVertex );
+}
+void IFC4X3::IfcVertexLoop::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcLoop::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcVertexLoop::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcLoop::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,11 @@ void IFC4X3::IfcVertexLoop::unlinkFromInverseCounterparts()
 {
 	IfcLoop::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcVertexLoop::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcLoop::getEntityReferences( refs );
+	if( m_LoopVertex )
+	{
+		refs.push_back( m_LoopVertex.get() );
+	}
+}
@@ -24,6 +24,12 @@ void IFC4X3::IfcVertexPoint::readStepArguments( const std::vector<std::string>&
 	if( num_args > 0 ){readEntityReference( args[0], m_VertexGeometry, map, errorStream, entityIdNotFound );}
 	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcVertexPoint, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcVertexPoint::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReference( args[0], m_VertexGeometry, map, errorStream, entityIdNotFound );}
+	if( num_args != 1 ){ errorStream << "Wrong parameter count for entity IfcVertexPoint, expecting 1, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcVertexPoint::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcVertex::getAttributes( vec_attributes );
@@ -33,6 +39,15 @@ void IFC4X3::IfcVertexPoint::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcVertex::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcVertexPoint::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcVertex::visitAttributes( visitor );
+	visitor.visitObject( 0, "VertexGeometry", m_VertexGeometry );
+}
+void IFC4X3::IfcVertexPoint::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcVertex::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcVertexPoint::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcVertex::setInverseCounterparts( ptr_self_entity );
@@ -41,3 +56,11 @@ void IFC4X3::IfcVertexPoint::unlinkFromInverseCounterparts()
 {
 	IfcVertex::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcVertexPoint::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcVertex::getEntityReferences( refs );
+	if( m_VertexGeometry )
+	{
+		refs.push_back( m_VertexGeometry.get() );
+	}
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcGridAxis.h"
 #include "ifcpp/IFC4X3/include/IfcLengthMeasure.h"
 #include "ifcpp/IFC4X3/include/IfcVirtualGridIntersection.h"
@@ -26,6 +27,13 @@ void IFC4X3::IfcVirtualGridIntersection::readStepArguments( const std::vector<st
 	if( num_args > 1 ){readTypeOfRealList( args[1], m_OffsetDistances );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcVirtualGridIntersection, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcVirtualGridIntersection::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){readEntityReferenceList( args[0], m_IntersectingAxes, map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readTypeOfRealList( args[1], m_OffsetDistances );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcVirtualGridIntersection, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcVirtualGridIntersection::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	shared_ptr<AttributeObjectVector> IntersectingAxes_vec_object( new AttributeObjectVector() );
@@ -38,6 +46,14 @@ void IFC4X3::IfcVirtualGridIntersection::getAttributes( std::vector<std::pair<st
 void IFC4X3::IfcVirtualGridIntersection::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcVirtualGridIntersection::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitList( 0, "IntersectingAxes", AttributeVectorView<IfcGridAxis>( m_IntersectingAxes ) );
+	visitor.visitList( 1, "OffsetDistances", AttributeVectorView<IfcLengthMeasure>( m_OffsetDistances ) );
+}
+void IFC4X3::IfcVirtualGridIntersection::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcVirtualGridIntersection::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcVirtualGridIntersection> ptr_self = dynamic_pointer_cast<IfcVirtualGridIntersection>( ptr_self_entity );
@@ -50,6 +66,16 @@ void IFC4X3::IfcVirtualGridIntersection::setInverseCounterparts( shared_ptr<Buil
 		}
 	}
 }
+void IFC4X3::IfcVirtualGridIntersection::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	for( size_t i=0; i<m_IntersectingAxes.size(); ++i )
+	{
+		if( m_IntersectingAxes[i] )
+		{
+			refs.emplace_back( m_IntersectingAxes[i].get(), INVERSE_HasIntersections );
+		}
+	}
+}
 void IFC4X3::IfcVirtualGridIntersection::unlinkFromInverseCounterparts()
 {
 	for( size_t i=0; i<m_IntersectingAxes.size(); ++i )
@@ -78,3 +104,13 @@ void IFC4X3::IfcVirtualGridIntersection::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcVirtualGridIntersection::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	for( size_t i=0; i<m_IntersectingAxes.size(); ++i )
+	{
+		if( m_IntersectingAxes[i] )
+		{
+			refs.push_back( m_IntersectingAxes[i].get() );
+		}
+	}
+}
@@ -26,6 +26,10 @@ void IFC4X3::IfcVoidingFeatureTypeEnum::getStepParameter( std::stringstream& str
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcVoidingFeatureTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcVoidingFeatureTypeEnum> IFC4X3::IfcVoidingFeatureTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcVoidingFeatureTypeEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcVoidingFeatureTypeEnum> IFC4X3::IfcVoidingFeatureTypeEnum:
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcVoidingFeatureTypeEnum> IFC4X3::IfcVoidingFeatureTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcVoidingFeatureTypeEnum>(); }
+		return shared_ptr<IfcVoidingFeatureTypeEnum>( new IfcVoidingFeatureTypeEnum( IfcVoidingFeatureTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
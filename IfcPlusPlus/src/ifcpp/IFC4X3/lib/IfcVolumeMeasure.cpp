@@ -18,6 +18,10 @@ void IFC4X3::IfcVolumeMeasure::getStepParameter( std::stringstream& stream, bool
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcVolumeMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcVolumeMeasure> IFC4X3::IfcVolumeMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcVolumeMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcVolumeMeasure> IFC4X3::IfcVolumeMeasure::createObjectFromS
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcVolumeMeasure> IFC4X3::IfcVolumeMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcVolumeMeasure>(); }
+	shared_ptr<IfcVolumeMeasure> type_object( new IfcVolumeMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
@@ -18,6 +18,10 @@ void IFC4X3::IfcVolumetricFlowRateMeasure::getStepParameter( std::stringstream&
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcVolumetricFlowRateMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcVolumetricFlowRateMeasure> IFC4X3::IfcVolumetricFlowRateMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcVolumetricFlowRateMeasure>(); }
@@ -27,3 +31,10 @@ shared_ptr<IFC4X3::IfcVolumetricFlowRateMeasure> IFC4X3::IfcVolumetricFlowRateMe
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcVolumetricFlowRateMeasure> IFC4X3::IfcVolumetricFlowRateMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcVolumetricFlowRateMeasure>(); }
+	shared_ptr<IfcVolumetricFlowRateMeasure> type_object( new IfcVolumetricFlowRateMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
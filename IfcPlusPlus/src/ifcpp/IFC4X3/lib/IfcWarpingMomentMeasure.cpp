@@ -19,6 +19,10 @@ void IFC4X3::IfcWarpingMomentMeasure::getStepParameter( std::stringstream& strea
 	appendRealWithoutTrailingZeros( stream, m_value, precision );
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWarpingMomentMeasure::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReal( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcWarpingMomentMeasure> IFC4X3::IfcWarpingMomentMeasure::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWarpingMomentMeasure>(); }
@@ -28,3 +32,10 @@ shared_ptr<IFC4X3::IfcWarpingMomentMeasure> IFC4X3::IfcWarpingMomentMeasure::cre
 	readReal( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWarpingMomentMeasure> IFC4X3::IfcWarpingMomentMeasure::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcWarpingMomentMeasure>(); }
+	shared_ptr<IfcWarpingMomentMeasure> type_object( new IfcWarpingMomentMeasure() );
+	readReal( arg, type_object->m_value );
+	return type_object;
+}
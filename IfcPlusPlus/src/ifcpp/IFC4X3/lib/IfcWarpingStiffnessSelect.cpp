@@ -23,3 +23,10 @@ shared_ptr<IFC4X3::IfcWarpingStiffnessSelect> IFC4X3::IfcWarpingStiffnessSelect:
 	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
 	return result_object;
 }
+shared_ptr<IFC4X3::IfcWarpingStiffnessSelect> IFC4X3::IfcWarpingStiffnessSelect::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.isEmpty() ){ return shared_ptr<IfcWarpingStiffnessSelect>(); }
+	shared_ptr<IfcWarpingStiffnessSelect> result_object;
+	readSelectType( arg, result_object, "", map, errorStream, entityIdNotFound );
+	return result_object;
+}
@@ -4,6 +4,7 @@
 #include "ifcpp/model/BuildingGuid.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
 #include "ifcpp/IFC4X3/include/IfcCoordinateReferenceSystem.h"
 #include "ifcpp/IFC4X3/include/IfcWellKnownText.h"
 #include "ifcpp/IFC4X3/include/IfcWellKnownTextLiteral.h"
@@ -26,6 +27,13 @@ void IFC4X3::IfcWellKnownText::readStepArguments( const std::vector<std::string>
 	if( num_args > 1 ){readEntityReference( args[1], m_CoordinateReferenceSystem, map, errorStream, entityIdNotFound );}
 	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcWellKnownText, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWellKnownText::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_WellKnownText = IfcWellKnownTextLiteral::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_CoordinateReferenceSystem, map, errorStream, entityIdNotFound );}
+	if( num_args != 2 ){ errorStream << "Wrong parameter count for entity IfcWellKnownText, expecting 2, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWellKnownText::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	vec_attributes.emplace_back( std::make_pair( "WellKnownText", m_WellKnownText ) );
@@ -34,6 +42,14 @@ void IFC4X3::IfcWellKnownText::getAttributes( std::vector<std::pair<std::string,
 void IFC4X3::IfcWellKnownText::getAttributesInverse( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes_inverse ) const
 {
 }
+void IFC4X3::IfcWellKnownText::visitAttributes( AttributeVisitor& visitor ) const
+{
+	visitor.visitObject( 0, "WellKnownText", m_WellKnownText );
+	visitor.visitObject( 1, "CoordinateReferenceSystem", m_CoordinateReferenceSystem );
+}
+void IFC4X3::IfcWellKnownText::visitAttributesInverse( AttributeVisitor& /*visitor*/ ) const
+{
+}
 void IFC4X3::IfcWellKnownText::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	shared_ptr<IfcWellKnownText> ptr_self = dynamic_pointer_cast<IfcWellKnownText>( ptr_self_entity );
@@ -43,6 +59,13 @@ void IFC4X3::IfcWellKnownText::setInverseCounterparts( shared_ptr<BuildingEntity
 		m_CoordinateReferenceSystem->m_WellKnownText_inverse.emplace_back( ptr_self );
 	}
 }
+void IFC4X3::IfcWellKnownText::getInverseReferences( std::vector<InverseReference>& refs ) const
+{
+	if( m_CoordinateReferenceSystem )
+	{
+		refs.emplace_back( m_CoordinateReferenceSystem.get(), INVERSE_WellKnownText );
+	}
+}
 void IFC4X3::IfcWellKnownText::unlinkFromInverseCounterparts()
 {
 	if( m_CoordinateReferenceSystem )
@@ -68,3 +91,10 @@ void IFC4X3::IfcWellKnownText::unlinkFromInverseCounterparts()
 		}
 	}
 }
+void IFC4X3::IfcWellKnownText::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	if( m_CoordinateReferenceSystem )
+	{
+		refs.push_back( m_CoordinateReferenceSystem.get() );
+	}
+}
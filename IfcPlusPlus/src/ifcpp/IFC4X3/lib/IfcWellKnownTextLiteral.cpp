@@ -17,6 +17,10 @@ void IFC4X3::IfcWellKnownTextLiteral::getStepParameter( std::stringstream& strea
 	stream << "'" << encodeStepString( m_value ) << "'";
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWellKnownTextLiteral::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	return encoder.encodeString( m_value, classID() );
+}
 shared_ptr<IFC4X3::IfcWellKnownTextLiteral> IFC4X3::IfcWellKnownTextLiteral::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWellKnownTextLiteral>(); }
@@ -26,3 +30,10 @@ shared_ptr<IFC4X3::IfcWellKnownTextLiteral> IFC4X3::IfcWellKnownTextLiteral::cre
 	readString( arg, type_object->m_value );
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWellKnownTextLiteral> IFC4X3::IfcWellKnownTextLiteral::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& /*map*/, std::stringstream& /*errorStream*/, std::unordered_set<int>& /*entityIdNotFound*/ )
+{
+	if( arg.isEmpty() ) { return shared_ptr<IfcWellKnownTextLiteral>(); }
+	shared_ptr<IfcWellKnownTextLiteral> type_object( new IfcWellKnownTextLiteral() );
+	readString( arg, type_object->m_value );
+	return type_object;
+}
@@ -80,6 +80,27 @@ void IFC4X3::IfcWindowLiningProperties::readStepArguments( const std::vector<std
 	if( num_args > 15 ){m_LiningToPanelOffsetY = IfcLengthMeasure::createObjectFromSTEP( args[15], map, errorStream, entityIdNotFound );}
 	if( num_args != 16 ){ errorStream << "Wrong parameter count for entity IfcWindowLiningProperties, expecting 16, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWindowLiningProperties::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_LiningDepth = IfcPositiveLengthMeasure::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LiningThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_TransomThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){m_MullionThickness = IfcNonNegativeLengthMeasure::createObjectFromBinary( args[7], map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_FirstTransomOffset = IfcNormalisedRatioMeasure::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_SecondTransomOffset = IfcNormalisedRatioMeasure::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_FirstMullionOffset = IfcNormalisedRatioMeasure::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_SecondMullionOffset = IfcNormalisedRatioMeasure::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){readEntityReference( args[12], m_ShapeAspectStyle, map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_LiningOffset = IfcLengthMeasure::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args > 14 ){m_LiningToPanelOffsetX = IfcLengthMeasure::createObjectFromBinary( args[14], map, errorStream, entityIdNotFound );}
+	if( num_args > 15 ){m_LiningToPanelOffsetY = IfcLengthMeasure::createObjectFromBinary( args[15], map, errorStream, entityIdNotFound );}
+	if( num_args != 16 ){ errorStream << "Wrong parameter count for entity IfcWindowLiningProperties, expecting 16, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWindowLiningProperties::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributes( vec_attributes );
@@ -100,6 +121,26 @@ void IFC4X3::IfcWindowLiningProperties::getAttributesInverse( std::vector<std::p
 {
 	IFC4X3::IfcPreDefinedPropertySet::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcWindowLiningProperties::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributes( visitor );
+	visitor.visitObject( 4, "LiningDepth", m_LiningDepth );
+	visitor.visitObject( 5, "LiningThickness", m_LiningThickness );
+	visitor.visitObject( 6, "TransomThickness", m_TransomThickness );
+	visitor.visitObject( 7, "MullionThickness", m_MullionThickness );
+	visitor.visitObject( 8, "FirstTransomOffset", m_FirstTransomOffset );
+	visitor.visitObject( 9, "SecondTransomOffset", m_SecondTransomOffset );
+	visitor.visitObject( 10, "FirstMullionOffset", m_FirstMullionOffset );
+	visitor.visitObject( 11, "SecondMullionOffset", m_SecondMullionOffset );
+	visitor.visitObject( 12, "ShapeAspectStyle", m_ShapeAspectStyle );
+	visitor.visitObject( 13, "LiningOffset", m_LiningOffset );
+	visitor.visitObject( 14, "LiningToPanelOffsetX", m_LiningToPanelOffsetX );
+	visitor.visitObject( 15, "LiningToPanelOffsetY", m_LiningToPanelOffsetY );
+}
+void IFC4X3::IfcWindowLiningProperties::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcPreDefinedPropertySet::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcWindowLiningProperties::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcPreDefinedPropertySet::setInverseCounterparts( ptr_self_entity );
@@ -108,3 +149,11 @@ void IFC4X3::IfcWindowLiningProperties::unlinkFromInverseCounterparts()
 {
 	IfcPreDefinedPropertySet::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcWindowLiningProperties::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcPreDefinedPropertySet::getEntityReferences( refs );
+	if( m_ShapeAspectStyle )
+	{
+		refs.push_back( m_ShapeAspectStyle.get() );
+	}
+}
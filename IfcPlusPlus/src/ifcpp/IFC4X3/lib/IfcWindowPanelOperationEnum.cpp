@@ -32,6 +32,10 @@ void IFC4X3::IfcWindowPanelOperationEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWindowPanelOperationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcWindowPanelOperationEnum> IFC4X3::IfcWindowPanelOperationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWindowPanelOperationEnum>(); }
@@ -96,3 +100,12 @@ shared_ptr<IFC4X3::IfcWindowPanelOperationEnum> IFC4X3::IfcWindowPanelOperationE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWindowPanelOperationEnum> IFC4X3::IfcWindowPanelOperationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcWindowPanelOperationEnum>(); }
+		return shared_ptr<IfcWindowPanelOperationEnum>( new IfcWindowPanelOperationEnum( IfcWindowPanelOperationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
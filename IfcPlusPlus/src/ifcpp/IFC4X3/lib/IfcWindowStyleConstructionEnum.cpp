@@ -26,6 +26,10 @@ void IFC4X3::IfcWindowStyleConstructionEnum::getStepParameter( std::stringstream
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWindowStyleConstructionEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcWindowStyleConstructionEnum> IFC4X3::IfcWindowStyleConstructionEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWindowStyleConstructionEnum>(); }
@@ -66,3 +70,12 @@ shared_ptr<IFC4X3::IfcWindowStyleConstructionEnum> IFC4X3::IfcWindowStyleConstru
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWindowStyleConstructionEnum> IFC4X3::IfcWindowStyleConstructionEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcWindowStyleConstructionEnum>(); }
+		return shared_ptr<IfcWindowStyleConstructionEnum>( new IfcWindowStyleConstructionEnum( IfcWindowStyleConstructionEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
@@ -29,6 +29,10 @@ void IFC4X3::IfcWindowStyleOperationEnum::getStepParameter( std::stringstream& s
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWindowStyleOperationEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcWindowStyleOperationEnum> IFC4X3::IfcWindowStyleOperationEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWindowStyleOperationEnum>(); }
@@ -81,3 +85,12 @@ shared_ptr<IFC4X3::IfcWindowStyleOperationEnum> IFC4X3::IfcWindowStyleOperationE
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWindowStyleOperationEnum> IFC4X3::IfcWindowStyleOperationEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcWindowStyleOperationEnum>(); }
+		return shared_ptr<IfcWindowStyleOperationEnum>( new IfcWindowStyleOperationEnum( IfcWindowStyleOperationEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
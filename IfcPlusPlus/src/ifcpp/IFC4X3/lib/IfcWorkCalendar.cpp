@@ -61,6 +61,20 @@ void IFC4X3::IfcWorkCalendar::readStepArguments( const std::vector<std::string>&
 	if( num_args > 8 ){m_PredefinedType = IfcWorkCalendarTypeEnum::createObjectFromSTEP( args[8], map, errorStream, entityIdNotFound );}
 	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcWorkCalendar, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWorkCalendar::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){readEntityReferenceList( args[6], m_WorkingTimes, map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_ExceptionTimes, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_PredefinedType = IfcWorkCalendarTypeEnum::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args != 9 ){ errorStream << "Wrong parameter count for entity IfcWorkCalendar, expecting 9, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWorkCalendar::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcControl::getAttributes( vec_attributes );
@@ -76,6 +90,17 @@ void IFC4X3::IfcWorkCalendar::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcWorkCalendar::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributes( visitor );
+	visitor.visitList( 6, "WorkingTimes", AttributeVectorView<IfcWorkTime>( m_WorkingTimes ) );
+	visitor.visitList( 7, "ExceptionTimes", AttributeVectorView<IfcWorkTime>( m_ExceptionTimes ) );
+	visitor.visitObject( 8, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcWorkCalendar::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcWorkCalendar::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcControl::setInverseCounterparts( ptr_self_entity );
@@ -84,3 +109,21 @@ void IFC4X3::IfcWorkCalendar::unlinkFromInverseCounterparts()
 {
 	IfcControl::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcWorkCalendar::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcControl::getEntityReferences( refs );
+	for( size_t i=0; i<m_WorkingTimes.size(); ++i )
+	{
+		if( m_WorkingTimes[i] )
+		{
+			refs.push_back( m_WorkingTimes[i].get() );
+		}
+	}
+	for( size_t i=0; i<m_ExceptionTimes.size(); ++i )
+	{
+		if( m_ExceptionTimes[i] )
+		{
+			refs.push_back( m_ExceptionTimes[i].get() );
+		}
+	}
+}
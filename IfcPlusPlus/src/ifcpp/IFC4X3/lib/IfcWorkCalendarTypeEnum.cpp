@@ -23,6 +23,10 @@ void IFC4X3::IfcWorkCalendarTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWorkCalendarTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcWorkCalendarTypeEnum> IFC4X3::IfcWorkCalendarTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWorkCalendarTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcWorkCalendarTypeEnum> IFC4X3::IfcWorkCalendarTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWorkCalendarTypeEnum> IFC4X3::IfcWorkCalendarTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcWorkCalendarTypeEnum>(); }
+		return shared_ptr<IfcWorkCalendarTypeEnum>( new IfcWorkCalendarTypeEnum( IfcWorkCalendarTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
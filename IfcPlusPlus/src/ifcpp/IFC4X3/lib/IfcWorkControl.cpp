@@ -74,6 +74,24 @@ void IFC4X3::IfcWorkControl::readStepArguments( const std::vector<std::string>&
 	if( num_args > 12 ){m_FinishTime = IfcDateTime::createObjectFromSTEP( args[12], map, errorStream, entityIdNotFound );}
 	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcWorkControl, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWorkControl::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_CreationDate = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_Creators, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_Purpose = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Duration = IfcDuration::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_TotalFloat = IfcDuration::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_StartTime = IfcDateTime::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_FinishTime = IfcDateTime::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args != 13 ){ errorStream << "Wrong parameter count for entity IfcWorkControl, expecting 13, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWorkControl::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcControl::getAttributes( vec_attributes );
@@ -91,6 +109,21 @@ void IFC4X3::IfcWorkControl::getAttributesInverse( std::vector<std::pair<std::st
 {
 	IFC4X3::IfcControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcWorkControl::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributes( visitor );
+	visitor.visitObject( 6, "CreationDate", m_CreationDate );
+	visitor.visitList( 7, "Creators", AttributeVectorView<IfcPerson>( m_Creators ) );
+	visitor.visitObject( 8, "Purpose", m_Purpose );
+	visitor.visitObject( 9, "Duration", m_Duration );
+	visitor.visitObject( 10, "TotalFloat", m_TotalFloat );
+	visitor.visitObject( 11, "StartTime", m_StartTime );
+	visitor.visitObject( 12, "FinishTime", m_FinishTime );
+}
+void IFC4X3::IfcWorkControl::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcWorkControl::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcControl::setInverseCounterparts( ptr_self_entity );
@@ -99,3 +132,14 @@ void IFC4X3::IfcWorkControl::unlinkFromInverseCounterparts()
 {
 	IfcControl::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcWorkControl::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcControl::getEntityReferences( refs );
+	for( size_t i=0; i<m_Creators.size(); ++i )
+	{
+		if( m_Creators[i] )
+		{
+			refs.push_back( m_Creators[i].get() );
+		}
+	}
+}
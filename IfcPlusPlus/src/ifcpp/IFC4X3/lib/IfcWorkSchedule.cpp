@@ -78,6 +78,25 @@ void IFC4X3::IfcWorkSchedule::readStepArguments( const std::vector<std::string>&
 	if( num_args > 13 ){m_PredefinedType = IfcWorkScheduleTypeEnum::createObjectFromSTEP( args[13], map, errorStream, entityIdNotFound );}
 	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcWorkSchedule, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWorkSchedule::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_Identification = IfcIdentifier::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args > 6 ){m_CreationDate = IfcDateTime::createObjectFromBinary( args[6], map, errorStream, entityIdNotFound );}
+	if( num_args > 7 ){readEntityReferenceList( args[7], m_Creators, map, errorStream, entityIdNotFound );}
+	if( num_args > 8 ){m_Purpose = IfcLabel::createObjectFromBinary( args[8], map, errorStream, entityIdNotFound );}
+	if( num_args > 9 ){m_Duration = IfcDuration::createObjectFromBinary( args[9], map, errorStream, entityIdNotFound );}
+	if( num_args > 10 ){m_TotalFloat = IfcDuration::createObjectFromBinary( args[10], map, errorStream, entityIdNotFound );}
+	if( num_args > 11 ){m_StartTime = IfcDateTime::createObjectFromBinary( args[11], map, errorStream, entityIdNotFound );}
+	if( num_args > 12 ){m_FinishTime = IfcDateTime::createObjectFromBinary( args[12], map, errorStream, entityIdNotFound );}
+	if( num_args > 13 ){m_PredefinedType = IfcWorkScheduleTypeEnum::createObjectFromBinary( args[13], map, errorStream, entityIdNotFound );}
+	if( num_args != 14 ){ errorStream << "Wrong parameter count for entity IfcWorkSchedule, expecting 14, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWorkSchedule::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcWorkControl::getAttributes( vec_attributes );
@@ -87,6 +106,15 @@ void IFC4X3::IfcWorkSchedule::getAttributesInverse( std::vector<std::pair<std::s
 {
 	IFC4X3::IfcWorkControl::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcWorkSchedule::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcWorkControl::visitAttributes( visitor );
+	visitor.visitObject( 13, "PredefinedType", m_PredefinedType );
+}
+void IFC4X3::IfcWorkSchedule::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcWorkControl::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcWorkSchedule::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcWorkControl::setInverseCounterparts( ptr_self_entity );
@@ -23,6 +23,10 @@ void IFC4X3::IfcWorkScheduleTypeEnum::getStepParameter( std::stringstream& strea
 	}
 	if( is_select_type ) { stream << ")"; }
 }
+SnapshotNode IFC4X3::IfcWorkScheduleTypeEnum::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeEnum( m_enum, classID() );
+}
 shared_ptr<IFC4X3::IfcWorkScheduleTypeEnum> IFC4X3::IfcWorkScheduleTypeEnum::createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
 {
 	if( arg.size() == 0 ) { return shared_ptr<IfcWorkScheduleTypeEnum>(); }
@@ -51,3 +55,12 @@ shared_ptr<IFC4X3::IfcWorkScheduleTypeEnum> IFC4X3::IfcWorkScheduleTypeEnum::cre
 	}
 	return type_object;
 }
+shared_ptr<IFC4X3::IfcWorkScheduleTypeEnum> IFC4X3::IfcWorkScheduleTypeEnum::createObjectFromBinary( const SnapshotArgument& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	if( arg.kind() == SNAPSHOT_ENUM )
+	{
+		if( arg.integerValue() < 0 || arg.integerValue() > ENUM_NOTDEFINED ) { return shared_ptr<IfcWorkScheduleTypeEnum>(); }
+		return shared_ptr<IfcWorkScheduleTypeEnum>( new IfcWorkScheduleTypeEnum( IfcWorkScheduleTypeEnumEnum( arg.integerValue() ) ) );
+	}
+	return createObjectFromSTEP( arg.toString(), map, errorStream, entityIdNotFound );
+}
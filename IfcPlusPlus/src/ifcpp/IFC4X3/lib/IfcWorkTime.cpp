@@ -40,6 +40,17 @@ void IFC4X3::IfcWorkTime::readStepArguments( const std::vector<std::string>& arg
 	if( num_args > 5 ){m_FinishDate = IfcDate::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcWorkTime, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcWorkTime::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_Name = IfcLabel::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){m_DataOrigin = IfcDataOriginEnum::createObjectFromBinary( args[1], map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_UserDefinedDataOrigin = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){readEntityReference( args[3], m_RecurrencePattern, map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_StartDate = IfcDate::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_FinishDate = IfcDate::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcWorkTime, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcWorkTime::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSchedulingTime::getAttributes( vec_attributes );
@@ -51,6 +62,17 @@ void IFC4X3::IfcWorkTime::getAttributesInverse( std::vector<std::pair<std::strin
 {
 	IFC4X3::IfcSchedulingTime::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcWorkTime::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributes( visitor );
+	visitor.visitObject( 3, "RecurrencePattern", m_RecurrencePattern );
+	visitor.visitObject( 4, "StartDate", m_StartDate );
+	visitor.visitObject( 5, "FinishDate", m_FinishDate );
+}
+void IFC4X3::IfcWorkTime::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSchedulingTime::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcWorkTime::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSchedulingTime::setInverseCounterparts( ptr_self_entity );
@@ -59,3 +81,11 @@ void IFC4X3::IfcWorkTime::unlinkFromInverseCounterparts()
 {
 	IfcSchedulingTime::unlinkFromInverseCounterparts();
 }
+void IFC4X3::IfcWorkTime::getEntityReferences( std::vector<BuildingEntity*>& refs ) const
+{
+	IfcSchedulingTime::getEntityReferences( refs );
+	if( m_RecurrencePattern )
+	{
+		refs.push_back( m_RecurrencePattern.get() );
+	}
+}
@@ -51,6 +51,17 @@ void IFC4X3::IfcZone::readStepArguments( const std::vector<std::string>& args, c
 	if( num_args > 5 ){m_LongName = IfcLabel::createObjectFromSTEP( args[5], map, errorStream, entityIdNotFound );}
 	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcZone, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
 }
+void IFC4X3::IfcZone::readBinaryArguments( const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound )
+{
+	const size_t num_args = args.size();
+	if( num_args > 0 ){m_GlobalId = IfcGloballyUniqueId::createObjectFromBinary( args[0], map, errorStream, entityIdNotFound );}
+	if( num_args > 1 ){readEntityReference( args[1], m_OwnerHistory, map, errorStream, entityIdNotFound );}
+	if( num_args > 2 ){m_Name = IfcLabel::createObjectFromBinary( args[2], map, errorStream, entityIdNotFound );}
+	if( num_args > 3 ){m_Description = IfcText::createObjectFromBinary( args[3], map, errorStream, entityIdNotFound );}
+	if( num_args > 4 ){m_ObjectType = IfcLabel::createObjectFromBinary( args[4], map, errorStream, entityIdNotFound );}
+	if( num_args > 5 ){m_LongName = IfcLabel::createObjectFromBinary( args[5], map, errorStream, entityIdNotFound );}
+	if( num_args != 6 ){ errorStream << "Wrong parameter count for entity IfcZone, expecting 6, having " << num_args << ". Entity ID: " << m_tag << std::endl; }
+}
 void IFC4X3::IfcZone::getAttributes( std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& vec_attributes ) const
 {
 	IFC4X3::IfcSystem::getAttributes( vec_attributes );
@@ -60,6 +71,15 @@ void IFC4X3::IfcZone::getAttributesInverse( std::vector<std::pair<std::string, s
 {
 	IFC4X3::IfcSystem::getAttributesInverse( vec_attributes_inverse );
 }
+void IFC4X3::IfcZone::visitAttributes( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributes( visitor );
+	visitor.visitObject( 5, "LongName", m_LongName );
+}
+void IFC4X3::IfcZone::visitAttributesInverse( AttributeVisitor& visitor ) const
+{
+	IFC4X3::IfcSystem::visitAttributesInverse( visitor );
+}
 void IFC4X3::IfcZone::setInverseCounterparts( shared_ptr<BuildingEntity> ptr_self_entity )
 {
 	IfcSystem::setInverseCounterparts( ptr_self_entity );
@@ -16,12 +16,15 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 */
 
 
+#include <limits>
+#include <tuple>
 #include <ifcpp/geometry/GeometryException.h>
 #include <ifcpp/geometry/GeomDebugDump.h>
 #include <ifcpp/geometry/GeometrySettings.h>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/BuildingException.h>
 #include <ifcpp/model/StatusCallback.h>
+#include <ifcpp/model/Trace.h>
 
 //#define CSG_OCC   // define CSG_OCC to enable OCC fall back if Carve fails
 #include "Carve2OpenCascade.h"
@@ -31,12 +34,178 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "MeshOps.h"
 #include "MeshFlattener.h"
 #include "GeometryInputData.h"
+#include "GeometryStatistics.h"
+#include "ConversionBudget.h"
 
 #if defined(_DEBUG) || defined(_DEBUG_RELEASE)
 static int csg_compute_count = 0;
 #define CSG_DEBUG
 #endif
 
+bool CsgOperandCache::OperandKey::operator<(const OperandKey& other) const
+{
+	return std::tie(input, inputRevision, epsMergePoints, minFaceArea, normalizeScale, normalizeCenter.x, normalizeCenter.y, normalizeCenter.z, flags)
+		< std::tie(other.input, other.inputRevision, other.epsMergePoints, other.minFaceArea, other.normalizeScale, other.normalizeCenter.x, other.normalizeCenter.y, other.normalizeCenter.z, other.flags);
+}
+
+const carve::csg::CSG::face_rtree_t* CsgOperandCache::PreparedOperand::getFaceRTree()
+{
+	if (!m_faceRTree && meshset)
+	{
+		m_faceRTree.reset(carve::csg::CSG::constructFaceRTree(meshset.get()));
+	}
+	return m_faceRTree.get();
+}
+
+CsgOperandCache::OperandKey CsgOperandCache::makeKey(const shared_ptr<carve::mesh::MeshSet<3> >& input, const GeomProcessingParams& params, const CarveMeshNormalizer* normalizer)
+{
+	OperandKey key;
+	key.input = input.get();
+	key.inputRevision = input->revision();
+	key.epsMergePoints = params.epsMergePoints;
+	key.minFaceArea = params.minFaceArea;
+	key.flags = (params.allowFinEdges ? 1 : 0)
+		| (params.allowDegenerateEdges ? 2 : 0)
+		| (params.allowZeroAreaFaces ? 4 : 0)
+		| (params.checkZeroAreaFaces ? 8 : 0)
+		| (params.triangulateResult ? 16 : 0)
+		| (params.shouldBeClosedManifold ? 32 : 0)
+		| (params.treatLongThinFaceAsDegenerate ? 64 : 0)
+		| (params.mergeAlignedEdges ? 128 : 0);
+
+	if (normalizer)
+	{
+		key.normalizeScale = normalizer->getScale();
+		key.normalizeCenter = normalizer->getNormalizeCenter();
+		key.flags |= 256;
+		if (normalizer->m_normalizeCoordsInsteadOfEpsilon) { key.flags |= 512; }
+		if (normalizer->m_disableNormalizeAll) { key.flags |= 1024; }
+	}
+	return key;
+}
+
+CsgOperandCache::InputInfo* CsgOperandCache::findInputInfo(const OperandKey& key)
+{
+	auto it = m_inputInfo.find(key);
+	if (it != m_inputInfo.end())
+	{
+		return &(it->second);
+	}
+	return nullptr;
+}
+
+CsgOperandCache::InputInfo& CsgOperandCache::insertInputInfo(const OperandKey& key, const InputInfo& info)
+{
+	InputInfo& entry = m_inputInfo[key];
+	entry = info;
+	return entry;
+}
+
+shared_ptr<CsgOperandCache::PreparedOperand> CsgOperandCache::findPreparedOperand(const OperandKey& key)
+{
+	auto it = m_preparedOperands.find(key);
+	if (it != m_preparedOperands.end())
+	{
+		return it->second;
+	}
+	return shared_ptr<PreparedOperand>();
+}
+
+void CsgOperandCache::insertPreparedOperand(const OperandKey& key, const shared_ptr<PreparedOperand>& prepared)
+{
+	m_preparedOperands[key] = prepared;
+}
+
+void CsgOperandCache::invalidate(const carve::mesh::MeshSet<3>* input)
+{
+	// keys are ordered by input pointer first, so all entries of one input are in one range
+	OperandKey lowerKey;
+	lowerKey.input = input;
+	lowerKey.inputRevision = 0;
+	lowerKey.epsMergePoints = -std::numeric_limits<double>::max();
+	
+	for (auto it = m_inputInfo.lower_bound(lowerKey); it != m_inputInfo.end() && it->first.input == input; )
+	{
+		it = m_inputInfo.erase(it);
+	}
+	for (auto it = m_preparedOperands.lower_bound(lowerKey); it != m_preparedOperands.end() && it->first.input == input; )
+	{
+		it = m_preparedOperands.erase(it);
+	}
+}
+
+void CsgOperandCache::clear()
+{
+	m_inputInfo.clear();
+	m_preparedOperands.clear();
+}
+
+static CsgOperandCache::InputInfo getInputInfo(const shared_ptr<carve::mesh::MeshSet<3> >& input, const GeomProcessingParams& params, CsgOperandCache* operandCache)
+{
+	CsgOperandCache::OperandKey key;
+	if (operandCache)
+	{
+		key = CsgOperandCache::makeKey(input, params, nullptr);
+		CsgOperandCache::InputInfo* existingInfo = operandCache->findInputInfo(key);
+		if (existingInfo)
+		{
+			return *existingInfo;
+		}
+	}
+
+	CsgOperandCache::InputInfo inputInfo;
+	inputInfo.input = input;
+	inputInfo.numDegenerateFaces = MeshOps::countDegeneratedFaces(input.get());
+	if (inputInfo.numDegenerateFaces == 0)
+	{
+		MeshSetInfo info(params.callbackFunc, params.ifc_entity);
+		inputInfo.meshSetValid = MeshOps::checkMeshSetValidAndClosed(input, info, params);
+		inputInfo.numZeroAreaFaces = info.zeroAreaFaces.size();
+	}
+
+	if (operandCache)
+	{
+		// the check can invert negative meshes of the input, which changes its revision
+		key = CsgOperandCache::makeKey(input, params, nullptr);
+		operandCache->insertInputInfo(key, inputInfo);
+	}
+	return inputInfo;
+}
+
+static shared_ptr<CsgOperandCache::PreparedOperand> prepareOperand(const shared_ptr<carve::mesh::MeshSet<3> >& input, CarveMeshNormalizer& normMesh, const std::string& normTag,
+	double epsDefault, const GeomProcessingParams& paramsScaled, CsgOperandCache* operandCache)
+{
+	CsgOperandCache::OperandKey key;
+	if (operandCache)
+	{
+		key = CsgOperandCache::makeKey(input, paramsScaled, &normMesh);
+		key.epsMergePoints = epsDefault;
+		shared_ptr<CsgOperandCache::PreparedOperand> existingOperand = operandCache->findPreparedOperand(key);
+		if (existingOperand && existingOperand->meshset->revision() == existingOperand->revision)
+		{
+			return existingOperand;
+		}
+	}
+
+	shared_ptr<CsgOperandCache::PreparedOperand> prepared(new CsgOperandCache::PreparedOperand());
+	prepared->input = input;
+	prepared->meshset = shared_ptr<carve::mesh::MeshSet<3> >(input->clone());
+	prepared->info.report_callback = paramsScaled.callbackFunc;
+	prepared->info.entity = paramsScaled.ifc_entity;
+
+	// normalize first, so that EPS values match the size of different meshes
+	normMesh.normalizeMesh(prepared->meshset, normTag, epsDefault);
+	MeshOps::simplifyMeshSet(prepared->meshset, prepared->info, paramsScaled);
+	prepared->volume = MeshOps::computeMeshsetVolume(prepared->meshset.get());
+	prepared->revision = prepared->meshset->revision();
+
+	if (operandCache)
+	{
+		operandCache->insertPreparedOperand(key, prepared);
+	}
+	return prepared;
+}
+
 void CSG_Adapter::mergeMeshesToMeshset(std::vector<carve::mesh::Mesh<3>*>& meshes, shared_ptr<carve::mesh::MeshSet<3> >& result, GeomProcessingParams& params)
 {
 	for (size_t ii = 0; ii < meshes.size(); ++ii)
@@ -234,7 +403,7 @@ bool checkResultByBBoxAndVolume(const shared_ptr<carve::mesh::MeshSet<3> >& op1,
 
 bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& inputA, const shared_ptr<carve::mesh::MeshSet<3> >& inputB, 
 	const carve::csg::CSG::OP operation, shared_ptr<carve::mesh::MeshSet<3> >& result,
-	GeomProcessingParams& params, CsgOperationParams& csgParams)
+	GeomProcessingParams& params, CsgOperationParams& csgParams, CsgOperandCache* operandCache)
 {
 	if (!inputA || !inputB)
 	{
@@ -242,14 +411,13 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 		return false;
 	}
 
-	if (inputA->vertex_storage.size() > 4000)
-	{
-		assignResultOnFail(inputA, inputB, operation, result);
-		return false;
-	}
-
-	if (inputB->vertex_storage.size() > 4000)
+	if (inputA->vertex_storage.size() > 4000 || inputB->vertex_storage.size() > 4000)
 	{
+		GeometryStatistics::ProductStatistics* statistics = GeometryStatistics::getCurrentProduct();
+		if (statistics)
+		{
+			++statistics->numCsgOperandTooLarge;
+		}
 		assignResultOnFail(inputA, inputB, operation, result);
 		return false;
 	}
@@ -269,6 +437,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 	// ScopedTimeMeasure() : in destructor, measure end time and save in map 100 most time consuming tags
 	ScopedTimeMeasure measure(&(params.generalSettings->m_mapCsgTimeTag), tag, 10);
 #endif
+	IFCPP_TRACE_SCOPE_ENTITY("CSG attempt", params.ifc_entity);
 
 	printToDebugLog(__FUNC__, "element tag " + std::to_string(tag));
 	GeomProcessingParams paramsUnscaled(params);
@@ -300,60 +469,86 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 		return true;
 	}
 
-	size_t numDegenerateFacesA = MeshOps::countDegeneratedFaces(inputA.get());
-	size_t numDegenerateFacesB = MeshOps::countDegeneratedFaces(inputB.get());
-	if (numDegenerateFacesA > 0)
+	if (inputA == inputB)
 	{
 		assignResultOnFail(inputA, inputB, operation, result);
 		return true;
 	}
-	if (numDegenerateFacesB > 0)
+
+	MeshSetInfo infoResult(params.callbackFunc, params.ifc_entity);
+	paramsScaled.allowFinEdges = csgParams.allowFinEdgesInResult;
+	paramsUnscaled.allowFinEdges = csgParams.allowFinEdgesInResult;
+
+	// degenerate faces and validity of the inputs do not change across retries, so they are taken from the cache if possible
+	CsgOperandCache::InputInfo inputInfoA = getInputInfo(inputA, paramsScaled, operandCache);
+	CsgOperandCache::InputInfo inputInfoB = getInputInfo(inputB, paramsScaled, operandCache);
+	if (inputInfoA.numDegenerateFaces > 0)
 	{
 		assignResultOnFail(inputA, inputB, operation, result);
 		return true;
 	}
-
-	if (inputA == inputB)
+	if (inputInfoB.numDegenerateFaces > 0)
 	{
 		assignResultOnFail(inputA, inputB, operation, result);
 		return true;
 	}
 
-	MeshSetInfo infoResult(params.callbackFunc, params.ifc_entity);
+#ifdef CSG_DEBUG
 	MeshSetInfo infoInputA(params.callbackFunc, params.ifc_entity);
 	MeshSetInfo infoInputB(params.callbackFunc, params.ifc_entity);
-	paramsScaled.allowFinEdges = csgParams.allowFinEdgesInResult;
-	paramsUnscaled.allowFinEdges = csgParams.allowFinEdgesInResult;
 	MeshOps::checkMeshSetValidAndClosed(inputA, infoInputA, paramsScaled);
 	MeshOps::checkMeshSetValidAndClosed(inputB, infoInputB, paramsScaled);
+#endif
 
-	shared_ptr<carve::mesh::MeshSet<3> > op1(inputA->clone());
-	shared_ptr<carve::mesh::MeshSet<3> > op2(inputB->clone());
+	shared_ptr<carve::mesh::MeshSet<3> > op1;
+	shared_ptr<carve::mesh::MeshSet<3> > op2;
+	shared_ptr<CsgOperandCache::PreparedOperand> preparedOp1;
+	shared_ptr<CsgOperandCache::PreparedOperand> preparedOp2;
 
 	std::stringstream strs_err;
 	try
 	{
-		// normalize first, so that EPS values match the size of different meshes
-		normMesh.normalizeMesh(op1, "op1", epsDefault);
-		normMesh.normalizeMesh(op2, "op2", epsDefault);
+		paramsScaled.triangulateResult = true;
+		paramsScaled.shouldBeClosedManifold = true;
+		paramsScaled.allowDegenerateEdges = csgParams.allowDegenerateEdges;
 
 		if (csgParams.flattenFacePlanes )
 		{
+			// flattening modifies both operands together, so these copies are not shared with other attempts
+			preparedOp1 = shared_ptr<CsgOperandCache::PreparedOperand>(new CsgOperandCache::PreparedOperand());
+			preparedOp2 = shared_ptr<CsgOperandCache::PreparedOperand>(new CsgOperandCache::PreparedOperand());
+			preparedOp1->input = inputA;
+			preparedOp2->input = inputB;
+			preparedOp1->meshset = shared_ptr<carve::mesh::MeshSet<3> >(inputA->clone());
+			preparedOp2->meshset = shared_ptr<carve::mesh::MeshSet<3> >(inputB->clone());
+			preparedOp1->info = MeshSetInfo(params.callbackFunc, params.ifc_entity);
+			preparedOp2->info = MeshSetInfo(params.callbackFunc, params.ifc_entity);
+
+			// normalize first, so that EPS values match the size of different meshes
+			normMesh.normalizeMesh(preparedOp1->meshset, "op1", epsDefault);
+			normMesh.normalizeMesh(preparedOp2->meshset, "op2", epsDefault);
+
 			MeshFlattener flat;
-			flat.flattenFacePlanes(op1, op2, paramsScaled);
-		}
+			flat.flattenFacePlanes(preparedOp1->meshset, preparedOp2->meshset, paramsScaled);
 
-		paramsScaled.triangulateResult = true;
-		paramsScaled.shouldBeClosedManifold = true;
-		paramsScaled.allowDegenerateEdges = csgParams.allowDegenerateEdges;
+			MeshOps::simplifyMeshSet(preparedOp1->meshset, preparedOp1->info, paramsScaled);
+			MeshOps::simplifyMeshSet(preparedOp2->meshset, preparedOp2->info, paramsScaled);
+			preparedOp1->volume = MeshOps::computeMeshsetVolume(preparedOp1->meshset.get());
+			preparedOp2->volume = MeshOps::computeMeshsetVolume(preparedOp2->meshset.get());
+		}
+		else
+		{
+			preparedOp1 = prepareOperand(inputA, normMesh, "op1", epsDefault, paramsScaled, operandCache);
+			preparedOp2 = prepareOperand(inputB, normMesh, "op2", epsDefault, paramsScaled, operandCache);
+		}
 
-		MeshSetInfo infoOp1(params.callbackFunc, params.ifc_entity);
-		MeshSetInfo infoOp2(params.callbackFunc, params.ifc_entity);
-		MeshOps::simplifyMeshSet(op1, infoOp1, paramsScaled);
-		MeshOps::simplifyMeshSet(op2, infoOp2, paramsScaled);
+		op1 = preparedOp1->meshset;
+		op2 = preparedOp2->meshset;
+		MeshSetInfo infoOp1(preparedOp1->info);
+		MeshSetInfo infoOp2(preparedOp2->info);
 
-		double volumeOp1 = MeshOps::computeMeshsetVolume(op1.get());
-		double volumeOp2 = MeshOps::computeMeshsetVolume(op2.get());
+		double volumeOp1 = preparedOp1->volume;
+		double volumeOp2 = preparedOp2->volume;
 		double expectedMinVolume = (volumeOp1 - volumeOp2) * 0.99; // leave 1% margin for mesh inaccuracies
 
 		if (infoOp1.finEdges.size() > 0)
@@ -368,7 +563,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 			paramsUnscaled.allowFinEdges = true;
 		}
 
-		if (infoInputA.zeroAreaFaces.size() > 0)
+		if (inputInfoA.numZeroAreaFaces > 0)
 		{
 			paramsScaled.allowZeroAreaFaces = true;  // temp
 			paramsUnscaled.allowZeroAreaFaces = true;  // temp
@@ -463,7 +658,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 
 			normMesh.normalizeMesh(op1, "op1_copy", epsDefault);
 			MeshOps::checkMeshSetValidAndClosed(op1, infoOp1, paramsScaled);
-			if (!infoOp1.meshSetValid && infoInputA.meshSetValid)
+			if (!infoOp1.meshSetValid && inputInfoA.meshSetValid)
 			{
 				// normalizing changed the validity, should not happen
 #ifdef CSG_DEBUG
@@ -481,7 +676,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 
 			normMesh.normalizeMesh(op2, "op2_copy", epsDefault);
 			MeshOps::checkMeshSetValidAndClosed(op2, infoOp2, paramsScaled);
-			if (!infoOp2.meshSetValid && infoInputB.meshSetValid)
+			if (!infoOp2.meshSetValid && inputInfoB.meshSetValid)
 			{
 				// normalizing changed the validity, should not happen
 #ifdef CSG_DEBUG
@@ -521,12 +716,22 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 		if (op1->meshes.size() > 1 && operation == carve::csg::CSG::A_MINUS_B)
 		{
 			handleInnerOuterMeshesInOperands(op1, op2, result, paramsScaled, boolOpDone, epsDefault);
+
+			// meshes of op1 might have been inverted, so the prepared copy can not be shared any more
+			if (operandCache)
+			{
+				operandCache->invalidate(inputA.get());
+			}
 		}
 
+		// the face R-trees depend only on the operands, so they are built once and shared by both classifiers, and with other attempts on the same operands
+		const carve::csg::CSG::face_rtree_t* rtreeOp1 = (op1 == preparedOp1->meshset) ? preparedOp1->getFaceRTree() : nullptr;
+		const carve::csg::CSG::face_rtree_t* rtreeOp2 = (op2 == preparedOp2->meshset) ? preparedOp2->getFaceRTree() : nullptr;
+
 		if (!boolOpDone)
 		{
 			carve::csg::CSG csg(epsDefault);
-			result = shared_ptr<carve::mesh::MeshSet<3> >(csg.compute(op1.get(), op2.get(), operation, nullptr, carve::csg::CSG::CLASSIFY_EDGE));
+			result = shared_ptr<carve::mesh::MeshSet<3> >(csg.compute(op1.get(), rtreeOp1, op2.get(), rtreeOp2, operation, nullptr, carve::csg::CSG::CLASSIFY_EDGE));
 		}
 
 		paramsScaled.allowFinEdges = csgParams.allowFinEdgesInResult;
@@ -609,7 +814,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 		{
 			// no success so far. Try again with CLASSIFY_NORMAL
 			carve::csg::CSG csg(epsDefault);
-			shared_ptr<carve::mesh::MeshSet<3> > resultClassifyNormal(csg.compute(op1.get(), op2.get(), operation, nullptr, carve::csg::CSG::CLASSIFY_NORMAL));
+			shared_ptr<carve::mesh::MeshSet<3> > resultClassifyNormal(csg.compute(op1.get(), rtreeOp1, op2.get(), rtreeOp2, operation, nullptr, carve::csg::CSG::CLASSIFY_NORMAL));
 
 			MeshSetInfo infoResultClassifyNormal;
 			MeshOps::checkMeshSetValidAndClosed(resultClassifyNormal, infoResultClassifyNormal, paramsScaled);
@@ -722,6 +927,12 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 #endif
 		}
 	}
+	catch (carve::interrupted&)
+	{
+		// time limit of the element reached, or conversion canceled. computeCSG keeps op1 unchanged
+		assignResultOnFail(inputA, inputB, operation, result);
+		return false;
+	}
 	catch (carve::exception& ce)
 	{
 		strs_err << "csg operation failed" << ce.str().c_str();
@@ -772,13 +983,38 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 }
 #define _ORDER_CSG_BY_VOLUME
 
-void CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2, const carve::csg::CSG::OP operation, GeomProcessingParams& params)
+const std::vector<CSG_Adapter::CsgOperationParams>& CSG_Adapter::getCsgOperationVariants()
+{
+	static const std::vector<CsgOperationParams> vecCsgParams =
+	{
+		// epsFactor, normalizeCoords, allowDegenEdges, allowFinFacesInResult, allowFinEdgesInResult, flattenFacePlanes
+		{1.0,			true,			false,			false,			false,					false },
+		{1.0,			true,			false,			false,			false,					true },	// one variant with flattenFacePlanes
+		{1.0,			true,			true,			false,			false,					false },
+		{15.3,			true,			true,			false,			false,					false },	// one variant with bigger epsilon
+		{0.11,			true,			true,			false,			false,					false },	// one variant with smaller epsilon
+		{1.0,			true,			true,			true,			true,					false },
+		{1.0,			false,			true,			false,			false,					false }		// one variant without normalizing
+	};
+	return vecCsgParams;
+}
+
+void CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2, const carve::csg::CSG::OP operation, GeomProcessingParams& params,
+	CsgOperandCache* operandCache)
 {
 	if (!op1 || operands2.size() == 0)
 	{
 		return;
 	}
 
+	CsgOperandCache operandCacheLocal;
+	if (!operandCache)
+	{
+		operandCache = &operandCacheLocal;
+	}
+
+	GeometryStatistics::ProductStatistics* statistics = GeometryStatistics::getCurrentProduct();
+	const std::vector<CsgOperationParams>& vecCsgParams = getCsgOperationVariants();
 	bool success = false;
 	std::multimap<double, shared_ptr<carve::mesh::MeshSet<3> > > mapVolumeMeshes;
 	for (const shared_ptr<carve::mesh::MeshSet<3> >&meshset2 : operands2)
@@ -792,35 +1028,63 @@ void CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const st
 	{
 		const shared_ptr<carve::mesh::MeshSet<3> >& meshset2 = it->second;
 #endif
-		std::vector<CsgOperationParams> vecCsgParams =
+		if (ConversionBudget::isCurrentExceeded())
+		{
+			// keep op1 with the operands that are applied so far, for A_MINUS_B that is the element without the remaining openings
+			break;
+		}
+
+		if (statistics)
 		{
-			// epsFactor, normalizeCoords, allowDegenEdges, allowFinFacesInResult, allowFinEdgesInResult, flattenFacePlanes
-			{1.0,			true,			false,			false,			false,					false },
-			{1.0,			true,			false,			false,			false,					true },	// one variant with flattenFacePlanes
-			{1.0,			true,			true,			false,			false,					false },
-			{15.3,			true,			true,			false,			false,					false },	// one variant with bigger epsilon
-			{0.11,			true,			true,			false,			false,					false },	// one variant with smaller epsilon
-			{1.0,			true,			true,			true,			true,					false },
-			{1.0,			false,			true,			false,			false,					false }		// one variant without normalizing
-		};
+			++statistics->numCsgOperations;
+			if (op1 && meshset2)
+			{
+				statistics->numCsgFacesIn += MeshOps::getNumFaces(op1.get()) + MeshOps::getNumFaces(meshset2.get());
+			}
+		}
 
-		for (size_t ii = 0; ii < vecCsgParams.size(); ++ii)
+		for (size_t ii = 0; ii < vecCsgParams.size() && !ConversionBudget::isCurrentExceeded(); ++ii)
 		{
 			shared_ptr<carve::mesh::MeshSet<3> > result;
-			CsgOperationParams& csgParams = vecCsgParams[ii];
-			success = computeCSG_Carve(op1, meshset2, operation, result, params, csgParams);
+			CsgOperationParams csgParams = vecCsgParams[ii];
+			success = computeCSG_Carve(op1, meshset2, operation, result, params, csgParams, operandCache);
+			if (statistics)
+			{
+				++statistics->numCsgAttempts;
+			}
 
 			if (success)
 			{
+				if (statistics)
+				{
+					statistics->numCsgSucceededByVariant.resize(vecCsgParams.size(), 0);
+					++statistics->numCsgSucceededByVariant[ii];
+					if (result)
+					{
+						statistics->numCsgFacesOut += MeshOps::getNumFaces(result.get());
+					}
+				}
+
 				if (operation == carve::csg::CSG::A_MINUS_B || operation == carve::csg::CSG::UNION)
 				{
-					op1 = result;
+					if (op1 != result)
+					{
+						// only the entries of the changed operand are outdated. Prepared copies of the other operands stay valid
+						operandCache->invalidate(op1.get());
+						op1 = result;
+					}
 				}
 
 				break;
 			}
 		}
+
+		if (!success && statistics)
+		{
+			++statistics->numCsgFailed;
+		}
 	}
+	operandCache->invalidate(op1.get());
 }
 
 void CSG_Adapter::handleInnerOuterMeshesInOperands(shared_ptr<carve::mesh::MeshSet<3> >& op1, shared_ptr<carve::mesh::MeshSet<3> >& op2, shared_ptr<carve::mesh::MeshSet<3> >& result,
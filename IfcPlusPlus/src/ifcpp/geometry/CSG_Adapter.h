@@ -17,17 +17,82 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <ifcpp/geometry/GeometrySettings.h>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/BuildingException.h>
 
 #include "IncludeCarveHeaders.h"
+#include "GeometryInputData.h"
+
+class CarveMeshNormalizer;
+
+//\brief Keeps the prepared (normalized, simplified and validated) copies of CSG operands together with their face R-trees.
+// Entries are bound to the input meshset and to the parameters that influence the preparation, so they can be reused across the retry
+// ladder in CSG_Adapter::computeCSG, and across consecutive subtractions of the same openings from the meshsets of one host.
+// When an operand is replaced by the result of a boolean operation, only the entries of that operand are dropped.
+class CsgOperandCache
+{
+public:
+	struct OperandKey
+	{
+		const carve::mesh::MeshSet<3>* input = nullptr;
+		uint64_t inputRevision = 0;	// entries of a modified input are not matched anymore
+		double epsMergePoints = 0;
+		double minFaceArea = 0;
+		double normalizeScale = 1.0;
+		vec3 normalizeCenter;
+		int flags = 0;
+
+		bool operator<(const OperandKey& other) const;
+	};
+
+	struct InputInfo
+	{
+		shared_ptr<carve::mesh::MeshSet<3> > input;	// keeps the input alive, so that its address is not reused for a different meshset
+		size_t numDegenerateFaces = 0;
+		bool meshSetValid = false;
+		size_t numZeroAreaFaces = 0;
+	};
+
+	struct PreparedOperand
+	{
+		shared_ptr<carve::mesh::MeshSet<3> > input;
+		shared_ptr<carve::mesh::MeshSet<3> > meshset;	// normalized and simplified copy of input. Must not be modified, since it is shared
+		MeshSetInfo info;
+		double volume = 0;
+		uint64_t revision = 0;	// revision of meshset after preparation, to detect modifications of the shared copy
+
+		const carve::csg::CSG::face_rtree_t* getFaceRTree();
+
+	private:
+		std::unique_ptr<carve::csg::CSG::face_rtree_t> m_faceRTree;
+	};
+
+	static OperandKey makeKey(const shared_ptr<carve::mesh::MeshSet<3> >& input, const GeomProcessingParams& params, const CarveMeshNormalizer* normalizer);
+
+	InputInfo* findInputInfo(const OperandKey& key);
+	InputInfo& insertInputInfo(const OperandKey& key, const InputInfo& info);
+	shared_ptr<PreparedOperand> findPreparedOperand(const OperandKey& key);
+	void insertPreparedOperand(const OperandKey& key, const shared_ptr<PreparedOperand>& prepared);
+
+	/** drops all entries that are derived from the given input meshset */
+	void invalidate(const carve::mesh::MeshSet<3>* input);
+	void clear();
+
+private:
+	std::map<OperandKey, InputInfo> m_inputInfo;
+	std::map<OperandKey, shared_ptr<PreparedOperand> > m_preparedOperands;
+};
 
 class CSG_Adapter
 {
 public:
+	/** \brief computeCSG: apply operation with all operands2 to op1. 
+	* @param operandCache optional cache of prepared operands. If it is given, it may be shared by subsequent calls with the same operands2, for example when the openings of an element are subtracted from several meshsets */
 	static void computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2,
-		const carve::csg::CSG::OP operation, GeomProcessingParams& params);
+		const carve::csg::CSG::OP operation, GeomProcessingParams& params, CsgOperandCache* operandCache = nullptr);
 
 
 	static void mergeMeshesToMeshset(std::vector<carve::mesh::Mesh<3>*>& meshes, shared_ptr<carve::mesh::MeshSet<3> >& result, GeomProcessingParams& params);
@@ -45,8 +110,12 @@ public:
 		bool allowFinEdgesInResult = false;
 		bool flattenFacePlanes = false;
 	};
+
+	/** \brief Variants of CsgOperationParams that computeCSG tries in this order, until one succeeds */
+	static const std::vector<CsgOperationParams>& getCsgOperationVariants();
+
 	static bool computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& inputA, const shared_ptr<carve::mesh::MeshSet<3> >& inputB, const carve::csg::CSG::OP operation, shared_ptr<carve::mesh::MeshSet<3> >& result,
-		GeomProcessingParams& params, CsgOperationParams& csgParams);
+		GeomProcessingParams& params, CsgOperationParams& csgParams, CsgOperandCache* operandCache = nullptr);
 
 	
 	static bool computeCSG_OCC(const shared_ptr<carve::mesh::MeshSet<3> >& inputA, const shared_ptr<carve::mesh::MeshSet<3> >& inputB, const carve::csg::CSG::OP operation, shared_ptr<carve::mesh::MeshSet<3> >& result,
@@ -0,0 +1,55 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <carve/carve.hpp>
+#include "ConversionBudget.h"
+
+static thread_local const ConversionBudget* t_currentBudget = nullptr;
+
+static bool checkBudgetExceeded(const void* budget)
+{
+	return static_cast<const ConversionBudget*>(budget)->isExceeded();
+}
+
+static void setCurrentBudget(const ConversionBudget* budget)
+{
+	t_currentBudget = budget;
+	if (budget)
+	{
+		carve::set_interrupt_check(&checkBudgetExceeded, budget);
+	}
+	else
+	{
+		carve::set_interrupt_check(nullptr, nullptr);
+	}
+}
+
+ConversionBudget::ScopedElement::ScopedElement(const ConversionBudget* budget)
+{
+	m_previous = t_currentBudget;
+	setCurrentBudget(budget);
+}
+
+ConversionBudget::ScopedElement::~ScopedElement()
+{
+	setCurrentBudget(m_previous);
+}
+
+const ConversionBudget* ConversionBudget::getCurrent()
+{
+	return t_currentBudget;
+}
@@ -0,0 +1,114 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ifcpp/model/BasicTypes.h>
+
+/**
+*\brief Class CancellationToken: cancels a running geometry conversion from another thread, see GeometrySettings::setCancellationToken
+*/
+class CancellationToken
+{
+public:
+	void cancel() { m_canceled.store(true, std::memory_order_relaxed); }
+	void reset() { m_canceled.store(false, std::memory_order_relaxed); }
+	bool isCanceled() const { return m_canceled.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> m_canceled{ false };
+};
+
+/**
+*\brief Class ConversionBudget: deadline and cancellation of the element that is converted in the current thread.
+* GeometryConverter creates one per element from the time limits in GeometrySettings. CSG_Adapter, MeshSimplifier and the intersection loops of Carve check it, see ScopedElement.
+* An element that exceeds its budget keeps the geometry that is converted so far, for example without the openings that are not subtracted yet.
+*/
+class ConversionBudget
+{
+public:
+	typedef std::chrono::steady_clock clock;
+
+	//\brief deadline clock::time_point::max() for no time limit, token may be nullptr. A budget can be checked from several threads
+	ConversionBudget(const shared_ptr<CancellationToken>& token, clock::time_point deadline) : m_token(token), m_deadline(deadline)
+	{
+	}
+
+	//\brief now + seconds, or clock::time_point::max() if seconds is 0 or less. Values beyond 30 years also mean no limit, to avoid an overflow of clock::duration
+	static clock::time_point deadlineAfter(double seconds)
+	{
+		if (seconds <= 0 || seconds > 1e9)
+		{
+			return clock::time_point::max();
+		}
+		return clock::now() + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(seconds));
+	}
+
+	const shared_ptr<CancellationToken>& getToken() const { return m_token; }
+	clock::time_point getDeadline() const { return m_deadline; }
+
+	//\brief False if there is neither a token nor a deadline, then nothing needs to be checked
+	bool hasLimit() const { return m_token || m_deadline != clock::time_point::max(); }
+
+	//\brief True if the token is canceled or the deadline has passed. Once true, it stays true
+	bool isExceeded() const
+	{
+		if (m_exceeded.load(std::memory_order_relaxed))
+		{
+			return true;
+		}
+		if ((m_token && m_token->isCanceled()) || (m_deadline != clock::time_point::max() && clock::now() > m_deadline))
+		{
+			m_exceeded.store(true, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	//\brief True if an earlier isExceeded() returned true, so an operation has been stopped or skipped. Does not check the clock
+	bool hasBeenExceeded() const { return m_exceeded.load(std::memory_order_relaxed); }
+
+	/** \brief Sets the budget of the current thread, also for carve::check_interrupt, and restores the previous one in the destructor */
+	class ScopedElement
+	{
+	public:
+		explicit ScopedElement(const ConversionBudget* budget);
+		~ScopedElement();
+		ScopedElement(const ScopedElement&) = delete;
+		ScopedElement& operator=(const ScopedElement&) = delete;
+
+	private:
+		const ConversionBudget* m_previous = nullptr;
+	};
+
+	/** \brief Budget of the current thread, nullptr if there is none */
+	static const ConversionBudget* getCurrent();
+
+	/** \brief True if the current thread has a budget and it is exceeded */
+	static bool isCurrentExceeded()
+	{
+		const ConversionBudget* budget = getCurrent();
+		return budget && budget->isExceeded();
+	}
+
+private:
+	shared_ptr<CancellationToken>	m_token;
+	clock::time_point				m_deadline;
+	mutable std::atomic<bool>		m_exceeded{ false };
+};
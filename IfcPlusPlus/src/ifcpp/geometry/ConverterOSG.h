@@ -17,6 +17,12 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <unordered_map>
+#include <vector>
 #include <osg/CullFace>
 #include <osg/Geode>
 #include <osg/Hint>
@@ -55,7 +61,10 @@ protected:
 	shared_ptr<GeometrySettings>						m_geom_settings;
 	std::map<std::string, osg::ref_ptr<ProductNodeType> >	m_map_entity_guid_to_switch;
 	std::map<int, osg::ref_ptr<ProductNodeType> >			m_map_representation_id_to_switch;
-	std::vector<osg::ref_ptr<osg::Vec3Array> >			m_cache_vertices;
+	// Caches for buffer reuse, key: hash of the array content. Arrays with equal hash are compared completely before they are shared
+	std::unordered_multimap<size_t, osg::ref_ptr<osg::Vec3Array> >		m_cache_vertices;
+	std::unordered_multimap<size_t, osg::ref_ptr<osg::Vec3Array> >		m_cache_normals;
+	std::unordered_multimap<size_t, osg::ref_ptr<osg::DrawElements> >	m_cache_draw_elements;
 	bool												m_caching_enabled = false;
 	double												m_recent_progress;
 	osg::ref_ptr<osg::CullFace>							m_cull_back_off;
@@ -63,6 +72,7 @@ protected:
 	double												m_crease_edges_max_delta_angle = M_PI * 0.05;
 	double												m_crease_edges_line_width = 1.5;
 	float												m_epsilon = 1.5e-8f;
+	float												m_cache_hash_grid = 1e-4f;
 	bool												m_render_crease_edges = false;
 	bool												m_draw_bounding_box = false;
 	size_t m_numConvertedProducts = 0;
@@ -80,6 +90,10 @@ public:
 	bool getRenderCreaseEdges() { return m_render_crease_edges; }
 	void setRenderCreaseEdges(bool render_crease_edges) { m_render_crease_edges = render_crease_edges; }
 
+	/**\brief Share equal vertex, normal and index arrays between geometries, for example repeated furniture */
+	bool getCachingEnabled() { return m_caching_enabled; }
+	void setCachingEnabled(bool caching_enabled) { m_caching_enabled = caching_enabled; }
+
 
 	// Map: IfcProduct ID -> scenegraph switch
 	std::map<std::string, osg::ref_ptr<ProductNodeType> >& getMapEntityGUIDToSwitch() { return m_map_entity_guid_to_switch; }
@@ -91,57 +105,199 @@ public:
 		m_map_entity_guid_to_switch.clear();
 		m_map_representation_id_to_switch.clear();
 
+		m_cache_vertices.clear();
+		m_cache_normals.clear();
+		m_cache_draw_elements.clear();
+
 		m_numConvertedProducts = 0;
 		m_numProductsInModel = 0;
+		m_numBuffersReused = 0;
 	}
 
-	void findExistingVertexArray(const osg::ref_ptr<osg::Vec3Array>& vertices, osg::ref_ptr<osg::Vec3Array>& existingArray)
+	static void hashCombine(size_t& seed, size_t value)
 	{
-		for (const osg::ref_ptr<osg::Vec3Array>& existingVertices : m_cache_vertices)
+		seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+
+	/** \brief Hash of one coordinate, rounded to m_cache_hash_grid. If the coordinate is within m_epsilon of a cell border, hashNeighbour is the hash of the cell on the other side, otherwise equal to hash.
+	* Values that are not finite or out of the range of int64_t are not rounded, because the cast would be undefined */
+	void hashCoordinate(float value, size_t& hash, size_t& hashNeighbour) const
+	{
+		const double scaled = double(value) / m_cache_hash_grid;
+		const double cell = std::floor(scaled);
+		if (!std::isfinite(cell) || std::abs(cell) > 9.0e18)
 		{
-			if (existingVertices->size() == vertices->size())
+			hash = std::hash<float>{}(value);
+			hashNeighbour = hash;
+			return;
+		}
+		hash = std::hash<int64_t>{}((int64_t)cell);
+		hashNeighbour = hash;
+
+		// twice m_epsilon, so that rounding of the division does not matter
+		const double border = 2.0 * m_epsilon / m_cache_hash_grid;
+		if (scaled - cell <= border)
+		{
+			hashNeighbour = std::hash<int64_t>{}((int64_t)cell - 1);
+		}
+		else if (cell + 1.0 - scaled <= border)
+		{
+			hashNeighbour = std::hash<int64_t>{}((int64_t)cell + 1);
+		}
+	}
+
+	/** \brief Term of one coordinate in the hash of an array: the hash of its cell, mixed with its position in the array (splitmix64 finalizer) */
+	static size_t hashCoordinateTerm(size_t coordinateIndex, size_t hash)
+	{
+		uint64_t x = uint64_t(hash) + 0x9e3779b97f4a7c15ull * (uint64_t(coordinateIndex) + 1);
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+		return size_t(x ^ (x >> 31));
+	}
+
+	/** \brief Hashes of the array size and the coordinates, rounded to m_cache_hash_grid. hashes[0] uses the cell of each coordinate, it is the key of the array in the cache.
+	* Two arrays that are equal within m_epsilon can still have coordinates on different sides of a cell border. Both coordinates are then within m_epsilon of the border,
+	* so for each coordinate near a border, hashes are added with the neighbouring cell, in all combinations. Arrays with more than max_border_coordinates such coordinates
+	* only get hashes[0], so near-equal arrays may not be shared.
+	* The hash is the sum of one term per coordinate. A combination only replaces the terms of the border coordinates, so it costs O(max_border_coordinates), not O(size) */
+	void hashVec3Array(const osg::Vec3Array* vertices, std::vector<size_t>& hashes) const
+	{
+		const size_t max_border_coordinates = 8;
+
+		// for each coordinate near a border: term with the neighbouring cell minus term with the own cell
+		size_t borderDeltas[max_border_coordinates];
+		size_t numBorderCoordinates = 0;
+		size_t seed = std::hash<size_t>{}(vertices->size());
+		size_t coordinateIndex = 0;
+		for (const osg::Vec3f& point : *vertices)
+		{
+			for (int ii = 0; ii < 3; ++ii, ++coordinateIndex)
 			{
-				bool matchingArrayFound = true;
-				auto itNewPoint = vertices->begin();
-				for (auto itExistingPoint = existingVertices->begin(); itExistingPoint != existingVertices->end(); ++itExistingPoint, ++itNewPoint)
+				size_t hash, hashNeighbour;
+				hashCoordinate(point[ii], hash, hashNeighbour);
+				const size_t term = hashCoordinateTerm(coordinateIndex, hash);
+				seed += term;
+				if (hashNeighbour != hash)
 				{
-					float dx = itNewPoint->x() - itExistingPoint->x();
-					if (fabs(dx) > m_epsilon)
+					if (numBorderCoordinates < max_border_coordinates)
 					{
-						matchingArrayFound = false;
-						break;
+						borderDeltas[numBorderCoordinates] = hashCoordinateTerm(coordinateIndex, hashNeighbour) - term;
 					}
+					++numBorderCoordinates;
+				}
+			}
+		}
 
-					float dy = itNewPoint->y() - itExistingPoint->y();
-					if (fabs(dy) > m_epsilon)
-					{
-						matchingArrayFound = false;
-						break;
-					}
+		hashes.clear();
+		hashes.push_back(seed);
+		if (numBorderCoordinates == 0 || numBorderCoordinates > max_border_coordinates)
+		{
+			return;
+		}
 
-					float dz = itNewPoint->z() - itExistingPoint->z();
-					if (fabs(dz) > m_epsilon)
-					{
-						matchingArrayFound = false;
-						break;
-					}
+		// bit ii of mask selects the neighbouring cell for border coordinate ii
+		const size_t numCombinations = size_t(1) << numBorderCoordinates;
+		for (size_t mask = 1; mask < numCombinations; ++mask)
+		{
+			size_t hash = seed;
+			for (size_t ii = 0; ii < numBorderCoordinates; ++ii)
+			{
+				if (mask & (size_t(1) << ii))
+				{
+					hash += borderDeltas[ii];
 				}
+			}
+			hashes.push_back(hash);
+		}
+	}
 
-				if (matchingArrayFound)
+	/** \brief Equal within m_epsilon. Arrays with NaN coordinates are never equal */
+	bool isEqualVec3Array(const osg::Vec3Array* lhs, const osg::Vec3Array* rhs) const
+	{
+		if (lhs->size() != rhs->size())
+		{
+			return false;
+		}
+		auto itRhs = rhs->begin();
+		for (auto itLhs = lhs->begin(); itLhs != lhs->end(); ++itLhs, ++itRhs)
+		{
+			if (!(fabs(itLhs->x() - itRhs->x()) <= m_epsilon && fabs(itLhs->y() - itRhs->y()) <= m_epsilon && fabs(itLhs->z() - itRhs->z()) <= m_epsilon))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void findExistingVec3Array(std::unordered_multimap<size_t, osg::ref_ptr<osg::Vec3Array> >& cache, const osg::ref_ptr<osg::Vec3Array>& vertices, osg::ref_ptr<osg::Vec3Array>& existingArray)
+	{
+		std::vector<size_t> hashes;
+		hashVec3Array(vertices.get(), hashes);
+		for (size_t hash : hashes)
+		{
+			auto range = cache.equal_range(hash);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				if (isEqualVec3Array(it->second.get(), vertices.get()))
 				{
 					++m_numBuffersReused;
-					existingArray = existingVertices;
+					existingArray = it->second;
 					return;
 				}
 			}
 		}
 
 		if (m_caching_enabled) {
-			m_cache_vertices.push_back(vertices);
+			cache.insert(std::make_pair(hashes[0], vertices));
 		}
 		existingArray = vertices;
 	}
 
+	void findExistingVertexArray(const osg::ref_ptr<osg::Vec3Array>& vertices, osg::ref_ptr<osg::Vec3Array>& existingArray)
+	{
+		findExistingVec3Array(m_cache_vertices, vertices, existingArray);
+	}
+
+	void findExistingNormalArray(const osg::ref_ptr<osg::Vec3Array>& normals, osg::ref_ptr<osg::Vec3Array>& existingArray)
+	{
+		findExistingVec3Array(m_cache_normals, normals, existingArray);
+	}
+
+	/** \brief Index arrays are compared exactly, including the primitive mode and the index type */
+	void findExistingDrawElements(const osg::ref_ptr<osg::DrawElements>& drawElements, osg::ref_ptr<osg::DrawElements>& existingElements)
+	{
+		const unsigned char* data = static_cast<const unsigned char*>(drawElements->getDataPointer());
+		const unsigned int dataSize = drawElements->getTotalDataSize();
+		size_t hash = dataSize;
+		hashCombine(hash, drawElements->getType());
+		hashCombine(hash, drawElements->getMode());
+		if (data && dataSize > 0)
+		{
+			hashCombine(hash, std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(data), dataSize)));
+		}
+
+		auto range = m_cache_draw_elements.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			const osg::DrawElements* existing = it->second.get();
+			if (existing->getType() != drawElements->getType() || existing->getMode() != drawElements->getMode() || existing->getTotalDataSize() != dataSize)
+			{
+				continue;
+			}
+			if (dataSize == 0 || memcmp(existing->getDataPointer(), data, dataSize) == 0)
+			{
+				++m_numBuffersReused;
+				existingElements = it->second;
+				return;
+			}
+		}
+
+		if (m_caching_enabled) {
+			m_cache_draw_elements.insert(std::make_pair(hash, drawElements));
+		}
+		existingElements = drawElements;
+	}
+
 	static void drawBoundingBox(const carve::geom::aabb<3>& aabb, osg::ref_ptr<osg::Geometry>& geom)
 	{
 		osg::ref_ptr<osg::Vec3Array> vertices = dynamic_cast<osg::Vec3Array*>(geom->getVertexArray());
@@ -268,17 +424,9 @@ public:
 		normals->resize(num_vertices, poly_normal);
 
 		osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry();
-
-		if (m_caching_enabled) {
-			osg::ref_ptr<osg::Vec3Array> cachedVertexArray;
-			findExistingVertexArray(vertices, cachedVertexArray);
-			geometry->setVertexArray(cachedVertexArray);
-		}
-		else {
-			geometry->setVertexArray(vertices);
-		}
-		geometry->setNormalArray(normals);
+		geometry->setVertexArray(vertices);
 		normals->setBinding(osg::Array::BIND_PER_VERTEX);
+		geometry->setNormalArray(normals);
 		geometry->addPrimitiveSet(new osg::DrawArrays(osg::PrimitiveSet::POLYGON, 0, vertices->size()));
 
 		if (add_color_array)
@@ -298,6 +446,21 @@ public:
 			//tesselator->setWindingType( osgUtil::Tessellator::TESS_WINDING_ODD );
 			tesselator->retessellatePolygons(*geometry);
 		}
+
+		// the tessellator appends vertices and normals where polygon edges intersect, so the arrays are shared only after tessellation
+		if (m_caching_enabled) {
+			osg::ref_ptr<osg::Vec3Array> tessellatedVertices = dynamic_cast<osg::Vec3Array*>(geometry->getVertexArray());
+			osg::ref_ptr<osg::Vec3Array> tessellatedNormals = dynamic_cast<osg::Vec3Array*>(geometry->getNormalArray());
+			if (tessellatedVertices && tessellatedNormals) {
+				osg::ref_ptr<osg::Vec3Array> cachedVertexArray;
+				findExistingVertexArray(tessellatedVertices, cachedVertexArray);
+				geometry->setVertexArray(cachedVertexArray);
+
+				osg::ref_ptr<osg::Vec3Array> cachedNormalArray;
+				findExistingNormalArray(tessellatedNormals, cachedNormalArray);
+				geometry->setNormalArray(cachedNormalArray);
+			}
+		}
 		geode->addDrawable(geometry);
 
 
@@ -525,6 +688,18 @@ public:
 			mat_in.m[3][0], mat_in.m[3][1], mat_in.m[3][2], mat_in.m[3][3]);
 	}
 
+	void addDrawElements(osg::ref_ptr<osg::Geometry>& geom, const osg::ref_ptr<osg::DrawElements>& drawElements)
+	{
+		if (m_caching_enabled) {
+			osg::ref_ptr<osg::DrawElements> cachedDrawElements;
+			findExistingDrawElements(drawElements, cachedDrawElements);
+			geom->addPrimitiveSet(cachedDrawElements);
+		}
+		else {
+			geom->addPrimitiveSet(drawElements);
+		}
+	}
+
 	void convertMeshSets(std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vecMeshSets, osg::ref_ptr<osg::Geode>& geode, size_t ii_item, bool disableBackfaceCulling)
 	{
 		double min_triangle_area = m_geom_settings->getMinTriangleArea();
@@ -553,7 +728,14 @@ public:
 				for (const vec3& point : polyTriangulated.m_poly_data->points) {
 					vertices->push_back(osg::Vec3f(point.x, point.y, point.z));
 				}
-				geom->setVertexArray(vertices);
+				if (m_caching_enabled) {
+					osg::ref_ptr<osg::Vec3Array> cachedVertexArray;
+					findExistingVertexArray(vertices, cachedVertexArray);
+					geom->setVertexArray(cachedVertexArray);
+				}
+				else {
+					geom->setVertexArray(vertices);
+				}
 				geode->addChild(geom);
 
 				size_t numFaces = polyTriangulated.m_poly_data->faceIndices.size() / 4;
@@ -582,7 +764,7 @@ public:
 						idx = *it;
 						drawElementsUByte->push_back(static_cast<GLubyte>(idx));
 					}
-					geom->addPrimitiveSet(drawElementsUByte);
+					addDrawElements(geom, drawElementsUByte);
 
 				}
 				else if (numIndices < USHRT_MAX) {
@@ -609,7 +791,7 @@ public:
 					}
 
 					
-					geom->addPrimitiveSet(drawElementsUShort);
+					addDrawElements(geom, drawElementsUShort);
 
 					const osg::BoundingBox& bbox = geom->getBoundingBox();
 					auto bboxMesh = item_meshset->getAABB();
@@ -645,7 +827,7 @@ public:
 						drawElementsUInt->push_back(static_cast<GLuint>(idx));
 					}
 
-					geom->addPrimitiveSet(drawElementsUInt);
+					addDrawElements(geom, drawElementsUInt);
 
 				}
 				else {
@@ -1079,7 +1261,7 @@ public:
 			parent_group->addChild(sw_objects_outside_spatial_structure);
 		}
 
-		std::cout << "num buffers: " << m_cache_vertices.size() << ", reused: " << m_numBuffersReused << std::endl;
+		std::cout << "num buffers: " << m_cache_vertices.size() + m_cache_normals.size() + m_cache_draw_elements.size() << ", reused: " << m_numBuffersReused << std::endl;
 
 		if (errorStream.tellp() > 0)
 		{
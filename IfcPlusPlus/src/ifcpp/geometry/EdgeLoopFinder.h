@@ -55,6 +55,15 @@ public:
 		}
 	}
 
+	// vertices are moved directly, so cached information about the meshset has to be invalidated explicitly
+	void markMeshsetModified()
+	{
+		if (m_meshset)
+		{
+			m_meshset->touch();
+		}
+	}
+
 	void initFromMesh(const shared_ptr<carve::mesh::MeshSet<3> >& meshset, const carve::mesh::Mesh<3>* mesh, 
 		const GeomProcessingParams& params, bool tryMergeShortOpenEdges, bool& meshsetChanged)
 	{
@@ -124,6 +133,7 @@ public:
 						{
 							v->v = bbox.pos;
 						}
+						markMeshsetModified();
 						m_openEdgesMergedToPoint = true;
 						meshsetChanged = true;
 					}
@@ -286,6 +296,7 @@ public:
 
 						// for now, simple solution:
 						openEdge->v1()->v = openEdge->v2()->v;
+						markMeshsetModified();
 						changesDone = true;
 					}
 				}
@@ -440,6 +451,7 @@ public:
 						carve::mesh::Vertex<3>* v1 = pair->first;
 						carve::mesh::Vertex<3>* v2 = pair->second;
 						v1->v = v2->v;
+						markMeshsetModified();
 						changesDone = true;
 					}
 
@@ -550,6 +562,12 @@ public:
 			}
 		}
 
+		if (changesDone)
+		{
+			// edges are re-connected without cacheEdges
+			markMeshsetModified();
+		}
+
 		if (m_meshsetCopyUnChanged)
 		{
 			MeshSetInfo infoChangedMesh;
@@ -611,6 +629,7 @@ public:
 					createBackup();
 					vertex1->v = middlePoint;
 					vertex2->v = middlePoint;
+					markMeshsetModified();
 					++numPointsMoved;
 				}
 			}
@@ -17,6 +17,8 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <exception>
+#include <numeric>
 #include <ifcpp/geometry/GeometrySettings.h>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
@@ -360,120 +362,189 @@ public:
 			printToDebugLog(__FUNC__, "num faces: " + std::to_string(vec_faces.size()) + tagString);
 		}
 		
-		for( size_t ii = 0; ii < vec_faces.size(); ++ii )
+		if( vec_faces.size() >= m_geom_settings->getMinNumFacesParallelTriangulation() )
 		{
-			const shared_ptr<IfcFace>& ifc_face = vec_faces[ii];
-			if( !ifc_face )
+			convertIfcFacesParallel( vec_faces, poly_cache, params );
+		}
+		else
+		{
+			for( size_t ii = 0; ii < vec_faces.size(); ++ii )
 			{
-				continue;
+				convertIfcFace( vec_faces[ii], poly_cache, params );
 			}
+		}
+
+		// IfcFaceList can be a closed or open shell
+		if( st == SHELL_TYPE_UNKONWN )
+		{
+			item_data->addOpenOrClosedPolyhedron( poly_cache.m_poly_data, params );
+		}
+		else if( st == OPEN_SHELL )
+		{
+			item_data->addOpenPolyhedron( poly_cache.m_poly_data, params );
+		}
+		else if( st == CLOSED_SHELL )
+		{
+			item_data->addClosedPolyhedron(poly_cache.m_poly_data, params);
+		}
+	}
 
-			const std::vector<shared_ptr<IfcFaceBound> >& vec_bounds = ifc_face->m_Bounds;
-			std::vector<std::vector<vec3> > face_loops;
-			params.ifc_entity = ifc_face.get();
+	void convertIfcFace( const shared_ptr<IfcFace>& ifc_face, PolyInputCache3D& poly_cache, GeomProcessingParams& params )
+	{
+		if( !ifc_face )
+		{
+			return;
+		}
+
+		const std::vector<shared_ptr<IfcFaceBound> >& vec_bounds = ifc_face->m_Bounds;
+		std::vector<std::vector<vec3> > face_loops;
+		params.ifc_entity = ifc_face.get();
+
+		for( auto it_bounds = vec_bounds.begin(); it_bounds != vec_bounds.end(); ++it_bounds )
+		{
+			const shared_ptr<IfcFaceBound>& face_bound = ( *it_bounds );
 
-			for( auto it_bounds = vec_bounds.begin(); it_bounds != vec_bounds.end(); ++it_bounds )
+			if( !face_bound )
 			{
-				const shared_ptr<IfcFaceBound>& face_bound = ( *it_bounds );
+				continue;
+			}
 
-				if( !face_bound )
+			// ENTITY IfcLoop SUPERTYPE OF(ONEOF(IfcEdgeLoop, IfcPolyLoop, IfcVertexLoop))
+			const shared_ptr<IfcLoop>& loop = face_bound->m_Bound;
+			if( !loop )
+			{
+				if( it_bounds == vec_bounds.begin() )
 				{
-					continue;
+					break;
 				}
-
-				// ENTITY IfcLoop SUPERTYPE OF(ONEOF(IfcEdgeLoop, IfcPolyLoop, IfcVertexLoop))
-				const shared_ptr<IfcLoop>& loop = face_bound->m_Bound;
-				if( !loop )
+				else
 				{
-					if( it_bounds == vec_bounds.begin() )
-					{
-						break;
-					}
-					else
-					{
-						continue;
-					}
+					continue;
 				}
+			}
 
-				face_loops.push_back( std::vector<vec3>() );
-				std::vector<vec3>& loop_points = face_loops.back();
+			face_loops.push_back( std::vector<vec3>() );
+			std::vector<vec3>& loop_points = face_loops.back();
 
-				m_curve_converter->convertIfcLoop( loop, loop_points );
+			m_curve_converter->convertIfcLoop( loop, loop_points );
 
-				if( loop_points.size() < 3 )
-				{
-					if( it_bounds == vec_bounds.begin() )
-					{
-						break;
-					}
-					else
-					{
-						continue;
-					}
-				}
-
-				bool orientation = true;
-				if( face_bound->m_Orientation )
+			if( loop_points.size() < 3 )
+			{
+				if( it_bounds == vec_bounds.begin() )
 				{
-					orientation = face_bound->m_Orientation->m_value;
+					break;
 				}
-				if( !orientation )
+				else
 				{
-					std::reverse( loop_points.begin(), loop_points.end() );
+					continue;
 				}
 			}
 
+			bool orientation = true;
+			if( face_bound->m_Orientation )
+			{
+				orientation = face_bound->m_Orientation->m_value;
+			}
+			if( !orientation )
+			{
+				std::reverse( loop_points.begin(), loop_points.end() );
+			}
+		}
+
+		for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
+		{
+			std::vector<vec3>& loop = face_loops[iiLoop];
+			GeomUtils::unClosePolygon(loop, params.epsMergePoints);
+		}
+		
+		createTriangulated3DFace( face_loops, poly_cache, params, false );
+
+#ifdef _DEBUG
+		if( ifc_face->m_tag == 279929)
+		{
+			params.debugDump = true;
+		}
+
+		shared_ptr<IfcAdvancedFace> advancedFace = dynamic_pointer_cast<IfcAdvancedFace>( ifc_face );
+
+		if( params.debugDump )//|| advancedFace )
+		{
+			vec4 color(0.5, 0.6, 0.7, 1.0);
 			for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
 			{
 				std::vector<vec3>& loop = face_loops[iiLoop];
-				GeomUtils::unClosePolygon(loop, params.epsMergePoints);
+				GeomDebugDump::dumpPolyline(loop, color, 0, false, false);
 			}
-			
-			createTriangulated3DFace( face_loops, poly_cache, params, false );
 
-#ifdef _DEBUG
-			if( ifc_face->m_tag == 279929)
+			//if( ii == 34 )
 			{
-				params.debugDump = true;
+				//PolyInputCache3D poly_cache_dump(eps);
+				//createTriangulated3DFace(face_loops, poly_cache_dump, params);
+				//std::map<std::string, std::string> mesh_input_options;
+				//shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_cache_dump.m_poly_data->createMesh(mesh_input_options, eps));
+				//bool drawNormals = false;
+				//GeomDebugDump::dumpMeshset(meshset, color, drawNormals, false, false);
 			}
+			GeomDebugDump::moveOffset(0.0001);
+		}
+#endif
+	}
 
-			shared_ptr<IfcAdvancedFace> advancedFace = dynamic_pointer_cast<IfcAdvancedFace>( ifc_face );
+	///\brief method convertIfcFacesParallel: Triangulates faces in parallel. Each chunk of faces is triangulated into its own cache in deferred merge mode,
+	/// then the caches are appended in the original face order, so the resulting mesh is identical to the sequential conversion
+	void convertIfcFacesParallel( const std::vector<shared_ptr<IfcFace> >& vec_faces, PolyInputCache3D& poly_cache, const GeomProcessingParams& params )
+	{
+		const size_t numFaces = vec_faces.size();
+		const size_t chunkSize = 1024;
+		const size_t numChunks = ( numFaces + chunkSize - 1 ) / chunkSize;
 
-			if( params.debugDump )//|| advancedFace )
-			{
-				vec4 color(0.5, 0.6, 0.7, 1.0);
-				for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
-				{
-					std::vector<vec3>& loop = face_loops[iiLoop];
-					GeomDebugDump::dumpPolyline(loop, color, 0, false, false);
-				}
+		std::vector<PolyInputCache3D> chunkCaches;
+		chunkCaches.reserve( numChunks );
+		for( size_t ii = 0; ii < numChunks; ++ii )
+		{
+			chunkCaches.emplace_back( poly_cache.epsilon );
+			chunkCaches.back().m_deferMerge = true;
+		}
+
+		std::vector<size_t> chunkIndexes( numChunks );
+		std::iota( chunkIndexes.begin(), chunkIndexes.end(), 0 );
+		std::vector<std::exception_ptr> chunkExceptions( numChunks );
 
-				//if( ii == 34 )
+		// if messages of the calling thread are buffered, the chunks buffer their messages too, and they are appended in face order
+		std::vector<shared_ptr<StatusCallback::Message> >* messageBuffer = StatusCallback::ScopedMessageBuffer::getCurrent();
+		std::vector<std::vector<shared_ptr<StatusCallback::Message> > > chunkMessages( messageBuffer ? numChunks : 0 );
+
+		Executor::get( m_geom_settings->getExecutor() ).forEach( chunkIndexes.begin(), chunkIndexes.end(), [&]( size_t chunkIndex ) {
+			StatusCallback::ScopedMessageBuffer scopedMessages( messageBuffer ? &chunkMessages[chunkIndex] : nullptr );
+			GeomProcessingParams paramsChunk( params );
+			PolyInputCache3D& chunkCache = chunkCaches[chunkIndex];
+			const size_t faceEnd = std::min( numFaces, ( chunkIndex + 1 )*chunkSize );
+			try
+			{
+				for( size_t ii = chunkIndex*chunkSize; ii < faceEnd; ++ii )
 				{
-					//PolyInputCache3D poly_cache_dump(eps);
-					//createTriangulated3DFace(face_loops, poly_cache_dump, params);
-					//std::map<std::string, std::string> mesh_input_options;
-					//shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_cache_dump.m_poly_data->createMesh(mesh_input_options, eps));
-					//bool drawNormals = false;
-					//GeomDebugDump::dumpMeshset(meshset, color, drawNormals, false, false);
+					convertIfcFace( vec_faces[ii], chunkCache, paramsChunk );
 				}
-				GeomDebugDump::moveOffset(0.0001);
 			}
-#endif
-		}
+			catch( ... )
+			{
+				// exceptions must not leave a parallel algorithm
+				chunkExceptions[chunkIndex] = std::current_exception();
+			}
+		}, 1 );
 
-		// IfcFaceList can be a closed or open shell
-		if( st == SHELL_TYPE_UNKONWN )
-		{
-			item_data->addOpenOrClosedPolyhedron( poly_cache.m_poly_data, params );
-		}
-		else if( st == OPEN_SHELL )
+		for( size_t ii = 0; ii < chunkMessages.size(); ++ii )
 		{
-			item_data->addOpenPolyhedron( poly_cache.m_poly_data, params );
+			messageBuffer->insert( messageBuffer->end(), chunkMessages[ii].begin(), chunkMessages[ii].end() );
 		}
-		else if( st == CLOSED_SHELL )
+
+		for( size_t ii = 0; ii < numChunks; ++ii )
 		{
-			item_data->addClosedPolyhedron(poly_cache.m_poly_data, params);
+			if( chunkExceptions[ii] )
+			{
+				std::rethrow_exception( chunkExceptions[ii] );
+			}
+			poly_cache.appendDeferred( chunkCaches[ii] );
 		}
 	}
 
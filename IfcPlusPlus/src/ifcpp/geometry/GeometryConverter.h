@@ -17,14 +17,18 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
-// #define _DEBUG_LOOP_SEQENTIAL  // define for debugging geometry conversion
+// for debugging geometry conversion in one thread: getGeomSettings()->setExecutor( make_shared<SerialExecutor>() )
 
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <numeric>
 #include <thread>
 #include <unordered_set>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/BuildingModel.h>
 #include <ifcpp/model/StatusCallback.h>
+#include <ifcpp/model/Trace.h>
 #include <ifcpp/reader/ReaderUtil.h>
 #include <ifcpp/IFC4X3/include/IfcBuilding.h>
 #include <ifcpp/IFC4X3/include/IfcConnectionGeometry.h>
@@ -54,8 +58,23 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "GeometryInputData.h"
 #include "RepresentationConverter.h"
 #include "CSG_Adapter.h"
+#include "GeometryStatistics.h"
+#include "ConversionBudget.h"
+#include "MeshOps.h"
 #include "MeshSimplifier.h"
 
+/** \brief Approximate memory of the converted geometry and the converter caches, see GeometryConverter::memoryReport */
+struct GeometryMemoryReport
+{
+	size_t m_meshset_bytes = 0;			// carve meshsets of all items, closed and open
+	size_t m_polyline_bytes = 0;		// polylines, vertex points and text literals of all items
+	size_t m_product_shape_bytes = 0;	// ProductShapeData and ItemShapeData trees, with their transforms and style references
+	size_t m_profile_cache_bytes = 0;	// profiles in ProfileCache
+	size_t m_style_cache_bytes = 0;		// styles in StylesConverter
+
+	size_t getTotalBytes() const { return m_meshset_bytes + m_polyline_bytes + m_product_shape_bytes + m_profile_cache_bytes + m_style_cache_bytes; }
+};
+
 class GeometryConverter : public StatusCallback
 {
 protected:
@@ -69,6 +88,8 @@ protected:
 	vec3 m_siteOffset;
 	double m_recent_progress = 0;
 	bool m_convertDirectlyToBuffer = true;
+	bool m_collect_statistics = false;
+	GeometryStatistics m_statistics;
 	std::unordered_map<int, std::vector<shared_ptr<StatusCallback::Message> > > m_messages;
 
 	std::mutex m_writelock_messages;
@@ -83,6 +104,26 @@ public:
 	void setGeomSettings(shared_ptr<GeometrySettings>& settings) { m_geom_settings = settings; }
 	std::unordered_map<std::string, shared_ptr<ProductShapeData> >& getShapeInputData() { return m_product_shape_data; }
 	std::unordered_map<std::string, shared_ptr<BuildingObject> >& getObjectsOutsideSpatialStructure() { return m_map_outside_spatial_structure; }
+
+	/** \brief If true, convertGeometry collects time, CSG operations and triangle counts per product in getStatistics(). Default is false */
+	void setCollectStatistics(bool collect) { m_collect_statistics = collect; }
+	bool isCollectingStatistics() const { return m_collect_statistics; }
+	GeometryStatistics& getStatistics() { return m_statistics; }
+
+	/** \brief Approximate memory of the product shapes in getShapeInputData() and of the profile and style caches. Meshsets that are shared by several items are counted once.
+	Sizes are computed from the number of vertices, faces, points etc, the heap is not walked. Call it between products or after convertGeometry, not concurrently with it */
+	GeometryMemoryReport memoryReport()
+	{
+		GeometryMemoryReport report;
+		std::unordered_set<const void*> setVisited;
+		for (auto& it : m_product_shape_data)
+		{
+			addMemoryUsage(it.second, report, setVisited);
+		}
+		report.m_profile_cache_bytes = m_representation_converter->getProfileCache()->getMemoryUsage();
+		report.m_style_cache_bytes = m_representation_converter->getStylesConverter()->getMemoryUsage();
+		return report;
+	}
 	bool m_clear_memory_immedeately = true;
 	bool m_set_model_to_origin = false;
 
@@ -135,14 +176,13 @@ public:
 
 	void clearIfcRepresentationsInModel(bool resetRepresentationInProducts, bool clearStyles, bool clearIfcElements )
 	{
-		std::unordered_map<int, shared_ptr<BuildingEntity> >& map_entities = m_ifc_model->getMapIfcEntities();
+		BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = m_ifc_model->getMapIfcEntities();
 		for (auto it = map_entities.begin(); it != map_entities.end(); )
 		{
 			shared_ptr<BuildingEntity>& entity = it->second;
 			if(entity)
 			{
-				shared_ptr<IfcElement> ele = dynamic_pointer_cast<IfcElement>(entity);
-				if (ele)
+				if (entity->isA<IfcElement>())
 				{
 					if (clearIfcElements)
 					{
@@ -158,9 +198,9 @@ public:
 
 				if (resetRepresentationInProducts)
 				{
-					shared_ptr<IfcProduct> product = dynamic_pointer_cast<IfcProduct>(entity);
-					if (product)
+					if (entity->isA<IfcProduct>())
 					{
+						IfcProduct* product = static_cast<IfcProduct*>(entity.get());
 						product->m_Representation.reset();
 						product->m_ObjectPlacement.reset();
 						++it;
@@ -168,25 +208,25 @@ public:
 					}
 				}
 
-				shared_ptr<IfcObjectPlacement> plc = dynamic_pointer_cast<IfcObjectPlacement>(entity);
-				if (plc)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcProductRepresentation> rep = dynamic_pointer_cast<IfcProductRepresentation>(entity);
-				if (rep)
+				if (entity->isA<IfcObjectPlacement>()
+					|| entity->isA<IfcProductRepresentation>()
+					|| entity->isA<IfcProfileDef>()
+					|| entity->isA<IfcPresentationStyle>()
+					|| entity->isA<IfcColourSpecification>()
+					|| entity->isA<IfcMaterialUsageDefinition>()
+					|| entity->isA<IfcShapeRepresentation>()
+					|| entity->isA<IfcRelSpaceBoundary>()
+					|| entity->isA<IfcRepresentationMap>()
+					|| entity->isA<IfcConnectionGeometry>()
+					|| entity->isA<IfcGeometricRepresentationContext>())
 				{
 					it = map_entities.erase(it);
 					continue;
 				}
 				
-				shared_ptr<IfcRepresentationItem> representationItem = dynamic_pointer_cast<IfcRepresentationItem>(entity);
-				if (representationItem)
+				if (entity->isA<IfcRepresentationItem>())
 				{
-					shared_ptr<IfcStyledItem> style = dynamic_pointer_cast<IfcStyledItem>(entity);
-					if (style)
+					if (entity->isA<IfcStyledItem>())
 					{
 						if (!clearStyles)
 						{
@@ -219,69 +259,6 @@ public:
 #endif
 					continue;
 				}
-
-				shared_ptr<IfcProfileDef> prof = dynamic_pointer_cast<IfcProfileDef>(entity);
-				if (prof)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcPresentationStyle> style = dynamic_pointer_cast<IfcPresentationStyle>(entity);
-				if (style)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcColourSpecification> colour = dynamic_pointer_cast<IfcColourSpecification>(entity);
-				if (colour)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcMaterialUsageDefinition> materialUsage = dynamic_pointer_cast<IfcMaterialUsageDefinition>(entity);
-				if (materialUsage)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcShapeRepresentation> shapeRep = dynamic_pointer_cast<IfcShapeRepresentation>(entity);
-				if (shapeRep)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcRelSpaceBoundary> spaceBoundary = dynamic_pointer_cast<IfcRelSpaceBoundary>(entity);
-				if (spaceBoundary)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcRepresentationMap> map = dynamic_pointer_cast<IfcRepresentationMap>(entity);
-				if (map)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcConnectionGeometry> conn = dynamic_pointer_cast<IfcConnectionGeometry>(entity);
-				if (conn)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
-
-				shared_ptr<IfcGeometricRepresentationContext> context = dynamic_pointer_cast<IfcGeometricRepresentationContext>(entity);
-				if (context)
-				{
-					it = map_entities.erase(it);
-					continue;
-				}
 			}
 			++it;
 		}
@@ -322,7 +299,7 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcLocalPlacement> local_placement = dynamic_pointer_cast<IfcLocalPlacement>(ifc_site->m_ObjectPlacement);
+		shared_ptr<IfcLocalPlacement> local_placement = entity_cast<IfcLocalPlacement>(ifc_site->m_ObjectPlacement);
 		if (!local_placement)
 		{
 			return;
@@ -429,7 +406,7 @@ public:
 			}
 		}
 
-		shared_ptr<IfcSpatialElement> spatial_ele = dynamic_pointer_cast<IfcSpatialElement>(ifc_object_def);
+		shared_ptr<IfcSpatialElement> spatial_ele = entity_cast<IfcSpatialElement>(ifc_object_def);
 		if (spatial_ele)
 		{
 			for (const weak_ptr<IfcRelContainedInSpatialStructure>& rel_contained_weak_ptr : spatial_ele->m_ContainsElements_inverse)
@@ -482,7 +459,7 @@ public:
 		if (resolveSecondaryStructure)
 		{
 			// handle IfcRelAssigns
-			shared_ptr<IfcSpatialElement> ifcSpatial = dynamic_pointer_cast<IfcSpatialElement>(ifc_object_def);
+			shared_ptr<IfcSpatialElement> ifcSpatial = entity_cast<IfcSpatialElement>(ifc_object_def);
 			if (ifcSpatial)
 			{
 				//std::cout << "ifcSpatial: " << ifcSpatial->m_tag << std::endl;
@@ -555,7 +532,7 @@ public:
 			}
 
 			// handle IfcRelConnects
-			shared_ptr<IfcDistributionElement> distributionElement = dynamic_pointer_cast<IfcDistributionElement>(ifc_object_def);
+			shared_ptr<IfcDistributionElement> distributionElement = entity_cast<IfcDistributionElement>(ifc_object_def);
 			if (distributionElement)
 			{
 				// #971193= IFCFLOWSEGMENT('2zIAtK02XAfPD15y9EpuCl',#41,'name',$,'description',#971178,#971191,'6021202');  - in spatial structure
@@ -643,7 +620,7 @@ public:
 
 			if (ifc_object_definition->classID() == IFCBUILDING)
 			{
-				shared_ptr<IfcBuilding> ifc_building = dynamic_pointer_cast<IfcBuilding>(ifc_object_definition);
+				shared_ptr<IfcBuilding> ifc_building = entity_cast<IfcBuilding>(ifc_object_definition);
 				if (ifc_building)
 				{
 					vec_ifc_buildings.push_back(product_shape);
@@ -653,7 +630,7 @@ public:
 
 			if (ifc_object_definition->classID() == IFCSITE)
 			{
-				shared_ptr<IfcSite> site = dynamic_pointer_cast<IfcSite>(ifc_object_definition);
+				shared_ptr<IfcSite> site = entity_cast<IfcSite>(ifc_object_definition);
 				if (site)
 				{
 					vec_ifc_sites.push_back(site);
@@ -663,7 +640,7 @@ public:
 
 			if (ifc_object_definition->classID() == IFCPROJECT)
 			{
-				shared_ptr<IfcProject> project = dynamic_pointer_cast<IfcProject>(ifc_object_definition);
+				shared_ptr<IfcProject> project = entity_cast<IfcProject>(ifc_object_definition);
 				if (project)
 				{
 					ifc_project = project;
@@ -682,7 +659,7 @@ public:
 				{
 					continue;
 				}
-				shared_ptr<IfcBuilding> ifc_building = dynamic_pointer_cast<IfcBuilding>(ifc_object_definition);
+				shared_ptr<IfcBuilding> ifc_building = entity_cast<IfcBuilding>(ifc_object_definition);
 				if (ifc_building)
 				{
 					if (ifc_building->m_Decomposes_inverse.size() == 0)
@@ -738,6 +715,7 @@ public:
 		m_map_outside_spatial_structure.clear();
 		m_setResolvedProjectStructure.clear();
 		m_representation_converter->clearCache();
+		m_statistics.clear();
 		m_clear_memory_immedeately = false;
 
 		if (!m_ifc_model)
@@ -745,6 +723,12 @@ public:
 			return;
 		}
 
+		if (m_ifc_model->getNumDeferredEntities() > 0)
+		{
+			// lazily loaded model: parse everything except property sets and quantities
+			m_ifc_model->materialize([](const shared_ptr<BuildingEntity>& entity) { return !BuildingModel::isPropertyOrQuantity(entity); });
+		}
+
 		shared_ptr<ProductShapeData> ifcProjectData;
 		std::vector<shared_ptr<IfcObjectDefinition> > vecObjectDefinitions;
 		getAllObjectDefinitions(vecObjectDefinitions, ifcProjectData);
@@ -752,14 +736,57 @@ public:
 		// create geometry for for each IfcProduct independently, spatial structure will be resolved later
 		const int num_object_definitions = (int)vecObjectDefinitions.size();
 
-		std::mutex writelock_map, writelock_ifc_project, writelock_err;
-		int ii = 0;
-		FOR_EACH_LOOP vecObjectDefinitions.begin(), vecObjectDefinitions.end(), [&](shared_ptr<IfcObjectDefinition>& object_def) {
+		// each product writes only to its own slot, the slots are merged in model order after the loop, so that the result does not depend on the number of threads
+		struct ProductSlot
+		{
+			shared_ptr<ProductShapeData> product_shape;
+			std::vector<shared_ptr<StatusCallback::Message> > messages;
+		};
+		std::vector<ProductSlot> vecProductSlots(num_object_definitions);
+		std::vector<size_t> vecIndexes(num_object_definitions);
+		std::iota(vecIndexes.begin(), vecIndexes.end(), 0);
+
+		// with deterministic output, messages are collected per product and sent in model order
+		const bool deterministic = m_geom_settings->isDeterministicOutput();
+		auto sendBufferedMessages = [&]() {
+			for (ProductSlot& slot : vecProductSlots)
+			{
+				for (const shared_ptr<StatusCallback::Message>& m : slot.messages)
+				{
+					StatusCallback::messageCallback(m);
+				}
+				slot.messages.clear();
+			}
+		};
+
+		// time limits: the model budget skips products that are not started yet, the element budget stops CSG operations of the product that is converted
+		const ConversionBudget modelBudget(m_geom_settings->getCancellationToken(), ConversionBudget::deadlineAfter(m_geom_settings->getMaxConversionTime()));
+		const double maxElementTime = m_geom_settings->getMaxElementConversionTime();
+		std::atomic<size_t> numProductsSkipped(0);
+		std::atomic<size_t> numProductsIncomplete(0);
+		std::atomic<size_t> numProductsOpeningsSkipped(0);
+		auto getElementDeadline = [&]() {
+			return std::min(modelBudget.getDeadline(), ConversionBudget::deadlineAfter(maxElementTime));
+		};
+
+		// 80% of progress for products, leave 20% to openings, rendering, file export etc
+		ProgressAggregator progress(this, "geometry", vecIndexes.size(), 0.0, 0.8);
+		Executor::get( m_geom_settings->getExecutor() ).forEach( vecIndexes.begin(), vecIndexes.end(), [&](size_t index) {
 
 				if (m_ifc_model->isLoadingCancelled())
 				{
 					return;
 				}
+				progress.addDone();
+				if (modelBudget.isExceeded())
+				{
+					++numProductsSkipped;
+					return;
+				}
+				shared_ptr<IfcObjectDefinition>& object_def = vecObjectDefinitions[index];
+				ProductSlot& slot = vecProductSlots[index];
+				StatusCallback::ScopedMessageBuffer scopedMessages(deterministic ? &slot.messages : nullptr);
+				IFCPP_TRACE_SCOPE_ENTITY("convert product", object_def.get());
 
 				const int tag = object_def->m_tag;
 				std::string guid;
@@ -773,7 +800,7 @@ public:
 
 				// TODO: check for equal product shapes: each representation and each item must be equal, also openings must be equal: m_HasOpenings_inverse
 				uint32_t classID = object_def->classID();
-				std::stringstream thread_err;
+				std::string thread_err;
 #ifdef _DEBUG
 				std::string className = IFC4X3::EntityFactory::getStringForClassID(classID);
 #endif
@@ -783,11 +810,15 @@ public:
 					return;
 				}
 
-				if (classID == IFCPROJECT)
+				GeometryStatistics::ProductStatistics* statistics = nullptr;
+				if (m_collect_statistics)
 				{
-					std::lock_guard<std::mutex> lock(writelock_ifc_project);
-					ifcProjectData = product_geom_input_data;
+					statistics = m_statistics.addProduct(tag, classID, guid);
 				}
+				GeometryStatistics::ScopedProduct scopedStatistics(statistics);
+				std::chrono::steady_clock::time_point timeStart = std::chrono::steady_clock::now();
+				ConversionBudget elementBudget(modelBudget.getToken(), getElementDeadline());
+				ConversionBudget::ScopedElement scopedBudget(elementBudget.hasLimit() ? &elementBudget : nullptr);
 
 				try
 				{
@@ -795,62 +826,127 @@ public:
 				}
 				catch (BuildingException& e)
 				{
-					thread_err << e.what();
+					thread_err = e.what();
 				}
 				catch (carve::exception& e)
 				{
-					thread_err << e.str();
+					thread_err = e.str();
 				}
 				catch (std::exception& e)
 				{
-					thread_err << e.what();
+					thread_err = e.what();
 				}
 				catch (...)
 				{
-					thread_err << "undefined error, product id " << tag;
+					thread_err = "undefined error, product id " + std::to_string(tag);
 				}
 
+				if (statistics)
 				{
-					std::lock_guard<std::mutex> lock(writelock_map);
-					m_product_shape_data[guid] = product_geom_input_data;
+					statistics->timeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - timeStart).count();
 				}
 
-				if (thread_err.tellp() > 0)
+				slot.product_shape = product_geom_input_data;
+
+				if (!thread_err.empty())
 				{
-					messageCallback(thread_err.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+					messageCallback(thread_err, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
 				}
+				if (elementBudget.hasBeenExceeded())
+				{
+					++numProductsIncomplete;
+				}
+			}, 1 );
 
-				// progress callback
-				double progress = (double)ii / (double)num_object_definitions;
-				sendProgress(progress);
-				++ii;
-			});
+		// ordered merge: for duplicate GUIDs, the product that comes later in the model wins, as in a sequential loop
+		m_product_shape_data.reserve(vecProductSlots.size());
+		for (size_t index = 0; index < vecProductSlots.size(); ++index)
+		{
+			const shared_ptr<ProductShapeData>& product_shape = vecProductSlots[index].product_shape;
+			if (!product_shape)
+			{
+				continue;
+			}
+			m_product_shape_data[product_shape->m_entity_guid] = product_shape;
 
-		// subtract openings in assemblies etc, in case the opening is attached at the top level
-		ii = 0;
-		FOR_EACH_LOOP vecObjectDefinitions.begin(), vecObjectDefinitions.end(), [&](shared_ptr<IfcObjectDefinition>& object_def) {
-			std::string guid;
-			if (object_def->m_GlobalId)
+			if (!ifcProjectData && vecObjectDefinitions[index]->classID() == IFCPROJECT)
 			{
-				guid = object_def->m_GlobalId->m_value;
+				ifcProjectData = product_shape;
 			}
-			auto it_find = m_product_shape_data.find(guid);
-			if (it_find != m_product_shape_data.end())
+		}
+		sendBufferedMessages();
+
+		// subtract openings in assemblies etc, in case the opening is attached at the top level
+		// openings follow the products, from 80% to 90%
+		ProgressAggregator progressOpenings(this, "geometry", vecIndexes.size(), 0.8, 0.9);
+		Executor::get( m_geom_settings->getExecutor() ).forEach( vecIndexes.begin(), vecIndexes.end(), [&](size_t index) {
+			ProductSlot& slot = vecProductSlots[index];
+			if (slot.product_shape && modelBudget.isExceeded())
 			{
-				shared_ptr<ProductShapeData> product_geom_input_data = it_find->second;
-				subtractOpeningsInRelatedObjects(product_geom_input_data);
+				// the openings of this element are not subtracted from its aggregated parts
+				shared_ptr<IfcElement> ifc_element = entity_cast<IfcElement>(vecObjectDefinitions[index]);
+				if (ifc_element && ifc_element->m_HasOpenings_inverse.size() > 0 && ifc_element->m_IsDecomposedBy_inverse.size() > 0)
+				{
+					++numProductsOpeningsSkipped;
+				}
 			}
+			else if (slot.product_shape)
+			{
+				StatusCallback::ScopedMessageBuffer scopedMessages(deterministic ? &slot.messages : nullptr);
 
-			double progress = 0.8 + 0.1* (double)ii / (double)num_object_definitions;
-			sendProgress(progress);
-			++ii;
-		});
+				// time and CSG operations are added to the element that has the openings
+				GeometryStatistics::ProductStatistics* statistics = m_collect_statistics ? m_statistics.getProduct(vecObjectDefinitions[index]->m_tag) : nullptr;
+				GeometryStatistics::ScopedProduct scopedStatistics(statistics);
+				std::chrono::steady_clock::time_point timeStart = std::chrono::steady_clock::now();
+				ConversionBudget elementBudget(modelBudget.getToken(), getElementDeadline());
+				ConversionBudget::ScopedElement scopedBudget(elementBudget.hasLimit() ? &elementBudget : nullptr);
 
-		if (m_ifc_model->isLoadingCancelled())
+				subtractOpeningsInRelatedObjects(slot.product_shape);
+				if (elementBudget.hasBeenExceeded())
+				{
+					++numProductsIncomplete;
+				}
+
+				if (statistics)
+				{
+					statistics->timeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - timeStart).count();
+				}
+			}
+			progressOpenings.addDone();
+		}, 1 );
+		sendBufferedMessages();
+
+		const shared_ptr<CancellationToken>& cancellationToken = m_geom_settings->getCancellationToken();
+		if (m_ifc_model->isLoadingCancelled() || (cancellationToken && cancellationToken->isCanceled()))
 		{
 			m_product_shape_data.clear();
 			return;
 		}
+
+		if (numProductsSkipped > 0 || numProductsIncomplete > 0 || numProductsOpeningsSkipped > 0)
+		{
+			std::stringstream strs;
+			strs << "geometry conversion time limit reached: " << numProductsSkipped << " products skipped, " << numProductsIncomplete << " products incomplete, " << numProductsOpeningsSkipped << " products without subtracted openings";
+			messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__);
+		}
+
+		if (m_collect_statistics)
+		{
+			for (auto& it : m_product_shape_data)
+			{
+				shared_ptr<ProductShapeData>& product_shape = it.second;
+				if (!product_shape || product_shape->m_ifc_object_definition.expired())
+				{
+					continue;
+				}
+				shared_ptr<IfcObjectDefinition> ifc_object_def(product_shape->m_ifc_object_definition);
+				GeometryStatistics::ProductStatistics* statistics = m_statistics.getProduct(ifc_object_def->m_tag);
+				if (statistics)
+				{
+					statistics->numFacesOut = getNumFaces(product_shape);
+				}
+			}
+		}
 				
 		try
 		{
@@ -891,7 +987,7 @@ public:
 							guid = ifc_object_def->m_GlobalId->m_value;
 						}
 
-						shared_ptr<IfcTypeObject> typeObject = dynamic_pointer_cast<IfcTypeObject>(ifc_object_def);
+						shared_ptr<IfcTypeObject> typeObject = entity_cast<IfcTypeObject>(ifc_object_def);
 						if (typeObject)
 						{
 							continue;
@@ -930,7 +1026,7 @@ public:
 
 	void getAllObjectDefinitions(std::vector<shared_ptr<IfcObjectDefinition> >& vecObjectDefinitions, shared_ptr<ProductShapeData>& ifcProjectData)
 	{
-		std::unordered_map<int, shared_ptr<BuildingEntity> >& map_entities = m_ifc_model->getMapIfcEntities();
+		BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = m_ifc_model->getMapIfcEntities();
 		std::unordered_set<std::string> setGuids;
 		if (map_entities.size() > 0)
 		{
@@ -939,7 +1035,7 @@ public:
 				shared_ptr<BuildingEntity> entity = it->second;
 				if (entity)
 				{
-					shared_ptr<IfcRoot> root = dynamic_pointer_cast<IfcRoot>(entity);
+					shared_ptr<IfcRoot> root = entity_cast<IfcRoot>(entity);
 					if (root)
 					{
 						std::string guid;
@@ -950,19 +1046,16 @@ public:
 							auto it_find = setGuids.find(guid);
 							if (it_find != setGuids.end())
 							{
+								// take the first free suffix. Entities are visited in order of their STEP id, so a file always gets the same suffixes
 								std::string guid_duplicate = guid;
 								size_t guid_append = 1;
-								for (auto it = setGuids.begin(); it != setGuids.end(); ++it)
+								std::string guid_unique = guid + "_1";
+								while (setGuids.find(guid_unique) != setGuids.end())
 								{
-									std::string guid_unique = guid + "_" + std::to_string(guid_append);
-									auto it_find2 = setGuids.find(guid_unique);
-									if (it_find2 == setGuids.end())
-									{
-										guid = guid_unique;
-										break;
-									}
 									++guid_append;
+									guid_unique = guid + "_" + std::to_string(guid_append);
 								}
+								guid = guid_unique;
 
 								std::string error = "duplicate GUID in model: " + guid_duplicate;
 								messageCallback(error, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
@@ -973,7 +1066,7 @@ public:
 							setGuids.insert(it_find, guid);
 						}
 
-						shared_ptr<IfcObjectDefinition> object_def = dynamic_pointer_cast<IfcObjectDefinition>(root);
+						shared_ptr<IfcObjectDefinition> object_def = entity_cast<IfcObjectDefinition>(root);
 						if (object_def)
 						{
 							vecObjectDefinitions.push_back(object_def);
@@ -982,11 +1075,8 @@ public:
 							{
 								if (object_def->classID() == IFCSITE)
 								{
-									shared_ptr<IfcSite> ifc_site = dynamic_pointer_cast<IfcSite>(object_def);
-									if (ifc_site)
-									{
-										setIfcSiteToOrigin(ifc_site);
-									}
+									shared_ptr<IfcSite> ifc_site = std::static_pointer_cast<IfcSite>(object_def);
+									setIfcSiteToOrigin(ifc_site);
 								}
 							}
 						}
@@ -1006,8 +1096,7 @@ public:
 						continue;
 					}
 
-					shared_ptr<IfcPropertyAbstraction> prop = dynamic_pointer_cast<IfcPropertyAbstraction>(entity);
-					if (prop)
+					if (entity->isA<IfcPropertyAbstraction>())
 					{
 						// IfcPropertySingleValue etc are referenced in PropertySet, don't need them in mapEntities
 						it = map_entities.erase(it);
@@ -1015,23 +1104,19 @@ public:
 					}
 
 					//////////////  <TEMP>
-					shared_ptr<IfcIndexedColourMap> indexedColorMap = dynamic_pointer_cast<IfcIndexedColourMap>(entity);
-					if (indexedColorMap)
+					if (entity->isA<IfcIndexedColourMap>())
 					{
 						it = map_entities.erase(it);
 						continue;
 					}
 					//////////////  </TEMP>
 
-					shared_ptr<IfcRepresentationItem> reItem = dynamic_pointer_cast<IfcRepresentationItem>(entity);
-					if (reItem)
+					if (entity->isA<IfcRepresentationItem>())
 					{
 						// exclude IFCINDEXEDCOLOURMAP and IFCSTYLEDITEM, which are not referenced by anyone
-						shared_ptr<IfcIndexedColourMap> colorMap = dynamic_pointer_cast<IfcIndexedColourMap>(entity);
-						if (!colorMap)
+						if (!entity->isA<IfcIndexedColourMap>())
 						{
-							shared_ptr<IfcStyledItem> styledItem = dynamic_pointer_cast<IfcStyledItem>(entity);
-							if (!styledItem)
+							if (!entity->isA<IfcStyledItem>())
 							{
 								// IfcRelVoidsElement is not derived from IfcRepresentationItem
 								// shared_ptr<IfcRelVoidsElement> relVoids = dynamic_pointer_cast<IfcRelVoidsElement>(entity);
@@ -1058,7 +1143,7 @@ public:
 		}
 
 		shared_ptr<IfcObjectDefinition> ifc_object_def(product_shape->m_ifc_object_definition);
-		shared_ptr<IfcProduct> ifc_product = dynamic_pointer_cast<IfcProduct>(ifc_object_def);
+		shared_ptr<IfcProduct> ifc_product = entity_cast<IfcProduct>(ifc_object_def);
 		if (!ifc_product)
 		{
 			return;
@@ -1075,7 +1160,7 @@ public:
 		printToDebugLog(__FUNC__, "converting element " + std::to_string(productTag));
 
 		std::vector<weak_ptr<IfcRelVoidsElement> > vec_rel_voids;
-		shared_ptr<IfcElement> ifc_element = dynamic_pointer_cast<IfcElement>(ifc_product);
+		shared_ptr<IfcElement> ifc_element = entity_cast<IfcElement>(ifc_product);
 		if (ifc_element)
 		{
 			vec_rel_voids = ifc_element->m_HasOpenings_inverse;
@@ -1188,6 +1273,125 @@ public:
 		}
 	}
 
+	// shared_ptr control block of an object that was created with new, approximately
+	static constexpr size_t MEMORY_SHARED_OBJECT_OVERHEAD = 2 * sizeof(void*) + 2 * sizeof(long);
+
+	static void addMemoryUsage(const shared_ptr<ItemShapeData>& item, GeometryMemoryReport& report, std::unordered_set<const void*>& setVisited)
+	{
+		if (!item || !setVisited.insert(item.get()).second)
+		{
+			return;
+		}
+
+		report.m_product_shape_bytes += sizeof(ItemShapeData) + MEMORY_SHARED_OBJECT_OVERHEAD;
+		report.m_product_shape_bytes += item->m_styles.capacity() * sizeof(shared_ptr<StyleData>);
+		report.m_product_shape_bytes += item->m_child_items.capacity() * sizeof(shared_ptr<ItemShapeData>);
+		report.m_meshset_bytes += (item->m_meshsets.capacity() + item->m_meshsets_open.capacity()) * sizeof(shared_ptr<carve::mesh::MeshSet<3> >);
+		for (const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >* meshsets : { &item->m_meshsets, &item->m_meshsets_open })
+		{
+			for (const shared_ptr<carve::mesh::MeshSet<3> >& meshset : *meshsets)
+			{
+				if (meshset && setVisited.insert(meshset.get()).second)
+				{
+					report.m_meshset_bytes += MeshOps::getMemoryUsage(meshset.get()) + MEMORY_SHARED_OBJECT_OVERHEAD;
+				}
+			}
+		}
+
+		for (const shared_ptr<carve::input::PolylineSetData>& polyline : item->m_polylines)
+		{
+			if (polyline && setVisited.insert(polyline.get()).second)
+			{
+				report.m_polyline_bytes += sizeof(carve::input::PolylineSetData) + MEMORY_SHARED_OBJECT_OVERHEAD + polyline->points.capacity() * sizeof(carve::geom3d::Vector);
+				for (const carve::input::PolylineSetData::polyline_data_t& polyline_data : polyline->polylines)
+				{
+					// list node with two pointers
+					report.m_polyline_bytes += sizeof(carve::input::PolylineSetData::polyline_data_t) + 2 * sizeof(void*) + polyline_data.second.capacity() * sizeof(int);
+				}
+			}
+		}
+		for (const shared_ptr<carve::input::VertexData>& vertex_data : item->m_vertex_points)
+		{
+			if (vertex_data && setVisited.insert(vertex_data.get()).second)
+			{
+				report.m_polyline_bytes += sizeof(carve::input::VertexData) + MEMORY_SHARED_OBJECT_OVERHEAD + vertex_data->points.capacity() * sizeof(carve::geom3d::Vector);
+			}
+		}
+		for (const shared_ptr<TextItemData>& text_data : item->m_text_literals)
+		{
+			if (text_data)
+			{
+				report.m_polyline_bytes += sizeof(TextItemData) + MEMORY_SHARED_OBJECT_OVERHEAD + getHeapMemorySize(text_data->m_text);
+			}
+		}
+		report.m_polyline_bytes += item->m_polylines.capacity() * sizeof(shared_ptr<carve::input::PolylineSetData>);
+		report.m_polyline_bytes += item->m_vertex_points.capacity() * sizeof(shared_ptr<carve::input::VertexData>);
+		report.m_polyline_bytes += item->m_text_literals.capacity() * sizeof(shared_ptr<TextItemData>);
+
+		for (const shared_ptr<ItemShapeData>& child_item : item->m_child_items)
+		{
+			addMemoryUsage(child_item, report, setVisited);
+		}
+	}
+
+	static void addMemoryUsage(const shared_ptr<ProductShapeData>& product_shape, GeometryMemoryReport& report, std::unordered_set<const void*>& setVisited)
+	{
+		if (!product_shape || !setVisited.insert(product_shape.get()).second)
+		{
+			return;
+		}
+
+		report.m_product_shape_bytes += sizeof(ProductShapeData) + MEMORY_SHARED_OBJECT_OVERHEAD + getHeapMemorySize(product_shape->m_entity_guid);
+		report.m_product_shape_bytes += product_shape->getGeometricItems().capacity() * sizeof(shared_ptr<ItemShapeData>);
+		report.m_product_shape_bytes += product_shape->getChildElements().capacity() * sizeof(shared_ptr<ProductShapeData>);
+		report.m_product_shape_bytes += product_shape->getStyles().capacity() * sizeof(shared_ptr<StyleData>);
+		report.m_product_shape_bytes += product_shape->m_transforms.capacity() * sizeof(shared_ptr<TransformData>);
+		report.m_product_shape_bytes += product_shape->m_transforms.size() * (sizeof(TransformData) + MEMORY_SHARED_OBJECT_OVERHEAD);
+
+		for (const shared_ptr<ItemShapeData>& item : product_shape->getGeometricItems())
+		{
+			addMemoryUsage(item, report, setVisited);
+		}
+		for (const shared_ptr<ProductShapeData>& child_product : product_shape->getChildElements())
+		{
+			addMemoryUsage(child_product, report, setVisited);
+		}
+	}
+
+	static size_t getNumFaces(const shared_ptr<ItemShapeData>& item)
+	{
+		size_t numFaces = 0;
+		for (const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets)
+		{
+			if (meshset)
+			{
+				numFaces += MeshOps::getNumFaces(meshset.get());
+			}
+		}
+		for (const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets_open)
+		{
+			if (meshset)
+			{
+				numFaces += MeshOps::getNumFaces(meshset.get());
+			}
+		}
+		for (const shared_ptr<ItemShapeData>& child_item : item->m_child_items)
+		{
+			numFaces += getNumFaces(child_item);
+		}
+		return numFaces;
+	}
+
+	static size_t getNumFaces(const shared_ptr<ProductShapeData>& product_shape)
+	{
+		size_t numFaces = 0;
+		for (const shared_ptr<ItemShapeData>& item : product_shape->getGeometricItems())
+		{
+			numFaces += getNumFaces(item);
+		}
+		return numFaces;
+	}
+
 	void subtractOpeningsInRelatedObjects(shared_ptr<ProductShapeData>& product_shape)
 	{
 		if (product_shape->m_ifc_object_definition.expired())
@@ -1196,7 +1400,7 @@ public:
 		}
 
 		shared_ptr<IfcObjectDefinition> ifc_object_def(product_shape->m_ifc_object_definition);
-		shared_ptr<IfcElement> ifc_element = dynamic_pointer_cast<IfcElement>(ifc_object_def);
+		shared_ptr<IfcElement> ifc_element = entity_cast<IfcElement>(ifc_object_def);
 		if (!ifc_element)
 		{
 			return;
@@ -1253,6 +1457,24 @@ public:
 		}
 	}
 
+	using StatusCallback::messageCallback;
+
+	//\brief buffered messages are sent to the callback function later, so without it nobody receives them
+	virtual bool hasMessageListener(MessageType type) const override
+	{
+		return hasMessageCallback(type);
+	}
+
+	//\brief messages of the converters are redirected to here. With deterministic output, they are buffered while a product is converted, see GeometrySettings::setDeterministicOutput
+	virtual void messageCallback(shared_ptr<StatusCallback::Message> m) override
+	{
+		if (bufferMessage(m))
+		{
+			return;
+		}
+		StatusCallback::messageCallback(m);
+	}
+
 	virtual void messageTarget(void* ptr, shared_ptr<StatusCallback::Message> m)
 	{
 		GeometryConverter* myself = (GeometryConverter*)ptr;
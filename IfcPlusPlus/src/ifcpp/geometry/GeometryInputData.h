@@ -28,6 +28,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <ifcpp/IFC4X3/include/IfcTextStyle.h>
 #include "IncludeCarveHeaders.h"
 #include "GeomUtils.h"
+#include "VertexTransform.h"
 
 class PolyInputCache3D;
 class ProductShapeData;
@@ -41,6 +42,11 @@ struct MeshSetInfo
 	{
 		copyFromOther(other);
 	}
+	MeshSetInfo& operator=(const MeshSetInfo& other)
+	{
+		copyFromOther(other);
+		return *this;
+	}
 
 	void copyFromOther(const MeshSetInfo& other)
 	{
@@ -457,40 +463,42 @@ public:
 
 	void applyTransformToItem(const carve::math::Matrix& mat, double eps, bool matrix_identity_checked)
 	{
-		if (!matrix_identity_checked)
+		VertexTransform::MatrixType matrixType = VertexTransform::classifyMatrix(mat);
+		if (matrixType == VertexTransform::MATRIX_IDENTITY)
 		{
-			if (GeomUtils::isMatrixIdentity(mat))
+			if (!matrix_identity_checked)
 			{
 				return;
 			}
+
+			// caller has decided to apply the matrix, so do not drop small deviations from identity
+			matrixType = VertexTransform::MATRIX_GENERAL;
+		}
+		applyTransformToItem(mat, matrixType, eps);
+	}
+
+	void applyTransformToItem(const carve::math::Matrix& mat, VertexTransform::MatrixType matrixType, double eps)
+	{
+		if (matrixType == VertexTransform::MATRIX_IDENTITY)
+		{
+			return;
 		}
 
 		for (size_t ii = 0; ii < m_vertex_points.size(); ++ii)
 		{
 			shared_ptr<carve::input::VertexData>& vertex_data = m_vertex_points[ii];
-			for (size_t j = 0; j < vertex_data->points.size(); ++j)
-			{
-				vec3& point = vertex_data->points[j];
-				point = mat * point;
-			}
+			VertexTransform::transformPoints(vertex_data->points, mat, matrixType);
 		}
 
 		for (size_t polyline_i = 0; polyline_i < m_polylines.size(); ++polyline_i)
 		{
 			shared_ptr<carve::input::PolylineSetData>& polyline_data = m_polylines[polyline_i];
-			for (size_t j = 0; j < polyline_data->points.size(); ++j)
-			{
-				vec3& point = polyline_data->points[j];
-				point = mat * point;
-			}
+			VertexTransform::transformPoints(polyline_data->points, mat, matrixType);
 		}
 
 		//is negative if coordinate system changes handedness (for example as result of mirroring)
 		//in this case invert the meshes to not make them look inside out (only noticeable if using back face culling)
-		bool const invert_meshes = 0 > carve::geom::dotcross(
-			carve::geom::VECTOR(mat.m[0][0], mat.m[1][0], mat.m[2][0]),
-			carve::geom::VECTOR(mat.m[0][1], mat.m[1][1], mat.m[2][1]),
-			carve::geom::VECTOR(mat.m[0][2], mat.m[1][2], mat.m[2][2]));
+		bool const invert_meshes = matrixType == VertexTransform::MATRIX_GENERAL && VertexTransform::isMatrixMirroring(mat);
 
 		for (size_t i_meshsets = 0; i_meshsets < m_meshsets_open.size(); ++i_meshsets)
 		{
@@ -500,11 +508,7 @@ public:
 				continue;
 			}
 
-			for (size_t i = 0; i < item_meshset->vertex_storage.size(); ++i)
-			{
-				vec3& point = item_meshset->vertex_storage[i].v;
-				point = mat * point;
-			}
+			VertexTransform::transformVertices(item_meshset->vertex_storage, mat, matrixType);
 			for (size_t i = 0; i < item_meshset->meshes.size(); ++i)
 			{
 				item_meshset->meshes[i]->recalc(eps);
@@ -523,11 +527,7 @@ public:
 				continue;
 			}
 
-			for (size_t i = 0; i < item_meshset->vertex_storage.size(); ++i)
-			{
-				vec3& point = item_meshset->vertex_storage[i].v;
-				point = mat * point;
-			}
+			VertexTransform::transformVertices(item_meshset->vertex_storage, mat, matrixType);
 			for (size_t i = 0; i < item_meshset->meshes.size(); ++i)
 			{
 				item_meshset->meshes[i]->recalc(eps);
@@ -548,7 +548,7 @@ public:
 
 		for (auto child : m_child_items)
 		{
-			child->applyTransformToItem(mat, eps, matrix_identity_checked);
+			child->applyTransformToItem(mat, matrixType, eps);
 		}
 	}
 
@@ -1015,23 +1015,34 @@ public:
 
 	void applyTransformToProduct( const carve::math::Matrix& matrix, double eps, bool matrix_identity_checked, bool applyToChildren )
 	{
-		if( !matrix_identity_checked )
+		VertexTransform::MatrixType matrixType = VertexTransform::classifyMatrix( matrix );
+		if( matrixType == VertexTransform::MATRIX_IDENTITY )
 		{
-			if( GeomUtils::isMatrixIdentity( matrix ) )
+			if( !matrix_identity_checked )
 			{
 				return;
 			}
+			matrixType = VertexTransform::MATRIX_GENERAL;
+		}
+		applyTransformToProduct( matrix, matrixType, eps, applyToChildren );
+	}
+
+	void applyTransformToProduct( const carve::math::Matrix& matrix, VertexTransform::MatrixType matrixType, double eps, bool applyToChildren )
+	{
+		if( matrixType == VertexTransform::MATRIX_IDENTITY )
+		{
+			return;
 		}
 		for( size_t i_item = 0; i_item < m_geometric_items.size(); ++i_item )
 		{
-			m_geometric_items[i_item]->applyTransformToItem( matrix, eps, true );
+			m_geometric_items[i_item]->applyTransformToItem( matrix, matrixType, eps );
 		}
 
 		if( applyToChildren )
 		{
 			for( auto child_product_data : m_child_products)
 			{
-				child_product_data->applyTransformToProduct(matrix, eps, true, applyToChildren );
+				child_product_data->applyTransformToProduct( matrix, matrixType, eps, applyToChildren );
 			}
 		}
 	}
@@ -1156,17 +1167,19 @@ public:
 		{
 			return;
 		}
-		if (!matrix_identity_checked)
+		VertexTransform::MatrixType matrixType = VertexTransform::classifyMatrix(transform->m_matrix);
+		if (matrixType == VertexTransform::MATRIX_IDENTITY)
 		{
-			if (GeomUtils::isMatrixIdentity(transform->m_matrix))
+			if (!matrix_identity_checked)
 			{
 				return;
 			}
+			matrixType = VertexTransform::MATRIX_GENERAL;
 		}
 
 		for (auto itemData : m_geometric_items)
 		{
-			itemData->applyTransformToItem(transform->m_matrix, eps, true);
+			itemData->applyTransformToItem(transform->m_matrix, matrixType, eps);
 		}
 	}
 };
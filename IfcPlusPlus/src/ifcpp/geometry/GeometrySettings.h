@@ -24,7 +24,9 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <unordered_set>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/BuildingObject.h>
+#include <ifcpp/model/Executor.h>
 #include <ifcpp/IFC4X3/EntityFactory.h>
+#include <ifcpp/geometry/ConversionBudget.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -70,6 +72,7 @@ public:
 		m_excludeIfcTypes = other->m_excludeIfcTypes;
 		m_renderOnlyIfcTypes = other->m_excludeIfcTypes;
 		m_maxNumFaceEdges = other->m_maxNumFaceEdges;
+		m_minNumFacesParallelTriangulation = other->m_minNumFacesParallelTriangulation;
 		m_num_vertices_per_circle = other->m_num_vertices_per_circle;
 		m_num_vertices_per_circle_default = other->m_num_vertices_per_circle_default;
 		m_min_num_vertices_per_arc = other->m_min_num_vertices_per_arc;
@@ -85,6 +88,10 @@ public:
 		m_epsCoplanarAngle = other->m_epsCoplanarAngle;
 		m_mergeAlignedEdges = other->m_mergeAlignedEdges;
 		m_callback_simplify_mesh = other->m_callback_simplify_mesh;
+		m_executor = other->m_executor;
+		m_cancellation_token = other->m_cancellation_token;
+		m_max_conversion_time = other->m_max_conversion_time;
+		m_max_element_conversion_time = other->m_max_element_conversion_time;
 	}
 
 	// Number of discretization points per circle
@@ -118,6 +125,33 @@ public:
 	void setMinTriangleArea(double min_area) { m_min_triangle_area = min_area; }
 	double getMinTriangleArea() { return m_min_triangle_area; }
 
+	/**\brief setMinNumFacesParallelTriangulation: face lists (IfcFacetedBrep, IfcFaceBasedSurfaceModel etc.) with at least this number of faces are triangulated in parallel */
+	void setMinNumFacesParallelTriangulation(size_t num) { m_minNumFacesParallelTriangulation = num; }
+	size_t getMinNumFacesParallelTriangulation() { return m_minNumFacesParallelTriangulation; }
+
+	/**\brief setExecutor: runs the parallel loops of the geometry conversion, over all products and over the faces of large face lists. If not set, Executor::getDefault() is used */
+	void setExecutor( const shared_ptr<Executor>& executor ) { m_executor = executor; }
+	const shared_ptr<Executor>& getExecutor() const { return m_executor; }
+
+	/**\brief setDeterministicOutput: messages of the geometry conversion are buffered per product and sent in model order after the parallel loops, instead of as soon as they occur.
+	Together with the ordered merge of the product shapes, messages and getShapeInputData() are then identical across runs and numbers of threads. Default is false */
+	void setDeterministicOutput(bool deterministic) { m_deterministic_output = deterministic; }
+	bool isDeterministicOutput() const { return m_deterministic_output; }
+
+	/**\brief setCancellationToken: GeometryConverter::convertGeometry stops as soon as the token is canceled, also within a running CSG operation, and clears the result */
+	void setCancellationToken(const shared_ptr<CancellationToken>& token) { m_cancellation_token = token; }
+	const shared_ptr<CancellationToken>& getCancellationToken() const { return m_cancellation_token; }
+
+	/**\brief setMaxConversionTime: wall-clock time limit of GeometryConverter::convertGeometry in seconds, 0 for no limit.
+	When it is reached, running CSG operations are stopped and products that are not converted yet are skipped. Products that are converted so far are kept */
+	void setMaxConversionTime(double seconds) { m_max_conversion_time = seconds; }
+	double getMaxConversionTime() const { return m_max_conversion_time; }
+
+	/**\brief setMaxElementConversionTime: wall-clock time limit per product in seconds, 0 for no limit.
+	A product that reaches it keeps the geometry that is converted so far, for example without the openings that are not subtracted yet */
+	void setMaxElementConversionTime(double seconds) { m_max_element_conversion_time = seconds; }
+	double getMaxElementConversionTime() const { return m_max_element_conversion_time; }
+
 	/**\brief Render bounding box for each object */
 	bool getRenderBoundingBoxes() { return m_render_bounding_box; }
 	void setRenderBoundingBoxes(bool render_bbox) { m_render_bounding_box = render_bbox; }
@@ -178,9 +212,15 @@ protected:
 	bool m_handle_styled_items = true;
 	bool m_handle_layer_assignments = true;
 	bool m_render_bounding_box = false;
+	bool m_deterministic_output = false;
 	double m_min_triangle_area = EPS_MIN_FACE_AREA;
 	double m_epsilonMergePoints = EPS_DEFAULT;
 	double m_epsCoplanarAngle = EPS_ANGLE_COPLANAR_FACES;
+	size_t m_minNumFacesParallelTriangulation = 10000;
+	shared_ptr<Executor> m_executor;
+	shared_ptr<CancellationToken> m_cancellation_token;
+	double m_max_conversion_time = 0;
+	double m_max_element_conversion_time = 0;
 
 	std::function<int(double)> m_num_vertices_per_circle_given_radius = [&](double radius)
 	{
@@ -0,0 +1,187 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include "CSG_Adapter.h"
+#include "GeometryStatistics.h"
+
+static thread_local GeometryStatistics::ProductStatistics* t_currentProduct = nullptr;
+
+// GUIDs come from the file and are not validated, so they may contain separators or quotes
+static void writeCSVField(std::ostream& stream, const std::string& field)
+{
+	if (field.find_first_of(",\"\r\n") == std::string::npos)
+	{
+		stream << field;
+		return;
+	}
+
+	// RFC 4180: enclose in quotes, and double the quotes inside
+	stream << '"';
+	for (char c : field)
+	{
+		if (c == '"')
+		{
+			stream << '"';
+		}
+		stream << c;
+	}
+	stream << '"';
+}
+
+static void writeJSONString(std::ostream& stream, const std::string& str)
+{
+	stream << '"';
+	for (char c : str)
+	{
+		if (c == '"' || c == '\\')
+		{
+			stream << '\\' << c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20)
+		{
+			stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+		}
+		else
+		{
+			stream << c;
+		}
+	}
+	stream << '"';
+}
+
+GeometryStatistics::ScopedProduct::ScopedProduct(ProductStatistics* product)
+{
+	m_previous = t_currentProduct;
+	t_currentProduct = product;
+}
+
+GeometryStatistics::ScopedProduct::~ScopedProduct()
+{
+	t_currentProduct = m_previous;
+}
+
+GeometryStatistics::ProductStatistics* GeometryStatistics::getCurrentProduct()
+{
+	return t_currentProduct;
+}
+
+GeometryStatistics::ProductStatistics* GeometryStatistics::addProduct(int tag, uint32_t classID, const std::string& guid)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	ProductStatistics& product = m_products[tag];
+	product.tag = tag;
+	product.classID = classID;
+	product.guid = guid;
+	return &product;
+}
+
+GeometryStatistics::ProductStatistics* GeometryStatistics::getProduct(int tag)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_products.find(tag);
+	if (it == m_products.end())
+	{
+		return nullptr;
+	}
+	return &it->second;
+}
+
+std::vector<GeometryStatistics::ProductStatistics> GeometryStatistics::getProducts() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::vector<ProductStatistics> products;
+	products.reserve(m_products.size());
+	for (auto& it : m_products)
+	{
+		products.push_back(it.second);
+	}
+	return products;
+}
+
+std::vector<GeometryStatistics::ProductStatistics> GeometryStatistics::getSlowestProducts(size_t numProducts) const
+{
+	std::vector<ProductStatistics> products = getProducts();
+	numProducts = std::min(numProducts, products.size());
+	std::partial_sort(products.begin(), products.begin() + numProducts, products.end(), [](const ProductStatistics& a, const ProductStatistics& b) {
+		return a.timeSeconds > b.timeSeconds;
+	});
+	products.resize(numProducts);
+	return products;
+}
+
+void GeometryStatistics::writeCSV(std::ostream& stream) const
+{
+	std::vector<ProductStatistics> products = getProducts();
+	stream << "tag,class,guid,time_seconds,csg_operations,csg_attempts,csg_failed,csg_operand_too_large,csg_succeeded_by_variant,csg_faces_in,csg_faces_out,faces_out\n";
+	for (const ProductStatistics& product : products)
+	{
+		stream << product.tag << "," << IFC4X3::EntityFactory::getStringForClassID(product.classID) << ",";
+		writeCSVField(stream, product.guid);
+		stream << "," << product.timeSeconds;
+		stream << "," << product.numCsgOperations << "," << product.numCsgAttempts << "," << product.numCsgFailed << "," << product.numCsgOperandTooLarge << ",";
+		bool first = true;
+		for (size_t ii = 0; ii < product.numCsgSucceededByVariant.size(); ++ii)
+		{
+			if (product.numCsgSucceededByVariant[ii] > 0)
+			{
+				stream << (first ? "" : " ") << ii << ":" << product.numCsgSucceededByVariant[ii];
+				first = false;
+			}
+		}
+		stream << "," << product.numCsgFacesIn << "," << product.numCsgFacesOut << "," << product.numFacesOut << "\n";
+	}
+}
+
+void GeometryStatistics::writeJSON(std::ostream& stream) const
+{
+	std::vector<ProductStatistics> products = getProducts();
+	stream << "{\n\"csgVariants\":[";
+	const std::vector<CSG_Adapter::CsgOperationParams>& variants = CSG_Adapter::getCsgOperationVariants();
+	for (size_t ii = 0; ii < variants.size(); ++ii)
+	{
+		const CSG_Adapter::CsgOperationParams& variant = variants[ii];
+		stream << (ii == 0 ? "\n" : ",\n");
+		stream << "{\"epsilonFactor\":" << variant.epsilonFactor << ",\"normalizeCoords\":" << (variant.normalizeCoords ? "true" : "false");
+		stream << ",\"allowDegenerateEdges\":" << (variant.allowDegenerateEdges ? "true" : "false") << ",\"allowFinFacesInResult\":" << (variant.allowFinFacesInResult ? "true" : "false");
+		stream << ",\"allowFinEdgesInResult\":" << (variant.allowFinEdgesInResult ? "true" : "false") << ",\"flattenFacePlanes\":" << (variant.flattenFacePlanes ? "true" : "false") << "}";
+	}
+	stream << "\n],\n\"products\":[";
+	for (size_t ii = 0; ii < products.size(); ++ii)
+	{
+		const ProductStatistics& product = products[ii];
+		stream << (ii == 0 ? "\n" : ",\n");
+		stream << "{\"tag\":" << product.tag << ",\"class\":\"" << IFC4X3::EntityFactory::getStringForClassID(product.classID) << "\",\"guid\":";
+		writeJSONString(stream, product.guid);
+		stream << ",\"timeSeconds\":" << product.timeSeconds << ",\"csgOperations\":" << product.numCsgOperations << ",\"csgAttempts\":" << product.numCsgAttempts;
+		stream << ",\"csgFailed\":" << product.numCsgFailed << ",\"csgOperandTooLarge\":" << product.numCsgOperandTooLarge << ",\"csgSucceededByVariant\":[";
+		for (size_t jj = 0; jj < product.numCsgSucceededByVariant.size(); ++jj)
+		{
+			stream << (jj == 0 ? "" : ",") << product.numCsgSucceededByVariant[jj];
+		}
+		stream << "],\"csgFacesIn\":" << product.numCsgFacesIn << ",\"csgFacesOut\":" << product.numCsgFacesOut << ",\"facesOut\":" << product.numFacesOut << "}";
+	}
+	stream << "\n]\n}\n";
+}
+
+void GeometryStatistics::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_products.clear();
+}
@@ -0,0 +1,90 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <ifcpp/model/BasicTypes.h>
+
+/**
+*\brief Class GeometryStatistics: cost of the geometry conversion per product, to find the elements and the kind of geometry that make a model slow to load.
+* Collected by GeometryConverter after GeometryConverter::setCollectStatistics(true). CSG_Adapter adds to the product that is converted in the calling thread, see ScopedProduct.
+*/
+class GeometryStatistics
+{
+public:
+	struct ProductStatistics
+	{
+		int					tag = -1;
+		uint32_t			classID = 0;
+		std::string			guid;
+		double				timeSeconds = 0;				// wall time of the conversion, including subtraction of openings
+		size_t				numCsgOperations = 0;			// boolean operations of the first operand with one other operand
+		size_t				numCsgAttempts = 0;				// calls of CSG_Adapter::computeCSG_Carve, including retries with other CsgOperationParams
+		size_t				numCsgFailed = 0;				// operations where all variants failed. The first operand is kept unchanged
+		size_t				numCsgOperandTooLarge = 0;		// attempts that were skipped, because an operand has too many vertices
+		std::vector<size_t>	numCsgSucceededByVariant;		// index is the variant in CSG_Adapter::getCsgOperationVariants()
+		size_t				numCsgFacesIn = 0;				// faces of the operands of all CSG operations. Carve faces, which may have more than 3 vertices
+		size_t				numCsgFacesOut = 0;				// faces of the results of successful CSG operations
+		size_t				numFacesOut = 0;				// faces of all meshes of the product after conversion
+	};
+
+	/** \brief Sets the product that CSG_Adapter adds to in the current thread, and restores the previous one in the destructor */
+	class ScopedProduct
+	{
+	public:
+		explicit ScopedProduct(ProductStatistics* product);
+		~ScopedProduct();
+		ScopedProduct(const ScopedProduct&) = delete;
+		ScopedProduct& operator=(const ScopedProduct&) = delete;
+
+	private:
+		ProductStatistics* m_previous = nullptr;
+	};
+
+	/** \brief Product that is converted in the current thread, nullptr if statistics are not collected */
+	static ProductStatistics* getCurrentProduct();
+
+	/** \brief Returns the entry of the product, and creates it if it does not exist yet. The pointer stays valid until clear() */
+	ProductStatistics* addProduct(int tag, uint32_t classID, const std::string& guid);
+
+	/** \brief Returns the entry of the product, or nullptr */
+	ProductStatistics* getProduct(int tag);
+
+	/** \brief Copy of all entries, sorted by tag */
+	std::vector<ProductStatistics> getProducts() const;
+
+	/** \brief Copy of the numProducts entries with the longest conversion time, slowest first */
+	std::vector<ProductStatistics> getSlowestProducts(size_t numProducts) const;
+
+	/** \brief Writes one line per product, with a header line. CSG variants are written as variantIndex:count, separated by spaces. GUIDs are quoted if necessary */
+	void writeCSV(std::ostream& stream) const;
+
+	/** \brief Writes the CsgOperationParams of the variants and an array of all products. GUIDs are escaped as JSON strings */
+	void writeJSON(std::ostream& stream) const;
+
+	void clear();
+
+private:
+	mutable std::mutex						m_mutex;
+	std::map<int, ProductStatistics>		m_products;
+};
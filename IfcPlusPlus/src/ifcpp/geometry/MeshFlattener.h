@@ -292,6 +292,7 @@ public:
 								if (face->mesh)
 								{
 									face->mesh->m_volume = std::numeric_limits<double>::quiet_NaN();
+									face->mesh->touchMeshSet();
 								}
 #ifdef _DEBUG
 								if (distance2 > EPS_M9)
@@ -480,6 +481,8 @@ public:
 				//#endif
 			}
 		}
+		op1->touch();
+		op2->touch();
 	}
 };
 
@@ -63,6 +63,7 @@ public:
 	}
 
 	double getScale() const { return m_scale; }
+	const vec3& getNormalizeCenter() const { return m_normalizeCenter; }
 	void setToZero()
 	{
 		m_scale = 1.0;
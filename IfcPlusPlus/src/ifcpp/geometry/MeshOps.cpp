@@ -33,6 +33,24 @@ size_t MeshOps::getNumFaces(const carve::mesh::MeshSet<3>* meshset)
 	return num_faces;
 }
 
+size_t MeshOps::getMemoryUsage(const carve::mesh::MeshSet<3>* meshset)
+{
+	size_t numBytes = sizeof(carve::mesh::MeshSet<3>);
+	numBytes += meshset->vertex_storage.capacity() * sizeof(carve::mesh::Vertex<3>);
+	numBytes += meshset->meshes.capacity() * sizeof(carve::mesh::Mesh<3>*);
+	for (const carve::mesh::Mesh<3>* mesh : meshset->meshes)
+	{
+		numBytes += sizeof(carve::mesh::Mesh<3>);
+		numBytes += mesh->faces.capacity() * sizeof(carve::mesh::Face<3>*);
+		numBytes += (mesh->open_edges.capacity() + mesh->closed_edges.capacity()) * sizeof(carve::mesh::Edge<3>*);
+		for (const carve::mesh::Face<3>* face : mesh->faces)
+		{
+			numBytes += sizeof(carve::mesh::Face<3>) + face->n_edges * sizeof(carve::mesh::Edge<3>);
+		}
+	}
+	return numBytes;
+}
+
 void MeshOps::recalcMeshSet(shared_ptr<carve::mesh::MeshSet<3> >& meshset, double eps)
 {
 	for (auto mesh : meshset->meshes)
@@ -1211,6 +1229,7 @@ void MeshOps::removeDegenerateMeshes(shared_ptr<carve::mesh::MeshSet<3> >& meshs
 
 	if( numRemovedMeshes > 0 )
 	{
+		meshsetInput->touch();
 		for( auto it = meshsetInput->meshes.begin(); it != meshsetInput->meshes.end(); ++it )
 		{
 			carve::mesh::Mesh<3>* mesh = *it;
@@ -2316,7 +2335,88 @@ void MeshOps::checkMeshSetIntegrity(const shared_ptr<carve::mesh::MeshSet<3> >&
 	}
 }
 
+struct CachedMeshSetInfo
+{
+	uint64_t revision = 0;
+	double epsMergePoints = 0;
+	double epsMergeAlignedEdgesAngle = 0;
+	double minFaceArea = 0;
+	bool allowFinEdges = false;
+	bool allowDegenerateEdges = false;
+	bool allowZeroAreaFaces = false;
+	bool treatLongThinFaceAsDegenerate = false;
+	MeshSetInfo info;
+
+	void setParams(const GeomProcessingParams& params)
+	{
+		epsMergePoints = params.epsMergePoints;
+		epsMergeAlignedEdgesAngle = params.epsMergeAlignedEdgesAngle;
+		minFaceArea = params.minFaceArea;
+		allowFinEdges = params.allowFinEdges;
+		allowDegenerateEdges = params.allowDegenerateEdges;
+		allowZeroAreaFaces = params.allowZeroAreaFaces;
+		treatLongThinFaceAsDegenerate = params.treatLongThinFaceAsDegenerate;
+	}
+
+	bool isValidFor(const carve::mesh::MeshSet<3>* meshset, const GeomProcessingParams& params) const
+	{
+		return revision == meshset->revision()
+			&& epsMergePoints == params.epsMergePoints
+			&& epsMergeAlignedEdgesAngle == params.epsMergeAlignedEdgesAngle
+			&& minFaceArea == params.minFaceArea
+			&& allowFinEdges == params.allowFinEdges
+			&& allowDegenerateEdges == params.allowDegenerateEdges
+			&& allowZeroAreaFaces == params.allowZeroAreaFaces
+			&& treatLongThinFaceAsDegenerate == params.treatLongThinFaceAsDegenerate;
+	}
+};
+
+// Side table of the last validation result per MeshSet. Geometry conversion runs per product in parallel, so each thread has its own table.
+// The MeshSet revision is unique over all MeshSets, so entries of deleted MeshSets are never matched, even if the address is reused.
+static thread_local std::unordered_map<const carve::mesh::MeshSet<3>*, CachedMeshSetInfo> tl_meshSetInfoCache;
+static const size_t MAX_NUM_CACHED_MESHSET_INFO = 64;
+
 bool MeshOps::checkMeshSetValidAndClosed(const shared_ptr<carve::mesh::MeshSet<3>>& meshset, MeshSetInfo& info, const GeomProcessingParams& params)
+{
+	if (!meshset)
+	{
+		info.meshSetValid = false;
+		return false;
+	}
+
+	auto itCached = tl_meshSetInfoCache.find(meshset.get());
+	if (itCached != tl_meshSetInfoCache.end())
+	{
+		const CachedMeshSetInfo& cached = itCached->second;
+		if (cached.isValidFor(meshset.get(), params))
+		{
+			// keep the reporting context of the caller
+			StatusCallback* report_callback = info.report_callback;
+			BuildingEntity* entity = info.entity;
+			info.copyFromOther(cached.info);
+			info.report_callback = report_callback;
+			info.entity = entity;
+			info.meshset = meshset;
+			return info.meshSetValid;
+		}
+	}
+
+	bool meshsetValid = checkMeshSetValidAndClosedUncached(meshset, info, params);
+
+	if (tl_meshSetInfoCache.size() >= MAX_NUM_CACHED_MESHSET_INFO && itCached == tl_meshSetInfoCache.end())
+	{
+		tl_meshSetInfoCache.clear();
+	}
+
+	// the check can invert negative meshes, so the revision is taken afterwards
+	CachedMeshSetInfo& cached = tl_meshSetInfoCache[meshset.get()];
+	cached.revision = meshset->revision();
+	cached.setParams(params);
+	cached.info.copyFromOther(info);
+	return meshsetValid;
+}
+
+bool MeshOps::checkMeshSetValidAndClosedUncached(const shared_ptr<carve::mesh::MeshSet<3>>& meshset, MeshSetInfo& info, const GeomProcessingParams& params)
 {
 	info.meshSetValid = false;
 	if (!meshset)
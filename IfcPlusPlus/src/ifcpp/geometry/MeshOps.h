@@ -32,6 +32,9 @@ public:
 	static double computeShapeSurfaceArea(const shared_ptr<ItemShapeData>& shape_input_data);
 	static double computeShapeSurfaceArea(const shared_ptr<ProductShapeData>& shape_input_data);
 	static size_t getNumFaces(const carve::mesh::MeshSet<3>* meshset);
+
+	/// \brief getMemoryUsage: approximate heap memory of a meshset, from the number of vertices, meshes, faces and edges
+	static size_t getMemoryUsage(const carve::mesh::MeshSet<3>* meshset);
 	static void recalcMeshSet(shared_ptr<carve::mesh::MeshSet<3> >& meshset, double eps);
 	static void checkFaceIntegrity(const carve::mesh::Face<3>* face, bool checkForDegenerateEdges, MeshSetInfo& info, double eps);
 	static size_t countFaces(carve::mesh::MeshSet<3>* mesh);
@@ -50,8 +53,12 @@ public:
 
 	static bool isBetterForBoolOp(const MeshSetInfo& infoNew, const MeshSetInfo& infoBefore, bool considerTriangulation);
 
+	/// \brief checkMeshSetValidAndClosed: check all faces and edges of the meshset. The result is cached per MeshSet revision, so a re-check of an unchanged meshset with the same params only copies the cached info
 	static bool checkMeshSetValidAndClosed(const shared_ptr<carve::mesh::MeshSet<3>>& meshset, MeshSetInfo& info, const GeomProcessingParams& params );
 
+	/// \brief checkMeshSetValidAndClosedUncached: same as checkMeshSetValidAndClosed, but always walks the whole meshset
+	static bool checkMeshSetValidAndClosedUncached(const shared_ptr<carve::mesh::MeshSet<3>>& meshset, MeshSetInfo& info, const GeomProcessingParams& params );
+
 	static bool checkMeshSetNonNegativeAndClosed(const shared_ptr<carve::mesh::MeshSet<3>> mesh_set, const GeomProcessingParams& params);
 
 	static void checkMeshIntegrity(const carve::mesh::Mesh<3>* mesh, bool checkForDegenerateEdges, const GeomProcessingParams& params, MeshSetInfo& info);
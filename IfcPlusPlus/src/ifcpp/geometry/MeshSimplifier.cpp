@@ -279,6 +279,10 @@ void MeshSimplifier::simplifyMeshSet(shared_ptr<carve::mesh::MeshSet<3> >& meshs
 
 		return;
 	}
+	catch (carve::interrupted&)
+	{
+		// time limit of the element reached, or conversion canceled. meshsetInput keeps the best result so far
+	}
 	catch (std::exception& ex)
 	{
 #ifdef _DEBUG
@@ -328,6 +332,7 @@ size_t MeshSimplifier::mergeCoplanarFacesInMeshSet(shared_ptr<carve::mesh::MeshS
 	{
 		for (carve::mesh::Edge<3>*edge : mesh->closed_edges)
 		{
+			carve::check_interrupt();
 			if (!edge)
 			{
 				continue;
@@ -423,6 +428,7 @@ size_t MeshSimplifier::mergeAlignedEdges(shared_ptr<carve::mesh::MeshSet<3> >& m
 	{
 		for (carve::mesh::Face<3>*face : mesh->faces)
 		{
+			carve::check_interrupt();
 			if (!face)
 			{
 				continue;
@@ -881,6 +887,7 @@ size_t MeshSimplifier::removeEdgeAndMergeFaces(carve::mesh::Edge<3>* edgeIn, con
 				// map<vertex, std::vector<face>>
 			}
 		}
+		mesh->touchMeshSet();
 
 		if (allVerticesInPlane)
 		{
@@ -148,6 +148,7 @@ public:
 			if (f == fx)
 			{
 				mesh->faces.erase(it);
+				mesh->touchMeshSet();
 				return 1;
 			}
 		}
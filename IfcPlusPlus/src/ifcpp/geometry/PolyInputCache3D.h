@@ -46,12 +46,30 @@ public:
 	shared_ptr<carve::input::PolyhedronData> m_poly_data;
 	double epsilon;
 
+	// Deferred merge mode: points are not merged, and checks that depend on merged point indices are only recorded.
+	// This allows to fill several caches in parallel, and then append them with appendDeferred in a fixed order,
+	// with exactly the same result as adding everything to one cache sequentially.
+	struct DeferredCheck
+	{
+		int faceCountBefore = 0;
+		uint32_t idx[4] = { 0, 0, 0, 0 };
+		bool isQuad = false;
+		double eps = 0;
+	};
+	bool m_deferMerge = false;
+	std::vector<DeferredCheck> m_deferredChecks;
+
 	PolyInputCache3D(double eps = 1e-6) : epsilon(eps) {
 		m_poly_data = shared_ptr<carve::input::PolyhedronData>(new carve::input::PolyhedronData());
 	}
 
 	// Adds a point to the cache. Returns the index of the existing or newly inserted point.
 	uint32_t addPoint(const vec3& pt) {
+		if (m_deferMerge) {
+			m_poly_data->points.push_back(pt);
+			return static_cast<uint32_t>(m_poly_data->points.size() - 1);
+		}
+
 		uint32_t hash = Vec3Hash(pt, epsilon);
 		std::vector<vec3>& pointList = m_poly_data->points;
 
@@ -72,6 +90,57 @@ public:
 		return newIndex;
 	}
 
+	// Appends a cache that was filled in deferred merge mode. Points are merged and the recorded checks are applied in the original order
+	void appendDeferred(const PolyInputCache3D& other)
+	{
+		const std::vector<vec3>& otherPoints = other.m_poly_data->points;
+		std::vector<uint32_t> mapIndex(otherPoints.size());
+		for (size_t ii = 0; ii < otherPoints.size(); ++ii)
+		{
+			mapIndex[ii] = addPoint(otherPoints[ii]);
+		}
+
+		const std::vector<int>& otherFaceIndices = other.m_poly_data->faceIndices;
+		std::vector<int> faceIndices;
+		size_t pos = 0;
+		int faceCount = 0;
+		auto itCheck = other.m_deferredChecks.begin();
+		while (true)
+		{
+			for (; itCheck != other.m_deferredChecks.end() && itCheck->faceCountBefore == faceCount; ++itCheck)
+			{
+				const DeferredCheck& check = *itCheck;
+				const vec3& v0 = otherPoints[check.idx[0]];
+				const vec3& v1 = otherPoints[check.idx[1]];
+				const vec3& v2 = otherPoints[check.idx[2]];
+				if (check.isQuad)
+				{
+					const vec3& v3 = otherPoints[check.idx[3]];
+					addFaceCheckIndexes(mapIndex[check.idx[0]], mapIndex[check.idx[1]], mapIndex[check.idx[2]], mapIndex[check.idx[3]], v0, v1, v2, v3, check.eps);
+				}
+				else
+				{
+					addTriangleCheckDegenerate(mapIndex[check.idx[0]], mapIndex[check.idx[1]], mapIndex[check.idx[2]], v0, v1, v2, check.eps);
+				}
+			}
+
+			if (pos >= otherFaceIndices.size())
+			{
+				break;
+			}
+
+			const int numFaceVertices = otherFaceIndices[pos];
+			faceIndices.clear();
+			for (int ii = 1; ii <= numFaceVertices; ++ii)
+			{
+				faceIndices.push_back(mapIndex[otherFaceIndices[pos + ii]]);
+			}
+			m_poly_data->addFace(faceIndices.begin(), faceIndices.end());
+			pos += numFaceVertices + 1;
+			++faceCount;
+		}
+	}
+
 	void clearPointCache()
 	{
 		m_hashToIndexMap.clear();
@@ -106,6 +175,20 @@ public:
 	void addFaceCheckIndexes(uint32_t idxA, uint32_t idxB, uint32_t idxC, uint32_t idxD,
 		const vec3& v0, const vec3& v1, const vec3& v2, const vec3& v3, double eps)
 	{
+		if (m_deferMerge)
+		{
+			DeferredCheck check;
+			check.faceCountBefore = m_poly_data->getFaceCount();
+			check.idx[0] = idxA;
+			check.idx[1] = idxB;
+			check.idx[2] = idxC;
+			check.idx[3] = idxD;
+			check.isQuad = true;
+			check.eps = eps;
+			m_deferredChecks.push_back(check);
+			return;
+		}
+
 		std::unordered_set<uint32_t> setIndices = { idxA, idxB, idxC, idxD };
 
 		if (setIndices.size() == 3)
@@ -146,6 +229,18 @@ public:
 	void addTriangleCheckDegenerate(uint32_t idxA, uint32_t idxB, uint32_t idxC,
 		const vec3& pointA, const vec3& pointB, const vec3& pointC, double eps)
 	{
+		if (m_deferMerge)
+		{
+			DeferredCheck check;
+			check.faceCountBefore = m_poly_data->getFaceCount();
+			check.idx[0] = idxA;
+			check.idx[1] = idxB;
+			check.idx[2] = idxC;
+			check.eps = eps;
+			m_deferredChecks.push_back(check);
+			return;
+		}
+
 		if (idxA == idxB || idxA == idxC || idxB == idxC)
 		{
 #ifdef _DEBUG
@@ -48,6 +48,31 @@ public:
 		m_profile_cache.clear();
 	}
 
+	/** \brief Approximate heap memory of the cached profiles and their paths */
+	size_t getMemoryUsage()
+	{
+		std::lock_guard<std::mutex> lock( m_writelock_profile_cache );
+		size_t numBytes = 0;
+		for( auto& it : m_profile_cache )
+		{
+			// map node and shared_ptr control block
+			numBytes += sizeof( std::pair<const int, shared_ptr<ProfileConverter> > ) + 6 * sizeof( void* );
+			const shared_ptr<ProfileConverter>& profile_converter = it.second;
+			if( !profile_converter )
+			{
+				continue;
+			}
+			numBytes += sizeof( ProfileConverter );
+			const std::vector<std::vector<vec2> >& paths = profile_converter->getCoordinates();
+			numBytes += paths.capacity() * sizeof( std::vector<vec2> );
+			for( const std::vector<vec2>& path : paths )
+			{
+				numBytes += path.capacity() * sizeof( vec2 );
+			}
+		}
+		return numBytes;
+	}
+
 	shared_ptr<ProfileConverter> getProfileConverter( const shared_ptr<IfcProfileDef>& ifc_profile, bool simplifyPaths)
 	{
 		if( !ifc_profile )
@@ -22,6 +22,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <ifcpp/geometry/GeometrySettings.h>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
+#include <ifcpp/model/Trace.h>
 #include <ifcpp/model/UnitConverter.h>
 #include <IfcAnnotationFillArea.h>
 #include <IfcBooleanResult.h>
@@ -173,7 +174,7 @@ public:
 
 		for (const shared_ptr<IfcRepresentationItem>& representationItem : ifcRepresentation->m_Items)
 		{
-			shared_ptr<IfcMappedItem> mapped = dynamic_pointer_cast<IfcMappedItem>(representationItem);
+			shared_ptr<IfcMappedItem> mapped = entity_cast<IfcMappedItem>( representationItem );
 			if (mapped)
 			{
 				if (mapped->m_MappingSource)
@@ -188,7 +189,7 @@ public:
 				}
 			}
 
-			shared_ptr<T> geomItem = dynamic_pointer_cast<T>(representationItem);
+			shared_ptr<T> geomItem = entity_cast<T>( representationItem );
 			if (geomItem)
 			{
 				return true;
@@ -206,7 +207,7 @@ public:
 		for( const shared_ptr<IfcRepresentationItem>& representationItem : ifcRepresentation->m_Items )
 		{
 			//ENTITY IfcRepresentationItem  ABSTRACT SUPERTYPE OF(ONEOF(IfcGeometricRepresentationItem, IfcMappedItem, IfcStyledItem, IfcTopologicalRepresentationItem));
-			shared_ptr<IfcGeometricRepresentationItem> geomItem = dynamic_pointer_cast<IfcGeometricRepresentationItem>( representationItem );
+			shared_ptr<IfcGeometricRepresentationItem> geomItem = entity_cast<IfcGeometricRepresentationItem>( representationItem );
 			if( geomItem )
 			{
 				shared_ptr<ItemShapeData> geomItemData( new ItemShapeData() );
@@ -229,7 +230,7 @@ public:
 				continue;
 			}
 
-			shared_ptr<IfcMappedItem> mapped_item = dynamic_pointer_cast<IfcMappedItem>( representationItem );
+			shared_ptr<IfcMappedItem> mapped_item = entity_cast<IfcMappedItem>( representationItem );
 			if( mapped_item )
 			{
 				shared_ptr<IfcRepresentationMap> map_source = mapped_item->m_MappingSource;
@@ -313,13 +314,13 @@ public:
 				continue;
 			}
 
-			shared_ptr<IfcStyledItem> styled_item = dynamic_pointer_cast<IfcStyledItem>( representationItem );
+			shared_ptr<IfcStyledItem> styled_item = entity_cast<IfcStyledItem>( representationItem );
 			if( styled_item )
 			{
 				continue;
 			}
 
-			shared_ptr<IfcTopologicalRepresentationItem> topo_item = dynamic_pointer_cast<IfcTopologicalRepresentationItem>( representationItem );
+			shared_ptr<IfcTopologicalRepresentationItem> topo_item = entity_cast<IfcTopologicalRepresentationItem>( representationItem );
 			if( topo_item )
 			{
 				shared_ptr<ItemShapeData> topological_item_data( new ItemShapeData() );
@@ -358,7 +359,7 @@ public:
 					std::vector<shared_ptr<IfcLayeredItem> >&	layerAssignedItems = layer_assignment->m_AssignedItems;
 					shared_ptr<IfcIdentifier>					layerID = layer_assignment->m_Identifier;				//optional
 
-					shared_ptr<IfcPresentationLayerWithStyle> layer_assignment_with_style = dynamic_pointer_cast<IfcPresentationLayerWithStyle>( layer_assignment );
+					shared_ptr<IfcPresentationLayerWithStyle> layer_assignment_with_style = entity_cast<IfcPresentationLayerWithStyle>( layer_assignment );
 					if( layer_assignment_with_style )
 					{
 						std::vector<shared_ptr<IfcPresentationStyle> >& vec_presentation_styles = layer_assignment_with_style->m_LayerStyles;
@@ -407,7 +408,7 @@ public:
 			}
 		}
 
-		shared_ptr<IfcFaceBasedSurfaceModel> surface_model = dynamic_pointer_cast<IfcFaceBasedSurfaceModel>( geom_item );
+		shared_ptr<IfcFaceBasedSurfaceModel> surface_model = entity_cast<IfcFaceBasedSurfaceModel>( geom_item );
 		if( surface_model )
 		{
 			std::vector<shared_ptr<IfcConnectedFaceSet> >& vec_face_sets = surface_model->m_FbsmFaces;
@@ -420,21 +421,21 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcBooleanResult> boolean_result = dynamic_pointer_cast<IfcBooleanResult>( geom_item );
+		shared_ptr<IfcBooleanResult> boolean_result = entity_cast<IfcBooleanResult>( geom_item );
 		if( boolean_result )
 		{
 			m_solid_converter->convertIfcBooleanResult( boolean_result, item_data );
 			return;
 		}
 		
-		shared_ptr<IfcSolidModel> solid_model = dynamic_pointer_cast<IfcSolidModel>( geom_item );
+		shared_ptr<IfcSolidModel> solid_model = entity_cast<IfcSolidModel>( geom_item );
 		if( solid_model )
 		{
 			m_solid_converter->convertIfcSolidModel( solid_model, item_data );
 			return;
 		}
 
-		shared_ptr<IfcShellBasedSurfaceModel> shell_based_surface_model = dynamic_pointer_cast<IfcShellBasedSurfaceModel>( geom_item );
+		shared_ptr<IfcShellBasedSurfaceModel> shell_based_surface_model = entity_cast<IfcShellBasedSurfaceModel>( geom_item );
 		if( shell_based_surface_model )
 		{
 			std::vector<shared_ptr<IfcShell> >& vec_shells = shell_based_surface_model->m_SbsmBoundary;
@@ -464,14 +465,14 @@ public:
 		double eps = m_geom_settings->getEpsilonMergePoints();
 		GeomProcessingParams params(m_geom_settings, geom_item.get(), this);
 
-		shared_ptr<IfcTessellatedItem> tessellatedItem = dynamic_pointer_cast<IfcTessellatedItem>(geom_item);
+		shared_ptr<IfcTessellatedItem> tessellatedItem = entity_cast<IfcTessellatedItem>( geom_item );
 		if( tessellatedItem )
 		{
 			m_solid_converter->convertTesselatedItem(tessellatedItem, item_data);
 			return;
 		}
 
-		shared_ptr<IfcSurface> ifc_surface = dynamic_pointer_cast<IfcSurface>( geom_item );
+		shared_ptr<IfcSurface> ifc_surface = entity_cast<IfcSurface>( geom_item );
 		if( ifc_surface )
 		{
 			shared_ptr<SurfaceProxy> surface_proxy;
@@ -479,7 +480,7 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcPolyline> poly_line = dynamic_pointer_cast<IfcPolyline>( geom_item );
+		shared_ptr<IfcPolyline> poly_line = entity_cast<IfcPolyline>( geom_item );
 		if( poly_line )
 		{
 			std::vector<vec3> poly_vertices;
@@ -500,7 +501,7 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcCurve> ifc_curve = dynamic_pointer_cast<IfcCurve>(geom_item);
+		shared_ptr<IfcCurve> ifc_curve = entity_cast<IfcCurve>( geom_item );
 		if (ifc_curve)
 		{
 			std::vector<vec3> loops;
@@ -523,7 +524,7 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcGeometricSet> geometric_set = dynamic_pointer_cast<IfcGeometricSet>( geom_item );
+		shared_ptr<IfcGeometricSet> geometric_set = entity_cast<IfcGeometricSet>( geom_item );
 		if( geometric_set )
 		{
 			// ENTITY IfcGeometricSet SUPERTYPE OF(IfcGeometricCurveSet)
@@ -575,7 +576,7 @@ public:
 				}
 			}
 
-			shared_ptr<IfcGeometricCurveSet> geometric_curve_set = dynamic_pointer_cast<IfcGeometricCurveSet>( geometric_set );
+			shared_ptr<IfcGeometricCurveSet> geometric_curve_set = entity_cast<IfcGeometricCurveSet>( geometric_set );
 			if( geometric_curve_set )
 			{
 				// no additional attributes
@@ -584,14 +585,14 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcSectionedSpine> sectioned_spine = dynamic_pointer_cast<IfcSectionedSpine>( geom_item );
+		shared_ptr<IfcSectionedSpine> sectioned_spine = entity_cast<IfcSectionedSpine>( geom_item );
 		if( sectioned_spine )
 		{
 			m_solid_converter->convertIfcSectionedSpine( sectioned_spine, item_data );
 			return;
 		}
 
-		shared_ptr<IfcTextLiteral> text_literal = dynamic_pointer_cast<IfcTextLiteral>( geom_item );
+		shared_ptr<IfcTextLiteral> text_literal = entity_cast<IfcTextLiteral>( geom_item );
 		if( text_literal )
 		{
 			// Literal		: 	IfcPresentableText;
@@ -635,7 +636,7 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcAnnotationFillArea> annotation_fill_area = dynamic_pointer_cast<IfcAnnotationFillArea>( geom_item );
+		shared_ptr<IfcAnnotationFillArea> annotation_fill_area = entity_cast<IfcAnnotationFillArea>( geom_item );
 		if( annotation_fill_area )
 		{
 			// convert outer boundary
@@ -674,11 +675,11 @@ public:
 			return;
 		}
 
-		shared_ptr<IfcPoint> ifc_point = dynamic_pointer_cast<IfcPoint>( geom_item );
+		shared_ptr<IfcPoint> ifc_point = entity_cast<IfcPoint>( geom_item );
 		if( ifc_point )
 		{
 			// ENTITY IfcPoint ABSTRACT SUPERTYPE OF( ONEOF ( IfcCartesianPoint, IfcPointOnCurve, IfcPointOnSurface ) )
-			shared_ptr<IfcCartesianPoint> ifc_cartesian_point = dynamic_pointer_cast<IfcCartesianPoint>( geom_item );
+			shared_ptr<IfcCartesianPoint> ifc_cartesian_point = entity_cast<IfcCartesianPoint>( geom_item );
 			if( ifc_cartesian_point )
 			{
 				vec3 point;
@@ -898,7 +899,8 @@ public:
 		}
 	}
 
-	void subtractOpeningFromProductShape(const shared_ptr<ItemShapeData>& productShapeItem, std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_opening_meshes, const shared_ptr<IfcElement>& ifc_element)
+	void subtractOpeningFromProductShape(const shared_ptr<ItemShapeData>& productShapeItem, std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_opening_meshes, const shared_ptr<IfcElement>& ifc_element,
+		CsgOperandCache& operandCache)
 	{
 		for (size_t i_product_meshset = 0; i_product_meshset < productShapeItem->m_meshsets.size(); ++i_product_meshset)
 		{
@@ -909,7 +911,7 @@ public:
 			GeomProcessingParams params(m_geom_settings);
 			params.callbackFunc = this;
 			params.ifc_entity = ifc_element.get();
-			CSG_Adapter::computeCSG(product_meshset, vec_opening_meshes, carve::csg::CSG::A_MINUS_B, params);
+			CSG_Adapter::computeCSG(product_meshset, vec_opening_meshes, carve::csg::CSG::A_MINUS_B, params, &operandCache);
 		}
 
 		for (const shared_ptr<ItemShapeData>& product_item_data : productShapeItem->m_child_items )
@@ -919,7 +921,7 @@ public:
 				continue;
 			}
 
-			subtractOpeningFromProductShape(product_item_data, vec_opening_meshes, ifc_element);
+			subtractOpeningFromProductShape(product_item_data, vec_opening_meshes, ifc_element, operandCache);
 		}
 	}
 
@@ -930,6 +932,7 @@ public:
 		{
 			return;
 		}
+		IFCPP_TRACE_SCOPE_ENTITY("subtract openings", ifc_element.get());
 
 		// convert opening representation
 		bool allOpeningsRelativeToProduct = true;
@@ -1041,7 +1044,9 @@ public:
 				}
 			}
 
-			subtractOpeningFromProductShape(productShapeItem, vec_opening_meshes, ifc_element);
+			// opening meshes are subtracted from all meshsets of the item, so their prepared copies are shared
+			CsgOperandCache operandCache;
+			subtractOpeningFromProductShape(productShapeItem, vec_opening_meshes, ifc_element, operandCache);
 
 			if (!allOpeningsRelativeToProduct)
 			{
@@ -1063,7 +1068,7 @@ public:
 	{
 		for (const shared_ptr<IfcRepresentationItem>& representationItem : ifcRepresentation->m_Items)
 		{
-			shared_ptr<IfcMappedItem> mapped = dynamic_pointer_cast<IfcMappedItem>(representationItem);
+			shared_ptr<IfcMappedItem> mapped = entity_cast<IfcMappedItem>( representationItem );
 			if (mapped)
 			{
 				if (mapped->m_MappingSource)
@@ -1078,7 +1083,7 @@ public:
 				}
 			}
 
-			shared_ptr<IfcBooleanResult> boolResult = dynamic_pointer_cast<IfcBooleanResult>(representationItem);
+			shared_ptr<IfcBooleanResult> boolResult = entity_cast<IfcBooleanResult>( representationItem );
 			if (boolResult)
 			{
 				return true;
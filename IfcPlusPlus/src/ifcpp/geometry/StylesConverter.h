@@ -90,6 +90,14 @@ public:
 		m_map_ifc_styles.clear();
 	}
 
+	/** \brief Approximate heap memory of the cached styles */
+	size_t getMemoryUsage()
+	{
+		std::lock_guard<std::mutex> lock(m_writelock_styles_converter);
+		// map node, shared_ptr control block and StyleData
+		return m_map_ifc_styles.size() * (sizeof(std::pair<const int, shared_ptr<StyleData> >) + 6 * sizeof(void*) + sizeof(StyleData));
+	}
+
 	static void convertIfcSpecularHighlightSelect(shared_ptr<IfcSpecularHighlightSelect> highlight_select, shared_ptr<StyleData>& style_data)
 	{
 		if (dynamic_pointer_cast<IfcSpecularExponent>(highlight_select))
@@ -17,6 +17,8 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <map>
+#include <tuple>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
 #include <earcut/include/mapbox/earcut.hpp>
@@ -24,6 +26,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "GeometryInputData.h"
 #include "GeomDebugDump.h"
 #include "CSG_Adapter.h"
+#include "MeshOps.h"
 
 class GeometrySettings;
 class UnitConverter;
@@ -37,6 +40,16 @@ public:
 	Sweeper(shared_ptr<GeometrySettings>& settings, shared_ptr<UnitConverter>& uc) : m_geom_settings(settings), m_unit_converter(uc) {}
 	virtual ~Sweeper(){}
 
+	/** Circle cross section of a swept disk in the local XY plane */
+	struct DiskCrossSection
+	{
+		std::vector<vec2> outer;
+		std::vector<vec2> inner;
+
+		/** Straight disk of length 1 along the negative local z axis, placed by a transform for straight bars. nullptr if it could not be created as closed mesh */
+		shared_ptr<carve::mesh::MeshSet<3> > straightMesh;
+	};
+
 	/*\brief Extrudes a set of cross sections along a direction
 	  \param[in] paths Set of cross sections to extrude
 	  \param[in] dir Extrusion vector
@@ -562,6 +575,11 @@ public:
 		vec3 local_z( carve::geom::VECTOR( 0, 0, 1 ) );
 		vec3 curve_point_first = curvePoints[0];
 		vec3 curve_point_second = curvePoints[1];
+		if( num_curvePoints == 2 && ( curve_point_second - curve_point_first ).length2() <= eps*eps )
+		{
+			messageCallback( "zero length sweep", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity );
+			return;
+		}
 
 		bool bend_found = false;
 		if( num_curvePoints > 3 )
@@ -643,7 +661,6 @@ public:
 		vec3  section_local_z = curve_point_first - curve_point_second;
 		vec3  section_local_x = carve::geom::cross( section_local_y, section_local_z );
 		section_local_y = carve::geom::cross( section_local_x, section_local_z );
-		std::vector<vec3> inner_shape_points;
 	
 		section_local_x.normalize();
 		section_local_y.normalize();
@@ -655,29 +672,57 @@ public:
 			section_local_x.z,		section_local_y.z,		section_local_z.z,	0,
 			0,				0,				0,			1 );
 
-		double angle = 0;
-		double delta_angle = 2.0*M_PI/double(nvc);	// TODO: adapt to model size and complexity
-		std::vector<vec3> circle_points(nvc);
-		std::vector<vec3> circle_points_inner(nvc);
-		for( size_t ii = 0; ii < nvc; ++ii )
+		shared_ptr<DiskCrossSection> cross_section = getDiskCrossSection( nvc, radius, use_radius_inner, eps );
+		const bool with_inner = use_radius_inner > 0;
+
+		// the axes are not unit vectors if the bar is parallel to local_z. Then the general sweep below is used, which validates its mesh in addClosedPolyhedron
+		const bool axes_valid = std::abs( section_local_x.length2() - 1.0 ) < eps && std::abs( section_local_y.length2() - 1.0 ) < eps;
+		if( num_curvePoints == 2 && cross_section->straightMesh && axes_valid )
 		{
-			// cross section (circle) is defined in XY plane
-			double x = sin(angle);
-			double y = cos(angle);
-			vec3 vertex( carve::geom::VECTOR( x*radius, y*radius, 0.0 ) );
-			vertex = matrix_first_direction*vertex + curve_point_first;
-			circle_points[ii] = vertex;
+			// straight bar: place the shared unit length disk instead of sweeping the cross section
+			carve::math::Matrix placement = carve::math::Matrix(
+				section_local_x.x,		section_local_y.x,		curve_point_first.x - curve_point_second.x,	curve_point_first.x,
+				section_local_x.y,		section_local_y.y,		curve_point_first.y - curve_point_second.y,	curve_point_first.y,
+				section_local_x.z,		section_local_y.z,		curve_point_first.z - curve_point_second.z,	curve_point_first.z,
+				0,				0,				0,			1 );
+
+			shared_ptr<carve::mesh::MeshSet<3> > meshset( cross_section->straightMesh->clone() );
+			VertexTransform::transformVertices( meshset->vertex_storage, placement, VertexTransform::MATRIX_GENERAL );
+			for( size_t ii = 0; ii < meshset->meshes.size(); ++ii )
+			{
+				meshset->meshes[ii]->recalc( eps );
+			}
 
-			if( use_radius_inner > 0 )
+			// if the placed disk is not valid, sweep the cross section below, which repairs or rejects the mesh
+			MeshSetInfo infoMesh;
+			if( MeshOps::checkMeshSetValidAndClosed( meshset, infoMesh, params ) )
 			{
-				vec3 vertex_inner( carve::geom::VECTOR( x*use_radius_inner, y*use_radius_inner, 0.0 ) );
-				vertex_inner = matrix_first_direction*vertex_inner + curve_point_first;
-				circle_points_inner[ii] = vertex_inner;
+				itemData->m_meshsets.push_back( meshset );
+				return;
 			}
-			angle += delta_angle;
+		}
+
+		// current cross section in global coordinates, outer circle followed by inner circle
+		const size_t num_ring_points = with_inner ? 2*nvc : nvc;
+		std::vector<double> ring_x( num_ring_points );
+		std::vector<double> ring_y( num_ring_points );
+		std::vector<double> ring_z( num_ring_points );
+		for( size_t jj = 0; jj < num_ring_points; ++jj )
+		{
+			const vec2& point2d = jj < nvc ? cross_section->outer[jj] : cross_section->inner[jj - nvc];
+			vec3 vertex = matrix_first_direction*carve::geom::VECTOR( point2d.x, point2d.y, 0.0 ) + curve_point_first;
+			ring_x[jj] = vertex.x;
+			ring_y[jj] = vertex.y;
+			ring_z[jj] = vertex.z;
 		}
 
 		shared_ptr<carve::input::PolyhedronData> poly_data( new carve::input::PolyhedronData() );
+		poly_data->reserveVertices( int(num_curvePoints*num_ring_points) );
+		std::vector<vec3> inner_shape_points;
+		if( with_inner )
+		{
+			inner_shape_points.reserve( num_curvePoints*nvc );
+		}
 		
 		for( size_t ii = 0; ii<num_curvePoints; ++ii )
 		{
@@ -709,27 +754,9 @@ public:
 			GeomUtils::bisectingPlane( vertex_before, vertex_current, vertex_next, bisecting_normal, eps );
 
 			vec3 section1 = vertex_current - vertex_before;
-			vec3 section2 = vertex_next - vertex_current;
-			if (section1.length2() > eps)
+			if( section1.length2() > eps )
 			{
 				section1.normalize();
-				if (section2.length2() > eps)
-				{
-					section2.normalize();
-					double dot_product = dot(section1, section2);
-					double dot_product_abs = std::abs(dot_product);
-
-					if (dot_product_abs < (1.0-eps) || dot_product_abs >(1.0+eps))
-					{
-						// bend found, compute next local z vector
-						vec3 lateral_vec = cross(section1, section2);
-						if (lateral_vec.length2() > eps)
-						{
-							local_z = cross(lateral_vec, section1);
-							local_z.normalize();
-						}
-					}
-				}
 			}
 
 			if( ii == num_curvePoints -1 )
@@ -738,52 +765,90 @@ public:
 			}
 
 			carve::geom::plane<3> bisecting_plane( bisecting_normal, vertex_current );
-			for( size_t jj = 0; jj < nvc; ++jj )
+			if( !projectRingOntoPlane( bisecting_plane, section1, ring_x.data(), ring_y.data(), ring_z.data(), num_ring_points, eps ) )
 			{
-				vec3& vertex = circle_points[jj];
-
-				vec3 v;
-				double t;
-				carve::IntersectionClass intersect = carve::geom3d::rayPlaneIntersection( bisecting_plane, vertex, vertex + section1, v, t, eps);
-				if( intersect > 0 )
-				{
-					vertex = v;
-				}
-				else
-				{
-					messageCallback( "no intersection found", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity );
-				}
-
-				poly_data->addVertex( vertex );
+				messageCallback( "no intersection found", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity );
 			}
 
-			if( use_radius_inner > 0 )
+			for( size_t jj = 0; jj < nvc; ++jj )
 			{
-				for( size_t jj = 0; jj < nvc; ++jj )
-				{
-					vec3& vertex = circle_points_inner[jj];
-					
-					vec3 v;
-					double t;
-					carve::IntersectionClass intersect = carve::geom3d::rayPlaneIntersection( bisecting_plane, vertex, vertex + section1, v, t, eps);
-					if( intersect > 0 )
-					{
-						vertex = v;
-					}
-					else
-					{
-						messageCallback( "no intersection found", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity );
-					}
+				poly_data->addVertex( carve::geom::VECTOR( ring_x[jj], ring_y[jj], ring_z[jj] ) );
+			}
 
-					//inner_shape_points[jj] = vertex;
-					inner_shape_points.push_back( vertex );
-				}
+			for( size_t jj = nvc; jj < num_ring_points; ++jj )
+			{
+				inner_shape_points.push_back( carve::geom::VECTOR( ring_x[jj], ring_y[jj], ring_z[jj] ) );
 			}
 		}
 
+		// add points for inner shape
+		for( size_t i=0; i<inner_shape_points.size(); ++i )
+		{
+			poly_data->addVertex( inner_shape_points[i] );
+		}
+
+		addDiskFaces( *poly_data, num_curvePoints, nvc, with_inner );
+
+		try
+		{
+			itemData->addClosedPolyhedron( poly_data, params );
+		}
+		catch( BuildingException& exception )
+		{
+			messageCallback( exception.what(), StatusCallback::MESSAGE_TYPE_WARNING, "", params.ifc_entity );  // calling function already in e.what()
+#ifdef _DEBUG
+			shared_ptr<carve::mesh::MeshSet<3> > meshset( poly_data->createMesh( carve::input::opts(), eps ) );
+			vec4 color( 0.7, 0.7, 0.7, 1.0 );
+			bool drawNormals = true;
+			GeomDebugDump::dumpMeshset( meshset, color, drawNormals, true );
+#endif
+		}
+
+	#ifdef _DEBUG
+		shared_ptr<carve::mesh::MeshSet<3> > meshset( poly_data->createMesh(carve::input::opts(), eps) );
+		MeshSetInfo infoMesh( this, params.ifc_entity );
+		MeshOps::checkMeshSetValidAndClosed( meshset, infoMesh, params);
+	#endif
+	}
+
+	/*\brief Moves the points of a cross section along a direction onto a plane.
+	  Coordinates are passed as separate arrays, so that the loop can be vectorized.
+	  \return false if the direction is parallel to the plane. The points are not changed in that case
+	**/
+	static bool projectRingOntoPlane( const carve::geom::plane<3>& plane, const vec3& direction, double* x, double* y, double* z, const size_t num_points, const double eps )
+	{
+		const double dot_normal_direction = dot( plane.N, direction );
+		if( carve::math::ZERO( dot_normal_direction, eps ) )
+		{
+			return false;
+		}
+
+		const double nx = plane.N.x;
+		const double ny = plane.N.y;
+		const double nz = plane.N.z;
+		const double d = plane.d;
+		const double dx = direction.x;
+		const double dy = direction.y;
+		const double dz = direction.z;
+		for( size_t ii = 0; ii < num_points; ++ii )
+		{
+			const double t = -( nx*x[ii] + ny*y[ii] + nz*z[ii] + d ) / dot_normal_direction;
+			x[ii] += t*dx;
+			y[ii] += t*dy;
+			z[ii] += t*dz;
+		}
+		return true;
+	}
+
+	/*\brief Adds the faces of a swept disk. Vertices are expected as num_rings outer circles, followed by num_rings inner circles if with_inner is set
+	**/
+	static void addDiskFaces( carve::input::PolyhedronData& poly_data, const size_t num_rings, const size_t nvc, const bool with_inner )
+	{
+		const size_t num_vertices_outer = num_rings*nvc;
+		poly_data.reserveFaces( int(( with_inner ? 4 : 2 )*num_rings*nvc), 3 );
+
 		// outer shape
-		size_t num_vertices_outer = poly_data->getVertexCount();
-		for( size_t i=0; i<num_curvePoints- 1; ++i )
+		for( size_t i=0; i<num_rings- 1; ++i )
 		{
 			size_t i_offset = i*nvc;
 			size_t i_offset_next = ( i + 1 )*nvc;
@@ -794,32 +859,15 @@ public:
 
 				size_t next_loop_pt1 = jj + i_offset_next;
 				size_t next_loop_pt2 = ( jj + 1 ) % nvc + i_offset_next;
-#ifdef _DEBUG
-				if( current_loop_pt1 >= num_vertices_outer || current_loop_pt2 >= num_vertices_outer || next_loop_pt1 >= num_vertices_outer || next_loop_pt2 >= num_vertices_outer )
-				{
-					std::cout << "current_loop_pt1 >= num_vertices_outer" << std::endl;
-				}
-#endif
-				poly_data->addFace( current_loop_pt1,	next_loop_pt1,		next_loop_pt2 );
-				poly_data->addFace( next_loop_pt2,		current_loop_pt2,	current_loop_pt1  );
+				poly_data.addFace( current_loop_pt1,	next_loop_pt1,		next_loop_pt2 );
+				poly_data.addFace( next_loop_pt2,		current_loop_pt2,	current_loop_pt1  );
 			}
 		}
 
-		if( use_radius_inner > 0 )
+		if( with_inner )
 		{
-			if( inner_shape_points.size() != num_vertices_outer )
-			{
-				messageCallback( "inner_shape_points.size() != num_vertices_outer", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity );
-			}
-
-			// add points for inner shape
-			for( size_t i=0; i<inner_shape_points.size(); ++i )
-			{
-				poly_data->addVertex( inner_shape_points[i] );
-			}
-
 			// faces of inner shape
-			for( size_t i=0; i<num_curvePoints- 1; ++i )
+			for( size_t i=0; i<num_rings- 1; ++i )
 			{
 				size_t i_offset = i*nvc + num_vertices_outer;
 				size_t i_offset_next = ( i + 1 )*nvc + num_vertices_outer;
@@ -831,8 +879,8 @@ public:
 					size_t next_loop_pt1 = jj + i_offset_next;
 					size_t next_loop_pt2 = ( jj + 1 ) % nvc + i_offset_next;
 
-					poly_data->addFace( current_loop_pt1,	current_loop_pt2,	next_loop_pt2 );
-					poly_data->addFace( next_loop_pt2,		next_loop_pt1,		current_loop_pt1  );
+					poly_data.addFace( current_loop_pt1,	current_loop_pt2,	next_loop_pt2 );
+					poly_data.addFace( next_loop_pt2,		next_loop_pt1,		current_loop_pt1  );
 				}
 			}
 
@@ -842,63 +890,103 @@ public:
 				size_t outer_rim_next = ( jj + 1 ) % nvc;
 				size_t inner_rim_next = outer_rim_next + num_vertices_outer;
 
-				poly_data->addFace( jj,					outer_rim_next,		num_vertices_outer+jj );
-				poly_data->addFace( outer_rim_next,		inner_rim_next,		num_vertices_outer+jj );
+				poly_data.addFace( jj,					outer_rim_next,		num_vertices_outer+jj );
+				poly_data.addFace( outer_rim_next,		inner_rim_next,		num_vertices_outer+jj );
 			}
 
 			// back cap
-			size_t back_offset = ( num_curvePoints - 1 )*nvc;
+			size_t back_offset = ( num_rings - 1 )*nvc;
 			for( size_t jj = 0; jj < nvc; ++jj )
 			{
 				size_t outer_rim_next = ( jj + 1 ) % nvc + back_offset;
 				size_t inner_rim_next = outer_rim_next + num_vertices_outer;
 
-				poly_data->addFace( jj+back_offset,		num_vertices_outer+jj+back_offset,	outer_rim_next );
-				poly_data->addFace( outer_rim_next,		num_vertices_outer+jj+back_offset,	inner_rim_next );
+				poly_data.addFace( jj+back_offset,		num_vertices_outer+jj+back_offset,	outer_rim_next );
+				poly_data.addFace( outer_rim_next,		num_vertices_outer+jj+back_offset,	inner_rim_next );
 			}
 		}
 		else
 		{
-#ifdef _DEBUG
-			if( nvc >= num_vertices_outer )
-			{
-				std::cout << "nvc >= num_vertices_outer" << std::endl;
-			}
-#endif
 			// front cap, full pipe, create triangle fan
 			for( size_t jj = 0; jj < nvc - 2; ++jj )
 			{
-				poly_data->addFace( 0, jj+1, jj+2 );
+				poly_data.addFace( 0, jj+1, jj+2 );
 			}
 
 			// back cap
-			size_t back_offset = ( num_curvePoints - 1 )*nvc;
+			size_t back_offset = ( num_rings - 1 )*nvc;
 			for( size_t jj = 0; jj < nvc - 2; ++jj )
 			{
-				poly_data->addFace( back_offset, back_offset+jj+2, back_offset+jj+1 );
+				poly_data.addFace( back_offset, back_offset+jj+2, back_offset+jj+1 );
 			}
 		}
+	}
 
-		try
+	/*\brief Returns the cross section of a swept disk with the given radii.
+	  Reinforcement models contain large numbers of bars with the same diameter, so cross sections are shared. Geometry conversion runs per product in parallel, so each thread has its own cache
+	**/
+	static shared_ptr<DiskCrossSection> getDiskCrossSection( const size_t nvc, const double radius, const double radius_inner, const double eps )
+	{
+		static thread_local std::map<std::tuple<size_t, double, double, double>, shared_ptr<DiskCrossSection> > tl_cross_sections;
+		static const size_t MAX_NUM_CACHED_CROSS_SECTIONS = 256;
+
+		std::tuple<size_t, double, double, double> key( nvc, radius, radius_inner, eps );
+		auto it = tl_cross_sections.find( key );
+		if( it != tl_cross_sections.end() )
 		{
-			itemData->addClosedPolyhedron( poly_data, params );
+			return it->second;
 		}
-		catch( BuildingException& exception )
+
+		shared_ptr<DiskCrossSection> cross_section( new DiskCrossSection() );
+		const bool with_inner = radius_inner > 0;
+		cross_section->outer.resize( nvc );
+		if( with_inner )
 		{
-			messageCallback( exception.what(), StatusCallback::MESSAGE_TYPE_WARNING, "", params.ifc_entity );  // calling function already in e.what()
-#ifdef _DEBUG
-			shared_ptr<carve::mesh::MeshSet<3> > meshset( poly_data->createMesh( carve::input::opts(), eps ) );
-			vec4 color( 0.7, 0.7, 0.7, 1.0 );
-			bool drawNormals = true;
-			GeomDebugDump::dumpMeshset( meshset, color, drawNormals, true );
-#endif
+			cross_section->inner.resize( nvc );
 		}
 
-	#ifdef _DEBUG
-		shared_ptr<carve::mesh::MeshSet<3> > meshset( poly_data->createMesh(carve::input::opts(), eps) );
-		MeshSetInfo infoMesh( this, params.ifc_entity );
-		MeshOps::checkMeshSetValidAndClosed( meshset, infoMesh, params);
-	#endif
+		double angle = 0;
+		double delta_angle = 2.0*M_PI/double(nvc);	// TODO: adapt to model size and complexity
+		for( size_t ii = 0; ii < nvc; ++ii )
+		{
+			// cross section (circle) is defined in XY plane
+			double x = sin(angle);
+			double y = cos(angle);
+			cross_section->outer[ii] = carve::geom::VECTOR( x*radius, y*radius );
+			if( with_inner )
+			{
+				cross_section->inner[ii] = carve::geom::VECTOR( x*radius_inner, y*radius_inner );
+			}
+			angle += delta_angle;
+		}
+
+		// straight disk from z=0 to z=-1, in the same vertex order as the swept result
+		shared_ptr<carve::input::PolyhedronData> poly_data( new carve::input::PolyhedronData() );
+		const std::vector<vec2>* rings[2] = { &cross_section->outer, &cross_section->inner };
+		for( size_t i_ring = 0; i_ring < ( with_inner ? 2 : 1 ); ++i_ring )
+		{
+			for( double z : { 0.0, -1.0 } )
+			{
+				for( const vec2& point2d : *rings[i_ring] )
+				{
+					poly_data->addVertex( carve::geom::VECTOR( point2d.x, point2d.y, z ) );
+				}
+			}
+		}
+		addDiskFaces( *poly_data, 2, nvc, with_inner );
+
+		shared_ptr<carve::mesh::MeshSet<3> > meshset( poly_data->createMesh( carve::input::opts(), eps ) );
+		if( meshset->isClosed() && meshset->vertex_storage.size() == poly_data->getVertexCount() )
+		{
+			cross_section->straightMesh = meshset;
+		}
+
+		if( tl_cross_sections.size() >= MAX_NUM_CACHED_CROSS_SECTIONS )
+		{
+			tl_cross_sections.clear();
+		}
+		tl_cross_sections[key] = cross_section;
+		return cross_section;
 	}
 
 	void findEnclosedLoops(const std::vector<std::vector<vec2> >& faceLoopsInput, std::vector<std::vector<std::vector<vec2> > >& profile_paths_enclosed, double eps)
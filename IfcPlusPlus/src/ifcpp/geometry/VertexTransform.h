@@ -0,0 +1,202 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "IncludeCarveHeaders.h"
+
+#if defined(__AVX2__) || defined(__AVX__)
+	#include <immintrin.h>
+	#define IFCPP_VERTEX_TRANSFORM_AVX
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#include <arm_neon.h>
+	#define IFCPP_VERTEX_TRANSFORM_NEON
+#endif
+
+namespace VertexTransform
+{
+	enum MatrixType
+	{
+		MATRIX_IDENTITY,
+		MATRIX_TRANSLATION,
+		MATRIX_GENERAL
+	};
+
+	/** Number of points that are gathered into the structure-of-arrays block before the matrix is applied */
+	static const size_t BLOCK_SIZE = 256;
+
+	/** Cheap classification of a placement matrix, so that identity and pure translation transforms can skip the full 4x4 multiplication.
+	* Identity uses the same tolerance as GeomUtils::isMatrixIdentity. Translation requires an exact unit 3x3 part, otherwise rotations close to identity would be lost on large coordinates. */
+	inline MatrixType classifyMatrix(const carve::math::Matrix& mat, double eps = 0.00001)
+	{
+		// projective part, not used for placements
+		if (mat._14 != 0.0 || mat._24 != 0.0 || mat._34 != 0.0 || mat._44 != 1.0)
+		{
+			if (std::abs(mat._14) > eps || std::abs(mat._24) > eps || std::abs(mat._34) > eps || std::abs(mat._44 - 1.0) > eps)
+			{
+				return MATRIX_GENERAL;
+			}
+		}
+
+		bool linearPartIsUnit = mat._11 == 1.0 && mat._22 == 1.0 && mat._33 == 1.0
+			&& mat._12 == 0.0 && mat._13 == 0.0 && mat._21 == 0.0 && mat._23 == 0.0 && mat._31 == 0.0 && mat._32 == 0.0;
+
+		if (!linearPartIsUnit)
+		{
+			bool linearPartIsNearUnit = std::abs(mat._11 - 1.0) <= eps && std::abs(mat._22 - 1.0) <= eps && std::abs(mat._33 - 1.0) <= eps
+				&& std::abs(mat._12) <= eps && std::abs(mat._13) <= eps && std::abs(mat._21) <= eps
+				&& std::abs(mat._23) <= eps && std::abs(mat._31) <= eps && std::abs(mat._32) <= eps;
+			if (linearPartIsNearUnit && std::abs(mat._41) <= eps && std::abs(mat._42) <= eps && std::abs(mat._43) <= eps)
+			{
+				return MATRIX_IDENTITY;
+			}
+			return MATRIX_GENERAL;
+		}
+
+		if (std::abs(mat._41) <= eps && std::abs(mat._42) <= eps && std::abs(mat._43) <= eps)
+		{
+			return MATRIX_IDENTITY;
+		}
+		return MATRIX_TRANSLATION;
+	}
+
+	/** Is negative if the coordinate system changes handedness (for example as result of mirroring) */
+	inline bool isMatrixMirroring(const carve::math::Matrix& mat)
+	{
+		return 0 > carve::geom::dotcross(
+			carve::geom::VECTOR(mat.m[0][0], mat.m[1][0], mat.m[2][0]),
+			carve::geom::VECTOR(mat.m[0][1], mat.m[1][1], mat.m[2][1]),
+			carve::geom::VECTOR(mat.m[0][2], mat.m[1][2], mat.m[2][2]));
+	}
+
+	/** Applies the affine part of mat to n points, given as separate x, y, z arrays */
+	inline void transformPointsSoA(const carve::math::Matrix& mat, double* x, double* y, double* z, size_t n)
+	{
+		size_t ii = 0;
+#if defined(IFCPP_VERTEX_TRANSFORM_AVX)
+		const __m256d m11 = _mm256_set1_pd(mat._11), m21 = _mm256_set1_pd(mat._21), m31 = _mm256_set1_pd(mat._31), m41 = _mm256_set1_pd(mat._41);
+		const __m256d m12 = _mm256_set1_pd(mat._12), m22 = _mm256_set1_pd(mat._22), m32 = _mm256_set1_pd(mat._32), m42 = _mm256_set1_pd(mat._42);
+		const __m256d m13 = _mm256_set1_pd(mat._13), m23 = _mm256_set1_pd(mat._23), m33 = _mm256_set1_pd(mat._33), m43 = _mm256_set1_pd(mat._43);
+		for (; ii + 4 <= n; ii += 4)
+		{
+			const __m256d px = _mm256_loadu_pd(x + ii);
+			const __m256d py = _mm256_loadu_pd(y + ii);
+			const __m256d pz = _mm256_loadu_pd(z + ii);
+
+			// same evaluation order as carve::math::operator*, so that results do not depend on the code path
+			__m256d rx = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m11, px), _mm256_mul_pd(m21, py)), _mm256_mul_pd(m31, pz)), m41);
+			__m256d ry = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m12, px), _mm256_mul_pd(m22, py)), _mm256_mul_pd(m32, pz)), m42);
+			__m256d rz = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m13, px), _mm256_mul_pd(m23, py)), _mm256_mul_pd(m33, pz)), m43);
+			_mm256_storeu_pd(x + ii, rx);
+			_mm256_storeu_pd(y + ii, ry);
+			_mm256_storeu_pd(z + ii, rz);
+		}
+#elif defined(IFCPP_VERTEX_TRANSFORM_NEON)
+		const float64x2_t m11 = vdupq_n_f64(mat._11), m21 = vdupq_n_f64(mat._21), m31 = vdupq_n_f64(mat._31), m41 = vdupq_n_f64(mat._41);
+		const float64x2_t m12 = vdupq_n_f64(mat._12), m22 = vdupq_n_f64(mat._22), m32 = vdupq_n_f64(mat._32), m42 = vdupq_n_f64(mat._42);
+		const float64x2_t m13 = vdupq_n_f64(mat._13), m23 = vdupq_n_f64(mat._23), m33 = vdupq_n_f64(mat._33), m43 = vdupq_n_f64(mat._43);
+		for (; ii + 2 <= n; ii += 2)
+		{
+			const float64x2_t px = vld1q_f64(x + ii);
+			const float64x2_t py = vld1q_f64(y + ii);
+			const float64x2_t pz = vld1q_f64(z + ii);
+
+			float64x2_t rx = vaddq_f64(vaddq_f64(vaddq_f64(vmulq_f64(m11, px), vmulq_f64(m21, py)), vmulq_f64(m31, pz)), m41);
+			float64x2_t ry = vaddq_f64(vaddq_f64(vaddq_f64(vmulq_f64(m12, px), vmulq_f64(m22, py)), vmulq_f64(m32, pz)), m42);
+			float64x2_t rz = vaddq_f64(vaddq_f64(vaddq_f64(vmulq_f64(m13, px), vmulq_f64(m23, py)), vmulq_f64(m33, pz)), m43);
+			vst1q_f64(x + ii, rx);
+			vst1q_f64(y + ii, ry);
+			vst1q_f64(z + ii, rz);
+		}
+#endif
+		for (; ii < n; ++ii)
+		{
+			const double px = x[ii];
+			const double py = y[ii];
+			const double pz = z[ii];
+			x[ii] = mat._11 * px + mat._21 * py + mat._31 * pz + mat._41;
+			y[ii] = mat._12 * px + mat._22 * py + mat._32 * pz + mat._42;
+			z[ii] = mat._13 * px + mat._23 * py + mat._33 * pz + mat._43;
+		}
+	}
+
+	/** Gathers the points of a container in blocks into contiguous arrays, transforms them, and scatters them back.
+	* getPoint(i) has to return a reference to the i-th point. */
+	template<typename TGetPoint>
+	inline void transformPointRange(size_t numPoints, const carve::math::Matrix& mat, MatrixType matrixType, TGetPoint getPoint)
+	{
+		if (matrixType == MATRIX_IDENTITY)
+		{
+			return;
+		}
+
+		if (matrixType == MATRIX_TRANSLATION)
+		{
+			const double tx = mat._41;
+			const double ty = mat._42;
+			const double tz = mat._43;
+			for (size_t ii = 0; ii < numPoints; ++ii)
+			{
+				vec3& point = getPoint(ii);
+				point.x += tx;
+				point.y += ty;
+				point.z += tz;
+			}
+			return;
+		}
+
+		alignas(32) double x[BLOCK_SIZE];
+		alignas(32) double y[BLOCK_SIZE];
+		alignas(32) double z[BLOCK_SIZE];
+
+		for (size_t blockBegin = 0; blockBegin < numPoints; blockBegin += BLOCK_SIZE)
+		{
+			const size_t blockSize = std::min(BLOCK_SIZE, numPoints - blockBegin);
+			for (size_t jj = 0; jj < blockSize; ++jj)
+			{
+				const vec3& point = getPoint(blockBegin + jj);
+				x[jj] = point.x;
+				y[jj] = point.y;
+				z[jj] = point.z;
+			}
+
+			transformPointsSoA(mat, x, y, z, blockSize);
+
+			for (size_t jj = 0; jj < blockSize; ++jj)
+			{
+				vec3& point = getPoint(blockBegin + jj);
+				point.x = x[jj];
+				point.y = y[jj];
+				point.z = z[jj];
+			}
+		}
+	}
+
+	inline void transformPoints(std::vector<vec3>& points, const carve::math::Matrix& mat, MatrixType matrixType)
+	{
+		vec3* data = points.data();
+		transformPointRange(points.size(), mat, matrixType, [data](size_t ii) -> vec3& { return data[ii]; });
+	}
+
+	inline void transformVertices(std::vector<carve::mesh::Vertex<3> >& vertices, const carve::math::Matrix& mat, MatrixType matrixType)
+	{
+		carve::mesh::Vertex<3>* data = vertices.data();
+		transformPointRange(vertices.size(), mat, matrixType, [data](size_t ii) -> vec3& { return data[ii].v; });
+	}
+}
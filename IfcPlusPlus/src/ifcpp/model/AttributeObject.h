@@ -99,3 +99,86 @@ public:
 	void getStepParameter( std::stringstream& /*stream*/, bool /*is_select_type = false*/, size_t /*precision*/ ) const override{}
 	const char* m_value;
 };
+
+/** \brief Read-only view of a list attribute, for example std::vector<shared_ptr<IfcCartesianPoint> >. The list is not copied. */
+class AttributeListView
+{
+public:
+	virtual ~AttributeListView() = default;
+	virtual size_t size() const = 0;
+
+	/** Element i, or nullptr for an empty element or an expired inverse reference */
+	virtual BuildingObject* at( size_t i ) const = 0;
+	virtual shared_ptr<BuildingObject> sharedAt( size_t i ) const = 0;
+};
+
+template<typename T>
+class AttributeVectorView : public AttributeListView
+{
+public:
+	explicit AttributeVectorView( const std::vector<shared_ptr<T> >& vec ) : m_vec( vec ) {}
+	size_t size() const override { return m_vec.size(); }
+	BuildingObject* at( size_t i ) const override { return m_vec[i].get(); }
+	shared_ptr<BuildingObject> sharedAt( size_t i ) const override { return m_vec[i]; }
+
+private:
+	const std::vector<shared_ptr<T> >& m_vec;
+};
+
+template<typename T>
+class AttributeInverseVectorView : public AttributeListView
+{
+public:
+	explicit AttributeInverseVectorView( const std::vector<weak_ptr<T> >& vec ) : m_vec( vec ) {}
+	size_t size() const override { return m_vec.size(); }
+	BuildingObject* at( size_t i ) const override { return m_vec[i].lock().get(); }
+	shared_ptr<BuildingObject> sharedAt( size_t i ) const override { return m_vec[i].lock(); }
+
+private:
+	const std::vector<weak_ptr<T> >& m_vec;
+};
+
+/** \brief Read-only view of a list of lists attribute, for example the control points of IfcBSplineSurface */
+class AttributeList2DView
+{
+public:
+	virtual ~AttributeList2DView() = default;
+	virtual size_t size() const = 0;
+	virtual size_t size( size_t i ) const = 0;
+	virtual BuildingObject* at( size_t i, size_t j ) const = 0;
+	virtual shared_ptr<BuildingObject> sharedAt( size_t i, size_t j ) const = 0;
+};
+
+template<typename T>
+class AttributeVector2DView : public AttributeList2DView
+{
+public:
+	explicit AttributeVector2DView( const std::vector<std::vector<shared_ptr<T> > >& vec ) : m_vec( vec ) {}
+	size_t size() const override { return m_vec.size(); }
+	size_t size( size_t i ) const override { return m_vec[i].size(); }
+	BuildingObject* at( size_t i, size_t j ) const override { return m_vec[i][j].get(); }
+	shared_ptr<BuildingObject> sharedAt( size_t i, size_t j ) const override { return m_vec[i][j]; }
+
+private:
+	const std::vector<std::vector<shared_ptr<T> > >& m_vec;
+};
+
+/** \brief Receives the attributes of an entity from BuildingEntity::visitAttributes and visitAttributesInverse, without wrapping them in attribute objects.
+*
+* index is the position of the attribute in the STEP line (for inverse attributes the position among the inverse attributes), including inherited attributes. Names are static strings.
+* Attributes are visited in the same order as getAttributes and getAttributesInverse. The views are only valid during the call.
+*/
+class AttributeVisitor
+{
+public:
+	virtual ~AttributeVisitor() = default;
+
+	/** Single entity, type or select attribute. value is empty if an optional attribute is not set */
+	virtual void visitObject( size_t /*index*/, const char* /*name*/, const shared_ptr<BuildingObject>& /*value*/ ) {}
+	virtual void visitList( size_t /*index*/, const char* /*name*/, const AttributeListView& /*list*/ ) {}
+	virtual void visitList2D( size_t /*index*/, const char* /*name*/, const AttributeList2DView& /*list*/ ) {}
+
+	/** Attributes that are stored as plain values in the entity, for example the exponents of IfcDimensionalExponents or the coordinates of IfcCartesianPoint */
+	virtual void visitInteger( size_t /*index*/, const char* /*name*/, int /*value*/ ) {}
+	virtual void visitReals( size_t /*index*/, const char* /*name*/, const double* /*values*/, size_t /*size*/ ) {}
+};
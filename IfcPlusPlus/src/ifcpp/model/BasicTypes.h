@@ -18,20 +18,9 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #pragma once
 #pragma warning( disable: 4305 )
 
-#if __has_include(<version>)
-#include <version>
-#endif
-
-#ifdef __cpp_lib_execution
-	#include <execution>
-	#if defined(_DEBUG_LOOP_SEQENTIAL) || defined(_DEBUG)
-		#define FOR_EACH_LOOP std::for_each( std::execution::seq,
-	#else
-		#define FOR_EACH_LOOP std::for_each( std::execution::par,
-	#endif
-#else
-	#define FOR_EACH_LOOP std::for_each(
-#endif
+// Deprecated, use Executor::forEach. Runs the loop on Executor::getDefault(), needs random access iterators and "ifcpp/model/Executor.h" where it is used:
+// FOR_EACH_LOOP vec.begin(), vec.end(), [&](auto& item) { ... } );
+#define FOR_EACH_LOOP Executor::getDefault()->forEach(
 
 // don't use glm::vec4, because it's x,y,z,w members depend on some defines, which can lead to lost colors
 struct vec4
@@ -41,7 +30,13 @@ struct vec4
 	float r, g, b, a;
 };
 
-#define BuildingModelMapType std::unordered_map
+#include <type_traits>
+#include <unordered_map>
+#include "DenseIdMap.h"
+
+// maps with STEP ids as key use the dense id map, all others a hash map
+template<typename Key, typename T>
+using BuildingModelMapType = typename std::conditional<std::is_same<Key, int>::value, DenseIdMap<int, T>, std::unordered_map<Key, T> >::type;
 
 #if _MSC_VER >= 1600
 
@@ -16,9 +16,11 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 */
 
 #pragma warning( disable: 4996 )
+#include <algorithm>
 #include <iostream>
 #include <ctime>
 #include <memory>
+#include <set>
 
 #include "IfcApplication.h"
 #include "IfcAxis2Placement.h"
@@ -41,13 +43,18 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "IfcOwnerHistory.h"
 #include "IfcPerson.h"
 #include "IfcPersonAndOrganization.h"
+#include "IfcPhysicalQuantity.h"
 #include "IfcPlaneAngleMeasure.h"
 #include "IfcProduct.h"
 #include "IfcProject.h"
+#include "IfcPropertyAbstraction.h"
+#include "IfcPropertyDefinition.h"
 #include "IfcReal.h"
 #include "IfcRelationship.h"
 #include "IfcRelAggregates.h"
 #include "IfcRelContainedInSpatialStructure.h"
+#include "IfcRelDefinesByProperties.h"
+#include "IfcRelDefinesByTemplate.h"
 #include "IfcSite.h"
 #include "IfcSIUnit.h"
 #include "IfcSIUnitName.h"
@@ -57,6 +64,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "IfcUnitEnum.h"
 #include "IfcValue.h"
 #include "ifcpp/IFC4X3/EntityFactory.h"
+#include "ifcpp/reader/ReaderSTEP.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
 
@@ -64,12 +72,14 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "BuildingGuid.h"
 #include "BuildingException.h"
 #include "BuildingModel.h"
+#include "Trace.h"
 #include "UnitConverter.h"
 
 using namespace IFC4X3;
 
-BuildingModel::BuildingModel()
+BuildingModel::BuildingModel(EntityMapStorageEnum entityMapStorage)
 {
+	m_map_entities.setDenseStorageEnabled( entityMapStorage == ENTITY_MAP_DENSE );
 	m_unit_converter = std::make_shared<UnitConverter>( );
 	m_unit_converter->setMessageTarget( this );
 	initFileHeader( "IfcPlusPlus-export.ifc", "IfcPlusPlus" );
@@ -289,7 +299,18 @@ void BuildingModel::setMapIfcEntities( const std::unordered_map<int, shared_ptr<
 	clearIfcModel();
 	m_map_entities.clear();
 	m_max_entity_id = -1;
-	m_map_entities = map;
+	for( auto it = map.begin(); it != map.end(); ++it )
+	{
+		m_map_entities.insert( *it );
+		if( it->second )
+		{
+			addToClassIndex( it->second );
+		}
+		if( it->first > m_max_entity_id )
+		{
+			m_max_entity_id = it->first;
+		}
+	}
 	updateCache();
 	// todo: check model consistency
 }
@@ -320,6 +341,7 @@ void BuildingModel::insertEntity( shared_ptr<BuildingEntity> e, bool overwrite_e
 		if( overwrite_existing )
 		{
 			it_find->second = e;
+			addToClassIndex( e );
 		}
 		else
 		{
@@ -332,10 +354,100 @@ void BuildingModel::insertEntity( shared_ptr<BuildingEntity> e, bool overwrite_e
 	else
 	{
 		// the key does not exist in the map
-		m_map_entities.insert( it_find, std::map<int, shared_ptr<BuildingEntity> >::value_type( tag, e ) );
+		m_map_entities.insert( it_find, BuildingModelMapType<int, shared_ptr<BuildingEntity> >::value_type( tag, e ) );
+		addToClassIndex( e );
+	}
+}
+
+void BuildingModel::addToClassIndex( const shared_ptr<BuildingEntity>& e )
+{
+	const EntityClassInfo* class_info = EntityFactory::getEntityClassInfo( e->classID() );
+	if( !class_info )
+	{
+		return;
+	}
+
+	if( m_entity_tags_by_class.size() < IFC_NUM_ENTITY_CLASSES )
+	{
+		m_entity_tags_by_class.resize( IFC_NUM_ENTITY_CLASSES );
+	}
+
+	std::vector<int>& tags = m_entity_tags_by_class[class_info->m_index];
+	if( tags.empty() || tags.back() < e->m_tag )
+	{
+		// usual case while reading a file
+		tags.push_back( e->m_tag );
+		return;
+	}
+
+	auto it_insert = std::lower_bound( tags.begin(), tags.end(), e->m_tag );
+	if( it_insert == tags.end() || *it_insert != e->m_tag )
+	{
+		tags.insert( it_insert, e->m_tag );
+	}
+}
+
+void BuildingModel::removeFromClassIndex( const shared_ptr<BuildingEntity>& e )
+{
+	const EntityClassInfo* class_info = EntityFactory::getEntityClassInfo( e->classID() );
+	if( !class_info || class_info->m_index >= m_entity_tags_by_class.size() )
+	{
+		return;
+	}
+
+	std::vector<int>& tags = m_entity_tags_by_class[class_info->m_index];
+	auto it_find = std::lower_bound( tags.begin(), tags.end(), e->m_tag );
+	if( it_find != tags.end() && *it_find == e->m_tag )
+	{
+		tags.erase( it_find );
+	}
+}
+
+template<typename TFunc>
+void BuildingModel::forEachEntityOfType( uint32_t classID, bool includeSubtypes, TFunc func ) const
+{
+	const EntityClassInfo* class_info = EntityFactory::getEntityClassInfo( classID );
+	if( !class_info || m_entity_tags_by_class.empty() )
+	{
+		return;
+	}
+
+	const uint16_t index_end = includeSubtypes ? class_info->m_index_end : class_info->m_index + 1;
+	for( uint16_t index = class_info->m_index; index < index_end; ++index )
+	{
+		const uint32_t index_class_id = EntityFactory::getEntityClassInfoByIndex( index ).m_class_id;
+		for( int tag : m_entity_tags_by_class[index] )
+		{
+			auto it_find = m_map_entities.find( tag );
+			if( it_find == m_map_entities.end() || !it_find->second )
+			{
+				continue;
+			}
+
+			// the entity may have been erased or replaced directly in the map
+			if( it_find->second->classID() != index_class_id )
+			{
+				continue;
+			}
+			func( it_find->second );
+		}
 	}
 }
 
+std::vector<shared_ptr<BuildingEntity> > BuildingModel::getEntitiesOfType( uint32_t classID, bool includeSubtypes ) const
+{
+	std::vector<shared_ptr<BuildingEntity> > result;
+	forEachEntityOfType( classID, includeSubtypes, [&result]( const shared_ptr<BuildingEntity>& e ) { result.push_back( e ); } );
+	return result;
+}
+
+size_t BuildingModel::getNumEntitiesOfType( uint32_t classID, bool includeSubtypes ) const
+{
+	size_t num_entities = 0;
+	forEachEntityOfType( classID, includeSubtypes, [&num_entities]( const shared_ptr<BuildingEntity>& ) { ++num_entities; } );
+	return num_entities;
+}
+
 void BuildingModel::removeEntity( shared_ptr<BuildingEntity> e )
 {
 	if( !e )
@@ -352,43 +464,17 @@ void BuildingModel::removeEntity( shared_ptr<BuildingEntity> e )
 	}
 	shared_ptr<BuildingEntity> entity_found = it_find->second;
 	entity_found->unlinkFromInverseCounterparts();
-	BuildingEntity* entity_remove_ptr = e.get();
-		
 	if( entity_found.use_count() > 1 )
 	{
-		// find references to this entity and remove them
-		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes_inverse;
-		entity_found->getAttributesInverse( vec_attributes_inverse );
-		for(auto & ii : vec_attributes_inverse)
-		{
-			shared_ptr<BuildingObject>& attribute_inverse = ii.second;
-
-			shared_ptr<BuildingEntity> attribute_inverse_entity = dynamic_pointer_cast<BuildingEntity>( attribute_inverse );
-			if( attribute_inverse_entity )
-			{
-				std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
-				attribute_inverse_entity->getAttributes( vec_attributes );
-				for( size_t jj = 0; jj < vec_attributes.size(); ++jj )
-				{
-					shared_ptr<BuildingObject>& attribute = vec_attributes[jj].second;
-					if( attribute.get() == entity_remove_ptr )
-					{
-						vec_attributes.erase( vec_attributes.begin() + jj );
-						if( jj > 0 )
-						{
-							--jj;
-						}
-					}
-				}
-			}
-		}
-
+		// other entities still reference this entity. Their attributes are not changed, so the entity stays alive until they release it
 		if (entity_found->m_tag == m_max_entity_id) {
 			if (m_max_entity_id > 0) {
 				--m_max_entity_id;
 			}
 		}
 	}
+	removeFromClassIndex( entity_found );
+	m_deferred_arguments.erase( remove_id );
 	m_map_entities.erase( it_find );
 }
 
@@ -461,87 +547,128 @@ int BuildingModel::getLowestUnusedEntityTagSlow()
 
 void BuildingModel::removeUnreferencedEntities()
 {
-	for( auto it_entities = m_map_entities.begin(); it_entities != m_map_entities.end();  )
+	removeUnreferencedEntities( { IFCPROJECT, IFCRELATIONSHIP, IFCSTYLEDITEM } );
+}
+
+void BuildingModel::removeUnreferencedEntities( const std::vector<uint32_t>& rootClassIDs )
+{
+	std::vector<BuildingEntity*> refs;
+	std::vector<int> deferred_tags;
+	std::vector<BuildingEntity*> stack;
+	std::unordered_set<const BuildingEntity*> reachable;
+	reachable.reserve( m_map_entities.size() );
+
+	// the deferred arguments are read and erased below, and entities that materialize is parsing outside of the mutex must be complete first.
+	// isMaterialized would lock again, so the lambdas read m_deferred_arguments directly
+	std::unique_lock<std::mutex> lock( m_mutex_deferred_arguments );
+	m_condition_materialized.wait( lock, [this]() { return m_materializing_tags.empty(); } );
+	auto isDeferred = [this]( int tag ) { return m_deferred_arguments.find( tag ) != m_deferred_arguments.end(); };
+
+	auto addReferences = [&]( const BuildingEntity* entity )
 	{
-		shared_ptr<BuildingEntity> entity = it_entities->second;
-		if( entity.use_count() < 2 )
+		auto it_deferred = m_deferred_arguments.find( entity->m_tag );
+		if( it_deferred == m_deferred_arguments.end() )
+		{
+			entity->getEntityReferences( refs );
+			return;
+		}
+
+		// lazy loaded entity: take the references from the argument text
+		const std::string arguments = m_deferred_arguments_text.substr( it_deferred->second.first, it_deferred->second.second );
+		deferred_tags.clear();
+		ReaderSTEP::collectReferencedTags( arguments, deferred_tags );
+		for( int tag : deferred_tags )
 		{
-			// if use_count is only 1, the entity is only referenced in m_map_entities, so no other entity or other object holds a shared_ptr
-			bool erase_entity = true;
-			shared_ptr<IfcRelationship> ifc_relationship = dynamic_pointer_cast<IfcRelationship>( entity );
-			if( ifc_relationship )
+			auto it_find = m_map_entities.find( tag );
+			if( it_find != m_map_entities.end() && it_find->second )
 			{
-				// relationship objects may only reference some entities while not being referenced itself
-				std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
-				ifc_relationship->getAttributes( vec_attributes );
-				if( vec_attributes.size() > 4 )
+				refs.push_back( it_find->second.get() );
+			}
+		}
+	};
+
+	// mark: collect roots
+	for( uint32_t classID : rootClassIDs )
+	{
+		forEachEntityOfType( classID, true, [&]( const shared_ptr<BuildingEntity>& entity )
+		{
+			IfcRelationship* relationship = dynamic_cast<IfcRelationship*>( entity.get() );
+			if( relationship && !isDeferred( entity->m_tag ) )
+			{
+				// relationship objects may only reference some entities while not being referenced itself. Without relevant references, they are garbage too
+				refs.clear();
+				relationship->getEntityReferences( refs );
+				const BuildingEntity* owner_history = relationship->m_OwnerHistory.get();
+				if( std::find_if( refs.begin(), refs.end(), [owner_history]( const BuildingEntity* e ) { return e != owner_history; } ) == refs.end() )
 				{
-					// check if the object has relevant pointers
-					size_t num_relevant_attributes = 0;
-					// first 4 attributes are GlobalId, OwnerHistory, Name, Description
-					for( size_t ii = 4; ii < vec_attributes.size(); ++ii )
-					{
-						shared_ptr<BuildingObject> attribute = vec_attributes[ii].second;
-						if( attribute )
-						{
-							shared_ptr<AttributeObjectVector> attribute_vec = dynamic_pointer_cast<AttributeObjectVector>( attribute );
-							if( attribute_vec )
-							{
-								if( !attribute_vec->m_vec.empty() )
-								{
-									++num_relevant_attributes;
-								}
-							}
-							else
-							{
-								shared_ptr<BuildingEntity> attribute_entity = dynamic_pointer_cast<BuildingEntity>( attribute );
-								if( attribute_entity )
-								{
-									++num_relevant_attributes;
-								}
-							}
-						}
-					}
-					if( num_relevant_attributes > 0 )
-					{
-						erase_entity = false;
-					}
+					return;
 				}
 			}
 			else
 			{
-				shared_ptr<IfcStyledItem> ifc_styled_item = dynamic_pointer_cast<IfcStyledItem>( entity );
-				if( ifc_styled_item )
+				IfcStyledItem* styled_item = dynamic_cast<IfcStyledItem*>( entity.get() );
+				if( styled_item && !isDeferred( entity->m_tag ) && !styled_item->m_Item )
 				{
-					if( ifc_styled_item->m_Item )
-					{
-						erase_entity = false;
-					}
+					return;
 				}
-				
 			}
-			if( erase_entity )
+
+			if( reachable.insert( entity.get() ).second )
 			{
-				entity->unlinkFromInverseCounterparts();
-				auto erase_it = it_entities;
-#ifdef _DEBUG
-				int tag = entity->m_tag;
-				const char* entity_className = IFC4X3::EntityFactory::getStringForClassID(entity->classID());
-#endif
-				++it_entities;
-				// TODO: check here if it really has been removed
-				removeEntity( entity );
+				stack.push_back( entity.get() );
 			}
-			else
+		} );
+	}
+
+	// mark: follow references
+	while( !stack.empty() )
+	{
+		BuildingEntity* entity = stack.back();
+		stack.pop_back();
+		refs.clear();
+		addReferences( entity );
+		for( BuildingEntity* referenced : refs )
+		{
+			if( reachable.insert( referenced ).second )
 			{
-				++it_entities;
+				stack.push_back( referenced );
 			}
 		}
-		else
+	}
+
+	// sweep: remove all entities that have not been reached
+	std::vector<shared_ptr<BuildingEntity> > vec_remove;
+	for( auto it = m_map_entities.begin(); it != m_map_entities.end(); ++it )
+	{
+		const shared_ptr<BuildingEntity>& entity = it->second;
+		if( entity && reachable.find( entity.get() ) == reachable.end() )
 		{
-			++it_entities;
+			vec_remove.push_back( entity );
 		}
 	}
+
+	if( vec_remove.empty() )
+	{
+		return;
+	}
+
+	for( const shared_ptr<BuildingEntity>& entity : vec_remove )
+	{
+		entity->unlinkFromInverseCounterparts();
+		m_deferred_arguments.erase( entity->m_tag );
+		m_map_entities.erase( entity->m_tag );
+	}
+
+	for( std::vector<int>& tags : m_entity_tags_by_class )
+	{
+		tags.erase( std::remove_if( tags.begin(), tags.end(), [this]( int tag ) { return m_map_entities.find( tag ) == m_map_entities.end(); } ), tags.end() );
+	}
+
+	if( m_inverse_attribute_storage == INVERSE_ATTRIBUTES_INDEX || m_inverse_attribute_storage == INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX )
+	{
+		m_inverse_index.build( m_map_entities, Executor::get( m_executor ) );
+		m_inverse_index_outdated = false;
+	}
 }
 
 void BuildingModel::initFileHeader( const std::string& fileName, const std::string& generatingApplication )
@@ -590,6 +717,11 @@ void BuildingModel::setFileName( const std::string& name )
 void BuildingModel::clearIfcModel()
 {
 	m_map_entities.clear();
+	m_entity_tags_by_class.clear();
+	m_inverse_index.clear();
+	m_inverse_index_outdated = false;
+	m_deferred_arguments.clear();
+	m_deferred_arguments_text.clear();
 	m_max_entity_id = -1;
 	m_ifc_project.reset();
 	m_geom_context_3d.reset();
@@ -611,53 +743,40 @@ void BuildingModel::resetIfcModel()
 void BuildingModel::updateCache()
 {
 	bool found_project = false;
-	bool found_geom_context = false;
 
 	shared_ptr<IfcProject> keep_project = m_ifc_project;
 	m_ifc_project.reset();
 
-	// try to find IfcProject and IfcGeometricRepresentationContext
-	for( auto it=m_map_entities.begin(); it!=m_map_entities.end(); ++it )
+	// try to find IfcProject and IfcGeometricRepresentationContext. As before the per-class index, the last IfcProject is kept if there are several
+	for( const shared_ptr<BuildingEntity>& obj : getEntitiesOfType( IFCPROJECT ) )
 	{
-		int tag = it->first;
-		shared_ptr<BuildingEntity> obj = it->second;
-		if( obj->classID() == IFCPROJECT )
+		if( m_ifc_project )
 		{
-			if( m_ifc_project )
-			{
-				messageCallback("More than one IfcProject in model", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__, m_ifc_project.get());
-			}
-			m_ifc_project = dynamic_pointer_cast<IfcProject>(obj);
-			
-			if( m_ifc_project )
-			{
-				found_project = true;
-				if( found_geom_context )
-				{
-					break;
-				}
-			}
-			else
-			{
-				std::cout << "BuildingModel::updateCache: IfcProject found but dynamic_cast failed. Is RTTI enabled?" << std::endl;
-			}
+			messageCallback("More than one IfcProject in model", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__, m_ifc_project.get());
+		}
+		m_ifc_project = dynamic_pointer_cast<IfcProject>(obj);
+
+		if( m_ifc_project )
+		{
+			found_project = true;
+		}
+		else
+		{
+			std::cout << "BuildingModel::updateCache: IfcProject found but dynamic_cast failed. Is RTTI enabled?" << std::endl;
 		}
-		else if( obj->classID() == IFCGEOMETRICREPRESENTATIONCONTEXT )
+	}
+
+	for( const shared_ptr<BuildingEntity>& obj : getEntitiesOfType( IFCGEOMETRICREPRESENTATIONCONTEXT ) )
+	{
+		shared_ptr<IfcGeometricRepresentationContext> context = dynamic_pointer_cast<IfcGeometricRepresentationContext>(obj);
+		if( context )
 		{
-			shared_ptr<IfcGeometricRepresentationContext> context = dynamic_pointer_cast<IfcGeometricRepresentationContext>(obj);
-			if( context )
+			if( context->m_CoordinateSpaceDimension )
 			{
-				if( context->m_CoordinateSpaceDimension )
+				if( context->m_CoordinateSpaceDimension->m_value == 3 )
 				{
-					if( context->m_CoordinateSpaceDimension->m_value == 3 )
-					{
-						m_geom_context_3d = context;
-						found_geom_context = true;
-						if( found_project )
-						{
-							break;
-						}
-					}
+					m_geom_context_3d = context;
+					break;
 				}
 			}
 		}
@@ -681,6 +800,18 @@ void BuildingModel::clearCache()
 
 void BuildingModel::resolveInverseAttributes()
 {
+	IFCPP_TRACE_SCOPE("BuildingModel::resolveInverseAttributes");
+	if( m_inverse_attribute_storage == INVERSE_ATTRIBUTES_INDEX || m_inverse_attribute_storage == INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX )
+	{
+		m_inverse_index.build( m_map_entities, Executor::get( m_executor ) );
+		m_inverse_index_outdated = false;
+	}
+
+	if( m_inverse_attribute_storage == INVERSE_ATTRIBUTES_INDEX )
+	{
+		return;
+	}
+
 	for( auto it = m_map_entities.begin(); it != m_map_entities.end(); ++it )
 	{
 		shared_ptr<BuildingEntity> entity = it->second;
@@ -704,94 +835,448 @@ void BuildingModel::unsetInverseAttributes()
 		}
 		entity->unlinkFromInverseCounterparts();
 	}
+	m_inverse_index.clear();
+	m_inverse_index_outdated = false;
 }
 
-void BuildingModel::collectDependentEntities( shared_ptr<BuildingObject> obj, std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, bool resolveInverseAttributes)
+const InverseIndex& BuildingModel::getInverseIndex() const
 {
-	if( !obj )
+	updateInverseIndex();
+	return m_inverse_index;
+}
+
+void BuildingModel::updateInverseIndex() const
+{
+	if( !m_inverse_index_outdated )
 	{
 		return;
 	}
-	if( target_map.find( obj.get() ) != target_map.end() )
+
+	// entities that materialize is parsing outside of the mutex are not read until they are done
+	std::unique_lock<std::mutex> lock( m_mutex_deferred_arguments );
+	m_condition_materialized.wait( lock, [this]() { return m_materializing_tags.empty(); } );
+	if( m_inverse_index_outdated )
 	{
-		//return;
+		m_inverse_index.build( m_map_entities, Executor::get( m_executor ) );
+		m_inverse_index_outdated = false;
 	}
+}
 
-	target_map[obj.get()] = obj;
+void BuildingModel::getInverseEntities( const shared_ptr<BuildingEntity>& target, uint16_t inverseAttribute, std::vector<shared_ptr<BuildingEntity> >& result ) const
+{
+	if( !target )
+	{
+		return;
+	}
 
-	shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( obj );
+	updateInverseIndex();
+	std::pair<const int*, const int*> source_tags = m_inverse_index.getSourceTags( target->m_tag, inverseAttribute );
+	for( const int* it_tag = source_tags.first; it_tag != source_tags.second; ++it_tag )
+	{
+		auto it_find = m_map_entities.find( *it_tag );
+		if( it_find != m_map_entities.end() && it_find->second )
+		{
+			result.push_back( it_find->second );
+		}
+	}
+}
 
-	if( entity )
+namespace
+{
+	// shared_ptr control block of an object that was created with new, approximately
+	const size_t memory_shared_object_overhead = 2*sizeof(void*) + 2*sizeof(long);
+
+	// adds the attribute objects of one entity to its EntityClassMemoryUsage. Referenced entities are counted in their own class
+	class MemoryUsageVisitor : public AttributeVisitor
 	{
-		shared_ptr<IfcElementAssembly> ele_assembly = dynamic_pointer_cast<IfcElementAssembly>(entity);
-		if( ele_assembly )
+	public:
+		explicit MemoryUsageVisitor( EntityClassMemoryUsage& usage ) : m_usage( usage )
 		{
-			int assembly_id = ele_assembly->m_tag;
-			std::vector<weak_ptr<IfcRelAggregates> >& vec_is_decomposed_by = ele_assembly->m_IsDecomposedBy_inverse;
-			for( const auto& is_decomposed_weak_ptr : vec_is_decomposed_by )
+		}
+
+		void visitObject( size_t, const char*, const shared_ptr<BuildingObject>& value ) override
+		{
+			addAttributeObject( value.get() );
+		}
+
+		void visitList( size_t, const char*, const AttributeListView& list ) override
+		{
+			m_usage.m_attribute_bytes += list.size()*sizeof( shared_ptr<BuildingObject> );
+			for( size_t ii = 0; ii < list.size(); ++ii )
 			{
-				shared_ptr<IfcRelDecomposes> rel_dec;
-				if( is_decomposed_weak_ptr.expired() )
-				{
-					continue;
-				}
-				shared_ptr<IfcRelAggregates> is_decomposed_ptr(is_decomposed_weak_ptr);
-				if( is_decomposed_ptr )
+				addAttributeObject( list.at( ii ) );
+			}
+		}
+
+		void visitList2D( size_t, const char*, const AttributeList2DView& list ) override
+		{
+			m_usage.m_attribute_bytes += list.size()*sizeof( std::vector<shared_ptr<BuildingObject> > );
+			for( size_t ii = 0; ii < list.size(); ++ii )
+			{
+				m_usage.m_attribute_bytes += list.size( ii )*sizeof( shared_ptr<BuildingObject> );
+				for( size_t jj = 0; jj < list.size( ii ); ++jj )
 				{
-					shared_ptr<BuildingEntity> as_ifcpp_entity = is_decomposed_ptr;
-					collectDependentEntities(as_ifcpp_entity, target_map, resolveInverseAttributes);
+					addAttributeObject( list.at( ii, jj ) );
 				}
 			}
 		}
 
-		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
-		entity->getAttributes(vec_attributes);
+		void addAttributeObject( BuildingObject* obj )
+		{
+			if( obj && !dynamic_cast<BuildingEntity*>( obj ) )
+			{
+				m_usage.m_attribute_bytes += obj->getMemorySize() + memory_shared_object_overhead;
+				m_usage.m_string_bytes += obj->getPayloadMemorySize();
+			}
+		}
 
-		if( resolveInverseAttributes )
+	private:
+		EntityClassMemoryUsage& m_usage;
+	};
+
+	// inverse attributes are weak references, only the vectors count
+	class InverseMemoryUsageVisitor : public AttributeVisitor
+	{
+	public:
+		explicit InverseMemoryUsageVisitor( EntityClassMemoryUsage& usage ) : m_usage( usage )
+		{
+		}
+
+		void visitList( size_t, const char*, const AttributeListView& list ) override
 		{
-			entity->getAttributesInverse(vec_attributes);
+			m_usage.m_inverse_bytes += list.size()*sizeof( weak_ptr<BuildingEntity> );
 		}
 
-		for( auto& vec_attribute : vec_attributes )
+	private:
+		EntityClassMemoryUsage& m_usage;
+	};
+}
+
+ModelMemoryReport BuildingModel::memoryReport() const
+{
+	ModelMemoryReport report;
+	std::vector<EntityClassMemoryUsage> usage_by_class_index( IFC_NUM_ENTITY_CLASSES );
+	for( auto it = m_map_entities.begin(); it != m_map_entities.end(); ++it )
+	{
+		const shared_ptr<BuildingEntity>& entity = it->second;
+		if( !entity )
+		{
+			continue;
+		}
+
+		const EntityClassInfo* class_info = EntityFactory::getEntityClassInfo( entity->classID() );
+		if( !class_info )
+		{
+			continue;
+		}
+
+		EntityClassMemoryUsage& usage = usage_by_class_index[class_info->m_index];
+		usage.m_class_id = class_info->m_class_id;
+		++usage.m_num_entities;
+		usage.m_entity_bytes += entity->getMemorySize() + memory_shared_object_overhead;
+
+		MemoryUsageVisitor visitor( usage );
+		entity->visitAttributes( visitor );
+		InverseMemoryUsageVisitor inverse_visitor( usage );
+		entity->visitAttributesInverse( inverse_visitor );
+	}
+
+	for( EntityClassMemoryUsage& usage : usage_by_class_index )
+	{
+		if( usage.m_num_entities > 0 )
+		{
+			report.m_classes.push_back( usage );
+		}
+	}
+	std::sort( report.m_classes.begin(), report.m_classes.end(), []( const EntityClassMemoryUsage& a, const EntityClassMemoryUsage& b ) {
+		return a.getTotalBytes() > b.getTotalBytes();
+	} );
+
+	report.m_entity_map_bytes = m_map_entities.getMemoryUsage();
+	for( const std::vector<int>& tags : m_entity_tags_by_class )
+	{
+		report.m_entity_map_bytes += getHeapMemorySize( tags );
+	}
+	report.m_entity_map_bytes += getHeapMemorySize( m_entity_tags_by_class );
+	report.m_inverse_index_bytes = m_inverse_index.getMemoryUsage();
+	const std::lock_guard<std::mutex> lock( m_mutex_deferred_arguments );
+	report.m_deferred_arguments_bytes = m_deferred_arguments.getMemoryUsage() + getHeapMemorySize( m_deferred_arguments_text );
+	return report;
+}
+
+void BuildingModel::setDeferredArguments( int tag, const std::string& arguments )
+{
+	m_deferred_arguments[tag] = std::make_pair( m_deferred_arguments_text.size(), arguments.size() );
+	m_deferred_arguments_text += arguments;
+}
+
+size_t BuildingModel::getNumDeferredEntities() const
+{
+	const std::lock_guard<std::mutex> lock( m_mutex_deferred_arguments );
+	return m_deferred_arguments.size() + m_materializing_tags.size();
+}
+
+bool BuildingModel::isMaterialized( int tag ) const
+{
+	const std::lock_guard<std::mutex> lock( m_mutex_deferred_arguments );
+	return m_deferred_arguments.find( tag ) == m_deferred_arguments.end() && m_materializing_tags.find( tag ) == m_materializing_tags.end();
+}
+
+void BuildingModel::materialize( const std::function<bool(const shared_ptr<BuildingEntity>&)>& filter )
+{
+	// take the argument text of the entities out of m_deferred_arguments, so that materializeEntity waits for them instead of parsing them a second time
+	std::vector<shared_ptr<BuildingEntity> > vec_entities;
+	std::vector<std::string> vec_arguments;
+	{
+		const std::lock_guard<std::mutex> lock( m_mutex_deferred_arguments );
+		for( auto it = m_deferred_arguments.begin(); it != m_deferred_arguments.end(); ++it )
 		{
-			shared_ptr<BuildingObject>& attribute = vec_attribute.second;
-			if( !attribute )
+			auto it_find = m_map_entities.find( it->first );
+			if( it_find == m_map_entities.end() || !it_find->second )
 			{
-				// empty attribute
 				continue;
 			}
-			shared_ptr<BuildingEntity> attribute_entity = dynamic_pointer_cast<BuildingEntity>(attribute);
-			if( attribute_entity )
+			if( !filter || filter( it_find->second ) )
+			{
+				vec_entities.push_back( it_find->second );
+				vec_arguments.push_back( m_deferred_arguments_text.substr( it->second.first, it->second.second ) );
+			}
+		}
+
+		for( const shared_ptr<BuildingEntity>& entity : vec_entities )
+		{
+			m_deferred_arguments.erase( entity->m_tag );
+			m_materializing_tags.insert( entity->m_tag );
+		}
+
+		if( m_deferred_arguments.size() == 0 )
+		{
+			std::string().swap( m_deferred_arguments_text );
+		}
+	}
+
+	if( vec_entities.empty() )
+	{
+		return;
+	}
+
+	// no setlocale, materializeEntity may parse in other threads at the same time. readRealValue does not depend on the locale
+	std::stringstream err;
+	std::set<int> entityIdNotFoundAll;
+	StatusCallback::RangeMessages rangeErrors;
+	std::mutex mutexEntityIdNotFound;
+	Executor::get( m_executor ).parallelForRange( 0, vec_entities.size(), m_grainSize, [&]( size_t rangeBegin, size_t rangeEnd ) {
+		std::stringstream errorStream;
+		std::unordered_set<int> entityIdNotFound;
+		for( size_t ii = rangeBegin; ii < rangeEnd; ++ii )
+		{
+			ReaderSTEP::readEntityArgumentString( vec_entities[ii], vec_arguments[ii], m_map_entities, errorStream, entityIdNotFound );
+		}
+
+		if( entityIdNotFound.size() > 0 )
+		{
+			const std::lock_guard<std::mutex> lock( mutexEntityIdNotFound );
+			entityIdNotFoundAll.insert( entityIdNotFound.begin(), entityIdNotFound.end() );
+		}
+		rangeErrors.addRange( rangeBegin, errorStream );
+	});
+	rangeErrors.appendTo( err );
+
+	{
+		// inverse attributes are shared with entities that materializeEntity may set at the same time
+		const std::lock_guard<std::mutex> lock( m_mutex_deferred_arguments );
+		for( const shared_ptr<BuildingEntity>& entity : vec_entities )
+		{
+			m_materializing_tags.erase( entity->m_tag );
+			if( m_inverse_attribute_storage != INVERSE_ATTRIBUTES_INDEX )
+			{
+				entity->setInverseCounterparts( entity );
+			}
+		}
+
+		if( m_inverse_attribute_storage == INVERSE_ATTRIBUTES_INDEX || m_inverse_attribute_storage == INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX )
+		{
+			m_inverse_index_outdated = true;
+		}
+	}
+	m_condition_materialized.notify_all();
+
+	if( entityIdNotFoundAll.size() > 0 )
+	{
+		err << "Entity with id # ";
+		for( auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); ++it )
+		{
+			if( it != entityIdNotFoundAll.begin() )
+			{
+				err << ", ";
+			}
+			err << *it;
+		}
+		err << "  not found" << std::endl;
+	}
+
+	if( err.tellp() > 0 )
+	{
+		messageCallback( err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+	}
+}
+
+void BuildingModel::materializeEntity( const shared_ptr<BuildingEntity>& entity )
+{
+	if( !entity )
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock( m_mutex_deferred_arguments );
+	const int tag = entity->m_tag;
+	m_condition_materialized.wait( lock, [this, tag]() { return m_materializing_tags.find( tag ) == m_materializing_tags.end(); } );
+	auto it_find = m_deferred_arguments.find( tag );
+	if( it_find == m_deferred_arguments.end() )
+	{
+		return;
+	}
+
+	std::string arguments = m_deferred_arguments_text.substr( it_find->second.first, it_find->second.second );
+	m_deferred_arguments.erase( it_find );
+
+	std::stringstream errorStream;
+	std::unordered_set<int> entityIdNotFound;
+	ReaderSTEP::readEntityArgumentString( entity, arguments, m_map_entities, errorStream, entityIdNotFound );
+
+	if( m_inverse_attribute_storage != INVERSE_ATTRIBUTES_INDEX )
+	{
+		entity->setInverseCounterparts( entity );
+	}
+	if( m_inverse_attribute_storage == INVERSE_ATTRIBUTES_INDEX || m_inverse_attribute_storage == INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX )
+	{
+		m_inverse_index_outdated = true;
+	}
+
+	for( int tag : entityIdNotFound )
+	{
+		errorStream << "Entity with id #" << tag << " not found" << std::endl;
+	}
+	if( errorStream.tellp() > 0 )
+	{
+		messageCallback( errorStream.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__, entity.get() );
+	}
+}
+
+bool BuildingModel::isPropertyOrQuantity( const shared_ptr<BuildingEntity>& entity )
+{
+	return entity->isA<IfcPropertyAbstraction>() || entity->isA<IfcPropertyDefinition>() || entity->isA<IfcPhysicalQuantity>()
+		|| entity->isA<IfcRelDefinesByProperties>() || entity->isA<IfcRelDefinesByTemplate>();
+}
+
+namespace
+{
+	// adds referenced entities that are not yet in target_map to the map and to the stack of BuildingModel::collectDependentEntities
+	class DependentEntitiesVisitor : public AttributeVisitor
+	{
+	public:
+		DependentEntitiesVisitor( std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, std::vector<shared_ptr<BuildingEntity> >& stack ) : m_target_map( target_map ), m_stack( stack )
+		{
+		}
+
+		void visitObject( size_t, const char*, const shared_ptr<BuildingObject>& value ) override
+		{
+			if( dynamic_cast<BuildingEntity*>( value.get() ) )
+			{
+				add( value );
+			}
+		}
+
+		void visitList( size_t, const char*, const AttributeListView& list ) override
+		{
+			for( size_t ii = 0; ii < list.size(); ++ii )
 			{
-				if( target_map.find(attribute_entity.get()) == target_map.end() )
+				if( dynamic_cast<BuildingEntity*>( list.at( ii ) ) )
 				{
-					target_map[attribute_entity.get()] = attribute_entity;
-					collectDependentEntities(attribute_entity, target_map, resolveInverseAttributes);
+					add( list.sharedAt( ii ) );
 				}
-				continue;
 			}
+		}
 
-			shared_ptr<AttributeObjectVector> attribute_object_vector = dynamic_pointer_cast<AttributeObjectVector>(attribute);
-			if( attribute_object_vector )
+		void visitList2D( size_t, const char*, const AttributeList2DView& list ) override
+		{
+			for( size_t ii = 0; ii < list.size(); ++ii )
 			{
-				std::vector<shared_ptr<BuildingObject> >& vec_of_attributes = attribute_object_vector->m_vec;
-				for( auto& attribute_object : vec_of_attributes )
+				for( size_t jj = 0; jj < list.size( ii ); ++jj )
 				{
-					collectDependentEntities(attribute_object, target_map, resolveInverseAttributes);
+					if( dynamic_cast<BuildingEntity*>( list.at( ii, jj ) ) )
+					{
+						add( list.sharedAt( ii, jj ) );
+					}
 				}
-				continue;
 			}
 		}
+
+		void add( const shared_ptr<BuildingObject>& obj )
+		{
+			shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( obj );
+			if( entity && m_target_map.insert( std::make_pair( obj.get(), obj ) ).second )
+			{
+				m_stack.push_back( entity );
+			}
+		}
+
+	private:
+		std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& m_target_map;
+		std::vector<shared_ptr<BuildingEntity> >& m_stack;
+	};
+}
+
+void BuildingModel::collectDependentEntities( shared_ptr<BuildingObject> obj, std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, bool resolveInverseAttributes)
+{
+	if( !obj )
+	{
 		return;
 	}
 
+	target_map[obj.get()] = obj;
+
 	shared_ptr<AttributeObjectVector> attribute_object_vector = dynamic_pointer_cast<AttributeObjectVector>(obj);
 	if( attribute_object_vector )
 	{
-		std::vector<shared_ptr<BuildingObject> >& vec_of_attributes = attribute_object_vector->m_vec;
-		for( auto& attribute_object : vec_of_attributes )
+		for( auto& attribute_object : attribute_object_vector->m_vec )
 		{
 			collectDependentEntities(attribute_object, target_map, resolveInverseAttributes);
 		}
+		return;
+	}
+
+	shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( obj );
+	if( !entity )
+	{
+		return;
+	}
+
+	std::vector<shared_ptr<BuildingEntity> > stack;
+	stack.push_back( entity );
+	DependentEntitiesVisitor visitor( target_map, stack );
+	while( !stack.empty() )
+	{
+		entity = stack.back();
+		stack.pop_back();
+
+		shared_ptr<IfcElementAssembly> ele_assembly = dynamic_pointer_cast<IfcElementAssembly>(entity);
+		if( ele_assembly )
+		{
+			for( const auto& is_decomposed_weak_ptr : ele_assembly->m_IsDecomposedBy_inverse )
+			{
+				shared_ptr<IfcRelAggregates> is_decomposed_ptr = is_decomposed_weak_ptr.lock();
+				if( is_decomposed_ptr )
+				{
+					visitor.add( is_decomposed_ptr );
+				}
+			}
+		}
+
+		entity->visitAttributes( visitor );
+		if( resolveInverseAttributes )
+		{
+			entity->visitAttributesInverse( visitor );
+		}
 	}
 }
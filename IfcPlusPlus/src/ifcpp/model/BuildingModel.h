@@ -17,10 +17,18 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include "BasicTypes.h"
+#include "BuildingObject.h"
+#include "Executor.h"
+#include "InverseIndex.h"
 #include "StatusCallback.h"
 
 class BuildingObject;
@@ -32,20 +40,73 @@ namespace IFC4X3
 	class IfcGeometricRepresentationContext;
 }
 
+/*! \brief Approximate memory of the entities of one class, see BuildingModel::memoryReport */
+struct EntityClassMemoryUsage
+{
+	uint32_t	m_class_id = 0;
+	size_t		m_num_entities = 0;
+	size_t		m_entity_bytes = 0;			// entity objects
+	size_t		m_attribute_bytes = 0;		// type and select objects of attributes, for example IfcLabel, and the vectors of list attributes
+	size_t		m_string_bytes = 0;			// characters of strings and values of lists that are owned by attribute objects
+	size_t		m_inverse_bytes = 0;		// vectors of the m_..._inverse members
+
+	size_t getTotalBytes() const { return m_entity_bytes + m_attribute_bytes + m_string_bytes + m_inverse_bytes; }
+};
+
+/*! \brief Result of BuildingModel::memoryReport */
+struct ModelMemoryReport
+{
+	std::vector<EntityClassMemoryUsage>	m_classes;						// classes with at least one entity, largest total first
+	size_t								m_entity_map_bytes = 0;			// map of entities by tag, and index of tags per class
+	size_t								m_inverse_index_bytes = 0;		// see BuildingModel::INVERSE_ATTRIBUTES_INDEX
+	size_t								m_deferred_arguments_bytes = 0;	// argument text of lazily loaded entities that are not parsed yet
+
+	size_t getTotalBytes() const
+	{
+		size_t total = m_entity_map_bytes + m_inverse_index_bytes + m_deferred_arguments_bytes;
+		for( const EntityClassMemoryUsage& usage : m_classes )
+		{
+			total += usage.getTotalBytes();
+		}
+		return total;
+	}
+};
+
 class IFCQUERY_EXPORT BuildingModel : public StatusCallback
 {
 public:
-	BuildingModel();
+	enum EntityMapStorageEnum { ENTITY_MAP_DENSE, ENTITY_MAP_SPARSE };
+
+	/*! \brief Constructor. With ENTITY_MAP_DENSE, entities are stored in a vector indexed by STEP id, with an ordered map as fallback for ids far out of range.
+	  ENTITY_MAP_SPARSE keeps all entities in the ordered map, which can be preferable for models with widely scattered ids */
+	BuildingModel(EntityMapStorageEnum entityMapStorage = ENTITY_MAP_DENSE);
 	~BuildingModel() override;
 
+	bool hasMessageListener(MessageType type) const override { return hasMessageCallback(type); }
+
 	enum SchemaVersionEnum { IFC_VERSION_UNDEFINED, IFC_VERSION_UNKNOWN, IFC2X, IFC2X2, IFC2X3, IFC2X4, IFC4, IFC4X1, IFC4X3 };
 	BuildingModelMapType<int, shared_ptr<BuildingEntity> >& getMapIfcEntities() { return m_map_entities; }
 	void setMapIfcEntities(const std::unordered_map<int, shared_ptr<BuildingEntity> >& map);
 	void insertEntity(shared_ptr<BuildingEntity> e, bool overwrite_existing = false, bool warn_on_existing_entities = true);
 	void removeEntity(shared_ptr<BuildingEntity> e);
 	void removeEntity(int tag);
+
+	/*! \brief Method removeUnreferencedEntities. Removes all entities that can not be reached from IfcProject, relationships or styled items, following references of any depth.
+	  Relationships only count as root if they reference other entities than their IfcOwnerHistory, and styled items if they have an Item. */
 	void removeUnreferencedEntities();
 
+	/*! \brief Method removeUnreferencedEntities. Same as above, with entities of the given classes (including subtypes) as roots, for example IFCPROJECT and IFCRELATIONSHIP.
+	  Unreachable entities are unlinked from inverse attributes and removed in one pass. Arguments of lazy loaded entities are not parsed, their references are taken from the argument text. */
+	void removeUnreferencedEntities( const std::vector<uint32_t>& rootClassIDs );
+
+	/*! \brief Method getEntitiesOfType. Returns all entities of a class, for example IFCWALL, grouped by class and in ascending tag order within a class.
+	  \param[in] includeSubtypes If true, entities of derived classes are included as well, for example IfcWallStandardCase for IFCWALL, or all products for IFCPRODUCT.
+	  Uses an index per class, which is kept up to date by insertEntity and removeEntity. Entities that are added directly to getMapIfcEntities() are not indexed. */
+	std::vector<shared_ptr<BuildingEntity> > getEntitiesOfType( uint32_t classID, bool includeSubtypes = false ) const;
+
+	/*! \brief Method getNumEntitiesOfType. Same as getEntitiesOfType(...).size(), without collecting the entities */
+	size_t getNumEntitiesOfType( uint32_t classID, bool includeSubtypes = false ) const;
+
 	/*! \brief Method getNextUnusedEntityTag. Return the next tag that is not in the model. Look for gaps in existing map */
 	int getLowestUnusedEntityTagSlow();
 
@@ -74,8 +135,66 @@ public:
 	void setIfcProject(shared_ptr<IFC4X3::IfcProject> project);
 	void setUnitConverter(shared_ptr<UnitConverter>& uc);
 	void setIfcGeometricRepresentationContext3D(shared_ptr<IFC4X3::IfcGeometricRepresentationContext>& context);
+	/*! \brief Where resolveInverseAttributes stores inverse attributes.
+	  INVERSE_ATTRIBUTES_MEMBERS fills the m_..._inverse members of the entities, which are used by the geometry converter.
+	  INVERSE_ATTRIBUTES_INDEX builds a compact table in the model instead, see getInverseEntities. The members stay empty, which saves memory for large models. */
+	enum InverseAttributeStorageEnum { INVERSE_ATTRIBUTES_MEMBERS, INVERSE_ATTRIBUTES_INDEX, INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX };
+	void setInverseAttributeStorage( InverseAttributeStorageEnum storage ) { m_inverse_attribute_storage = storage; }
+	InverseAttributeStorageEnum getInverseAttributeStorage() const { return m_inverse_attribute_storage; }
+
 	void resolveInverseAttributes();
 	void unsetInverseAttributes();
+
+	/*! \brief Method getInverseEntities. Adds the entities that reference target with the given inverse attribute, for example IFC4X3::INVERSE_HasOpenings of an IfcElement.
+	  Requires INVERSE_ATTRIBUTES_INDEX or INVERSE_ATTRIBUTES_MEMBERS_AND_INDEX. The index reflects the model at the time of resolveInverseAttributes, entities that have been materialized since are included. */
+	void getInverseEntities( const shared_ptr<BuildingEntity>& target, uint16_t inverseAttribute, std::vector<shared_ptr<BuildingEntity> >& result ) const;
+
+	template<typename T>
+	void getInverseEntities( const shared_ptr<BuildingEntity>& target, uint16_t inverseAttribute, std::vector<shared_ptr<T> >& result ) const
+	{
+		std::vector<shared_ptr<BuildingEntity> > vec_entities;
+		getInverseEntities( target, inverseAttribute, vec_entities );
+		for( const shared_ptr<BuildingEntity>& entity : vec_entities )
+		{
+			shared_ptr<T> entity_t = entity_cast<T>( entity );
+			if( entity_t )
+			{
+				result.push_back( entity_t );
+			}
+		}
+	}
+
+	/*! \brief Method getInverseIndex. Rebuilds the index first if entities have been materialized since it was built. The reference is valid until the next call of materialize or materializeEntity */
+	const InverseIndex& getInverseIndex() const;
+
+	/*! \brief Method memoryReport. Approximate memory per entity class, computed from the size hooks BuildingObject::getMemorySize and getPayloadMemorySize of the entities and their attribute objects.
+	  Attributes are visited without allocating, the heap is not walked. Each object is counted with an estimate for its shared_ptr control block, other allocator overhead is not included. */
+	ModelMemoryReport memoryReport() const;
+
+	/*! \brief Method setDeferredArguments. Lazy loading: keeps the STEP arguments of an entity as text, until materialize or materializeEntity parses them. Used by ReaderSTEP::setDeferredArguments */
+	void setDeferredArguments( int tag, const std::string& arguments );
+
+	/*! \brief Method getNumDeferredEntities. Number of entities whose arguments have not been parsed yet */
+	size_t getNumDeferredEntities() const;
+	bool isMaterialized( int tag ) const;
+
+	/*! \brief Method materialize. Parses the deferred arguments of all entities for which filter returns true, or of all entities if filter is empty.
+	  Inverse attributes of the parsed entities are resolved, so that for example IfcRelDefinesByProperties appear in IsDefinedBy of the related objects. */
+	void materialize( const std::function<bool(const shared_ptr<BuildingEntity>&)>& filter = nullptr );
+
+	/*! \brief Method materializeEntity. Parses the deferred arguments of one entity, if there are any. Call this before accessing attributes of an entity in a lazily loaded model.
+	  Can be called from several threads, also while materialize runs. If materialize is parsing the entity, it waits until that is done. Inverse attribute members are set.
+	  The inverse attribute index is not rebuilt for each entity, it is rebuilt once on the next call of getInverseEntities or getInverseIndex. */
+	void materializeEntity( const shared_ptr<BuildingEntity>& entity );
+
+	/*! \brief Method isPropertyOrQuantity. True for properties, property sets, quantities and the relationships that assign them to objects.
+	  Can be passed to ReaderSTEP::setDeferredArguments if only geometry is needed. */
+	static bool isPropertyOrQuantity( const shared_ptr<BuildingEntity>& entity );
+
+	/*! \brief Method setExecutor. Executor for the parallel loops of the model, in materialize and when building the inverse attribute index. If not set, Executor::getDefault() is used.
+	  \param[in] grainSize Number of entities per task in materialize, 0 to choose it from the number of entities and threads. */
+	void setExecutor( const shared_ptr<Executor>& executor, size_t grainSize = 0 ) { m_executor = executor; m_grainSize = grainSize; }
+
 	void clearIfcModel();
 	void initIfcModel();
 	void initCopyIfcModel(const shared_ptr<BuildingModel>& other);
@@ -95,7 +214,27 @@ public:
 	}
 
 private:
+	void addToClassIndex( const shared_ptr<BuildingEntity>& e );
+	void removeFromClassIndex( const shared_ptr<BuildingEntity>& e );
+	void updateInverseIndex() const;
+	template<typename TFunc> void forEachEntityOfType( uint32_t classID, bool includeSubtypes, TFunc func ) const;
+
 	BuildingModelMapType<int, shared_ptr<BuildingEntity> >	m_map_entities;
+
+	// ascending entity tags per entity class, indexed by EntityClassInfo::m_index. Entries of entities that have been erased directly in m_map_entities are skipped when reading
+	std::vector<std::vector<int> >							m_entity_tags_by_class;
+	// rebuilt lazily by updateInverseIndex after materialize and materializeEntity, which only set m_inverse_index_outdated
+	mutable InverseIndex									m_inverse_index;
+	mutable std::atomic<bool>								m_inverse_index_outdated{ false };
+	InverseAttributeStorageEnum								m_inverse_attribute_storage = INVERSE_ATTRIBUTES_MEMBERS;
+
+	// arguments of lazily loaded entities that have not been parsed yet: offset and length in m_deferred_arguments_text, by entity tag
+	BuildingModelMapType<int, std::pair<size_t, size_t> >	m_deferred_arguments;
+	std::string												m_deferred_arguments_text;
+	// entities whose arguments are being parsed by materialize, outside of the mutex
+	std::unordered_set<int>									m_materializing_tags;
+	mutable std::mutex										m_mutex_deferred_arguments;
+	mutable std::condition_variable							m_condition_materialized;
 	int														m_max_entity_id = -1;
 	shared_ptr<IFC4X3::IfcProject>							m_ifc_project;
 	shared_ptr<IFC4X3::IfcGeometricRepresentationContext>	m_geom_context_3d;
@@ -106,5 +245,7 @@ private:
 	std::string											m_IFC_FILE_NAME;
 	SchemaVersionEnum									m_ifc_schema_version_loaded_file = IFC4X3;
 	SchemaVersionEnum									m_ifc_schema_version_current = IFC4X3;
+	shared_ptr<Executor>								m_executor;
+	size_t												m_grainSize = 0;
 	bool m_cancelLoading = false;
 };
@@ -22,17 +22,63 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <sstream>
 #include <vector>
 #include <limits>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include "ifcpp/model/BasicTypes.h"
 
 enum LogicalEnum { LOGICAL_TRUE, LOGICAL_FALSE, LOGICAL_UNKNOWN };
 
+struct SnapshotNode;
+struct SnapshotEncoder;
+
 class IFCQUERY_EXPORT BuildingObject
 {
 public:
 	virtual uint32_t classID() const = 0;
 	virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const = 0;
+
+	/** \brief Encodes the value for a binary snapshot, see SnapshotFormat.h. The default stores the text of getStepParameter, which ReaderSnapshot parses like a STEP argument */
+	virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const;
+
+	/** \brief Size of the object itself, sizeof of the most derived class. Used for memory reports, see BuildingModel::memoryReport */
+	virtual size_t getMemorySize() const { return sizeof( BuildingObject ); }
+
+	/** \brief Heap memory that the object owns directly, for example the characters of a string value. Referenced objects are not included */
+	virtual size_t getPayloadMemorySize() const { return 0; }
+};
+
+/** \brief Heap memory of a string, 0 if the characters are stored in the string object itself (small string optimization) */
+inline size_t getHeapMemorySize( const std::string& str )
+{
+	const char* data = str.data();
+	const char* begin = reinterpret_cast<const char*>( &str );
+	if( data >= begin && data < begin + sizeof( std::string ) )
+	{
+		return 0;
+	}
+	return str.capacity() + 1;
+}
+
+template<typename T>
+size_t getHeapMemorySize( const std::vector<T>& vec )
+{
+	return vec.capacity() * sizeof( T );
+}
+
+class BuildingEntity;
+class SnapshotArgument;
+class AttributeVisitor;
+
+/** \brief Reference from one entity to another entity, which has an inverse attribute for it */
+struct InverseReference
+{
+	InverseReference( BuildingEntity* target, uint16_t inverse_attribute ) : m_target(target), m_inverse_attribute(inverse_attribute)
+	{
+	}
+
+	BuildingEntity*	m_target;
+	uint16_t		m_inverse_attribute;
 };
 
 // ENTITY
@@ -52,11 +98,31 @@ public:
 	}
 	virtual uint32_t classID()  const override = 0;
 
+	/** \brief Position of the class in a depth first traversal of the inheritance tree. The subtypes of a class T have indexes in [T::CLASS_INDEX, T::CLASS_INDEX_END). */
+	virtual uint16_t classIndex() const = 0;
+
+	/** \brief Returns true if the entity is of type T or a subtype of T. Same result as dynamic_pointer_cast, but without RTTI lookup. */
+	template<typename T>
+	bool isA() const
+	{
+		const uint16_t index = classIndex();
+		return index >= T::CLASS_INDEX && index < T::CLASS_INDEX_END;
+	}
+
+	/** \brief Same as isA<T>(), for a class ID that is known at runtime only, for example IFCWALL. Returns false if ifcClassID is not an entity class. */
+	bool isA( uint32_t ifcClassID ) const;
+
 	/** \brief Appends a line in STEP format to stream, including all attributes. */
 	virtual void getStepLine(std::stringstream& stream, size_t precision) const = 0;
 
+	/** \brief Entities are encoded as reference to m_tag, like in getStepParameter */
+	virtual SnapshotNode getBinaryParameter( SnapshotEncoder& encoder ) const override;
+
 	/** \brief Reads all attributes from args. References to other entities are taken from map_entities. */
-	virtual void readStepArguments(const std::vector<std::string>& args, const std::unordered_map<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound) = 0;
+	virtual void readStepArguments(const std::vector<std::string>& args, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound) = 0;
+
+	/** \brief Same as readStepArguments, for arguments from a binary snapshot (see SnapshotFormat.h). Numbers and references are read without text parsing. */
+	virtual void readBinaryArguments(const std::vector<SnapshotArgument>& args, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound) = 0;
 
 	/** \brief Number of attributes, including inherited attributes, without inverse attributes */
 	virtual uint8_t getNumAttributes() const = 0;
@@ -67,12 +133,37 @@ public:
 	/** \brief Same as getAttributes, but for inverse attributes.*/
 	virtual void getAttributesInverse(std::vector<std::pair<std::string, shared_ptr<BuildingObject> > >& map_attributes) const = 0;
 
+	/** \brief Passes all attributes (including inherited attributes) with index, name and value to visitor. Unlike getAttributes, nothing is allocated, see AttributeVisitor.*/
+	virtual void visitAttributes( AttributeVisitor& visitor ) const = 0;
+
+	/** \brief Same as visitAttributes, but for inverse attributes.*/
+	virtual void visitAttributesInverse( AttributeVisitor& visitor ) const = 0;
+
 	/** \brief If there is a reference from object a to object b, and b has an inverse reference to a, the inverse reference is established here.*/
 	virtual void setInverseCounterparts(shared_ptr<BuildingEntity> ptr_self) = 0;
 
 	/** \brief Removes the inverse reference established in setInverseCounterparts.*/
 	virtual void unlinkFromInverseCounterparts() {}
 
+	/** \brief Adds the references for which the referenced entity has an inverse attribute. Same relations as setInverseCounterparts, but the referenced entities are not modified.*/
+	virtual void getInverseReferences( std::vector<InverseReference>& ) const {}
+
+	/** \brief Adds the entities that are referenced directly by attributes of this entity, including entities in lists and select attributes. Nothing is allocated apart from growing refs.*/
+	virtual void getEntityReferences( std::vector<BuildingEntity*>& ) const {}
+
 	/// Entity ID (same as STEP ID)
 	int m_tag;
 };
+
+/** \brief Cast of an entity to a subtype, for example entity_cast<IfcWall>(entity). Returns an empty pointer if the entity is not of type T.
+* Uses the class index instead of RTTI, so it is cheaper than dynamic_pointer_cast. The source type has to be BuildingEntity or an entity class, not a select type. */
+template<typename T, typename U>
+shared_ptr<T> entity_cast( const shared_ptr<U>& entity )
+{
+	static_assert(std::is_base_of<BuildingEntity, U>::value, "entity_cast requires a pointer to an entity");
+	if( entity && entity->template isA<T>() )
+	{
+		return std::static_pointer_cast<T>(entity);
+	}
+	return shared_ptr<T>();
+}
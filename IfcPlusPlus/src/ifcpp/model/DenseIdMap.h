@@ -0,0 +1,395 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*! \brief Map from integer ids to values, with the interface of std::unordered_map.
+*
+* STEP ids are almost always dense 1..N, so values are stored in a vector indexed by id, with holes for unused ids.
+* Each slot of the vector keeps its id as key, and a separate flag per slot tells if it holds a value. Keys are const, as in std::unordered_map.
+* Ids that are negative or far beyond the number of stored values go to an ordered std::map, so that a file with a few huge ids does not allocate a huge vector.
+* Iteration is ordered by id for non-negative ids. Lookup of a dense id is a bounds check and one flag.
+*/
+template<typename Key, typename T>
+class DenseIdMap
+{
+	static_assert(std::is_integral<Key>::value && std::is_signed<Key>::value, "DenseIdMap requires a signed integer key");
+
+public:
+	typedef Key						key_type;
+	typedef T						mapped_type;
+	typedef std::pair<const Key, T>	value_type;
+	typedef size_t					size_type;
+
+	/** Ids below this value are always stored in the dense part */
+	static constexpr size_t MIN_DENSE_RANGE = 1024;
+
+	/** Ids up to this multiple of the number of stored values are stored in the dense part */
+	static constexpr size_t MAX_DENSE_RANGE_PER_VALUE = 4;
+
+private:
+	typedef std::map<Key, value_type> SparseMap;
+
+	template<bool IsConst>
+	class iterator_base
+	{
+		friend class DenseIdMap;
+		typedef typename std::conditional<IsConst, const DenseIdMap, DenseIdMap>::type map_t;
+		typedef typename std::conditional<IsConst, typename SparseMap::const_iterator, typename SparseMap::iterator>::type sparse_iterator;
+
+		map_t*			m_map = nullptr;
+		size_t			m_dense_index = 0;
+		sparse_iterator	m_sparse_it;
+
+		iterator_base(map_t* map, size_t dense_index, sparse_iterator sparse_it) : m_map(map), m_dense_index(dense_index), m_sparse_it(sparse_it) {}
+
+		void skipHoles()
+		{
+			while( m_dense_index < m_map->m_dense.size() && !m_map->m_dense_used[m_dense_index] )
+			{
+				++m_dense_index;
+			}
+		}
+
+	public:
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef typename DenseIdMap::value_type	value_type;
+		typedef std::ptrdiff_t				difference_type;
+		typedef typename std::conditional<IsConst, const value_type*, value_type*>::type pointer;
+		typedef typename std::conditional<IsConst, const value_type&, value_type&>::type reference;
+
+		iterator_base() = default;
+
+		// iterator converts to const_iterator
+		template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+		iterator_base(const iterator_base<OtherConst>& other) : m_map(other.m_map), m_dense_index(other.m_dense_index), m_sparse_it(other.m_sparse_it) {}
+
+		reference operator*() const
+		{
+			if( m_dense_index < m_map->m_dense.size() )
+			{
+				return m_map->m_dense[m_dense_index];
+			}
+			return m_sparse_it->second;
+		}
+
+		pointer operator->() const
+		{
+			return &(**this);
+		}
+
+		iterator_base& operator++()
+		{
+			if( m_dense_index < m_map->m_dense.size() )
+			{
+				++m_dense_index;
+				skipHoles();
+			}
+			else
+			{
+				++m_sparse_it;
+			}
+			return *this;
+		}
+
+		iterator_base operator++(int)
+		{
+			iterator_base tmp(*this);
+			++(*this);
+			return tmp;
+		}
+
+		bool operator==(const iterator_base& other) const
+		{
+			if( m_dense_index != other.m_dense_index )
+			{
+				return false;
+			}
+			if( m_dense_index < m_map->m_dense.size() )
+			{
+				return true;
+			}
+			return m_sparse_it == other.m_sparse_it;
+		}
+
+		bool operator!=(const iterator_base& other) const
+		{
+			return !(*this == other);
+		}
+
+		template<bool> friend class iterator_base;
+	};
+
+public:
+	typedef iterator_base<false>	iterator;
+	typedef iterator_base<true>		const_iterator;
+
+	DenseIdMap() = default;
+
+	DenseIdMap(const DenseIdMap& other) = default;
+
+	// the keys are const, so the vector cannot assign its elements
+	DenseIdMap& operator=(const DenseIdMap& other)
+	{
+		if( this != &other )
+		{
+			DenseIdMap copy(other);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	void swap(DenseIdMap& other)
+	{
+		m_dense.swap(other.m_dense);
+		m_dense_used.swap(other.m_dense_used);
+		m_sparse.swap(other.m_sparse);
+		std::swap(m_size, other.m_size);
+		std::swap(m_dense_enabled, other.m_dense_enabled);
+	}
+
+	/** Disabling the dense part keeps all values in the ordered std::map, for example if ids are known to be scattered */
+	void setDenseStorageEnabled(bool enabled)
+	{
+		if( enabled == m_dense_enabled )
+		{
+			return;
+		}
+
+		std::vector<value_type> values;
+		values.reserve(m_size);
+		for( auto it = begin(); it != end(); ++it )
+		{
+			values.push_back(std::move(*it));
+		}
+		clear();
+		m_dense_enabled = enabled;
+		for( value_type& value : values )
+		{
+			insert(std::move(value));
+		}
+	}
+
+	bool isDenseStorageEnabled() const { return m_dense_enabled; }
+
+	iterator begin()
+	{
+		iterator it(this, 0, m_sparse.begin());
+		it.skipHoles();
+		return it;
+	}
+
+	const_iterator begin() const
+	{
+		const_iterator it(this, 0, m_sparse.begin());
+		it.skipHoles();
+		return it;
+	}
+
+	const_iterator cbegin() const { return begin(); }
+
+	iterator end() { return iterator(this, m_dense.size(), m_sparse.end()); }
+	const_iterator end() const { return const_iterator(this, m_dense.size(), m_sparse.end()); }
+	const_iterator cend() const { return end(); }
+
+	size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+	iterator find(Key key)
+	{
+		if( isDenseKey(key) )
+		{
+			if( m_dense_used[size_t(key)] )
+			{
+				return iterator(this, size_t(key), m_sparse.begin());
+			}
+			return end();
+		}
+		return iterator(this, m_dense.size(), m_sparse.find(key));
+	}
+
+	const_iterator find(Key key) const
+	{
+		if( isDenseKey(key) )
+		{
+			if( m_dense_used[size_t(key)] )
+			{
+				return const_iterator(this, size_t(key), m_sparse.begin());
+			}
+			return end();
+		}
+		return const_iterator(this, m_dense.size(), m_sparse.find(key));
+	}
+
+	size_t count(Key key) const
+	{
+		return find(key) != end() ? 1 : 0;
+	}
+
+	std::pair<iterator, bool> insert(const value_type& value)
+	{
+		return emplace(value.first, value.second);
+	}
+
+	std::pair<iterator, bool> insert(value_type&& value)
+	{
+		return emplace(value.first, std::move(value.second));
+	}
+
+	/** The hint is ignored, the position of a value is given by its id */
+	iterator insert(const_iterator /*hint*/, const value_type& value)
+	{
+		return insert(value).first;
+	}
+
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Key key, Args&&... args)
+	{
+		iterator it = find(key);
+		if( it != end() )
+		{
+			return std::make_pair(it, false);
+		}
+
+		if( key >= 0 && size_t(key) >= m_dense.size() && m_dense_enabled && size_t(key) < maxDenseRange() )
+		{
+			growDense(size_t(key) + 1);
+		}
+
+		if( isDenseKey(key) )
+		{
+			m_dense[size_t(key)].second = T(std::forward<Args>(args)...);
+			m_dense_used[size_t(key)] = 1;
+			++m_size;
+			return std::make_pair(iterator(this, size_t(key), m_sparse.begin()), true);
+		}
+
+		auto it_sparse = m_sparse.emplace(key, value_type(key, T(std::forward<Args>(args)...))).first;
+		++m_size;
+		return std::make_pair(iterator(this, m_dense.size(), it_sparse), true);
+	}
+
+	T& operator[](Key key)
+	{
+		return emplace(key).first->second;
+	}
+
+	iterator erase(const_iterator pos)
+	{
+		if( pos.m_dense_index < m_dense.size() )
+		{
+			m_dense[pos.m_dense_index].second = T();
+			m_dense_used[pos.m_dense_index] = 0;
+			--m_size;
+			iterator next(this, pos.m_dense_index, m_sparse.begin());
+			next.skipHoles();
+			return next;
+		}
+
+		--m_size;
+		return iterator(this, m_dense.size(), m_sparse.erase(pos.m_sparse_it));
+	}
+
+	iterator erase(iterator pos)
+	{
+		return erase(const_iterator(pos));
+	}
+
+	size_t erase(Key key)
+	{
+		iterator it = find(key);
+		if( it == end() )
+		{
+			return 0;
+		}
+		erase(it);
+		return 1;
+	}
+
+	void clear()
+	{
+		std::vector<value_type>().swap(m_dense);
+		std::vector<char>().swap(m_dense_used);
+		m_sparse.clear();
+		m_size = 0;
+	}
+
+	/** Reserves memory in the dense part for ids below num_ids, for example for the highest id of a file that is about to be read */
+	void reserve(size_t num_ids)
+	{
+		if( m_dense_enabled )
+		{
+			m_dense.reserve(num_ids);
+			m_dense_used.reserve(num_ids);
+		}
+	}
+
+	/** Number of slots in the dense part, including holes */
+	size_t denseCapacity() const { return m_dense.size(); }
+
+	/** Number of values that are stored in the ordered fallback map */
+	size_t sparseSize() const { return m_sparse.size(); }
+
+	/** Approximate heap memory of the map, without the memory that the values own. Nodes of the fallback map are estimated with four pointers of overhead */
+	size_t getMemoryUsage() const { return m_dense.capacity()*sizeof(value_type) + m_dense_used.capacity() + m_sparse.size()*(sizeof(typename SparseMap::value_type) + 4*sizeof(void*)); }
+
+private:
+	std::vector<value_type>	m_dense;
+	std::vector<char>		m_dense_used;	// 1 if the slot with the same index holds a value
+	SparseMap				m_sparse;
+	size_t					m_size = 0;
+	bool					m_dense_enabled = true;
+
+	bool isDenseKey(Key key) const
+	{
+		return key >= 0 && size_t(key) < m_dense.size();
+	}
+
+	size_t maxDenseRange() const
+	{
+		return std::max(MIN_DENSE_RANGE, (m_size + 1) * MAX_DENSE_RANGE_PER_VALUE);
+	}
+
+	void growDense(size_t min_size)
+	{
+		size_t old_size = m_dense.size();
+		size_t new_size = std::max(min_size, old_size + old_size / 2);
+		m_dense.reserve(new_size);
+		for( size_t ii = old_size; ii < new_size; ++ii )
+		{
+			m_dense.emplace_back(Key(ii), T());
+		}
+		m_dense_used.resize(new_size, 0);
+
+		// ids that were too large for the dense part before are moved over, so that each id is stored in one place only
+		auto it_sparse = m_sparse.lower_bound(Key(old_size));
+		while( it_sparse != m_sparse.end() && size_t(it_sparse->first) < new_size )
+		{
+			m_dense[size_t(it_sparse->first)].second = std::move(it_sparse->second.second);
+			m_dense_used[size_t(it_sparse->first)] = 1;
+			it_sparse = m_sparse.erase(it_sparse);
+		}
+	}
+};
@@ -0,0 +1,205 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include "Executor.h"
+
+static std::mutex s_default_executor_mutex;
+static shared_ptr<Executor> s_default_executor;
+
+shared_ptr<Executor> Executor::getDefault()
+{
+	std::lock_guard<std::mutex> lock( s_default_executor_mutex );
+	if( !s_default_executor )
+	{
+#if defined(_DEBUG_LOOP_SEQENTIAL) || defined(_DEBUG)
+		s_default_executor = make_shared<SerialExecutor>();
+#else
+		s_default_executor = make_shared<ThreadPoolExecutor>();
+#endif
+	}
+	return s_default_executor;
+}
+
+void Executor::setDefault( const shared_ptr<Executor>& executor )
+{
+	std::lock_guard<std::mutex> lock( s_default_executor_mutex );
+	s_default_executor = executor;
+}
+
+void SerialExecutor::parallelForRange( size_t begin, size_t end, size_t /*grainSize*/, const std::function<void(size_t, size_t)>& rangeFunc )
+{
+	if( begin < end )
+	{
+		rangeFunc( begin, end );
+	}
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor( size_t numThreads, const std::function<void(size_t)>& onWorkerStart )
+{
+	if( numThreads == 0 )
+	{
+		numThreads = std::max( 1u, std::thread::hardware_concurrency() );
+	}
+
+	for( size_t ii = 1; ii < numThreads; ++ii )
+	{
+		m_workers.emplace_back( &ThreadPoolExecutor::workerThread, this, ii - 1, onWorkerStart );
+	}
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_stop = true;
+	}
+	m_work_available.notify_all();
+	for( std::thread& worker : m_workers )
+	{
+		worker.join();
+	}
+}
+
+bool ThreadPoolExecutor::runRanges( Loop& loop )
+{
+	bool ran = false;
+	while( true )
+	{
+		const size_t rangeIndex = loop.m_nextRange.fetch_add( 1 );
+		if( rangeIndex >= loop.m_numRanges )
+		{
+			return ran;
+		}
+		ran = true;
+
+		if( !loop.m_cancelled )
+		{
+			const size_t rangeBegin = loop.m_begin + rangeIndex*loop.m_grainSize;
+			const size_t rangeEnd = std::min( loop.m_end, rangeBegin + loop.m_grainSize );
+			try
+			{
+				( *loop.m_rangeFunc )( rangeBegin, rangeEnd );
+			}
+			catch( ... )
+			{
+				std::lock_guard<std::mutex> lock( loop.m_mutex );
+				if( !loop.m_exception )
+				{
+					loop.m_exception = std::current_exception();
+				}
+				loop.m_cancelled = true;
+			}
+		}
+
+		if( loop.m_numRangesDone.fetch_add( 1 ) + 1 == loop.m_numRanges )
+		{
+			std::lock_guard<std::mutex> lock( loop.m_mutex );
+			loop.m_done.notify_all();
+		}
+	}
+}
+
+void ThreadPoolExecutor::parallelForRange( size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& rangeFunc )
+{
+	if( begin >= end )
+	{
+		return;
+	}
+
+	const size_t numIndexes = end - begin;
+	if( grainSize == 0 )
+	{
+		grainSize = getAutomaticGrainSize( numIndexes );
+	}
+
+	if( m_workers.empty() || grainSize >= numIndexes )
+	{
+		rangeFunc( begin, end );
+		return;
+	}
+
+	shared_ptr<Loop> loop = make_shared<Loop>();
+	loop->m_begin = begin;
+	loop->m_end = end;
+	loop->m_grainSize = grainSize;
+	loop->m_numRanges = ( numIndexes + grainSize - 1 )/grainSize;
+	loop->m_rangeFunc = &rangeFunc;
+
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_loops.push_back( loop );
+	}
+	m_work_available.notify_all();
+
+	runRanges( *loop );
+
+	{
+		// all ranges are taken, workers may still be running some of them
+		std::unique_lock<std::mutex> lock( loop->m_mutex );
+		loop->m_done.wait( lock, [&loop]() { return loop->m_numRangesDone == loop->m_numRanges; } );
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		auto it_find = std::find( m_loops.begin(), m_loops.end(), loop );
+		if( it_find != m_loops.end() )
+		{
+			m_loops.erase( it_find );
+		}
+	}
+
+	if( loop->m_exception )
+	{
+		std::rethrow_exception( loop->m_exception );
+	}
+}
+
+void ThreadPoolExecutor::workerThread( size_t workerIndex, std::function<void(size_t)> onWorkerStart )
+{
+	if( onWorkerStart )
+	{
+		onWorkerStart( workerIndex );
+	}
+
+	while( true )
+	{
+		shared_ptr<Loop> loop;
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_work_available.wait( lock, [this]() { return m_stop || !m_loops.empty(); } );
+			if( m_stop )
+			{
+				return;
+			}
+
+			// take the most recent loop, which is the innermost one of nested loops
+			loop = m_loops.back();
+		}
+
+		if( !runRanges( *loop ) )
+		{
+			// all ranges of the loop are taken already, so it does not need more workers
+			std::lock_guard<std::mutex> lock( m_mutex );
+			auto it_find = std::find( m_loops.begin(), m_loops.end(), loop );
+			if( it_find != m_loops.end() )
+			{
+				m_loops.erase( it_find );
+			}
+		}
+	}
+}
@@ -0,0 +1,135 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "GlobalDefines.h"
+
+/*! \brief Runs the parallel loops of the library, for example parsing of entities in ReaderSTEP and conversion of products in GeometryConverter.
+*
+* ReaderSTEP, WriterSTEP, GeometryConverter, BuildingModel and the snapshot reader and writer use Executor::getDefault() unless an executor is set with setExecutor.
+* To limit the number of threads of a model, or to share threads between models that are loaded at the same time, set the same ThreadPoolExecutor for all of them.
+* To run the loops in an existing thread pool or task library, derive from Executor and implement parallelForRange.
+*/
+class IFCQUERY_EXPORT Executor
+{
+public:
+	virtual ~Executor() = default;
+
+	/*! \brief Splits [begin, end) into ranges of grainSize indexes and calls rangeFunc( rangeBegin, rangeEnd ) for each of them, possibly in parallel. Returns when all ranges are done.
+	  \param[in] grainSize Number of indexes per call, 0 to choose it from the number of indexes and threads. Loops with many small tasks need larger ranges.
+	  If rangeFunc throws, the remaining ranges are skipped and the first exception is thrown again in the calling thread. */
+	virtual void parallelForRange( size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& rangeFunc ) = 0;
+
+	/*! \brief Maximum number of threads that run loops, including the calling thread */
+	virtual size_t getConcurrency() const = 0;
+
+	/*! \brief Calls func for all elements in [first, last), a range of random access iterators, like std::for_each */
+	template<typename TIterator, typename TFunc>
+	void forEach( TIterator first, TIterator last, TFunc func, size_t grainSize = 0 )
+	{
+		parallelForRange( 0, std::distance( first, last ), grainSize, [&]( size_t rangeBegin, size_t rangeEnd ) {
+			for( size_t ii = rangeBegin; ii < rangeEnd; ++ii )
+			{
+				func( *( first + ii ) );
+			}
+		});
+	}
+
+	/*! \brief Grain size for parallelForRange with grainSize 0: about 8 ranges per thread, so that threads that finish early can take over work */
+	size_t getAutomaticGrainSize( size_t numIndexes ) const
+	{
+		const size_t numRanges = getConcurrency()*8;
+		return std::max( size_t(1), ( numIndexes + numRanges - 1 )/numRanges );
+	}
+
+	/*! \brief Executor for all objects that have no executor set. Initially a ThreadPoolExecutor with one thread per hardware thread, created on first use (a SerialExecutor in debug builds) */
+	static shared_ptr<Executor> getDefault();
+	static void setDefault( const shared_ptr<Executor>& executor );
+
+	/*! \brief Returns executor if it is set, otherwise getDefault() */
+	static Executor& get( const shared_ptr<Executor>& executor )
+	{
+		return executor ? *executor : *getDefault();
+	}
+};
+
+/*! \brief Runs all loops in the calling thread */
+class IFCQUERY_EXPORT SerialExecutor : public Executor
+{
+public:
+	void parallelForRange( size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& rangeFunc ) override;
+	size_t getConcurrency() const override { return 1; }
+};
+
+/*! \brief Thread pool for parallel loops. The calling thread works on its own loop, and idle worker threads take ranges from any running loop.
+*
+* Loops can be nested, for example a parallel loop in the geometry conversion of a product: the inner loop is run by the thread that starts it, with help from idle workers, so it does not wait for a free thread.
+*
+* There are no per-thread task queues. Each loop hands out its ranges with one atomic counter, so threads that finish early simply take the next range, which balances the load like work stealing.
+* The mutex of the pool only guards the list of running loops. It is locked when a loop starts or ends and when a worker looks for a loop, not per range.
+*/
+class IFCQUERY_EXPORT ThreadPoolExecutor : public Executor
+{
+public:
+	/*! \brief Constructor.
+	  \param[in] numThreads Number of threads including the calling thread, so numThreads-1 worker threads are started. 0 for std::thread::hardware_concurrency().
+	  \param[in] onWorkerStart Called in each worker thread before it takes work, with the worker index. Can be used to pin the thread to a core or to name it. */
+	explicit ThreadPoolExecutor( size_t numThreads = 0, const std::function<void(size_t)>& onWorkerStart = nullptr );
+	~ThreadPoolExecutor() override;
+
+	void parallelForRange( size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& rangeFunc ) override;
+	size_t getConcurrency() const override { return m_workers.size() + 1; }
+
+private:
+	struct Loop
+	{
+		size_t m_begin = 0;
+		size_t m_end = 0;
+		size_t m_grainSize = 1;
+		size_t m_numRanges = 0;
+		const std::function<void(size_t, size_t)>* m_rangeFunc = nullptr;
+		std::atomic<size_t> m_nextRange{ 0 };
+		std::atomic<size_t> m_numRangesDone{ 0 };
+		std::atomic<bool> m_cancelled{ false };
+		std::exception_ptr m_exception;
+		std::mutex m_mutex;
+		std::condition_variable m_done;
+	};
+
+	/*! \brief Runs ranges of loop until none is left. Returns false if there was no range left to take */
+	static bool runRanges( Loop& loop );
+	void workerThread( size_t workerIndex, std::function<void(size_t)> onWorkerStart );
+
+	std::vector<std::thread>		m_workers;
+	std::deque<shared_ptr<Loop> >	m_loops;
+	std::mutex						m_mutex;
+	std::condition_variable			m_work_available;
+	bool							m_stop = false;
+};
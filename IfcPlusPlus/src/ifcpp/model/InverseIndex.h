@@ -0,0 +1,173 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include "BasicTypes.h"
+#include "BuildingObject.h"
+#include "Executor.h"
+
+/*! \brief Model wide table of inverse attributes, as alternative to the weak_ptr vectors in each entity.
+*
+* The table is stored in compressed sparse row format: one row per referenced entity, and within a row the tags of the referencing entities, sorted by inverse attribute and tag.
+* It is built in one pass over the model from BuildingEntity::getInverseReferences, and costs 6 bytes per reference plus 8 bytes per referenced entity.
+* Entities are stored as tags, so the table does not keep entities alive. It is not updated when entities are added or removed, build it again after modifying the model.
+*/
+class InverseIndex
+{
+public:
+	/** Replaces the content with the inverse references of all entities in map_entities. The references are collected in parallel loops of executor */
+	void build( const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities, Executor& executor )
+	{
+		clear();
+
+		std::vector<BuildingEntity*> vec_entities;
+		vec_entities.reserve( map_entities.size() );
+		for( auto it = map_entities.begin(); it != map_entities.end(); ++it )
+		{
+			if( it->second )
+			{
+				vec_entities.push_back( it->second.get() );
+			}
+		}
+
+		// collect the references per range of the parallel loop, so that the virtual calls run in parallel. The executor decides where ranges begin, so each range fills its own vector and hands it over under the mutex
+		const size_t numEntities = vec_entities.size();
+		const size_t grainSize = 4096;
+		std::vector<std::pair<size_t, std::vector<Reference> > > rangeReferences;
+		std::mutex mutexRangeReferences;
+
+		executor.parallelForRange( 0, numEntities, grainSize, [&]( size_t entityBegin, size_t entityEnd ) {
+			std::vector<InverseReference> refs;
+			std::vector<Reference> rangeRefs;
+			for( size_t ii = entityBegin; ii < entityEnd; ++ii )
+			{
+				const BuildingEntity* source = vec_entities[ii];
+				refs.clear();
+				source->getInverseReferences( refs );
+				for( const InverseReference& ref : refs )
+				{
+					if( ref.m_target && ref.m_target->m_tag >= 0 )
+					{
+						rangeRefs.push_back( { ref.m_target->m_tag, source->m_tag, ref.m_inverse_attribute } );
+					}
+				}
+			}
+
+			if( rangeRefs.size() > 0 )
+			{
+				std::lock_guard<std::mutex> lock( mutexRangeReferences );
+				rangeReferences.emplace_back( entityBegin, std::move( rangeRefs ) );
+			}
+		});
+
+		size_t numReferences = 0;
+		for( const std::pair<size_t, std::vector<Reference> >& range : rangeReferences )
+		{
+			numReferences += range.second.size();
+		}
+
+		std::vector<Reference> references;
+		references.reserve( numReferences );
+		for( std::pair<size_t, std::vector<Reference> >& range : rangeReferences )
+		{
+			references.insert( references.end(), range.second.begin(), range.second.end() );
+			std::vector<Reference>().swap( range.second );
+		}
+
+		std::sort( references.begin(), references.end(), []( const Reference& a, const Reference& b ) {
+			if( a.m_target_tag != b.m_target_tag ) return a.m_target_tag < b.m_target_tag;
+			if( a.m_inverse_attribute != b.m_inverse_attribute ) return a.m_inverse_attribute < b.m_inverse_attribute;
+			return a.m_source_tag < b.m_source_tag;
+		});
+		references.erase( std::unique( references.begin(), references.end(), []( const Reference& a, const Reference& b ) {
+			return a.m_target_tag == b.m_target_tag && a.m_inverse_attribute == b.m_inverse_attribute && a.m_source_tag == b.m_source_tag;
+		}), references.end() );
+
+		m_source_tags.reserve( references.size() );
+		m_inverse_attributes.reserve( references.size() );
+		for( const Reference& ref : references )
+		{
+			if( m_target_tags.empty() || m_target_tags.back() != ref.m_target_tag )
+			{
+				m_target_tags.push_back( ref.m_target_tag );
+				m_row_begin.push_back( uint32_t( m_source_tags.size() ) );
+			}
+			m_source_tags.push_back( ref.m_source_tag );
+			m_inverse_attributes.push_back( ref.m_inverse_attribute );
+		}
+		m_row_begin.push_back( uint32_t( m_source_tags.size() ) );
+		m_built = true;
+	}
+
+	void clear()
+	{
+		std::vector<int>().swap( m_target_tags );
+		std::vector<uint32_t>().swap( m_row_begin );
+		std::vector<int>().swap( m_source_tags );
+		std::vector<uint16_t>().swap( m_inverse_attributes );
+		m_built = false;
+	}
+
+	bool isBuilt() const { return m_built; }
+
+	/** Number of stored references */
+	size_t getNumReferences() const { return m_source_tags.size(); }
+
+	/** Tags of the entities that reference target_tag with the given inverse attribute, in ascending order. Returns an empty range if there are none */
+	std::pair<const int*, const int*> getSourceTags( int target_tag, uint16_t inverse_attribute ) const
+	{
+		auto it_target = std::lower_bound( m_target_tags.begin(), m_target_tags.end(), target_tag );
+		if( it_target == m_target_tags.end() || *it_target != target_tag )
+		{
+			return std::make_pair( nullptr, nullptr );
+		}
+
+		const size_t row = size_t( it_target - m_target_tags.begin() );
+		const uint16_t* attributes_begin = m_inverse_attributes.data() + m_row_begin[row];
+		const uint16_t* attributes_end = m_inverse_attributes.data() + m_row_begin[row + 1];
+		auto range = std::equal_range( attributes_begin, attributes_end, inverse_attribute );
+		const int* sources = m_source_tags.data();
+		return std::make_pair( sources + ( range.first - m_inverse_attributes.data() ), sources + ( range.second - m_inverse_attributes.data() ) );
+	}
+
+	/** Memory used by the table, in bytes */
+	size_t getMemoryUsage() const
+	{
+		return m_target_tags.capacity()*sizeof(int) + m_row_begin.capacity()*sizeof(uint32_t) + m_source_tags.capacity()*sizeof(int) + m_inverse_attributes.capacity()*sizeof(uint16_t);
+	}
+
+private:
+	struct Reference
+	{
+		int			m_target_tag;
+		int			m_source_tag;
+		uint16_t	m_inverse_attribute;
+	};
+
+	std::vector<int>		m_target_tags;			// ascending, one row per referenced entity
+	std::vector<uint32_t>	m_row_begin;			// m_target_tags.size() + 1 offsets into m_source_tags
+	std::vector<int>		m_source_tags;
+	std::vector<uint16_t>	m_inverse_attributes;	// parallel to m_source_tags
+	bool					m_built = false;
+};
@@ -0,0 +1,539 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ifcpp/model/AttributeObject.h"
+#include "ifcpp/writer/WriterUtil.h"
+
+/*! \file SnapshotFormat.h
+* \brief Binary layout of a model snapshot, written by WriterSnapshot and read by ReaderSnapshot.
+*
+* A snapshot consists of a SnapshotFileHeader, followed by four arrays that each start at a multiple of 8 bytes, so that a memory mapped file can be read in place:
+*  - SnapshotEntity records: class ID, tag and the range of top level argument nodes of each entity
+*  - SnapshotNode: one node per argument. Scalars are stored in the node, flat lists of numbers or references in the word array, other lists as child nodes
+*  - 8 byte words: int64 for integers and entity ids, double for reals
+*  - string pool: characters of string values, and STEP text of types that have no binary encoding
+* Values of type objects keep the class ID of the type, for example IFCLABEL, so that select attributes are read without text parsing.
+* Values are stored in the byte order of the writing machine, the reader rejects snapshots with a different byte order.
+*/
+
+static const char SNAPSHOT_MAGIC[8] = { 'I', 'F', 'C', 'P', 'P', 'S', 'N', 'P' };
+static const uint32_t SNAPSHOT_VERSION = 2;
+static const uint32_t SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+
+/** Position of a string in the string pool */
+struct SnapshotString
+{
+	uint64_t m_offset;
+	uint64_t m_size;
+};
+
+struct SnapshotFileHeader
+{
+	char			m_magic[8];
+	uint32_t		m_version;
+	uint32_t		m_byte_order_mark;
+	uint32_t		m_schema_version_loaded_file;	// BuildingModel::SchemaVersionEnum
+	uint32_t		m_reserved;
+	uint64_t		m_num_entities;
+	uint64_t		m_num_nodes;
+	uint64_t		m_num_words;
+	uint64_t		m_string_pool_size;
+	SnapshotString	m_file_header;
+	SnapshotString	m_file_description;
+	SnapshotString	m_file_name;
+};
+
+struct SnapshotEntity
+{
+	uint32_t	m_class_id;
+	int32_t		m_tag;
+	uint32_t	m_first_argument;
+	uint32_t	m_num_arguments;
+};
+
+/** Scalars of type objects have the class ID of the type in m_size, plain values have 0 */
+enum SnapshotNodeKind : uint8_t
+{
+	SNAPSHOT_NULL,				// $
+	SNAPSHOT_DERIVED,			// *
+	SNAPSHOT_REFERENCE,			// #12, id in m_integer
+	SNAPSHOT_INTEGER,			// m_integer
+	SNAPSHOT_REAL,				// m_real
+	SNAPSHOT_TEXT,				// STEP text of the argument, m_size characters at m_offset in the string pool
+	SNAPSHOT_REFERENCE_ARRAY,	// m_size entity ids at word m_offset
+	SNAPSHOT_INTEGER_ARRAY,		// m_size integers at word m_offset
+	SNAPSHOT_REAL_ARRAY,		// m_size reals at word m_offset
+	SNAPSHOT_LIST,				// m_size child nodes, starting at node m_offset
+	SNAPSHOT_ENUM,				// value of the enum in m_integer, for example IfcWallTypeEnum::ENUM_MOVABLE
+	SNAPSHOT_LOGICAL,			// m_integer 0 for false, 1 for true, 2 for unknown
+	SNAPSHOT_STRING,			// string value without quotes and escape sequences, m_size characters at m_offset in the string pool
+	SNAPSHOT_TYPED				// class ID of a type in m_size, the value is the child node m_offset. Used for strings and lists of type objects
+};
+
+struct SnapshotNode
+{
+	uint8_t		m_kind;
+	uint8_t		m_padding[3];
+	uint32_t	m_size;
+	union
+	{
+		int64_t		m_integer;
+		double		m_real;
+		uint64_t	m_offset;
+	};
+};
+
+static_assert(sizeof(SnapshotFileHeader) % 8 == 0 && sizeof(SnapshotEntity) % 8 == 0 && sizeof(SnapshotNode) == 16, "snapshot records need to keep 8 byte alignment");
+
+/** Pointers to the node, word and string arrays of a snapshot */
+struct SnapshotSections
+{
+	const SnapshotNode*	m_nodes = nullptr;
+	const uint64_t*		m_words = nullptr;
+	const char*			m_strings = nullptr;
+};
+
+/** \brief Read only view of one argument in a snapshot, passed to BuildingEntity::readBinaryArguments.
+*
+* toString() returns the argument in the form that readStepArguments expects, so each attribute can fall back to the text parser.
+*/
+class SnapshotArgument
+{
+public:
+	SnapshotArgument( const SnapshotNode* node, const SnapshotSections* sections ) : m_node(node), m_sections(sections)
+	{
+	}
+
+	SnapshotNodeKind kind() const { return SnapshotNodeKind(m_node->m_kind); }
+
+	/** True for $, * and empty arguments, which are read as unset attributes */
+	bool isEmpty() const
+	{
+		return m_node->m_kind == SNAPSHOT_NULL || m_node->m_kind == SNAPSHOT_DERIVED || ( m_node->m_kind == SNAPSHOT_TEXT && m_node->m_size == 0 );
+	}
+
+	bool isNumber() const { return m_node->m_kind == SNAPSHOT_INTEGER || m_node->m_kind == SNAPSHOT_REAL; }
+	bool isNumberArray() const { return m_node->m_kind == SNAPSHOT_INTEGER_ARRAY || m_node->m_kind == SNAPSHOT_REAL_ARRAY; }
+	bool isEmptyList() const { return m_node->m_kind == SNAPSHOT_LIST && m_node->m_size == 0; }
+
+	/** Entity id of a reference */
+	int64_t entityId() const { return m_node->m_integer; }
+
+	/** Value of an integer or real, converted if necessary */
+	int64_t integerValue() const { return m_node->m_kind == SNAPSHOT_REAL ? int64_t(m_node->m_real) : m_node->m_integer; }
+	double realValue() const { return m_node->m_kind == SNAPSHOT_REAL ? m_node->m_real : double(m_node->m_integer); }
+
+	const char* text() const { return m_sections->m_strings + m_node->m_offset; }
+
+	/** Number of characters of a text, elements of an array, or children of a list */
+	size_t size() const { return m_node->m_size; }
+
+	/** Element of a reference or integer array */
+	int64_t integerAt( size_t index ) const
+	{
+		const uint64_t word = m_sections->m_words[m_node->m_offset + index];
+		if( m_node->m_kind == SNAPSHOT_REAL_ARRAY )
+		{
+			return int64_t(bitsToDouble(word));
+		}
+		return int64_t(word);
+	}
+
+	/** Element of an integer or real array */
+	double realAt( size_t index ) const
+	{
+		const uint64_t word = m_sections->m_words[m_node->m_offset + index];
+		if( m_node->m_kind == SNAPSHOT_REAL_ARRAY )
+		{
+			return bitsToDouble(word);
+		}
+		return double(int64_t(word));
+	}
+
+	SnapshotArgument child( size_t index ) const
+	{
+		return SnapshotArgument(m_sections->m_nodes + m_node->m_offset + index, m_sections);
+	}
+
+	/** Class ID of the type object that was written, for example IFCLENGTHMEASURE. 0 for references and plain values */
+	uint32_t typeClassID() const
+	{
+		switch( m_node->m_kind )
+		{
+		case SNAPSHOT_INTEGER:
+		case SNAPSHOT_REAL:
+		case SNAPSHOT_ENUM:
+		case SNAPSHOT_LOGICAL:
+		case SNAPSHOT_TYPED:
+			return m_node->m_size;
+		default:
+			return 0;
+		}
+	}
+
+	/** The argument without SNAPSHOT_TYPED nodes, for example the string of a typed string */
+	SnapshotArgument value() const
+	{
+		const SnapshotNode* node = m_node;
+		while( node->m_kind == SNAPSHOT_TYPED )
+		{
+			node = m_sections->m_nodes + node->m_offset;
+		}
+		return SnapshotArgument(node, m_sections);
+	}
+
+	const SnapshotSections* sections() const { return m_sections; }
+
+	/** The argument in STEP syntax, as it was passed to readStepArguments. Reals are written with the shortest text that reads back to the same value.
+	* Enums have no text in the snapshot, they are written as number. Typed values are written without the type name. */
+	std::string toString() const
+	{
+		std::string result;
+		appendString(result);
+		return result;
+	}
+
+	void appendString( std::string& str ) const
+	{
+		switch( m_node->m_kind )
+		{
+		case SNAPSHOT_NULL:
+			str += '$';
+			break;
+		case SNAPSHOT_DERIVED:
+			str += '*';
+			break;
+		case SNAPSHOT_REFERENCE:
+			str += '#';
+			appendInteger(str, m_node->m_integer);
+			break;
+		case SNAPSHOT_INTEGER:
+			appendInteger(str, m_node->m_integer);
+			break;
+		case SNAPSHOT_REAL:
+			appendReal(str, m_node->m_real);
+			break;
+		case SNAPSHOT_TEXT:
+			str.append(text(), m_node->m_size);
+			break;
+		case SNAPSHOT_REFERENCE_ARRAY:
+		case SNAPSHOT_INTEGER_ARRAY:
+		case SNAPSHOT_REAL_ARRAY:
+			str += '(';
+			for( size_t ii = 0; ii < m_node->m_size; ++ii )
+			{
+				if( ii > 0 )
+				{
+					str += ',';
+				}
+				if( m_node->m_kind == SNAPSHOT_REFERENCE_ARRAY )
+				{
+					str += '#';
+				}
+				if( m_node->m_kind == SNAPSHOT_REAL_ARRAY )
+				{
+					appendReal(str, realAt(ii));
+				}
+				else
+				{
+					appendInteger(str, integerAt(ii));
+				}
+			}
+			str += ')';
+			break;
+		case SNAPSHOT_LIST:
+			str += '(';
+			for( size_t ii = 0; ii < m_node->m_size; ++ii )
+			{
+				if( ii > 0 )
+				{
+					str += ',';
+				}
+				child(ii).appendString(str);
+			}
+			str += ')';
+			break;
+		case SNAPSHOT_ENUM:
+			appendInteger(str, m_node->m_integer);
+			break;
+		case SNAPSHOT_LOGICAL:
+			str += m_node->m_integer == 0 ? ".F." : ( m_node->m_integer == 1 ? ".T." : ".U." );
+			break;
+		case SNAPSHOT_STRING:
+			str += '\'';
+			str.append(text(), m_node->m_size);
+			str += '\'';
+			break;
+		case SNAPSHOT_TYPED:
+			value().appendString(str);
+			break;
+		}
+	}
+
+	static double bitsToDouble( uint64_t word )
+	{
+		double value;
+		std::memcpy(&value, &word, sizeof(double));
+		return value;
+	}
+
+	static void appendInteger( std::string& str, int64_t value )
+	{
+		char buffer[24];
+		std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		str.append(buffer, result.ptr - buffer);
+	}
+
+	/** Shortest text that reads back to the same value, with a decimal point as required by STEP, for example 1. or 2.5e-07 */
+	static void appendReal( std::string& str, double value )
+	{
+		char buffer[STEP_REAL_ROUND_TRIP_MAX_LENGTH];
+		str.append(buffer, writeRealRoundTrip(buffer, value));
+	}
+
+private:
+	const SnapshotNode*		m_node;
+	const SnapshotSections*	m_sections;
+};
+
+/** \brief Appends the nodes, words and strings of a snapshot. Used by WriterSnapshot, and by BuildingObject::getBinaryParameter to encode a single value.
+*
+* The encode methods return the node of the value, the caller stores it in a node that was allocated before. Child nodes are appended during encoding, so they always come after their parent.
+*/
+struct SnapshotEncoder
+{
+	std::vector<SnapshotNode>					m_nodes;
+	std::vector<uint64_t>						m_words;
+	std::string									m_strings;
+	std::unordered_map<std::string, uint64_t>	m_string_offsets;
+
+	SnapshotString addString( const std::string& str )
+	{
+		auto it_find = m_string_offsets.find( str );
+		if( it_find != m_string_offsets.end() )
+		{
+			return { it_find->second, str.size() };
+		}
+		const uint64_t offset = m_strings.size();
+		m_strings += str;
+		m_string_offsets.insert( std::make_pair( str, offset ) );
+		return { offset, str.size() };
+	}
+
+	static SnapshotNode makeNode( SnapshotNodeKind kind, uint32_t size )
+	{
+		SnapshotNode node;
+		std::memset( &node, 0, sizeof(SnapshotNode) );
+		node.m_kind = kind;
+		node.m_size = size;
+		return node;
+	}
+
+	static SnapshotNode encodeReference( int tag )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_REFERENCE, 0 );
+		node.m_integer = tag;
+		return node;
+	}
+
+	/** class_id is the class of the type object, for example IFCINTEGER, or 0 for plain values */
+	static SnapshotNode encodeInteger( int64_t value, uint32_t class_id )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_INTEGER, class_id );
+		node.m_integer = value;
+		return node;
+	}
+
+	static SnapshotNode encodeReal( double value, uint32_t class_id )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_REAL, class_id );
+		node.m_real = value;
+		return node;
+	}
+
+	static SnapshotNode encodeEnum( int value, uint32_t class_id )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_ENUM, class_id );
+		node.m_integer = value;
+		return node;
+	}
+
+	static SnapshotNode encodeLogical( LogicalEnum value, uint32_t class_id )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_LOGICAL, class_id );
+		node.m_integer = value == LOGICAL_FALSE ? 0 : ( value == LOGICAL_TRUE ? 1 : 2 );
+		return node;
+	}
+
+	static SnapshotNode encodeBool( bool value, uint32_t class_id )
+	{
+		return encodeLogical( value ? LOGICAL_TRUE : LOGICAL_FALSE, class_id );
+	}
+
+	SnapshotNode encodeString( const std::string& value, uint32_t class_id )
+	{
+		SnapshotString str = addString( value );
+		SnapshotNode node = makeNode( SNAPSHOT_STRING, uint32_t( str.m_size ) );
+		node.m_offset = str.m_offset;
+		return class_id != 0 ? encodeTyped( class_id, node ) : node;
+	}
+
+	/** Argument in decoded STEP syntax, for values without binary encoding. ReaderSnapshot passes it to the text parser */
+	SnapshotNode encodeText( const std::string& arg )
+	{
+		SnapshotString str = addString( arg );
+		SnapshotNode node = makeNode( SNAPSHOT_TEXT, uint32_t( str.m_size ) );
+		node.m_offset = str.m_offset;
+		return node;
+	}
+
+	/** Appends value as child node of a SNAPSHOT_TYPED node, which keeps the class ID of the type. value must not have child nodes, see the overload below */
+	SnapshotNode encodeTyped( uint32_t class_id, const SnapshotNode& value )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_TYPED, class_id );
+		node.m_offset = m_nodes.size();
+		m_nodes.push_back( value );
+		return node;
+	}
+
+	/** For values with child nodes, like lists: the child node of the SNAPSHOT_TYPED node is reserved before encode_value appends the children, because children are stored after their parent */
+	template<typename EncodeValue>
+	SnapshotNode encodeTyped( uint32_t class_id, EncodeValue encode_value )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_TYPED, class_id );
+		node.m_offset = m_nodes.size();
+		m_nodes.emplace_back();
+		SnapshotNode value = encode_value();
+		m_nodes[size_t( node.m_offset )] = value;
+		return node;
+	}
+
+	SnapshotNode encodeRealArray( const double* values, size_t size )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_REAL_ARRAY, uint32_t( size ) );
+		node.m_offset = m_words.size();
+		for( size_t ii = 0; ii < size; ++ii )
+		{
+			m_words.push_back( doubleToBits( values[ii] ) );
+		}
+		return node;
+	}
+
+	SnapshotNode encodeIntegerArray( const int* values, size_t size )
+	{
+		SnapshotNode node = makeNode( SNAPSHOT_INTEGER_ARRAY, uint32_t( size ) );
+		node.m_offset = m_words.size();
+		for( size_t ii = 0; ii < size; ++ii )
+		{
+			m_words.push_back( uint64_t( int64_t( values[ii] ) ) );
+		}
+		return node;
+	}
+
+	/** Entity reference, type value or empty node */
+	SnapshotNode encodeObject( const BuildingObject* object )
+	{
+		if( !object )
+		{
+			return makeNode( SNAPSHOT_NULL, 0 );
+		}
+		return object->getBinaryParameter( *this );
+	}
+
+	SnapshotNode encodeList( const AttributeListView& list )
+	{
+		return encodeItems( list.size(), [&]( size_t ii ) { return encodeObject( list.at( ii ) ); } );
+	}
+
+	SnapshotNode encodeList2D( const AttributeList2DView& list )
+	{
+		return encodeItems( list.size(), [&]( size_t ii ) {
+			return encodeItems( list.size( ii ), [&]( size_t jj ) { return encodeObject( list.at( ii, jj ) ); } );
+		});
+	}
+
+	/** Encodes num_items child nodes. References, or numbers of the same type like (0.,0.,1.), are moved to the word array instead */
+	template<typename EncodeItem>
+	SnapshotNode encodeItems( size_t num_items, EncodeItem encode_item )
+	{
+		const size_t first = m_nodes.size();
+		m_nodes.resize( first + num_items );
+		for( size_t ii = 0; ii < num_items; ++ii )
+		{
+			// child nodes of the item are appended during encoding, so the node is assigned afterwards
+			SnapshotNode node = encode_item( ii );
+			m_nodes[first + ii] = node;
+		}
+
+		SnapshotNode list_node = makeNode( SNAPSHOT_LIST, uint32_t( num_items ) );
+		list_node.m_offset = first;
+		encodeArray( list_node );
+		return list_node;
+	}
+
+	static uint64_t doubleToBits( double value )
+	{
+		uint64_t word;
+		std::memcpy( &word, &value, sizeof(double) );
+		return word;
+	}
+
+private:
+	void encodeArray( SnapshotNode& list_node )
+	{
+		const size_t first = size_t( list_node.m_offset );
+		const size_t num_items = list_node.m_size;
+		if( num_items == 0 || m_nodes.size() != first + num_items )
+		{
+			// empty, or items with child nodes
+			return;
+		}
+
+		const uint8_t kind = m_nodes[first].m_kind;
+		const uint32_t class_id = m_nodes[first].m_size;
+		if( kind != SNAPSHOT_REFERENCE && kind != SNAPSHOT_INTEGER && kind != SNAPSHOT_REAL )
+		{
+			return;
+		}
+		for( size_t ii = first; ii < first + num_items; ++ii )
+		{
+			if( m_nodes[ii].m_kind != kind || m_nodes[ii].m_size != class_id )
+			{
+				return;
+			}
+		}
+
+		const size_t first_word = m_words.size();
+		for( size_t ii = first; ii < first + num_items; ++ii )
+		{
+			m_words.push_back( kind == SNAPSHOT_REAL ? doubleToBits( m_nodes[ii].m_real ) : uint64_t( m_nodes[ii].m_integer ) );
+		}
+		m_nodes.resize( first );
+
+		SnapshotNode array_node = makeNode( kind == SNAPSHOT_REFERENCE ? SNAPSHOT_REFERENCE_ARRAY : ( kind == SNAPSHOT_INTEGER ? SNAPSHOT_INTEGER_ARRAY : SNAPSHOT_REAL_ARRAY ), uint32_t( num_items ) );
+		array_node.m_offset = first_word;
+		list_node = class_id != 0 ? encodeTyped( class_id, array_node ) : array_node;
+	}
+};
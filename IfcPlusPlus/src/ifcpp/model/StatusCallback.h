@@ -17,10 +17,13 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <vector>
 
 #include "BasicTypes.h"
 #include "GlobalDefines.h"
@@ -68,6 +71,139 @@ public:
 		std::string m_progress_text;		// A text that describes the current actions. It can be used for example to set a text on the progress bar.
 	};
 
+	/*\class ScopedMessageBuffer
+	  \brief While it exists, StatusCallback implementations that support buffering (GeometryConverter) append messages of the current thread to a buffer instead of sending them.
+	  The owner sends the buffered messages later in a defined order, for example per product in model order. Progress messages are never buffered.
+	  Restores the previous buffer of the thread in the destructor, so scopes can be nested.
+	*/
+	class IFCQUERY_EXPORT ScopedMessageBuffer
+	{
+	public:
+		explicit ScopedMessageBuffer(std::vector<shared_ptr<Message> >* buffer);
+		~ScopedMessageBuffer();
+		ScopedMessageBuffer(const ScopedMessageBuffer&) = delete;
+		ScopedMessageBuffer& operator=(const ScopedMessageBuffer&) = delete;
+
+		//\brief Buffer of the current thread, nullptr if no ScopedMessageBuffer is active
+		static std::vector<shared_ptr<Message> >* getCurrent();
+
+	private:
+		std::vector<shared_ptr<Message> >* m_previous;
+	};
+
+	//\brief Appends m to the buffer of the current thread, if there is one and m is not a progress message. Returns false if the message needs to be sent directly
+	static bool bufferMessage(const shared_ptr<Message>& m)
+	{
+		std::vector<shared_ptr<Message> >* buffer = ScopedMessageBuffer::getCurrent();
+		if (!buffer || !m)
+		{
+			return false;
+		}
+
+		switch (m->m_message_type)
+		{
+		case MESSAGE_TYPE_PROGRESS_VALUE:
+		case MESSAGE_TYPE_PROGRESS_TEXT:
+		case MESSAGE_TYPE_CLEAR_MESSAGES:
+		case MESSAGE_TYPE_CANCELED:
+			return false;
+		default:
+			buffer->push_back(m);
+			return true;
+		}
+	}
+
+	/*\class ProgressAggregator
+	  \brief Progress of a parallel loop without a lock per item. Threads count finished items with addDone, an atomic increment, and only the thread that passes the next step sends a progress value.
+	  So at most about 1/minStep progress messages are sent per loop. If the callback has no listener, addDone returns immediately.
+	*/
+	class ProgressAggregator
+	{
+	public:
+		//\brief The progress value goes from progressBegin to progressEnd while numItems items are done
+		ProgressAggregator(StatusCallback* callback, const std::string& progressType, size_t numItems, double progressBegin, double progressEnd, double minStep = 0.01)
+			: m_progressType(progressType), m_numItems(std::max(size_t(1), numItems)), m_progressBegin(progressBegin), m_progressEnd(progressEnd)
+		{
+			m_callback = (callback && callback->hasMessageListener(MESSAGE_TYPE_PROGRESS_VALUE)) ? callback : nullptr;
+			m_step = std::max(size_t(1), size_t(minStep*double(m_numItems)));
+			m_nextReport = m_step;
+		}
+
+		void addDone(size_t numDone = 1)
+		{
+			if (!m_callback)
+			{
+				return;
+			}
+
+			const size_t done = m_numDone.fetch_add(numDone, std::memory_order_relaxed) + numDone;
+			size_t nextReport = m_nextReport.load(std::memory_order_relaxed);
+			while (done >= nextReport)
+			{
+				if (m_nextReport.compare_exchange_weak(nextReport, done + m_step, std::memory_order_relaxed))
+				{
+					// the sending thread holds the lock, so that values arrive in increasing order. If it is taken, this value is skipped, a later step sends a higher one
+					std::unique_lock<std::mutex> lock(m_sendMutex, std::try_to_lock);
+					if (lock.owns_lock())
+					{
+						const size_t doneNow = m_numDone.load(std::memory_order_relaxed);
+						if (doneNow > m_numSent)
+						{
+							m_numSent = doneNow;
+							const double fraction = std::min(1.0, double(doneNow)/double(m_numItems));
+							m_callback->progressValueCallback(m_progressBegin + (m_progressEnd - m_progressBegin)*fraction, m_progressType);
+						}
+					}
+					return;
+				}
+			}
+		}
+
+	private:
+		StatusCallback*		m_callback;
+		std::string			m_progressType;
+		size_t				m_numItems;
+		double				m_progressBegin;
+		double				m_progressEnd;
+		size_t				m_step;
+		std::atomic<size_t>	m_numDone{ 0 };
+		std::atomic<size_t>	m_nextReport;
+		std::mutex			m_sendMutex;
+		size_t				m_numSent = 0;
+	};
+
+	/*\class RangeMessages
+	  \brief Error text of a parallel loop. Each range of the loop writes into its own std::stringstream without locking and hands it over with addRange at the end of the range,
+	  which locks only if there is text. appendTo writes the texts in index order, so the result does not depend on the number of threads.
+	*/
+	class RangeMessages
+	{
+	public:
+		void addRange(size_t rangeBegin, std::stringstream& strs)
+		{
+			if (strs.tellp() > 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_ranges.emplace_back(rangeBegin, strs.str());
+			}
+		}
+
+		void appendTo(std::stringstream& strs)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			std::sort(m_ranges.begin(), m_ranges.end(), [](const std::pair<size_t, std::string>& a, const std::pair<size_t, std::string>& b) { return a.first < b.first; });
+			for (const std::pair<size_t, std::string>& range : m_ranges)
+			{
+				strs << range.second;
+			}
+			m_ranges.clear();
+		}
+
+	private:
+		std::mutex										m_mutex;
+		std::vector<std::pair<size_t, std::string> >	m_ranges;
+	};
+
 	StatusCallback() = default;
 	virtual ~StatusCallback() = default;
 
@@ -100,6 +236,17 @@ public:
 		m_func_check_cancel = nullptr;
 	}
 
+	//\brief false if nobody receives messages of the given type that are sent to this object, so that they do not need to be composed. Follows setMessageTarget redirections.
+	// The default is true, because a subclass may override messageCallback(shared_ptr<Message>). Subclasses that only pass messages to the callback function can return hasMessageCallback(type)
+	virtual bool hasMessageListener(MessageType type) const
+	{
+		if (m_redirect_target)
+		{
+			return m_redirect_target->hasMessageListener(type);
+		}
+		return true;
+	}
+
 	//\brief trigger the callback to pass a message, warning, or error, for example to store in a logfile
 	virtual void messageCallback(shared_ptr<Message> m)
 	{
@@ -159,6 +306,10 @@ public:
 
 	virtual void messageCallback(const std::string& message_text, MessageType type, const char* reporting_function, BuildingObject* entity = nullptr)
 	{
+		if (!hasMessageListener(type))
+		{
+			return;
+		}
 		shared_ptr<Message> message(new Message());
 		message->m_message_text.assign(message_text.begin(), message_text.end());
 		message->m_message_type = type;
@@ -168,6 +319,10 @@ public:
 	}
 	virtual void progressValueCallback(double progress_value, const std::string& progress_type)
 	{
+		if (!hasMessageListener(MESSAGE_TYPE_PROGRESS_VALUE))
+		{
+			return;
+		}
 		shared_ptr<Message> progress_message(new Message());
 		progress_message->m_message_type = MessageType::MESSAGE_TYPE_PROGRESS_VALUE;
 		progress_message->m_progress_value = progress_value;
@@ -176,6 +331,10 @@ public:
 	}
 	virtual void progressTextCallback(const std::string& progress_text)
 	{
+		if (!hasMessageListener(MESSAGE_TYPE_PROGRESS_TEXT))
+		{
+			return;
+		}
 		shared_ptr<Message> progress_message(new Message());
 		progress_message->m_message_type = MessageType::MESSAGE_TYPE_PROGRESS_TEXT;
 		progress_message->m_progress_value = -1;
@@ -196,6 +355,21 @@ public:
 	}
 
 protected:
+	//\brief for hasMessageListener: true if messages reach the callback function, following setMessageTarget redirections. The callback function receives all message types.
+	// Debug builds print messages without receiver, so there is always a listener
+	bool hasMessageCallback(MessageType type) const
+	{
+		if (m_redirect_target)
+		{
+			return m_redirect_target->hasMessageListener(type);
+		}
+#ifdef _DEBUG
+		return true;
+#else
+		return m_func_call_on_message != nullptr;
+#endif
+	}
+
 	//\brief Message callback function
 	MessageCallbackType m_func_call_on_message;
 	
@@ -0,0 +1,175 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <vector>
+#include "ifcpp/IFC4X3/EntityFactory.h"
+#include "Trace.h"
+
+std::atomic<bool> Trace::s_enabled( false );
+
+namespace
+{
+	struct ThreadBuffer
+	{
+		ThreadBuffer( size_t size, uint32_t threadIndex ) : m_events( std::max( size_t(1), size ) ), m_threadIndex( threadIndex ) {}
+
+		std::vector<Trace::Event>	m_events;
+		// only written by the owning thread, the events up to m_count are complete
+		std::atomic<uint64_t>		m_count{ 0 };
+		uint32_t					m_threadIndex;
+	};
+
+	struct BufferRegistry
+	{
+		std::mutex								m_mutex;
+		std::vector<shared_ptr<ThreadBuffer> >	m_buffers;
+		size_t									m_bufferSize = 65536;
+	};
+
+	BufferRegistry& getRegistry()
+	{
+		static BufferRegistry registry;
+		return registry;
+	}
+
+	ThreadBuffer* getThreadBuffer()
+	{
+		// the registry keeps the buffer, so that events of finished threads can still be written
+		thread_local ThreadBuffer* t_buffer = nullptr;
+		if( !t_buffer )
+		{
+			BufferRegistry& registry = getRegistry();
+			std::lock_guard<std::mutex> lock( registry.m_mutex );
+			shared_ptr<ThreadBuffer> buffer = make_shared<ThreadBuffer>( registry.m_bufferSize, (uint32_t)registry.m_buffers.size() );
+			registry.m_buffers.push_back( buffer );
+			t_buffer = buffer.get();
+		}
+		return t_buffer;
+	}
+
+	void writeJsonString( std::ostream& stream, const char* str )
+	{
+		stream << '"';
+		for( const char* ch = str; *ch != '\0'; ++ch )
+		{
+			if( *ch == '"' || *ch == '\\' )
+			{
+				stream << '\\';
+			}
+			stream << *ch;
+		}
+		stream << '"';
+	}
+}
+
+void Trace::setBufferSize( size_t numEventsPerThread )
+{
+	BufferRegistry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock( registry.m_mutex );
+	registry.m_bufferSize = numEventsPerThread;
+}
+
+uint64_t Trace::now()
+{
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start ).count();
+}
+
+void Trace::record( const char* name, uint64_t beginNs, uint64_t endNs, int tag, uint32_t classID )
+{
+	ThreadBuffer* buffer = getThreadBuffer();
+	const uint64_t index = buffer->m_count.load( std::memory_order_relaxed );
+	Event& e = buffer->m_events[index % buffer->m_events.size()];
+	e.name = name;
+	e.beginNs = beginNs;
+	e.endNs = endNs;
+	e.tag = tag;
+	e.classID = classID;
+	buffer->m_count.store( index + 1, std::memory_order_release );
+}
+
+void Trace::writeChromeTrace( std::ostream& stream )
+{
+	BufferRegistry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock( registry.m_mutex );
+
+	const auto flags = stream.flags();
+	stream << std::fixed << std::setprecision( 3 );
+	stream << "{\"traceEvents\":[";
+	bool first = true;
+	for( const shared_ptr<ThreadBuffer>& buffer : registry.m_buffers )
+	{
+		const uint64_t count = buffer->m_count.load( std::memory_order_acquire );
+		if( count == 0 )
+		{
+			continue;
+		}
+		const uint64_t size = buffer->m_events.size();
+		const uint64_t numEvents = std::min( count, size );
+
+		stream << ( first ? "\n" : ",\n" );
+		first = false;
+		stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->m_threadIndex << ",\"args\":{\"name\":\"thread " << buffer->m_threadIndex << "\"}}";
+
+		for( uint64_t ii = count - numEvents; ii < count; ++ii )
+		{
+			const Event& e = buffer->m_events[ii % size];
+			stream << ",\n{\"name\":";
+			writeJsonString( stream, e.name ? e.name : "" );
+			stream << ",\"cat\":\"ifcpp\",\"ph\":\"X\",\"ts\":" << e.beginNs*0.001 << ",\"dur\":" << ( e.endNs - e.beginNs )*0.001;
+			stream << ",\"pid\":1,\"tid\":" << buffer->m_threadIndex;
+			if( e.tag >= 0 || e.classID != 0 )
+			{
+				stream << ",\"args\":{\"tag\":" << e.tag;
+				if( e.classID != 0 )
+				{
+					stream << ",\"class\":";
+					writeJsonString( stream, IFC4X3::EntityFactory::getStringForClassID( e.classID ) );
+				}
+				stream << "}";
+			}
+			stream << "}";
+		}
+	}
+	stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	stream.flags( flags );
+}
+
+bool Trace::writeChromeTraceFile( const std::string& filePath )
+{
+	std::ofstream stream( filePath, std::ofstream::binary );
+	if( !stream.is_open() )
+	{
+		return false;
+	}
+	writeChromeTrace( stream );
+	return stream.good();
+}
+
+void Trace::clear()
+{
+	BufferRegistry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock( registry.m_mutex );
+	for( const shared_ptr<ThreadBuffer>& buffer : registry.m_buffers )
+	{
+		buffer->m_count.store( 0, std::memory_order_relaxed );
+	}
+}
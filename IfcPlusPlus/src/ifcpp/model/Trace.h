@@ -0,0 +1,123 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "BasicTypes.h"
+#include "BuildingObject.h"
+#include "GlobalDefines.h"
+
+/*! \brief Records timed spans of the library (parsing, inverse attributes, geometry conversion per product, CSG operations, writing) and exports them as Chrome trace.
+*
+* Spans are created with IFCPP_TRACE_SCOPE and IFCPP_TRACE_SCOPE_ENTITY. They are only compiled in with IFCPP_ENABLE_TRACING (CMake option IFCPP_ENABLE_TRACING), otherwise the macros expand to nothing.
+* Recording also has to be switched on at runtime with Trace::setEnabled( true ).
+*
+* Each thread writes into its own ring buffer, so recording takes no lock. If a buffer is full, the oldest events of that thread are overwritten.
+* writeChromeTrace writes the trace_event JSON format, which can be opened in chrome://tracing or https://ui.perfetto.dev. Call it, and clear, only while no traced work is running.
+*/
+class IFCQUERY_EXPORT Trace
+{
+public:
+	struct Event
+	{
+		const char*	name = nullptr;
+		uint64_t	beginNs = 0;
+		uint64_t	endNs = 0;
+		int			tag = -1;
+		uint32_t	classID = 0;
+	};
+
+	static void setEnabled( bool enabled ) { s_enabled.store( enabled, std::memory_order_relaxed ); }
+	static bool isEnabled() { return s_enabled.load( std::memory_order_relaxed ); }
+
+	/*! \brief Number of events per thread. Applies to ring buffers of threads that record their first event afterwards. Default is 65536 */
+	static void setBufferSize( size_t numEventsPerThread );
+
+	/*! \brief Nanoseconds since the first call, on a steady clock */
+	static uint64_t now();
+
+	/*! \brief Adds an event to the ring buffer of the calling thread.
+	  \param[in] name Name of the span. Only the pointer is stored, so it needs to be a string literal or otherwise live until the trace is written. */
+	static void record( const char* name, uint64_t beginNs, uint64_t endNs, int tag = -1, uint32_t classID = 0 );
+
+	/*! \brief Writes the recorded events of all threads in Chrome trace_event JSON format. Entity tags and IFC class names are written as args of the events */
+	static void writeChromeTrace( std::ostream& stream );
+	static bool writeChromeTraceFile( const std::string& filePath );
+
+	/*! \brief Removes all recorded events */
+	static void clear();
+
+private:
+	static std::atomic<bool> s_enabled;
+};
+
+/*! \brief Records a span from construction to destruction, if Trace is enabled */
+class TraceScope
+{
+public:
+	explicit TraceScope( const char* name ) : m_name( name )
+	{
+		if( Trace::isEnabled() )
+		{
+			m_active = true;
+			m_beginNs = Trace::now();
+		}
+	}
+
+	TraceScope( const char* name, const BuildingEntity* entity ) : TraceScope( name )
+	{
+		if( entity )
+		{
+			m_tag = entity->m_tag;
+			m_classID = entity->classID();
+		}
+	}
+
+	~TraceScope()
+	{
+		if( m_active )
+		{
+			Trace::record( m_name, m_beginNs, Trace::now(), m_tag, m_classID );
+		}
+	}
+
+	TraceScope( const TraceScope& ) = delete;
+	TraceScope& operator=( const TraceScope& ) = delete;
+
+private:
+	const char*	m_name;
+	uint64_t	m_beginNs = 0;
+	int			m_tag = -1;
+	uint32_t	m_classID = 0;
+	bool		m_active = false;
+};
+
+#ifdef IFCPP_ENABLE_TRACING
+	#define IFCPP_TRACE_CONCAT_IMPL( a, b ) a##b
+	#define IFCPP_TRACE_CONCAT( a, b ) IFCPP_TRACE_CONCAT_IMPL( a, b )
+	#define IFCPP_TRACE_SCOPE( name ) TraceScope IFCPP_TRACE_CONCAT( traceScope, __LINE__ )( name )
+	#define IFCPP_TRACE_SCOPE_ENTITY( name, entity ) TraceScope IFCPP_TRACE_CONCAT( traceScope, __LINE__ )( name, entity )
+#else
+	#define IFCPP_TRACE_SCOPE( name )
+	#define IFCPP_TRACE_SCOPE_ENTITY( name, entity )
+#endif
@@ -1,976 +1,1470 @@
-/* -*-c++-*- IfcQuery www.ifcquery.com
-*
-MIT License
-
-Copyright (c) 2017 Fabian Gerold
-
-Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
-*/
-
-#include <cstring>
-#include <filesystem>
-#include <fstream>
-#include <iostream>
-#include <map>
-#include <unordered_set>
-#include <string>
-#include <thread>
-#include <unordered_map>
-#include <vector>
-
-#include <ifcpp/model/BasicTypes.h>
-#include <ifcpp/model/BuildingModel.h>
-#include <ifcpp/model/BuildingException.h>
-#include <ifcpp/model/UnknownEntityException.h>
-#include <ifcpp/IFC4X3/EntityFactory.h>
-#include <IfcBuilding.h>
-#include <IfcBuildingStorey.h>
-#include <IfcColour.h>
-#include <IfcColourOrFactor.h>
-#include <IfcColourRgb.h>
-#include <IfcCurveStyle.h>
-#include <IfcFillAreaStyle.h>
-#include <IfcLabel.h>
-#include <IfcNormalisedRatioMeasure.h>
-#include <IfcPresentationStyle.h>
-#include <IfcPresentationStyleAssignment.h>
-#include <IfcProject.h>
-#include <IfcProductRepresentation.h>
-#include <IfcRelAggregates.h>
-#include <IfcRelContainedInSpatialStructure.h>
-#include <IfcRepresentation.h>
-#include <IfcSite.h>
-#include <IfcStyledItem.h>
-#include <IfcSurfaceStyle.h>
-#include <IfcSurfaceStyleElementSelect.h>
-#include <IfcSurfaceStyleRendering.h>
-#include <IfcTextStyle.h>
-
-#ifdef _MSC_VER
-#include <windows.h>
-#include <tchar.h>
-#endif
-
-#include <external/zippy/zippy.hpp>
-
-#include "ReaderUtil.h"
-#include "ReaderSTEP.h"
-
-using namespace IFC4X3;
-
-ReaderSTEP::ReaderSTEP() = default;
-ReaderSTEP::~ReaderSTEP() = default;
-
-void ReaderSTEP::loadModelFromFile(const std::string& filePath, shared_ptr<BuildingModel>& targetModel)
-{
-	// if file content needs to be loaded into a plain model, call resetModel() before loadModelFromFile
-	std::string ext = getFileExtension(filePath);
-	std::string uncompressedFileName = "";
-	std::string filePathRead = filePath;
-
-	if (std_iequal(ext, ".ifc"))
-	{
-		// ok, nothing to do here
-	}
-	else if (std_iequal(ext, ".ifcXML"))
-	{
-		// TODO: implement xml reader
-		messageCallback("ifcXML not yet implemented", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-		return;
-	}
-	else if (std_iequal(ext, ".ifcZIP") || std_iequal(ext, ".zip"))
-	{
-		std::stringstream buffer;
-		buffer.seekp(0, std::ios::end);
-		std::stringstream::pos_type buffer_size = buffer.tellp();
-
-		uncompressedFileName = filePath + "_uncompressed77334.ifc";
-
-		std::shared_ptr<Zippy::ZipArchive> archive(new Zippy::ZipArchive());
-		archive->Open(filePath.c_str());
-
-		std::vector<std::string> entryNames = archive->GetEntryNames();
-		if (entryNames.size() == 0)
-		{
-			return;
-		}
-
-		std::string zipcontent = archive->GetEntry(entryNames[0]).GetDataAsString();
-		std::ofstream zipFileUncompressed(uncompressedFileName, std::ofstream::out);
-		zipFileUncompressed << zipcontent;
-		zipFileUncompressed.close();
-
-		std::ifstream infile;
-		infile.open(uncompressedFileName.c_str(), std::ifstream::in);
-
-		if (!infile.is_open())
-		{
-			std::stringstream strs;
-			strs << "Could not unzip file: " << filePath;
-			messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-			return;
-		}
-
-
-		filePathRead = uncompressedFileName;
-	}
-	else
-	{
-		std::stringstream strs;
-		strs << "Unsupported file type: " << ext;
-		messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-		return;
-	}
-
-	// open file
-	setlocale(LC_ALL, "");
-	std::ifstream infile;
-	infile.open(filePathRead.c_str(), std::ifstream::in);
-
-	if (!infile.is_open())
-	{
-		std::stringstream strs;
-		strs << "Could not open file: " << filePathRead.c_str();
-		messageCallback(strs.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-		return;
-	}
-
-	// get length of file content
-	infile.imbue(std::locale(""));
-	infile.seekg(0, std::ios::end);
-	std::streampos file_end_pos = infile.tellg();
-	infile.seekg(0, std::ios::beg);
-
-	loadModelFromStream(infile, file_end_pos, targetModel);
-	infile.close();
-
-	if (uncompressedFileName.size() > 0)
-	{
-		try
-		{
-			std::filesystem::remove(uncompressedFileName);
-		}
-		catch (std::exception& e)
-		{
-			std::cout << __FUNCTION__ << ": " << __LINE__ << ": exception: " << e.what() << ", input file: " << uncompressedFileName << std::endl;
-		}
-	}
-}
-
-void ReaderSTEP::loadModelFromStream(std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel)
-{
-	int millisecs_begin = clock();
-
-	readHeader(content, targetModel);
-
-	// currently generated IFC classes are IFC4X3, files with older versions are converted. So after loading, the schema is always IFC4X3
-	targetModel->setIfcSchemaVersionEnumCurrent( BuildingModel::IFC4X3 );
-	readData(content, file_end_pos, targetModel);
-	targetModel->resolveInverseAttributes();
-	targetModel->updateCache();
-
-	int millisecs_end = clock();
-	double seconds = (millisecs_end - millisecs_begin) * 0.001;
-	double progress = 1.0;
-	progressValueCallback(progress, "parse");
-}
-
-void removeComments(std::string& line)
-{
-	for (size_t ii = 0; ii < line.size(); ++ii)
-	{
-		size_t found_comment_start = line.find("/*");
-		if (found_comment_start == std::string::npos)
-		{
-			break;
-		}
-		size_t found_comment_end = line.find("*/");
-		if (found_comment_end != std::string::npos)
-		{
-			if (found_comment_end > found_comment_start)
-			{
-				line.erase(found_comment_start, found_comment_end - found_comment_start + 2);
-			}
-		}
-		else
-		{
-			line.erase(found_comment_start);
-		}
-	}
-}
-
-void ReaderSTEP::readHeader(std::istream& content, shared_ptr<BuildingModel>& target_model)
-{
-	if (!target_model)
-	{
-		throw BuildingException("Model not set.", __FUNC__);
-	}
-
-	target_model->setFileHeader("");
-	target_model->setFileDescription("");
-	target_model->setFileName("");
-
-	std::string line;
-	std::string strHeader;
-	size_t line_header_start = std::string::npos;
-	size_t line_header_end = std::string::npos;
-	size_t lineCount = 0;
-	bool inComment = false;
-
-	while (!bufferedGetline(content, line).eof())
-	{
-		size_t found_comment_start = line.find("/*");
-		if (found_comment_start != std::string::npos)
-		{
-			inComment = true;
-		}
-
-		if (inComment)
-		{
-			size_t found_comment_end = line.find("*/");
-			if (found_comment_end != std::string::npos)
-			{
-				if (found_comment_start != std::string::npos)
-				{
-					// comment start and end in same line
-					if (found_comment_end > found_comment_start)
-					{
-						inComment = false;
-						line.erase(found_comment_start, found_comment_end - found_comment_start + 2);
-						//continue;
-					}
-					// TODO: remove comment from line, and check rest of line
-				}
-				else
-				{
-					inComment = false;
-					continue;
-				}
-			}
-		}
-		if (inComment)
-		{
-			continue;
-		}
-
-		if (line_header_start == std::string::npos)
-		{
-			size_t found = line.find("HEADER;");
-			if (found != std::string::npos)
-			{
-				line_header_start = lineCount;
-				strHeader += line + '\n';
-			}
-		}
-		else
-		{
-			if (line_header_end == std::string::npos)
-			{
-				strHeader += line + '\n';
-			}
-		}
-
-		if (line_header_end == std::string::npos)
-		{
-			size_t found = line.find("ENDSEC;");
-			if (found != std::string::npos)
-			{
-				line_header_end = lineCount;
-				break;
-			}
-		}
-
-		++lineCount;
-	}
-
-	removeComments(strHeader);
-	target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC_VERSION_UNDEFINED);
-	std::vector<std::string> vec_header;
-	std::vector<std::string> vec_header_str;
-	vec_header.emplace_back(strHeader);
-	decodeArgumentStrings(vec_header, vec_header_str);
-
-	std::string file_header_str;
-	if (!vec_header_str.empty())
-	{
-		file_header_str = vec_header_str[0];
-	}
-	target_model->setFileHeader(file_header_str);
-
-	std::vector<std::string> vec_header_lines;
-	// split into lines
-	const char* stream_pos = &file_header_str[0];
-	const char* last_token = stream_pos;
-
-	if (stream_pos == nullptr)
-	{
-		throw BuildingException("Invalid file content, couldn't find HEADER section", __FUNC__);
-	}
-
-	while (*stream_pos != '\0')
-	{
-		if (*stream_pos == '\'')
-		{
-			findEndOfString(stream_pos);
-			continue;
-		}
-
-		if (*stream_pos == ';')
-		{
-			const char* begin_line = last_token;
-			std::string single_step_line(begin_line, stream_pos - last_token);
-			vec_header_lines.push_back(single_step_line);
-
-			++stream_pos;
-			while (isspace(*stream_pos)) { ++stream_pos; }
-			last_token = stream_pos;
-
-			continue;
-		}
-		++stream_pos;
-	}
-
-	for (auto header_line : vec_header_lines)
-	{
-		if (header_line.find("FILE_DESCRIPTION") != std::string::npos)
-		{
-			target_model->setFileDescription(header_line);
-			continue;
-		}
-
-		if (header_line.find("FILE_NAME") != std::string::npos)
-		{
-			target_model->setFileName(header_line);
-			continue;
-		}
-
-		if (header_line.find("FILE_SCHEMA") != std::string::npos)
-		{
-			size_t file_schema_begin = header_line.find("FILE_SCHEMA") + 11;
-
-			std::string file_schema_args = header_line.substr(11);
-			size_t find_whitespace = file_schema_args.find(' ');
-			while (find_whitespace != std::string::npos) { file_schema_args.erase(find_whitespace, 1); find_whitespace = file_schema_args.find(L' '); }
-
-			if (file_schema_args.empty())
-			{
-				continue;
-			}
-
-			if (file_schema_args.at(0) == '(' && file_schema_args.at(file_schema_args.size() - 1) == ')')
-			{
-				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
-			}
-			if (file_schema_args.at(0) == '(' && file_schema_args.at(file_schema_args.size() - 1) == ')')
-			{
-				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
-			}
-			if (file_schema_args.at(0) == '\'' && file_schema_args.at(file_schema_args.size() - 1) == '\'')
-			{
-				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
-			}
-
-			convertStringToUpperCase(file_schema_args);
-
-			if (file_schema_args.compare("IFC4X3") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X3);
-			}
-			else if (file_schema_args.compare("IFC4X1") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X1);
-			}
-			else if (file_schema_args.compare("IFC4") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4);
-			}
-			else if (file_schema_args.substr(0, 6).compare("IFC2X4") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X4);
-			}
-			else if (file_schema_args.substr(0, 6).compare("IFC2X3") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X3);
-			}
-			else if (file_schema_args.substr(0, 6).compare("IFC2X2") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X2);
-			}
-			else if (file_schema_args.substr(0, 5).compare("IFC2X") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X);
-			}
-			else if (file_schema_args.substr(0, 5).compare("IFC20") == 0)
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X);
-			}
-			else
-			{
-				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC_VERSION_UNKNOWN);
-			}
-		}
-	}
-}
-
-void ReaderSTEP::readSingleStepLine(const std::string& line, std::pair<std::string, shared_ptr<BuildingEntity> >& target_read_object)
-{
-	if (line.empty())
-	{
-		return;
-	}
-	char* stream_pos = const_cast<char*>(line.c_str());
-	while (isspace(*stream_pos))
-	{
-		++stream_pos;
-	}
-
-	if (*stream_pos != '#')
-	{
-		return;
-	}
-
-	// need at least one integer here
-	++stream_pos;
-	if (*stream_pos == '\0')
-	{
-		return;
-	}
-
-	if (!isdigit(*stream_pos))
-	{
-		return;
-	}
-	char* begin_id = stream_pos;
-
-	// proceed until end of integer
-	++stream_pos;
-	while (*stream_pos != '\0')
-	{
-		if (isdigit(*stream_pos))
-		{
-			++stream_pos;
-		}
-		else
-		{
-			break;
-		}
-	}
-
-	const int tag = atoi(std::string(begin_id, stream_pos - begin_id).c_str());
-
-	// skip whitespace
-	while (isspace(*stream_pos)) { ++stream_pos; }
-
-	// next char after whitespace needs to be an "="
-	if (*stream_pos != '=')
-	{
-		// print error
-		return;
-	}
-	++stream_pos;
-
-	// skip whitespaces
-	while (isspace(*stream_pos)) { ++stream_pos; }
-
-	// extract keyword
-	const char* entity_name_begin = stream_pos;
-	while (isalnum(*stream_pos)) { ++stream_pos; }
-
-	std::string entity_name_upper(entity_name_begin, stream_pos - entity_name_begin);
-	convertStringToUpperCase(entity_name_upper);
-
-	// proceed to '('
-	if (*stream_pos != '(')
-	{
-		while (*stream_pos != '\0')
-		{
-			if (*stream_pos == '(')
-			{
-				break;
-			}
-			++stream_pos;
-		}
-	}
-
-	if (entity_name_upper.empty())
-	{
-		std::stringstream strs;
-		strs << "Could not read STEP line: " << line.c_str();
-		messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-		return;
-	}
-
-	shared_ptr<BuildingEntity> obj(EntityFactory::createEntityObject(entity_name_upper));
-	if (obj)
-	{
-		obj->m_tag = tag;
-		target_read_object.second = obj;
-		size_t sub_length = line.size() - (stream_pos - line.c_str());
-		std::string entity_arg(stream_pos, sub_length);
-		if (entity_arg.size() > 2)
-		{
-			if (entity_arg[0] == '(')
-			{
-				if (entity_arg[entity_arg.size() - 1] == ')')
-				{
-					// semicolon already removed
-					entity_arg = entity_arg.substr(1, entity_arg.size() - 2);
-				}
-				else if (entity_arg[entity_arg.size() - 1] == ';')
-				{
-					std::string whitespaces (" \t\f\v\n\r");
-					size_t closing_parent_pos = entity_arg.find_last_not_of(whitespaces, entity_arg.size() - 2);
-
-					if (closing_parent_pos != std::string::npos && entity_arg[closing_parent_pos] == ')')
-					{
-						entity_arg = entity_arg.substr(1, closing_parent_pos - 1);
-					}
-				}
-			}
-		}
-		target_read_object.first.assign(entity_arg.begin(), entity_arg.end());
-	}
-	else
-	{
-		throw UnknownEntityException(entity_name_upper);
-	}
-}
-
-void ReaderSTEP::readEntityArguments(std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities, const std::unordered_map<int, shared_ptr<BuildingEntity> >& map_entities, shared_ptr<BuildingModel>& model)
-{
-	// second pass, now read arguments
-	// every object can be initialized independently in parallel
-	const int num_objects = static_cast<int>(vec_entities.size());
-	std::stringstream err;
-	std::string ifc_version = model->getIfcSchemaVersionOfLoadedFile();
-
-	// set progress
-	double progress = 0.3;
-	progressValueCallback(progress, "parse");
-	double last_progress = 0.3;
-	const std::unordered_map<int, shared_ptr<BuildingEntity> >* map_entities_ptr = &map_entities;
-	std::unordered_set<int> entityIdNotFoundAll;
-
-	std::mutex mutexProgress;
-	std::mutex mutexError;
-	std::mutex mutexEntityIdNotFound;
-	int i = 0;
-
-#ifdef _DEBUG
-	std::unordered_set<std::string> setClassesWithAdjustedArguments;
-#endif
-	
-	FOR_EACH_LOOP vec_entities.begin(), vec_entities.end(), [&](std::pair<std::string, shared_ptr<BuildingEntity> >& entity_read_object) {
-			if (model->isLoadingCancelled())
-			{
-				return;
-			}
-
-			const shared_ptr<BuildingEntity>& entity = entity_read_object.second;
-			if (!entity)
-			{
-				return;
-			}
-			std::stringstream errorStream;
-			std::unordered_set<int> entityIdNotFound;
-			std::string& argument_str = entity_read_object.first;
-			std::vector<std::string> arguments_raw;
-			tokenizeEntityArguments(argument_str, arguments_raw);
-			argument_str.clear();
-
-			// character decoding:
-			std::vector<std::string> arguments_decoded;
-			decodeArgumentStrings(arguments_raw, arguments_decoded);
-			arguments_raw.clear();
-
-			const size_t num_expected_arguments = entity->getNumAttributes();
-			if (entity->classID() == IFCCOLOURRGB)
-			{
-				if (arguments_decoded.size() < num_expected_arguments)
-				{
-					arguments_decoded.insert(arguments_decoded.begin(), "$");
-				}
-			}
-			else if (entity->classID() == IFCPRESENTATIONSTYLEASSIGNMENT)
-			{
-				if (num_expected_arguments > arguments_decoded.size())
-				{
-					arguments_decoded.insert(arguments_decoded.begin(), "$");
-				}
-			}
-			else if (entity->classID() == IFCTRIANGULATEDFACESET)
-			{
-				// IFC4: second argument: Closed : OPTIONAL IfcBoolean;
-				// Coordinates : IfcCartesianPointList3D;
-				// Normals : OPTIONAL LIST [1:?] OF LIST [3:3] OF IfcParameterValue;
-				// Closed : OPTIONAL IfcBoolean;
-				// CoordIndex : LIST [1:?] OF LIST [3:3] OF IfcPositiveInteger;
-				// PnIndex : OPTIONAL LIST [1:?] OF IfcPositiveInteger;
-
-				// IFC4X3 arguments:
-				// Coordinates : IfcCartesianPointList3D;
-				// Closed : OPTIONAL IfcBoolean;
-				// Normals : OPTIONAL LIST [1:?] OF LIST [3:3] OF IfcParameterValue;
-				// CoordIndex : LIST [1:?] OF LIST [3:3] OF IfcPositiveInteger;
-				// PnIndex : OPTIONAL LIST [1:?] OF IfcPositiveInteger;
-
-				if (arguments_decoded.size() > 2)
-				{
-					if (arguments_decoded[2].compare(".T.") == 0 || arguments_decoded[2].compare(".F.") == 0)
-					{
-						//std::swap(arguments_decoded[2], arguments_decoded[1]);
-					}
-				}
-			}
-#ifdef _DEBUG
-			if (entity->classID() == IFCRELVOIDSELEMENT)
-			{
-				int tag = entity->m_tag;
-			}
-			if (entity->m_tag == 23)
-			{
-				std::string className = EntityFactory::getStringForClassID(entity->classID());
-			}
-#endif
-
-			if (num_expected_arguments != arguments_decoded.size())
-			{
-				while (arguments_decoded.size() > num_expected_arguments) { arguments_decoded.pop_back(); }
-				while (arguments_decoded.size() < num_expected_arguments) { arguments_decoded.emplace_back("$"); }
-#ifdef _DEBUG
-				std::string className = EntityFactory::getStringForClassID(entity->classID());
-				if (setClassesWithAdjustedArguments.find(className) == setClassesWithAdjustedArguments.end())
-				{
-					//std::cout << "adjusted number of arguments for entity #" << entity->m_tag << "=" << className << std::endl;
-					setClassesWithAdjustedArguments.insert(className);
-				}
-#endif
-			}
-
-			try
-			{
-				entity->readStepArguments(arguments_decoded, map_entities, errorStream, entityIdNotFound);
-			}
-			catch (std::exception& e)
-			{
-				const std::lock_guard<std::mutex> lock(mutexError);
-				err << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << ": " << e.what();
-			}
-			catch (std::exception* e)
-			{
-				const std::lock_guard<std::mutex> lock(mutexError);
-				err << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << ": " << e->what();
-			}
-			catch (...)
-			{
-				const std::lock_guard<std::mutex> lock(mutexError);
-				err << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << " readStepData: error occurred" << std::endl;
-			}
-
-			// in case there are unresolved references
-			if (entityIdNotFound.size() > 0)
-			{
-				const std::lock_guard<std::mutex> lock(mutexEntityIdNotFound);
-				std::copy(entityIdNotFound.begin(), entityIdNotFound.end(), std::inserter(entityIdNotFoundAll, entityIdNotFoundAll.end()));
-			}
-
-			if (errorStream.tellp() > 0)
-			{
-				const std::lock_guard<std::mutex> lock(mutexError);
-				err << errorStream.str();
-			}
-
-			//if (i % 10 == 0)
-			{
-				progress = 0.3 + 0.6 * double(i) / double(num_objects);
-				if (progress - last_progress > 0.03)
-				{
-					const std::lock_guard<std::mutex> lock(mutexProgress);
-					progressValueCallback(progress, "parse");
-					last_progress = progress;
-				}
-			}
-
-			++i;
-		});
-
-	for (auto it = vec_entities.begin(); it != vec_entities.end(); ++it)
-	{
-		if (model->isLoadingCancelled())
-		{
-			vec_entities.clear();
-			break;
-		}
-
-		std::pair<std::string, shared_ptr<BuildingEntity> >& entity_read_object = *it;
-		const shared_ptr<BuildingEntity>& entity = entity_read_object.second;
-
-		if (entity->classID() == IFCSTYLEDITEM)
-		{
-			int tag = entity->m_tag;
-			shared_ptr<IfcStyledItem> styledItem = dynamic_pointer_cast<IfcStyledItem>(entity);
-			if (styledItem)
-			{
-				std::vector<shared_ptr<IfcPresentationStyle> >			vec_presentationStylesReplaced;
-				for (shared_ptr<IfcPresentationStyle>& presentationStyle : styledItem->m_Styles)
-				{
-					if (!presentationStyle)
-					{
-						continue;
-					}
-
-					shared_ptr<IfcPresentationStyleAssignment> presentationStyleAssignment = dynamic_pointer_cast<IfcPresentationStyleAssignment>(presentationStyle);
-					if (presentationStyleAssignment)
-					{
-						// IFCPRESENTATIONSTYLEASSIGNMENT has been removed in IFC4X3
-						// old:    IfcRepresentationItem  <- IFCSTYLEDITEM ->  IFCPRESENTATIONSTYLEASSIGNMENT -> IFCSURFACESTYLE
-						// new      IfcRepresentationItem  <- IFCSTYLEDITEM ->     [x]   ->      IFCSURFACESTYLE
-
-						for (shared_ptr<IfcPresentationStyle>& presentationStyle : presentationStyleAssignment->m_Styles)
-						{
-							if (!presentationStyle)
-							{
-								continue;
-							}
-
-							//ENTITY IfcPresentationStyle ABSTRACT SUPERTYPE OF (ONEOF (IfcCurveStyle ,IfcFillAreaStyle ,IfcSurfaceStyle ,IfcTextStyle));
-
-							shared_ptr<IfcSurfaceStyle> surfaceStyle = dynamic_pointer_cast<IfcSurfaceStyle>(presentationStyle);
-							if (surfaceStyle)
-							{
-								vec_presentationStylesReplaced.push_back(surfaceStyle);
-								continue;
-							}
-
-							shared_ptr<IfcCurveStyle> curveStyle = dynamic_pointer_cast<IfcCurveStyle>(presentationStyle);
-							if (curveStyle)
-							{
-								vec_presentationStylesReplaced.push_back(curveStyle);
-								continue;
-							}
-
-							shared_ptr<IfcFillAreaStyle> fillAreaStyle = dynamic_pointer_cast<IfcFillAreaStyle>(presentationStyle);
-							if (fillAreaStyle)
-							{
-								vec_presentationStylesReplaced.push_back(fillAreaStyle);
-								continue;
-							}
-
-							shared_ptr<IfcTextStyle> textStyle = dynamic_pointer_cast<IfcTextStyle>(presentationStyle);
-							if (textStyle)
-							{
-								vec_presentationStylesReplaced.push_back(textStyle);
-								continue;
-							}
-						}
-						continue;
-					}
-
-					vec_presentationStylesReplaced.push_back(presentationStyle);
-				}
-
-				styledItem->m_Styles = vec_presentationStylesReplaced;
-			}
-		}
-	}
-
-	if (entityIdNotFoundAll.size() > 0)
-	{
-		// unresolved entity references
-		err << "Entity with id # ";
-
-		for (auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); ++it)
-		{
-			if (it != entityIdNotFoundAll.begin())
-			{
-				err << ", ";
-			}
-			err << *it;
-		}
-
-		err << "  not found" << std::endl;
-	}
-
-	if (err.tellp() > 0)
-	{
-		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-	}
-}
-
-void ReaderSTEP::readData(std::istream& read_in, std::streampos file_size, shared_ptr<BuildingModel>& model)
-{
-	std::string current_numeric_locale(setlocale(LC_NUMERIC, nullptr));
-	setlocale(LC_NUMERIC, "C");
-
-	if (read_in.peek() == EOF)
-	{
-		return;
-	}
-	std::string file_schema_version = model->getIfcSchemaVersionOfLoadedFile();
-	messageCallback(std::string("Detected IFC version: ") + file_schema_version, StatusCallback::MESSAGE_TYPE_GENERAL_MESSAGE, __FUNC__);
-
-	size_t read_size = model->getFileHeader().size();
-	std::stringstream err;
-	std::unordered_set<std::string> unkown_entities;
-	std::stringstream err_unknown_entity;
-	std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > > vec_entities;
-	try
-	{
-		std::string line;
-		std::string linePreviousRemaining;
-		size_t lineCount = 0;
-		double progress = 0;
-		double last_progress = 0;
-
-		bool hasMoreLines = true;
-		while (hasMoreLines)
-		{
-			if (bufferedGetStepLine(read_in, line).eof())
-			{
-				hasMoreLines = false;
-			}
-
-			read_size += line.size();
-			std::pair<std::string, shared_ptr<BuildingEntity> > entity_read_obj;
-			try
-			{
-				readSingleStepLine(line, entity_read_obj);
-				if (entity_read_obj.second)
-				{
-					vec_entities.push_back(entity_read_obj);
-					line = "";
-				}
-			}
-			catch (UnknownEntityException& e)
-			{
-				std::string step_line_fix = line;
-				std::string unknown_keyword = e.m_keyword;
-
-				std::map<std::string, std::string > mapFindReplaceTypes;
-				mapFindReplaceTypes["IFCBEAMSTANDARDCASE"] = "IFCBEAM";
-				mapFindReplaceTypes["IFC2DCOMPOSITECURVE"] = "IFCCOMPOSITECURVE";
-				mapFindReplaceTypes["IFCELECTRICDISTRIBUTIONPOINT"] = "IFCFLOWCONTROLLER";
-				// IfcElectricDistributionPoint	DELETED   ->  IfcFlowController
-
-				for (auto it : mapFindReplaceTypes)
-				{
-					const std::string& find1 = it.first;
-					const std::string& replace1 = it.second;
-
-					size_t pos1 = step_line_fix.find(find1);
-					if (pos1 != std::string::npos)
-					{
-						step_line_fix.replace(pos1, find1.size(), replace1);
-					}
-				}
-
-				if (step_line_fix.compare(line) != 0)
-				{
-					try
-					{
-						readSingleStepLine(step_line_fix, entity_read_obj);
-						if (entity_read_obj.second)
-						{
-							vec_entities.push_back(entity_read_obj);
-							line = "";
-						}
-						continue;
-					}
-					catch (UnknownEntityException&)
-					{
-
-					}
-				}
-
-				if (unkown_entities.find(unknown_keyword) == unkown_entities.end())
-				{
-					unkown_entities.insert(unknown_keyword);
-					err_unknown_entity << "unknown IFC entity: " << unknown_keyword << std::endl;
-				}
-			}
-			catch (std::exception& e)
-			{
-				err << e.what();
-			}
-
-			if (lineCount % 100 == 0)
-			{
-				progress = 0.05 + 0.2 * double(read_size) / double(file_size);
-				if (progress - last_progress > 0.01)
-				{
-					// TODO read arguments already in parallel thread
-					progressValueCallback(progress, "parse");
-					last_progress = progress;
-				}
-
-				if (model->isLoadingCancelled())
-				{
-					vec_entities.clear();
-					return;
-				}
-			}
-
-			++lineCount;
-		}
-	}
-	catch (BuildingException& e)
-	{
-		err << e.what();
-	}
-	catch (std::exception& e)
-	{
-		err << e.what();
-	}
-	catch (...)
-	{
-		err << __FUNC__ << ": error occurred" << std::endl;
-	}
-
-	if (err_unknown_entity.tellp() > 0)
-	{
-		messageCallback(err_unknown_entity.str(), StatusCallback::MESSAGE_TYPE_UNKNOWN_ENTITY, __FUNC__);
-	}
-
-	// copy entities into map so that they can be found during entity attribute initialization
-	std::unordered_map<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
-	for (auto& entity_read_object : vec_entities)
-	{
-		shared_ptr<BuildingEntity> entity = entity_read_object.second;
-
-		if (entity) // skip aborted entities
-		{
-			model->insertEntity(entity);
-		}
-	}
-
-	try
-	{
-		readEntityArguments(vec_entities, map_entities, model);
-	}
-	catch (BuildingException& e)
-	{
-		err << e.what();
-	}
-	catch (std::exception& e)
-	{
-		err << e.what();
-	}
-	catch (...)
-	{
-		err << __FUNC__ << ": error occurred" << std::endl;
-	}
-
-	setlocale(LC_NUMERIC, current_numeric_locale.c_str());
-	if (err.tellp() > 0)
-	{
-		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
-	}
-}
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <unordered_set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/Trace.h>
+#include <ifcpp/model/UnknownEntityException.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <IfcBuilding.h>
+#include <IfcBuildingStorey.h>
+#include <IfcColour.h>
+#include <IfcColourOrFactor.h>
+#include <IfcColourRgb.h>
+#include <IfcContext.h>
+#include <IfcCurveStyle.h>
+#include <IfcDerivedUnit.h>
+#include <IfcDerivedUnitElement.h>
+#include <IfcDimensionalExponents.h>
+#include <IfcFillAreaStyle.h>
+#include <IfcGeometricRepresentationContext.h>
+#include <IfcLabel.h>
+#include <IfcMeasureWithUnit.h>
+#include <IfcMonetaryUnit.h>
+#include <IfcNamedUnit.h>
+#include <IfcNormalisedRatioMeasure.h>
+#include <IfcPresentationStyle.h>
+#include <IfcPresentationStyleAssignment.h>
+#include <IfcProject.h>
+#include <IfcProductRepresentation.h>
+#include <IfcRelAggregates.h>
+#include <IfcRelContainedInSpatialStructure.h>
+#include <IfcRepresentation.h>
+#include <IfcSite.h>
+#include <IfcStyledItem.h>
+#include <IfcSurfaceStyle.h>
+#include <IfcSurfaceStyleElementSelect.h>
+#include <IfcSurfaceStyleRendering.h>
+#include <IfcTextStyle.h>
+#include <IfcUnitAssignment.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#include <tchar.h>
+#endif
+
+#include <external/zippy/zippy.hpp>
+
+#include "ReaderUtil.h"
+#include "ReaderSTEP.h"
+
+using namespace IFC4X3;
+
+ReaderSTEP::ReaderSTEP() = default;
+ReaderSTEP::~ReaderSTEP() = default;
+
+void ReaderSTEP::setClassFilter(ClassFilterEnum filter, const std::vector<uint32_t>& classIDs)
+{
+	m_classFilter = filter;
+	m_classFilterSelected.assign(IFC_NUM_ENTITY_CLASSES, false);
+	for (uint32_t classID : classIDs)
+	{
+		const EntityClassInfo* info = EntityFactory::getEntityClassInfo(classID);
+		if (!info)
+		{
+			messageCallback(std::string("Class filter: not an entity class: ") + EntityFactory::getStringForClassID(classID), StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__);
+			continue;
+		}
+
+		// subtypes follow their supertype in class index order
+		std::fill(m_classFilterSelected.begin() + info->m_index, m_classFilterSelected.begin() + info->m_index_end, true);
+	}
+}
+
+bool ReaderSTEP::isClassSkipped(uint32_t classID) const
+{
+	const EntityClassInfo* info = EntityFactory::getEntityClassInfo(classID);
+	if (!info)
+	{
+		return false;
+	}
+	if (m_classFilter == CLASS_FILTER_ALLOW)
+	{
+		return !m_classFilterSelected[info->m_index];
+	}
+	if (m_classFilter == CLASS_FILTER_DENY)
+	{
+		return m_classFilterSelected[info->m_index];
+	}
+	return false;
+}
+
+void ReaderSTEP::collectReferencedTags(const std::string& arguments, std::vector<int>& tags)
+{
+	const char* stream_pos = arguments.c_str();
+	while (*stream_pos != '\0')
+	{
+		if (*stream_pos == '\'')
+		{
+			findEndOfString(stream_pos);
+			continue;
+		}
+		if (*stream_pos == '#')
+		{
+			++stream_pos;
+			int tag = 0;
+			while (isdigit(*stream_pos))
+			{
+				tag = tag * 10 + (*stream_pos - '0');
+				++stream_pos;
+			}
+			tags.push_back(tag);
+			continue;
+		}
+		++stream_pos;
+	}
+}
+
+void ReaderSTEP::keepEntitiesReferencedByRoots(std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities)
+{
+	// references are taken from the argument text, so that entities that are not needed are never parsed
+	BuildingModelMapType<int, size_t> map_index;
+	std::vector<bool> keep(vec_entities.size(), false);
+	std::vector<size_t> stack;
+	for (size_t ii = 0; ii < vec_entities.size(); ++ii)
+	{
+		const shared_ptr<BuildingEntity>& entity = vec_entities[ii].second;
+		if (!entity)
+		{
+			continue;
+		}
+		map_index[entity->m_tag] = ii;
+		if (m_classFilterSelected[entity->classIndex()])
+		{
+			keep[ii] = true;
+			stack.push_back(ii);
+		}
+	}
+
+	std::vector<int> referenced_tags;
+	while (!stack.empty())
+	{
+		const size_t index = stack.back();
+		stack.pop_back();
+		referenced_tags.clear();
+		collectReferencedTags(vec_entities[index].first, referenced_tags);
+		for (int tag : referenced_tags)
+		{
+			auto it_find = map_index.find(tag);
+			if (it_find != map_index.end() && !keep[it_find->second])
+			{
+				keep[it_find->second] = true;
+				stack.push_back(it_find->second);
+			}
+		}
+	}
+
+	size_t num_kept = 0;
+	for (size_t ii = 0; ii < vec_entities.size(); ++ii)
+	{
+		if (keep[ii])
+		{
+			if (ii != num_kept)
+			{
+				vec_entities[num_kept] = std::move(vec_entities[ii]);
+			}
+			++num_kept;
+		}
+		else if (vec_entities[ii].second)
+		{
+			m_skippedEntityTags.push_back(vec_entities[ii].second->m_tag);
+		}
+	}
+	vec_entities.resize(num_kept);
+}
+
+void ReaderSTEP::loadModelFromFile(const std::string& filePath, shared_ptr<BuildingModel>& targetModel)
+{
+	// if file content needs to be loaded into a plain model, call resetModel() before loadModelFromFile
+	std::string ext = getFileExtension(filePath);
+	std::string uncompressedFileName = "";
+	std::string filePathRead = filePath;
+
+	if (std_iequal(ext, ".ifc"))
+	{
+		// ok, nothing to do here
+	}
+	else if (std_iequal(ext, ".ifcXML"))
+	{
+		// TODO: implement xml reader
+		messageCallback("ifcXML not yet implemented", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+	else if (std_iequal(ext, ".ifcZIP") || std_iequal(ext, ".zip"))
+	{
+		std::stringstream buffer;
+		buffer.seekp(0, std::ios::end);
+		std::stringstream::pos_type buffer_size = buffer.tellp();
+
+		uncompressedFileName = filePath + "_uncompressed77334.ifc";
+
+		std::shared_ptr<Zippy::ZipArchive> archive(new Zippy::ZipArchive());
+		archive->Open(filePath.c_str());
+
+		std::vector<std::string> entryNames = archive->GetEntryNames();
+		if (entryNames.size() == 0)
+		{
+			return;
+		}
+
+		std::string zipcontent = archive->GetEntry(entryNames[0]).GetDataAsString();
+		std::ofstream zipFileUncompressed(uncompressedFileName, std::ofstream::out);
+		zipFileUncompressed << zipcontent;
+		zipFileUncompressed.close();
+
+		std::ifstream infile;
+		infile.open(uncompressedFileName.c_str(), std::ifstream::in);
+
+		if (!infile.is_open())
+		{
+			std::stringstream strs;
+			strs << "Could not unzip file: " << filePath;
+			messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+			return;
+		}
+
+
+		filePathRead = uncompressedFileName;
+	}
+	else
+	{
+		std::stringstream strs;
+		strs << "Unsupported file type: " << ext;
+		messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	// open file
+	setlocale(LC_ALL, "");
+	std::ifstream infile;
+	infile.open(filePathRead.c_str(), std::ifstream::in);
+
+	if (!infile.is_open())
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePathRead.c_str();
+		messageCallback(strs.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	// get length of file content
+	infile.imbue(std::locale(""));
+	infile.seekg(0, std::ios::end);
+	std::streampos file_end_pos = infile.tellg();
+	infile.seekg(0, std::ios::beg);
+
+	loadModelFromStream(infile, file_end_pos, targetModel);
+	infile.close();
+
+	if (uncompressedFileName.size() > 0)
+	{
+		try
+		{
+			std::filesystem::remove(uncompressedFileName);
+		}
+		catch (std::exception& e)
+		{
+			std::cout << __FUNCTION__ << ": " << __LINE__ << ": exception: " << e.what() << ", input file: " << uncompressedFileName << std::endl;
+		}
+	}
+}
+
+void ReaderSTEP::loadModelFromStream(std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel)
+{
+	IFCPP_TRACE_SCOPE("ReaderSTEP::loadModelFromStream");
+
+	readHeader(content, targetModel);
+
+	// currently generated IFC classes are IFC4X3, files with older versions are converted. So after loading, the schema is always IFC4X3
+	targetModel->setIfcSchemaVersionEnumCurrent( BuildingModel::IFC4X3 );
+	readData(content, file_end_pos, targetModel);
+	targetModel->resolveInverseAttributes();
+	targetModel->updateCache();
+
+	double progress = 1.0;
+	progressValueCallback(progress, "parse");
+}
+
+void removeComments(std::string& line)
+{
+	for (size_t ii = 0; ii < line.size(); ++ii)
+	{
+		size_t found_comment_start = line.find("/*");
+		if (found_comment_start == std::string::npos)
+		{
+			break;
+		}
+		size_t found_comment_end = line.find("*/");
+		if (found_comment_end != std::string::npos)
+		{
+			if (found_comment_end > found_comment_start)
+			{
+				line.erase(found_comment_start, found_comment_end - found_comment_start + 2);
+			}
+		}
+		else
+		{
+			line.erase(found_comment_start);
+		}
+	}
+}
+
+void ReaderSTEP::readHeader(std::istream& content, shared_ptr<BuildingModel>& target_model)
+{
+	if (!target_model)
+	{
+		throw BuildingException("Model not set.", __FUNC__);
+	}
+
+	target_model->setFileHeader("");
+	target_model->setFileDescription("");
+	target_model->setFileName("");
+
+	std::string line;
+	std::string strHeader;
+	size_t line_header_start = std::string::npos;
+	size_t line_header_end = std::string::npos;
+	size_t lineCount = 0;
+	bool inComment = false;
+
+	while (!bufferedGetline(content, line).eof())
+	{
+		size_t found_comment_start = line.find("/*");
+		if (found_comment_start != std::string::npos)
+		{
+			inComment = true;
+		}
+
+		if (inComment)
+		{
+			size_t found_comment_end = line.find("*/");
+			if (found_comment_end != std::string::npos)
+			{
+				if (found_comment_start != std::string::npos)
+				{
+					// comment start and end in same line
+					if (found_comment_end > found_comment_start)
+					{
+						inComment = false;
+						line.erase(found_comment_start, found_comment_end - found_comment_start + 2);
+						//continue;
+					}
+					// TODO: remove comment from line, and check rest of line
+				}
+				else
+				{
+					inComment = false;
+					continue;
+				}
+			}
+		}
+		if (inComment)
+		{
+			continue;
+		}
+
+		if (line_header_start == std::string::npos)
+		{
+			size_t found = line.find("HEADER;");
+			if (found != std::string::npos)
+			{
+				line_header_start = lineCount;
+				strHeader += line + '\n';
+			}
+		}
+		else
+		{
+			if (line_header_end == std::string::npos)
+			{
+				strHeader += line + '\n';
+			}
+		}
+
+		if (line_header_end == std::string::npos)
+		{
+			size_t found = line.find("ENDSEC;");
+			if (found != std::string::npos)
+			{
+				line_header_end = lineCount;
+				break;
+			}
+		}
+
+		++lineCount;
+	}
+
+	removeComments(strHeader);
+	target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC_VERSION_UNDEFINED);
+	std::vector<std::string> vec_header;
+	std::vector<std::string> vec_header_str;
+	vec_header.emplace_back(strHeader);
+	decodeArgumentStrings(vec_header, vec_header_str);
+
+	std::string file_header_str;
+	if (!vec_header_str.empty())
+	{
+		file_header_str = vec_header_str[0];
+	}
+	target_model->setFileHeader(file_header_str);
+
+	std::vector<std::string> vec_header_lines;
+	// split into lines
+	const char* stream_pos = &file_header_str[0];
+	const char* last_token = stream_pos;
+
+	if (stream_pos == nullptr)
+	{
+		throw BuildingException("Invalid file content, couldn't find HEADER section", __FUNC__);
+	}
+
+	while (*stream_pos != '\0')
+	{
+		if (*stream_pos == '\'')
+		{
+			findEndOfString(stream_pos);
+			continue;
+		}
+
+		if (*stream_pos == ';')
+		{
+			const char* begin_line = last_token;
+			std::string single_step_line(begin_line, stream_pos - last_token);
+			vec_header_lines.push_back(single_step_line);
+
+			++stream_pos;
+			while (isspace(*stream_pos)) { ++stream_pos; }
+			last_token = stream_pos;
+
+			continue;
+		}
+		++stream_pos;
+	}
+
+	for (auto header_line : vec_header_lines)
+	{
+		if (header_line.find("FILE_DESCRIPTION") != std::string::npos)
+		{
+			target_model->setFileDescription(header_line);
+			continue;
+		}
+
+		if (header_line.find("FILE_NAME") != std::string::npos)
+		{
+			target_model->setFileName(header_line);
+			continue;
+		}
+
+		if (header_line.find("FILE_SCHEMA") != std::string::npos)
+		{
+			size_t file_schema_begin = header_line.find("FILE_SCHEMA") + 11;
+
+			std::string file_schema_args = header_line.substr(11);
+			size_t find_whitespace = file_schema_args.find(' ');
+			while (find_whitespace != std::string::npos) { file_schema_args.erase(find_whitespace, 1); find_whitespace = file_schema_args.find(L' '); }
+
+			if (file_schema_args.empty())
+			{
+				continue;
+			}
+
+			if (file_schema_args.at(0) == '(' && file_schema_args.at(file_schema_args.size() - 1) == ')')
+			{
+				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
+			}
+			if (file_schema_args.at(0) == '(' && file_schema_args.at(file_schema_args.size() - 1) == ')')
+			{
+				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
+			}
+			if (file_schema_args.at(0) == '\'' && file_schema_args.at(file_schema_args.size() - 1) == '\'')
+			{
+				file_schema_args = file_schema_args.substr(1, file_schema_args.size() - 2);
+			}
+
+			convertStringToUpperCase(file_schema_args);
+
+			if (file_schema_args.compare("IFC4X3") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X3);
+			}
+			else if (file_schema_args.compare("IFC4X1") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X1);
+			}
+			else if (file_schema_args.compare("IFC4") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4);
+			}
+			else if (file_schema_args.substr(0, 6).compare("IFC2X4") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X4);
+			}
+			else if (file_schema_args.substr(0, 6).compare("IFC2X3") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X3);
+			}
+			else if (file_schema_args.substr(0, 6).compare("IFC2X2") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X2);
+			}
+			else if (file_schema_args.substr(0, 5).compare("IFC2X") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X);
+			}
+			else if (file_schema_args.substr(0, 5).compare("IFC20") == 0)
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC2X);
+			}
+			else
+			{
+				target_model->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC_VERSION_UNKNOWN);
+			}
+		}
+	}
+}
+
+void ReaderSTEP::readSingleStepLine(const std::string& line, std::pair<std::string, shared_ptr<BuildingEntity> >& target_read_object)
+{
+	if (line.empty())
+	{
+		return;
+	}
+	char* stream_pos = const_cast<char*>(line.c_str());
+	while (isspace(*stream_pos))
+	{
+		++stream_pos;
+	}
+
+	if (*stream_pos != '#')
+	{
+		return;
+	}
+
+	// need at least one integer here
+	++stream_pos;
+	if (*stream_pos == '\0')
+	{
+		return;
+	}
+
+	if (!isdigit(*stream_pos))
+	{
+		return;
+	}
+	char* begin_id = stream_pos;
+
+	// proceed until end of integer
+	++stream_pos;
+	while (*stream_pos != '\0')
+	{
+		if (isdigit(*stream_pos))
+		{
+			++stream_pos;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	const int tag = atoi(std::string(begin_id, stream_pos - begin_id).c_str());
+
+	// skip whitespace
+	while (isspace(*stream_pos)) { ++stream_pos; }
+
+	// next char after whitespace needs to be an "="
+	if (*stream_pos != '=')
+	{
+		// print error
+		return;
+	}
+	++stream_pos;
+
+	// skip whitespaces
+	while (isspace(*stream_pos)) { ++stream_pos; }
+
+	// extract keyword
+	const char* entity_name_begin = stream_pos;
+	while (isalnum(*stream_pos)) { ++stream_pos; }
+
+	std::string entity_name_upper(entity_name_begin, stream_pos - entity_name_begin);
+	convertStringToUpperCase(entity_name_upper);
+
+	// proceed to '('
+	if (*stream_pos != '(')
+	{
+		while (*stream_pos != '\0')
+		{
+			if (*stream_pos == '(')
+			{
+				break;
+			}
+			++stream_pos;
+		}
+	}
+
+	if (entity_name_upper.empty())
+	{
+		std::stringstream strs;
+		strs << "Could not read STEP line: " << line.c_str();
+		messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	shared_ptr<BuildingEntity> obj;
+	if (m_classFilter == CLASS_FILTER_ALLOW || m_classFilter == CLASS_FILTER_DENY)
+	{
+		const uint32_t classID = EntityFactory::getClassIDForEntityName(entity_name_upper);
+		if (isClassSkipped(classID))
+		{
+			// filtered out: neither create the entity nor keep its arguments
+			m_skippedEntityTags.push_back(tag);
+			return;
+		}
+		obj.reset(EntityFactory::createEntityObject(classID));
+	}
+	else
+	{
+		obj.reset(EntityFactory::createEntityObject(entity_name_upper));
+	}
+
+	if (obj)
+	{
+		obj->m_tag = tag;
+		target_read_object.second = obj;
+		size_t sub_length = line.size() - (stream_pos - line.c_str());
+		std::string entity_arg(stream_pos, sub_length);
+		if (entity_arg.size() > 2)
+		{
+			if (entity_arg[0] == '(')
+			{
+				if (entity_arg[entity_arg.size() - 1] == ')')
+				{
+					// semicolon already removed
+					entity_arg = entity_arg.substr(1, entity_arg.size() - 2);
+				}
+				else if (entity_arg[entity_arg.size() - 1] == ';')
+				{
+					std::string whitespaces (" \t\f\v\n\r");
+					size_t closing_parent_pos = entity_arg.find_last_not_of(whitespaces, entity_arg.size() - 2);
+
+					if (closing_parent_pos != std::string::npos && entity_arg[closing_parent_pos] == ')')
+					{
+						entity_arg = entity_arg.substr(1, closing_parent_pos - 1);
+					}
+				}
+			}
+		}
+		target_read_object.first.assign(entity_arg.begin(), entity_arg.end());
+	}
+	else
+	{
+		throw UnknownEntityException(entity_name_upper);
+	}
+}
+
+// entities that are needed while loading: the project and units in BuildingModel::updateCache, and styles for the conversion of IfcPresentationStyleAssignment
+static bool isParsedWhileLoading(const shared_ptr<BuildingEntity>& entity)
+{
+	return entity->isA<IfcContext>() || entity->isA<IfcGeometricRepresentationContext>() || entity->isA<IfcUnitAssignment>() || entity->isA<IfcNamedUnit>()
+		|| entity->isA<IfcDerivedUnit>() || entity->isA<IfcDerivedUnitElement>() || entity->isA<IfcDimensionalExponents>() || entity->isA<IfcMeasureWithUnit>()
+		|| entity->isA<IfcMonetaryUnit>() || entity->isA<IfcStyledItem>() || entity->isA<IfcPresentationStyleAssignment>();
+}
+
+void ReaderSTEP::readEntityArgumentString(const shared_ptr<BuildingEntity>& entity, std::string& argument_str, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	std::vector<std::string> arguments_raw;
+	tokenizeEntityArguments(argument_str, arguments_raw);
+	argument_str.clear();
+
+	// character decoding:
+	std::vector<std::string> arguments_decoded;
+	decodeArgumentStrings(arguments_raw, arguments_decoded);
+	arguments_raw.clear();
+
+	const size_t num_expected_arguments = entity->getNumAttributes();
+	if (entity->classID() == IFCCOLOURRGB)
+	{
+		if (arguments_decoded.size() < num_expected_arguments)
+		{
+			arguments_decoded.insert(arguments_decoded.begin(), "$");
+		}
+	}
+	else if (entity->classID() == IFCPRESENTATIONSTYLEASSIGNMENT)
+	{
+		if (num_expected_arguments > arguments_decoded.size())
+		{
+			arguments_decoded.insert(arguments_decoded.begin(), "$");
+		}
+	}
+	else if (entity->classID() == IFCTRIANGULATEDFACESET)
+	{
+		// IFC4: second argument: Closed : OPTIONAL IfcBoolean;
+		// Coordinates : IfcCartesianPointList3D;
+		// Normals : OPTIONAL LIST [1:?] OF LIST [3:3] OF IfcParameterValue;
+		// Closed : OPTIONAL IfcBoolean;
+		// CoordIndex : LIST [1:?] OF LIST [3:3] OF IfcPositiveInteger;
+		// PnIndex : OPTIONAL LIST [1:?] OF IfcPositiveInteger;
+
+		// IFC4X3 arguments:
+		// Coordinates : IfcCartesianPointList3D;
+		// Closed : OPTIONAL IfcBoolean;
+		// Normals : OPTIONAL LIST [1:?] OF LIST [3:3] OF IfcParameterValue;
+		// CoordIndex : LIST [1:?] OF LIST [3:3] OF IfcPositiveInteger;
+		// PnIndex : OPTIONAL LIST [1:?] OF IfcPositiveInteger;
+
+		if (arguments_decoded.size() > 2)
+		{
+			if (arguments_decoded[2].compare(".T.") == 0 || arguments_decoded[2].compare(".F.") == 0)
+			{
+				//std::swap(arguments_decoded[2], arguments_decoded[1]);
+			}
+		}
+	}
+#ifdef _DEBUG
+	if (entity->classID() == IFCRELVOIDSELEMENT)
+	{
+		int tag = entity->m_tag;
+	}
+	if (entity->m_tag == 23)
+	{
+		std::string className = EntityFactory::getStringForClassID(entity->classID());
+	}
+#endif
+
+	if (num_expected_arguments != arguments_decoded.size())
+	{
+		while (arguments_decoded.size() > num_expected_arguments) { arguments_decoded.pop_back(); }
+		while (arguments_decoded.size() < num_expected_arguments) { arguments_decoded.emplace_back("$"); }
+	}
+
+	try
+	{
+		entity->readStepArguments(arguments_decoded, map_entities, errorStream, entityIdNotFound);
+	}
+	catch (std::exception& e)
+	{
+		errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << ": " << e.what();
+	}
+	catch (std::exception* e)
+	{
+		errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << ": " << e->what();
+	}
+	catch (...)
+	{
+		errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << " readStepData: error occurred" << std::endl;
+	}
+}
+
+void ReaderSTEP::readEntityArguments(std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities, shared_ptr<BuildingModel>& model)
+{
+	// second pass, now read arguments
+	// every object can be initialized independently in parallel
+	IFCPP_TRACE_SCOPE("ReaderSTEP: read arguments (pass 2)");
+	std::stringstream err;
+	std::string ifc_version = model->getIfcSchemaVersionOfLoadedFile();
+
+	// set progress
+	progressValueCallback(0.3, "parse");
+	ProgressAggregator progress(this, "parse", vec_entities.size(), 0.3, 0.9, 0.03);
+	std::set<int> entityIdNotFoundAll;	// ordered, so that the error message does not depend on the number of threads
+
+	// each range of entities collects errors and unresolved ids locally, they are merged once per range
+	RangeMessages rangeErrors;
+	std::mutex mutexEntityIdNotFound;
+
+	Executor::get( m_executor ).parallelForRange( 0, vec_entities.size(), m_grainSize, [&](size_t rangeBegin, size_t rangeEnd) {
+			std::stringstream errorStream;
+			std::unordered_set<int> entityIdNotFound;
+			size_t numDone = 0;
+			for (size_t ii = rangeBegin; ii < rangeEnd; ++ii)
+			{
+				if (model->isLoadingCancelled())
+				{
+					break;
+				}
+
+				std::pair<std::string, shared_ptr<BuildingEntity> >& entity_read_object = vec_entities[ii];
+				const shared_ptr<BuildingEntity>& entity = entity_read_object.second;
+				if (entity)
+				{
+					readEntityArgumentString(entity, entity_read_object.first, map_entities, errorStream, entityIdNotFound);
+				}
+
+				// count progress in batches, to keep the shared counter out of the inner loop
+				if (++numDone == 64)
+				{
+					progress.addDone(numDone);
+					numDone = 0;
+				}
+			}
+			progress.addDone(numDone);
+
+			// in case there are unresolved references
+			if (entityIdNotFound.size() > 0)
+			{
+				const std::lock_guard<std::mutex> lock(mutexEntityIdNotFound);
+				std::copy(entityIdNotFound.begin(), entityIdNotFound.end(), std::inserter(entityIdNotFoundAll, entityIdNotFoundAll.end()));
+			}
+			rangeErrors.addRange(rangeBegin, errorStream);
+		});
+	rangeErrors.appendTo(err);
+
+	for (auto it = vec_entities.begin(); it != vec_entities.end(); ++it)
+	{
+		if (model->isLoadingCancelled())
+		{
+			vec_entities.clear();
+			break;
+		}
+
+		std::pair<std::string, shared_ptr<BuildingEntity> >& entity_read_object = *it;
+		const shared_ptr<BuildingEntity>& entity = entity_read_object.second;
+
+		if (entity->classID() == IFCSTYLEDITEM)
+		{
+			int tag = entity->m_tag;
+			shared_ptr<IfcStyledItem> styledItem = entity_cast<IfcStyledItem>(entity);
+			if (styledItem)
+			{
+				std::vector<shared_ptr<IfcPresentationStyle> >			vec_presentationStylesReplaced;
+				for (shared_ptr<IfcPresentationStyle>& presentationStyle : styledItem->m_Styles)
+				{
+					if (!presentationStyle)
+					{
+						continue;
+					}
+
+					shared_ptr<IfcPresentationStyleAssignment> presentationStyleAssignment = entity_cast<IfcPresentationStyleAssignment>(presentationStyle);
+					if (presentationStyleAssignment)
+					{
+						// IFCPRESENTATIONSTYLEASSIGNMENT has been removed in IFC4X3
+						// old:    IfcRepresentationItem  <- IFCSTYLEDITEM ->  IFCPRESENTATIONSTYLEASSIGNMENT -> IFCSURFACESTYLE
+						// new      IfcRepresentationItem  <- IFCSTYLEDITEM ->     [x]   ->      IFCSURFACESTYLE
+
+						for (shared_ptr<IfcPresentationStyle>& presentationStyle : presentationStyleAssignment->m_Styles)
+						{
+							if (!presentationStyle)
+							{
+								continue;
+							}
+
+							//ENTITY IfcPresentationStyle ABSTRACT SUPERTYPE OF (ONEOF (IfcCurveStyle ,IfcFillAreaStyle ,IfcSurfaceStyle ,IfcTextStyle));
+
+							shared_ptr<IfcSurfaceStyle> surfaceStyle = entity_cast<IfcSurfaceStyle>(presentationStyle);
+							if (surfaceStyle)
+							{
+								vec_presentationStylesReplaced.push_back(surfaceStyle);
+								continue;
+							}
+
+							shared_ptr<IfcCurveStyle> curveStyle = entity_cast<IfcCurveStyle>(presentationStyle);
+							if (curveStyle)
+							{
+								vec_presentationStylesReplaced.push_back(curveStyle);
+								continue;
+							}
+
+							shared_ptr<IfcFillAreaStyle> fillAreaStyle = entity_cast<IfcFillAreaStyle>(presentationStyle);
+							if (fillAreaStyle)
+							{
+								vec_presentationStylesReplaced.push_back(fillAreaStyle);
+								continue;
+							}
+
+							shared_ptr<IfcTextStyle> textStyle = entity_cast<IfcTextStyle>(presentationStyle);
+							if (textStyle)
+							{
+								vec_presentationStylesReplaced.push_back(textStyle);
+								continue;
+							}
+						}
+						continue;
+					}
+
+					vec_presentationStylesReplaced.push_back(presentationStyle);
+				}
+
+				styledItem->m_Styles = vec_presentationStylesReplaced;
+			}
+		}
+	}
+
+	if (m_skippedEntityTags.size() > 0)
+	{
+		// references to entities that have been skipped by the class filter are expected
+		for (auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); )
+		{
+			if (std::binary_search(m_skippedEntityTags.begin(), m_skippedEntityTags.end(), *it))
+			{
+				it = entityIdNotFoundAll.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	if (entityIdNotFoundAll.size() > 0)
+	{
+		// unresolved entity references
+		err << "Entity with id # ";
+
+		for (auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); ++it)
+		{
+			if (it != entityIdNotFoundAll.begin())
+			{
+				err << ", ";
+			}
+			err << *it;
+		}
+
+		err << "  not found" << std::endl;
+	}
+
+	if (err.tellp() > 0)
+	{
+		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+	}
+}
+
+void ReaderSTEP::readData(std::istream& read_in, std::streampos file_size, shared_ptr<BuildingModel>& model)
+{
+	std::string current_numeric_locale(setlocale(LC_NUMERIC, nullptr));
+	setlocale(LC_NUMERIC, "C");
+
+	if (read_in.peek() == EOF)
+	{
+		return;
+	}
+	std::string file_schema_version = model->getIfcSchemaVersionOfLoadedFile();
+	messageCallback(std::string("Detected IFC version: ") + file_schema_version, StatusCallback::MESSAGE_TYPE_GENERAL_MESSAGE, __FUNC__);
+
+	size_t read_size = model->getFileHeader().size();
+	std::stringstream err;
+	std::unordered_set<std::string> unkown_entities;
+	std::stringstream err_unknown_entity;
+	std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > > vec_entities;
+	m_skippedEntityTags.clear();
+	try
+	{
+		IFCPP_TRACE_SCOPE("ReaderSTEP: read lines (pass 1)");
+		std::string line;
+		std::string linePreviousRemaining;
+		size_t lineCount = 0;
+		double progress = 0;
+		double last_progress = 0;
+
+		bool hasMoreLines = true;
+		while (hasMoreLines)
+		{
+			if (bufferedGetStepLine(read_in, line).eof())
+			{
+				hasMoreLines = false;
+			}
+
+			read_size += line.size();
+			std::pair<std::string, shared_ptr<BuildingEntity> > entity_read_obj;
+			try
+			{
+				readSingleStepLine(line, entity_read_obj);
+				if (entity_read_obj.second)
+				{
+					vec_entities.push_back(entity_read_obj);
+					line = "";
+				}
+			}
+			catch (UnknownEntityException& e)
+			{
+				std::string step_line_fix = line;
+				std::string unknown_keyword = e.m_keyword;
+
+				std::map<std::string, std::string > mapFindReplaceTypes;
+				mapFindReplaceTypes["IFCBEAMSTANDARDCASE"] = "IFCBEAM";
+				mapFindReplaceTypes["IFC2DCOMPOSITECURVE"] = "IFCCOMPOSITECURVE";
+				mapFindReplaceTypes["IFCELECTRICDISTRIBUTIONPOINT"] = "IFCFLOWCONTROLLER";
+				// IfcElectricDistributionPoint	DELETED   ->  IfcFlowController
+
+				for (auto it : mapFindReplaceTypes)
+				{
+					const std::string& find1 = it.first;
+					const std::string& replace1 = it.second;
+
+					size_t pos1 = step_line_fix.find(find1);
+					if (pos1 != std::string::npos)
+					{
+						step_line_fix.replace(pos1, find1.size(), replace1);
+					}
+				}
+
+				if (step_line_fix.compare(line) != 0)
+				{
+					try
+					{
+						readSingleStepLine(step_line_fix, entity_read_obj);
+						if (entity_read_obj.second)
+						{
+							vec_entities.push_back(entity_read_obj);
+							line = "";
+						}
+						continue;
+					}
+					catch (UnknownEntityException&)
+					{
+
+					}
+				}
+
+				if (unkown_entities.find(unknown_keyword) == unkown_entities.end())
+				{
+					unkown_entities.insert(unknown_keyword);
+					err_unknown_entity << "unknown IFC entity: " << unknown_keyword << std::endl;
+				}
+			}
+			catch (std::exception& e)
+			{
+				err << e.what();
+			}
+
+			if (lineCount % 100 == 0)
+			{
+				progress = 0.05 + 0.2 * double(read_size) / double(file_size);
+				if (progress - last_progress > 0.01)
+				{
+					// TODO read arguments already in parallel thread
+					progressValueCallback(progress, "parse");
+					last_progress = progress;
+				}
+
+				if (model->isLoadingCancelled())
+				{
+					vec_entities.clear();
+					return;
+				}
+			}
+
+			++lineCount;
+		}
+	}
+	catch (BuildingException& e)
+	{
+		err << e.what();
+	}
+	catch (std::exception& e)
+	{
+		err << e.what();
+	}
+	catch (...)
+	{
+		err << __FUNC__ << ": error occurred" << std::endl;
+	}
+
+	if (err_unknown_entity.tellp() > 0)
+	{
+		messageCallback(err_unknown_entity.str(), StatusCallback::MESSAGE_TYPE_UNKNOWN_ENTITY, __FUNC__);
+	}
+
+	if (m_classFilter == CLASS_FILTER_ROOTS)
+	{
+		keepEntitiesReferencedByRoots(vec_entities);
+	}
+	std::sort(m_skippedEntityTags.begin(), m_skippedEntityTags.end());
+
+	// copy entities into map so that they can be found during entity attribute initialization
+	BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+	int max_tag = 0;
+	for (auto& entity_read_object : vec_entities)
+	{
+		if (entity_read_object.second && entity_read_object.second->m_tag > max_tag)
+		{
+			max_tag = entity_read_object.second->m_tag;
+		}
+	}
+	if (size_t(max_tag) < (map_entities.size() + vec_entities.size() + 1) * BuildingModelMapType<int, shared_ptr<BuildingEntity> >::MAX_DENSE_RANGE_PER_VALUE)
+	{
+		// ids are dense, so reserve the id range at once
+		map_entities.reserve(size_t(max_tag) + 1);
+	}
+
+	for (auto& entity_read_object : vec_entities)
+	{
+		shared_ptr<BuildingEntity> entity = entity_read_object.second;
+
+		if (entity) // skip aborted entities
+		{
+			model->insertEntity(entity);
+		}
+	}
+
+	if (m_deferArguments)
+	{
+		// lazy loading: keep the arguments as text in the model, they are parsed in BuildingModel::materialize
+		auto it_deferred = std::remove_if(vec_entities.begin(), vec_entities.end(), [&](std::pair<std::string, shared_ptr<BuildingEntity> >& entity_read_object) {
+			const shared_ptr<BuildingEntity>& entity = entity_read_object.second;
+			if (!entity || isParsedWhileLoading(entity) || !m_deferArguments(entity))
+			{
+				return false;
+			}
+			model->setDeferredArguments(entity->m_tag, entity_read_object.first);
+			return true;
+		});
+		vec_entities.erase(it_deferred, vec_entities.end());
+	}
+
+	try
+	{
+		readEntityArguments(vec_entities, map_entities, model);
+	}
+	catch (BuildingException& e)
+	{
+		err << e.what();
+	}
+	catch (std::exception& e)
+	{
+		err << e.what();
+	}
+	catch (...)
+	{
+		err << __FUNC__ << ": error occurred" << std::endl;
+	}
+
+	std::vector<int>().swap(m_skippedEntityTags);
+	setlocale(LC_NUMERIC, current_numeric_locale.c_str());
+	if (err.tellp() > 0)
+	{
+		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+	}
+}
+
+// sidecar index of the entity records in an IFC file, written by writeEntityIndex. Records are sorted by tag.
+// Values are stored in the byte order of the writing machine, loadEntityClosure rejects an index with a different byte order
+static const char ENTITY_INDEX_MAGIC[8] = { 'I', 'F', 'C', 'P', 'P', 'I', 'D', 'X' };
+static const uint32_t ENTITY_INDEX_VERSION = 2;
+static const uint32_t ENTITY_INDEX_BYTE_ORDER_MARK = 0x01020304;
+
+struct EntityIndexHeader
+{
+	char		m_magic[8];
+	uint32_t	m_version;
+	uint32_t	m_byte_order_mark;
+	uint32_t	m_record_size;
+	uint32_t	m_reserved;
+	uint64_t	m_file_size;
+	uint64_t	m_num_records;
+};
+
+struct EntityIndexRecord
+{
+	int32_t		m_tag;
+	uint32_t	m_class_id;		// 0 for classes that are not known
+	uint64_t	m_offset;		// position of the # in the IFC file
+	uint64_t	m_length;		// up to and including the ;
+};
+
+bool ReaderSTEP::writeEntityIndex(const std::string& filePath, const std::string& indexFilePath)
+{
+	std::ifstream infile(filePath.c_str(), std::ifstream::in | std::ifstream::binary);
+	if (!infile.is_open())
+	{
+		messageCallback("Could not open file: " + filePath, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return false;
+	}
+
+	// find the beginning and end of each statement, skipping strings and comments. Statements that start with #id=KEYWORD are entity records
+	std::vector<EntityIndexRecord> vec_records;
+	std::vector<char> buffer(1 << 20);
+	uint64_t buffer_offset = 0;
+	uint64_t statement_begin = 0;
+	bool in_statement = false;
+	bool in_string = false;
+	bool in_comment = false;
+	bool previous_slash = false;
+	bool previous_star = false;
+	std::string statement_head;	// #id=KEYWORD, without whitespace
+	bool statement_head_complete = false;
+
+	while (infile)
+	{
+		infile.read(buffer.data(), buffer.size());
+		const size_t num_read = size_t(infile.gcount());
+		for (size_t ii = 0; ii < num_read; ++ii)
+		{
+			const char c = buffer[ii];
+			if (in_comment)
+			{
+				in_comment = !(previous_star && c == '/');
+				previous_star = c == '*';
+				continue;
+			}
+			if (in_string)
+			{
+				// a quote inside a string is written as two quotes, which toggles twice
+				in_string = c != '\'';
+				continue;
+			}
+			if (previous_slash)
+			{
+				previous_slash = false;
+				if (c == '*')
+				{
+					in_comment = true;
+					previous_star = false;
+					continue;
+				}
+			}
+
+			if (c == '/')
+			{
+				previous_slash = true;
+				continue;
+			}
+			if (isspace(c))
+			{
+				continue;
+			}
+			if (!in_statement)
+			{
+				in_statement = true;
+				statement_begin = buffer_offset + ii;
+				statement_head.clear();
+				statement_head_complete = false;
+			}
+			if (c == '\'')
+			{
+				in_string = true;
+			}
+			else if (c == ';')
+			{
+				in_statement = false;
+				if (statement_head.size() > 1 && statement_head[0] == '#')
+				{
+					const size_t pos_equal = statement_head.find('=');
+					if (pos_equal != std::string::npos)
+					{
+						EntityIndexRecord record;
+						record.m_tag = atoi(statement_head.c_str() + 1);
+						record.m_class_id = EntityFactory::getClassIDForEntityName(statement_head.substr(pos_equal + 1));
+						record.m_offset = statement_begin;
+						record.m_length = buffer_offset + ii + 1 - statement_begin;
+						vec_records.push_back(record);
+					}
+				}
+				continue;
+			}
+
+			if (!statement_head_complete)
+			{
+				if (c == '(' || statement_head.size() > 128)
+				{
+					statement_head_complete = true;
+				}
+				else
+				{
+					statement_head += char(toupper(c));
+				}
+			}
+		}
+		buffer_offset += num_read;
+	}
+
+	std::sort(vec_records.begin(), vec_records.end(), [](const EntityIndexRecord& a, const EntityIndexRecord& b) { return a.m_tag < b.m_tag; });
+
+	EntityIndexHeader header;
+	std::memcpy(header.m_magic, ENTITY_INDEX_MAGIC, sizeof(header.m_magic));
+	header.m_version = ENTITY_INDEX_VERSION;
+	header.m_byte_order_mark = ENTITY_INDEX_BYTE_ORDER_MARK;
+	header.m_record_size = sizeof(EntityIndexRecord);
+	header.m_reserved = 0;
+	header.m_file_size = buffer_offset;
+	header.m_num_records = vec_records.size();
+
+	std::ofstream outfile(indexFilePath.c_str(), std::ofstream::out | std::ofstream::binary);
+	outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	outfile.write(reinterpret_cast<const char*>(vec_records.data()), vec_records.size() * sizeof(EntityIndexRecord));
+	if (!outfile)
+	{
+		messageCallback("Could not write file: " + indexFilePath, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return false;
+	}
+	return true;
+}
+
+void ReaderSTEP::loadEntityClosure(const std::string& filePath, const std::string& indexFilePath, int tag, int depth, shared_ptr<BuildingModel>& targetModel)
+{
+	std::ifstream indexfile(indexFilePath.c_str(), std::ifstream::in | std::ifstream::binary);
+	EntityIndexHeader header;
+	if (!indexfile.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.m_magic, ENTITY_INDEX_MAGIC, sizeof(header.m_magic)) != 0
+		|| header.m_version != ENTITY_INDEX_VERSION || header.m_byte_order_mark != ENTITY_INDEX_BYTE_ORDER_MARK || header.m_record_size != sizeof(EntityIndexRecord))
+	{
+		messageCallback("Not a valid entity index: " + indexFilePath, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	std::ifstream infile(filePath.c_str(), std::ifstream::in | std::ifstream::binary);
+	if (!infile.is_open())
+	{
+		messageCallback("Could not open file: " + filePath, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+	infile.seekg(0, std::ios::end);
+	if (uint64_t(infile.tellg()) != header.m_file_size)
+	{
+		messageCallback("Entity index does not match file, it needs to be written again: " + indexFilePath, StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+	infile.seekg(0, std::ios::beg);
+
+	// binary search in the index file, so that it is not loaded completely
+	auto findRecord = [&](int findTag, EntityIndexRecord& record) -> bool {
+		uint64_t begin = 0;
+		uint64_t end = header.m_num_records;
+		while (begin < end)
+		{
+			const uint64_t mid = begin + (end - begin) / 2;
+			indexfile.seekg(sizeof(EntityIndexHeader) + mid * sizeof(EntityIndexRecord));
+			if (!indexfile.read(reinterpret_cast<char*>(&record), sizeof(EntityIndexRecord)))
+			{
+				indexfile.clear();
+				return false;
+			}
+			if (record.m_tag == findTag)
+			{
+				return true;
+			}
+			if (record.m_tag < findTag)
+			{
+				begin = mid + 1;
+			}
+			else
+			{
+				end = mid;
+			}
+		}
+		return false;
+	};
+
+	std::string current_numeric_locale(setlocale(LC_NUMERIC, nullptr));
+	setlocale(LC_NUMERIC, "C");
+
+	readHeader(infile, targetModel);
+	targetModel->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X3);
+
+	// breadth first, so that each entity is reached with the lowest depth
+	std::stringstream err;
+	std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > > vec_entities;
+	std::unordered_set<int> set_visited = { tag };
+	std::vector<int> current_level = { tag };
+	std::vector<int> next_level;
+	std::vector<int> referenced_tags;
+	m_skippedEntityTags.clear();
+	for (int level = 0; !current_level.empty(); ++level)
+	{
+		next_level.clear();
+		for (int current_tag : current_level)
+		{
+			EntityIndexRecord record;
+			if (!findRecord(current_tag, record))
+			{
+				// missing references are reported by readEntityArguments
+				if (level == 0)
+				{
+					err << "Entity #" << current_tag << " not found in entity index" << std::endl;
+				}
+				continue;
+			}
+
+			// read exactly this record, so that a damaged record without ; does not run into the following ones
+			std::string record_text(size_t(record.m_length), '\0');
+			infile.clear();
+			infile.seekg(record.m_offset);
+			if (!infile.read(&record_text[0], record.m_length))
+			{
+				err << "Entity #" << current_tag << " could not be read at offset " << record.m_offset << std::endl;
+				continue;
+			}
+
+			// removes comments and white space outside of strings, like when reading the whole file
+			std::string line;
+			std::istringstream record_stream(record_text);
+			bufferedGetStepLine(record_stream, line);
+
+			std::pair<std::string, shared_ptr<BuildingEntity> > entity_read_obj;
+			try
+			{
+				readSingleStepLine(line, entity_read_obj);
+			}
+			catch (UnknownEntityException& e)
+			{
+				err << "unknown IFC entity: " << e.m_keyword << std::endl;
+			}
+			if (!entity_read_obj.second)
+			{
+				continue;
+			}
+
+			referenced_tags.clear();
+			collectReferencedTags(entity_read_obj.first, referenced_tags);
+			for (int referenced_tag : referenced_tags)
+			{
+				if (depth >= 0 && level >= depth)
+				{
+					// beyond the requested depth, leave the reference empty
+					m_skippedEntityTags.push_back(referenced_tag);
+				}
+				else if (set_visited.insert(referenced_tag).second)
+				{
+					next_level.push_back(referenced_tag);
+				}
+			}
+			vec_entities.push_back(std::move(entity_read_obj));
+		}
+		std::swap(current_level, next_level);
+	}
+	std::sort(m_skippedEntityTags.begin(), m_skippedEntityTags.end());
+
+	for (auto& entity_read_object : vec_entities)
+	{
+		targetModel->insertEntity(entity_read_object.second);
+	}
+
+	readEntityArguments(vec_entities, targetModel->getMapIfcEntities(), targetModel);
+	std::vector<int>().swap(m_skippedEntityTags);
+	setlocale(LC_NUMERIC, current_numeric_locale.c_str());
+
+	targetModel->resolveInverseAttributes();
+	targetModel->updateCache();
+
+	if (err.tellp() > 0)
+	{
+		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+	}
+}
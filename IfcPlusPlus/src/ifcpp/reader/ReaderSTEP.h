@@ -17,9 +17,12 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <functional>
+#include <vector>
 #include "ifcpp/model/BasicTypes.h"
 #include "ifcpp/model/BuildingObject.h"
 #include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/Executor.h"
 #include "ifcpp/model/StatusCallback.h"
 
 class IFCQUERY_EXPORT ReaderSTEP : public StatusCallback
@@ -27,6 +30,10 @@ class IFCQUERY_EXPORT ReaderSTEP : public StatusCallback
 public:
 	ReaderSTEP();
 	~ReaderSTEP() override;
+
+	bool hasMessageListener(MessageType type) const override { return hasMessageCallback(type); }
+
+	enum ClassFilterEnum { CLASS_FILTER_NONE, CLASS_FILTER_ALLOW, CLASS_FILTER_DENY, CLASS_FILTER_ROOTS };
 	void readHeader( std::istream& in, shared_ptr<BuildingModel>& target_model );
 	void readData( std::istream& in, std::streampos file_end_pos, shared_ptr<BuildingModel>& model );
 	
@@ -36,5 +43,47 @@ public:
 	void loadModelFromFile( const std::string& filePath, shared_ptr<BuildingModel>& targetModel );
 	void loadModelFromStream( std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel );
 	void readSingleStepLine(	const std::string& line, std::pair<std::string, shared_ptr<BuildingEntity> >& target_read_object );
-	void readEntityArguments(	std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities, const std::unordered_map<int, shared_ptr<BuildingEntity> >& map, shared_ptr<BuildingModel>& targetModel );
+	void readEntityArguments(	std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, shared_ptr<BuildingModel>& targetModel );
+
+	/*\brief Lazy loading. For entities where deferArguments returns true, the arguments are not parsed while loading, but kept as text in the model until BuildingModel::materialize or materializeEntity is called.
+	  For example BuildingModel::isPropertyOrQuantity defers property sets and quantities, which are not needed for geometry. Entities that are needed while loading, like IfcProject and units, are always parsed.
+	  An empty function (default) parses all entities while loading.
+	**/
+	void setDeferredArguments( const std::function<bool(const shared_ptr<BuildingEntity>&)>& deferArguments ) { m_deferArguments = deferArguments; }
+
+	/*\brief Tokenizes and decodes the arguments of one entity, and calls readStepArguments. Errors are written to errorStream. arguments is cleared to release memory early. */
+	static void readEntityArgumentString( const shared_ptr<BuildingEntity>& entity, std::string& arguments, const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
+
+	/*\brief Appends the tags of all #id references in the argument text of an entity, without parsing the arguments. References in strings are ignored. */
+	static void collectReferencedTags( const std::string& arguments, std::vector<int>& tags );
+
+	/*\brief Loads only a part of the entities. Classes include their subtypes, for example IFCPROPERTYABSTRACTION for all properties.
+	  CLASS_FILTER_ALLOW loads only entities of the given classes, CLASS_FILTER_DENY all other entities.
+	  CLASS_FILTER_ROOTS loads entities of the given classes, and all entities that they reference directly or indirectly, for example IFCRELCONTAINEDINSPATIALSTRUCTURE for all contained elements with their geometry.
+	  With CLASS_FILTER_ALLOW and CLASS_FILTER_DENY, skipped entities are neither created nor are their arguments stored. References to skipped entities are left empty without error message.
+	**/
+	void setClassFilter( ClassFilterEnum filter, const std::vector<uint32_t>& classIDs );
+
+	/*\brief Scans an IFC file for its entity records, and writes an index with tag, class, file offset and length of each record to indexFilePath. Nothing is parsed. Returns false on error.
+	  The index is used by loadEntityClosure. It belongs to the file in the state when it was written, and is rejected if the file size has changed. **/
+	bool writeEntityIndex( const std::string& filePath, const std::string& indexFilePath );
+
+	/*\brief Loads the entity with the given tag and the entities it references, up to depth levels of references (-1: unlimited), into targetModel.
+	  Only the needed records are read, at the offsets from the index written by writeEntityIndex. References beyond depth are left empty without error message. **/
+	void loadEntityClosure( const std::string& filePath, const std::string& indexFilePath, int tag, int depth, shared_ptr<BuildingModel>& targetModel );
+
+	/*\brief Executor for the parallel loops, see Executor. If not set, Executor::getDefault() is used.
+	  \param[in] grainSize Number of entities per task, 0 to choose it from the number of entities and threads. **/
+	void setExecutor( const shared_ptr<Executor>& executor, size_t grainSize = 0 ) { m_executor = executor; m_grainSize = grainSize; }
+
+private:
+	bool isClassSkipped( uint32_t classID ) const;
+	void keepEntitiesReferencedByRoots( std::vector<std::pair<std::string, shared_ptr<BuildingEntity> > >& vec_entities );
+
+	std::function<bool(const shared_ptr<BuildingEntity>&)> m_deferArguments;
+	ClassFilterEnum		m_classFilter = CLASS_FILTER_NONE;
+	std::vector<bool>	m_classFilterSelected;		// by EntityClassInfo::m_index, true if the class or one of its supertypes is in the filter
+	std::vector<int>	m_skippedEntityTags;
+	shared_ptr<Executor>	m_executor;
+	size_t				m_grainSize = 0;
 };
@@ -0,0 +1,438 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <clocale>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/SnapshotFormat.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+
+#include "ReaderUtil.h"
+#include "ReaderSnapshot.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace IFC4X3;
+
+static size_t paddedSize( uint64_t size )
+{
+	return size_t( ( size + 7 ) / 8 * 8 );
+}
+
+/** Checks the header and all offsets, so that reading the arguments can not access memory outside of data */
+static bool checkSnapshot( const char* data, size_t size, SnapshotSections& sections, std::stringstream& err )
+{
+	if( !ReaderSnapshot::isSnapshot( data, size ) )
+	{
+		err << "Not a snapshot of this version" << std::endl;
+		return false;
+	}
+	if( reinterpret_cast<uintptr_t>( data ) % 8 != 0 )
+	{
+		err << "Snapshot data needs to be aligned to 8 bytes" << std::endl;
+		return false;
+	}
+
+	const SnapshotFileHeader* header = reinterpret_cast<const SnapshotFileHeader*>( data );
+	const uint64_t max_records = size / 8;
+	if( header->m_num_entities > max_records || header->m_num_nodes > max_records || header->m_num_words > max_records || header->m_string_pool_size > size )
+	{
+		err << "Invalid snapshot size" << std::endl;
+		return false;
+	}
+
+	const size_t entities_begin = paddedSize( sizeof(SnapshotFileHeader) );
+	const size_t nodes_begin = entities_begin + paddedSize( header->m_num_entities*sizeof(SnapshotEntity) );
+	const size_t words_begin = nodes_begin + paddedSize( header->m_num_nodes*sizeof(SnapshotNode) );
+	const size_t strings_begin = words_begin + paddedSize( header->m_num_words*sizeof(uint64_t) );
+	if( strings_begin + header->m_string_pool_size > size )
+	{
+		err << "Snapshot is truncated" << std::endl;
+		return false;
+	}
+
+	sections.m_nodes = reinterpret_cast<const SnapshotNode*>( data + nodes_begin );
+	sections.m_words = reinterpret_cast<const uint64_t*>( data + words_begin );
+	sections.m_strings = data + strings_begin;
+
+	const SnapshotString* header_strings[3] = { &header->m_file_header, &header->m_file_description, &header->m_file_name };
+	for( const SnapshotString* str : header_strings )
+	{
+		if( str->m_offset > header->m_string_pool_size || str->m_size > header->m_string_pool_size - str->m_offset )
+		{
+			err << "Invalid string in snapshot header" << std::endl;
+			return false;
+		}
+	}
+
+	const SnapshotEntity* entities = reinterpret_cast<const SnapshotEntity*>( data + entities_begin );
+	for( uint64_t ii = 0; ii < header->m_num_entities; ++ii )
+	{
+		if( uint64_t( entities[ii].m_first_argument ) + entities[ii].m_num_arguments > header->m_num_nodes )
+		{
+			err << "Invalid arguments of entity #" << entities[ii].m_tag << " in snapshot" << std::endl;
+			return false;
+		}
+	}
+
+	for( uint64_t ii = 0; ii < header->m_num_nodes; ++ii )
+	{
+		const SnapshotNode& node = sections.m_nodes[ii];
+		bool valid = true;
+		switch( node.m_kind )
+		{
+		case SNAPSHOT_NULL:
+		case SNAPSHOT_DERIVED:
+		case SNAPSHOT_REFERENCE:
+		case SNAPSHOT_INTEGER:
+		case SNAPSHOT_REAL:
+		case SNAPSHOT_ENUM:
+		case SNAPSHOT_LOGICAL:
+			break;
+		case SNAPSHOT_TEXT:
+		case SNAPSHOT_STRING:
+			valid = node.m_offset <= header->m_string_pool_size && node.m_size <= header->m_string_pool_size - node.m_offset;
+			break;
+		case SNAPSHOT_REFERENCE_ARRAY:
+		case SNAPSHOT_INTEGER_ARRAY:
+		case SNAPSHOT_REAL_ARRAY:
+			valid = node.m_offset <= header->m_num_words && node.m_size <= header->m_num_words - node.m_offset;
+			break;
+		case SNAPSHOT_LIST:
+			// children are always stored after their parent, so that nested lists and typed values can not form a cycle
+			valid = node.m_offset > ii && node.m_offset <= header->m_num_nodes && node.m_size <= header->m_num_nodes - node.m_offset;
+			break;
+		case SNAPSHOT_TYPED:
+			valid = node.m_offset > ii && node.m_offset < header->m_num_nodes;
+			break;
+		default:
+			valid = false;
+		}
+		if( !valid )
+		{
+			err << "Invalid argument node " << ii << " in snapshot" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ReaderSnapshot::isSnapshot( const char* data, size_t size )
+{
+	if( data == nullptr || size < sizeof(SnapshotFileHeader) )
+	{
+		return false;
+	}
+	SnapshotFileHeader header;
+	std::memcpy( &header, data, sizeof(SnapshotFileHeader) );
+	return std::memcmp( header.m_magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC) ) == 0 && header.m_version == SNAPSHOT_VERSION && header.m_byte_order_mark == SNAPSHOT_BYTE_ORDER_MARK;
+}
+
+namespace
+{
+	/** Read-only memory mapping of a whole file. The mapping starts at a page boundary, so it is aligned as loadModelFromBuffer requires */
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		MappedFile( const MappedFile& ) = delete;
+		MappedFile& operator=( const MappedFile& ) = delete;
+
+		~MappedFile()
+		{
+#ifdef _MSC_VER
+			if( m_data != nullptr )
+			{
+				UnmapViewOfFile( m_data );
+			}
+			if( m_mapping != nullptr )
+			{
+				CloseHandle( m_mapping );
+			}
+			if( m_file != INVALID_HANDLE_VALUE )
+			{
+				CloseHandle( m_file );
+			}
+#else
+			if( m_data != nullptr )
+			{
+				munmap( const_cast<char*>( m_data ), m_size );
+			}
+			if( m_file >= 0 )
+			{
+				close( m_file );
+			}
+#endif
+		}
+
+		/** Returns false if the file can not be opened. An empty file is opened, but not mapped */
+		bool open( const std::string& filePath )
+		{
+#ifdef _MSC_VER
+			m_file = CreateFileA( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+			LARGE_INTEGER file_size;
+			if( m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx( m_file, &file_size ) )
+			{
+				return false;
+			}
+			m_size = size_t( file_size.QuadPart );
+#else
+			m_file = ::open( filePath.c_str(), O_RDONLY );
+			struct stat file_stat;
+			if( m_file < 0 || fstat( m_file, &file_stat ) != 0 )
+			{
+				return false;
+			}
+			m_size = size_t( file_stat.st_size );
+#endif
+			return true;
+		}
+
+		/** Returns false if the file is not empty and can not be mapped */
+		bool map()
+		{
+			if( m_size == 0 )
+			{
+				return true;
+			}
+#ifdef _MSC_VER
+			m_mapping = CreateFileMappingA( m_file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+			if( m_mapping == nullptr )
+			{
+				return false;
+			}
+			m_data = static_cast<const char*>( MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ) );
+			return m_data != nullptr;
+#else
+			void* data = mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0 );
+			if( data == MAP_FAILED )
+			{
+				return false;
+			}
+			m_data = static_cast<const char*>( data );
+
+			// all pages are read during loading, so they can be read ahead
+			madvise( data, m_size, MADV_WILLNEED );
+			return true;
+#endif
+		}
+
+		const char* data() const { return m_data; }
+		size_t size() const { return m_size; }
+
+	private:
+#ifdef _MSC_VER
+		HANDLE			m_file = INVALID_HANDLE_VALUE;
+		HANDLE			m_mapping = nullptr;
+#else
+		int				m_file = -1;
+#endif
+		const char*		m_data = nullptr;
+		size_t			m_size = 0;
+	};
+}
+
+void ReaderSnapshot::loadModelFromFile( const std::string& filePath, shared_ptr<BuildingModel>& targetModel )
+{
+	// the snapshot is decoded in place from the mapping, without copying the file into memory first
+	MappedFile file;
+	if( !file.open( filePath ) )
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePath;
+		messageCallback( strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		return;
+	}
+
+	if( !file.map() )
+	{
+		std::stringstream strs;
+		strs << "Could not map file: " << filePath;
+		messageCallback( strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		return;
+	}
+
+	loadModelFromBuffer( file.data(), file.size(), targetModel );
+}
+
+void ReaderSnapshot::loadModelFromBuffer( const char* data, size_t size, shared_ptr<BuildingModel>& targetModel )
+{
+	if( !targetModel )
+	{
+		throw BuildingException( "Model not set.", __FUNC__ );
+	}
+
+	std::stringstream err;
+	SnapshotSections sections;
+	if( !checkSnapshot( data, size, sections, err ) )
+	{
+		messageCallback( err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		return;
+	}
+
+	// values without binary encoding are read from text, so the same locale is needed as in ReaderSTEP
+	std::string current_numeric_locale( setlocale( LC_NUMERIC, nullptr ) );
+	setlocale( LC_NUMERIC, "C" );
+
+	const SnapshotFileHeader* header = reinterpret_cast<const SnapshotFileHeader*>( data );
+	const SnapshotEntity* records = reinterpret_cast<const SnapshotEntity*>( data + paddedSize( sizeof(SnapshotFileHeader) ) );
+	const size_t num_entities = size_t( header->m_num_entities );
+
+	targetModel->setFileHeader( std::string( sections.m_strings + header->m_file_header.m_offset, size_t( header->m_file_header.m_size ) ) );
+	targetModel->setFileDescription( std::string( sections.m_strings + header->m_file_description.m_offset, size_t( header->m_file_description.m_size ) ) );
+	targetModel->setFileName( std::string( sections.m_strings + header->m_file_name.m_offset, size_t( header->m_file_name.m_size ) ) );
+	targetModel->getIfcSchemaVersionEnumOfLoadedFile() = BuildingModel::SchemaVersionEnum( header->m_schema_version_loaded_file );
+	targetModel->setIfcSchemaVersionEnumCurrent( BuildingModel::IFC4X3 );
+	progressValueCallback( 0.05, "parse" );
+
+	// create entities, then copy them into the map so that they can be found during attribute initialization
+	std::vector<shared_ptr<BuildingEntity> > vec_entities( num_entities );
+	std::unordered_set<uint32_t> unknown_class_ids;
+	int max_tag = 0;
+	for( size_t ii = 0; ii < num_entities; ++ii )
+	{
+		const SnapshotEntity& record = records[ii];
+		BuildingEntity* entity = EntityFactory::createEntityObject( record.m_class_id );
+		if( !entity )
+		{
+			unknown_class_ids.insert( record.m_class_id );
+			continue;
+		}
+		entity->m_tag = record.m_tag;
+		vec_entities[ii] = shared_ptr<BuildingEntity>( entity );
+		if( record.m_tag > max_tag )
+		{
+			max_tag = record.m_tag;
+		}
+	}
+
+	for( uint32_t class_id : unknown_class_ids )
+	{
+		err << "unknown class ID in snapshot: " << class_id << std::endl;
+	}
+
+	BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = targetModel->getMapIfcEntities();
+	if( size_t( max_tag ) < ( map_entities.size() + num_entities + 1 ) * BuildingModelMapType<int, shared_ptr<BuildingEntity> >::MAX_DENSE_RANGE_PER_VALUE )
+	{
+		map_entities.reserve( size_t( max_tag ) + 1 );
+	}
+	for( const shared_ptr<BuildingEntity>& entity : vec_entities )
+	{
+		if( entity )
+		{
+			targetModel->insertEntity( entity );
+		}
+	}
+	progressValueCallback( 0.2, "parse" );
+
+	// read arguments, every entity can be initialized independently in parallel
+	std::set<int> entityIdNotFoundAll;
+	RangeMessages rangeErrors;
+	std::mutex mutexEntityIdNotFound;
+	const SnapshotNode null_node = SnapshotNode();
+
+	// each range of entities collects errors and unresolved ids locally, they are merged once per range
+	Executor::get( m_executor ).parallelForRange( 0, num_entities, m_grainSize, [&]( size_t rangeBegin, size_t rangeEnd ) {
+		std::stringstream errorStream;
+		std::unordered_set<int> entityIdNotFound;
+		std::vector<SnapshotArgument> arguments;
+		for( size_t entityIndex = rangeBegin; entityIndex < rangeEnd; ++entityIndex )
+		{
+			const shared_ptr<BuildingEntity>& entity = vec_entities[entityIndex];
+			if( !entity || targetModel->isLoadingCancelled() )
+			{
+				continue;
+			}
+
+			const SnapshotEntity& record = records[entityIndex];
+			const size_t num_expected_arguments = entity->getNumAttributes();
+			arguments.clear();
+			arguments.reserve( num_expected_arguments );
+			for( size_t ii = 0; ii < record.m_num_arguments && ii < num_expected_arguments; ++ii )
+			{
+				arguments.emplace_back( sections.m_nodes + record.m_first_argument + ii, &sections );
+			}
+			while( arguments.size() < num_expected_arguments )
+			{
+				arguments.emplace_back( &null_node, &sections );
+			}
+
+			try
+			{
+				entity->readBinaryArguments( arguments, map_entities, errorStream, entityIdNotFound );
+			}
+			catch( std::exception& e )
+			{
+				errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID( entity->classID() ) << ": " << e.what();
+			}
+			catch( ... )
+			{
+				errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID( entity->classID() ) << " readBinaryArguments: error occurred" << std::endl;
+			}
+		}
+
+		if( entityIdNotFound.size() > 0 )
+		{
+			const std::lock_guard<std::mutex> lock( mutexEntityIdNotFound );
+			std::copy( entityIdNotFound.begin(), entityIdNotFound.end(), std::inserter( entityIdNotFoundAll, entityIdNotFoundAll.end() ) );
+		}
+		rangeErrors.addRange( rangeBegin, errorStream );
+	});
+	rangeErrors.appendTo( err );
+	progressValueCallback( 0.9, "parse" );
+
+	if( entityIdNotFoundAll.size() > 0 )
+	{
+		err << "Entity with id # ";
+		for( auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); ++it )
+		{
+			if( it != entityIdNotFoundAll.begin() )
+			{
+				err << ", ";
+			}
+			err << *it;
+		}
+		err << "  not found" << std::endl;
+	}
+
+	setlocale( LC_NUMERIC, current_numeric_locale.c_str() );
+	if( err.tellp() > 0 )
+	{
+		messageCallback( err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+	}
+
+	targetModel->resolveInverseAttributes();
+	targetModel->updateCache();
+	progressValueCallback( 1.0, "parse" );
+}
@@ -0,0 +1,59 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/Executor.h"
+#include "ifcpp/model/StatusCallback.h"
+
+/*! \brief Loads a model from a binary snapshot written by WriterSnapshot.
+*
+* Entities are created by class ID, and their attributes are read with BuildingEntity::readBinaryArguments, without tokenizing STEP text.
+* Afterwards the model is in the same state as after ReaderSTEP::loadModelFromFile: inverse attributes are resolved and the cache is updated.
+*/
+class IFCQUERY_EXPORT ReaderSnapshot : public StatusCallback
+{
+public:
+	ReaderSnapshot() = default;
+	~ReaderSnapshot() override = default;
+
+	bool hasMessageListener(MessageType type) const override { return hasMessageCallback(type); }
+
+	/*\brief Maps the file into memory and calls loadModelFromBuffer on the mapping.
+	  \param[in] filePath Path of a file written by WriterSnapshot.
+	**/
+	void loadModelFromFile( const std::string& filePath, shared_ptr<BuildingModel>& targetModel );
+
+	/*\brief Reads a snapshot from memory, for example from a memory mapped file. The data is only read during the call.
+	  \param[in] data Begin of the snapshot, aligned to 8 bytes.
+	**/
+	void loadModelFromBuffer( const char* data, size_t size, shared_ptr<BuildingModel>& targetModel );
+
+	/*\brief Returns true if data starts with the header of a snapshot that this version can read */
+	static bool isSnapshot( const char* data, size_t size );
+
+	/*\brief Executor for the parallel loops, see Executor. If not set, Executor::getDefault() is used.
+	  \param[in] grainSize Number of entities per task, 0 to choose it from the number of entities and threads. **/
+	void setExecutor( const shared_ptr<Executor>& executor, size_t grainSize = 0 ) { m_executor = executor; m_grainSize = grainSize; }
+
+private:
+	shared_ptr<Executor>	m_executor;
+	size_t					m_grainSize = 0;
+};
@@ -16,6 +16,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 */
 
 #define _USE_MATH_DEFINES
+#include <charconv>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -671,12 +672,12 @@ void readRealList(const std::string& str, std::vector<double>& vec)
 	{
 		if (ch[i] == ',')
 		{
-			vec.push_back(std::stod(str.substr(last_token, i - last_token)));
+			vec.push_back(readRealValue(ch + last_token, ch + i));
 			last_token = i + 1;
 		}
 		else if (ch[i] == ')')
 		{
-			vec.push_back(std::stod(str.substr(last_token, i - last_token)));
+			vec.push_back(readRealValue(ch + last_token, ch + i));
 			return;
 		}
 		++i;
@@ -710,7 +711,7 @@ void readRealArray( const std::string& str, double(&vec)[3] )
 		{
 			if (idx < 3)
 			{
-				vec[idx] = std::stod(str.substr(last_token, i - last_token));
+				vec[idx] = readRealValue(ch + last_token, ch + i);
 			}
 			++idx;
 			last_token = i + 1;
@@ -719,7 +720,7 @@ void readRealArray( const std::string& str, double(&vec)[3] )
 		{
 			if (idx < 3)
 			{
-				vec[idx] = std::stod(str.substr(last_token, i - last_token));
+				vec[idx] = readRealValue(ch + last_token, ch + i);
 			}
 			return;
 		}
@@ -1154,7 +1155,7 @@ void decodeArgumentString(const std::string& argument_str, std::string& arg_out)
 			else if (c1 == 'X')
 			{
 				char c2 = *(stream_pos + 2);
-				if (c2 == '\\')
+				if (c2 == '\\' && *(stream_pos + 3) != '\0' && *(stream_pos + 4) != '\0')
 				{
 					// we have \\X\\Unicode code points
 
@@ -1222,9 +1223,15 @@ void decodeArgumentString(const std::string& argument_str, std::string& arg_out)
 								}
 							}
 
-							char codePoint2 = *(stream_pos + 1);
-							char codePoint3 = *(stream_pos + 2);
-							char codePoint4 = *(stream_pos + 3);
+							char codePoint2 = codePoint1 != '\0' ? *(stream_pos + 1) : '\0';
+							char codePoint3 = codePoint2 != '\0' ? *(stream_pos + 2) : '\0';
+							char codePoint4 = codePoint3 != '\0' ? *(stream_pos + 3) : '\0';
+							if (codePoint2 == '\0' || codePoint3 == '\0' || codePoint4 == '\0')
+							{
+								// truncated sequence
+								arg_out = argument_str;
+								return;
+							}
 
 							char c1 = (convertToHex<char>(codePoint1) << 4) | convertToHex<char>(codePoint2);
 							char c2 = (convertToHex<char>(codePoint3) << 4) | convertToHex<char>(codePoint4);
@@ -1236,12 +1243,12 @@ void decodeArgumentString(const std::string& argument_str, std::string& arg_out)
 
 						} while ((*stream_pos != '\0'));
 
-						std::u16string u16str(reinterpret_cast<char16_t*>(&utf16Characters[0]), utf16Characters.size() / 2);
+						std::u16string u16str(reinterpret_cast<char16_t*>(utf16Characters.data()), utf16Characters.size() / 2);
 						std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
 						std::string utf8 = convert.to_bytes(u16str);
 						arg_str_new += utf8;
+						continue;
 					}
-					continue;
 				}
 			}
 			else if (c1 == 'N')
@@ -1323,9 +1330,49 @@ void readIntegerValue(const std::string& str, int& int_value)
 	}
 }
 
+double readRealValue(const char* begin, const char* end)
+{
+	// leading white space and '+' are accepted by std::stod, but not by std::from_chars
+	while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+	{
+		++begin;
+	}
+	if (begin != end && *begin == '+')
+	{
+		++begin;
+		if (begin != end && *begin == '-')
+		{
+			throw std::invalid_argument("readRealValue");
+		}
+	}
+
+	double value = 0;
+	const std::from_chars_result result = std::from_chars(begin, end, value);
+	if (result.ec == std::errc::invalid_argument)
+	{
+		throw std::invalid_argument("readRealValue");
+	}
+	if (result.ec == std::errc::result_out_of_range)
+	{
+		throw std::out_of_range("readRealValue");
+	}
+
+	// only trailing white space is allowed. from_chars stops for example at the 'x' of 0x10, or at the E of 1.E without exponent
+	const char* rest = result.ptr;
+	while (rest != end && std::isspace(static_cast<unsigned char>(*rest)))
+	{
+		++rest;
+	}
+	if (rest != end)
+	{
+		throw std::invalid_argument("readRealValue");
+	}
+	return value;
+}
+
 void readReal(const std::string& attribute_value, double& target)
 {
-	target = std::stod(attribute_value);
+	target = readRealValue(attribute_value);
 }
 
 void readString(const std::string& attribute_value, std::string& target)
@@ -1565,3 +1612,147 @@ bool std_iequal(const std::string& a, const std::string& b)
 	}
 	return false;
 }
+
+void readBool(const SnapshotArgument& arg, bool& target)
+{
+	if (arg.kind() == SNAPSHOT_LOGICAL)
+	{
+		if (arg.integerValue() == 0)
+		{
+			target = false;
+		}
+		else if (arg.integerValue() == 1)
+		{
+			target = true;
+		}
+		return;
+	}
+	readBool(arg.toString(), target);
+}
+
+void readLogical(const SnapshotArgument& arg, LogicalEnum& target)
+{
+	if (arg.kind() == SNAPSHOT_LOGICAL)
+	{
+		if (arg.integerValue() == 0)
+		{
+			target = LOGICAL_FALSE;
+		}
+		else if (arg.integerValue() == 1)
+		{
+			target = LOGICAL_TRUE;
+		}
+		else if (arg.integerValue() == 2)
+		{
+			target = LOGICAL_UNKNOWN;
+		}
+		return;
+	}
+	readLogical(arg.toString(), target);
+}
+
+void readIntegerValue(const SnapshotArgument& arg, int& int_value)
+{
+	if (arg.isNumber())
+	{
+		int_value = int(arg.integerValue());
+		return;
+	}
+	readIntegerValue(arg.toString(), int_value);
+}
+
+void readInteger(const SnapshotArgument& arg, int& result)
+{
+	if (arg.isNumber())
+	{
+		result = int(arg.integerValue());
+		return;
+	}
+	readInteger(arg.toString(), result);
+}
+
+void readReal(const SnapshotArgument& arg, double& target)
+{
+	if (arg.isNumber())
+	{
+		target = arg.realValue();
+		return;
+	}
+	readReal(arg.toString(), target);
+}
+
+void readString(const SnapshotArgument& arg, std::string& target)
+{
+	const SnapshotArgument value = arg.value();
+	if (value.kind() == SNAPSHOT_STRING)
+	{
+		target.assign(value.text(), value.size());
+		return;
+	}
+	if (value.kind() == SNAPSHOT_TEXT)
+	{
+		const char* text = value.text();
+		const size_t length = value.size();
+		if (length >= 2 && text[0] == '\'' && text[length - 1] == '\'')
+		{
+			target.assign(text + 1, length - 2);
+		}
+		else
+		{
+			target.assign(text, length);
+		}
+		return;
+	}
+	readString(value.toString(), target);
+}
+
+void readRealArray(const SnapshotArgument& arg, double(&vec)[3])
+{
+	if (arg.isNumberArray())
+	{
+		for (size_t ii = 0; ii < arg.size() && ii < 3; ++ii)
+		{
+			vec[ii] = arg.realAt(ii);
+		}
+		return;
+	}
+	readRealArray(arg.toString(), vec);
+}
+
+void readIntegerList(const SnapshotArgument& arg, std::vector<int>& vec)
+{
+	const SnapshotArgument list = arg.value();
+	if (list.isNumberArray())
+	{
+		vec.reserve(vec.size() + list.size());
+		for (size_t ii = 0; ii < list.size(); ++ii)
+		{
+			vec.push_back(int(list.integerAt(ii)));
+		}
+		return;
+	}
+	if (list.kind() == SNAPSHOT_NULL || list.isEmptyList())
+	{
+		return;
+	}
+	readIntegerList(list.toString(), vec);
+}
+
+void readRealList(const SnapshotArgument& arg, std::vector<double>& vec)
+{
+	const SnapshotArgument list = arg.value();
+	if (list.isNumberArray())
+	{
+		vec.reserve(vec.size() + list.size());
+		for (size_t ii = 0; ii < list.size(); ++ii)
+		{
+			vec.push_back(list.realAt(ii));
+		}
+		return;
+	}
+	if (list.kind() == SNAPSHOT_NULL || list.isEmptyList())
+	{
+		return;
+	}
+	readRealList(list.toString(), vec);
+}
@@ -29,6 +29,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "ifcpp/model/BasicTypes.h"
 #include "ifcpp/model/BuildingException.h"
 #include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/SnapshotFormat.h"
 #include "ifcpp/IFC4X3/TypeFactory.h"
 
 #ifdef _MSC_VER
@@ -110,6 +111,11 @@ inline void readInteger(const std::string& str, int& result)
 	result = std::stoi(str);
 }
 void readIntegerValue(const std::string& str, int& int_value);
+/** Converts a STEP real like 1.5, -2.E-05 or 1. with '.' as decimal separator. Unlike std::stod, the result does not depend on the C locale, which is shared by all threads.
+  Accepts white space around the number and one optional sign. Throws std::invalid_argument if anything else is left after the number, which also rejects
+  hexadecimal numbers, and std::out_of_range if the value overflows or underflows to zero. Subnormal values are returned, where std::stod throws */
+double readRealValue(const char* begin, const char* end);
+inline double readRealValue(const std::string& str) { return readRealValue(str.data(), str.data() + str.size()); }
 void readReal(const std::string& attribute_value, double& target);
 void readString(const std::string& attribute_value, std::string& target);
 
@@ -288,11 +294,10 @@ void readTypeOfRealList( const std::string& str, std::vector<shared_ptr<T> >& ta
 			size_t length_str = ch - last_token;
 			if( length_str > 0 )
 			{
-				std::string double_str(last_token, length_str);
 				double real_value = 0;
 				try
 				{
-					real_value = std::stod(double_str);
+					real_value = readRealValue(last_token, ch);
 				}
 				catch( std::exception&  )
 				{
@@ -541,7 +546,7 @@ void readTypeList( const std::string arg_complete, std::vector<shared_ptr<T> >&
 
 template<typename select_t>
 void readSelectType( const std::string& item, shared_ptr<select_t>& result, const std::string& defaultType,
-	const std::unordered_map<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
 {
 	char* ch = (char*)item.c_str();
 	if( *ch == '#' )
@@ -799,3 +804,287 @@ void readEntityReferenceList3D( const std::string& str, std::vector<std::vector<
 	err << "no closing parenthesis found: " << str << std::endl;
 	throw BuildingException( err.str(), __FUNC__ );
 }
+
+// Overloads for arguments of a binary snapshot. Values are read directly, only arguments that were stored as STEP text fall back to the text versions above.
+void readBool( const SnapshotArgument& arg, bool& target );
+void readLogical( const SnapshotArgument& arg, LogicalEnum& target );
+void readIntegerValue( const SnapshotArgument& arg, int& int_value );
+void readInteger( const SnapshotArgument& arg, int& result );
+void readReal( const SnapshotArgument& arg, double& target );
+void readString( const SnapshotArgument& arg, std::string& target );
+void readRealArray( const SnapshotArgument& arg, double(&vec)[3] );
+void readIntegerList( const SnapshotArgument& arg, std::vector<int>& vec );
+void readRealList( const SnapshotArgument& arg, std::vector<double>& vec );
+
+template<typename T>
+void readTypeOfIntegerList( const SnapshotArgument& arg, std::vector<shared_ptr<T> >& target_vec )
+{
+	const SnapshotArgument list = arg.value();
+	if( list.isNumberArray() )
+	{
+		target_vec.reserve( target_vec.size() + list.size() );
+		for( size_t ii = 0; ii < list.size(); ++ii )
+		{
+			target_vec.push_back( shared_ptr<T>( new T( int(list.integerAt( ii )) ) ) );
+		}
+		return;
+	}
+	if( list.kind() == SNAPSHOT_NULL || list.isEmptyList() )
+	{
+		return;
+	}
+	readTypeOfIntegerList( list.toString(), target_vec );
+}
+
+template<typename T>
+void readTypeOfIntegerList2D( const SnapshotArgument& arg, std::vector<std::vector<shared_ptr<T> > >& target_vec )
+{
+	if( arg.kind() == SNAPSHOT_LIST && arg.size() > 0 )
+	{
+		target_vec.reserve( target_vec.size() + arg.size() );
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			target_vec.resize( target_vec.size() + 1 );
+			readTypeOfIntegerList( arg.child( ii ), target_vec.back() );
+		}
+		return;
+	}
+	readTypeOfIntegerList2D( arg.toString(), target_vec );
+}
+
+template<typename T>
+void readTypeOfRealList( const SnapshotArgument& arg, std::vector<shared_ptr<T> >& target_vec )
+{
+	const SnapshotArgument list = arg.value();
+	if( list.isNumberArray() )
+	{
+		target_vec.reserve( target_vec.size() + list.size() );
+		for( size_t ii = 0; ii < list.size(); ++ii )
+		{
+			target_vec.push_back( shared_ptr<T>( new T( list.realAt( ii ) ) ) );
+		}
+		return;
+	}
+	if( list.kind() == SNAPSHOT_NULL || list.isEmptyList() )
+	{
+		return;
+	}
+	readTypeOfRealList( list.toString(), target_vec );
+}
+
+template<typename T>
+void readTypeOfRealList2D( const SnapshotArgument& arg, std::vector<std::vector<shared_ptr<T> > >& target_vec )
+{
+	if( arg.kind() == SNAPSHOT_LIST && arg.size() > 0 )
+	{
+		target_vec.reserve( target_vec.size() + arg.size() );
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			target_vec.resize( target_vec.size() + 1 );
+			readTypeOfRealList( arg.child( ii ), target_vec.back() );
+		}
+		return;
+	}
+	readTypeOfRealList2D( arg.toString(), target_vec );
+}
+
+template<typename T>
+void readTypeOfStringList( const SnapshotArgument& arg, std::vector<shared_ptr<T> >& target_vec )
+{
+	if( arg.kind() == SNAPSHOT_LIST )
+	{
+		target_vec.reserve( target_vec.size() + arg.size() );
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			std::string str_value;
+			readString( arg.child( ii ), str_value );
+			target_vec.push_back( shared_ptr<T>( new T( str_value ) ) );
+		}
+		return;
+	}
+	if( arg.kind() == SNAPSHOT_NULL )
+	{
+		return;
+	}
+	readTypeOfStringList( arg.toString(), target_vec );
+}
+
+template<typename T>
+void readEntityReference( const SnapshotArgument& arg, shared_ptr<T>& target, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& mapEntities,
+	std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	if( arg.kind() == SNAPSHOT_REFERENCE )
+	{
+		const int tag = int(arg.entityId());
+		BuildingModelMapType<int,shared_ptr<BuildingEntity> >::const_iterator it_entity = mapEntities.find( tag );
+		if( it_entity != mapEntities.end() )
+		{
+			target = dynamic_pointer_cast<T>(it_entity->second);
+		}
+		else
+		{
+			entityIdNotFound.insert(tag);
+		}
+		return;
+	}
+	if( arg.isEmpty() )
+	{
+		return;
+	}
+	readEntityReference( arg.toString(), target, mapEntities, errorStream, entityIdNotFound );
+}
+
+template<typename T>
+void readEntityReferenceList( const SnapshotArgument& arg, std::vector<shared_ptr<T> >& vec, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& mapEntities,
+	std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	const SnapshotArgument list = arg.value();
+	if( list.kind() == SNAPSHOT_REFERENCE_ARRAY )
+	{
+		vec.reserve( vec.size() + list.size() );
+		BuildingModelMapType<int,shared_ptr<BuildingEntity> >::const_iterator it_entity;
+		for( size_t ii = 0; ii < list.size(); ++ii )
+		{
+			const int id = int(list.integerAt( ii ));
+			it_entity = mapEntities.find( id );
+			if( it_entity != mapEntities.end() )
+			{
+				vec.push_back( dynamic_pointer_cast<T>(it_entity->second) );
+			}
+			else
+			{
+				entityIdNotFound.insert( id );
+			}
+		}
+		return;
+	}
+	if( list.kind() == SNAPSHOT_NULL || list.isEmptyList() )
+	{
+		return;
+	}
+	readEntityReferenceList( list.toString(), vec, mapEntities, errorStream, entityIdNotFound );
+}
+
+template<typename T>
+void readEntityReferenceList2D( const SnapshotArgument& arg, std::vector<std::vector<shared_ptr<T> > >& vec, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& mapEntities,
+	std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	if( arg.kind() == SNAPSHOT_LIST && arg.size() > 0 )
+	{
+		vec.reserve( vec.size() + arg.size() );
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			vec.resize( vec.size() + 1 );
+			readEntityReferenceList( arg.child( ii ), vec.back(), mapEntities, errorStream, entityIdNotFound );
+		}
+		return;
+	}
+	readEntityReferenceList2D( arg.toString(), vec, mapEntities, errorStream, entityIdNotFound );
+}
+
+template<typename select_t>
+void readSelectType( const SnapshotArgument& arg, shared_ptr<select_t>& result, const std::string& defaultType,
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	if( arg.kind() == SNAPSHOT_REFERENCE )
+	{
+		const int id = int(arg.entityId());
+		auto it_entity = mapEntities.find( id );
+		if( it_entity != mapEntities.end() )
+		{
+			result = dynamic_pointer_cast<select_t>(it_entity->second);
+		}
+		else
+		{
+			entityIdNotFound.insert(id);
+		}
+		return;
+	}
+	const uint32_t type_class_id = arg.typeClassID();
+	if( type_class_id != 0 )
+	{
+		// type object, for example IFCLABEL('x') in STEP
+		shared_ptr<BuildingObject> type_instance = IFC4X3::TypeFactory::createTypeObject( type_class_id, arg, mapEntities, errorStream, entityIdNotFound );
+		result = dynamic_pointer_cast<select_t>(type_instance);
+		return;
+	}
+	if( arg.isEmpty() )
+	{
+		return;
+	}
+	readSelectType( arg.toString(), result, defaultType, mapEntities, errorStream, entityIdNotFound );
+}
+
+template<typename select_t>
+void readSelectList( const SnapshotArgument& arg, std::vector<shared_ptr<select_t> >& vec, const std::string& defaultType,
+	const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& mapEntities, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound)
+{
+	if( arg.kind() == SNAPSHOT_REFERENCE_ARRAY )
+	{
+		vec.reserve( vec.size() + arg.size() );
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			const int id = int(arg.integerAt( ii ));
+			auto it_entity = mapEntities.find( id );
+			if( it_entity != mapEntities.end() )
+			{
+				shared_ptr<select_t> select_object = dynamic_pointer_cast<select_t>(it_entity->second);
+				if( select_object )
+				{
+					vec.push_back( select_object );
+				}
+			}
+			else
+			{
+				entityIdNotFound.insert( id );
+			}
+		}
+		return;
+	}
+	const SnapshotArgument array = arg.value();
+	if( arg.kind() == SNAPSHOT_TYPED && ( array.kind() == SNAPSHOT_INTEGER_ARRAY || array.kind() == SNAPSHOT_REAL_ARRAY ) )
+	{
+		// numbers of the same type, for example IfcReal values
+		SnapshotNode item_node = SnapshotEncoder::makeNode( array.kind() == SNAPSHOT_INTEGER_ARRAY ? SNAPSHOT_INTEGER : SNAPSHOT_REAL, arg.typeClassID() );
+		vec.reserve( vec.size() + array.size() );
+		for( size_t ii = 0; ii < array.size(); ++ii )
+		{
+			if( array.kind() == SNAPSHOT_INTEGER_ARRAY )
+			{
+				item_node.m_integer = array.integerAt( ii );
+			}
+			else
+			{
+				item_node.m_real = array.realAt( ii );
+			}
+			shared_ptr<select_t> select_object;
+			readSelectType( SnapshotArgument( &item_node, arg.sections() ), select_object, defaultType, mapEntities, errorStream, entityIdNotFound );
+			if( select_object )
+			{
+				vec.push_back( select_object );
+			}
+		}
+		return;
+	}
+	if( arg.kind() == SNAPSHOT_LIST )
+	{
+		for( size_t ii = 0; ii < arg.size(); ++ii )
+		{
+			shared_ptr<select_t> select_object;
+			try
+			{
+				readSelectType( arg.child( ii ), select_object, defaultType, mapEntities, errorStream, entityIdNotFound );
+			}
+			catch( BuildingException& e )
+			{
+				errorStream << e.what();
+			}
+			if( select_object )
+			{
+				vec.push_back( select_object );
+			}
+		}
+		return;
+	}
+	readSelectList( arg.toString(), vec, defaultType, mapEntities, errorStream, entityIdNotFound );
+}
@@ -27,6 +27,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "ifcpp/model/BasicTypes.h"
 #include "ifcpp/model/BuildingObject.h"
 #include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/Trace.h"
 #include "ifcpp/writer/WriterUtil.h"
 #include "IfcProduct.h"
 #include "IfcProject.h"
@@ -38,9 +39,14 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 void WriterSTEP::writeModelToStream(std::stringstream& stream, shared_ptr<BuildingModel> model)
 {
+	IFCPP_TRACE_SCOPE("WriterSTEP::writeModelToStream");
+
 	//imbue C locale to always use dots as decimal separator
 	stream.imbue(std::locale("C"));
 
+	// arguments of lazily loaded entities are written only after parsing them
+	model->materialize();
+
 	const std::string& file_header_str = model->getFileHeader();
 	if(file_header_str.size() == 0)
 	{
@@ -54,14 +60,11 @@ void WriterSTEP::writeModelToStream(std::stringstream& stream, shared_ptr<Buildi
 	stream << std::setiosflags(std::ios::showpoint);
 	stream << std::fixed;
 
-	const std::unordered_map<int, shared_ptr<BuildingEntity> >& mapEntities = model->getMapIfcEntities();
-	std::map<int, shared_ptr<BuildingEntity> > mapEntitiesAscendingTags;
-	for (auto it : mapEntities)
-	{
-		mapEntitiesAscendingTags.insert(it);
-	}
+	// entity map is ordered by tag
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities = model->getMapIfcEntities();
 	std::vector<std::tuple<int, shared_ptr<BuildingEntity>, std::string>> entityDataStrings;
-	for (auto entity : mapEntitiesAscendingTags)
+	entityDataStrings.reserve(mapEntities.size());
+	for (const auto& entity : mapEntities)
 	{
 		entityDataStrings.push_back(std::tuple<int, shared_ptr<BuildingEntity>, std::string>(entity.first, entity.second, ""));
 	}
@@ -70,7 +73,7 @@ void WriterSTEP::writeModelToStream(std::stringstream& stream, shared_ptr<Buildi
 	auto t_start = std::chrono::high_resolution_clock::now();
 	std::atomic<int> counter = 0;
 	size_t numEntities = entityDataStrings.size();
-	FOR_EACH_LOOP entityDataStrings.begin(), entityDataStrings.end(), [&, this](std::tuple<int, shared_ptr<BuildingEntity>, std::string>& entityDataForOutput) {
+	Executor::get( m_executor ).forEach( entityDataStrings.begin(), entityDataStrings.end(), [&, this](std::tuple<int, shared_ptr<BuildingEntity>, std::string>& entityDataForOutput) {
 		shared_ptr<BuildingEntity> obj = std::get<1>(entityDataForOutput);
 		if (obj.use_count() < 2)
 		{
@@ -105,7 +108,7 @@ void WriterSTEP::writeModelToStream(std::stringstream& stream, shared_ptr<Buildi
 				progressValueCallback(progress, "parse");
 			}
 		}
-		});
+		}, m_grainSize );
 
 	for (auto line : entityDataStrings)
 	{
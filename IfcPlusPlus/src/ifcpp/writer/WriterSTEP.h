@@ -18,6 +18,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #pragma once
 
 #include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/Executor.h"
 #include "ifcpp/model/StatusCallback.h"
 
 class IFCQUERY_EXPORT WriterSTEP : public StatusCallback
@@ -26,6 +27,14 @@ public:
 	WriterSTEP() = default;
 	~WriterSTEP() = default;
 	virtual void writeModelToStream( std::stringstream& stream, shared_ptr<BuildingModel> model );
-	
+
+	/*\brief Executor for the parallel loops, see Executor. If not set, Executor::getDefault() is used.
+	  \param[in] grainSize Number of entities per task, 0 to choose it from the number of entities and threads. **/
+	void setExecutor( const shared_ptr<Executor>& executor, size_t grainSize = 0 ) { m_executor = executor; m_grainSize = grainSize; }
+
 	size_t m_writeNumberPrecision = 15;
+
+protected:
+	shared_ptr<Executor>	m_executor;
+	size_t					m_grainSize = 0;
 };
@@ -0,0 +1,251 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "ifcpp/model/AttributeObject.h"
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingException.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/SnapshotFormat.h"
+#include "ifcpp/reader/ReaderUtil.h"
+#include "ifcpp/writer/WriterUtil.h"
+#include "ifcpp/writer/WriterSnapshot.h"
+
+SnapshotNode BuildingObject::getBinaryParameter( SnapshotEncoder& encoder ) const
+{
+	// same text as in a STEP line, decoded like ReaderSTEP passes it to createObjectFromSTEP
+	std::stringstream stream;
+	stream.imbue( std::locale::classic() );
+	getStepParameter( stream, false, STEP_PRECISION_ROUND_TRIP );
+	std::string arg;
+	decodeArgumentString( stream.str(), arg );
+	return encoder.encodeTyped( classID(), encoder.encodeText( arg ) );
+}
+
+SnapshotNode BuildingEntity::getBinaryParameter( SnapshotEncoder& /*encoder*/ ) const
+{
+	return SnapshotEncoder::encodeReference( m_tag );
+}
+
+/** Encodes the attributes of an entity into the nodes of its arguments, which are allocated before */
+class SnapshotArgumentVisitor : public AttributeVisitor
+{
+public:
+	SnapshotArgumentVisitor( SnapshotEncoder& encoder, size_t firstNode, size_t numArguments ) : m_encoder( encoder ), m_first_node( firstNode ), m_num_arguments( numArguments )
+	{
+	}
+
+	void visitObject( size_t index, const char* /*name*/, const shared_ptr<BuildingObject>& value ) override
+	{
+		setArgument( index, m_encoder.encodeObject( value.get() ) );
+	}
+
+	void visitList( size_t index, const char* /*name*/, const AttributeListView& list ) override
+	{
+		setArgument( index, m_encoder.encodeList( list ) );
+	}
+
+	void visitList2D( size_t index, const char* /*name*/, const AttributeList2DView& list ) override
+	{
+		setArgument( index, m_encoder.encodeList2D( list ) );
+	}
+
+	void visitInteger( size_t index, const char* /*name*/, int value ) override
+	{
+		setArgument( index, SnapshotEncoder::encodeInteger( value, 0 ) );
+	}
+
+	void visitReals( size_t index, const char* /*name*/, const double* values, size_t size ) override
+	{
+		setArgument( index, m_encoder.encodeRealArray( values, size ) );
+	}
+
+private:
+	void setArgument( size_t index, const SnapshotNode& node )
+	{
+		if( index < m_num_arguments )
+		{
+			m_encoder.m_nodes[m_first_node + index] = node;
+		}
+	}
+
+	SnapshotEncoder&	m_encoder;
+	size_t				m_first_node;
+	size_t				m_num_arguments;
+};
+
+/** Entities of one range of the parallel loop, encoded independently of the other ranges */
+struct SnapshotRange
+{
+	size_t						m_begin = 0;
+	std::vector<SnapshotEntity>	m_records;
+	SnapshotEncoder				m_encoder;
+};
+
+/** Appends the arrays of range to encoder, and moves the offsets of nodes and records accordingly */
+static void appendRange( SnapshotEncoder& encoder, std::vector<SnapshotEntity>& records, SnapshotRange& range )
+{
+	const uint64_t node_base = encoder.m_nodes.size();
+	const uint64_t word_base = encoder.m_words.size();
+	const uint64_t string_base = encoder.m_strings.size();
+	for( SnapshotNode node : range.m_encoder.m_nodes )
+	{
+		switch( node.m_kind )
+		{
+		case SNAPSHOT_LIST:
+		case SNAPSHOT_TYPED:
+			node.m_offset += node_base;
+			break;
+		case SNAPSHOT_REFERENCE_ARRAY:
+		case SNAPSHOT_INTEGER_ARRAY:
+		case SNAPSHOT_REAL_ARRAY:
+			node.m_offset += word_base;
+			break;
+		case SNAPSHOT_TEXT:
+		case SNAPSHOT_STRING:
+			node.m_offset += string_base;
+			break;
+		default:
+			break;
+		}
+		encoder.m_nodes.push_back( node );
+	}
+	encoder.m_words.insert( encoder.m_words.end(), range.m_encoder.m_words.begin(), range.m_encoder.m_words.end() );
+	encoder.m_strings += range.m_encoder.m_strings;
+	for( SnapshotEntity record : range.m_records )
+	{
+		record.m_first_argument += uint32_t( node_base );
+		records.push_back( record );
+	}
+	range = SnapshotRange();
+}
+
+static void writePadded( std::ostream& stream, const void* data, size_t size )
+{
+	stream.write( static_cast<const char*>( data ), size );
+	const char padding[8] = { 0 };
+	if( size % 8 != 0 )
+	{
+		stream.write( padding, 8 - size % 8 );
+	}
+}
+
+void WriterSnapshot::writeModelToStream( std::ostream& stream, shared_ptr<BuildingModel> model )
+{
+	// arguments of lazily loaded entities are written only after parsing them
+	model->materialize();
+
+	// entity map is ordered by tag
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& mapEntities = model->getMapIfcEntities();
+	std::vector<BuildingEntity*> vec_entities;
+	vec_entities.reserve( mapEntities.size() );
+	for( const auto& it : mapEntities )
+	{
+		if( it.second )
+		{
+			vec_entities.push_back( it.second.get() );
+		}
+	}
+
+	// attributes are encoded directly from the entities, each range of entities into its own arrays
+	std::vector<SnapshotRange> vec_ranges;
+	std::mutex mutex_ranges;
+	Executor::get( m_executor ).parallelForRange( 0, vec_entities.size(), m_grainSize, [&]( size_t rangeBegin, size_t rangeEnd ) {
+		SnapshotRange range;
+		range.m_begin = rangeBegin;
+		range.m_records.reserve( rangeEnd - rangeBegin );
+		SnapshotEncoder& encoder = range.m_encoder;
+		for( size_t ii = rangeBegin; ii < rangeEnd; ++ii )
+		{
+			const BuildingEntity* entity = vec_entities[ii];
+			const size_t num_arguments = entity->getNumAttributes();
+			const size_t first_node = encoder.m_nodes.size();
+
+			// all attributes are visited, unset ones stay $
+			encoder.m_nodes.resize( first_node + num_arguments, SnapshotEncoder::makeNode( SNAPSHOT_NULL, 0 ) );
+			SnapshotArgumentVisitor visitor( encoder, first_node, num_arguments );
+			entity->visitAttributes( visitor );
+
+			SnapshotEntity record;
+			record.m_class_id = entity->classID();
+			record.m_tag = entity->m_tag;
+			record.m_first_argument = uint32_t( first_node );
+			record.m_num_arguments = uint32_t( num_arguments );
+			range.m_records.push_back( record );
+		}
+
+		const std::lock_guard<std::mutex> lock( mutex_ranges );
+		vec_ranges.push_back( std::move( range ) );
+	});
+	progressValueCallback( 0.5, "write" );
+
+	std::sort( vec_ranges.begin(), vec_ranges.end(), []( const SnapshotRange& a, const SnapshotRange& b ) { return a.m_begin < b.m_begin; } );
+	SnapshotEncoder encoder;
+	std::vector<SnapshotEntity> vec_records;
+	vec_records.reserve( vec_entities.size() );
+	for( SnapshotRange& range : vec_ranges )
+	{
+		appendRange( encoder, vec_records, range );
+		if( encoder.m_nodes.size() > std::numeric_limits<uint32_t>::max() )
+		{
+			messageCallback( "Model too large for snapshot", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+			return;
+		}
+	}
+
+	SnapshotFileHeader header;
+	std::memset( &header, 0, sizeof(SnapshotFileHeader) );
+	std::memcpy( header.m_magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC) );
+	header.m_version = SNAPSHOT_VERSION;
+	header.m_byte_order_mark = SNAPSHOT_BYTE_ORDER_MARK;
+	header.m_schema_version_loaded_file = uint32_t( model->getIfcSchemaVersionEnumOfLoadedFile() );
+	header.m_file_header = encoder.addString( model->getFileHeader() );
+	header.m_file_description = encoder.addString( model->getFileDescription() );
+	header.m_file_name = encoder.addString( model->getFileName() );
+	header.m_num_entities = vec_records.size();
+	header.m_num_nodes = encoder.m_nodes.size();
+	header.m_num_words = encoder.m_words.size();
+	header.m_string_pool_size = encoder.m_strings.size();
+
+	writePadded( stream, &header, sizeof(SnapshotFileHeader) );
+	writePadded( stream, vec_records.data(), vec_records.size()*sizeof(SnapshotEntity) );
+	writePadded( stream, encoder.m_nodes.data(), encoder.m_nodes.size()*sizeof(SnapshotNode) );
+	writePadded( stream, encoder.m_words.data(), encoder.m_words.size()*sizeof(uint64_t) );
+	writePadded( stream, encoder.m_strings.data(), encoder.m_strings.size() );
+	progressValueCallback( 1.0, "write" );
+}
+
+void WriterSnapshot::writeModelToFile( const std::string& filePath, shared_ptr<BuildingModel> model )
+{
+	std::ofstream outfile( filePath.c_str(), std::ofstream::out | std::ofstream::binary );
+	if( !outfile.is_open() )
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePath;
+		messageCallback( strs.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		return;
+	}
+	writeModelToStream( outfile, model );
+}
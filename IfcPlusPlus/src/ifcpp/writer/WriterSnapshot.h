@@ -0,0 +1,46 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <ostream>
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/Executor.h"
+#include "ifcpp/model/StatusCallback.h"
+
+/*! \brief Writes a model as binary snapshot (see SnapshotFormat.h), which ReaderSnapshot loads without parsing STEP text.
+*
+* All entities of the model are written, including entities that are not referenced. Attributes are encoded from the entities without STEP text, see BuildingObject::getBinaryParameter.
+* Reals are stored with full precision, so the loaded model has the same values as the written one.
+* A snapshot is meant as cache of an unchanged model, for example next to the IFC file. It is not an exchange format: it depends on the generated IFC classes and the byte order of the machine.
+*/
+class IFCQUERY_EXPORT WriterSnapshot : public StatusCallback
+{
+public:
+	WriterSnapshot() = default;
+	~WriterSnapshot() = default;
+	virtual void writeModelToStream( std::ostream& stream, shared_ptr<BuildingModel> model );
+	void writeModelToFile( const std::string& filePath, shared_ptr<BuildingModel> model );
+
+	/*\brief Executor for the parallel loops, see Executor. If not set, Executor::getDefault() is used.
+	  \param[in] grainSize Number of entities per task, 0 to choose it from the number of entities and threads. **/
+	void setExecutor( const shared_ptr<Executor>& executor, size_t grainSize = 0 ) { m_executor = executor; m_grainSize = grainSize; }
+
+protected:
+	shared_ptr<Executor>	m_executor;
+	size_t					m_grainSize = 0;
+};
@@ -15,7 +15,10 @@ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTH
 LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -24,8 +27,29 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "ifcpp/model/BuildingObject.h"
 #include "WriterUtil.h"
 
+size_t writeRealRoundTrip(char* buffer, const double number)
+{
+	std::to_chars_result result = std::to_chars(buffer, buffer + STEP_REAL_ROUND_TRIP_MAX_LENGTH - 1, number);
+	char* end = result.ptr;
+	char* exponent = std::find(buffer, end, 'e');
+	if (std::isfinite(number) && std::find(buffer, exponent, '.') == exponent)
+	{
+		std::memmove(exponent + 1, exponent, end - exponent);
+		*exponent = '.';
+		++end;
+	}
+	return end - buffer;
+}
+
 void appendRealWithoutTrailingZeros(std::stringstream& stream, const double number, size_t precision)
 {
+	if (precision == STEP_PRECISION_ROUND_TRIP)
+	{
+		char buffer[STEP_REAL_ROUND_TRIP_MAX_LENGTH];
+		stream.write(buffer, writeRealRoundTrip(buffer, number));
+		return;
+	}
+
 	std::ostringstream temp;
 	temp.imbue(std::locale("C"));
 	temp.precision(precision);
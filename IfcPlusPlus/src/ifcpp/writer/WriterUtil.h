@@ -27,6 +27,14 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 IFCQUERY_EXPORT std::string encodeStepString(const std::string& str);
 
+/** Precision for getStepLine and getStepParameter: reals are written with the shortest text that reads back to the same value, instead of a fixed number of decimals */
+static const size_t STEP_PRECISION_ROUND_TRIP = size_t(-1);
+
+/** Writes number with the shortest text that reads back to the same value, with a decimal point as required by STEP: 1 -> 1.   1e-07 -> 1.e-07   2.5 -> 2.5
+  The exponent is written in lower case. buffer needs space for STEP_REAL_ROUND_TRIP_MAX_LENGTH characters. Returns the number of characters written */
+static const size_t STEP_REAL_ROUND_TRIP_MAX_LENGTH = 32;
+IFCQUERY_EXPORT size_t writeRealRoundTrip(char* buffer, const double number);
+
 IFCQUERY_EXPORT void appendRealWithoutTrailingZeros(std::stringstream& stream, const double number, size_t precision);
 void writeRealList(std::stringstream& stream, const std::vector<double>& vec, bool optionalAttribute, size_t precision);
 void writeRealArray3(std::stringstream& stream, const double(&vec)[3], bool optionalAttribute, size_t precision);
@@ -0,0 +1,49 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <sstream>
+#include <ifcpp/reader/ReaderUtil.h>
+
+#include "FuzzCheck.h"
+#include "ReaderUtilReference.h"
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size )
+{
+	const std::string input( reinterpret_cast<const char*>( data ), size );
+
+	std::vector<std::string> lines;
+	std::istringstream stream( input );
+	std::string line;
+	while( bufferedGetStepLine( stream, line ) )
+	{
+		lines.push_back( line );
+	}
+
+	std::vector<std::string> lines_reference;
+	std::istringstream stream_reference( input );
+	while( ReaderUtilReference::bufferedGetStepLine( stream_reference, line ) )
+	{
+		lines_reference.push_back( line );
+	}
+
+	if( lines != lines_reference )
+	{
+		reportMismatch( "bufferedGetStepLine", input );
+	}
+	return 0;
+}
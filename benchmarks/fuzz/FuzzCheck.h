@@ -0,0 +1,69 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Helpers for the fuzz targets: a mismatch between the library and the reference implementation aborts, so that libFuzzer stores the input.
+
+inline void reportMismatch( const char* what, const std::string& input )
+{
+	std::cerr << "mismatch in " << what << " for input (" << input.size() << " bytes):" << std::endl << input << std::endl;
+	std::abort();
+}
+
+inline bool isEqualReal( double a, double b )
+{
+	return a == b || ( std::isnan( a ) && std::isnan( b ) );
+}
+
+inline bool isEqualReals( const std::vector<double>& a, const std::vector<double>& b )
+{
+	if( a.size() != b.size() )
+	{
+		return false;
+	}
+	for( size_t ii = 0; ii < a.size(); ++ii )
+	{
+		if( !isEqualReal( a[ii], b[ii] ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+inline bool isEqualReals( const std::vector<std::vector<double> >& a, const std::vector<std::vector<double> >& b )
+{
+	if( a.size() != b.size() )
+	{
+		return false;
+	}
+	for( size_t ii = 0; ii < a.size(); ++ii )
+	{
+		if( !isEqualReals( a[ii], b[ii] ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,56 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <ifcpp/reader/ReaderUtil.h>
+
+#include "FuzzCheck.h"
+#include "ReaderUtilReference.h"
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size )
+{
+	const std::string input( reinterpret_cast<const char*>( data ), size );
+
+	std::string decoded;
+	decodeArgumentString( input, decoded );
+	std::string decoded_reference;
+	ReaderUtilReference::decodeArgumentString( input, decoded_reference );
+	if( decoded != decoded_reference )
+	{
+		reportMismatch( "decodeArgumentString", input );
+	}
+
+	// decodeArgumentStrings on the tokenized arguments, as in ReaderSTEP
+	std::vector<std::string> entity_arguments;
+	tokenizeEntityArguments( input, entity_arguments );
+	std::vector<std::string> args_decoded;
+	decodeArgumentStrings( entity_arguments, args_decoded );
+	std::vector<std::string> args_decoded_reference;
+	for( const std::string& argument : entity_arguments )
+	{
+		if( !argument.empty() )
+		{
+			args_decoded_reference.emplace_back();
+			ReaderUtilReference::decodeArgumentString( argument, args_decoded_reference.back() );
+		}
+	}
+	if( args_decoded != args_decoded_reference )
+	{
+		reportMismatch( "decodeArgumentStrings", input );
+	}
+	return 0;
+}
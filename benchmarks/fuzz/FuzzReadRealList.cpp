@@ -0,0 +1,91 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <ifcpp/reader/ReaderUtil.h>
+
+#include "FuzzCheck.h"
+#include "ReaderUtilReference.h"
+
+// stand-in for the generated real types like IfcLengthMeasure
+struct FuzzReal
+{
+	FuzzReal( double value ) : m_value( value ) {}
+	double m_value;
+};
+
+// Runs both implementations. Throwing an exception is part of the behavior, so either both throw, or both return the same values.
+template<typename T, typename F, typename G>
+void checkEquivalence( const std::string& input, const char* what, F library, G reference )
+{
+	T result;
+	bool thrown = false;
+	try
+	{
+		library( input, result );
+	}
+	catch( std::exception& )
+	{
+		thrown = true;
+	}
+
+	T result_reference;
+	bool thrown_reference = false;
+	try
+	{
+		reference( input, result_reference );
+	}
+	catch( std::exception& )
+	{
+		thrown_reference = true;
+	}
+
+	if( thrown != thrown_reference || ( !thrown && !isEqualReals( result, result_reference ) ) )
+	{
+		reportMismatch( what, input );
+	}
+}
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size )
+{
+	const std::string input( reinterpret_cast<const char*>( data ), size );
+
+	checkEquivalence<std::vector<double> >( input, "readRealList",
+		[]( const std::string& str, std::vector<double>& vec ) { readRealList( str, vec ); },
+		[]( const std::string& str, std::vector<double>& vec ) { ReaderUtilReference::readRealList( str, vec ); } );
+
+	checkEquivalence<std::vector<std::vector<double> > >( input, "readRealList2D",
+		[]( const std::string& str, std::vector<std::vector<double> >& vec ) { readRealList2D( str, vec ); },
+		[]( const std::string& str, std::vector<std::vector<double> >& vec ) { ReaderUtilReference::readRealList2D( str, vec ); } );
+
+	checkEquivalence<std::vector<std::vector<double> > >( input, "readTypeOfRealList2D",
+		[]( const std::string& str, std::vector<std::vector<double> >& vec )
+		{
+			std::vector<std::vector<shared_ptr<FuzzReal> > > target_vec;
+			readTypeOfRealList2D( str, target_vec );
+			for( auto& inner : target_vec )
+			{
+				vec.emplace_back();
+				for( auto& item : inner )
+				{
+					vec.back().push_back( item->m_value );
+				}
+			}
+		},
+		[]( const std::string& str, std::vector<std::vector<double> >& vec ) { ReaderUtilReference::readTypeOfRealList2D( str, vec ); } );
+	return 0;
+}
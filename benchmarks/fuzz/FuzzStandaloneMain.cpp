@@ -0,0 +1,90 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "ReaderUtilCorpus.h"
+
+// Driver for compilers without libFuzzer. Runs the fuzz target on the given files, or on all files in the given directories,
+// for example the crash inputs that libFuzzer stored. Without arguments, it runs the built-in corpus of ReaderUtilCorpus.h.
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size );
+
+static void runInput( const std::string& input )
+{
+	LLVMFuzzerTestOneInput( reinterpret_cast<const uint8_t*>( input.data() ), input.size() );
+}
+
+static void runFile( const std::filesystem::path& path )
+{
+	std::ifstream ifs( path, std::ios::binary );
+	std::string input( ( std::istreambuf_iterator<char>( ifs ) ), std::istreambuf_iterator<char>() );
+	runInput( input );
+}
+
+int main( int argc, char* argv[] )
+{
+	size_t num_inputs = 0;
+	if( argc < 2 )
+	{
+		std::vector<std::string> inputs = getEntityArgumentsCorpus();
+		inputs.push_back( createPointListArgument( 100, 3 ) );
+		inputs.push_back( createPointListArgument( 100, 2 ) );
+		inputs.push_back( createEncodedStringArgument( 3 ) );
+		inputs.push_back( createStepDataSection( 12 ) );
+		for( const std::string& input : inputs )
+		{
+			runInput( input );
+
+			// all prefixes, to cover truncated arguments and unterminated escape sequences
+			for( size_t length = 0; length < input.size() && length < 256; ++length )
+			{
+				runInput( input.substr( 0, length ) );
+			}
+			++num_inputs;
+		}
+	}
+
+	for( int ii = 1; ii < argc; ++ii )
+	{
+		std::filesystem::path path( argv[ii] );
+		if( std::filesystem::is_directory( path ) )
+		{
+			for( auto& entry : std::filesystem::directory_iterator( path ) )
+			{
+				if( entry.is_regular_file() )
+				{
+					runFile( entry.path() );
+					++num_inputs;
+				}
+			}
+		}
+		else
+		{
+			runFile( path );
+			++num_inputs;
+		}
+	}
+	std::cout << argv[0] << ": " << num_inputs << " inputs without mismatch" << std::endl;
+	return 0;
+}
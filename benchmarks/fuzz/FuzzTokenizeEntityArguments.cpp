@@ -0,0 +1,48 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <ifcpp/reader/ReaderUtil.h>
+
+#include "FuzzCheck.h"
+#include "ReaderUtilReference.h"
+
+extern "C" int LLVMFuzzerTestOneInput( const uint8_t* data, size_t size )
+{
+	const std::string input( reinterpret_cast<const char*>( data ), size );
+
+	std::vector<std::string> entity_arguments;
+	tokenizeEntityArguments( input, entity_arguments );
+	std::vector<std::string> entity_arguments_reference;
+	ReaderUtilReference::tokenizeEntityArguments( input, entity_arguments_reference );
+	if( entity_arguments != entity_arguments_reference )
+	{
+		reportMismatch( "tokenizeEntityArguments", input );
+	}
+
+	// findEndOfString expects the position of the opening quote
+	const std::string quoted = "'" + input;
+	const char* stream_pos = quoted.c_str();
+	findEndOfString( stream_pos );
+	const char* stream_pos_reference = quoted.c_str();
+	ReaderUtilReference::findEndOfString( stream_pos_reference );
+	if( stream_pos != stream_pos_reference )
+	{
+		reportMismatch( "findEndOfString", quoted );
+	}
+	return 0;
+}
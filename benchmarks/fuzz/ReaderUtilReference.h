@@ -0,0 +1,39 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <istream>
+#include <string>
+#include <vector>
+
+/** \brief Reference implementations of the ReaderUtil tokenizers.
+  These are copies of the implementations in ReaderUtil.cpp and ReaderUtil.h before any optimization. The fuzzers compare the library
+  functions against them, so a faster tokenizer can replace the one in ReaderUtil as long as the fuzzers find no input with a different result.
+  Do not change these copies when optimizing ReaderUtil. Change them only together with an intended change of behavior, like the stricter conversion of reals in readRealValue. */
+namespace ReaderUtilReference
+{
+	void findEndOfString( const char*& stream_pos );
+	void tokenizeEntityArguments( const std::string& argument_str, std::vector<std::string>& entity_arguments );
+	void decodeArgumentString( const std::string& argument_str, std::string& arg_out );
+	std::istream& bufferedGetStepLine( std::istream& inputStream, std::string& lineOut );
+	void readRealList( const std::string& str, std::vector<double>& vec );
+	void readRealList2D( const std::string& str, std::vector<std::vector<double> >& vec );
+
+	/** \brief Same as the template readTypeOfRealList2D<T>, with double instead of shared_ptr<T> */
+	void readTypeOfRealList2D( const std::string& str, std::vector<std::vector<double> >& target_vec );
+}
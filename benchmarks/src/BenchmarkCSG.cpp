@@ -0,0 +1,61 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <ifcpp/geometry/CSG_Adapter.h>
+#include <ifcpp/geometry/GeometrySettings.h>
+#include <ifcpp/geometry/MeshOps.h>
+
+// Wall-like box with a row of window-like boxes subtracted, the typical CSG case of IfcRelVoidsElement.
+// The benchmark argument is the number of subtracted boxes.
+
+static shared_ptr<carve::mesh::MeshSet<3> > createBox( double x, double y, double z, double dx, double dy, double dz )
+{
+	vec3 pos = carve::geom::VECTOR( x + dx*0.5, y + dy*0.5, z + dz*0.5 );
+	vec3 extent = carve::geom::VECTOR( dx*0.5, dy*0.5, dz*0.5 );
+	carve::math::Matrix identity( carve::math::Matrix::IDENT() );
+	return MeshOps::createBoxMesh( pos, extent, identity, 1.5e-9 );
+}
+
+static void BM_CSG_Adapter_subtractBoxes( benchmark::State& state )
+{
+	const int num_openings = static_cast<int>( state.range( 0 ) );
+	const double wall_length = 1.0*num_openings + 0.5;
+
+	std::vector<shared_ptr<carve::mesh::MeshSet<3> > > openings;
+	for( int ii = 0; ii < num_openings; ++ii )
+	{
+		openings.push_back( createBox( 0.25 + ii*1.0, -0.1, 0.9, 0.6, 0.45, 1.2 ) );
+	}
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	GeomProcessingParams params( geom_settings );
+	size_t num_faces = 0;
+	for( auto _ : state )
+	{
+		state.PauseTiming();
+		shared_ptr<carve::mesh::MeshSet<3> > wall = createBox( 0, 0, 0, wall_length, 0.25, 3.0 );
+		state.ResumeTiming();
+
+		CSG_Adapter::computeCSG( wall, openings, carve::csg::CSG::A_MINUS_B, params );
+		num_faces = MeshOps::countFaces( wall.get() );
+	}
+	state.counters["faces"] = double( num_faces );
+}
+
+BENCHMARK( BM_CSG_Adapter_subtractBoxes )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
@@ -0,0 +1,212 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSnapshot.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/writer/WriterSnapshot.h>
+#include <ifcpp/writer/WriterSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+#include "SyntheticModel.h"
+
+// The benchmark argument is the number of storeys of the synthetic model, the other parameters keep their defaults.
+// Each storey adds a fixed set of walls with openings, furniture, rebars and breps, so the model size grows linearly.
+
+static SyntheticModelParams getSyntheticModelParams( int64_t numStoreys )
+{
+	SyntheticModelParams params;
+	params.numStoreys = static_cast<int>( numStoreys );
+	return params;
+}
+
+static const std::string& getSyntheticModelSTEP( int64_t numStoreys )
+{
+	static std::map<int64_t, std::string> cache;
+	auto it = cache.find( numStoreys );
+	if( it == cache.end() )
+	{
+		it = cache.insert( { numStoreys, createSyntheticModelSTEP( getSyntheticModelParams( numStoreys ) ) } ).first;
+	}
+	return it->second;
+}
+
+static void loadSyntheticModel( int64_t numStoreys, shared_ptr<BuildingModel>& ifc_model )
+{
+	const std::string& content = getSyntheticModelSTEP( numStoreys );
+	std::istringstream stream( content );
+	shared_ptr<ReaderSTEP> step_reader( new ReaderSTEP() );
+	step_reader->loadModelFromStream( stream, content.size(), ifc_model );
+}
+
+static void BM_ReaderSTEP_load( benchmark::State& state )
+{
+	const std::string& content = getSyntheticModelSTEP( state.range( 0 ) );
+	size_t num_entities = 0;
+	for( auto _ : state )
+	{
+		shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+		std::istringstream stream( content );
+		shared_ptr<ReaderSTEP> step_reader( new ReaderSTEP() );
+		step_reader->loadModelFromStream( stream, content.size(), ifc_model );
+		num_entities = ifc_model->getMapIfcEntities().size();
+
+		state.PauseTiming();
+		ifc_model.reset();
+		state.ResumeTiming();
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( content.size() ) );
+	state.counters["entities"] = double( num_entities );
+}
+
+static std::string writeModelToSTEP( shared_ptr<BuildingModel>& ifc_model )
+{
+	std::stringstream stream;
+	shared_ptr<WriterSTEP> step_writer( new WriterSTEP() );
+	step_writer->writeModelToStream( stream, ifc_model );
+	return stream.str();
+}
+
+// snapshot of the synthetic model, in 8 byte words because ReaderSnapshot needs aligned data
+static std::vector<uint64_t> writeModelToSnapshot( shared_ptr<BuildingModel>& ifc_model, size_t& num_bytes )
+{
+	std::stringstream stream;
+	shared_ptr<WriterSnapshot> snapshot_writer( new WriterSnapshot() );
+	snapshot_writer->writeModelToStream( stream, ifc_model );
+	const std::string content = stream.str();
+	num_bytes = content.size();
+	std::vector<uint64_t> words( ( num_bytes + 7 ) / 8 );
+	std::memcpy( words.data(), content.data(), num_bytes );
+	return words;
+}
+
+// Same model as BM_ReaderSTEP_load, read from a snapshot in memory. Before timing, the snapshot is checked: the model read from it has to give the same STEP output as the model read from STEP
+static void BM_ReaderSnapshot_load( benchmark::State& state )
+{
+	shared_ptr<BuildingModel> step_model( new BuildingModel() );
+	loadSyntheticModel( state.range( 0 ), step_model );
+	size_t num_bytes = 0;
+	const std::vector<uint64_t> snapshot = writeModelToSnapshot( step_model, num_bytes );
+	const char* data = reinterpret_cast<const char*>( snapshot.data() );
+
+	shared_ptr<BuildingModel> snapshot_model( new BuildingModel() );
+	shared_ptr<ReaderSnapshot> check_reader( new ReaderSnapshot() );
+	check_reader->loadModelFromBuffer( data, num_bytes, snapshot_model );
+	if( writeModelToSTEP( snapshot_model ) != writeModelToSTEP( step_model ) )
+	{
+		state.SkipWithError( "STEP output of the model read from the snapshot differs from the original" );
+		return;
+	}
+	step_model.reset();
+	snapshot_model.reset();
+
+	size_t num_entities = 0;
+	for( auto _ : state )
+	{
+		shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+		shared_ptr<ReaderSnapshot> snapshot_reader( new ReaderSnapshot() );
+		snapshot_reader->loadModelFromBuffer( data, num_bytes, ifc_model );
+		num_entities = ifc_model->getMapIfcEntities().size();
+
+		state.PauseTiming();
+		ifc_model.reset();
+		state.ResumeTiming();
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( num_bytes ) );
+	state.counters["entities"] = double( num_entities );
+}
+
+static void BM_WriterSTEP_write( benchmark::State& state )
+{
+	shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+	loadSyntheticModel( state.range( 0 ), ifc_model );
+	size_t num_bytes = 0;
+	for( auto _ : state )
+	{
+		std::stringstream stream;
+		shared_ptr<WriterSTEP> step_writer( new WriterSTEP() );
+		step_writer->writeModelToStream( stream, ifc_model );
+		num_bytes = stream.str().size();
+		benchmark::DoNotOptimize( num_bytes );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( num_bytes ) );
+	state.counters["entities"] = double( ifc_model->getMapIfcEntities().size() );
+}
+
+static void BM_WriterSnapshot_write( benchmark::State& state )
+{
+	shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+	loadSyntheticModel( state.range( 0 ), ifc_model );
+	size_t num_bytes = 0;
+	for( auto _ : state )
+	{
+		std::stringstream stream;
+		shared_ptr<WriterSnapshot> snapshot_writer( new WriterSnapshot() );
+		snapshot_writer->writeModelToStream( stream, ifc_model );
+		num_bytes = size_t( stream.tellp() );
+		benchmark::DoNotOptimize( num_bytes );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( num_bytes ) );
+	state.counters["entities"] = double( ifc_model->getMapIfcEntities().size() );
+}
+
+static void BM_BuildingModel_resolveInverseAttributes( benchmark::State& state )
+{
+	shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+	loadSyntheticModel( state.range( 0 ), ifc_model );
+	for( auto _ : state )
+	{
+		state.PauseTiming();
+		ifc_model->unsetInverseAttributes();
+		state.ResumeTiming();
+
+		ifc_model->resolveInverseAttributes();
+	}
+	state.counters["entities"] = double( ifc_model->getMapIfcEntities().size() );
+}
+
+static void BM_GeometryConverter_convertGeometry( benchmark::State& state )
+{
+	shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+	loadSyntheticModel( state.range( 0 ), ifc_model );
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	size_t num_products = 0;
+	for( auto _ : state )
+	{
+		shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( ifc_model, geom_settings ) );
+		geometry_converter->convertGeometry();
+		num_products = geometry_converter->getShapeInputData().size();
+
+		state.PauseTiming();
+		geometry_converter.reset();
+		state.ResumeTiming();
+	}
+	state.counters["products"] = double( num_products );
+}
+
+BENCHMARK( BM_ReaderSTEP_load )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_ReaderSnapshot_load )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_WriterSTEP_write )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_WriterSnapshot_write )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_BuildingModel_resolveInverseAttributes )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_GeometryConverter_convertGeometry )->Arg( 1 )->Arg( 4 )->Unit( benchmark::kMillisecond )->UseRealTime();
@@ -0,0 +1,189 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <benchmark/benchmark.h>
+
+#include <ifcpp/reader/ReaderUtil.h>
+#include <ifcpp/IFC4X3/include/IfcLengthMeasure.h>
+
+#include "ReaderUtilCorpus.h"
+
+// Micro benchmarks for the tokenizers in ReaderUtil. Sizes are in the benchmark argument, bytes per second make runs with different sizes comparable.
+
+static void BM_tokenizeEntityArguments_corpus( benchmark::State& state )
+{
+	const std::vector<std::string>& corpus = getEntityArgumentsCorpus();
+	int64_t num_bytes = 0;
+	for( const std::string& arguments : corpus )
+	{
+		num_bytes += arguments.size();
+	}
+
+	std::vector<std::string> entity_arguments;
+	for( auto _ : state )
+	{
+		for( const std::string& arguments : corpus )
+		{
+			entity_arguments.clear();
+			tokenizeEntityArguments( arguments, entity_arguments );
+			benchmark::DoNotOptimize( entity_arguments.data() );
+		}
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*num_bytes );
+}
+
+static void BM_tokenizeEntityArguments_pointList( benchmark::State& state )
+{
+	// IfcCartesianPointList3D: the point list is one argument, the tokenizer has to scan it completely
+	const std::string arguments = createPointListArgument( static_cast<int>( state.range( 0 ) ), 3 ) + ",$";
+	std::vector<std::string> entity_arguments;
+	for( auto _ : state )
+	{
+		entity_arguments.clear();
+		tokenizeEntityArguments( arguments, entity_arguments );
+		benchmark::DoNotOptimize( entity_arguments.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( arguments.size() ) );
+}
+
+static void BM_tokenizeEntityArguments_encodedString( benchmark::State& state )
+{
+	const std::string arguments = createEncodedStringArgument( static_cast<int>( state.range( 0 ) ) ) + ",$,.T.";
+	std::vector<std::string> entity_arguments;
+	for( auto _ : state )
+	{
+		entity_arguments.clear();
+		tokenizeEntityArguments( arguments, entity_arguments );
+		benchmark::DoNotOptimize( entity_arguments.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( arguments.size() ) );
+}
+
+static void BM_findEndOfString( benchmark::State& state )
+{
+	const std::string argument = createEncodedStringArgument( static_cast<int>( state.range( 0 ) ) );
+	for( auto _ : state )
+	{
+		const char* stream_pos = argument.c_str();
+		findEndOfString( stream_pos );
+		benchmark::DoNotOptimize( stream_pos );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( argument.size() ) );
+}
+
+static void BM_decodeArgumentString( benchmark::State& state )
+{
+	const std::string argument = createEncodedStringArgument( static_cast<int>( state.range( 0 ) ) );
+	std::string decoded;
+	for( auto _ : state )
+	{
+		decoded.clear();
+		decodeArgumentString( argument, decoded );
+		benchmark::DoNotOptimize( decoded.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( argument.size() ) );
+}
+
+static void BM_decodeArgumentStrings_corpus( benchmark::State& state )
+{
+	std::vector<std::string> entity_arguments;
+	for( const std::string& arguments : getEntityArgumentsCorpus() )
+	{
+		tokenizeEntityArguments( arguments, entity_arguments );
+	}
+	int64_t num_bytes = 0;
+	for( const std::string& argument : entity_arguments )
+	{
+		num_bytes += argument.size();
+	}
+
+	std::vector<std::string> decoded;
+	for( auto _ : state )
+	{
+		decoded.clear();
+		decodeArgumentStrings( entity_arguments, decoded );
+		benchmark::DoNotOptimize( decoded.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*num_bytes );
+}
+
+static void BM_bufferedGetStepLine( benchmark::State& state )
+{
+	const std::string content = createStepDataSection( static_cast<int>( state.range( 0 ) ) );
+	std::string line;
+	for( auto _ : state )
+	{
+		std::istringstream stream( content );
+		while( bufferedGetStepLine( stream, line ) )
+		{
+			benchmark::DoNotOptimize( line.data() );
+		}
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( content.size() ) );
+}
+
+static void BM_readRealList2D( benchmark::State& state )
+{
+	const std::string argument = createPointListArgument( static_cast<int>( state.range( 0 ) ), 3 );
+	std::vector<std::vector<double> > points;
+	for( auto _ : state )
+	{
+		points.clear();
+		readRealList2D( argument, points );
+		benchmark::DoNotOptimize( points.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( argument.size() ) );
+	state.SetItemsProcessed( int64_t( state.iterations() )*state.range( 0 ) );
+}
+
+static void BM_readTypeOfRealList2D( benchmark::State& state )
+{
+	const std::string argument = createPointListArgument( static_cast<int>( state.range( 0 ) ), 3 );
+	std::vector<std::vector<shared_ptr<IFC4X3::IfcLengthMeasure> > > points;
+	for( auto _ : state )
+	{
+		points.clear();
+		readTypeOfRealList2D( argument, points );
+		benchmark::DoNotOptimize( points.data() );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( argument.size() ) );
+	state.SetItemsProcessed( int64_t( state.iterations() )*state.range( 0 ) );
+}
+
+static void BM_readRealArray( benchmark::State& state )
+{
+	const std::string argument = "(1234.5678,-0.0001,0.125E2)";
+	double coordinates[3];
+	for( auto _ : state )
+	{
+		readRealArray( argument, coordinates );
+		benchmark::DoNotOptimize( coordinates );
+	}
+	state.SetBytesProcessed( int64_t( state.iterations() )*int64_t( argument.size() ) );
+}
+
+BENCHMARK( BM_tokenizeEntityArguments_corpus );
+BENCHMARK( BM_tokenizeEntityArguments_pointList )->Arg( 16 )->Arg( 1024 )->Arg( 65536 );
+BENCHMARK( BM_tokenizeEntityArguments_encodedString )->Arg( 1 )->Arg( 64 );
+BENCHMARK( BM_findEndOfString )->Arg( 1 )->Arg( 64 );
+BENCHMARK( BM_decodeArgumentString )->Arg( 1 )->Arg( 64 );
+BENCHMARK( BM_decodeArgumentStrings_corpus );
+BENCHMARK( BM_bufferedGetStepLine )->Arg( 1024 )->Arg( 65536 );
+BENCHMARK( BM_readRealList2D )->Arg( 16 )->Arg( 1024 )->Arg( 65536 );
+BENCHMARK( BM_readTypeOfRealList2D )->Arg( 16 )->Arg( 1024 )->Arg( 65536 );
+BENCHMARK( BM_readRealArray );
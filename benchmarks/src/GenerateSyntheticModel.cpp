@@ -0,0 +1,44 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "SyntheticModel.h"
+
+// usage: GenerateSyntheticModel <output.ifc> [numStoreys]
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: " << argv[0] << " <output.ifc> [numStoreys]" << std::endl;
+		return 1;
+	}
+
+	SyntheticModelParams params;
+	if( argc > 2 )
+	{
+		params.numStoreys = std::stoi( argv[2] );
+	}
+
+	std::ofstream ofs( argv[1], std::ofstream::out );
+	ofs << createSyntheticModelSTEP( params );
+	ofs.close();
+	std::cout << "synthetic model " << params.getName() << " written to " << argv[1] << std::endl;
+	return 0;
+}
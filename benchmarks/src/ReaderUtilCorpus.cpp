@@ -0,0 +1,131 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include "ReaderUtilCorpus.h"
+
+std::string createPointListArgument( int numPoints, int dimension )
+{
+	// coordinates in the different notations that exporters write: 1., 1.5, -2.25, 1.E-3, 0.125E2
+	static const char* coordinates[] = { "0.", "1.5", "-2.25", "1.E-3", "1234.5678", "0.125E2", "-0.0001", "42." };
+	const size_t num_coordinates = sizeof( coordinates )/sizeof( coordinates[0] );
+
+	std::stringstream strs;
+	strs << "(";
+	size_t coordinate_index = 0;
+	for( int ii = 0; ii < numPoints; ++ii )
+	{
+		if( ii > 0 )
+		{
+			strs << ",";
+		}
+		strs << "(";
+		for( int jj = 0; jj < dimension; ++jj )
+		{
+			if( jj > 0 )
+			{
+				strs << ",";
+			}
+			strs << coordinates[coordinate_index % num_coordinates];
+			++coordinate_index;
+		}
+		strs << ")";
+	}
+	strs << ")";
+	return strs.str();
+}
+
+std::string createEncodedStringArgument( int numRepetitions )
+{
+	std::stringstream strs;
+	strs << "'";
+	for( int ii = 0; ii < numRepetitions; ++ii )
+	{
+		strs << "Heizk\\S\\vrper pot\\X2\\00EA\\X0\\ncia \\X2\\00C400D600DC\\X0\\ Stra\\X\\DFe \\X4\\0001F600\\X0\\ it''s \\N\\ ";
+	}
+	strs << "'";
+	return strs.str();
+}
+
+const std::vector<std::string>& getEntityArgumentsCorpus()
+{
+	static const std::vector<std::string> corpus =
+	{
+		// IfcWall
+		"'2XQ$n5SLP5MBLyL442paFx',#2,'Wall xyz','Description of Wall',$,#46,#51,'ID test',.STANDARD.",
+		// IfcPropertySingleValue with nested select
+		"'Reference',$,IFCIDENTIFIER('W-01'),$",
+		"'Width',$,IFCPOSITIVELENGTHMEASURE(0.25),#30",
+		"'Fire rating',$,IFCLABEL('EI 90, (tested)'),$",
+		// IfcShapeRepresentation with reference list
+		"#20,'Body','SweptSolid',(#120,#121,#122)",
+		// IfcCartesianPoint and IfcDirection
+		"(0.,0.,3850.)",
+		"(1.,0.,0.)",
+		// IfcPropertyListValue with a list of selects
+		"'Dimensions',$,(IFCLENGTHMEASURE(1.),IFCLENGTHMEASURE(2.5),IFCLENGTHMEASURE(-3.E-2)),$",
+		// strings with escaped quotes, backslashes, parentheses and commas
+		"'it''s a (test), really','C:\\\\path\\\\file.ifc',$",
+		"'pot\\X2\\00EA\\X0\\ncia','Heizk\\S\\vrper','\\X4\\0001F600\\X0\\'",
+		// IfcIndexedPolygonalFace and IfcPolygonalFaceSet
+		"(1,2,3,4)",
+		"#10,$,(#11,#12,#13),$",
+		// derived and omitted values
+		"*,*,*,$,.T.,.F.,.U.",
+		// empty string and empty list
+		"'',()",
+		// reals that readRealValue converts differently than std::stod: hexadecimal, second sign, subnormal, overflow, underflow, missing exponent
+		"(0x10)",
+		"(+-1)",
+		"(1e-310)",
+		"(0X1p3)",
+		"(1.E)",
+		"(1e400,-1e-400)",
+		"( 1.5 , +2.)",
+		"((0x10,1.),(1e-310,+-1))",
+	};
+	return corpus;
+}
+
+std::string createStepDataSection( int numLines )
+{
+	std::stringstream strs;
+	for( int ii = 0; ii < numLines; ++ii )
+	{
+		switch( ii % 6 )
+		{
+		case 0:
+			strs << "#" << ii + 1 << "= IFCCARTESIANPOINT((" << ii << ".,0.5," << ii*0.25 << "));\n";
+			break;
+		case 1:
+			strs << "#" << ii + 1 << "= IFCPOLYLOOP((#" << ii << ",#" << ii - 1 << ",#2,#3));\r\n";
+			break;
+		case 2:
+			strs << "/* comment with ; and ' inside */\n#" << ii + 1 << "= IFCLABEL('a; b');\n";
+			break;
+		case 3:
+			strs << "#" << ii + 1 << "= IFCWALL('2XQ$n5SLP5MBLyL442paFx',#2,'Wall; \\X2\\00C4\\X0\\','it''s',$,#46,#51,$,.STANDARD.);\r";
+			break;
+		case 4:
+			strs << "#" << ii + 1 << "= IFCPROPERTYSINGLEVALUE('Width',$,\n\tIFCPOSITIVELENGTHMEASURE(0.25),$);\n";
+			break;
+		default:
+			strs << "#" << ii + 1 << "=IFCSHAPEREPRESENTATION(#20,'Body','SweptSolid',(#120,#121));\n";
+		}
+	}
+	return strs.str();
+}
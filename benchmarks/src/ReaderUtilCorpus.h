@@ -0,0 +1,36 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Argument shapes as they occur in real STEP files, for the ReaderUtil benchmarks and as seeds for the fuzzers.
+
+/** \brief Point list argument like in IfcCartesianPointList3D: ((0.,1.5,-2.25),(...),...) */
+std::string createPointListArgument( int numPoints, int dimension );
+
+/** \brief String argument with the STEP escape sequences \X2\, \X4\, \X\, \S\ and \N\ between plain text */
+std::string createEncodedStringArgument( int numRepetitions );
+
+/** \brief Arguments of typical entities, without the surrounding parentheses, for example the arguments of IfcWall, IfcPropertySingleValue with a
+  nested select, IfcShapeRepresentation with a reference list, and a string with escaped quotes */
+const std::vector<std::string>& getEntityArgumentsCorpus();
+
+/** \brief DATA section lines like in a STEP file, with comments, strings containing semicolons, and different line endings */
+std::string createStepDataSection( int numLines );
@@ -0,0 +1,450 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/writer/WriterSTEP.h>
+
+#include <ifcpp/IFC4X3/include/IfcAxis2Placement2D.h>
+#include <ifcpp/IFC4X3/include/IfcAxis2Placement3D.h>
+#include <ifcpp/IFC4X3/include/IfcBoolean.h>
+#include <ifcpp/IFC4X3/include/IfcBuilding.h>
+#include <ifcpp/IFC4X3/include/IfcBuildingElementProxy.h>
+#include <ifcpp/IFC4X3/include/IfcBuildingStorey.h>
+#include <ifcpp/IFC4X3/include/IfcCartesianPoint.h>
+#include <ifcpp/IFC4X3/include/IfcCartesianTransformationOperator3D.h>
+#include <ifcpp/IFC4X3/include/IfcClosedShell.h>
+#include <ifcpp/IFC4X3/include/IfcDimensionCount.h>
+#include <ifcpp/IFC4X3/include/IfcDirection.h>
+#include <ifcpp/IFC4X3/include/IfcExtrudedAreaSolid.h>
+#include <ifcpp/IFC4X3/include/IfcFace.h>
+#include <ifcpp/IFC4X3/include/IfcFaceOuterBound.h>
+#include <ifcpp/IFC4X3/include/IfcFacetedBrep.h>
+#include <ifcpp/IFC4X3/include/IfcFurniture.h>
+#include <ifcpp/IFC4X3/include/IfcGeometricRepresentationContext.h>
+#include <ifcpp/IFC4X3/include/IfcGloballyUniqueId.h>
+#include <ifcpp/IFC4X3/include/IfcIdentifier.h>
+#include <ifcpp/IFC4X3/include/IfcLabel.h>
+#include <ifcpp/IFC4X3/include/IfcLengthMeasure.h>
+#include <ifcpp/IFC4X3/include/IfcLocalPlacement.h>
+#include <ifcpp/IFC4X3/include/IfcMappedItem.h>
+#include <ifcpp/IFC4X3/include/IfcOpeningElement.h>
+#include <ifcpp/IFC4X3/include/IfcOrganization.h>
+#include <ifcpp/IFC4X3/include/IfcOwnerHistory.h>
+#include <ifcpp/IFC4X3/include/IfcPerson.h>
+#include <ifcpp/IFC4X3/include/IfcPersonAndOrganization.h>
+#include <ifcpp/IFC4X3/include/IfcPolyline.h>
+#include <ifcpp/IFC4X3/include/IfcPolyLoop.h>
+#include <ifcpp/IFC4X3/include/IfcPositiveLengthMeasure.h>
+#include <ifcpp/IFC4X3/include/IfcProductDefinitionShape.h>
+#include <ifcpp/IFC4X3/include/IfcProfileTypeEnum.h>
+#include <ifcpp/IFC4X3/include/IfcProject.h>
+#include <ifcpp/IFC4X3/include/IfcPropertySet.h>
+#include <ifcpp/IFC4X3/include/IfcPropertySingleValue.h>
+#include <ifcpp/IFC4X3/include/IfcReal.h>
+#include <ifcpp/IFC4X3/include/IfcRectangleProfileDef.h>
+#include <ifcpp/IFC4X3/include/IfcReinforcingBar.h>
+#include <ifcpp/IFC4X3/include/IfcRelAggregates.h>
+#include <ifcpp/IFC4X3/include/IfcRelContainedInSpatialStructure.h>
+#include <ifcpp/IFC4X3/include/IfcRelDefinesByProperties.h>
+#include <ifcpp/IFC4X3/include/IfcRelVoidsElement.h>
+#include <ifcpp/IFC4X3/include/IfcRepresentationMap.h>
+#include <ifcpp/IFC4X3/include/IfcShapeRepresentation.h>
+#include <ifcpp/IFC4X3/include/IfcSite.h>
+#include <ifcpp/IFC4X3/include/IfcSIUnit.h>
+#include <ifcpp/IFC4X3/include/IfcSIUnitName.h>
+#include <ifcpp/IFC4X3/include/IfcSweptDiskSolid.h>
+#include <ifcpp/IFC4X3/include/IfcText.h>
+#include <ifcpp/IFC4X3/include/IfcUnitAssignment.h>
+#include <ifcpp/IFC4X3/include/IfcUnitEnum.h>
+#include <ifcpp/IFC4X3/include/IfcWall.h>
+
+#include "SyntheticModel.h"
+
+using namespace IFC4X3;
+
+std::string SyntheticModelParams::getName() const
+{
+	std::stringstream strs;
+	strs << numStoreys << "x(" << numWallsPerStorey << "w" << numOpeningsPerWall << "o," << numFurniturePerStorey << "f," << numRebarsPerStorey << "r," << numBrepsPerStorey << "b" << numBrepSegments << ")";
+	return strs.str();
+}
+
+namespace
+{
+	class SyntheticModelBuilder
+	{
+	public:
+		std::vector<shared_ptr<BuildingEntity> > m_new_entities;
+		int m_guid_counter = 0;
+
+		template<typename T>
+		shared_ptr<T> create()
+		{
+			shared_ptr<T> entity( new T() );
+			m_new_entities.push_back( entity );
+			return entity;
+		}
+
+		shared_ptr<IfcGloballyUniqueId> createGuid()
+		{
+			// 32 hex digits from a counter instead of a random UUID, so that repeated runs produce identical models
+			char hex[40];
+			snprintf( hex, sizeof( hex ), "%032X", ++m_guid_counter );
+			return shared_ptr<IfcGloballyUniqueId>( new IfcGloballyUniqueId( compressGUID( hex ) ) );
+		}
+
+		shared_ptr<IfcCartesianPoint> createPoint( double x, double y )
+		{
+			shared_ptr<IfcCartesianPoint> pt = create<IfcCartesianPoint>();
+			pt->m_Coordinates[0] = x;
+			pt->m_Coordinates[1] = y;
+			pt->m_Coordinates[2] = std::nan( "" );
+			return pt;
+		}
+
+		shared_ptr<IfcCartesianPoint> createPoint( double x, double y, double z )
+		{
+			shared_ptr<IfcCartesianPoint> pt = create<IfcCartesianPoint>();
+			pt->m_Coordinates[0] = x;
+			pt->m_Coordinates[1] = y;
+			pt->m_Coordinates[2] = z;
+			return pt;
+		}
+
+		shared_ptr<IfcDirection> createDirection( double x, double y, double z )
+		{
+			shared_ptr<IfcDirection> dir = create<IfcDirection>();
+			dir->m_DirectionRatios.push_back( shared_ptr<IfcReal>( new IfcReal( x ) ) );
+			dir->m_DirectionRatios.push_back( shared_ptr<IfcReal>( new IfcReal( y ) ) );
+			dir->m_DirectionRatios.push_back( shared_ptr<IfcReal>( new IfcReal( z ) ) );
+			return dir;
+		}
+
+		shared_ptr<IfcAxis2Placement3D> createAxis2Placement3D( double x, double y, double z )
+		{
+			shared_ptr<IfcAxis2Placement3D> axis2placement3d = create<IfcAxis2Placement3D>();
+			axis2placement3d->m_Location = createPoint( x, y, z );
+			axis2placement3d->m_Axis = createDirection( 0, 0, 1 );
+			axis2placement3d->m_RefDirection = createDirection( 1, 0, 0 );
+			return axis2placement3d;
+		}
+
+		shared_ptr<IfcLocalPlacement> createLocalPlacement( double x, double y, double z, shared_ptr<IfcObjectPlacement> placement_rel_to )
+		{
+			shared_ptr<IfcLocalPlacement> local_placement = create<IfcLocalPlacement>();
+			local_placement->m_RelativePlacement = createAxis2Placement3D( x, y, z );
+			local_placement->m_PlacementRelTo = placement_rel_to;
+			return local_placement;
+		}
+
+		shared_ptr<IfcProductDefinitionShape> createProductShape( const std::string& representation_type, shared_ptr<IfcRepresentationItem> item )
+		{
+			shared_ptr<IfcShapeRepresentation> shape_representation = create<IfcShapeRepresentation>();
+			shape_representation->m_RepresentationIdentifier = shared_ptr<IfcLabel>( new IfcLabel( "Body" ) );
+			shape_representation->m_RepresentationType = shared_ptr<IfcLabel>( new IfcLabel( representation_type ) );
+			shape_representation->m_Items.push_back( item );
+
+			shared_ptr<IfcProductDefinitionShape> product_def_shape = create<IfcProductDefinitionShape>();
+			product_def_shape->m_Representations.push_back( shape_representation );
+			return product_def_shape;
+		}
+
+		/** \brief Box with its lower left corner at (x,y,z), as an IfcExtrudedAreaSolid with IfcRectangleProfileDef */
+		shared_ptr<IfcExtrudedAreaSolid> createBox( double x, double y, double z, double dx, double dy, double dz )
+		{
+			shared_ptr<IfcRectangleProfileDef> profile = create<IfcRectangleProfileDef>();
+			profile->m_ProfileType = shared_ptr<IfcProfileTypeEnum>( new IfcProfileTypeEnum( IfcProfileTypeEnum::ENUM_AREA ) );
+			profile->m_Position = create<IfcAxis2Placement2D>();
+			profile->m_Position->m_Location = createPoint( dx*0.5, dy*0.5 );
+			profile->m_XDim = shared_ptr<IfcPositiveLengthMeasure>( new IfcPositiveLengthMeasure( dx ) );
+			profile->m_YDim = shared_ptr<IfcPositiveLengthMeasure>( new IfcPositiveLengthMeasure( dy ) );
+
+			shared_ptr<IfcExtrudedAreaSolid> extruded_solid = create<IfcExtrudedAreaSolid>();
+			extruded_solid->m_SweptArea = profile;
+			extruded_solid->m_Position = createAxis2Placement3D( x, y, z );
+			extruded_solid->m_ExtrudedDirection = createDirection( 0, 0, 1 );
+			extruded_solid->m_Depth = shared_ptr<IfcPositiveLengthMeasure>( new IfcPositiveLengthMeasure( dz ) );
+			return extruded_solid;
+		}
+
+		shared_ptr<IfcFace> createFace( const std::vector<shared_ptr<IfcCartesianPoint> >& polygon )
+		{
+			shared_ptr<IfcPolyLoop> poly_loop = create<IfcPolyLoop>();
+			poly_loop->m_Polygon = polygon;
+
+			shared_ptr<IfcFaceOuterBound> face_bound = create<IfcFaceOuterBound>();
+			face_bound->m_Bound = poly_loop;
+			face_bound->m_Orientation = shared_ptr<IfcBoolean>( new IfcBoolean( true ) );
+
+			shared_ptr<IfcFace> face = create<IfcFace>();
+			face->m_Bounds.push_back( face_bound );
+			return face;
+		}
+
+		/** \brief Prism with a regular polygon as base, as an IfcFacetedBrep with num_segments side faces */
+		shared_ptr<IfcFacetedBrep> createPrismBrep( double radius, double height, int num_segments )
+		{
+			std::vector<shared_ptr<IfcCartesianPoint> > bottom;
+			std::vector<shared_ptr<IfcCartesianPoint> > top;
+			for( int ii = 0; ii < num_segments; ++ii )
+			{
+				double angle = 2.0*M_PI*double( ii )/double( num_segments );
+				double x = radius*cos( angle );
+				double y = radius*sin( angle );
+				bottom.push_back( createPoint( x, y, 0 ) );
+				top.push_back( createPoint( x, y, height ) );
+			}
+
+			shared_ptr<IfcClosedShell> closed_shell = create<IfcClosedShell>();
+			closed_shell->m_CfsFaces.push_back( createFace( std::vector<shared_ptr<IfcCartesianPoint> >( bottom.rbegin(), bottom.rend() ) ) );
+			closed_shell->m_CfsFaces.push_back( createFace( top ) );
+			for( int ii = 0; ii < num_segments; ++ii )
+			{
+				int next = ( ii + 1 ) % num_segments;
+				closed_shell->m_CfsFaces.push_back( createFace( { bottom[ii], bottom[next], top[next], top[ii] } ) );
+			}
+
+			shared_ptr<IfcFacetedBrep> faceted_brep = create<IfcFacetedBrep>();
+			faceted_brep->m_Outer = closed_shell;
+			return faceted_brep;
+		}
+
+		/** \brief Bar bent up and down along the x axis, as an IfcSweptDiskSolid along an IfcPolyline */
+		shared_ptr<IfcSweptDiskSolid> createRebar( double length, double radius )
+		{
+			shared_ptr<IfcPolyline> directrix = create<IfcPolyline>();
+			const int num_bends = 4;
+			for( int ii = 0; ii <= num_bends; ++ii )
+			{
+				directrix->m_Points.push_back( createPoint( length*double( ii )/double( num_bends ), 0, ( ii % 2 )*0.2 ) );
+			}
+
+			shared_ptr<IfcSweptDiskSolid> swept_disk_solid = create<IfcSweptDiskSolid>();
+			swept_disk_solid->m_Directrix = directrix;
+			swept_disk_solid->m_Radius = shared_ptr<IfcPositiveLengthMeasure>( new IfcPositiveLengthMeasure( radius ) );
+			return swept_disk_solid;
+		}
+
+		void addPropertySet( shared_ptr<IfcObjectDefinition> object, int num_properties )
+		{
+			shared_ptr<IfcPropertySet> property_set = create<IfcPropertySet>();
+			property_set->m_Name = shared_ptr<IfcLabel>( new IfcLabel( "Pset_Synthetic" ) );
+			for( int ii = 0; ii < num_properties; ++ii )
+			{
+				shared_ptr<IfcPropertySingleValue> property = create<IfcPropertySingleValue>();
+				property->m_Name = shared_ptr<IfcIdentifier>( new IfcIdentifier( "Property" + std::to_string( ii ) ) );
+				if( ii % 2 == 0 )
+				{
+					property->m_NominalValue = shared_ptr<IfcReal>( new IfcReal( ii*0.5 ) );
+				}
+				else
+				{
+					property->m_NominalValue = shared_ptr<IfcLabel>( new IfcLabel( "Value" + std::to_string( ii ) ) );
+				}
+				property_set->m_HasProperties.push_back( property );
+			}
+
+			shared_ptr<IfcRelDefinesByProperties> rel_defines = create<IfcRelDefinesByProperties>();
+			rel_defines->m_RelatedObjects.push_back( object );
+			rel_defines->m_RelatingPropertyDefinition = property_set;
+		}
+	};
+}
+
+void createSyntheticModel( const SyntheticModelParams& params, shared_ptr<BuildingModel>& ifc_model )
+{
+	SyntheticModelBuilder builder;
+
+	const double wall_length = 5.0;
+	const double wall_thickness = 0.25;
+	const double storey_height = 3.0;
+	const double opening_width = 0.9;
+	const double opening_height = 1.2;
+
+	// spatial structure
+	shared_ptr<IfcProject> ifc_project = builder.create<IfcProject>();
+	ifc_project->m_Name = shared_ptr<IfcLabel>( new IfcLabel( "Synthetic " + params.getName() ) );
+	shared_ptr<IfcSite> ifc_site = builder.create<IfcSite>();
+	shared_ptr<IfcBuilding> ifc_building = builder.create<IfcBuilding>();
+
+	shared_ptr<IfcRelAggregates> rel_aggregates_project_site = builder.create<IfcRelAggregates>();
+	rel_aggregates_project_site->m_RelatingObject = ifc_project;
+	rel_aggregates_project_site->m_RelatedObjects.push_back( ifc_site );
+
+	shared_ptr<IfcRelAggregates> rel_aggregates_site_building = builder.create<IfcRelAggregates>();
+	rel_aggregates_site_building->m_RelatingObject = ifc_site;
+	rel_aggregates_site_building->m_RelatedObjects.push_back( ifc_building );
+
+	shared_ptr<IfcRelAggregates> rel_aggregates_building_storeys = builder.create<IfcRelAggregates>();
+	rel_aggregates_building_storeys->m_RelatingObject = ifc_building;
+
+	shared_ptr<IfcAxis2Placement3D> axis_placement_origin = builder.createAxis2Placement3D( 0, 0, 0 );
+	shared_ptr<IfcLocalPlacement> global_placement = builder.create<IfcLocalPlacement>();
+	global_placement->m_RelativePlacement = axis_placement_origin;
+	ifc_site->m_ObjectPlacement = global_placement;
+	ifc_building->m_ObjectPlacement = builder.createLocalPlacement( 0, 0, 0, global_placement );
+
+	// all furniture shares the same representation map, placed by an IfcMappedItem each
+	shared_ptr<IfcShapeRepresentation> furniture_representation = builder.create<IfcShapeRepresentation>();
+	furniture_representation->m_RepresentationIdentifier = shared_ptr<IfcLabel>( new IfcLabel( "Body" ) );
+	furniture_representation->m_RepresentationType = shared_ptr<IfcLabel>( new IfcLabel( "SweptSolid" ) );
+	furniture_representation->m_Items.push_back( builder.createBox( 0, 0, 0, 1.2, 0.6, 0.75 ) );
+
+	shared_ptr<IfcRepresentationMap> furniture_map = builder.create<IfcRepresentationMap>();
+	furniture_map->m_MappingOrigin = builder.createAxis2Placement3D( 0, 0, 0 );
+	furniture_map->m_MappedRepresentation = furniture_representation;
+
+	for( int storey_index = 0; storey_index < params.numStoreys; ++storey_index )
+	{
+		shared_ptr<IfcBuildingStorey> storey = builder.create<IfcBuildingStorey>();
+		storey->m_Name = shared_ptr<IfcLabel>( new IfcLabel( "Storey " + std::to_string( storey_index ) ) );
+		storey->m_ObjectPlacement = builder.createLocalPlacement( 0, 0, storey_index*storey_height, ifc_building->m_ObjectPlacement );
+		rel_aggregates_building_storeys->m_RelatedObjects.push_back( storey );
+
+		shared_ptr<IfcRelContainedInSpatialStructure> rel_contained = builder.create<IfcRelContainedInSpatialStructure>();
+		rel_contained->m_RelatingStructure = storey;
+
+		// walls in parallel rows, each with openings that need a boolean subtraction
+		for( int ii = 0; ii < params.numWallsPerStorey; ++ii )
+		{
+			shared_ptr<IfcWall> wall = builder.create<IfcWall>();
+			wall->m_Name = shared_ptr<IfcLabel>( new IfcLabel( "Wall " + std::to_string( ii ) ) );
+			wall->m_ObjectPlacement = builder.createLocalPlacement( ( ii % 10 )*( wall_length + 1.0 ), ( ii / 10 )*2.0, 0, storey->m_ObjectPlacement );
+			wall->m_Representation = builder.createProductShape( "SweptSolid", builder.createBox( 0, 0, 0, wall_length, wall_thickness, storey_height ) );
+			rel_contained->m_RelatedElements.push_back( wall );
+
+			if( params.numPropertiesPerSet > 0 )
+			{
+				builder.addPropertySet( wall, params.numPropertiesPerSet );
+			}
+
+			double opening_spacing = wall_length/double( params.numOpeningsPerWall + 1 );
+			for( int jj = 0; jj < params.numOpeningsPerWall; ++jj )
+			{
+				double opening_x = opening_spacing*double( jj + 1 ) - opening_width*0.5;
+				shared_ptr<IfcOpeningElement> opening = builder.create<IfcOpeningElement>();
+				opening->m_ObjectPlacement = builder.createLocalPlacement( opening_x, -0.1, 0.9, wall->m_ObjectPlacement );
+				opening->m_Representation = builder.createProductShape( "SweptSolid", builder.createBox( 0, 0, 0, opening_width, wall_thickness + 0.2, opening_height ) );
+
+				shared_ptr<IfcRelVoidsElement> rel_voids = builder.create<IfcRelVoidsElement>();
+				rel_voids->m_RelatingBuildingElement = wall;
+				rel_voids->m_RelatedOpeningElement = opening;
+			}
+		}
+
+		for( int ii = 0; ii < params.numFurniturePerStorey; ++ii )
+		{
+			shared_ptr<IfcCartesianTransformationOperator3D> mapping_target = builder.create<IfcCartesianTransformationOperator3D>();
+			mapping_target->m_LocalOrigin = builder.createPoint( 0, 0, 0 );
+
+			shared_ptr<IfcMappedItem> mapped_item = builder.create<IfcMappedItem>();
+			mapped_item->m_MappingSource = furniture_map;
+			mapped_item->m_MappingTarget = mapping_target;
+
+			shared_ptr<IfcFurniture> furniture = builder.create<IfcFurniture>();
+			furniture->m_ObjectPlacement = builder.createLocalPlacement( ( ii % 10 )*1.5, -3.0 - ( ii / 10 )*1.0, 0, storey->m_ObjectPlacement );
+			furniture->m_Representation = builder.createProductShape( "MappedRepresentation", mapped_item );
+			rel_contained->m_RelatedElements.push_back( furniture );
+		}
+
+		for( int ii = 0; ii < params.numRebarsPerStorey; ++ii )
+		{
+			shared_ptr<IfcReinforcingBar> rebar = builder.create<IfcReinforcingBar>();
+			rebar->m_ObjectPlacement = builder.createLocalPlacement( 0, -6.0 - ii*0.1, 0.1, storey->m_ObjectPlacement );
+			rebar->m_Representation = builder.createProductShape( "AdvancedSweptSolid", builder.createRebar( 4.0, 0.008 ) );
+			rel_contained->m_RelatedElements.push_back( rebar );
+		}
+
+		for( int ii = 0; ii < params.numBrepsPerStorey; ++ii )
+		{
+			shared_ptr<IfcBuildingElementProxy> proxy = builder.create<IfcBuildingElementProxy>();
+			proxy->m_ObjectPlacement = builder.createLocalPlacement( ii*1.5, -10.0, 0, storey->m_ObjectPlacement );
+			proxy->m_Representation = builder.createProductShape( "Brep", builder.createPrismBrep( 0.5, storey_height, params.numBrepSegments ) );
+			rel_contained->m_RelatedElements.push_back( proxy );
+		}
+	}
+
+	// general objects
+	shared_ptr<IfcPerson> person = builder.create<IfcPerson>();
+	person->m_FamilyName = shared_ptr<IfcLabel>( new IfcLabel( "Synthetic" ) );
+	shared_ptr<IfcOrganization> orga = builder.create<IfcOrganization>();
+	orga->m_Name = shared_ptr<IfcLabel>( new IfcLabel( "IfcPlusPlus benchmarks" ) );
+	shared_ptr<IfcPersonAndOrganization> person_and_organization = builder.create<IfcPersonAndOrganization>();
+	person_and_organization->m_ThePerson = person;
+	person_and_organization->m_TheOrganization = orga;
+	shared_ptr<IfcOwnerHistory> owner_history = builder.create<IfcOwnerHistory>();
+	owner_history->m_OwningUser = person_and_organization;
+
+	shared_ptr<IfcSIUnit> unit_length = builder.create<IfcSIUnit>();
+	unit_length->m_UnitType = shared_ptr<IfcUnitEnum>( new IfcUnitEnum( IfcUnitEnum::ENUM_LENGTHUNIT ) );
+	unit_length->m_Name = shared_ptr<IfcSIUnitName>( new IfcSIUnitName( IfcSIUnitName::ENUM_METRE ) );
+	shared_ptr<IfcUnitAssignment> unit_assignment = builder.create<IfcUnitAssignment>();
+	unit_assignment->m_Units.push_back( unit_length );
+
+	shared_ptr<IfcGeometricRepresentationContext> geom_context = builder.create<IfcGeometricRepresentationContext>();
+	geom_context->m_ContextType = shared_ptr<IfcLabel>( new IfcLabel( "Model" ) );
+	geom_context->m_CoordinateSpaceDimension = shared_ptr<IfcDimensionCount>( new IfcDimensionCount( 3 ) );
+	geom_context->m_Precision = shared_ptr<IfcReal>( new IfcReal( 1.000E-5 ) );
+	geom_context->m_WorldCoordinateSystem = axis_placement_origin;
+
+	ifc_project->m_UnitsInContext = unit_assignment;
+	ifc_project->m_RepresentationContexts.push_back( geom_context );
+
+	ifc_model->clearIfcModel();
+	ifc_model->initFileHeader( "synthetic.ifc", "IfcPlusPlus" );
+	ifc_model->setIfcProject( ifc_project );
+
+	// insert entities into IFC model, in creation order so that tags are stable
+	int tag = 0;
+	for( auto& entity : builder.m_new_entities )
+	{
+		shared_ptr<IfcRoot> ifc_root_object = dynamic_pointer_cast<IfcRoot>( entity );
+		if( ifc_root_object )
+		{
+			ifc_root_object->m_GlobalId = builder.createGuid();
+			ifc_root_object->m_OwnerHistory = owner_history;
+		}
+
+		shared_ptr<IfcRepresentation> ifc_representation = dynamic_pointer_cast<IfcRepresentation>( entity );
+		if( ifc_representation )
+		{
+			ifc_representation->m_ContextOfItems = geom_context;
+		}
+
+		entity->m_tag = ++tag;
+		ifc_model->insertEntity( entity );
+	}
+
+	ifc_model->unsetInverseAttributes();
+	ifc_model->resolveInverseAttributes();
+}
+
+std::string createSyntheticModelSTEP( const SyntheticModelParams& params )
+{
+	shared_ptr<BuildingModel> ifc_model( new BuildingModel() );
+	createSyntheticModel( params, ifc_model );
+
+	std::stringstream stream;
+	shared_ptr<WriterSTEP> step_writer( new WriterSTEP() );
+	step_writer->writeModelToStream( stream, ifc_model );
+	return stream.str();
+}
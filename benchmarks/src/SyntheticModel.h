@@ -0,0 +1,44 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <ifcpp/model/BasicTypes.h>
+
+class BuildingModel;
+
+/** \brief Size of a synthetic model. The model has numStoreys storeys, each with the same set of elements */
+struct SyntheticModelParams
+{
+	int numStoreys = 2;
+	int numWallsPerStorey = 20;			// IfcWall with extruded rectangle profile
+	int numOpeningsPerWall = 2;			// IfcOpeningElement with extruded rectangle, subtracted from the wall
+	int numFurniturePerStorey = 20;		// IfcFurniture with an IfcMappedItem, all furniture shares one IfcRepresentationMap
+	int numRebarsPerStorey = 20;		// IfcReinforcingBar with IfcSweptDiskSolid along a polyline with bends
+	int numBrepsPerStorey = 5;			// IfcBuildingElementProxy with IfcFacetedBrep, a prism with numBrepSegments side faces
+	int numBrepSegments = 64;
+	int numPropertiesPerSet = 50;		// each wall has one IfcPropertySet with this number of IfcPropertySingleValue
+
+	std::string getName() const;
+};
+
+/** \brief Creates the model in code. GUIDs are derived from a counter, so the same parameters always give the same model */
+void createSyntheticModel( const SyntheticModelParams& params, shared_ptr<BuildingModel>& ifc_model );
+
+/** \brief Creates the model and returns it as STEP file content */
+std::string createSyntheticModelSTEP( const SyntheticModelParams& params );
@@ -1,4 +1,6 @@
 #include "ifc_parser.h"
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include <ifcpp/IFC4X3/EntityFactory.h>
@@ -90,16 +92,15 @@ int IfcParser::getEntitiesByTypeCount(const std::string& ifcType) {
         return 0;
     }
     
-    const auto& entities = m_ifc_model->getMapIfcEntities();
-    int count = 0;
-    
-    for (const auto& pair : entities) {
-        if (pair.second && EntityFactory::getStringForClassID(pair.second->classID()) == ifcType) {
-            count++;
-        }
+    // look up the class ID by name, then count with the per-class index of the model
+    std::string ifcTypeUpper = ifcType;
+    std::transform(ifcTypeUpper.begin(), ifcTypeUpper.end(), ifcTypeUpper.begin(), [](unsigned char c) { return (char)std::toupper(c); });
+    uint32_t classID = EntityFactory::getClassIDForEntityName(ifcTypeUpper);
+    if (classID == 0) {
+        return 0;
     }
     
-    return count;
+    return (int)m_ifc_model->getNumEntitiesOfType(classID);
 }
 
 std::string IfcParser::getBuildingHierarchy() {
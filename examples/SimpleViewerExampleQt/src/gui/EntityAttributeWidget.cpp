@@ -45,6 +45,18 @@
 #include "ScopedLockAndBlock.h"
 #include "EntityAttributeWidget.h"
 
+// checks if an entity has attributes to show, without collecting them
+class HasAttributesVisitor : public AttributeVisitor
+{
+public:
+	void visitObject(size_t, const char*, const shared_ptr<BuildingObject>&) override { m_has_attributes = true; }
+	void visitList(size_t, const char*, const AttributeListView&) override { m_has_attributes = true; }
+	void visitList2D(size_t, const char*, const AttributeList2DView&) override { m_has_attributes = true; }
+	void visitInteger(size_t, const char*, int) override { m_has_attributes = true; }
+	void visitReals(size_t, const char*, const double*, size_t) override { m_has_attributes = true; }
+	bool m_has_attributes = false;
+};
+
 class EditableTreeWidgetItem : public QTreeWidgetItem
 {
 public:
@@ -336,10 +348,10 @@ void EntityAttributeWidget::appendAttributeChildren(shared_ptr<BuildingObject>&
 		{
 			//m_map_item_objects.insert( std::make_pair( item, attribute_entity ) );
 
-			std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes_peek;
-			attribute_entity->getAttributes(vec_attributes_peek);
-			attribute_entity->getAttributesInverse(vec_attributes_peek);
-			if (vec_attributes_peek.size() > 0)
+			HasAttributesVisitor has_attributes;
+			attribute_entity->visitAttributes(has_attributes);
+			attribute_entity->visitAttributesInverse(has_attributes);
+			if (has_attributes.m_has_attributes)
 			{
 				item->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
 			}
@@ -831,7 +843,7 @@ void EntityAttributeWidget::slotTreewidgetSelectionChanged( QTreeWidgetItem* cur
 
 	return;
 	ScopedBoolToTrue block( m_block_selection_signals, m_block_counter );
-	const std::unordered_map<int,shared_ptr<BuildingEntity> >& map_ifc_objects = m_system->getGeometryConverter()->getBuildingModel()->getMapIfcEntities();
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_ifc_objects = m_system->getGeometryConverter()->getBuildingModel()->getMapIfcEntities();
 	
 	if( previous )
 	{
@@ -98,7 +98,7 @@ void IfcTreeWidget::slotTreewidgetSelectionChanged( QTreeWidgetItem* current, QT
 	{
 		return;
 	}
-	const std::unordered_map<int,shared_ptr<BuildingEntity> >& map_ifc_objects = m_system->getIfcModel()->getMapIfcEntities();
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_ifc_objects = m_system->getIfcModel()->getMapIfcEntities();
 
 	if (!m_system->isCtrlKeyDown())
 	{
@@ -146,7 +146,7 @@ void IfcTreeWidget::slotTreeWidgetItemDoubleClick( QTreeWidgetItem* item, int co
 		return;
 	}
 
-	const std::unordered_map<int,shared_ptr<BuildingEntity>>& map_ifc_objects = m_system->getIfcModel()->getMapIfcEntities();
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_ifc_objects = m_system->getIfcModel()->getMapIfcEntities();
 	const int id = item->text(1).toUInt();
 	auto it_find = map_ifc_objects.find(id);
 